@@ -1,41 +1,98 @@
 #include <iostream>
+#include <cstdio>
 #include <cstring>
 #include <cstdlib>
 #include "libretro.h"
+#include "libretro_state.h"
+#include "context.h"
 #include "file.h"
 #include "jagbios.h"
 #include "jagbios2.h"
 #include "jaguar.h"
 #include "dac.h"
 #include "dsp.h"
+#include "dspthread.h"
 #include "joystick.h"
 #include "log.h"
 #include "memory.h"
+#include "movie.h"
+#include "profile.h"
 #include "settings.h"
+#include "state.h"
 #include "tom.h"
+#include "tomthread.h"
 
 static bool failed_init;
-int videoWidth, videoHeight;
-uint32_t *videoBuffer = NULL;
-int game_width;
-int game_height;
-
-static retro_video_refresh_t video_cb;
-static retro_input_poll_t input_poll_cb;
-static retro_input_state_t input_state_cb;
-static retro_environment_t environ_cb;
-static retro_audio_sample_batch_t audio_batch_cb;
-
-void retro_set_video_refresh(retro_video_refresh_t cb) { video_cb = cb; }
+
+#ifndef MULTI_INSTANCE
+struct LibretroState libretroState;
+#endif
+
+#define videoWidth            (CONTEXT(libretro).videoWidth)
+#define videoHeight           (CONTEXT(libretro).videoHeight)
+#define videoBuffer           (CONTEXT(libretro).videoBuffer)
+#define game_width            (CONTEXT(libretro).game_width)
+#define game_height           (CONTEXT(libretro).game_height)
+
+#define video_cb              (CONTEXT(libretro).video_cb)
+#define input_poll_cb         (CONTEXT(libretro).input_poll_cb)
+#define input_state_cb        (CONTEXT(libretro).input_state_cb)
+#define environ_cb            (CONTEXT(libretro).environ_cb)
+#define audio_batch_cb        (CONTEXT(libretro).audio_batch_cb)
+
+#ifdef MULTI_INSTANCE
+// A frontend that doesn't know about contexts gets one made for it the first
+// time it calls in on a thread without one, so it gets the same core as ever
+static void ensure_context(void)
+{
+   if (!JaguarContextCurrent())
+      JaguarContextMakeCurrent(JaguarContextCreate());
+}
+#else
+static void ensure_context(void) {}
+#endif
+
+void retro_set_video_refresh(retro_video_refresh_t cb) { ensure_context(); video_cb = cb; }
 void retro_set_audio_sample(retro_audio_sample_t cb) { (void)cb; }
-void retro_set_audio_sample_batch(retro_audio_sample_batch_t cb) { audio_batch_cb = cb; }
-void retro_set_input_poll(retro_input_poll_t cb) { input_poll_cb = cb; }
-void retro_set_input_state(retro_input_state_t cb) { input_state_cb = cb; }
+void retro_set_audio_sample_batch(retro_audio_sample_batch_t cb) { ensure_context(); audio_batch_cb = cb; }
+void retro_set_input_poll(retro_input_poll_t cb) { ensure_context(); input_poll_cb = cb; }
+void retro_set_input_state(retro_input_state_t cb) { ensure_context(); input_state_cb = cb; }
+
+// Frame skipping: the skipped frames are still emulated in full, they just
+// don't get drawn. "auto" skips when the frontend's audio buffer is running
+// low (or, without that, when frames are taking too long), "manual" draws one
+// frame out of every frameskip interval + 1.
+#define frameskip_type        (CONTEXT(libretro).frameskip_type)
+#define frameskip_threshold   (CONTEXT(libretro).frameskip_threshold)
+#define frameskip_counter     (CONTEXT(libretro).frameskip_counter)
+#define can_dupe              (CONTEXT(libretro).can_dupe)
+
+#define audio_buff_status     (CONTEXT(libretro).audio_buff_status)
+#define audio_buff_active     (CONTEXT(libretro).audio_buff_active)
+#define audio_buff_occupancy  (CONTEXT(libretro).audio_buff_occupancy)
+#define audio_buff_underrun   (CONTEXT(libretro).audio_buff_underrun)
+static const retro_usec_t frame_time_reference = 1000000 / 60;
+#define frame_time_last       (CONTEXT(libretro).frame_time_last)
+
+// Input movies go in the save dir, named after the ROM's CRC like the EEPROMs
+#define movie_mode            (CONTEXT(libretro).movie_mode)
+#define game_loaded           (CONTEXT(libretro).game_loaded)
+
+static void audio_buff_status_cb(bool active, unsigned occupancy, bool underrun_likely)
+{
+   audio_buff_active    = active;
+   audio_buff_occupancy = occupancy;
+   audio_buff_underrun  = underrun_likely;
+}
 
-int doom_res_hack=0; // Doom Hack to double pixel if pwidth==8 (163*2)
+static void frame_time_cb(retro_usec_t usec)
+{
+   frame_time_last = usec;
+}
 
 void retro_set_environment(retro_environment_t cb)
 {
+   ensure_context();
    environ_cb = cb;
 
    struct retro_variable variables[] = {
@@ -43,11 +100,56 @@ void retro_set_environment(retro_environment_t cb)
          "virtualjaguar_usefastblitter",
          "Fast Blitter; disabled|enabled",
 
+      },
+      {
+         "virtualjaguar_blitter_shadow",
+         "Blitter Shadow Verification (slow); disabled|enabled",
+
       },
       {
          "virtualjaguar_doom_res_hack",
          "Doom Res Hack; disabled|enabled",
 
+      },
+      {
+         "virtualjaguar_risc_jit",
+         "GPU/DSP Recompiler (x86-64); disabled|enabled",
+
+      },
+      {
+         "virtualjaguar_dsp_thread",
+         "DSP Thread (experimental; audio lags a frame, so it won't match running without); disabled|enabled",
+
+      },
+      {
+         "virtualjaguar_render_threads",
+         "Threaded Video Conversion; disabled|enabled",
+
+      },
+      {
+         "virtualjaguar_profiler",
+         "Profiler (JSON log in save dir); disabled|enabled",
+
+      },
+      {
+         "virtualjaguar_frameskip",
+         "Frameskip; disabled|auto|manual",
+
+      },
+      {
+         "virtualjaguar_frameskip_threshold",
+         "Frameskip Threshold (%); 33|15|18|21|24|27|30|36|39|42|45|48|51|54|57|60",
+
+      },
+      {
+         "virtualjaguar_frameskip_interval",
+         "Frameskip Interval; 1|2|3|4|5|6|7|8|9",
+
+      },
+      {
+         "virtualjaguar_movie",
+         "Input Movie (in save dir); disabled|record|play",
+
       },
       { NULL, NULL },
    };
@@ -55,6 +157,88 @@ void retro_set_environment(retro_environment_t cb)
    cb(RETRO_ENVIRONMENT_SET_VARIABLES, variables);
 }
 
+// Auto frame skipping needs to know how full the frontend's audio buffer is,
+// & some audio latency to play with. If the frontend can't tell us about its
+// audio buffer, how long the last frame took will have to do.
+static void set_frameskip_callbacks(void)
+{
+   struct retro_audio_buffer_status_callback buf_status_cb;
+   struct retro_frame_time_callback frame_cb;
+   unsigned latency = 0;
+
+   buf_status_cb.callback = (frameskip_type == FRAMESKIP_AUTO ? audio_buff_status_cb : NULL);
+   audio_buff_status = environ_cb(RETRO_ENVIRONMENT_SET_AUDIO_BUFFER_STATUS_CALLBACK, &buf_status_cb)
+      && frameskip_type == FRAMESKIP_AUTO;
+   audio_buff_active = false;
+   audio_buff_occupancy = 0;
+   audio_buff_underrun = false;
+
+   if (frameskip_type == FRAMESKIP_AUTO)
+   {
+      // Six frames' worth, rounded up to a whole number of ms
+      latency = (unsigned)((6 * frame_time_reference + 999) / 1000);
+
+      if (!audio_buff_status)
+      {
+         frame_cb.callback = frame_time_cb;
+         frame_cb.reference = frame_time_reference;
+         environ_cb(RETRO_ENVIRONMENT_SET_FRAME_TIME_CALLBACK, &frame_cb);
+      }
+   }
+
+   frame_time_last = 0;
+   frameskip_counter = 0;
+   environ_cb(RETRO_ENVIRONMENT_SET_MINIMUM_AUDIO_LATENCY, &latency);
+}
+
+// Decides whether this frame gets drawn
+static bool render_this_frame(void)
+{
+   bool skip = false;
+
+   if (frameskip_type == FRAMESKIP_MANUAL)
+      skip = (frameskip_counter != 0);
+   else if (frameskip_type == FRAMESKIP_AUTO)
+   {
+      if (audio_buff_status)
+         skip = audio_buff_active && (audio_buff_underrun || audio_buff_occupancy < frameskip_threshold);
+      else
+         // Frames that come in more than a quarter late mean we can't keep up
+         skip = (frame_time_last > frame_time_reference + frame_time_reference / 4);
+
+      // Don't go so long without drawing anything that it looks like a hang
+      if (skip && frameskip_counter >= vjs.frameSkip)
+         skip = false;
+   }
+
+   if (frameskip_type == FRAMESKIP_MANUAL)
+      frameskip_counter = (frameskip_counter + 1) % (vjs.frameSkip + 1);
+   else
+      frameskip_counter = (skip ? frameskip_counter + 1 : 0);
+
+   return !skip;
+}
+
+// Recording starts from wherever the game is at; playing back goes to where
+// the movie starts from
+static void start_movie(void)
+{
+   const char *dir = NULL;
+   char path[4096];
+
+   MovieStop();
+
+   if (movie_mode == MOVIE_NONE || !environ_cb(RETRO_ENVIRONMENT_GET_SAVE_DIRECTORY, &dir) || !dir)
+      return;
+
+   snprintf(path, sizeof(path), "%s/%08X.vjm", dir, (unsigned)jaguarMainROMCRC32);
+
+   if (movie_mode == MOVIE_RECORD)
+      MovieRecord(path);
+   else
+      MoviePlay(path);
+}
+
 static void check_variables(void)
 {
    struct retro_variable var;
@@ -71,20 +255,152 @@ static void check_variables(void)
    else
       vjs.useFastBlitter=0;
 
+   var.key = "virtualjaguar_blitter_shadow";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if (strcmp(var.value, "enabled") == 0)
+         vjs.useBlitterShadow=1;
+      if (strcmp(var.value, "disabled") == 0)
+         vjs.useBlitterShadow=0;
+   }
+   else
+      vjs.useBlitterShadow=0;
+
    var.key = "virtualjaguar_doom_res_hack";
    var.value = NULL;
 
    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
    {
       if (strcmp(var.value, "enabled") == 0)
-         doom_res_hack=1;
+         vjs.doomResHack=1;
       if (strcmp(var.value, "disabled") == 0)
-         doom_res_hack=0;
+         vjs.doomResHack=0;
    }
    else
-      doom_res_hack=0;
+      vjs.doomResHack=0;
+
+   var.key = "virtualjaguar_risc_jit";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if (strcmp(var.value, "enabled") == 0)
+         vjs.useRISCJit=1;
+      if (strcmp(var.value, "disabled") == 0)
+         vjs.useRISCJit=0;
+   }
+   else
+      vjs.useRISCJit=0;
+
+   var.key = "virtualjaguar_dsp_thread";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if (strcmp(var.value, "enabled") == 0)
+         vjs.useDSPThread=1;
+      if (strcmp(var.value, "disabled") == 0)
+         vjs.useDSPThread=0;
+   }
+   else
+      vjs.useDSPThread=0;
+
+   var.key = "virtualjaguar_render_threads";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if (strcmp(var.value, "enabled") == 0)
+         vjs.useRenderThread=1;
+      if (strcmp(var.value, "disabled") == 0)
+         vjs.useRenderThread=0;
+   }
+   else
+      vjs.useRenderThread=0;
+
+   var.key = "virtualjaguar_profiler";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if (strcmp(var.value, "enabled") == 0)
+         ProfileEnable(true);
+      if (strcmp(var.value, "disabled") == 0)
+         ProfileEnable(false);
+   }
+   else
+      ProfileEnable(false);
+
+   unsigned old_frameskip_type = frameskip_type;
+   var.key = "virtualjaguar_frameskip";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if (strcmp(var.value, "auto") == 0)
+         frameskip_type = FRAMESKIP_AUTO;
+      else if (strcmp(var.value, "manual") == 0)
+         frameskip_type = FRAMESKIP_MANUAL;
+      else
+         frameskip_type = FRAMESKIP_NONE;
+   }
+   else
+      frameskip_type = FRAMESKIP_NONE;
+
+   var.key = "virtualjaguar_frameskip_threshold";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      frameskip_threshold = strtol(var.value, NULL, 10);
+   else
+      frameskip_threshold = FRAMESKIP_THRESHOLD;
+
+   var.key = "virtualjaguar_frameskip_interval";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+      vjs.frameSkip = strtol(var.value, NULL, 10);
+   else
+      vjs.frameSkip = 1;
+
+   if (frameskip_type != old_frameskip_type)
+      set_frameskip_callbacks();
+
+   unsigned old_movie_mode = movie_mode;
+   var.key = "virtualjaguar_movie";
+   var.value = NULL;
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+   {
+      if (strcmp(var.value, "record") == 0)
+         movie_mode = MOVIE_RECORD;
+      else if (strcmp(var.value, "play") == 0)
+         movie_mode = MOVIE_PLAY;
+      else
+         movie_mode = MOVIE_NONE;
+   }
+   else
+      movie_mode = MOVIE_NONE;
+
+   if (movie_mode != old_movie_mode && game_loaded)
+      start_movie();
 } 
 
+// With the profiler on, every 5 seconds' worth of frames gets a line in here
+static void set_profile_dump(void)
+{
+   const char *dir = NULL;
+   char path[4096];
+
+   if (!environ_cb(RETRO_ENVIRONMENT_GET_SAVE_DIRECTORY, &dir) || !dir)
+      return;
+
+   snprintf(path, sizeof(path), "%s/virtualjaguar_profile.json", dir);
+   ProfileSetDump(path, 300);
+}
+
 static void update_input(void)
 {
    if (!input_poll_cb)
@@ -138,17 +454,18 @@ void retro_set_controller_port_device(unsigned port, unsigned device)
 
 size_t retro_serialize_size(void)
 {
-   return 0;
+   return StateSize();
 }
 
 bool retro_serialize(void *data, size_t size)
 {
-   return false;
+   return SaveState(data, size);
 }
 
 bool retro_unserialize(const void *data, size_t size)
 {
-   return false;
+   // A movie follows the state if it's on the movie's timeline (see movie.cpp)
+   return LoadState(data, size);
 }
 
 void retro_cheat_reset(void)
@@ -201,7 +518,11 @@ bool retro_load_game(const struct retro_game_info *info)
    vjs.useJaguarBIOS = false;
    vjs.renderType = 0;
 
+   if (!environ_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE, &can_dupe))
+      can_dupe = false;
+
    check_variables();
+   set_profile_dump();
 
    //strcpy(vjs.EEPROMPath, "/path/to/eeproms/");   // battery saves
    JaguarInit();                                             // set up hardware
@@ -217,6 +538,9 @@ bool retro_load_game(const struct retro_game_info *info)
    JaguarLoadFile((char *)full_path);                // load rom
    JaguarReset();
 
+   game_loaded = true;
+   start_movie();
+
    return true;
 }
 
@@ -230,6 +554,8 @@ bool retro_load_game_special(unsigned game_type, const struct retro_game_info *i
 
 void retro_unload_game(void)
 {
+   MovieStop();
+   game_loaded = false;
 }
 
 unsigned retro_get_region(void)
@@ -256,6 +582,9 @@ void retro_init(void)
 {
    unsigned level = 18;
 
+   ensure_context();
+   frameskip_threshold = FRAMESKIP_THRESHOLD;
+
    videoWidth = 320;
    videoHeight = 240;
    videoBuffer = (uint32_t *)calloc(sizeof(uint32_t), 1024 * 512);
@@ -272,13 +601,19 @@ void retro_init(void)
 
 void retro_deinit(void)
 {
+   MovieStop();
+   game_loaded = false;
    JaguarDone();
+   ProfileSetDump(NULL, 0);
+   frameskip_type = FRAMESKIP_NONE;
+   audio_buff_status = false;
    free(videoBuffer);
    free(sampleBuffer); //found in dac.h
 }
 
 void retro_reset(void)
 {
+   MovieStop();
    JaguarReset();
 }
 
@@ -287,14 +622,41 @@ void retro_run(void)
    bool updated = false;
 
    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated)
+   {
+      // Don't change settings out from under the DSP thread
+      DSPThreadWait();
       check_variables();
+   }
 
    update_input();
+   MovieInput();
+
+   // Frames that a movie checks the screen on always get drawn
+   bool render = render_this_frame() || MovieCheckDue();
+   JaguarExecuteNew(render);
+
+   // With the DSP thread on, the DSP runs this frame while we do the next one,
+   // & what we hand to the frontend is the previous frame's audio
+   if (vjs.useDSPThread)
+      DSPThreadRun(sampleBuffer, 1600);
+   else
+   {
+      DSPThreadWait();
+      SDLSoundCallback(NULL, sampleBuffer, 1600);
+   }
+
+   // Make sure all of the frame's lines have made it into the backbuffer
+   TOMThreadWait();
+   ProfileEndFrame();
+
+   // A movie's RAM check has to wait for the DSP's share of the frame
+   if (MovieCheckDue())
+      DSPThreadWait();
 
-   JaguarExecuteNew();
-   
-   SDLSoundCallback(NULL, sampleBuffer, 1600);
+   MovieEndFrame(videoBuffer, game_width, game_height, videoWidth);
 
-   video_cb(videoBuffer, game_width, game_height, game_width << 2);
+   // A skipped frame leaves the last one in the buffer, so it can always be
+   // shown again, but it's cheaper to let the frontend dupe it
+   video_cb((render || !can_dupe ? videoBuffer : NULL), game_width, game_height, game_width << 2);
    audio_batch_cb((int16_t *)sampleBuffer, 1600/2);
 }
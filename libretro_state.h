@@ -0,0 +1,46 @@
+//
+// libretro_state.h: What libretro.cpp keeps for each machine (see context.h)
+//
+
+#ifndef __LIBRETRO_STATE_H__
+#define __LIBRETRO_STATE_H__
+
+#include <stdint.h>
+#include "libretro.h"
+
+enum { FRAMESKIP_NONE = 0, FRAMESKIP_AUTO, FRAMESKIP_MANUAL };
+#define FRAMESKIP_THRESHOLD		33
+
+enum { MOVIE_NONE = 0, MOVIE_RECORD, MOVIE_PLAY };
+
+struct LibretroState
+{
+	int videoWidth, videoHeight;
+	uint32_t * videoBuffer;
+	int game_width;
+	int game_height;
+
+	// The frontend's callbacks
+	retro_video_refresh_t video_cb;
+	retro_input_poll_t input_poll_cb;
+	retro_input_state_t input_state_cb;
+	retro_environment_t environ_cb;
+	retro_audio_sample_batch_t audio_batch_cb;
+
+	// Frame skipping
+	unsigned frameskip_type;
+	unsigned frameskip_threshold;
+	unsigned frameskip_counter;
+	bool can_dupe;
+
+	bool audio_buff_status;						// Frontend tells us how its audio buffer is doing
+	bool audio_buff_active;
+	unsigned audio_buff_occupancy;
+	bool audio_buff_underrun;
+	retro_usec_t frame_time_last;
+
+	unsigned movie_mode;
+	bool game_loaded;
+};
+
+#endif	// __LIBRETRO_STATE_H__
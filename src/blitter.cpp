@@ -25,9 +25,11 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include "gpu.h"
 #include "jaguar.h"
 #include "log.h"
 //#include "vjag_memory.h"
+#include "profile.h"
 #include "settings.h"
 
 // Various conditional compilation goodies...
@@ -47,18 +49,33 @@
 
 // External global variables
 
-extern int jaguar_active_memory_dumps;
 
 // Local global variables
 
+#ifndef MULTI_INSTANCE
+struct BlitterState blitterState;
+#endif
+
 int start_logging = 0;
-uint8_t blitter_working = 0;
 bool startConciseBlitLogging = false;
+#ifdef DEBUG_HOOKS
 bool logBlit = false;
+#else
+static const bool logBlit = false;				// Lets the per pixel logging fold away
+#endif
 
 // Blitter register RAM (most of it is hidden from the user)
 
-static uint8_t blitter_ram[0x100];
+#define blitter_ram			(CONTEXT(blitter).blitter_ram)
+#define addarray_co			(CONTEXT(blitter).addarray_co)
+#define addradd_co			(CONTEXT(blitter).addradd_co)
+
+// Shadow mode's bookkeeping (see BlitterShadowBlit())
+
+#define shadowAccess		(CONTEXT(blitter).shadowAccess)
+#define shadowBefore		(CONTEXT(blitter).shadowBefore)
+#define shadowResult		(CONTEXT(blitter).shadowResult)
+#define shadowFailed		(CONTEXT(blitter).shadowFailed)
 
 // Other crapola
 
@@ -313,70 +330,304 @@ void BlitterMidsummer2(void);
 
 //static uint8_t * tom_ram_8;
 //static uint8_t * paletteRam;
-static uint8_t src;
-static uint8_t dst;
-static uint8_t misc;
-static uint8_t a1ctl;
-static uint8_t mode;
-static uint8_t ity;
-static uint8_t zop;
-static uint8_t op;
-static uint8_t ctrl;
-static uint32_t a1_addr;
-static uint32_t a2_addr;
-static int32_t a1_zoffs;
-static int32_t a2_zoffs;
-static uint32_t xadd_a1_control;
-static uint32_t xadd_a2_control;
-static int32_t a1_pitch;
-static int32_t a2_pitch;
-static uint32_t n_pixels;
-static uint32_t n_lines;
-static int32_t a1_x;
-static int32_t a1_y;
-static int32_t a1_width;
-static int32_t a2_x;
-static int32_t a2_y;
-static int32_t a2_width;
-static int32_t a2_mask_x;
-static int32_t a2_mask_y;
-static int32_t a1_xadd;
-static int32_t a1_yadd;
-static int32_t a2_xadd;
-static int32_t a2_yadd;
-static uint8_t a1_phrase_mode;
-static uint8_t a2_phrase_mode;
-static int32_t a1_step_x = 0;
-static int32_t a1_step_y = 0;
-static int32_t a2_step_x = 0;
-static int32_t a2_step_y = 0;
-static uint32_t outer_loop;
-static uint32_t inner_loop;
-static uint32_t a2_psize;
-static uint32_t a1_psize;
-static uint32_t gouraud_add;
+// The rest of the command word (src, dst, misc, a1ctl, mode, ity, zop, op &
+// ctrl) used to be split out here as well, but nothing ever looked at it.
+#define a1_addr				(CONTEXT(blitter).a1_addr)
+#define a2_addr				(CONTEXT(blitter).a2_addr)
+#define a1_zoffs			(CONTEXT(blitter).a1_zoffs)
+#define a2_zoffs			(CONTEXT(blitter).a2_zoffs)
+#define xadd_a1_control		(CONTEXT(blitter).xadd_a1_control)
+#define xadd_a2_control		(CONTEXT(blitter).xadd_a2_control)
+#define a1_pitch			(CONTEXT(blitter).a1_pitch)
+#define a2_pitch			(CONTEXT(blitter).a2_pitch)
+#define n_pixels			(CONTEXT(blitter).n_pixels)
+#define n_lines				(CONTEXT(blitter).n_lines)
+#define a1_x				(CONTEXT(blitter).a1_x)
+#define a1_y				(CONTEXT(blitter).a1_y)
+#define a1_width			(CONTEXT(blitter).a1_width)
+#define a2_x				(CONTEXT(blitter).a2_x)
+#define a2_y				(CONTEXT(blitter).a2_y)
+#define a2_width			(CONTEXT(blitter).a2_width)
+#define a2_mask_x			(CONTEXT(blitter).a2_mask_x)
+#define a2_mask_y			(CONTEXT(blitter).a2_mask_y)
+#define a1_xadd				(CONTEXT(blitter).a1_xadd)
+#define a1_yadd				(CONTEXT(blitter).a1_yadd)
+#define a2_xadd				(CONTEXT(blitter).a2_xadd)
+#define a2_yadd				(CONTEXT(blitter).a2_yadd)
+#define a1_phrase_mode		(CONTEXT(blitter).a1_phrase_mode)
+#define a2_phrase_mode		(CONTEXT(blitter).a2_phrase_mode)
+#define a1_step_x			(CONTEXT(blitter).a1_step_x)
+#define a1_step_y			(CONTEXT(blitter).a1_step_y)
+#define a2_step_x			(CONTEXT(blitter).a2_step_x)
+#define a2_step_y			(CONTEXT(blitter).a2_step_y)
+#define outer_loop			(CONTEXT(blitter).outer_loop)
+#define inner_loop			(CONTEXT(blitter).inner_loop)
+#define a2_psize			(CONTEXT(blitter).a2_psize)
+#define a1_psize			(CONTEXT(blitter).a1_psize)
+#define gouraud_add			(CONTEXT(blitter).gouraud_add)
 //static uint32_t gouraud_data;
 //static uint16_t gint[4];
 //static uint16_t gfrac[4];
 //static uint8_t  gcolour[4];
-static int gd_i[4];
-static int gd_c[4];
-static int gd_ia, gd_ca;
-static int colour_index = 0;
-static int32_t zadd;
-static uint32_t z_i[4];
+#define gd_i				(CONTEXT(blitter).gd_i)
+#define gd_c				(CONTEXT(blitter).gd_c)
+#define gd_ia				(CONTEXT(blitter).gd_ia)
+#define gd_ca				(CONTEXT(blitter).gd_ca)
+#define colour_index		(CONTEXT(blitter).colour_index)
+#define zadd				(CONTEXT(blitter).zadd)
+#define z_i					(CONTEXT(blitter).z_i)
 
-static int32_t a1_clip_x, a1_clip_y;
+#define a1_clip_x			(CONTEXT(blitter).a1_clip_x)
+#define a1_clip_y			(CONTEXT(blitter).a1_clip_y)
 
 // In the spirit of "get it right first, *then* optimize" I've taken the liberty
 // of removing all the unnecessary code caching. If it turns out to be a good way
 // to optimize the blitter, then we may revisit it in the future...
 
+// Per command word blit statistics (see BlitCommandStats in blitter.h)
+
+#define blitStats			(CONTEXT(blitter).blitStats)
+#define blitStatsUsed		(CONTEXT(blitter).blitStatsUsed)
+#define useSpecializedBlits	(CONTEXT(blitter).useSpecializedBlits)
+
+
+static BlitCommandStats * BlitterFindStats(uint32_t cmd)
+{
+	uint32_t slot = (cmd ^ (cmd >> 11) ^ (cmd >> 21)) & (BLIT_STATS_SIZE - 1);
+
+	for(uint32_t i=0; i<BLIT_STATS_SIZE; i++, slot=(slot+1)&(BLIT_STATS_SIZE-1))
+	{
+		if (blitStats[slot].used && blitStats[slot].cmd == cmd)
+			return &blitStats[slot];
+
+		if (!blitStats[slot].used)
+		{
+			// Leave a free slot, so lookups of new commands always terminate
+			if (blitStatsUsed >= BLIT_STATS_SIZE - 1)
+				return NULL;
+
+			blitStats[slot].used = true;
+			blitStats[slot].cmd = cmd;
+			blitStatsUsed++;
+			return &blitStats[slot];
+		}
+	}
+
+	return NULL;
+}
+
+
+static int BlitterCompareStats(const void * a, const void * b)
+{
+	const BlitCommandStats * s1 = (const BlitCommandStats *)a, * s2 = (const BlitCommandStats *)b;
+
+	if (s1->used != s2->used)
+		return (s1->used ? -1 : 1);
+
+	return (s1->pixels > s2->pixels ? -1 : (s1->pixels < s2->pixels ? 1 : 0));
+}
+
+
+void BlitterLogStats(void)
+{
+	if (blitStatsUsed == 0)
+		return;
+
+	BlitCommandStats sorted[BLIT_STATS_SIZE];
+	memcpy(sorted, blitStats, sizeof(sorted));
+	qsort(sorted, BLIT_STATS_SIZE, sizeof(BlitCommandStats), BlitterCompareStats);
+
+	WriteLog("BLIT: Command      Blits        Pixels    Checked Mismatches\n");
+
+	for(uint32_t i=0; i<blitStatsUsed; i++)
+		WriteLog("BLIT: %08X %10u %13llu %10u %10u%s%s\n", sorted[i].cmd, sorted[i].blits,
+			(unsigned long long)sorted[i].pixels, sorted[i].checked, sorted[i].mismatches,
+			(sorted[i].specialized ? " (specialized)" : ""),
+			(sorted[i].mismatches ? " (not safe for fast blitter)" : (sorted[i].checked ? " (safe for fast blitter)" : "")));
+}
+
+
+void BlitterResetStats(void)
+{
+	memset(blitStats, 0, sizeof(blitStats));
+	blitStatsUsed = 0;
+}
+
+
 //
-// Generic blit handler
+// The specialized paths can be switched off, to check them against (or time
+// them against) the plain old generic blitter.
 //
-void blitter_generic(uint32_t cmd)
+void BlitterUseSpecializedPaths(bool state)
+{
+	useSpecializedBlits = state;
+}
+
+
+//
+// Phrase-wide row kernels for plain fills & copies. The pixel loop moves one
+// pixel at a time through the memory handlers, which is a lot of work for what
+// is usually a straight run of bytes in main RAM. So when a whole row lands in
+// (and for copies, comes from) host memory in one piece, we do it with memcpy()
+// a phrase at a time, and leave everything else to the pixel loop.
+//
+
+// SRCENZ DSTEN DSTENZ DSTWRZ CLIP_A1 GOURD GOURZ ZMODE* BCOMPEN DCOMPEN SRCSHADE
+#define BLIT_KERNEL_CLEAR	0x4C1C307A
+
+static inline bool BlitterIsFill(uint32_t cmd)
+{
+	return !(cmd & (BLIT_KERNEL_CLEAR | 0x00000005)) && PATDSEL;
+}
+
+
+static inline bool BlitterIsCopy(uint32_t cmd)
+{
+	// LFU_REPLACE (S.D + S./D) is just the source, since without DSTEN the
+	// destination data comes from the DSTDATA register. A1 -> A2 only reads the
+	// source from memory with SRCEN set; A1 <- A2 takes SRCENX too.
+	return !(cmd & (BLIT_KERNEL_CLEAR | 0x00030000)) && (((cmd >> 21) & 0x0F) == 0x0C)
+		&& (cmd & (DSTA2 ? 0x00000001 : 0x00000005));
+}
+
+
+//
+// Returns a host pointer to a run of bytes that's all in main RAM (or all in
+// the cartridge, if it's only being read), or NULL if it isn't
+//
+static inline uint8_t * BlitterRunPointer(uint32_t address, uint32_t length, bool write)
+{
+	address &= 0xFFFFFF;
+
+	// First 2M is mirrored in the $0 - $7FFFFF range
+	if (address < 0x800000)
+		return ((address & 0x1FFFFF) + length <= 0x200000 ? jaguarMainRAM + (address & 0x1FFFFF) : NULL);
+
+	if (!write && address + length <= 0xDFFF00)
+		return jaguarMainROM + (address - 0x800000);
+
+	return NULL;
+}
+
+
+//
+// Returns where a channel's row starts, if it's a straight run of 8, 16 or
+// 32 BPP pixels going left to right.
+//
+static inline bool BlitterRowStart(uint32_t & address, uint32_t flags, uint32_t base, int32_t x,
+	int32_t y, int32_t width, int32_t pitch, int32_t xadd, int32_t yadd, uint32_t length)
+{
+	uint32_t depth = (flags >> 3) & 0x07, pixelX = (uint32_t)x >> 16;
+
+	if (depth < 3 || depth > 5 || pitch != 0 || xadd != (1 << 16) || yadd != 0
+		|| pixelX + length > 0x10000)
+		return false;
+
+	address = base + ((((uint32_t)y >> 16) * width) + pixelX) * (1 << (depth - 3));
+	return true;
+}
+
+
+static bool BlitterRowKernel(uint32_t cmd)
+{
+	bool copy = BlitterIsCopy(cmd);
+	uint32_t dstFlags = REG(DSTA2 ? A2_FLAGS : A1_FLAGS), srcFlags = REG(DSTA2 ? A1_FLAGS : A2_FLAGS);
+	uint32_t bytes = 1 << (((dstFlags >> 3) & 0x07) - 3);
+	uint32_t dstAddress, srcAddress;
+
+	// A2's mask would make its X wrap around, so we leave that to the pixel loop
+	if (n_pixels == 0 || ((DSTA2 || copy) && (REG(A2_FLAGS) & 0x8000)))
+		return false;
+
+	if (!DSTA2)
+	{
+		if (!BlitterRowStart(dstAddress, dstFlags, a1_addr, a1_x, a1_y, a1_width, a1_pitch, a1_xadd, a1_yadd, n_pixels)
+			|| (copy && !BlitterRowStart(srcAddress, srcFlags, a2_addr, a2_x, a2_y, a2_width, a2_pitch, a2_xadd, a2_yadd, n_pixels)))
+			return false;
+	}
+	else
+	{
+		if (!BlitterRowStart(dstAddress, dstFlags, a2_addr, a2_x, a2_y, a2_width, a2_pitch, a2_xadd, a2_yadd, n_pixels)
+			|| (copy && !BlitterRowStart(srcAddress, srcFlags, a1_addr, a1_x, a1_y, a1_width, a1_pitch, a1_xadd, a1_yadd, n_pixels)))
+			return false;
+	}
+
+	uint32_t length = n_pixels * bytes;
+	uint8_t * dst = BlitterRunPointer(dstAddress, length, true);
+
+	if (!dst)
+		return false;
+
+	if (copy)
+	{
+		// Source & destination have to agree on the pixel size, and the pixel
+		// loop's front to back copy only matches memcpy() if they don't overlap
+		const uint8_t * src = BlitterRunPointer(srcAddress, length, false);
+
+		if (((srcFlags ^ dstFlags) & 0x38) || !src || (src < dst + length && dst < src + length))
+			return false;
+
+		memcpy(dst, src, length);
+	}
+	else
+	{
+		// Build a phrase of pattern pixels starting at this row's X, which then
+		// repeats all the way across
+		uint8_t pattern[8];
+		uint32_t pixelX = (uint32_t)(DSTA2 ? a2_x : a1_x) >> 16;
+		uint8_t phraseMode = (DSTA2 ? a2_phrase_mode : a1_phrase_mode);
+
+		for(uint32_t i=0; i<8/bytes; i++)
+		{
+			int32_t pattern_x = (int32_t)((pixelX + i) << 16);
+			uint32_t pixel = READ_RDATA(PATTERNDATA, pattern, dstFlags, phraseMode);
+
+			for(uint32_t j=0; j<bytes; j++)
+				pattern[(i * bytes) + j] = pixel >> (8 * (bytes - 1 - j));
+		}
+
+		uint32_t offset = 0;
+
+		for(; offset+8<=length; offset+=8)
+			memcpy(dst + offset, pattern, 8);
+
+		memcpy(dst + offset, pattern, length - offset);
+	}
+
+	uint32_t ramOffset = dst - jaguarMainRAM;
+
+	for(uint32_t page=ramOffset>>STATE_PAGE_SHIFT; page<=(ramOffset+length-1)>>STATE_PAGE_SHIFT; page++)
+		mainRAMDirtyPage[page] = STATE_DIRTY_ALL;
+
+	// Leave the pointers where the pixel loop would have
+	a1_x = (int32_t)((uint32_t)a1_x + (n_pixels * (uint32_t)a1_xadd));
+	a1_y = (int32_t)((uint32_t)a1_y + (n_pixels * (uint32_t)a1_yadd));
+
+	if (!(REG(A2_FLAGS) & 0x8000))
+	{
+		a2_x = (int32_t)((uint32_t)a2_x + (n_pixels * (uint32_t)a2_xadd));
+		a2_y = (int32_t)((uint32_t)a2_y + (n_pixels * (uint32_t)a2_yadd));
+	}
+	else
+	{
+		for(uint32_t i=0; i<n_pixels; i++)
+			a2_x = (a2_x + a2_xadd) & a2_mask_x, a2_y = (a2_y + a2_yadd) & a2_mask_y;
+	}
+
+	return true;
+}
+
+
+//
+// Generic blit handler. It's a template so that the common command words can
+// have a copy of their own: with cmd a constant, every one of the flag tests
+// in here folds away and all that's left is the inner loop that it needs.
+//
+template <bool FIXED, uint32_t FIXED_CMD>
+static void BlitterGenericLoop(uint32_t command)
 {
+	const uint32_t cmd = (FIXED ? FIXED_CMD : command);
+
 /*
 Blit! (0018FA70 <- 008DDC40) count: 2 x 13, A1/2_FLAGS: 00014218/00013C18 [cmd: 1401060C]
  CMD -> src: SRCENX dst: DSTEN  misc:  a1ctl: UPDA1 UPDA2 mode:  ity: PATDSEL z-op:  op: LFU_CLEAR ctrl: BCOMPEN BKGWREN
@@ -426,6 +677,11 @@ if (specialLog)
 		}
 
 		inner_loop = n_pixels;
+
+		// Plain fills & copies can go a whole row at a time
+		if (useSpecializedBlits && (BlitterIsFill(cmd) || BlitterIsCopy(cmd)) && BlitterRowKernel(cmd))
+			inner_loop = 0;
+
 		while (inner_loop--)
 		{
 if (specialLog)
@@ -1084,6 +1340,14 @@ Lesse, with pre-add we'd have:
 specialLog = false;
 }
 
+
+void blitter_generic(uint32_t cmd)
+{
+	BlitterGenericLoop<false, 0>(cmd);
+}
+
+#define BLIT_SPECIALIZE(c)	case c: BlitterGenericLoop<true, c>(c); break
+
 void blitter_blit(uint32_t cmd)
 {
 //Apparently this is doing *something*, just not sure exactly what...
@@ -1096,15 +1360,6 @@ void blitter_blit(uint32_t cmd)
 
 	uint32_t pitchValue[4] = { 0, 1, 3, 2 };
 	colour_index = 0;
-	src = cmd & 0x07;
-	dst = (cmd >> 3) & 0x07;
-	misc = (cmd >> 6) & 0x03;
-	a1ctl = (cmd >> 8) & 0x7;
-	mode = (cmd >> 11) & 0x07;
-	ity = (cmd >> 14) & 0x0F;
-	zop = (cmd >> 18) & 0x07;
-	op = (cmd >> 21) & 0x0F;
-	ctrl = (cmd >> 25) & 0x3F;
 
 	// Addresses in A1/2_BASE are *phrase* aligned, i.e., bottom three bits are ignored!
 	// NOTE: This fixes Rayman's bad collision detection AND keeps T2K working!
@@ -1476,6 +1731,7 @@ Blit! (00110000 <- 0010B2A8) count: 12 x 12, A1/2_FLAGS: 000042E2/00000020 [cmd:
         A1 x/y: 173/144, A2 x/y: 4052/0
 
 */
+#ifdef DEBUG_HOOKS
 //extern int op_start_log;
 if (blit_start_log)
 {
@@ -1519,12 +1775,55 @@ if (blit_start_log)
 //	blit_start_log = 0;
 //	op_start_log = 1;
 }
+#endif
 
 	blitter_working = 1;
 //#ifndef USE_GENERIC_BLITTER
 //	if (!blitter_execute_cached_code(blitter_in_cache(cmd)))
 //#endif
-	blitter_generic(cmd);
+	if (!useSpecializedBlits)
+		blitter_generic(cmd);
+	else
+	{
+		BlitCommandStats * stats = BlitterFindStats(cmd);
+
+		if (stats)
+			stats->specialized = true;
+
+		// The command words that show up the most get a loop of their own
+		switch (cmd)
+		{
+		// Fills & patterns
+		BLIT_SPECIALIZE(0x00010000);				// PATDSEL
+		BLIT_SPECIALIZE(0x00010200);				// UPDA1 PATDSEL
+		// Plain copies
+		BLIT_SPECIALIZE(0x01800001);				// SRCEN LFUFUNC=C
+		BLIT_SPECIALIZE(0x01800005);				// SRCEN SRCENX LFUFUNC=C
+		BLIT_SPECIALIZE(0x01800201);				// SRCEN UPDA1 LFUFUNC=C
+		BLIT_SPECIALIZE(0x01800601);				// SRCEN UPDA1 UPDA2 LFUFUNC=C
+		BLIT_SPECIALIZE(0x01800E01);				// SRCEN UPDA1 UPDA2 DSTA2 LFUFUNC=C
+		// Transparent copies
+		BLIT_SPECIALIZE(0x09800209);				// SRCEN DSTEN UPDA1 LFUFUNC=C DCOMPEN
+		BLIT_SPECIALIZE(0x09800609);				// SRCEN DSTEN UPDA1 UPDA2 LFUFUNC=C DCOMPEN
+		BLIT_SPECIALIZE(0x09800741);				// SRCEN CLIP_A1 UPDA1 UPDA1F UPDA2 LFUFUNC=C DCOMPEN
+		BLIT_SPECIALIZE(0x05810601);				// SRCEN UPDA1 UPDA2 PATDSEL BCOMPEN
+		// Gouraud shading
+		BLIT_SPECIALIZE(0x00011000);				// GOURD PATDSEL
+		BLIT_SPECIALIZE(0x00011008);				// DSTEN GOURD PATDSEL
+		BLIT_SPECIALIZE(0x00011040);				// CLIP_A1 GOURD PATDSEL
+		BLIT_SPECIALIZE(0x00011200);				// UPDA1 GOURD PATDSEL
+		// Z buffered
+		BLIT_SPECIALIZE(0x00113078);				// DSTEN DSTENZ DSTWRZ CLIP_A1 GOURD GOURZ PATDSEL ZMODE=4
+		BLIT_SPECIALIZE(0x01902839);				// SRCEN DSTEN DSTENZ DSTWRZ DSTA2 GOURZ ZMODE=4 LFUFUNC=C
+		BLIT_SPECIALIZE(0x09900F39);				// SRCEN DSTEN DSTENZ DSTWRZ UPDA1 UPDA1F UPDA2 DSTA2 ZMODE=4 LFUFUNC=C DCOMPEN
+		BLIT_SPECIALIZE(0x41802F41);				// SRCEN CLIP_A1 UPDA1 UPDA1F UPDA2 DSTA2 GOURZ ZMODE=0 LFUFUNC=C SRCSHADE
+		default:
+			if (stats)
+				stats->specialized = false;
+
+			blitter_generic(cmd);
+		}
+	}
 
 /*if (blit_start_log)
 {
@@ -1542,6 +1841,50 @@ if (blit_start_log)
 
 	blitter_working = 0;
 }
+
+// Everything from here on has its own ideas about what a1_x & friends are
+#undef a1_addr
+#undef a2_addr
+#undef a1_zoffs
+#undef a2_zoffs
+#undef xadd_a1_control
+#undef xadd_a2_control
+#undef a1_pitch
+#undef a2_pitch
+#undef n_pixels
+#undef n_lines
+#undef a1_x
+#undef a1_y
+#undef a1_width
+#undef a2_x
+#undef a2_y
+#undef a2_width
+#undef a2_mask_x
+#undef a2_mask_y
+#undef a1_xadd
+#undef a1_yadd
+#undef a2_xadd
+#undef a2_yadd
+#undef a1_phrase_mode
+#undef a2_phrase_mode
+#undef a1_step_x
+#undef a1_step_y
+#undef a2_step_x
+#undef a2_step_y
+#undef outer_loop
+#undef inner_loop
+#undef a2_psize
+#undef a1_psize
+#undef gouraud_add
+#undef gd_i
+#undef gd_c
+#undef gd_ia
+#undef gd_ca
+#undef colour_index
+#undef zadd
+#undef z_i
+#undef a1_clip_x
+#undef a1_clip_y
 #endif											// of the #if 0 near the top...
 /*******************************************************************************
 ********************** STUFF CUT ABOVE THIS LINE! ******************************
@@ -1550,6 +1893,8 @@ if (blit_start_log)
 
 void BlitterInit(void)
 {
+	useSpecializedBlits = true;
+	shadowAccess = 0xFFFFFFFF;
 	BlitterReset();
 }
 
@@ -1562,10 +1907,227 @@ void BlitterReset(void)
 
 void BlitterDone(void)
 {
+	BlitterLogStats();
+	free(shadowBefore);
+	free(shadowResult);
+	shadowBefore = shadowResult = NULL;
+	shadowFailed = false;
 	WriteLog("BLIT: Done.\n");
 }
 
 
+//
+// Blits are run to completion as soon as they're started, so the only state
+// that survives between them is the register file & the adder carries.
+//
+void BlitterStateSync(StateBuffer * sb)
+{
+	STATE_SYNC(sb, blitter_ram);
+	STATE_SYNC(sb, addarray_co);
+}
+
+
+//
+// Shadow mode runs each blit thru both blitters & compares what they leave
+// behind in main RAM & the GPU's local RAM (which is where just about every
+// blit lands). The blitter that isn't in use goes first, then memory & the
+// registers get put back and the one that is in use runs for real, so the
+// emulation carries on exactly as it would without it. Command words that
+// ever come out different get logged, & stay off the fast blitter from then
+// on. Note that we only compare memory, since the Midsummer blitter doesn't
+// write its pointers back to the registers.
+//
+// Anything outside of RAM & ROM can't be run twice or put back afterward, so
+// the first pass runs sandboxed: JaguarRead*/JaguarWrite* hand the blitter's
+// accesses to everything else (other than reads of the BIOS & writes to the
+// GPU's RAM) to BlitterShadowAccess(), which drops them. A blit that tried
+// any is run once for real & isn't checked. The second pass notes them as
+// well, so one that only the blitter in use makes shows up as a mismatch
+// instead of being missed by the compare.
+//
+#define SHADOW_GPU_RAM			0xF03000
+#define SHADOW_GPU_RAM_SIZE		0x1000
+#define SHADOW_SIZE				(0x200000 + SHADOW_GPU_RAM_SIZE)
+
+
+//
+// Returns true if the access is to be dropped
+//
+bool BlitterShadowAccess(uint32_t offset, bool write)
+{
+	if (write ? (offset >= SHADOW_GPU_RAM && offset < SHADOW_GPU_RAM + SHADOW_GPU_RAM_SIZE)
+		: (offset >= 0xE00000 && offset < 0xE40000))
+		return false;
+
+	if (shadowAccess == 0xFFFFFFFF)
+		shadowAccess = offset;
+
+	return (blitterShadowPass == SHADOW_PASS_SANDBOXED);
+}
+
+
+#ifdef USE_BOTH_BLITTERS
+
+
+static bool BlitterShadowInit(void)
+{
+	if (shadowBefore)
+		return true;
+
+	if (shadowFailed)
+		return false;
+
+	shadowBefore = (uint8_t *)malloc(SHADOW_SIZE);
+	shadowResult = (uint8_t *)malloc(SHADOW_SIZE);
+
+	if (shadowBefore && shadowResult)
+		return true;
+
+	WriteLog("BLIT: Could not allocate shadow RAM! Blitter shadowing is disabled.\n");
+	free(shadowBefore);
+	free(shadowResult);
+	shadowBefore = shadowResult = NULL;
+	shadowFailed = true;
+	return false;
+}
+
+
+static void BlitterShadowSave(uint8_t * buffer)
+{
+	memcpy(buffer, jaguarMainRAM, 0x200000);
+
+	for(uint32_t i=0; i<SHADOW_GPU_RAM_SIZE; i+=4)
+	{
+		uint32_t data = GPUReadLong(SHADOW_GPU_RAM + i, BLITTER);
+		SET32(buffer, 0x200000 + i, data);
+	}
+}
+
+
+static void BlitterShadowRestore(const uint8_t * buffer)
+{
+	memcpy(jaguarMainRAM, buffer, 0x200000);
+
+	for(uint32_t i=0; i<SHADOW_GPU_RAM_SIZE; i+=4)
+		GPUWriteLong(SHADOW_GPU_RAM + i, GET32(buffer, 0x200000 + i), BLITTER);
+}
+
+
+//
+// Returns the Jaguar address of the first byte that differs between memory &
+// the buffer, or 0xFFFFFFFF if they're the same
+//
+static uint32_t BlitterShadowCompare(const uint8_t * buffer)
+{
+	if (memcmp(jaguarMainRAM, buffer, 0x200000) != 0)
+	{
+		for(uint32_t i=0; i<0x200000; i++)
+			if (jaguarMainRAM[i] != buffer[i])
+				return i;
+	}
+
+	for(uint32_t i=0; i<SHADOW_GPU_RAM_SIZE; i+=4)
+	{
+		uint32_t data = GPUReadLong(SHADOW_GPU_RAM + i, BLITTER);
+
+		for(uint32_t j=0; j<4; j++)
+			if ((uint8_t)(data >> (24 - (j * 8))) != buffer[0x200000 + i + j])
+				return SHADOW_GPU_RAM + i + j;
+	}
+
+	return 0xFFFFFFFF;
+}
+
+
+static void BlitterShadowBlit(uint32_t cmd, BlitCommandStats * stats, bool useFast)
+{
+	if (!BlitterShadowInit())
+	{
+		if (useFast)
+			blitter_blit(cmd);
+		else
+			BlitterMidsummer2();
+
+		return;
+	}
+
+	uint8_t regs[0x100], carries[4];
+	memcpy(regs, blitter_ram, sizeof(regs));
+	memcpy(carries, addarray_co, sizeof(carries));
+	BlitterShadowSave(shadowBefore);
+
+	shadowAccess = 0xFFFFFFFF;
+	blitterShadowPass = SHADOW_PASS_SANDBOXED;
+
+	if (useFast)
+		BlitterMidsummer2();
+	else
+		blitter_blit(cmd);
+
+	blitterShadowPass = SHADOW_PASS_NONE;
+	bool sandboxed = (shadowAccess != 0xFFFFFFFF);
+
+	if (!sandboxed)
+		BlitterShadowSave(shadowResult);
+
+	BlitterShadowRestore(shadowBefore);
+	memcpy(blitter_ram, regs, sizeof(regs));
+	memcpy(addarray_co, carries, sizeof(carries));
+
+	// It went outside of RAM & ROM, so the only thing left to do is the real blit
+	if (sandboxed)
+	{
+		if (useFast)
+			blitter_blit(cmd);
+		else
+			BlitterMidsummer2();
+
+		return;
+	}
+
+	blitterShadowPass = SHADOW_PASS_WATCHED;
+
+	if (useFast)
+		blitter_blit(cmd);
+	else
+		BlitterMidsummer2();
+
+	blitterShadowPass = SHADOW_PASS_NONE;
+
+	if (stats)
+		stats->checked++;
+
+	if (shadowAccess != 0xFFFFFFFF)
+	{
+		if (stats)
+			stats->mismatches++;
+
+		WriteLog("BLIT: Shadow mismatch! cmd: %08X, A1/A2 flags: %08X/%08X, A1/A2 base: %06X/%06X, count: %08X, only the %s blitter accessed %06X\n",
+			cmd, GET32(regs, A1_FLAGS), GET32(regs, A2_FLAGS), GET32(regs, A1_BASE), GET32(regs, A2_BASE),
+			GET32(regs, PIXLINECOUNTER), (useFast ? "fast" : "Midsummer2"), shadowAccess);
+		return;
+	}
+
+	uint32_t address = BlitterShadowCompare(shadowResult);
+
+	if (address == 0xFFFFFFFF)
+		return;
+
+	if (stats)
+		stats->mismatches++;
+
+	uint32_t index = (address < 0x200000 ? address : 0x200000 + address - SHADOW_GPU_RAM);
+	uint8_t current = (address < 0x200000 ? jaguarMainRAM[address]
+		: (uint8_t)(GPUReadLong(address & ~3, BLITTER) >> (24 - ((address & 3) * 8))));
+
+	WriteLog("BLIT: Shadow mismatch! cmd: %08X, A1/A2 flags: %08X/%08X, A1/A2 base: %06X/%06X, count: %08X, first difference at %06X (fast: %02X, Midsummer2: %02X)\n",
+		cmd, GET32(regs, A1_FLAGS), GET32(regs, A2_FLAGS), GET32(regs, A1_BASE), GET32(regs, A2_BASE),
+		GET32(regs, PIXLINECOUNTER), address, (useFast ? current : shadowResult[index]),
+		(useFast ? shadowResult[index] : current));
+}
+#endif
+
+
 uint8_t BlitterReadByte(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 {
 	offset &= 0xFF;
@@ -1745,10 +2307,29 @@ if (blit_start_log)
 #endif
 #else
 	{
-		if (vjs.useFastBlitter)
-			blitter_blit(GET32(blitter_ram, 0x38));
+		uint32_t cmd = GET32(blitter_ram, 0x38);
+		BlitCommandStats * stats = BlitterFindStats(cmd);
+		uint64_t pixels = (uint64_t)GET16(blitter_ram, PIXLINECOUNTER + 2) * GET16(blitter_ram, PIXLINECOUNTER);
+
+		if (stats)
+			stats->blits++, stats->pixels += pixels;
+
+		if (profileEnabled)
+			ProfileAddWork(PROFILE_BLITTER, pixels), ProfileBlitCommand(cmd, pixels);
+
+		// Anything that shadow mode caught the fast blitter getting wrong goes
+		// to the Midsummer blitter instead
+		bool useFast = vjs.useFastBlitter && !(stats && stats->mismatches);
+		ProfileEnter(PROFILE_BLITTER);
+
+		if (vjs.useBlitterShadow)
+			BlitterShadowBlit(cmd, stats, useFast);
+		else if (useFast)
+			blitter_blit(cmd);
 		else
 			BlitterMidsummer2();
+
+		ProfileLeave();
 	}
 #endif
 }
@@ -2771,11 +3352,13 @@ if (
 //	&& cmd != 0x09800F41	// SRCEN CLIP_A1 UPDA1 UPDA1F UPDA2 DSTA2 LFUFUNC=C DCOMPEN
 	)
 	logBlit = true;//*/
-#else
+#elif defined(DEBUG_HOOKS)
 logBlit = true;
 #endif
+#ifdef DEBUG_HOOKS
 if (blit_start_log == 0)	// Wait for the signal...
 	logBlit = false;//*/
+#endif
 //temp, for testing...
 /*if (cmd != 0x49820609)
 	logBlit = false;//*/
@@ -5038,11 +5621,10 @@ void ADDARRAY(uint16_t * addq, uint8_t daddasel, uint8_t daddbsel, uint8_t daddm
 
 	uint8_t cinsel = (daddmode >= 1 && daddmode <= 4 ? 1 : 0);
 
-static uint8_t co[4];//These are preserved between calls...
 	uint8_t cin[4];
 
 	for(int i=0; i<4; i++)
-		cin[i] = initcin[i] | (co[i] & cinsel);
+		cin[i] = initcin[i] | (addarray_co[i] & cinsel);
 
 	bool eightbit = daddmode & 0x02;
 	bool sat = daddmode & 0x03;
@@ -5050,7 +5632,7 @@ static uint8_t co[4];//These are preserved between calls...
 
 //Note that the carry out is saved between calls to this function...
 	for(int i=0; i<4; i++)
-		ADD16SAT(addq[i], co[i], adda[i], addb[i], cin[i], sat, eightbit, hicinh);
+		ADD16SAT(addq[i], addarray_co[i], adda[i], addb[i], cin[i], sat, eightbit, hicinh);
 }
 
 
@@ -5367,7 +5949,7 @@ Ci_y		:= EO (ci_y, cyt[1], suba_y);*/
 
 ////////////////////////////////////// C++ CODE //////////////////////////////////////
 //I'm sure the following will generate a bunch of warnings, but will have to do for now.
-	static uint16_t co_x = 0, co_y = 0;	// Carry out has to propogate between function calls...
+	uint16_t & co_x = addradd_co[0], & co_y = addradd_co[1];	// Carry out has to propogate between function calls...
 	uint16_t ci_x = co_x ^ (suba_x ? 1 : 0);
 	uint16_t ci_y = co_y ^ (suba_y ? 1 : 0);
 	uint32_t addqt_x = adda_x + addb_x + ci_x;
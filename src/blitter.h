@@ -5,11 +5,14 @@
 #ifndef __BLITTER_H__
 #define __BLITTER_H__
 
+#include "context.h"
 #include "vjag_memory.h"
+#include "state.h"
 
 void BlitterInit(void);
 void BlitterReset(void);
 void BlitterDone(void);
+void BlitterStateSync(StateBuffer * sb);
 
 uint8_t BlitterReadByte(uint32_t, uint32_t who = UNKNOWN);
 uint16_t BlitterReadWord(uint32_t, uint32_t who = UNKNOWN);
@@ -21,7 +24,83 @@ void BlitterWriteLong(uint32_t, uint32_t, uint32_t who = UNKNOWN);
 uint32_t blitter_reg_read(uint32_t offset);
 void blitter_reg_write(uint32_t offset, uint32_t data);
 
-extern uint8_t blitter_working;
+//
+// Per command word blit statistics. Every blit that goes through here gets
+// counted by its command word, which makes it easy to see what a game leans on
+// (and so which command words are worth specializing; see blitter.cpp).
+//
+#define BLIT_STATS_SIZE		512					// Must be a power of 2
+
+struct BlitCommandStats
+{
+	uint32_t cmd;
+	uint32_t blits;
+	uint64_t pixels;
+	uint32_t checked;							// Blits compared between the two blitters
+	uint32_t mismatches;						// ...and how many of them didn't agree
+	bool used;
+	bool specialized;
+};
+
+// What BLITTER.CPP knows about the machine (see context.h)
+
+struct BlitterState
+{
+	uint8_t blitter_working;
+	uint8_t blitterShadowPass;
+	uint8_t blitter_ram[0x100];					// Most of it is hidden from the user
+	uint8_t addarray_co[4];						// ADDARRAY carries, preserved between calls
+	uint16_t addradd_co[2];						// Same for ADDRADD
+
+	// The original blitter's working copy of the registers, good for one blit
+	uint32_t a1_addr, a2_addr;
+	int32_t a1_zoffs, a2_zoffs;
+	uint32_t xadd_a1_control, xadd_a2_control;
+	int32_t a1_pitch, a2_pitch;
+	uint32_t n_pixels, n_lines;
+	int32_t a1_x, a1_y, a1_width;
+	int32_t a2_x, a2_y, a2_width;
+	int32_t a2_mask_x, a2_mask_y;
+	int32_t a1_xadd, a1_yadd;
+	int32_t a2_xadd, a2_yadd;
+	uint8_t a1_phrase_mode, a2_phrase_mode;
+	int32_t a1_step_x, a1_step_y;
+	int32_t a2_step_x, a2_step_y;
+	uint32_t outer_loop, inner_loop;
+	uint32_t a2_psize, a1_psize;
+	uint32_t gouraud_add;
+	int gd_i[4];
+	int gd_c[4];
+	int gd_ia, gd_ca;
+	int colour_index;
+	int32_t zadd;
+	uint32_t z_i[4];
+	int32_t a1_clip_x, a1_clip_y;
+
+	BlitCommandStats blitStats[BLIT_STATS_SIZE];
+	uint32_t blitStatsUsed;
+	bool useSpecializedBlits;
+
+	uint32_t shadowAccess;
+	uint8_t * shadowBefore;
+	uint8_t * shadowResult;
+	bool shadowFailed;
+};
+
+#define blitter_working		(CONTEXT(blitter).blitter_working)
+
+// Per command word statistics & the fast blitter's specialized paths
+
+void BlitterLogStats(void);
+void BlitterResetStats(void);
+void BlitterUseSpecializedPaths(bool state);
+
+// Shadow mode's sandbox, for JaguarRead*/JaguarWrite* (see blitter.cpp)
+
+enum { SHADOW_PASS_NONE = 0, SHADOW_PASS_SANDBOXED, SHADOW_PASS_WATCHED };
+
+#define blitterShadowPass	(CONTEXT(blitter).blitterShadowPass)
+bool BlitterShadowAccess(uint32_t offset, bool write);
 
 //For testing only...
 void LogBlit(void);
@@ -177,12 +177,23 @@ const char * BReg[12] = { "BUTCH", "DSCNTRL", "DS_DATA", "???", "I2CNTRL", "SBCN
 //extern const char * whoName[9];
 
 
-static uint8_t cdRam[0x100];
-static uint16_t cdCmd = 0, cdPtr = 0;
-static bool haveCDGoodness;
-static uint32_t min, sec, frm, block;
-static uint8_t cdBuf[2352 + 96];
-static uint32_t cdBufPtr = 2352;
+#ifndef MULTI_INSTANCE
+struct CDROMState cdromState;
+#endif
+
+#define cdRam				(CONTEXT(cdrom).cdRam)
+#define cdCmd				(CONTEXT(cdrom).cdCmd)
+#define cdPtr				(CONTEXT(cdrom).cdPtr)
+#define haveCDGoodness		(CONTEXT(cdrom).haveCDGoodness)
+#define min					(CONTEXT(cdrom).min)
+#define sec					(CONTEXT(cdrom).sec)
+#define frm					(CONTEXT(cdrom).frm)
+#define block				(CONTEXT(cdrom).block)
+#define cdBuf				(CONTEXT(cdrom).cdBuf)
+#define cdBufPtr			(CONTEXT(cdrom).cdBufPtr)
+#define trackNum			(CONTEXT(cdrom).trackNum)
+#define minTrack			(CONTEXT(cdrom).minTrack)
+#define maxTrack			(CONTEXT(cdrom).maxTrack)
 //Also need to set up (save/restore) the CD's NVRAM
 
 
@@ -190,6 +201,8 @@ static uint32_t cdBufPtr = 2352;
 void CDROMInit(void)
 {
 	haveCDGoodness = CDIntfInit();
+	cdBufPtr = 2352;
+	trackNum = 1;
 
 //GetRawTOC();
 /*uint8_t buf[2448];
@@ -303,7 +316,6 @@ uint8_t CDROMReadByte(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 	return cdRam[offset & 0xFF];
 }
 
-static uint8_t trackNum = 1, minTrack, maxTrack;
 //static uint8_t minutes[16] = {  0,  0,  2,  5,  7, 10, 12, 15, 17, 20, 22, 25, 27, 30, 32, 35 };
 //static uint8_t seconds[16] = {  0,  0, 30,  0, 30,  0, 30,  0, 30,  0, 30,  0, 30,  0, 30,  0 };
 //static uint8_t frames[16]  = {  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 };
@@ -683,14 +695,15 @@ void CDROMWriteWord(uint32_t offset, uint16_t data, uint32_t who/*=UNKNOWN*/)
 // State machine for sending/receiving data along a serial bus
 //
 
-enum ButchState { ST_INIT, ST_RISING, ST_FALLING };
-static ButchState currentState = ST_INIT;
-static uint16_t counter = 0;
-static bool cmdTx = false;
-static uint16_t busCmd;
-static uint16_t rxData, txData;
-static uint16_t rxDataBit;
-static bool firstTime = false;
+// (ButchState is in cdrom.h)
+#define currentState		(CONTEXT(cdrom).currentState)
+#define counter				(CONTEXT(cdrom).counter)
+#define cmdTx				(CONTEXT(cdrom).cmdTx)
+#define busCmd				(CONTEXT(cdrom).busCmd)
+#define rxData				(CONTEXT(cdrom).rxData)
+#define txData				(CONTEXT(cdrom).txData)
+#define rxDataBit			(CONTEXT(cdrom).rxDataBit)
+#define firstTime			(CONTEXT(cdrom).firstTime)
 
 static void CDROMBusWrite(uint16_t data)
 {
@@ -807,7 +820,8 @@ static uint16_t CDROMBusRead(void)
 // This simulates a read from BUTCH over the SSI to JERRY. Uses real reading!
 //
 //temp, until I can fix my CD image... Argh!
-static uint8_t cdBuf2[2532 + 96], cdBuf3[2532 + 96];
+#define cdBuf2				(CONTEXT(cdrom).cdBuf2)
+#define cdBuf3				(CONTEXT(cdrom).cdBuf3)
 uint16_t GetWordFromButchSSI(uint32_t offset, uint32_t who/*= UNKNOWN*/)
 {
 	bool go = ((offset & 0x0F) == 0x0A || (offset & 0x0F) == 0x0E ? true : false);
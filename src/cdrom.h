@@ -6,6 +6,7 @@
 #define __CDROM_H__
 
 //#include "types.h"
+#include "context.h"
 #include "vjag_memory.h"
 
 void CDROMInit(void);
@@ -23,4 +24,30 @@ bool ButchIsReadyToSend(void);
 uint16_t GetWordFromButchSSI(uint32_t offset, uint32_t who = UNKNOWN);
 void SetSSIWordsXmittedFromButch(void);
 
+// What CDROM.CPP knows about the machine (see context.h)
+
+enum ButchState { ST_INIT, ST_RISING, ST_FALLING };
+
+struct CDROMState
+{
+	uint8_t cdRam[0x100];
+	uint16_t cdCmd, cdPtr;
+	bool haveCDGoodness;
+	uint32_t min, sec, frm, block;
+	uint8_t cdBuf[2352 + 96];
+	uint32_t cdBufPtr;
+	uint8_t trackNum, minTrack, maxTrack;
+
+	// The serial bus' state machine
+	ButchState currentState;
+	uint16_t counter;
+	bool cmdTx;
+	uint16_t busCmd;
+	uint16_t rxData, txData;
+	uint16_t rxDataBit;
+	bool firstTime;
+
+	uint8_t cdBuf2[2532 + 96], cdBuf3[2532 + 96];
+};
+
 #endif	// __CDROM_H__
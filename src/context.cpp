@@ -0,0 +1,168 @@
+//
+// context.cpp: Making & switching between emulated Jaguars (see context.h)
+//
+
+#include "context.h"
+
+#ifdef MULTI_INSTANCE
+
+#include <stdlib.h>
+#include "blitter.h"
+#include "cdrom.h"
+#include "dac.h"
+#include "dsp.h"
+#include "dspthread.h"
+#include "eeprom.h"
+#include "event.h"
+#include "gpu.h"
+#include "jaguar.h"
+#include "libretro_state.h"
+#include "jerry.h"
+#include "joystick.h"
+#include "movie.h"
+#include "op.h"
+#include "settings.h"
+#include "state.h"
+#include "tom.h"
+#include "tomscan.h"
+#include "tomthread.h"
+#include "vjag_memory.h"
+#include "m68000/cpudefs.h"
+#include "m68000/m68kinterface.h"
+
+#ifdef HAVE_THREADS
+#include <pthread.h>
+#endif
+
+CONTEXT_LOCAL struct JaguarContext * jaguarContext = NULL;
+
+#ifdef HAVE_THREADS
+static pthread_mutex_t tableLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+#define ALLOCATE_STATE(module, type) \
+	if (!(context->module = (type *)calloc(1, sizeof(type)))) \
+		failed = true
+
+#define FREE_STATE(module) \
+	free(context->module)
+
+
+//
+// The lookup tables are the same for every machine, so they're shared. Each
+// one's filled the first time it's asked for & left alone after that; doing
+// it here, before there's a machine that could be running, keeps two of them
+// from filling one at the same time.
+//
+static void JaguarContextFillTables(void)
+{
+#ifdef HAVE_THREADS
+	pthread_mutex_lock(&tableLock);
+#endif
+	TOMFillLookupTables();
+	TOMScanInit();
+	OPFillBlendTables();
+	GPUFillTables();
+	DSPFillTables();
+	m68k_fill_tables();
+#ifdef HAVE_THREADS
+	pthread_mutex_unlock(&tableLock);
+#endif
+}
+
+
+//
+// Make a new machine, all zeroes. Nothing's been initialized yet; make it
+// current & call retro_init() & retro_load_game() to do that.
+//
+struct JaguarContext * JaguarContextCreate(void)
+{
+	struct JaguarContext * context = (JaguarContext *)calloc(1, sizeof(JaguarContext));
+	bool failed = false;
+
+	if (!context)
+		return NULL;
+
+	JaguarContextFillTables();
+	ALLOCATE_STATE(memory, MemoryState);
+	ALLOCATE_STATE(jaguar, JaguarState);
+	ALLOCATE_STATE(event, EventState);
+	ALLOCATE_STATE(settings, VJSettings);
+	ALLOCATE_STATE(tom, TOMState);
+	ALLOCATE_STATE(jerry, JERRYState);
+	ALLOCATE_STATE(op, OPState);
+	ALLOCATE_STATE(blitter, BlitterState);
+	ALLOCATE_STATE(gpu, GPUState);
+	ALLOCATE_STATE(dsp, DSPState);
+	ALLOCATE_STATE(m68k, M68KState);
+	ALLOCATE_STATE(cdrom, CDROMState);
+	ALLOCATE_STATE(eeprom, EEPROMState);
+	ALLOCATE_STATE(joystick, JoystickState);
+	ALLOCATE_STATE(dac, DACState);
+	ALLOCATE_STATE(state, StateState);
+	ALLOCATE_STATE(movie, MovieState);
+	ALLOCATE_STATE(dspThread, DSPThreadState);
+	ALLOCATE_STATE(tomThread, TOMThreadState);
+	ALLOCATE_STATE(libretro, LibretroState);
+
+	if (failed)
+	{
+		JaguarContextDestroy(context);
+		return NULL;
+	}
+
+	return context;
+}
+
+
+//
+// Throw away a machine. Call retro_unload_game() & retro_deinit() with it
+// current first, so it's not running any threads of its own.
+//
+void JaguarContextDestroy(struct JaguarContext * context)
+{
+	if (!context)
+		return;
+
+	if (jaguarContext == context)
+		jaguarContext = NULL;
+
+	FREE_STATE(memory);
+	FREE_STATE(jaguar);
+	FREE_STATE(event);
+	FREE_STATE(settings);
+	FREE_STATE(tom);
+	FREE_STATE(jerry);
+	FREE_STATE(op);
+	FREE_STATE(blitter);
+	FREE_STATE(gpu);
+	FREE_STATE(dsp);
+	FREE_STATE(m68k);
+	FREE_STATE(cdrom);
+	FREE_STATE(eeprom);
+	FREE_STATE(joystick);
+	FREE_STATE(dac);
+	FREE_STATE(state);
+	FREE_STATE(movie);
+	FREE_STATE(dspThread);
+	FREE_STATE(tomThread);
+	FREE_STATE(libretro);
+	free(context);
+}
+
+
+//
+// Everything the core does on this thread from now on is done to this machine
+//
+void JaguarContextMakeCurrent(struct JaguarContext * context)
+{
+	jaguarContext = context;
+}
+
+
+struct JaguarContext * JaguarContextCurrent(void)
+{
+	return jaguarContext;
+}
+
+#endif	// MULTI_INSTANCE
@@ -0,0 +1,123 @@
+//
+// context.h: Where each emulated Jaguar keeps its state
+//
+// Everything that makes up one machine lives in a state struct per module
+// (MemoryState in vjag_memory.h, GPUState in gpu.h & so on), & the code gets
+// at them thru CONTEXT(module). Each module keeps the names its globals used
+// to have as macros on top of its struct, so the code that uses them reads
+// the same as it ever did.
+//
+// Normally there's only the one machine, & each module's struct is a plain
+// global (memoryState, gpuState, ...). That compiles down to exactly what
+// the globals did, so the libretro core pays nothing for any of this.
+//
+// Built with MULTI_INSTANCE (make MULTI_INSTANCE=1), the structs are
+// allocated per JaguarContext instead, & CONTEXT() goes thru the calling
+// thread's current context. That lets one process run as many Jaguars as it
+// likes, each on its own thread. Make a context current on a thread & call
+// the retro_* entry points as usual; the core's own worker threads (see
+// dspthread.cpp & tomthread.cpp) pick up the context of whoever started them.
+// tools/multirun.cpp does just that, & the core exports the JaguarContext*
+// functions for frontends that want to do the same.
+//
+// The lookup tables (see context.cpp), the log, the profiler & the debugging
+// switches aren't part of any one machine, so they're still shared by all of
+// them.
+//
+
+#ifndef __CONTEXT_H__
+#define __CONTEXT_H__
+
+#ifdef MULTI_INSTANCE
+
+#if defined(_MSC_VER)
+#define CONTEXT_LOCAL	__declspec(thread)
+#elif defined(__GNUC__)
+// The core only ever looks at its own thread pointer, so there's no need for
+// the (slow) general dynamic model, even when it's a shared library
+#define CONTEXT_LOCAL	__thread __attribute__((tls_model("initial-exec")))
+#else
+#define CONTEXT_LOCAL	_Thread_local
+#endif
+
+struct JaguarContext
+{
+	struct MemoryState * memory;
+	struct JaguarState * jaguar;
+	struct EventState * event;
+	struct VJSettings * settings;
+	struct TOMState * tom;
+	struct JERRYState * jerry;
+	struct OPState * op;
+	struct BlitterState * blitter;
+	struct GPUState * gpu;
+	struct DSPState * dsp;
+	struct M68KState * m68k;
+	struct CDROMState * cdrom;
+	struct EEPROMState * eeprom;
+	struct JoystickState * joystick;
+	struct DACState * dac;
+	struct StateState * state;
+	struct MovieState * movie;
+	struct DSPThreadState * dspThread;
+	struct TOMThreadState * tomThread;
+	struct LibretroState * libretro;
+};
+
+#define CONTEXT(module)		(*jaguarContext->module)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern CONTEXT_LOCAL struct JaguarContext * jaguarContext;
+
+struct JaguarContext * JaguarContextCreate(void);
+void JaguarContextDestroy(struct JaguarContext * context);
+void JaguarContextMakeCurrent(struct JaguarContext * context);
+struct JaguarContext * JaguarContextCurrent(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#else
+
+#define CONTEXT(module)		(module##State)
+
+// There's only the one machine, so there's nothing to switch between
+#define JaguarContextCurrent()				NULL
+#define JaguarContextMakeCurrent(context)	((void)(context))
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct MemoryState memoryState;
+extern struct JaguarState jaguarState;
+extern struct EventState eventState;
+extern struct VJSettings settingsState;
+extern struct TOMState tomState;
+extern struct JERRYState jerryState;
+extern struct OPState opState;
+extern struct BlitterState blitterState;
+extern struct GPUState gpuState;
+extern struct DSPState dspState;
+extern struct M68KState m68kState;
+extern struct CDROMState cdromState;
+extern struct EEPROMState eepromState;
+extern struct JoystickState joystickState;
+extern struct DACState dacState;
+extern struct StateState stateState;
+extern struct MovieState movieState;
+extern struct DSPThreadState dspThreadState;
+extern struct TOMThreadState tomThreadState;
+extern struct LibretroState libretroState;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MULTI_INSTANCE
+
+#endif	// __CONTEXT_H__
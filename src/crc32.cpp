@@ -54,10 +54,20 @@ static unsigned long crctable[256] =
 
 int crc32_calcCheckSum(unsigned char * data, unsigned int length)
 {
-	unsigned long crc = 0xFFFFFFFF;
+	return crc32_update(0, data, length);
+}
+
+
+//
+// Same as above, but carries on from a previous CRC (start with 0), so that
+// data that isn't all in one piece can be checksummed
+//
+unsigned int crc32_update(unsigned int crc, const unsigned char * data, unsigned int length)
+{
+	unsigned long c = crc ^ 0xFFFFFFFF;
 
 	for(unsigned int i=0; i<length; i++)
-		crc = crctable[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+		c = crctable[(c ^ *data++) & 0xFF] ^ (c >> 8);
 
-	return crc ^ 0xFFFFFFFF;
+	return (unsigned int)(c ^ 0xFFFFFFFF);
 }
@@ -6,5 +6,6 @@
 #define __CRC32_H__
 
 int crc32_calcCheckSum(unsigned char * data, unsigned int length);
+unsigned int crc32_update(unsigned int crc, const unsigned char * data, unsigned int length);
 
 #endif	// __CRC32_H__
@@ -51,6 +51,7 @@
 #include "log.h"
 #include "m68000/m68kinterface.h"
 //#include "vjag_memory.h"
+#include "profile.h"
 #include "settings.h"
 
 
@@ -75,8 +76,14 @@
 
 // Local variables
 
-static SDL_AudioSpec desired;
-static bool SDLSoundInitialized;
+#ifndef MULTI_INSTANCE
+struct DACState dacState;
+#endif
+
+#define desired				(CONTEXT(dac).desired)
+#define SDLSoundInitialized	(CONTEXT(dac).SDLSoundInitialized)
+#define sampleCycles		(CONTEXT(dac).sampleCycles)
+#define dspCyclesAhead		(CONTEXT(dac).dspCyclesAhead)
 //static uint8_t SCLKFrequencyDivider = 19;			// Default is roughly 22 KHz (20774 Hz in NTSC mode)
 // /*static*/ uint16_t serialMode = 0;
 
@@ -133,6 +140,7 @@ void DACReset(void)
 {
 //	LeftFIFOHeadPtr = LeftFIFOTailPtr = 0, RightFIFOHeadPtr = RightFIFOTailPtr = 1;
 	ltxd = lrxd = desired.silence;
+	dspCyclesAhead = 0;
 }
 
 
@@ -160,6 +168,23 @@ void DACDone(void)
 }
 
 
+//
+// The sample buffer is always drained by the end of SDLSoundCallback(), so
+// all that's left to save are the I2S registers (& how far the DSP is ahead).
+//
+void DACStateSync(StateBuffer * sb)
+{
+	STATE_SYNC(sb, dspCyclesAhead);
+	STATE_SYNC(sb, ltxd);
+	STATE_SYNC(sb, rtxd);
+	STATE_SYNC(sb, lrxd);
+	STATE_SYNC(sb, rrxd);
+	STATE_SYNC(sb, sclk);
+	STATE_SYNC(sb, sstat);
+	STATE_SYNC(sb, smode);
+}
+
+
 // Approach: Run the DSP for however many cycles needed to correspond to whatever sample rate
 // we've set the audio to run at. So, e.g., if we run it at 48 KHz, then we would run the DSP
 // for however much time it takes to fill the buffer. So with a 2K buffer, this would correspond
@@ -175,10 +200,10 @@ void DACDone(void)
 // Note: The samples are packed in the buffer in 16 bit left/16 bit right pairs.
 //       Also, length is the length of the buffer in BYTES
 //
-uint16_t * sampleBuffer;
-static int bufferIndex = 0;
-static int numberOfSamples = 0;
-static bool bufferDone = false;
+#define outputBuffer		(CONTEXT(dac).outputBuffer)
+#define bufferIndex			(CONTEXT(dac).bufferIndex)
+#define numberOfSamples		(CONTEXT(dac).numberOfSamples)
+#define bufferDone			(CONTEXT(dac).bufferDone)
 void SDLSoundCallback(void * userdata, uint16_t * buffer, int length)
 {
 	// 1st, check to see if the DSP is running. If not, fill the buffer with L/RXTD and exit.
@@ -204,28 +229,38 @@ void SDLSoundCallback(void * userdata, uint16_t * buffer, int length)
 	// Now, run the DSP for that length of time for each sample we need to make
 
 	bufferIndex = 0;
-	sampleBuffer = buffer;
+	outputBuffer = buffer;
 // If length is the length of the sample buffer in BYTES, then shouldn't the # of
 // samples be / 4? No, because we bump the sample count by 2, so this is OK.
 	numberOfSamples = length;
 	bufferDone = false;
+	sampleCycles = USEC_TO_RISC_CYCLES(1000000.0 / (double)DAC_AUDIO_RATE);
 
-	SetCallbackTime(DSPSampleCallback, 1000000.0 / (double)DAC_AUDIO_RATE, EVENT_JERRY);
+	SetCallbackCycles(DSPSampleCallback, sampleCycles, EVENT_JERRY);
 
 	// These timings are tied to NTSC, need to fix that in event.cpp/h! [FIXED]
 	do
 	{
-		double timeToNextEvent = GetTimeToNextEvent(EVENT_JERRY);
+		// Just like the CPUs on the main timeline (see JaguarExecuteNew()),
+		// the DSP carries whatever it overshoots by into the next slice
+		int32_t slice = (int32_t)GetCyclesToNextEvent(EVENT_JERRY) - dspCyclesAhead;
 
 		if (vjs.DSPEnabled)
 		{
-			if (vjs.usePipelinedDSP)
-				DSPExecP2(USEC_TO_RISC_CYCLES(timeToNextEvent));
+			if (slice > 0)
+			{
+				ProfileEnter(PROFILE_DSP);
+				int32_t dspCycles = (vjs.usePipelinedDSP ? DSPExecP2(slice) : DSPExec(slice));
+				ProfileLeave();
+				dspCyclesAhead = (dspCycles > slice ? dspCycles - slice : 0);
+			}
 			else
-				DSPExec(USEC_TO_RISC_CYCLES(timeToNextEvent));
+				dspCyclesAhead = -slice;
 		}
 
+		ProfileEnter(PROFILE_EVENTS);
 		HandleNextEvent(EVENT_JERRY);
+		ProfileLeave();
 	}
 	while (!bufferDone);
     
@@ -234,8 +269,8 @@ void SDLSoundCallback(void * userdata, uint16_t * buffer, int length)
 
 void DSPSampleCallback(void)
 {
-	sampleBuffer[bufferIndex + 0] = ltxd;
-	sampleBuffer[bufferIndex + 1] = rtxd;
+	outputBuffer[bufferIndex + 0] = ltxd;
+	outputBuffer[bufferIndex + 1] = rtxd;
 	bufferIndex += 2;
 
 	if (bufferIndex == numberOfSamples)
@@ -244,7 +279,7 @@ void DSPSampleCallback(void)
 		return;
 	}
 
-	SetCallbackTime(DSPSampleCallback, 1000000.0 / (double)DAC_AUDIO_RATE, EVENT_JERRY);
+	SetCallbackCycles(DSPSampleCallback, sampleCycles, EVENT_JERRY);
 }
 
 
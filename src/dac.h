@@ -5,12 +5,16 @@
 #ifndef __DAC_H__
 #define __DAC_H__
 
+#include "context.h"
 #include "vjag_memory.h"
+#include "state.h"
+#include "SDL.h"
 
 void DACInit(void);
 void DACReset(void);
 void DACPauseAudioThread(bool state = true);
 void DACDone(void);
+void DACStateSync(StateBuffer * sb);
 //int GetCalculatedFrequency(void);
 
 // DAC memory access
@@ -21,7 +25,23 @@ uint8_t DACReadByte(uint32_t offset, uint32_t who = UNKNOWN);
 uint16_t DACReadWord(uint32_t offset, uint32_t who = UNKNOWN);
 
 void SDLSoundCallback(void * userdata, uint16_t * buffer, int length);
-extern uint16_t *sampleBuffer;
+// What DAC.CPP knows about the machine (see context.h)
+
+struct DACState
+{
+	SDL_AudioSpec desired;
+	bool SDLSoundInitialized;
+	uint32_t sampleCycles;						// Time between samples, in RISC cycles
+	int32_t dspCyclesAhead;						// RISC cycles the DSP ran past the timeline
+
+	uint16_t * sampleBuffer;
+	uint16_t * outputBuffer;					// Where the current callback's samples go
+	int bufferIndex;
+	int numberOfSamples;
+	bool bufferDone;
+};
+
+#define sampleBuffer		(CONTEXT(dac).sampleBuffer)
 
 // DAC defines
 
@@ -19,12 +19,17 @@
 #include "SDL.h"								// Used only for SDL_GetTicks...
 #include <stdlib.h>
 #include "dac.h"
+#include "dspthread.h"
 #include "gpu.h"
 #include "jagdasm.h"
 #include "jaguar.h"
 #include "jerry.h"
 #include "log.h"
 #include "m68000/m68kinterface.h"
+#include "profile.h"
+#include "risc.h"
+#include "riscjit.h"
+#include "settings.h"
 //#include "vjag_memory.h"
 
 
@@ -168,31 +173,23 @@ const bool affectsScoreboard[64] =
 	false, false, false,  true
 };
 
-struct PipelineStage
-{
-	uint16_t instruction;
-	uint8_t opcode, operand1, operand2;
-	uint32_t reg1, reg2, areg1, areg2;
-	uint32_t result;
-	uint8_t writebackRegister;
-	// General memory store...
-	uint32_t address;
-	uint32_t value;
-	uint8_t type;
-};
+// (PipelineStage is in dsp.h, with the rest of the DSP's state)
 
 #define TYPE_BYTE			0
 #define TYPE_WORD			1
 #define TYPE_DWORD			2
 #define PIPELINE_STALL		64						// Set to # of opcodes + 1
-#ifndef NEW_SCOREBOARD
-bool scoreboard[32];
-#else
-uint8_t scoreboard[32];
+#ifndef MULTI_INSTANCE
+struct DSPState dspState;
 #endif
-uint8_t plPtrFetch, plPtrRead, plPtrExec, plPtrWrite;
-PipelineStage pipeline[4];
-bool IMASKCleared = false;
+
+#define scoreboard					(CONTEXT(dsp).scoreboard)
+#define plPtrFetch					(CONTEXT(dsp).plPtrFetch)
+#define plPtrRead					(CONTEXT(dsp).plPtrRead)
+#define plPtrExec					(CONTEXT(dsp).plPtrExec)
+#define plPtrWrite					(CONTEXT(dsp).plPtrWrite)
+#define pipeline					(CONTEXT(dsp).pipeline)
+#define IMASKCleared				(CONTEXT(dsp).IMASKCleared)
 
 // DSP flags (old--have to get rid of this crap)
 
@@ -244,72 +241,6 @@ bool IMASKCleared = false;
 
 extern uint32_t jaguar_mainRom_crc32;
 
-// Is opcode 62 *really* a NOP? Seems like it...
-static void dsp_opcode_abs(void);
-static void dsp_opcode_add(void);
-static void dsp_opcode_addc(void);
-static void dsp_opcode_addq(void);
-static void dsp_opcode_addqmod(void);
-static void dsp_opcode_addqt(void);
-static void dsp_opcode_and(void);
-static void dsp_opcode_bclr(void);
-static void dsp_opcode_bset(void);
-static void dsp_opcode_btst(void);
-static void dsp_opcode_cmp(void);
-static void dsp_opcode_cmpq(void);
-static void dsp_opcode_div(void);
-static void dsp_opcode_imacn(void);
-static void dsp_opcode_imult(void);
-static void dsp_opcode_imultn(void);
-static void dsp_opcode_jr(void);
-static void dsp_opcode_jump(void);
-static void dsp_opcode_load(void);
-static void dsp_opcode_loadb(void);
-static void dsp_opcode_loadw(void);
-static void dsp_opcode_load_r14_indexed(void);
-static void dsp_opcode_load_r14_ri(void);
-static void dsp_opcode_load_r15_indexed(void);
-static void dsp_opcode_load_r15_ri(void);
-static void dsp_opcode_mirror(void);
-static void dsp_opcode_mmult(void);
-static void dsp_opcode_move(void);
-static void dsp_opcode_movei(void);
-static void dsp_opcode_movefa(void);
-static void dsp_opcode_move_pc(void);
-static void dsp_opcode_moveq(void);
-static void dsp_opcode_moveta(void);
-static void dsp_opcode_mtoi(void);
-static void dsp_opcode_mult(void);
-static void dsp_opcode_neg(void);
-static void dsp_opcode_nop(void);
-static void dsp_opcode_normi(void);
-static void dsp_opcode_not(void);
-static void dsp_opcode_or(void);
-static void dsp_opcode_resmac(void);
-static void dsp_opcode_ror(void);
-static void dsp_opcode_rorq(void);
-static void dsp_opcode_xor(void);
-static void dsp_opcode_sat16s(void);
-static void dsp_opcode_sat32s(void);
-static void dsp_opcode_sh(void);
-static void dsp_opcode_sha(void);
-static void dsp_opcode_sharq(void);
-static void dsp_opcode_shlq(void);
-static void dsp_opcode_shrq(void);
-static void dsp_opcode_store(void);
-static void dsp_opcode_storeb(void);
-static void dsp_opcode_storew(void);
-static void dsp_opcode_store_r14_indexed(void);
-static void dsp_opcode_store_r14_ri(void);
-static void dsp_opcode_store_r15_indexed(void);
-static void dsp_opcode_store_r15_ri(void);
-static void dsp_opcode_sub(void);
-static void dsp_opcode_subc(void);
-static void dsp_opcode_subq(void);
-static void dsp_opcode_subqmod(void);
-static void dsp_opcode_subqt(void);
-static void dsp_opcode_illegal(void);
-
 /*uint8_t dsp_opcode_cycles[64] =
 {
 	3,  3,  3,  3,  3,  3,  3,  3,
@@ -340,27 +271,6 @@ uint8_t dsp_opcode_cycles[64] =
 	1,  1,  3,  3,  1,  1,  1,  1
 };//*/
 
-void (* dsp_opcode[64])() =
-{
-	dsp_opcode_add,					dsp_opcode_addc,				dsp_opcode_addq,				dsp_opcode_addqt,
-	dsp_opcode_sub,					dsp_opcode_subc,				dsp_opcode_subq,				dsp_opcode_subqt,
-	dsp_opcode_neg,					dsp_opcode_and,					dsp_opcode_or,					dsp_opcode_xor,
-	dsp_opcode_not,					dsp_opcode_btst,				dsp_opcode_bset,				dsp_opcode_bclr,
-	dsp_opcode_mult,				dsp_opcode_imult,				dsp_opcode_imultn,				dsp_opcode_resmac,
-	dsp_opcode_imacn,				dsp_opcode_div,					dsp_opcode_abs,					dsp_opcode_sh,
-	dsp_opcode_shlq,				dsp_opcode_shrq,				dsp_opcode_sha,					dsp_opcode_sharq,
-	dsp_opcode_ror,					dsp_opcode_rorq,				dsp_opcode_cmp,					dsp_opcode_cmpq,
-	dsp_opcode_subqmod,				dsp_opcode_sat16s,				dsp_opcode_move,				dsp_opcode_moveq,
-	dsp_opcode_moveta,				dsp_opcode_movefa,				dsp_opcode_movei,				dsp_opcode_loadb,
-	dsp_opcode_loadw,				dsp_opcode_load,				dsp_opcode_sat32s,				dsp_opcode_load_r14_indexed,
-	dsp_opcode_load_r15_indexed,	dsp_opcode_storeb,				dsp_opcode_storew,				dsp_opcode_store,
-	dsp_opcode_mirror,				dsp_opcode_store_r14_indexed,	dsp_opcode_store_r15_indexed,	dsp_opcode_move_pc,
-	dsp_opcode_jump,				dsp_opcode_jr,					dsp_opcode_mmult,				dsp_opcode_mtoi,
-	dsp_opcode_normi,				dsp_opcode_nop,					dsp_opcode_load_r14_ri,			dsp_opcode_load_r15_ri,
-	dsp_opcode_store_r14_ri,		dsp_opcode_store_r15_ri,		dsp_opcode_illegal,				dsp_opcode_addqmod,
-};
-
-uint32_t dsp_opcode_use[65];
 
 const char * dsp_opcode_str[65]=
 {
@@ -383,25 +293,100 @@ const char * dsp_opcode_str[65]=
 	"STALL"
 };
 
-uint32_t dsp_pc;
-static uint64_t dsp_acc;								// 40 bit register, NOT 32!
-static uint32_t dsp_remain;
-static uint32_t dsp_modulo;
-static uint32_t dsp_flags;
-static uint32_t dsp_matrix_control;
-static uint32_t dsp_pointer_to_matrix;
-static uint32_t dsp_data_organization;
-uint32_t dsp_control;
-static uint32_t dsp_div_control;
-static uint8_t dsp_flag_z, dsp_flag_n, dsp_flag_c;
-static uint32_t * dsp_reg = NULL, * dsp_alternate_reg = NULL;
-uint32_t dsp_reg_bank_0[32], dsp_reg_bank_1[32];
-
-static uint32_t dsp_opcode_first_parameter;
-static uint32_t dsp_opcode_second_parameter;
+#define dsp_pc						(CONTEXT(dsp).dsp_pc)
+#define dsp_acc						(CONTEXT(dsp).dsp_acc)
+#define dsp_remain					(CONTEXT(dsp).dsp_remain)
+#define dsp_modulo					(CONTEXT(dsp).dsp_modulo)
+#define dsp_flags					(CONTEXT(dsp).dsp_flags)
+#define dsp_matrix_control			(CONTEXT(dsp).dsp_matrix_control)
+#define dsp_pointer_to_matrix		(CONTEXT(dsp).dsp_pointer_to_matrix)
+#define dsp_data_organization		(CONTEXT(dsp).dsp_data_organization)
+#define dsp_control					(CONTEXT(dsp).dsp_control)
+#define dsp_div_control				(CONTEXT(dsp).dsp_div_control)
+#define dsp_flag_zn					(CONTEXT(dsp).dsp_flag_zn)
+#define dsp_flag_c					(CONTEXT(dsp).dsp_flag_c)
+#define dsp_reg						(CONTEXT(dsp).dsp_reg)
+#define dsp_alternate_reg			(CONTEXT(dsp).dsp_alternate_reg)
+#define dsp_opcode_first_parameter	(CONTEXT(dsp).dsp_opcode_first_parameter)
+#define dsp_opcode_second_parameter	(CONTEXT(dsp).dsp_opcode_second_parameter)
 
 #define DSP_RUNNING			(dsp_control & 0x01)
 
+#define dsp_ram_8					(CONTEXT(dsp).dsp_ram_8)
+
+#define dsp_in_exec					(CONTEXT(dsp).dsp_in_exec)
+#define dsp_releaseTimeSlice_flag	(CONTEXT(dsp).dsp_releaseTimeSlice_flag)
+#define dsp_decode_cache			(CONTEXT(dsp).dsp_decode_cache)
+#define dsp_jit_state				(CONTEXT(dsp).dsp_jit_state)
+#define dsp_jit						(CONTEXT(dsp).dsp_jit)
+
+void DSPHandleIRQsNP(void);
+
+//
+// What the RISC core (see risc.h) needs to know about the DSP
+//
+struct DSPTraits
+{
+	enum { WHO = DSP, RAM_BASE = DSP_WORK_RAM_BASE, RAM_SIZE = 0x2000, IRQS = 6,
+		PROFILE = PROFILE_DSP, DASM = JAGUAR_DSP };
+	typedef uint64_t Accumulator;
+
+	static inline uint32_t & pc(void) { return dsp_pc; }
+	static inline uint32_t * & reg(void) { return dsp_reg; }
+	static inline uint32_t * & alternateReg(void) { return dsp_alternate_reg; }
+	static inline uint32_t * regBank0(void) { return dsp_reg_bank_0; }
+	static inline uint32_t * regBank1(void) { return dsp_reg_bank_1; }
+	static inline uint32_t & flags(void) { return dsp_flags; }
+	static inline uint32_t & control(void) { return dsp_control; }
+	static inline uint64_t & flagZN(void) { return dsp_flag_zn; }
+	static inline uint8_t & flagC(void) { return dsp_flag_c; }
+	static inline Accumulator & acc(void) { return dsp_acc; }
+	static inline uint32_t & remain(void) { return dsp_remain; }
+	static inline uint32_t & modulo(void) { return dsp_modulo; }
+	static inline uint32_t & divControl(void) { return dsp_div_control; }
+	static inline uint32_t & matrixControl(void) { return dsp_matrix_control; }
+	static inline uint32_t & pointerToMatrix(void) { return dsp_pointer_to_matrix; }
+	static inline uint32_t & firstParameter(void) { return dsp_opcode_first_parameter; }
+	static inline uint32_t & secondParameter(void) { return dsp_opcode_second_parameter; }
+	static inline uint32_t & inExec(void) { return dsp_in_exec; }
+	static inline uint8_t * ram(void) { return dsp_ram_8; }
+	static inline uint32_t * opcodeUse(void) { return dsp_opcode_use; }
+	static inline RISCDecodedOp * decodeCache(void) { return dsp_decode_cache; }
+	static inline RISCJitCore & jit(void) { return dsp_jit; }
+	static void (* (& opcode)[64])();
+	static uint8_t (& opcodeCycles)[64];
+
+	static inline uint16_t ReadWord(uint32_t offset) { return DSPReadWord(offset, DSP); }
+	static inline uint32_t ReadLong(uint32_t offset) { return DSPReadLong(offset, DSP); }
+	static inline void WriteLong(uint32_t offset, uint32_t data) { DSPWriteLong(offset, data, DSP); }
+	static inline void Exec(int32_t cycles) { DSPExec(cycles); }
+
+	static inline void BeforeOpcode(void)
+	{
+		if (IMASKCleared)						// If IMASK was cleared,
+		{
+#ifdef DSP_DEBUG_IRQ
+			WriteLog("DSP: Finished interrupt. PC=$%06X\n", dsp_pc);
+#endif
+			DSPHandleIRQsNP();					// See if any other interrupts are pending!
+			IMASKCleared = false;
+		}
+	}
+
+	static inline bool Tracing(void)
+	{
+#ifdef DEBUG_HOOKS
+		return doDSPDis;
+#else
+		return false;
+#endif
+	}
+};
+
+typedef RISC<DSPTraits> DSPRISC;
+
+// The pipelined core below still uses these
+
 #define RM					dsp_reg[dsp_opcode_first_parameter]
 #define RN					dsp_reg[dsp_opcode_second_parameter]
 #define ALTERNATE_RM		dsp_alternate_reg[dsp_opcode_first_parameter]
@@ -409,30 +394,101 @@ static uint32_t dsp_opcode_second_parameter;
 #define IMM_1				dsp_opcode_first_parameter
 #define IMM_2				dsp_opcode_second_parameter
 
-#define CLR_Z				(dsp_flag_z = 0)
-#define CLR_ZN				(dsp_flag_z = dsp_flag_n = 0)
-#define CLR_ZNC				(dsp_flag_z = dsp_flag_n = dsp_flag_c = 0)
-#define SET_Z(r)			(dsp_flag_z = ((r) == 0))
-#define SET_N(r)			(dsp_flag_n = (((uint32_t)(r) >> 31) & 0x01))
-#define SET_C_ADD(a,b)		(dsp_flag_c = ((uint32_t)(b) > (uint32_t)(~(a))))
-#define SET_C_SUB(a,b)		(dsp_flag_c = ((uint32_t)(b) > (uint32_t)(a)))
-#define SET_ZN(r)			SET_N(r); SET_Z(r)
-#define SET_ZNC_ADD(a,b,r)	SET_N(r); SET_Z(r); SET_C_ADD(a,b)
-#define SET_ZNC_SUB(a,b,r)	SET_N(r); SET_Z(r); SET_C_SUB(a,b)
-
-uint32_t dsp_convert_zero[32] = {
-	32, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
-	17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31
+#define DSP_FLAG_Z			DSPRISC::FlagZ()
+#define DSP_FLAG_N			DSPRISC::FlagN()
+
+#define CLR_ZN				(dsp_flag_zn = 1)
+#define CLR_ZNC				DSPRISC::ClearZNC()
+#define SET_Z(r)			DSPRISC::SetZ(r)
+#define SET_N(r)			DSPRISC::SetN(r)
+#define SET_ZN_FLAGS(z,n)	DSPRISC::SetZNFlags(z, n)
+#define SET_ZN(r)			DSPRISC::SetZN(r)
+#define SET_ZNC_ADD(a,b,r)	DSPRISC::SetZNCAdd(a, b, r)
+#define SET_ZNC_SUB(a,b,r)	DSPRISC::SetZNCSub(a, b, r)
+
+#define BRANCH_CONDITION(x)	DSPRISC::branchCondition[(x) + ((jaguar_flags & 7) << 5)]
+
+// Is opcode 62 *really* a NOP? Seems like it...
+void (* dsp_opcode[64])() =
+{
+	DSPRISC::opcode_add,				DSPRISC::opcode_addc,				DSPRISC::opcode_addq,				DSPRISC::opcode_addqt,
+	DSPRISC::opcode_sub,				DSPRISC::opcode_subc,				DSPRISC::opcode_subq,				DSPRISC::opcode_subqt,
+	DSPRISC::opcode_neg,				DSPRISC::opcode_and,				DSPRISC::opcode_or,					DSPRISC::opcode_xor,
+	DSPRISC::opcode_not,				DSPRISC::opcode_btst,				DSPRISC::opcode_bset,				DSPRISC::opcode_bclr,
+	DSPRISC::opcode_mult,				DSPRISC::opcode_imult,				DSPRISC::opcode_imultn,				DSPRISC::opcode_resmac,
+	DSPRISC::opcode_imacn,				DSPRISC::opcode_div,				DSPRISC::opcode_abs,				DSPRISC::opcode_sh,
+	DSPRISC::opcode_shlq,				DSPRISC::opcode_shrq,				DSPRISC::opcode_sha,				DSPRISC::opcode_sharq,
+	DSPRISC::opcode_ror,				DSPRISC::opcode_rorq,				DSPRISC::opcode_cmp,				DSPRISC::opcode_cmpq,
+	DSPRISC::opcode_subqmod,			DSPRISC::opcode_sat16s,				DSPRISC::opcode_move,				DSPRISC::opcode_moveq,
+	DSPRISC::opcode_moveta,				DSPRISC::opcode_movefa,				DSPRISC::opcode_movei,				DSPRISC::opcode_loadb,
+	DSPRISC::opcode_loadw,				DSPRISC::opcode_load,				DSPRISC::opcode_sat32s,				DSPRISC::opcode_load_r14_indexed,
+	DSPRISC::opcode_load_r15_indexed,	DSPRISC::opcode_storeb,				DSPRISC::opcode_storew,				DSPRISC::opcode_store,
+	DSPRISC::opcode_mirror,				DSPRISC::opcode_store_r14_indexed,	DSPRISC::opcode_store_r15_indexed,	DSPRISC::opcode_move_pc,
+	DSPRISC::opcode_jump,				DSPRISC::opcode_jr,					DSPRISC::opcode_mmult,				DSPRISC::opcode_mtoi,
+	DSPRISC::opcode_normi,				DSPRISC::opcode_nop,				DSPRISC::opcode_load_r14_ri,		DSPRISC::opcode_load_r15_ri,
+	DSPRISC::opcode_store_r14_ri,		DSPRISC::opcode_store_r15_ri,		DSPRISC::opcode_illegal,			DSPRISC::opcode_addqmod,
+};
+
+
+// How the recompiler handles each opcode (see riscjit.h)
+
+static const uint8_t dsp_jit_kind[64] =
+{
+	RJ_ADD,		RJ_CALL,	RJ_ADDQ,	RJ_ADDQT,	RJ_SUB,		RJ_CALL,	RJ_SUBQ,	RJ_SUBQT,
+	RJ_NEG,		RJ_AND,		RJ_OR,		RJ_XOR,		RJ_NOT,		RJ_BTST,	RJ_BSET,	RJ_BCLR,
+	RJ_MULT,	RJ_IMULT,	RJ_CALL,	RJ_CALL,	RJ_CALL,	RJ_CALL,	RJ_CALL,	RJ_CALL,
+	RJ_SHLQ,	RJ_SHRQ,	RJ_CALL,	RJ_SHARQ,	RJ_CALL,	RJ_RORQ,	RJ_CMP,		RJ_CMPQ,
+	RJ_CALL,	RJ_CALL,	RJ_MOVE,	RJ_MOVEQ,	RJ_MOVETA,	RJ_MOVEFA,	RJ_MOVEI,	RJ_LOAD,
+	RJ_LOAD,	RJ_LOAD,	RJ_CALL,	RJ_LOAD,	RJ_LOAD,	RJ_STORE,	RJ_STORE,	RJ_STORE,
+	RJ_CALL,	RJ_STORE,	RJ_STORE,	RJ_CALL,	RJ_JUMP,	RJ_JR,		RJ_LOAD,	RJ_CALL,
+	RJ_CALL,	RJ_NOP,		RJ_LOAD,	RJ_LOAD,	RJ_STORE,	RJ_STORE,	RJ_END,		RJ_CALL
 };
 
-uint8_t dsp_branch_condition_table[32 * 8];
-static uint16_t mirror_table[65536];
-static uint8_t dsp_ram_8[0x2000];
+void (* (& DSPTraits::opcode)[64])() = dsp_opcode;
+uint8_t (& DSPTraits::opcodeCycles)[64] = dsp_opcode_cycles;
 
-#define BRANCH_CONDITION(x)		dsp_branch_condition_table[(x) + ((jaguar_flags & 7) << 5)]
 
-static uint32_t dsp_in_exec = 0;
-static uint32_t dsp_releaseTimeSlice_flag = 0;
+//
+// Tell the recompiler where this machine's DSP keeps everything
+//
+static void DSPJitSetup(void)
+{
+	RISCJitState state[DSP_JIT_STATES] =
+	{
+		{ dsp_reg_bank_0, sizeof(dsp_reg_bank_0), "bank 0" },
+		{ dsp_reg_bank_1, sizeof(dsp_reg_bank_1), "bank 1" },
+		{ &dsp_reg, sizeof(dsp_reg), "dsp_reg" },
+		{ &dsp_alternate_reg, sizeof(dsp_alternate_reg), "dsp_alternate_reg" },
+		{ &dsp_acc, sizeof(dsp_acc), "dsp_acc" },
+		{ &dsp_remain, sizeof(dsp_remain), "dsp_remain" },
+		{ &dsp_flag_zn, sizeof(dsp_flag_zn), "dsp_flag_zn" },
+		{ &dsp_flag_c, sizeof(dsp_flag_c), "dsp_flag_c" },
+		{ &dsp_pc, sizeof(dsp_pc), "dsp_pc" }
+	};
+
+	memcpy(dsp_jit_state, state, sizeof(state));
+	dsp_jit.name = "DSP";
+	dsp_jit.ramBase = DSP_WORK_RAM_BASE;
+	dsp_jit.ramSize = 0x2000;
+	dsp_jit.ram = dsp_ram_8;
+	dsp_jit.opcode = dsp_opcode;
+	dsp_jit.opcodeCycles = dsp_opcode_cycles;
+	dsp_jit.opcodeUse = dsp_opcode_use;
+	dsp_jit.opcodeKind = dsp_jit_kind;
+	dsp_jit.convertZero = DSPRISC::convertZero;
+	dsp_jit.firstParameter = &dsp_opcode_first_parameter;
+	dsp_jit.secondParameter = &dsp_opcode_second_parameter;
+	dsp_jit.pc = &dsp_pc;
+	dsp_jit.reg = &dsp_reg;
+	dsp_jit.alternateReg = &dsp_alternate_reg;
+	dsp_jit.flagZN = &dsp_flag_zn;
+	dsp_jit.flagC = &dsp_flag_c;
+	dsp_jit.control = &dsp_control;
+	dsp_jit.attention = &IMASKCleared;
+	dsp_jit.delaySlotIRQ = NULL;
+	dsp_jit.state = dsp_jit_state;
+	dsp_jit.numState = DSP_JIT_STATES;
+}
 
 FILE * dsp_fp;
 
@@ -463,45 +519,6 @@ void DSPReleaseTimeslice(void)
 	dsp_releaseTimeSlice_flag = 1;
 }
 
-void dsp_build_branch_condition_table(void)
-{
-	// Fill in the mirror table
-	for(int i=0; i<65536; i++)
-	{
-		mirror_table[i] = ((i >> 15) & 0x0001) | ((i >> 13) & 0x0002)
-			| ((i >> 11) & 0x0004) | ((i >> 9)  & 0x0008)
-			| ((i >> 7)  & 0x0010) | ((i >> 5)  & 0x0020)
-			| ((i >> 3)  & 0x0040) | ((i >> 1)  & 0x0080)
-			| ((i << 1)  & 0x0100) | ((i << 3)  & 0x0200)
-			| ((i << 5)  & 0x0400) | ((i << 7)  & 0x0800)
-			| ((i << 9)  & 0x1000) | ((i << 11) & 0x2000)
-			| ((i << 13) & 0x4000) | ((i << 15) & 0x8000);
-	}
-
-	// Fill in the condition table
-	for(int i=0; i<8; i++)
-	{
-		for(int j=0; j<32; j++)
-		{
-			int result = 1;
-
-			if ((j & 1) && (i & ZERO_FLAG))
-				result = 0;
-
-			if ((j & 2) && (!(i & ZERO_FLAG)))
-				result = 0;
-
-			if ((j & 4) && (i & (CARRY_FLAG << (j >> 4))))
-				result = 0;
-
-			if ((j & 8) && (!(i & (CARRY_FLAG << (j >> 4)))))
-				result = 0;
-
-			dsp_branch_condition_table[i * 32 + j] = result;
-		}
-	}
-}
-
 uint8_t DSPReadByte(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 {
 	if (offset >= 0xF1A000 && offset <= 0xF1A0FF)
@@ -590,7 +607,7 @@ uint32_t DSPReadLong(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 		switch (offset)
 		{
 		case 0x00:
-			dsp_flags = (dsp_flags & 0xFFFFFFF8) | (dsp_flag_n << 2) | (dsp_flag_c << 1) | dsp_flag_z;
+			dsp_flags = (dsp_flags & 0xFFFFFFF8) | (DSP_FLAG_N << 2) | (dsp_flag_c << 1) | DSP_FLAG_Z;
 			return dsp_flags & 0xFFFFC1FF;
 		case 0x04: return dsp_matrix_control;
 		case 0x08: return dsp_pointer_to_matrix;
@@ -618,6 +635,7 @@ void DSPWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 	{
 		offset -= DSP_WORK_RAM_BASE;
 		dsp_ram_8[offset] = data;
+		DSPRISC::LocalWrite(offset);
 //This is rather stupid! !!! FIX !!!
 /*		if (dsp_in_exec == 0)
 		{
@@ -667,6 +685,7 @@ void DSPWriteWord(uint32_t offset, uint16_t data, uint32_t who/*=UNKNOWN*/)
 		offset -= DSP_WORK_RAM_BASE;
 		dsp_ram_8[offset] = data >> 8;
 		dsp_ram_8[offset+1] = data & 0xFF;
+		DSPRISC::LocalWrite(offset);
 //This is rather stupid! !!! FIX !!!
 /*		if (dsp_in_exec == 0)
 		{
@@ -729,6 +748,8 @@ void DSPWriteLong(uint32_t offset, uint32_t data, uint32_t who/*=UNKNOWN*/)
 }//*/
 		offset -= DSP_WORK_RAM_BASE;
 		SET32(dsp_ram_8, offset, data);
+		DSPRISC::LocalWrite(offset);
+		DSPRISC::LocalWrite(offset + 2);
 //CC only!
 #ifdef DSP_DEBUG_CC
 SET32(ram1, offset, data),
@@ -752,9 +773,7 @@ SET32(ram2, offset, data);
 			// NOTE: According to the JTRM, writing a 1 to IMASK has no effect; only the
 			//       IRQ logic can set it. So we mask it out here to prevent problems...
 			dsp_flags = data & (~IMASK);
-			dsp_flag_z = dsp_flags & 0x01;
-			dsp_flag_c = (dsp_flags >> 1) & 0x01;
-			dsp_flag_n = (dsp_flags >> 2) & 0x01;
+			DSPRISC::SetFlags(dsp_flags);
 			DSPUpdateRegisterBanks();
 			dsp_control &= ~((dsp_flags & CINT04FLAGS) >> 3);
 			dsp_control &= ~((dsp_flags & CINT5FLAG) >> 1);
@@ -802,7 +821,7 @@ WriteLog("Write to DSP CTRL by %s: %08X (DSP PC=$%08X)\n", whoName[who], data, d
 				{
 					JERRYSetPendingIRQ(IRQ2_DSP);
 					DSPReleaseTimeslice();
-					m68k_set_irq(2);			// Set 68000 IPL 2...
+					DSPThreadSet68KIRQ(2);			// Set 68000 IPL 2...
 				}
 				data &= ~CPUINT;
 			}
@@ -812,7 +831,8 @@ WriteLog("Write to DSP CTRL by %s: %08X (DSP PC=$%08X)\n", whoName[who], data, d
 #ifdef DSP_DEBUG
 				WriteLog("DSP: CPU -> DSP interrupt\n");
 #endif
-				m68k_end_timeslice();
+				if (!DSPThreadIsWorker())
+					m68k_end_timeslice();
 				DSPReleaseTimeslice();
 				DSPSetIRQLine(DSPIRQ_CPU, ASSERT_LINE);
 				data &= ~DSPINT0;
@@ -894,18 +914,10 @@ WriteLog("DSP: Modulo data %08X written by %s.\n", data, whoName[who]);
 //
 void DSPUpdateRegisterBanks(void)
 {
-	int bank = (dsp_flags & REGPAGE);
-
-	if (dsp_flags & IMASK)
-		bank = 0;							// IMASK forces main bank to be bank 0
-
-	if (bank)
-		dsp_reg = dsp_reg_bank_1, dsp_alternate_reg = dsp_reg_bank_0;
-	else
-		dsp_reg = dsp_reg_bank_0, dsp_alternate_reg = dsp_reg_bank_1;
+	DSPRISC::UpdateRegisterBanks();
 
 #ifdef DSP_DEBUG_IRQ
-	WriteLog("DSP: Register bank #%s active.\n", (bank ? "1" : "0"));
+	WriteLog("DSP: Register bank #%s active.\n", (dsp_reg == dsp_reg_bank_1 ? "1" : "0"));
 #endif
 }
 
@@ -1075,88 +1087,12 @@ void DSPHandleIRQsNP(void)
 		dsp_control				= ctrl1[8];
 		dsp_div_control			= ctrl1[9];
 		IMASKCleared			= ctrl1[10];
-		dsp_flag_z				= ctrl1[11];
-		dsp_flag_n				= ctrl1[12];
+		SET_ZN_FLAGS(ctrl1[11], ctrl1[12]);
 		dsp_flag_c				= ctrl1[13];
 DSPUpdateRegisterBanks();
 #endif
 //!!!!!!!!
-	if (dsp_flags & IMASK) 							// Bail if we're already inside an interrupt
-		return;
-
-	// Get the active interrupt bits (latches) & interrupt mask (enables)
-	uint32_t bits = ((dsp_control >> 10) & 0x20) | ((dsp_control >> 6) & 0x1F),
-		mask = ((dsp_flags >> 11) & 0x20) | ((dsp_flags >> 4) & 0x1F);
-
-//	WriteLog("dsp: bits=%.2x mask=%.2x\n",bits,mask);
-	bits &= mask;
-
-	if (!bits)										// Bail if nothing is enabled
-		return;
-
-	int which = 0;									// Determine which interrupt
-	if (bits & 0x01)
-		which = 0;
-	if (bits & 0x02)
-		which = 1;
-	if (bits & 0x04)
-		which = 2;
-	if (bits & 0x08)
-		which = 3;
-	if (bits & 0x10)
-		which = 4;
-	if (bits & 0x20)
-		which = 5;
-
-	dsp_flags |= IMASK;		// Force Bank #0
-//CC only!
-#ifdef DSP_DEBUG_CC
-ctrl1[4] = dsp_flags;
-#endif
-//!!!!!!!!
-#ifdef DSP_DEBUG_IRQ
-	WriteLog("DSP: Bank 0: R30=%08X, R31=%08X\n", dsp_reg_bank_0[30], dsp_reg_bank_0[31]);
-	WriteLog("DSP: Bank 1: R30=%08X, R31=%08X\n", dsp_reg_bank_1[30], dsp_reg_bank_1[31]);
-#endif
-	DSPUpdateRegisterBanks();
-#ifdef DSP_DEBUG_IRQ
-	WriteLog("DSP: Bank 0: R30=%08X, R31=%08X\n", dsp_reg_bank_0[30], dsp_reg_bank_0[31]);
-	WriteLog("DSP: Bank 1: R30=%08X, R31=%08X\n", dsp_reg_bank_1[30], dsp_reg_bank_1[31]);
-#endif
-
-#ifdef DSP_DEBUG_IRQ
-	WriteLog("DSP: Generating interrupt #%i...", which);
-	WriteLog(" [PC will return to %08X, R31 = %08X]\n", dsp_pc, dsp_reg[31]);
-#endif
-
-	// subqt  #4,r31		; pre-decrement stack pointer
-	// move   pc,r30		; address of interrupted code
-	// store  r30,(r31)     ; store return address
-	dsp_reg[31] -= 4;
-	dsp_reg[30] = dsp_pc - 2; // -2 because we've executed the instruction already
-
-//CC only!
-#ifdef DSP_DEBUG_CC
-regs1[31] -= 4;
-#endif
-//!!!!!!!!
-//	DSPWriteLong(dsp_reg[31], dsp_pc - 2, DSP);
-	DSPWriteLong(dsp_reg[31], dsp_reg[30], DSP);
-//CC only!
-#ifdef DSP_DEBUG_CC
-SET32(ram1, regs1[31] - 0xF1B000, dsp_pc - 2);
-#endif
-//!!!!!!!!
-
-	// movei  #service_address,r30  ; pointer to ISR entry
-	// jump  (r30)					; jump to ISR
-	// nop
-	dsp_pc = dsp_reg[30] = DSP_WORK_RAM_BASE + (which * 0x10);
-//CC only!
-#ifdef DSP_DEBUG_CC
-ctrl1[0] = regs1[30] = dsp_pc;
-#endif
-//!!!!!!!!
+	DSPRISC::HandleIRQs();
 }
 
 //
@@ -1198,13 +1134,22 @@ bool DSPIsRunning(void)
 	return (DSP_RUNNING ? true : false);
 }
 
+//
+// The DSP's branch condition table is shared by every machine (see context.h)
+//
+void DSPFillTables(void)
+{
+	DSPRISC::Init();
+}
+
 void DSPInit(void)
 {
 //	memory_malloc_secure((void **)&dsp_ram_8, 0x2000, "DSP work RAM");
 //	memory_malloc_secure((void **)&dsp_reg_bank_0, 32 * sizeof(int32_t), "DSP bank 0 regs");
 //	memory_malloc_secure((void **)&dsp_reg_bank_1, 32 * sizeof(int32_t), "DSP bank 1 regs");
 
-	dsp_build_branch_condition_table();
+	DSPFillTables();
+	DSPJitSetup();
 	DSPReset();
 }
 
@@ -1228,14 +1173,16 @@ void DSPReset(void)
 	for(int i=0; i<32; i++)
 		dsp_reg[i] = dsp_alternate_reg[i] = 0x00000000;
 
-	CLR_ZNC;
+	DSPRISC::ClearZNC();
 	IMASKCleared = false;
 	FlushDSPPipeline();
 	dsp_reset_stats();
 
 	// Contents of local RAM are quasi-stable; we simulate this by randomizing RAM contents
 	for(uint32_t i=0; i<8192; i+=4)
-		*((uint32_t *)(&dsp_ram_8[i])) = rand();
+		*((uint32_t *)(&dsp_ram_8[i])) = JaguarRandom();
+
+	DSPRISC::Flush();
 }
 
 void DSPDumpDisassembly(void)
@@ -1256,7 +1203,7 @@ void DSPDumpDisassembly(void)
 void DSPDumpRegisters(void)
 {
 //Shoud add modulus, etc to dump here...
-	WriteLog("\n---[DSP flags: NCZ %d%d%d, DSP PC: %08X]------------\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, dsp_pc);
+	WriteLog("\n---[DSP flags: NCZ %d%d%d, DSP PC: %08X]------------\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, dsp_pc);
 	WriteLog("\nRegisters bank 0\n");
 
 	for(int j=0; j<8; j++)
@@ -1319,7 +1266,7 @@ void DSPDone(void)
 
 	WriteLog("\n");
 
-	static char buffer[512];
+	char buffer[512];
 	j = DSP_WORK_RAM_BASE;
 
 	while (j <= 0xF1CFFF)
@@ -1336,6 +1283,54 @@ void DSPDone(void)
 		if (dsp_opcode_use[i])
 			WriteLog("\t%s %i\n", dsp_opcode_str[i], dsp_opcode_use[i]);
 	}//*/
+
+	RISCJitDone(&dsp_jit);
+}
+
+//
+// Save/load the DSP's state. The pipeline used by DSPExecP2() isn't saved, as
+// it's flushed every time that core gives up its timeslice.
+//
+void DSPStateSync(StateBuffer * sb)
+{
+	uint8_t bank = (dsp_reg == dsp_reg_bank_1 ? 1 : 0);
+
+	// Only recompiled code for the words that the state actually changes has
+	// to go
+	const uint8_t * newRAM = StatePeek(sb, sizeof(dsp_ram_8));
+
+	if (newRAM)
+	{
+		for(uint32_t i=0; i<0x2000; i+=2)
+		{
+			if (GET16(newRAM, i) != GET16(dsp_ram_8, i))
+				DSPRISC::LocalWrite(i);
+		}
+	}
+
+	STATE_SYNC(sb, dsp_ram_8);
+	STATE_SYNC(sb, dsp_pc);
+	STATE_SYNC(sb, dsp_acc);
+	STATE_SYNC(sb, dsp_remain);
+	STATE_SYNC(sb, dsp_modulo);
+	STATE_SYNC(sb, dsp_flags);
+	STATE_SYNC(sb, dsp_matrix_control);
+	STATE_SYNC(sb, dsp_pointer_to_matrix);
+	STATE_SYNC(sb, dsp_data_organization);
+	STATE_SYNC(sb, dsp_control);
+	STATE_SYNC(sb, dsp_div_control);
+	STATE_SYNC(sb, dsp_flag_zn);
+	STATE_SYNC(sb, dsp_flag_c);
+	STATE_SYNC(sb, dsp_reg_bank_0);
+	STATE_SYNC(sb, dsp_reg_bank_1);
+	STATE_SYNC(sb, IMASKCleared);
+	STATE_SYNC(sb, bank);
+
+	if (sb->mode == STATE_LOAD)
+	{
+		dsp_reg = (bank ? dsp_reg_bank_1 : dsp_reg_bank_0);
+		dsp_alternate_reg = (bank ? dsp_reg_bank_0 : dsp_reg_bank_1);
+	}
 }
 
 
@@ -1364,8 +1359,7 @@ void DSPExecComp(int32_t cycles)
 		dsp_control				= ctrl1[8];
 		dsp_div_control			= ctrl1[9];
 		IMASKCleared			= ctrl1[10];
-		dsp_flag_z				= ctrl1[11];
-		dsp_flag_n				= ctrl1[12];
+		SET_ZN_FLAGS(ctrl1[11], ctrl1[12]);
 		dsp_flag_c				= ctrl1[13];
 DSPUpdateRegisterBanks();
 
@@ -1391,8 +1385,8 @@ DSPUpdateRegisterBanks();
 		ctrl1[8]  = dsp_control;
 		ctrl1[9]  = dsp_div_control;
 		ctrl1[10] = IMASKCleared;
-		ctrl1[11] = dsp_flag_z;
-		ctrl1[12] = dsp_flag_n;
+		ctrl1[11] = DSP_FLAG_Z;
+		ctrl1[12] = DSP_FLAG_N;
 		ctrl1[13] = dsp_flag_c;
 
 		// Load up vars for pipelined core
@@ -1410,8 +1404,7 @@ DSPUpdateRegisterBanks();
 		dsp_control				= ctrl2[8];
 		dsp_div_control			= ctrl2[9];
 		IMASKCleared			= ctrl2[10];
-		dsp_flag_z				= ctrl2[11];
-		dsp_flag_n				= ctrl2[12];
+		SET_ZN_FLAGS(ctrl2[11], ctrl2[12]);
 		dsp_flag_c				= ctrl2[13];
 DSPUpdateRegisterBanks();
 
@@ -1433,8 +1426,8 @@ DSPUpdateRegisterBanks();
 		ctrl2[8]  = dsp_control;
 		ctrl2[9]  = dsp_div_control;
 		ctrl2[10] = IMASKCleared;
-		ctrl2[11] = dsp_flag_z;
-		ctrl2[12] = dsp_flag_n;
+		ctrl2[11] = DSP_FLAG_Z;
+		ctrl2[12] = DSP_FLAG_N;
 		ctrl2[13] = dsp_flag_c;
 
 		if (instr1 != lastExec)
@@ -1464,8 +1457,8 @@ DSPUpdateRegisterBanks();
 		ctrl2[8]  = dsp_control;
 		ctrl2[9]  = dsp_div_control;
 		ctrl2[10] = IMASKCleared;
-		ctrl2[11] = dsp_flag_z;
-		ctrl2[12] = dsp_flag_n;
+		ctrl2[11] = DSP_FLAG_Z;
+		ctrl2[12] = DSP_FLAG_N;
 		ctrl2[13] = dsp_flag_c;
 			}
 //			else									// NP ran ahead of P
@@ -1487,8 +1480,7 @@ DSPUpdateRegisterBanks();
 		dsp_control				= ctrl1[8];
 		dsp_div_control			= ctrl1[9];
 		IMASKCleared			= ctrl1[10];
-		dsp_flag_z				= ctrl1[11];
-		dsp_flag_n				= ctrl1[12];
+		SET_ZN_FLAGS(ctrl1[11], ctrl1[12]);
 		dsp_flag_c				= ctrl1[13];
 DSPUpdateRegisterBanks();
 
@@ -1517,8 +1509,8 @@ for(int k=0; k<2; k++)
 		ctrl1[8]  = dsp_control;
 		ctrl1[9]  = dsp_div_control;
 		ctrl1[10] = IMASKCleared;
-		ctrl1[11] = dsp_flag_z;
-		ctrl1[12] = dsp_flag_n;
+		ctrl1[11] = DSP_FLAG_Z;
+		ctrl1[12] = DSP_FLAG_N;
 		ctrl1[13] = dsp_flag_c;
 			}
 		}
@@ -1541,11 +1533,9 @@ for(int k=0; k<2; k++)
 
 
 //
-// DSP execution core
+// DSP execution core (see risc.h)
 //
-//static bool R20Set = false, tripwire = false;
-//static uint32_t pcQueue[32], ptrPCQ = 0;
-void DSPExec(int32_t cycles)
+int32_t DSPExec(int32_t cycles)
 {
 #ifdef DSP_SINGLE_STEPPING
 	if (dsp_control & 0x18)
@@ -1557,1194 +1547,13 @@ void DSPExec(int32_t cycles)
 //There is *no* good reason to do this here!
 //	DSPHandleIRQs();
 	dsp_releaseTimeSlice_flag = 0;
-	dsp_in_exec++;
-
-	while (cycles > 0 && DSP_RUNNING)
-	{
-/*extern uint32_t totalFrames;
-//F1B2F6: LOAD   (R14+$04), R24 [NCZ:001, R14+$04=00F20018, R24=FFFFFFFF] -> Jaguar: Unknown word read at 00F20018 by DSP (M68K PC=00E32E)
-//-> 43 + 1 + 24 -> $2B + $01 + $18 -> 101011 00001 11000 -> 1010 1100 0011 1000 -> AC38
-//C470 -> 1100 0100 0111 0000 -> 110001 00011 10000 -> 49, 3, 16 -> STORE R16, (R14+$0C)
-//F1B140:
-if (totalFrames >= 377 && GET16(dsp_ram_8, 0x0002F6) == 0xAC38 && dsp_pc == 0xF1B140)
-{
-	doDSPDis = true;
-	WriteLog("Starting disassembly at frame #%u...\n", totalFrames);
-}
-if (dsp_pc == 0xF1B092)
-	doDSPDis = false;//*/
-/*if (dsp_pc == 0xF1B140)
-	doDSPDis = true;//*/
-
-		if (IMASKCleared)						// If IMASK was cleared,
-		{
-#ifdef DSP_DEBUG_IRQ
-			WriteLog("DSP: Finished interrupt. PC=$%06X\n", dsp_pc);
-#endif
-			DSPHandleIRQsNP();					// See if any other interrupts are pending!
-			IMASKCleared = false;
-		}
-
-/*if (badWrite)
-{
-	WriteLog("\nDSP: Encountered bad write in Atari Synth module. PC=%08X, R15=%08X\n", dsp_pc, dsp_reg[15]);
-	for(int i=0; i<80; i+=4)
-		WriteLog("     %08X: %08X\n", dsp_reg[15]+i, JaguarReadLong(dsp_reg[15]+i));
-	WriteLog("\n");
-}//*/
-/*if (dsp_pc == 0xF1B55E)
-{
-	WriteLog("DSP: At $F1B55E--R15 = %08X at %u ms%s...\n", dsp_reg[15], SDL_GetTicks(), (dsp_flags & IMASK ? " (inside interrupt)" : ""));
-}//*/
-/*if (dsp_pc == 0xF1B7D2)	// Start here???
-	doDSPDis = true;
-pcQueue[ptrPCQ++] = dsp_pc;
-ptrPCQ %= 32;*/
-		uint16_t opcode = DSPReadWord(dsp_pc, DSP);
-		uint32_t index = opcode >> 10;
-		dsp_opcode_first_parameter = (opcode >> 5) & 0x1F;
-		dsp_opcode_second_parameter = opcode & 0x1F;
-		dsp_pc += 2;
-		dsp_opcode[index]();
-		dsp_opcode_use[index]++;
-		cycles -= dsp_opcode_cycles[index];
-/*if (dsp_reg_bank_0[20] == 0xF1A100 & !R20Set)
-{
-	WriteLog("DSP: R20 set to $F1A100 at %u ms%s...\n", SDL_GetTicks(), (dsp_flags & IMASK ? " (inside interrupt)" : ""));
-	R20Set = true;
-}
-if (dsp_reg_bank_0[20] != 0xF1A100 && R20Set)
-{
-	WriteLog("DSP: R20 corrupted at %u ms from starting%s!\nAborting!\n", SDL_GetTicks(), (dsp_flags & IMASK ? " (inside interrupt)" : ""));
-	DSPDumpRegisters();
-	DSPDumpDisassembly();
-	exit(1);
-}
-if ((dsp_pc < 0xF1B000 || dsp_pc > 0xF1CFFE) && !tripwire)
-{
-	char buffer[512];
-	WriteLog("DSP: Jumping outside of DSP RAM at %u ms. Register dump:\n", SDL_GetTicks());
-	DSPDumpRegisters();
-	tripwire = true;
-	WriteLog("\nBacktrace:\n");
-	for(int i=0; i<32; i++)
-	{
-		dasmjag(JAGUAR_DSP, buffer, pcQueue[(ptrPCQ + i) % 32]);
-		WriteLog("\t%08X: %s\n", pcQueue[(ptrPCQ + i) % 32], buffer);
-	}
-	WriteLog("\n");
-}*/
-	}
 
-	dsp_in_exec--;
+	return DSPRISC::Run(cycles);
 }
 
 
 //
-// DSP opcode handlers
-//
-
-// There is a problem here with interrupt handlers the JUMP and JR instructions that
-// can cause trouble because an interrupt can occur *before* the instruction following the
-// jump can execute... !!! FIX !!!
-static void dsp_opcode_jump(void)
-{
-#ifdef DSP_DIS_JUMP
-const char * condition[32] =
-{	"T", "nz", "z", "???", "nc", "nc nz", "nc z", "???", "c", "c nz",
-	"c z", "???", "???", "???", "???", "???", "???", "???", "???",
-	"???", "nn", "nn nz", "nn z", "???", "n", "n nz", "n z", "???",
-	"???", "???", "???", "F" };
-	if (doDSPDis)
-		WriteLog("%06X: JUMP   %s, (R%02u) [NCZ:%u%u%u, R%02u=%08X] ", dsp_pc-2, condition[IMM_2], IMM_1, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM);
-#endif
-	// normalize flags
-/*	dsp_flag_c=dsp_flag_c?1:0;
-	dsp_flag_z=dsp_flag_z?1:0;
-	dsp_flag_n=dsp_flag_n?1:0;*/
-	// KLUDGE: Used by BRANCH_CONDITION
-	uint32_t jaguar_flags = (dsp_flag_n << 2) | (dsp_flag_c << 1) | dsp_flag_z;
-
-	if (BRANCH_CONDITION(IMM_2))
-	{
-#ifdef DSP_DIS_JUMP
-	if (doDSPDis)
-		WriteLog("Branched!\n");
-#endif
-		uint32_t delayed_pc = RM;
-		DSPExec(1);
-		dsp_pc = delayed_pc;
-	}
-#ifdef DSP_DIS_JUMP
-	else
-		if (doDSPDis)
-			WriteLog("Branch NOT taken.\n");
-#endif
-}
-
-
-static void dsp_opcode_jr(void)
-{
-#ifdef DSP_DIS_JR
-const char * condition[32] =
-{	"T", "nz", "z", "???", "nc", "nc nz", "nc z", "???", "c", "c nz",
-	"c z", "???", "???", "???", "???", "???", "???", "???", "???",
-	"???", "nn", "nn nz", "nn z", "???", "n", "n nz", "n z", "???",
-	"???", "???", "???", "F" };
-	if (doDSPDis)
-		WriteLog("%06X: JR     %s, %06X [NCZ:%u%u%u] ", dsp_pc-2, condition[IMM_2], dsp_pc+((IMM_1 & 0x10 ? 0xFFFFFFF0 | IMM_1 : IMM_1) * 2), dsp_flag_n, dsp_flag_c, dsp_flag_z);
-#endif
-	// normalize flags
-/*	dsp_flag_c=dsp_flag_c?1:0;
-	dsp_flag_z=dsp_flag_z?1:0;
-	dsp_flag_n=dsp_flag_n?1:0;*/
-	// KLUDGE: Used by BRANCH_CONDITION
-	uint32_t jaguar_flags = (dsp_flag_n << 2) | (dsp_flag_c << 1) | dsp_flag_z;
-
-	if (BRANCH_CONDITION(IMM_2))
-	{
-#ifdef DSP_DIS_JR
-	if (doDSPDis)
-		WriteLog("Branched!\n");
-#endif
-		int32_t offset = (IMM_1 & 0x10 ? 0xFFFFFFF0 | IMM_1 : IMM_1);		// Sign extend IMM_1
-		int32_t delayed_pc = dsp_pc + (offset * 2);
-		DSPExec(1);
-		dsp_pc = delayed_pc;
-	}
-#ifdef DSP_DIS_JR
-	else
-		if (doDSPDis)
-			WriteLog("Branch NOT taken.\n");
-#endif
-}
-
-
-static void dsp_opcode_add(void)
-{
-#ifdef DSP_DIS_ADD
-	if (doDSPDis)
-		WriteLog("%06X: ADD    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	uint32_t res = RN + RM;
-	SET_ZNC_ADD(RN, RM, res);
-	RN = res;
-#ifdef DSP_DIS_ADD
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_addc(void)
-{
-#ifdef DSP_DIS_ADDC
-	if (doDSPDis)
-		WriteLog("%06X: ADDC   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	uint32_t res = RN + RM + dsp_flag_c;
-	uint32_t carry = dsp_flag_c;
-//	SET_ZNC_ADD(RN, RM, res); //???BUG??? Yes!
-	SET_ZNC_ADD(RN + carry, RM, res);
-//	SET_ZNC_ADD(RN, RM + carry, res);
-	RN = res;
-#ifdef DSP_DIS_ADDC
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_addq(void)
-{
-#ifdef DSP_DIS_ADDQ
-	if (doDSPDis)
-		WriteLog("%06X: ADDQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, dsp_convert_zero[IMM_1], IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	uint32_t r1 = dsp_convert_zero[IMM_1];
-	uint32_t res = RN + r1;
-	CLR_ZNC; SET_ZNC_ADD(RN, r1, res);
-	RN = res;
-#ifdef DSP_DIS_ADDQ
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_sub(void)
-{
-#ifdef DSP_DIS_SUB
-	if (doDSPDis)
-		WriteLog("%06X: SUB    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	uint32_t res = RN - RM;
-	SET_ZNC_SUB(RN, RM, res);
-	RN = res;
-#ifdef DSP_DIS_SUB
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_subc(void)
-{
-#ifdef DSP_DIS_SUBC
-	if (doDSPDis)
-		WriteLog("%06X: SUBC   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	// This is how the DSP ALU does it--Two's complement with inverted carry
-	uint64_t res = (uint64_t)RN + (uint64_t)(RM ^ 0xFFFFFFFF) + (dsp_flag_c ^ 1);
-	// Carry out of the result is inverted too
-	dsp_flag_c = ((res >> 32) & 0x01) ^ 1;
-	RN = (res & 0xFFFFFFFF);
-	SET_ZN(RN);
-#ifdef DSP_DIS_SUBC
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_subq(void)
-{
-#ifdef DSP_DIS_SUBQ
-	if (doDSPDis)
-		WriteLog("%06X: SUBQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, dsp_convert_zero[IMM_1], IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	uint32_t r1 = dsp_convert_zero[IMM_1];
-	uint32_t res = RN - r1;
-	SET_ZNC_SUB(RN, r1, res);
-	RN = res;
-#ifdef DSP_DIS_SUBQ
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_cmp(void)
-{
-#ifdef DSP_DIS_CMP
-	if (doDSPDis)
-		WriteLog("%06X: CMP    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	uint32_t res = RN - RM;
-	SET_ZNC_SUB(RN, RM, res);
-#ifdef DSP_DIS_CMP
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z);
-#endif
-}
-
-
-static void dsp_opcode_cmpq(void)
-{
-	static int32_t sqtable[32] =
-		{ 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,-16,-15,-14,-13,-12,-11,-10,-9,-8,-7,-6,-5,-4,-3,-2,-1 };
-#ifdef DSP_DIS_CMPQ
-	if (doDSPDis)
-		WriteLog("%06X: CMPQ   #%d, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, sqtable[IMM_1], IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	uint32_t r1 = sqtable[IMM_1 & 0x1F]; // I like this better -> (INT8)(jaguar.op >> 2) >> 3;
-	uint32_t res = RN - r1;
-	SET_ZNC_SUB(RN, r1, res);
-#ifdef DSP_DIS_CMPQ
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z);
-#endif
-}
-
-
-static void dsp_opcode_and(void)
-{
-#ifdef DSP_DIS_AND
-	if (doDSPDis)
-		WriteLog("%06X: AND    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	RN = RN & RM;
-	SET_ZN(RN);
-#ifdef DSP_DIS_AND
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_or(void)
-{
-#ifdef DSP_DIS_OR
-	if (doDSPDis)
-		WriteLog("%06X: OR     R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	RN = RN | RM;
-	SET_ZN(RN);
-#ifdef DSP_DIS_OR
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_xor(void)
-{
-#ifdef DSP_DIS_XOR
-	if (doDSPDis)
-		WriteLog("%06X: XOR    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	RN = RN ^ RM;
-	SET_ZN(RN);
-#ifdef DSP_DIS_XOR
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_not(void)
-{
-#ifdef DSP_DIS_NOT
-	if (doDSPDis)
-		WriteLog("%06X: NOT    R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	RN = ~RN;
-	SET_ZN(RN);
-#ifdef DSP_DIS_NOT
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_move_pc(void)
-{
-	RN = dsp_pc - 2;
-}
-
-
-static void dsp_opcode_store_r14_indexed(void)
-{
-#ifdef DSP_DIS_STORE14I
-	if (doDSPDis)
-		WriteLog("%06X: STORE  R%02u, (R14+$%02X) [NCZ:%u%u%u, R%02u=%08X, R14+$%02X=%08X]\n", dsp_pc-2, IMM_2, dsp_convert_zero[IMM_1] << 2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN, dsp_convert_zero[IMM_1] << 2, dsp_reg[14]+(dsp_convert_zero[IMM_1] << 2));
-#endif
-#ifdef DSP_CORRECT_ALIGNMENT_STORE
-	DSPWriteLong((dsp_reg[14] & 0xFFFFFFFC) + (dsp_convert_zero[IMM_1] << 2), RN, DSP);
-#else
-	DSPWriteLong(dsp_reg[14] + (dsp_convert_zero[IMM_1] << 2), RN, DSP);
-#endif
-}
-
-
-static void dsp_opcode_store_r15_indexed(void)
-{
-#ifdef DSP_DIS_STORE15I
-	if (doDSPDis)
-		WriteLog("%06X: STORE  R%02u, (R15+$%02X) [NCZ:%u%u%u, R%02u=%08X, R15+$%02X=%08X]\n", dsp_pc-2, IMM_2, dsp_convert_zero[IMM_1] << 2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN, dsp_convert_zero[IMM_1] << 2, dsp_reg[15]+(dsp_convert_zero[IMM_1] << 2));
-#endif
-#ifdef DSP_CORRECT_ALIGNMENT_STORE
-	DSPWriteLong((dsp_reg[15] & 0xFFFFFFFC) + (dsp_convert_zero[IMM_1] << 2), RN, DSP);
-#else
-	DSPWriteLong(dsp_reg[15] + (dsp_convert_zero[IMM_1] << 2), RN, DSP);
-#endif
-}
-
-
-static void dsp_opcode_load_r14_ri(void)
-{
-#ifdef DSP_DIS_LOAD14R
-	if (doDSPDis)
-		WriteLog("%06X: LOAD   (R14+R%02u), R%02u [NCZ:%u%u%u, R14+R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM+dsp_reg[14], IMM_2, RN);
-#endif
-#ifdef DSP_CORRECT_ALIGNMENT
-	RN = DSPReadLong((dsp_reg[14] + RM) & 0xFFFFFFFC, DSP);
-#else
-	RN = DSPReadLong(dsp_reg[14] + RM, DSP);
-#endif
-#ifdef DSP_DIS_LOAD14R
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_load_r15_ri(void)
-{
-#ifdef DSP_DIS_LOAD15R
-	if (doDSPDis)
-		WriteLog("%06X: LOAD   (R15+R%02u), R%02u [NCZ:%u%u%u, R15+R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM+dsp_reg[15], IMM_2, RN);
-#endif
-#ifdef DSP_CORRECT_ALIGNMENT
-	RN = DSPReadLong((dsp_reg[15] + RM) & 0xFFFFFFFC, DSP);
-#else
-	RN = DSPReadLong(dsp_reg[15] + RM, DSP);
-#endif
-#ifdef DSP_DIS_LOAD15R
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_store_r14_ri(void)
-{
-	DSPWriteLong(dsp_reg[14] + RM, RN, DSP);
-}
-
-
-static void dsp_opcode_store_r15_ri(void)
-{
-	DSPWriteLong(dsp_reg[15] + RM, RN, DSP);
-}
-
-
-static void dsp_opcode_nop(void)
-{
-#ifdef DSP_DIS_NOP
-	if (doDSPDis)
-		WriteLog("%06X: NOP    [NCZ:%u%u%u]\n", dsp_pc-2, dsp_flag_n, dsp_flag_c, dsp_flag_z);
-#endif
-}
-
-
-static void dsp_opcode_storeb(void)
-{
-#ifdef DSP_DIS_STOREB
-	if (doDSPDis)
-		WriteLog("%06X: STOREB R%02u, (R%02u) [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_pc-2, IMM_2, IMM_1, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN, IMM_1, RM);
-#endif
-	if (RM >= DSP_WORK_RAM_BASE && RM <= (DSP_WORK_RAM_BASE + 0x1FFF))
-		DSPWriteLong(RM, RN & 0xFF, DSP);
-	else
-		JaguarWriteByte(RM, RN, DSP);
-}
-
-
-static void dsp_opcode_storew(void)
-{
-#ifdef DSP_DIS_STOREW
-	if (doDSPDis)
-		WriteLog("%06X: STOREW R%02u, (R%02u) [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_pc-2, IMM_2, IMM_1, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN, IMM_1, RM);
-#endif
-#ifdef DSP_CORRECT_ALIGNMENT_STORE
-	if (RM >= DSP_WORK_RAM_BASE && RM <= (DSP_WORK_RAM_BASE + 0x1FFF))
-		DSPWriteLong(RM & 0xFFFFFFFE, RN & 0xFFFF, DSP);
-	else
-		JaguarWriteWord(RM & 0xFFFFFFFE, RN, DSP);
-#else
-	if (RM >= DSP_WORK_RAM_BASE && RM <= (DSP_WORK_RAM_BASE + 0x1FFF))
-		DSPWriteLong(RM, RN & 0xFFFF, DSP);
-	else
-		JaguarWriteWord(RM, RN, DSP);
-#endif
-}
-
-
-static void dsp_opcode_store(void)
-{
-#ifdef DSP_DIS_STORE
-	if (doDSPDis)
-		WriteLog("%06X: STORE  R%02u, (R%02u) [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_pc-2, IMM_2, IMM_1, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN, IMM_1, RM);
-#endif
-#ifdef DSP_CORRECT_ALIGNMENT_STORE
-	DSPWriteLong(RM & 0xFFFFFFFC, RN, DSP);
-#else
-	DSPWriteLong(RM, RN, DSP);
-#endif
-}
-
-
-static void dsp_opcode_loadb(void)
-{
-#ifdef DSP_DIS_LOADB
-	if (doDSPDis)
-		WriteLog("%06X: LOADB  (R%02u), R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	if (RM >= DSP_WORK_RAM_BASE && RM <= (DSP_WORK_RAM_BASE + 0x1FFF))
-		RN = DSPReadLong(RM, DSP) & 0xFF;
-	else
-		RN = JaguarReadByte(RM, DSP);
-#ifdef DSP_DIS_LOADB
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_loadw(void)
-{
-#ifdef DSP_DIS_LOADW
-	if (doDSPDis)
-		WriteLog("%06X: LOADW  (R%02u), R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-#ifdef DSP_CORRECT_ALIGNMENT
-	if (RM >= DSP_WORK_RAM_BASE && RM <= (DSP_WORK_RAM_BASE + 0x1FFF))
-		RN = DSPReadLong(RM & 0xFFFFFFFE, DSP) & 0xFFFF;
-	else
-		RN = JaguarReadWord(RM & 0xFFFFFFFE, DSP);
-#else
-	if (RM >= DSP_WORK_RAM_BASE && RM <= (DSP_WORK_RAM_BASE + 0x1FFF))
-		RN = DSPReadLong(RM, DSP) & 0xFFFF;
-	else
-		RN = JaguarReadWord(RM, DSP);
-#endif
-#ifdef DSP_DIS_LOADW
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_load(void)
-{
-#ifdef DSP_DIS_LOAD
-	if (doDSPDis)
-		WriteLog("%06X: LOAD   (R%02u), R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-#ifdef DSP_CORRECT_ALIGNMENT
-	RN = DSPReadLong(RM & 0xFFFFFFFC, DSP);
-#else
-	RN = DSPReadLong(RM, DSP);
-#endif
-#ifdef DSP_DIS_LOAD
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_load_r14_indexed(void)
-{
-#ifdef DSP_DIS_LOAD14I
-	if (doDSPDis)
-		WriteLog("%06X: LOAD   (R14+$%02X), R%02u [NCZ:%u%u%u, R14+$%02X=%08X, R%02u=%08X] -> ", dsp_pc-2, dsp_convert_zero[IMM_1] << 2, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, dsp_convert_zero[IMM_1] << 2, dsp_reg[14]+(dsp_convert_zero[IMM_1] << 2), IMM_2, RN);
-#endif
-#ifdef DSP_CORRECT_ALIGNMENT
-	RN = DSPReadLong((dsp_reg[14] & 0xFFFFFFFC) + (dsp_convert_zero[IMM_1] << 2), DSP);
-#else
-	RN = DSPReadLong(dsp_reg[14] + (dsp_convert_zero[IMM_1] << 2), DSP);
-#endif
-#ifdef DSP_DIS_LOAD14I
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_load_r15_indexed(void)
-{
-#ifdef DSP_DIS_LOAD15I
-	if (doDSPDis)
-		WriteLog("%06X: LOAD   (R15+$%02X), R%02u [NCZ:%u%u%u, R15+$%02X=%08X, R%02u=%08X] -> ", dsp_pc-2, dsp_convert_zero[IMM_1] << 2, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, dsp_convert_zero[IMM_1] << 2, dsp_reg[15]+(dsp_convert_zero[IMM_1] << 2), IMM_2, RN);
-#endif
-#ifdef DSP_CORRECT_ALIGNMENT
-	RN = DSPReadLong((dsp_reg[15] & 0xFFFFFFFC) + (dsp_convert_zero[IMM_1] << 2), DSP);
-#else
-	RN = DSPReadLong(dsp_reg[15] + (dsp_convert_zero[IMM_1] << 2), DSP);
-#endif
-#ifdef DSP_DIS_LOAD15I
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_movei(void)
-{
-#ifdef DSP_DIS_MOVEI
-	if (doDSPDis)
-		WriteLog("%06X: MOVEI  #$%08X, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, (uint32_t)DSPReadWord(dsp_pc) | ((uint32_t)DSPReadWord(dsp_pc + 2) << 16), IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	// This instruction is followed by 32-bit value in LSW / MSW format...
-	RN = (uint32_t)DSPReadWord(dsp_pc, DSP) | ((uint32_t)DSPReadWord(dsp_pc + 2, DSP) << 16);
-	dsp_pc += 4;
-#ifdef DSP_DIS_MOVEI
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_moveta(void)
-{
-#ifdef DSP_DIS_MOVETA
-	if (doDSPDis)
-		WriteLog("%06X: MOVETA R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u(alt)=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, ALTERNATE_RN);
-#endif
-	ALTERNATE_RN = RM;
-#ifdef DSP_DIS_MOVETA
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u(alt)=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, ALTERNATE_RN);
-#endif
-}
-
-
-static void dsp_opcode_movefa(void)
-{
-#ifdef DSP_DIS_MOVEFA
-	if (doDSPDis)
-		WriteLog("%06X: MOVEFA R%02u, R%02u [NCZ:%u%u%u, R%02u(alt)=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, ALTERNATE_RM, IMM_2, RN);
-#endif
-	RN = ALTERNATE_RM;
-#ifdef DSP_DIS_MOVEFA
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u(alt)=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, ALTERNATE_RM, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_move(void)
-{
-#ifdef DSP_DIS_MOVE
-	if (doDSPDis)
-		WriteLog("%06X: MOVE   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	RN = RM;
-#ifdef DSP_DIS_MOVE
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_moveq(void)
-{
-#ifdef DSP_DIS_MOVEQ
-	if (doDSPDis)
-		WriteLog("%06X: MOVEQ  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	RN = IMM_1;
-#ifdef DSP_DIS_MOVEQ
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_resmac(void)
-{
-#ifdef DSP_DIS_RESMAC
-	if (doDSPDis)
-		WriteLog("%06X: RESMAC R%02u [NCZ:%u%u%u, R%02u=%08X, DSP_ACC=%02X%08X] -> ", dsp_pc-2, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN, (uint8_t)(dsp_acc >> 32), (uint32_t)(dsp_acc & 0xFFFFFFFF));
-#endif
-	RN = (uint32_t)dsp_acc;
-#ifdef DSP_DIS_RESMAC
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_imult(void)
-{
-#ifdef DSP_DIS_IMULT
-	if (doDSPDis)
-		WriteLog("%06X: IMULT  R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	RN = (int16_t)RN * (int16_t)RM;
-	SET_ZN(RN);
-#ifdef DSP_DIS_IMULT
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_mult(void)
-{
-#ifdef DSP_DIS_MULT
-	if (doDSPDis)
-		WriteLog("%06X: MULT   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	RN = (uint16_t)RM * (uint16_t)RN;
-	SET_ZN(RN);
-#ifdef DSP_DIS_MULT
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_bclr(void)
-{
-#ifdef DSP_DIS_BCLR
-	if (doDSPDis)
-		WriteLog("%06X: BCLR   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	uint32_t res = RN & ~(1 << IMM_1);
-	RN = res;
-	SET_ZN(res);
-#ifdef DSP_DIS_BCLR
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_btst(void)
-{
-#ifdef DSP_DIS_BTST
-	if (doDSPDis)
-		WriteLog("%06X: BTST   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	dsp_flag_z = (~RN >> IMM_1) & 1;
-#ifdef DSP_DIS_BTST
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_bset(void)
-{
-#ifdef DSP_DIS_BSET
-	if (doDSPDis)
-		WriteLog("%06X: BSET   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	uint32_t res = RN | (1 << IMM_1);
-	RN = res;
-	SET_ZN(res);
-#ifdef DSP_DIS_BSET
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_subqt(void)
-{
-#ifdef DSP_DIS_SUBQT
-	if (doDSPDis)
-		WriteLog("%06X: SUBQT  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, dsp_convert_zero[IMM_1], IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	RN -= dsp_convert_zero[IMM_1];
-#ifdef DSP_DIS_SUBQT
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_addqt(void)
-{
-#ifdef DSP_DIS_ADDQT
-	if (doDSPDis)
-		WriteLog("%06X: ADDQT  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, dsp_convert_zero[IMM_1], IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	RN += dsp_convert_zero[IMM_1];
-#ifdef DSP_DIS_ADDQT
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_imacn(void)
-{
-#ifdef DSP_DIS_IMACN
-	if (doDSPDis)
-		WriteLog("%06X: IMACN  R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	int32_t res = (int16_t)RM * (int16_t)RN;
-	dsp_acc += (int64_t)res;
-//Should we AND the result to fit into 40 bits here???
-#ifdef DSP_DIS_IMACN
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, DSP_ACC=%02X%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, (uint8_t)(dsp_acc >> 32), (uint32_t)(dsp_acc & 0xFFFFFFFF));
-#endif
-}
-
-
-static void dsp_opcode_mtoi(void)
-{
-	RN = (((int32_t)RM >> 8) & 0xFF800000) | (RM & 0x007FFFFF);
-	SET_ZN(RN);
-}
-
-
-static void dsp_opcode_normi(void)
-{
-	uint32_t _Rm = RM;
-	uint32_t res = 0;
-
-	if (_Rm)
-	{
-		while ((_Rm & 0xffc00000) == 0)
-		{
-			_Rm <<= 1;
-			res--;
-		}
-		while ((_Rm & 0xff800000) != 0)
-		{
-			_Rm >>= 1;
-			res++;
-		}
-	}
-	RN = res;
-	SET_ZN(RN);
-}
-
-
-static void dsp_opcode_mmult(void)
-{
-	int count	= dsp_matrix_control&0x0f;
-	uint32_t addr = dsp_pointer_to_matrix; // in the dsp ram
-	int64_t accum = 0;
-	uint32_t res;
-
-	if (!(dsp_matrix_control & 0x10))
-	{
-		for (int i = 0; i < count; i++)
-		{
-			int16_t a;
-			if (i&0x01)
-				a=(int16_t)((dsp_alternate_reg[dsp_opcode_first_parameter + (i>>1)]>>16)&0xffff);
-			else
-				a=(int16_t)(dsp_alternate_reg[dsp_opcode_first_parameter + (i>>1)]&0xffff);
-			int16_t b=((int16_t)DSPReadWord(addr + 2, DSP));
-			accum += a*b;
-			addr += 4;
-		}
-	}
-	else
-	{
-		for (int i = 0; i < count; i++)
-		{
-			int16_t a;
-			if (i&0x01)
-				a=(int16_t)((dsp_alternate_reg[dsp_opcode_first_parameter + (i>>1)]>>16)&0xffff);
-			else
-				a=(int16_t)(dsp_alternate_reg[dsp_opcode_first_parameter + (i>>1)]&0xffff);
-			int16_t b=((int16_t)DSPReadWord(addr + 2, DSP));
-			accum += a*b;
-			addr += 4 * count;
-		}
-	}
-	RN = res = (int32_t)accum;
-	// carry flag to do
-//NOTE: The flags are set based upon the last add/multiply done...
-	SET_ZN(RN);
-}
-
-
-static void dsp_opcode_abs(void)
-{
-#ifdef DSP_DIS_ABS
-	if (doDSPDis)
-		WriteLog("%06X: ABS    R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	uint32_t _Rn = RN;
-	uint32_t res;
-
-	if (_Rn == 0x80000000)
-		dsp_flag_n = 1;
-	else
-	{
-		dsp_flag_c = ((_Rn & 0x80000000) >> 31);
-		res = RN = (_Rn & 0x80000000 ? -_Rn : _Rn);
-		CLR_ZN; SET_Z(res);
-	}
-#ifdef DSP_DIS_ABS
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_div(void)
-{
-#if 0
-	if (RM)
-	{
-		if (dsp_div_control & 0x01)		// 16.16 division
-		{
-			dsp_remain = ((uint64_t)RN << 16) % RM;
-			RN = ((uint64_t)RN << 16) / RM;
-		}
-		else
-		{
-			// We calculate the remainder first because we destroy RN after
-			// this by assigning it to itself.
-			dsp_remain = RN % RM;
-			RN = RN / RM;
-		}
-
-	}
-	else
-	{
-		// This is what happens according to SCPCD. NYAN!
-		RN = 0xFFFFFFFF;
-		dsp_remain = 0;
-	}
-#else
-	// Real algorithm, courtesy of SCPCD: NYAN!
-	uint32_t q = RN;
-	uint32_t r = 0;
-
-	// If 16.16 division, stuff top 16 bits of RN into remainder and put the
-	// bottom 16 of RN in top 16 of quotient
-	if (dsp_div_control & 0x01)
-		q <<= 16, r = RN >> 16;
-
-	for(int i=0; i<32; i++)
-	{
-//		uint32_t sign = (r >> 31) & 0x01;
-		uint32_t sign = r & 0x80000000;
-		r = (r << 1) | ((q >> 31) & 0x01);
-		r += (sign ? RM : -RM);
-		q = (q << 1) | (((~r) >> 31) & 0x01);
-	}
-
-	RN = q;
-	dsp_remain = r;
-#endif
-}
-
-
-static void dsp_opcode_imultn(void)
-{
-#ifdef DSP_DIS_IMULTN
-	if (doDSPDis)
-		WriteLog("%06X: IMULTN R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	// This is OK, since this multiply won't overflow 32 bits...
-	int32_t res = (int32_t)((int16_t)RN * (int16_t)RM);
-	dsp_acc = (int64_t)res;
-	SET_ZN(res);
-#ifdef DSP_DIS_IMULTN
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, DSP_ACC=%02X%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, (uint8_t)(dsp_acc >> 32), (uint32_t)(dsp_acc & 0xFFFFFFFF));
-#endif
-}
-
-
-static void dsp_opcode_neg(void)
-{
-#ifdef DSP_DIS_NEG
-	if (doDSPDis)
-		WriteLog("%06X: NEG    R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	uint32_t res = -RN;
-	SET_ZNC_SUB(0, RN, res);
-	RN = res;
-#ifdef DSP_DIS_NEG
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_shlq(void)
-{
-#ifdef DSP_DIS_SHLQ
-	if (doDSPDis)
-		WriteLog("%06X: SHLQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, 32 - IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	// NB: This instruction is the *only* one that does (32 - immediate data).
-	int32_t r1 = 32 - IMM_1;
-	uint32_t res = RN << r1;
-	SET_ZN(res); dsp_flag_c = (RN >> 31) & 1;
-	RN = res;
-#ifdef DSP_DIS_SHLQ
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_shrq(void)
-{
-#ifdef DSP_DIS_SHRQ
-	if (doDSPDis)
-		WriteLog("%06X: SHRQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, dsp_convert_zero[IMM_1], IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	int32_t r1 = dsp_convert_zero[IMM_1];
-	uint32_t res = RN >> r1;
-	SET_ZN(res); dsp_flag_c = RN & 1;
-	RN = res;
-#ifdef DSP_DIS_SHRQ
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_ror(void)
-{
-#ifdef DSP_DIS_ROR
-	if (doDSPDis)
-		WriteLog("%06X: ROR    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	uint32_t r1 = RM & 0x1F;
-	uint32_t res = (RN >> r1) | (RN << (32 - r1));
-	SET_ZN(res); dsp_flag_c = (RN >> 31) & 1;
-	RN = res;
-#ifdef DSP_DIS_ROR
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_rorq(void)
-{
-#ifdef DSP_DIS_RORQ
-	if (doDSPDis)
-		WriteLog("%06X: RORQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, dsp_convert_zero[IMM_1], IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	uint32_t r1 = dsp_convert_zero[IMM_1 & 0x1F];
-	uint32_t r2 = RN;
-	uint32_t res = (r2 >> r1) | (r2 << (32 - r1));
-	RN = res;
-	SET_ZN(res); dsp_flag_c = (r2 >> 31) & 0x01;
-#ifdef DSP_DIS_RORQ
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_sha(void)
-{
-	int32_t sRm=(int32_t)RM;
-	uint32_t _Rn=RN;
-
-	if (sRm<0)
-	{
-		uint32_t shift=-sRm;
-		if (shift>=32) shift=32;
-		dsp_flag_c=(_Rn&0x80000000)>>31;
-		while (shift)
-		{
-			_Rn<<=1;
-			shift--;
-		}
-	}
-	else
-	{
-		uint32_t shift=sRm;
-		if (shift>=32) shift=32;
-		dsp_flag_c=_Rn&0x1;
-		while (shift)
-		{
-			_Rn=((int32_t)_Rn)>>1;
-			shift--;
-		}
-	}
-	RN = _Rn;
-	SET_ZN(RN);
-}
-
-
-static void dsp_opcode_sharq(void)
-{
-#ifdef DSP_DIS_SHARQ
-	if (doDSPDis)
-		WriteLog("%06X: SHARQ  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", dsp_pc-2, dsp_convert_zero[IMM_1], IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-	uint32_t res = (int32_t)RN >> dsp_convert_zero[IMM_1];
-	SET_ZN(res); dsp_flag_c = RN & 0x01;
-	RN = res;
-#ifdef DSP_DIS_SHARQ
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void dsp_opcode_sh(void)
-{
-	int32_t sRm=(int32_t)RM;
-	uint32_t _Rn=RN;
-
-	if (sRm<0)
-	{
-		uint32_t shift=(-sRm);
-		if (shift>=32) shift=32;
-		dsp_flag_c=(_Rn&0x80000000)>>31;
-		while (shift)
-		{
-			_Rn<<=1;
-			shift--;
-		}
-	}
-	else
-	{
-		uint32_t shift=sRm;
-		if (shift>=32) shift=32;
-		dsp_flag_c=_Rn&0x1;
-		while (shift)
-		{
-			_Rn>>=1;
-			shift--;
-		}
-	}
-	RN = _Rn;
-	SET_ZN(RN);
-}
-
-void dsp_opcode_addqmod(void)
-{
-#ifdef DSP_DIS_ADDQMOD
-	if (doDSPDis)
-		WriteLog("%06X: ADDQMOD #%u, R%02u [NCZ:%u%u%u, R%02u=%08X, DSP_MOD=%08X] -> ", dsp_pc-2, dsp_convert_zero[IMM_1], IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN, dsp_modulo);
-#endif
-	uint32_t r1 = dsp_convert_zero[IMM_1];
-	uint32_t r2 = RN;
-	uint32_t res = r2 + r1;
-	res = (res & (~dsp_modulo)) | (r2 & dsp_modulo);
-	RN = res;
-	SET_ZNC_ADD(r2, r1, res);
-#ifdef DSP_DIS_ADDQMOD
-	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, IMM_2, RN);
-#endif
-}
-
-void dsp_opcode_subqmod(void)
-{
-	uint32_t r1 = dsp_convert_zero[IMM_1];
-	uint32_t r2 = RN;
-	uint32_t res = r2 - r1;
-	res = (res & (~dsp_modulo)) | (r2 & dsp_modulo);
-	RN = res;
-
-	SET_ZNC_SUB(r2, r1, res);
-}
-
-void dsp_opcode_mirror(void)
-{
-	uint32_t r1 = RN;
-	RN = (mirror_table[r1 & 0xFFFF] << 16) | mirror_table[r1 >> 16];
-	SET_ZN(RN);
-}
-
-void dsp_opcode_sat32s(void)
-{
-	int32_t r2 = (uint32_t)RN;
-	int32_t temp = dsp_acc >> 32;
-	uint32_t res = (temp < -1) ? (int32_t)0x80000000 : (temp > 0) ? (int32_t)0x7FFFFFFF : r2;
-	RN = res;
-	SET_ZN(res);
-}
-
-void dsp_opcode_sat16s(void)
-{
-	int32_t r2 = RN;
-	uint32_t res = (r2 < -32768) ? -32768 : (r2 > 32767) ? 32767 : r2;
-	RN = res;
-	SET_ZN(res);
-}
-
-void dsp_opcode_illegal(void)
-{
-	// Don't know what it does, but it does *something*...
-	WriteLog("%06X: illegal %u, %u [NCZ:%u%u%u]\n", dsp_pc-2, IMM_1, IMM_2, dsp_flag_n, dsp_flag_c, dsp_flag_z);
-}
-
-//
-// New pipelined DSP core
+// New pipelined DSP core
 //
 
 static void DSP_abs(void);
@@ -3148,15 +1957,16 @@ F1B016: NOP    [NCZ:001]
 F1B1FC: MOVEI  #$00F1A100, R01 [NCZ:001, R01=00F1A100] -> [NCZ:001, R01=00F1A100]
 */
 
-uint32_t pcQueue1[0x400];
-uint32_t pcQPtr1 = 0;
+#define pcQueue1					(CONTEXT(dsp).pcQueue1)
+#define pcQPtr1						(CONTEXT(dsp).pcQPtr1)
 static uint32_t prevR1;
 //Let's try a 3 stage pipeline....
 //Looks like 3 stage is correct, otherwise bad things happen...
-void DSPExecP2(int32_t cycles)
+int32_t DSPExecP2(int32_t cycles)
 {
 	dsp_releaseTimeSlice_flag = 0;
 	dsp_in_exec++;
+	int32_t requested = cycles;
 
 	while (cycles > 0 && DSP_RUNNING)
 	{
@@ -3188,8 +1998,10 @@ if (dsp_pc == 0xF1B092)
 //F1B0D2: ADDQT  #8, R01 [NCZ:000, R01=0002140C] -> [NCZ:000, R01=00021414]
 
 
+#ifdef DEBUG_HOOKS
 pcQueue1[pcQPtr1++] = dsp_pc;
 pcQPtr1 &= 0x3FF;
+#endif
 
 #ifdef DSP_DEBUG_PL2
 if ((dsp_pc < 0xF1B000 || dsp_pc > 0xF1CFFF) && !doDSPDis)
@@ -3399,6 +2211,10 @@ WriteLog("\n");
 	}
 
 	dsp_in_exec--;
+	ProfileWork(PROFILE_DSP, requested - cycles);
+
+	// # of cycles actually run (which can be a few more than asked for)
+	return requested - cycles;
 }
 
 
@@ -3530,21 +2346,22 @@ static void DSP_abs(void)
 {
 #ifdef DSP_DIS_ABS
 	if (doDSPDis)
-		WriteLog("%06X: ABS    R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: ABS    R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
 	uint32_t _Rn = PRN;
 
+	dsp_flag_c = ((_Rn & 0x80000000) >> 31);
+
 	if (_Rn == 0x80000000)
-		dsp_flag_n = 1;
+		SET_ZN(0x80000000);
 	else
 	{
-		dsp_flag_c = ((_Rn & 0x80000000) >> 31);
 		PRES = (_Rn & 0x80000000 ? -_Rn : _Rn);
 		CLR_ZN; SET_Z(PRES);
 	}
 #ifdef DSP_DIS_ABS
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -3552,14 +2369,14 @@ static void DSP_add(void)
 {
 #ifdef DSP_DIS_ADD
 	if (doDSPDis)
-		WriteLog("%06X: ADD    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: ADD    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	uint32_t res = PRN + PRM;
 	SET_ZNC_ADD(PRN, PRM, res);
 	PRES = res;
 #ifdef DSP_DIS_ADD
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRES);
 #endif
 }
 
@@ -3567,7 +2384,7 @@ static void DSP_addc(void)
 {
 #ifdef DSP_DIS_ADDC
 	if (doDSPDis)
-		WriteLog("%06X: ADDC   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: ADDC   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	uint32_t res = PRN + PRM + dsp_flag_c;
 	uint32_t carry = dsp_flag_c;
@@ -3577,7 +2394,7 @@ static void DSP_addc(void)
 	PRES = res;
 #ifdef DSP_DIS_ADDC
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRES);
 #endif
 }
 
@@ -3585,15 +2402,15 @@ static void DSP_addq(void)
 {
 #ifdef DSP_DIS_ADDQ
 	if (doDSPDis)
-		WriteLog("%06X: ADDQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, dsp_convert_zero[PIMM1], PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: ADDQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, DSPRISC::convertZero[PIMM1], PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
-	uint32_t r1 = dsp_convert_zero[PIMM1];
+	uint32_t r1 = DSPRISC::convertZero[PIMM1];
 	uint32_t res = PRN + r1;
 	CLR_ZNC; SET_ZNC_ADD(PRN, r1, res);
 	PRES = res;
 #ifdef DSP_DIS_ADDQ
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -3601,9 +2418,9 @@ static void DSP_addqmod(void)
 {
 #ifdef DSP_DIS_ADDQMOD
 	if (doDSPDis)
-		WriteLog("%06X: ADDQMOD #%u, R%02u [NCZ:%u%u%u, R%02u=%08X, DSP_MOD=%08X] -> ", DSP_PPC, dsp_convert_zero[PIMM1], PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN, dsp_modulo);
+		WriteLog("%06X: ADDQMOD #%u, R%02u [NCZ:%u%u%u, R%02u=%08X, DSP_MOD=%08X] -> ", DSP_PPC, DSPRISC::convertZero[PIMM1], PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN, dsp_modulo);
 #endif
-	uint32_t r1 = dsp_convert_zero[PIMM1];
+	uint32_t r1 = DSPRISC::convertZero[PIMM1];
 	uint32_t r2 = PRN;
 	uint32_t res = r2 + r1;
 	res = (res & (~dsp_modulo)) | (r2 & dsp_modulo);
@@ -3611,7 +2428,7 @@ static void DSP_addqmod(void)
 	SET_ZNC_ADD(r2, r1, res);
 #ifdef DSP_DIS_ADDQMOD
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -3619,12 +2436,12 @@ static void DSP_addqt(void)
 {
 #ifdef DSP_DIS_ADDQT
 	if (doDSPDis)
-		WriteLog("%06X: ADDQT  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, dsp_convert_zero[PIMM1], PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: ADDQT  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, DSPRISC::convertZero[PIMM1], PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
-	PRES = PRN + dsp_convert_zero[PIMM1];
+	PRES = PRN + DSPRISC::convertZero[PIMM1];
 #ifdef DSP_DIS_ADDQT
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -3632,13 +2449,13 @@ static void DSP_and(void)
 {
 #ifdef DSP_DIS_AND
 	if (doDSPDis)
-		WriteLog("%06X: AND    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: AND    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	PRES = PRN & PRM;
 	SET_ZN(PRES);
 #ifdef DSP_DIS_AND
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRES);
 #endif
 }
 
@@ -3646,13 +2463,13 @@ static void DSP_bclr(void)
 {
 #ifdef DSP_DIS_BCLR
 	if (doDSPDis)
-		WriteLog("%06X: BCLR   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: BCLR   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
 	PRES = PRN & ~(1 << PIMM1);
 	SET_ZN(PRES);
 #ifdef DSP_DIS_BCLR
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -3660,13 +2477,13 @@ static void DSP_bset(void)
 {
 #ifdef DSP_DIS_BSET
 	if (doDSPDis)
-		WriteLog("%06X: BSET   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: BSET   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
 	PRES = PRN | (1 << PIMM1);
 	SET_ZN(PRES);
 #ifdef DSP_DIS_BSET
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -3674,13 +2491,13 @@ static void DSP_btst(void)
 {
 #ifdef DSP_DIS_BTST
 	if (doDSPDis)
-		WriteLog("%06X: BTST   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: BTST   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
-	dsp_flag_z = (~PRN >> PIMM1) & 1;
+	SET_Z((PRN >> PIMM1) & 1);
 	NO_WRITEBACK;
 #ifdef DSP_DIS_BTST
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
 }
 
@@ -3688,14 +2505,14 @@ static void DSP_cmp(void)
 {
 #ifdef DSP_DIS_CMP
 	if (doDSPDis)
-		WriteLog("%06X: CMP    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: CMP    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	uint32_t res = PRN - PRM;
 	SET_ZNC_SUB(PRN, PRM, res);
 	NO_WRITEBACK;
 #ifdef DSP_DIS_CMP
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z);
+		WriteLog("[NCZ:%u%u%u]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z);
 #endif
 }
 
@@ -3705,7 +2522,7 @@ static void DSP_cmpq(void)
 		{ 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,-16,-15,-14,-13,-12,-11,-10,-9,-8,-7,-6,-5,-4,-3,-2,-1 };
 #ifdef DSP_DIS_CMPQ
 	if (doDSPDis)
-		WriteLog("%06X: CMPQ   #%d, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, sqtable[PIMM1], PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: CMPQ   #%d, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, sqtable[PIMM1], PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
 	uint32_t r1 = sqtable[PIMM1 & 0x1F]; // I like this better -> (INT8)(jaguar.op >> 2) >> 3;
 	uint32_t res = PRN - r1;
@@ -3713,7 +2530,7 @@ static void DSP_cmpq(void)
 	NO_WRITEBACK;
 #ifdef DSP_DIS_CMPQ
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z);
+		WriteLog("[NCZ:%u%u%u]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z);
 #endif
 }
 
@@ -3746,7 +2563,7 @@ static void DSP_imacn(void)
 {
 #ifdef DSP_DIS_IMACN
 	if (doDSPDis)
-		WriteLog("%06X: IMACN  R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: IMACN  R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	int32_t res = (int16_t)PRM * (int16_t)PRN;
 	dsp_acc += (int64_t)res;
@@ -3754,7 +2571,7 @@ static void DSP_imacn(void)
 	NO_WRITEBACK;
 #ifdef DSP_DIS_IMACN
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, DSP_ACC=%02X%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, (uint8_t)(dsp_acc >> 32), (uint32_t)(dsp_acc & 0xFFFFFFFF));
+		WriteLog("[NCZ:%u%u%u, DSP_ACC=%02X%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, (uint8_t)(dsp_acc >> 32), (uint32_t)(dsp_acc & 0xFFFFFFFF));
 #endif
 }
 
@@ -3762,13 +2579,13 @@ static void DSP_imult(void)
 {
 #ifdef DSP_DIS_IMULT
 	if (doDSPDis)
-		WriteLog("%06X: IMULT  R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: IMULT  R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	PRES = (int16_t)PRN * (int16_t)PRM;
 	SET_ZN(PRES);
 #ifdef DSP_DIS_IMULT
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRES);
 #endif
 }
 
@@ -3776,7 +2593,7 @@ static void DSP_imultn(void)
 {
 #ifdef DSP_DIS_IMULTN
 	if (doDSPDis)
-		WriteLog("%06X: IMULTN R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: IMULTN R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	// This is OK, since this multiply won't overflow 32 bits...
 	int32_t res = (int32_t)((int16_t)PRN * (int16_t)PRM);
@@ -3785,7 +2602,7 @@ static void DSP_imultn(void)
 	NO_WRITEBACK;
 #ifdef DSP_DIS_IMULTN
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, DSP_ACC=%02X%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, (uint8_t)(dsp_acc >> 32), (uint32_t)(dsp_acc & 0xFFFFFFFF));
+		WriteLog("[NCZ:%u%u%u, DSP_ACC=%02X%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, (uint8_t)(dsp_acc >> 32), (uint32_t)(dsp_acc & 0xFFFFFFFF));
 #endif
 }
 
@@ -3793,7 +2610,7 @@ static void DSP_illegal(void)
 {
 #ifdef DSP_DIS_ILLEGAL
 	if (doDSPDis)
-		WriteLog("%06X: ILLEGAL [NCZ:%u%u%u]\n", DSP_PPC, dsp_flag_n, dsp_flag_c, dsp_flag_z);
+		WriteLog("%06X: ILLEGAL [NCZ:%u%u%u]\n", DSP_PPC, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z);
 #endif
 	NO_WRITEBACK;
 }
@@ -3813,10 +2630,10 @@ const char * condition[32] =
 	"???", "???", "???", "F" };
 	if (doDSPDis)
 //How come this is always off by 2???
-		WriteLog("%06X: JR     %s, %06X [NCZ:%u%u%u] ", DSP_PPC, condition[PIMM2], DSP_PPC+((PIMM1 & 0x10 ? 0xFFFFFFF0 | PIMM1 : PIMM1) * 2)+2, dsp_flag_n, dsp_flag_c, dsp_flag_z);
+		WriteLog("%06X: JR     %s, %06X [NCZ:%u%u%u] ", DSP_PPC, condition[PIMM2], DSP_PPC+((PIMM1 & 0x10 ? 0xFFFFFFF0 | PIMM1 : PIMM1) * 2)+2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z);
 #endif
 	// KLUDGE: Used by BRANCH_CONDITION macro
-	uint32_t jaguar_flags = (dsp_flag_n << 2) | (dsp_flag_c << 1) | dsp_flag_z;
+	uint32_t jaguar_flags = (DSP_FLAG_N << 2) | (dsp_flag_c << 1) | DSP_FLAG_Z;
 
 	if (BRANCH_CONDITION(PIMM2))
 	{
@@ -3922,10 +2739,10 @@ const char * condition[32] =
 	"???", "nn", "nn nz", "nn z", "???", "n", "n nz", "n z", "???",
 	"???", "???", "???", "F" };
 	if (doDSPDis)
-		WriteLog("%06X: JUMP   %s, (R%02u) [NCZ:%u%u%u, R%02u=%08X] ", DSP_PPC, condition[PIMM2], PIMM1, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM);
+		WriteLog("%06X: JUMP   %s, (R%02u) [NCZ:%u%u%u, R%02u=%08X] ", DSP_PPC, condition[PIMM2], PIMM1, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM);
 #endif
 	// KLUDGE: Used by BRANCH_CONDITION macro
-	uint32_t jaguar_flags = (dsp_flag_n << 2) | (dsp_flag_c << 1) | dsp_flag_z;
+	uint32_t jaguar_flags = (DSP_FLAG_N << 2) | (dsp_flag_c << 1) | DSP_FLAG_Z;
 
 	if (BRANCH_CONDITION(PIMM2))
 	{
@@ -4022,7 +2839,7 @@ static void DSP_load(void)
 {
 #ifdef DSP_DIS_LOAD
 	if (doDSPDis)
-		WriteLog("%06X: LOAD   (R%02u), R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: LOAD   (R%02u), R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 #ifdef DSP_CORRECT_ALIGNMENT
 	PRES = DSPReadLong(PRM & 0xFFFFFFFC, DSP);
@@ -4031,7 +2848,7 @@ static void DSP_load(void)
 #endif
 #ifdef DSP_DIS_LOAD
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4039,7 +2856,7 @@ static void DSP_loadb(void)
 {
 #ifdef DSP_DIS_LOADB
 	if (doDSPDis)
-		WriteLog("%06X: LOADB  (R%02u), R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: LOADB  (R%02u), R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	if (PRM >= DSP_WORK_RAM_BASE && PRM <= (DSP_WORK_RAM_BASE + 0x1FFF))
 		PRES = DSPReadLong(PRM, DSP) & 0xFF;
@@ -4047,7 +2864,7 @@ static void DSP_loadb(void)
 		PRES = JaguarReadByte(PRM, DSP);
 #ifdef DSP_DIS_LOADB
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4055,7 +2872,7 @@ static void DSP_loadw(void)
 {
 #ifdef DSP_DIS_LOADW
 	if (doDSPDis)
-		WriteLog("%06X: LOADW  (R%02u), R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: LOADW  (R%02u), R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 #ifdef DSP_CORRECT_ALIGNMENT
 	if (PRM >= DSP_WORK_RAM_BASE && PRM <= (DSP_WORK_RAM_BASE + 0x1FFF))
@@ -4070,7 +2887,7 @@ static void DSP_loadw(void)
 #endif
 #ifdef DSP_DIS_LOADW
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4078,16 +2895,16 @@ static void DSP_load_r14_i(void)
 {
 #ifdef DSP_DIS_LOAD14I
 	if (doDSPDis)
-		WriteLog("%06X: LOAD   (R14+$%02X), R%02u [NCZ:%u%u%u, R14+$%02X=%08X, R%02u=%08X] -> ", DSP_PPC, dsp_convert_zero[PIMM1] << 2, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, dsp_convert_zero[PIMM1] << 2, dsp_reg[14]+(dsp_convert_zero[PIMM1] << 2), PIMM2, PRN);
+		WriteLog("%06X: LOAD   (R14+$%02X), R%02u [NCZ:%u%u%u, R14+$%02X=%08X, R%02u=%08X] -> ", DSP_PPC, DSPRISC::convertZero[PIMM1] << 2, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, DSPRISC::convertZero[PIMM1] << 2, dsp_reg[14]+(DSPRISC::convertZero[PIMM1] << 2), PIMM2, PRN);
 #endif
 #ifdef DSP_CORRECT_ALIGNMENT
-	PRES = DSPReadLong((dsp_reg[14] & 0xFFFFFFFC) + (dsp_convert_zero[PIMM1] << 2), DSP);
+	PRES = DSPReadLong((dsp_reg[14] & 0xFFFFFFFC) + (DSPRISC::convertZero[PIMM1] << 2), DSP);
 #else
-	PRES = DSPReadLong(dsp_reg[14] + (dsp_convert_zero[PIMM1] << 2), DSP);
+	PRES = DSPReadLong(dsp_reg[14] + (DSPRISC::convertZero[PIMM1] << 2), DSP);
 #endif
 #ifdef DSP_DIS_LOAD14I
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4095,7 +2912,7 @@ static void DSP_load_r14_r(void)
 {
 #ifdef DSP_DIS_LOAD14R
 	if (doDSPDis)
-		WriteLog("%06X: LOAD   (R14+R%02u), R%02u [NCZ:%u%u%u, R14+R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM+dsp_reg[14], PIMM2, PRES);
+		WriteLog("%06X: LOAD   (R14+R%02u), R%02u [NCZ:%u%u%u, R14+R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM+dsp_reg[14], PIMM2, PRES);
 #endif
 #ifdef DSP_CORRECT_ALIGNMENT
 	PRES = DSPReadLong((dsp_reg[14] + PRM) & 0xFFFFFFFC, DSP);
@@ -4104,7 +2921,7 @@ static void DSP_load_r14_r(void)
 #endif
 #ifdef DSP_DIS_LOAD14R
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4112,16 +2929,16 @@ static void DSP_load_r15_i(void)
 {
 #ifdef DSP_DIS_LOAD15I
 	if (doDSPDis)
-		WriteLog("%06X: LOAD   (R15+$%02X), R%02u [NCZ:%u%u%u, R15+$%02X=%08X, R%02u=%08X] -> ", DSP_PPC, dsp_convert_zero[PIMM1] << 2, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, dsp_convert_zero[PIMM1] << 2, dsp_reg[15]+(dsp_convert_zero[PIMM1] << 2), PIMM2, PRN);
+		WriteLog("%06X: LOAD   (R15+$%02X), R%02u [NCZ:%u%u%u, R15+$%02X=%08X, R%02u=%08X] -> ", DSP_PPC, DSPRISC::convertZero[PIMM1] << 2, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, DSPRISC::convertZero[PIMM1] << 2, dsp_reg[15]+(DSPRISC::convertZero[PIMM1] << 2), PIMM2, PRN);
 #endif
 #ifdef DSP_CORRECT_ALIGNMENT
-	PRES = DSPReadLong((dsp_reg[15] &0xFFFFFFFC) + (dsp_convert_zero[PIMM1] << 2), DSP);
+	PRES = DSPReadLong((dsp_reg[15] &0xFFFFFFFC) + (DSPRISC::convertZero[PIMM1] << 2), DSP);
 #else
-	PRES = DSPReadLong(dsp_reg[15] + (dsp_convert_zero[PIMM1] << 2), DSP);
+	PRES = DSPReadLong(dsp_reg[15] + (DSPRISC::convertZero[PIMM1] << 2), DSP);
 #endif
 #ifdef DSP_DIS_LOAD15I
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4129,7 +2946,7 @@ static void DSP_load_r15_r(void)
 {
 #ifdef DSP_DIS_LOAD15R
 	if (doDSPDis)
-		WriteLog("%06X: LOAD   (R15+R%02u), R%02u [NCZ:%u%u%u, R15+R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM+dsp_reg[15], PIMM2, PRN);
+		WriteLog("%06X: LOAD   (R15+R%02u), R%02u [NCZ:%u%u%u, R15+R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM+dsp_reg[15], PIMM2, PRN);
 #endif
 #ifdef DSP_CORRECT_ALIGNMENT
 	PRES = DSPReadLong((dsp_reg[15] + PRM) & 0xFFFFFFFC, DSP);
@@ -4138,14 +2955,14 @@ static void DSP_load_r15_r(void)
 #endif
 #ifdef DSP_DIS_LOAD15R
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
 static void DSP_mirror(void)
 {
 	uint32_t r1 = PRN;
-	PRES = (mirror_table[r1 & 0xFFFF] << 16) | mirror_table[r1 >> 16];
+	PRES = DSPRISC::Mirror(r1);
 	SET_ZN(PRES);
 }
 
@@ -4195,12 +3012,12 @@ static void DSP_move(void)
 {
 #ifdef DSP_DIS_MOVE
 	if (doDSPDis)
-		WriteLog("%06X: MOVE   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: MOVE   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	PRES = PRM;
 #ifdef DSP_DIS_MOVE
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRES);
 #endif
 }
 
@@ -4208,15 +3025,15 @@ static void DSP_movefa(void)
 {
 #ifdef DSP_DIS_MOVEFA
 	if (doDSPDis)
-//		WriteLog("%06X: MOVEFA R%02u, R%02u [NCZ:%u%u%u, R%02u(alt)=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, ALTERNATE_RM, PIMM2, PRN);
-		WriteLog("%06X: MOVEFA R%02u, R%02u [NCZ:%u%u%u, R%02u(alt)=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, dsp_alternate_reg[PIMM1], PIMM2, PRN);
+//		WriteLog("%06X: MOVEFA R%02u, R%02u [NCZ:%u%u%u, R%02u(alt)=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, ALTERNATE_RM, PIMM2, PRN);
+		WriteLog("%06X: MOVEFA R%02u, R%02u [NCZ:%u%u%u, R%02u(alt)=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, dsp_alternate_reg[PIMM1], PIMM2, PRN);
 #endif
 //	PRES = ALTERNATE_RM;
 	PRES = dsp_alternate_reg[PIMM1];
 #ifdef DSP_DIS_MOVEFA
 	if (doDSPDis)
-//		WriteLog("[NCZ:%u%u%u, R%02u(alt)=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, ALTERNATE_RM, PIMM2, PRN);
-		WriteLog("[NCZ:%u%u%u, R%02u(alt)=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, dsp_alternate_reg[PIMM1], PIMM2, PRES);
+//		WriteLog("[NCZ:%u%u%u, R%02u(alt)=%08X, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, ALTERNATE_RM, PIMM2, PRN);
+		WriteLog("[NCZ:%u%u%u, R%02u(alt)=%08X, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, dsp_alternate_reg[PIMM1], PIMM2, PRES);
 #endif
 }
 
@@ -4224,14 +3041,14 @@ static void DSP_movei(void)
 {
 #ifdef DSP_DIS_MOVEI
 	if (doDSPDis)
-		WriteLog("%06X: MOVEI  #$%08X, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PRES, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: MOVEI  #$%08X, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PRES, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
 //	// This instruction is followed by 32-bit value in LSW / MSW format...
 //	PRES = (uint32_t)DSPReadWord(dsp_pc, DSP) | ((uint32_t)DSPReadWord(dsp_pc + 2, DSP) << 16);
 //	dsp_pc += 4;
 #ifdef DSP_DIS_MOVEI
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4239,7 +3056,7 @@ static void DSP_movepc(void)
 {
 #ifdef DSP_DIS_MOVEPC
 	if (doDSPDis)
-		WriteLog("%06X: MOVE   PC, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: MOVE   PC, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
 //Need to fix this to take into account pipelining effects... !!! FIX !!! [DONE]
 //	PRES = dsp_pc - 2;
@@ -4247,7 +3064,7 @@ static void DSP_movepc(void)
 	PRES = dsp_pc - 2 - (pipeline[plPtrRead].opcode == 38 ? 6 : (pipeline[plPtrRead].opcode == PIPELINE_STALL ? 0 : 2));
 #ifdef DSP_DIS_MOVEPC
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4255,12 +3072,12 @@ static void DSP_moveq(void)
 {
 #ifdef DSP_DIS_MOVEQ
 	if (doDSPDis)
-		WriteLog("%06X: MOVEQ  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: MOVEQ  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
 	PRES = PIMM1;
 #ifdef DSP_DIS_MOVEQ
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4268,16 +3085,16 @@ static void DSP_moveta(void)
 {
 #ifdef DSP_DIS_MOVETA
 	if (doDSPDis)
-//		WriteLog("%06X: MOVETA R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u(alt)=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, ALTERNATE_RN);
-		WriteLog("%06X: MOVETA R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u(alt)=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, dsp_alternate_reg[PIMM2]);
+//		WriteLog("%06X: MOVETA R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u(alt)=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, ALTERNATE_RN);
+		WriteLog("%06X: MOVETA R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u(alt)=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, dsp_alternate_reg[PIMM2]);
 #endif
 //	ALTERNATE_RN = PRM;
 	dsp_alternate_reg[PIMM2] = PRM;
 	NO_WRITEBACK;
 #ifdef DSP_DIS_MOVETA
 	if (doDSPDis)
-//		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u(alt)=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, ALTERNATE_RN);
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u(alt)=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, dsp_alternate_reg[PIMM2]);
+//		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u(alt)=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, ALTERNATE_RN);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u(alt)=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, dsp_alternate_reg[PIMM2]);
 #endif
 }
 
@@ -4291,13 +3108,13 @@ static void DSP_mult(void)
 {
 #ifdef DSP_DIS_MULT
 	if (doDSPDis)
-		WriteLog("%06X: MULT   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: MULT   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	PRES = (uint16_t)PRM * (uint16_t)PRN;
 	SET_ZN(PRES);
 #ifdef DSP_DIS_MULT
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRES);
 #endif
 }
 
@@ -4305,14 +3122,14 @@ static void DSP_neg(void)
 {
 #ifdef DSP_DIS_NEG
 	if (doDSPDis)
-		WriteLog("%06X: NEG    R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: NEG    R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
 	uint32_t res = -PRN;
 	SET_ZNC_SUB(0, PRN, res);
 	PRES = res;
 #ifdef DSP_DIS_NEG
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4320,7 +3137,7 @@ static void DSP_nop(void)
 {
 #ifdef DSP_DIS_NOP
 	if (doDSPDis)
-		WriteLog("%06X: NOP    [NCZ:%u%u%u]\n", DSP_PPC, dsp_flag_n, dsp_flag_c, dsp_flag_z);
+		WriteLog("%06X: NOP    [NCZ:%u%u%u]\n", DSP_PPC, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z);
 #endif
 	NO_WRITEBACK;
 }
@@ -4351,13 +3168,13 @@ static void DSP_not(void)
 {
 #ifdef DSP_DIS_NOT
 	if (doDSPDis)
-		WriteLog("%06X: NOT    R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: NOT    R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
 	PRES = ~PRN;
 	SET_ZN(PRES);
 #ifdef DSP_DIS_NOT
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4365,13 +3182,13 @@ static void DSP_or(void)
 {
 #ifdef DSP_DIS_OR
 	if (doDSPDis)
-		WriteLog("%06X: OR     R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: OR     R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	PRES = PRN | PRM;
 	SET_ZN(PRES);
 #ifdef DSP_DIS_OR
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRES);
 #endif
 }
 
@@ -4379,12 +3196,12 @@ static void DSP_resmac(void)
 {
 #ifdef DSP_DIS_RESMAC
 	if (doDSPDis)
-		WriteLog("%06X: RESMAC R%02u [NCZ:%u%u%u, R%02u=%08X, DSP_ACC=%02X%08X] -> ", DSP_PPC, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN, (uint8_t)(dsp_acc >> 32), (uint32_t)(dsp_acc & 0xFFFFFFFF));
+		WriteLog("%06X: RESMAC R%02u [NCZ:%u%u%u, R%02u=%08X, DSP_ACC=%02X%08X] -> ", DSP_PPC, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN, (uint8_t)(dsp_acc >> 32), (uint32_t)(dsp_acc & 0xFFFFFFFF));
 #endif
 	PRES = (uint32_t)dsp_acc;
 #ifdef DSP_DIS_RESMAC
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
 }
 
@@ -4392,7 +3209,7 @@ static void DSP_ror(void)
 {
 #ifdef DSP_DIS_ROR
 	if (doDSPDis)
-		WriteLog("%06X: ROR    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: ROR    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	uint32_t r1 = PRM & 0x1F;
 	uint32_t res = (PRN >> r1) | (PRN << (32 - r1));
@@ -4400,7 +3217,7 @@ static void DSP_ror(void)
 	PRES = res;
 #ifdef DSP_DIS_ROR
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRES);
 #endif
 }
 
@@ -4408,16 +3225,16 @@ static void DSP_rorq(void)
 {
 #ifdef DSP_DIS_RORQ
 	if (doDSPDis)
-		WriteLog("%06X: RORQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, dsp_convert_zero[PIMM1], PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: RORQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, DSPRISC::convertZero[PIMM1], PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
-	uint32_t r1 = dsp_convert_zero[PIMM1 & 0x1F];
+	uint32_t r1 = DSPRISC::convertZero[PIMM1 & 0x1F];
 	uint32_t r2 = PRN;
 	uint32_t res = (r2 >> r1) | (r2 << (32 - r1));
 	PRES = res;
 	SET_ZN(res); dsp_flag_c = (r2 >> 31) & 0x01;
 #ifdef DSP_DIS_RORQ
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4522,14 +3339,14 @@ static void DSP_sharq(void)
 {
 #ifdef DSP_DIS_SHARQ
 	if (doDSPDis)
-		WriteLog("%06X: SHARQ  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, dsp_convert_zero[PIMM1], PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: SHARQ  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, DSPRISC::convertZero[PIMM1], PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
-	uint32_t res = (int32_t)PRN >> dsp_convert_zero[PIMM1];
+	uint32_t res = (int32_t)PRN >> DSPRISC::convertZero[PIMM1];
 	SET_ZN(res); dsp_flag_c = PRN & 0x01;
 	PRES = res;
 #ifdef DSP_DIS_SHARQ
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4537,7 +3354,7 @@ static void DSP_shlq(void)
 {
 #ifdef DSP_DIS_SHLQ
 	if (doDSPDis)
-		WriteLog("%06X: SHLQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, 32 - PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: SHLQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, 32 - PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
 	int32_t r1 = 32 - PIMM1;
 	uint32_t res = PRN << r1;
@@ -4545,7 +3362,7 @@ static void DSP_shlq(void)
 	PRES = res;
 #ifdef DSP_DIS_SHLQ
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4553,15 +3370,15 @@ static void DSP_shrq(void)
 {
 #ifdef DSP_DIS_SHRQ
 	if (doDSPDis)
-		WriteLog("%06X: SHRQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, dsp_convert_zero[PIMM1], PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: SHRQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, DSPRISC::convertZero[PIMM1], PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
-	int32_t r1 = dsp_convert_zero[PIMM1];
+	int32_t r1 = DSPRISC::convertZero[PIMM1];
 	uint32_t res = PRN >> r1;
 	SET_ZN(res); dsp_flag_c = PRN & 1;
 	PRES = res;
 #ifdef DSP_DIS_SHRQ
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4569,7 +3386,7 @@ static void DSP_store(void)
 {
 #ifdef DSP_DIS_STORE
 	if (doDSPDis)
-		WriteLog("%06X: STORE  R%02u, (R%02u) [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_PPC, PIMM2, PIMM1, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN, PIMM1, PRM);
+		WriteLog("%06X: STORE  R%02u, (R%02u) [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_PPC, PIMM2, PIMM1, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN, PIMM1, PRM);
 #endif
 //	DSPWriteLong(PRM, PRN, DSP);
 //	NO_WRITEBACK;
@@ -4587,7 +3404,7 @@ static void DSP_storeb(void)
 {
 #ifdef DSP_DIS_STOREB
 	if (doDSPDis)
-		WriteLog("%06X: STOREB R%02u, (R%02u) [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_PPC, PIMM2, PIMM1, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN, PIMM1, PRM);
+		WriteLog("%06X: STOREB R%02u, (R%02u) [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_PPC, PIMM2, PIMM1, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN, PIMM1, PRM);
 #endif
 //	if (PRM >= DSP_WORK_RAM_BASE && PRM <= (DSP_WORK_RAM_BASE + 0x1FFF))
 //		DSPWriteLong(PRM, PRN & 0xFF, DSP);
@@ -4615,7 +3432,7 @@ static void DSP_storew(void)
 {
 #ifdef DSP_DIS_STOREW
 	if (doDSPDis)
-		WriteLog("%06X: STOREW R%02u, (R%02u) [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_PPC, PIMM2, PIMM1, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN, PIMM1, PRM);
+		WriteLog("%06X: STOREW R%02u, (R%02u) [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_PPC, PIMM2, PIMM1, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN, PIMM1, PRM);
 #endif
 //	if (PRM >= DSP_WORK_RAM_BASE && PRM <= (DSP_WORK_RAM_BASE + 0x1FFF))
 //		DSPWriteLong(PRM, PRN & 0xFFFF, DSP);
@@ -4646,14 +3463,14 @@ static void DSP_store_r14_i(void)
 {
 #ifdef DSP_DIS_STORE14I
 	if (doDSPDis)
-		WriteLog("%06X: STORE  R%02u, (R14+$%02X) [NCZ:%u%u%u, R%02u=%08X, R14+$%02X=%08X]\n", DSP_PPC, PIMM2, dsp_convert_zero[PIMM1] << 2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN, dsp_convert_zero[PIMM1] << 2, dsp_reg[14]+(dsp_convert_zero[PIMM1] << 2));
+		WriteLog("%06X: STORE  R%02u, (R14+$%02X) [NCZ:%u%u%u, R%02u=%08X, R14+$%02X=%08X]\n", DSP_PPC, PIMM2, DSPRISC::convertZero[PIMM1] << 2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN, DSPRISC::convertZero[PIMM1] << 2, dsp_reg[14]+(DSPRISC::convertZero[PIMM1] << 2));
 #endif
-//	DSPWriteLong(dsp_reg[14] + (dsp_convert_zero[PIMM1] << 2), PRN, DSP);
+//	DSPWriteLong(dsp_reg[14] + (DSPRISC::convertZero[PIMM1] << 2), PRN, DSP);
 //	NO_WRITEBACK;
 #ifdef DSP_CORRECT_ALIGNMENT_STORE
-	pipeline[plPtrExec].address = (dsp_reg[14] & 0xFFFFFFFC) + (dsp_convert_zero[PIMM1] << 2);
+	pipeline[plPtrExec].address = (dsp_reg[14] & 0xFFFFFFFC) + (DSPRISC::convertZero[PIMM1] << 2);
 #else
-	pipeline[plPtrExec].address = dsp_reg[14] + (dsp_convert_zero[PIMM1] << 2);
+	pipeline[plPtrExec].address = dsp_reg[14] + (DSPRISC::convertZero[PIMM1] << 2);
 #endif
 	pipeline[plPtrExec].value = PRN;
 	pipeline[plPtrExec].type = TYPE_DWORD;
@@ -4678,14 +3495,14 @@ static void DSP_store_r15_i(void)
 {
 #ifdef DSP_DIS_STORE15I
 	if (doDSPDis)
-		WriteLog("%06X: STORE  R%02u, (R15+$%02X) [NCZ:%u%u%u, R%02u=%08X, R15+$%02X=%08X]\n", DSP_PPC, PIMM2, dsp_convert_zero[PIMM1] << 2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN, dsp_convert_zero[PIMM1] << 2, dsp_reg[15]+(dsp_convert_zero[PIMM1] << 2));
+		WriteLog("%06X: STORE  R%02u, (R15+$%02X) [NCZ:%u%u%u, R%02u=%08X, R15+$%02X=%08X]\n", DSP_PPC, PIMM2, DSPRISC::convertZero[PIMM1] << 2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN, DSPRISC::convertZero[PIMM1] << 2, dsp_reg[15]+(DSPRISC::convertZero[PIMM1] << 2));
 #endif
-//	DSPWriteLong(dsp_reg[15] + (dsp_convert_zero[PIMM1] << 2), PRN, DSP);
+//	DSPWriteLong(dsp_reg[15] + (DSPRISC::convertZero[PIMM1] << 2), PRN, DSP);
 //	NO_WRITEBACK;
 #ifdef DSP_CORRECT_ALIGNMENT_STORE
-	pipeline[plPtrExec].address = (dsp_reg[15] & 0xFFFFFFFC) + (dsp_convert_zero[PIMM1] << 2);
+	pipeline[plPtrExec].address = (dsp_reg[15] & 0xFFFFFFFC) + (DSPRISC::convertZero[PIMM1] << 2);
 #else
-	pipeline[plPtrExec].address = dsp_reg[15] + (dsp_convert_zero[PIMM1] << 2);
+	pipeline[plPtrExec].address = dsp_reg[15] + (DSPRISC::convertZero[PIMM1] << 2);
 #endif
 	pipeline[plPtrExec].value = PRN;
 	pipeline[plPtrExec].type = TYPE_DWORD;
@@ -4710,14 +3527,14 @@ static void DSP_sub(void)
 {
 #ifdef DSP_DIS_SUB
 	if (doDSPDis)
-		WriteLog("%06X: SUB    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: SUB    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	uint32_t res = PRN - PRM;
 	SET_ZNC_SUB(PRN, PRM, res);
 	PRES = res;
 #ifdef DSP_DIS_SUB
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRES);
 #endif
 }
 
@@ -4725,7 +3542,7 @@ static void DSP_subc(void)
 {
 #ifdef DSP_DIS_SUBC
 	if (doDSPDis)
-		WriteLog("%06X: SUBC   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: SUBC   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	uint32_t res = PRN - PRM - dsp_flag_c;
 	uint32_t borrow = dsp_flag_c;
@@ -4733,7 +3550,7 @@ static void DSP_subc(void)
 	PRES = res;
 #ifdef DSP_DIS_SUBC
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRES);
 #endif
 }
 
@@ -4741,21 +3558,21 @@ static void DSP_subq(void)
 {
 #ifdef DSP_DIS_SUBQ
 	if (doDSPDis)
-		WriteLog("%06X: SUBQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, dsp_convert_zero[PIMM1], PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: SUBQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, DSPRISC::convertZero[PIMM1], PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
-	uint32_t r1 = dsp_convert_zero[PIMM1];
+	uint32_t r1 = DSPRISC::convertZero[PIMM1];
 	uint32_t res = PRN - r1;
 	SET_ZNC_SUB(PRN, r1, res);
 	PRES = res;
 #ifdef DSP_DIS_SUBQ
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
 static void DSP_subqmod(void)
 {
-	uint32_t r1 = dsp_convert_zero[PIMM1];
+	uint32_t r1 = DSPRISC::convertZero[PIMM1];
 	uint32_t r2 = PRN;
 	uint32_t res = r2 - r1;
 	res = (res & (~dsp_modulo)) | (r2 & dsp_modulo);
@@ -4767,12 +3584,12 @@ static void DSP_subqt(void)
 {
 #ifdef DSP_DIS_SUBQT
 	if (doDSPDis)
-		WriteLog("%06X: SUBQT  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, dsp_convert_zero[PIMM1], PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRN);
+		WriteLog("%06X: SUBQT  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", DSP_PPC, DSPRISC::convertZero[PIMM1], PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRN);
 #endif
-	PRES = PRN - dsp_convert_zero[PIMM1];
+	PRES = PRN - DSPRISC::convertZero[PIMM1];
 #ifdef DSP_DIS_SUBQT
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM2, PRES);
 #endif
 }
 
@@ -4780,12 +3597,12 @@ static void DSP_xor(void)
 {
 #ifdef DSP_DIS_XOR
 	if (doDSPDis)
-		WriteLog("%06X: XOR    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRN);
+		WriteLog("%06X: XOR    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", DSP_PPC, PIMM1, PIMM2, DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRN);
 #endif
 	PRES = PRN ^ PRM;
 	SET_ZN(PRES);
 #ifdef DSP_DIS_XOR
 	if (doDSPDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", dsp_flag_n, dsp_flag_c, dsp_flag_z, PIMM1, PRM, PIMM2, PRES);
+		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", DSP_FLAG_N, dsp_flag_c, DSP_FLAG_Z, PIMM1, PRM, PIMM2, PRES);
 #endif
 }
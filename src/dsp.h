@@ -5,15 +5,20 @@
 #ifndef __DSP_H__
 #define __DSP_H__
 
+#include "context.h"
+#include "riscjit.h"
 #include "vjag_memory.h"
+#include "state.h"
 
 #define DSP_CONTROL_RAM_BASE    0x00F1A100
 #define DSP_WORK_RAM_BASE		0x00F1B000
 
 void DSPInit(void);
+void DSPFillTables(void);
 void DSPReset(void);
-void DSPExec(int32_t);
+int32_t DSPExec(int32_t);
 void DSPDone(void);
+void DSPStateSync(StateBuffer * sb);
 void DSPUpdateRegisterBanks(void);
 void DSPHandleIRQs(void);
 void DSPSetIRQLine(int irqline, int state);
@@ -25,16 +30,74 @@ void DSPWriteWord(uint32_t offset, uint16_t data, uint32_t who = UNKNOWN);
 void DSPWriteLong(uint32_t offset, uint32_t data, uint32_t who = UNKNOWN);
 void DSPReleaseTimeslice(void);
 bool DSPIsRunning(void);
+void dsp_reset_stats(void);
 
 void DSPExecP(int32_t cycles);
-void DSPExecP2(int32_t cycles);
+int32_t DSPExecP2(int32_t cycles);
 //void DSPExecP3(int32_t cycles);
 void DSPExecComp(int32_t cycles);
 
+// What DSP.CPP knows about the machine (see context.h)
+
+struct PipelineStage
+{
+	uint16_t instruction;
+	uint8_t opcode, operand1, operand2;
+	uint32_t reg1, reg2, areg1, areg2;
+	uint32_t result;
+	uint8_t writebackRegister;
+	// General memory store...
+	uint32_t address;
+	uint32_t value;
+	uint8_t type;
+};
+
+#define DSP_JIT_STATES		9
+
+struct DSPState
+{
+	uint8_t dsp_ram_8[0x2000];
+	uint32_t dsp_pc;
+	uint64_t dsp_acc;							// 40 bit register, NOT 32!
+	uint32_t dsp_remain;
+	uint32_t dsp_modulo;
+	uint32_t dsp_flags;
+	uint32_t dsp_matrix_control;
+	uint32_t dsp_pointer_to_matrix;
+	uint32_t dsp_data_organization;
+	uint32_t dsp_control;
+	uint32_t dsp_div_control;
+	// Z & N are kept as the result that set them, sign extended to 64 bits (see the
+	// GPU): Z is the bottom 32 bits being zero, & N is the top bit
+	uint64_t dsp_flag_zn;
+	uint8_t dsp_flag_c;
+	uint32_t * dsp_reg, * dsp_alternate_reg;
+	uint32_t dsp_reg_bank_0[32], dsp_reg_bank_1[32];
+	uint32_t dsp_opcode_first_parameter;
+	uint32_t dsp_opcode_second_parameter;
+	uint32_t dsp_opcode_use[65];
+	uint32_t dsp_in_exec;
+	uint32_t dsp_releaseTimeSlice_flag;
+	bool IMASKCleared;
+	RISCDecodedOp dsp_decode_cache[0x2000 / 2];
+	RISCJitState dsp_jit_state[DSP_JIT_STATES];
+	RISCJitCore dsp_jit;
+
+	// The pipelined core's (DSPExecP2()) state
+	uint8_t scoreboard[32];						// A count with NEW_SCOREBOARD, a flag without
+	uint8_t plPtrFetch, plPtrRead, plPtrExec, plPtrWrite;
+	PipelineStage pipeline[4];
+	uint32_t pcQueue1[0x400];
+	uint32_t pcQPtr1;
+};
+
 // Exported vars
 
 extern bool doDSPDis;
-extern uint32_t dsp_reg_bank_0[], dsp_reg_bank_1[];
+#define dsp_reg_bank_0		(CONTEXT(dsp).dsp_reg_bank_0)
+#define dsp_reg_bank_1		(CONTEXT(dsp).dsp_reg_bank_1)
+#define dsp_opcode_use		(CONTEXT(dsp).dsp_opcode_use)
+extern const char * dsp_opcode_str[];
 
 // DSP interrupt numbers (in $F1A100, bits 4-8 & 16)
 
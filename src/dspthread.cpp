@@ -0,0 +1,406 @@
+//
+// dspthread.cpp: Runs the JERRY/DSP timeline on its own thread
+//
+
+//
+// Normally, the DSP's share of a frame (SDLSoundCallback) is run right after
+// the main timeline's. With the DSP thread turned on, that work is handed to a
+// worker instead, which chews on it while the main timeline runs the *next*
+// frame, so the DSP is never more than one frame behind. To keep the two from
+// stepping on each other:
+//
+// - The DSP sees main RAM as it was at the end of the frame it's running (its
+//   copy gets the pages written since the last job when the job is handed
+//   over), plus its own writes. TOM's interrupt mask (which JERRY's timers
+//   look at) is copied the same way.
+// - Reads by the DSP of anything else the main thread might be changing (TOM,
+//   the GPU, the blitter, the CD-ROM & the joystick/GPIO space) stop the
+//   worker until the main thread next waits for it, which then does the read
+//   on the worker's behalf. Since the main thread is always at the same point
+//   when it gets there, the worker gets the same answer every time. ROM, the
+//   BIOS & the rest of JERRY can't change under it, & are read directly.
+// - Writes by the DSP to anything outside of JERRY are queued up & applied by
+//   the main thread once the worker is done, as are 68K interrupts. Only one
+//   side owns the queue at any given time, so it needs no locking.
+// - If the main thread touches anything on JERRY's side, it waits for the
+//   worker to finish first.
+//
+// This keeps the results independent of how the two threads happen to get
+// scheduled, but it is NOT the same machine as running the DSP in line:
+//
+// - Everything the DSP does to the rest of the system (RAM writes & 68K
+//   interrupts) lands a frame late, & so does the audio.
+// - The DSP never sees a write to RAM the 68K or GPU makes during the frame
+//   it's running. Anything that hands data back & forth thru a semaphore in
+//   main RAM (the 68K setting a flag & spinning until the DSP clears it, or
+//   the other way around) sees the other side a frame late at best, & can
+//   stall or hang outright.
+// - A game whose DSP reads TOM or the GPU a lot gets little out of the
+//   thread, since the worker sits waiting for the main thread on each one.
+//
+// That's why it's off unless asked for, & why it's labelled as experimental.
+//
+
+#include "dspthread.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "dac.h"
+#include "jaguar.h"
+#include "log.h"
+#include "m68000/m68kinterface.h"
+#include "state.h"
+#include "tom.h"
+#include "vjag_memory.h"
+
+#ifdef HAVE_THREADS
+#include <pthread.h>
+#endif
+
+#ifndef MULTI_INSTANCE
+struct DSPThreadState dspThreadState;
+#endif
+
+#ifdef HAVE_THREADS
+#define worker				(CONTEXT(dspThread).worker)
+#define lock				(CONTEXT(dspThread).lock)
+#define wakeWorker			(CONTEXT(dspThread).wakeWorker)
+#define workerDone			(CONTEXT(dspThread).workerDone)
+#define readDone			(CONTEXT(dspThread).readDone)
+#define workerStarted		(CONTEXT(dspThread).workerStarted)
+#define workerFailed		(CONTEXT(dspThread).workerFailed)
+#define jobPending			(CONTEXT(dspThread).jobPending)
+#define quitWorker			(CONTEXT(dspThread).quitWorker)
+#define readPending			(CONTEXT(dspThread).readPending)
+#define readOffset			(CONTEXT(dspThread).readOffset)
+#define readWho				(CONTEXT(dspThread).readWho)
+#define readSize			(CONTEXT(dspThread).readSize)
+#define readData			(CONTEXT(dspThread).readData)
+#endif
+
+#define workerBuffer		(CONTEXT(dspThread).workerBuffer)
+#define workerLength		(CONTEXT(dspThread).workerLength)
+#define audioPending		(CONTEXT(dspThread).audioPending)
+#define workerRAM			(CONTEXT(dspThread).workerRAM)
+#define deferredWrite		(CONTEXT(dspThread).deferredWrite)
+#define numDeferredWrites	(CONTEXT(dspThread).numDeferredWrites)
+#define maxDeferredWrites	(CONTEXT(dspThread).maxDeferredWrites)
+#define deferredIRQ			(CONTEXT(dspThread).deferredIRQ)
+#define workerTOMIRQMask	(CONTEXT(dspThread).workerTOMIRQMask)
+
+
+#ifdef HAVE_THREADS
+static void * DSPThreadLoop(void * context)
+{
+	// The worker runs the DSP of the machine that started it
+	JaguarContextMakeCurrent((struct JaguarContext *)context);
+	pthread_mutex_lock(&lock);
+
+	while (true)
+	{
+		while (!jobPending && !quitWorker)
+			pthread_cond_wait(&wakeWorker, &lock);
+
+		if (quitWorker)
+			break;
+
+		pthread_mutex_unlock(&lock);
+		SDLSoundCallback(NULL, workerBuffer, workerLength);
+		pthread_mutex_lock(&lock);
+
+		jobPending = false;
+		pthread_cond_signal(&workerDone);
+	}
+
+	pthread_mutex_unlock(&lock);
+	return NULL;
+}
+
+
+static bool DSPThreadStart(void)
+{
+	if (workerStarted)
+		return true;
+
+	if (workerFailed)
+		return false;
+
+	workerBuffer = (uint16_t *)calloc(2048, sizeof(uint16_t));
+	workerRAM = (uint8_t *)malloc(0x200000);
+	pthread_mutex_init(&lock, NULL);
+	pthread_cond_init(&wakeWorker, NULL);
+	pthread_cond_init(&workerDone, NULL);
+	pthread_cond_init(&readDone, NULL);
+
+	if (workerBuffer && workerRAM
+		&& pthread_create(&worker, NULL, DSPThreadLoop, JaguarContextCurrent()) == 0)
+	{
+		WriteLog("DSP: Started DSP thread.\n");
+		workerStarted = true;
+
+		// The worker's copy of RAM starts out empty
+		for(uint32_t i=0; i<STATE_NUM_PAGES; i++)
+			mainRAMDirtyPage[i] |= STATE_DIRTY_DSP_THREAD;
+
+		return true;
+	}
+
+	WriteLog("DSP: Could not start DSP thread! Running the DSP in line instead.\n");
+	pthread_mutex_destroy(&lock);
+	pthread_cond_destroy(&wakeWorker);
+	pthread_cond_destroy(&workerDone);
+	pthread_cond_destroy(&readDone);
+	free(workerBuffer);
+	free(workerRAM);
+	workerBuffer = NULL;
+	workerRAM = NULL;
+	workerFailed = true;
+	return false;
+}
+#endif
+
+
+//
+// Fill the buffer with the audio from the previous frame's job & hand the
+// current frame's DSP work over to the worker.
+//
+void DSPThreadRun(uint16_t * buffer, int length)
+{
+#ifdef HAVE_THREADS
+	if (length <= 2048 && DSPThreadStart())
+	{
+		DSPThreadWait();
+
+		if (audioPending)
+			memcpy(buffer, workerBuffer, length * sizeof(uint16_t));
+		else
+			memset(buffer, 0, length * sizeof(uint16_t));
+
+		// Only the pages written since the last frame's copy need to go
+		for(uint32_t i=0; i<STATE_NUM_PAGES; i++)
+		{
+			if (mainRAMDirtyPage[i] & STATE_DIRTY_DSP_THREAD)
+			{
+				memcpy(workerRAM + (i << STATE_PAGE_SHIFT), jaguarMainRAM + (i << STATE_PAGE_SHIFT), 1 << STATE_PAGE_SHIFT);
+				mainRAMDirtyPage[i] &= ~STATE_DIRTY_DSP_THREAD;
+			}
+		}
+
+		workerTOMIRQMask = TOMReadByte(0xF000E1, DSP);
+		workerLength = length;
+		audioPending = true;
+		dspThreadBusy = true;
+
+		pthread_mutex_lock(&lock);
+		jobPending = true;
+		pthread_cond_signal(&wakeWorker);
+		pthread_mutex_unlock(&lock);
+		return;
+	}
+#endif
+
+	DSPThreadWait();
+	audioPending = false;
+	SDLSoundCallback(NULL, buffer, length);
+}
+
+
+//
+// Wait for the worker to finish its frame, then apply whatever it left for us
+//
+void DSPThreadWait(void)
+{
+	if (!dspThreadBusy)
+		return;
+
+#ifdef HAVE_THREADS
+	pthread_mutex_lock(&lock);
+
+	while (jobPending)
+	{
+		if (readPending)
+		{
+			// The worker can't go on until we do this read for it
+			pthread_mutex_unlock(&lock);
+			uint16_t data = (readSize == 1 ? JaguarReadByte(readOffset, readWho)
+				: JaguarReadWord(readOffset, readWho));
+			pthread_mutex_lock(&lock);
+
+			readData = data;
+			readPending = false;
+			pthread_cond_signal(&readDone);
+		}
+		else
+			pthread_cond_wait(&workerDone, &lock);
+	}
+
+	pthread_mutex_unlock(&lock);
+#endif
+	dspThreadBusy = false;
+
+	for(uint32_t i=0; i<numDeferredWrites; i++)
+	{
+		DeferredWrite & w = deferredWrite[i];
+
+		if (w.size == 1)
+			JaguarWriteByte(w.offset, w.data, w.who);
+		else
+			JaguarWriteWord(w.offset, w.data, w.who);
+	}
+
+	numDeferredWrites = 0;
+
+	if (deferredIRQ)
+	{
+		m68k_set_irq(deferredIRQ);
+		deferredIRQ = 0;
+	}
+}
+
+
+//
+// Shut down the worker. Any audio it made that hasn't been picked up yet is
+// thrown away.
+//
+void DSPThreadDone(void)
+{
+	DSPThreadWait();
+	audioPending = false;
+
+#ifdef HAVE_THREADS
+	if (workerStarted)
+	{
+		pthread_mutex_lock(&lock);
+		quitWorker = true;
+		pthread_cond_signal(&wakeWorker);
+		pthread_mutex_unlock(&lock);
+		pthread_join(worker, NULL);
+		pthread_mutex_destroy(&lock);
+		pthread_cond_destroy(&wakeWorker);
+		pthread_cond_destroy(&workerDone);
+		pthread_cond_destroy(&readDone);
+		workerStarted = false;
+		quitWorker = false;
+	}
+#endif
+
+	free(workerBuffer);
+	free(workerRAM);
+	free(deferredWrite);
+	workerBuffer = NULL;
+	workerRAM = NULL;
+	deferredWrite = NULL;
+	maxDeferredWrites = 0;
+}
+
+
+bool DSPThreadIsWorker(void)
+{
+#ifdef HAVE_THREADS
+	return workerStarted && pthread_equal(pthread_self(), worker);
+#else
+	return false;
+#endif
+}
+
+
+//
+// Called on every write through JaguarWriteByte/Word. If it's the worker doing
+// it & the write is to anything but JERRY, it's queued up for later. Returns
+// true if the write was queued.
+//
+bool DSPThreadDeferWrite(uint32_t offset, uint32_t data, int size, uint32_t who)
+{
+	offset &= 0xFFFFFF;
+
+	if (!DSPThreadIsWorker() || (offset >= 0xF10000 && offset <= 0xF1FFFF))
+		return false;
+
+	if (numDeferredWrites == maxDeferredWrites)
+	{
+		uint32_t newMax = (maxDeferredWrites ? maxDeferredWrites * 2 : 4096);
+		DeferredWrite * p = (DeferredWrite *)realloc(deferredWrite, newMax * sizeof(DeferredWrite));
+
+		// If we can't grow the queue, the best we can do is write it now
+		if (!p)
+			return false;
+
+		deferredWrite = p;
+		maxDeferredWrites = newMax;
+	}
+
+	DeferredWrite & w = deferredWrite[numDeferredWrites++];
+	w.offset = offset;
+	w.data = data;
+	w.who = who;
+	w.size = size;
+
+	// The DSP has to be able to read back what it wrote to RAM
+	if (offset < 0x800000)
+	{
+		if (size == 1)
+			workerRAM[offset & 0x1FFFFF] = data;
+		else
+		{
+			workerRAM[(offset + 0) & 0x1FFFFF] = data >> 8;
+			workerRAM[(offset + 1) & 0x1FFFFF] = data & 0xFF;
+		}
+	}
+
+	return true;
+}
+
+
+//
+// Main RAM as the caller should see it: the worker gets its copy, everyone
+// else gets NULL (meaning use the real thing).
+//
+const uint8_t * DSPThreadRAM(void)
+{
+	return (DSPThreadIsWorker() ? workerRAM : NULL);
+}
+
+
+//
+// Has the main thread do a read for the worker (see DSPThreadForwardsRead()),
+// & waits for it to get around to it
+//
+uint16_t DSPThreadRead(uint32_t offset, int size, uint32_t who)
+{
+#ifdef HAVE_THREADS
+	pthread_mutex_lock(&lock);
+	readOffset = offset;
+	readSize = size;
+	readWho = who;
+	readPending = true;
+	pthread_cond_signal(&workerDone);
+
+	while (readPending)
+		pthread_cond_wait(&readDone, &lock);
+
+	uint16_t data = readData;
+	pthread_mutex_unlock(&lock);
+	return data;
+#else
+	// There's no worker to ask for one
+	return 0;
+#endif
+}
+
+
+//
+// TOM's interrupt mask as it was when the worker was handed its frame
+//
+uint8_t DSPThreadTOMIRQMask(void)
+{
+	return workerTOMIRQMask;
+}
+
+
+void DSPThreadSet68KIRQ(unsigned int level)
+{
+	if (dspThreadBusy && DSPThreadIsWorker())
+		deferredIRQ = level;
+	else
+		m68k_set_irq(level);
+}
@@ -0,0 +1,98 @@
+//
+// dspthread.h: Runs the JERRY/DSP timeline on its own thread
+//
+
+#ifndef __DSPTHREAD_H__
+#define __DSPTHREAD_H__
+
+#include <stdint.h>
+#include "context.h"
+
+#ifdef HAVE_THREADS
+#include <pthread.h>
+#endif
+
+// What DSPTHREAD.CPP knows about the machine (see context.h)
+
+struct DeferredWrite
+{
+	uint32_t offset;
+	uint32_t data;
+	uint32_t who;
+	int size;
+};
+
+struct DSPThreadState
+{
+	// When this is set, the worker is busy running the DSP for the previous
+	// frame while the main timeline moves on to the next one. Only the main
+	// thread ever changes it.
+	bool dspThreadBusy;
+
+#ifdef HAVE_THREADS
+	pthread_t worker;
+	pthread_mutex_t lock;
+	pthread_cond_t wakeWorker;
+	pthread_cond_t workerDone;
+	pthread_cond_t readDone;
+	bool workerStarted;
+	bool workerFailed;
+	bool jobPending;
+	bool quitWorker;
+
+	// A read the worker is waiting on the main thread to do for it
+	bool readPending;
+	uint32_t readOffset, readWho;
+	int readSize;
+	uint16_t readData;
+#endif
+
+	uint16_t * workerBuffer;
+	int workerLength;
+	bool audioPending;
+	uint8_t * workerRAM;						// The DSP's view of main RAM
+	DeferredWrite * deferredWrite;
+	uint32_t numDeferredWrites;
+	uint32_t maxDeferredWrites;
+	unsigned int deferredIRQ;
+	uint8_t workerTOMIRQMask;
+};
+
+#define dspThreadBusy		(CONTEXT(dspThread).dspThreadBusy)
+
+void DSPThreadRun(uint16_t * buffer, int length);
+void DSPThreadWait(void);
+void DSPThreadDone(void);
+bool DSPThreadIsWorker(void);
+bool DSPThreadDeferWrite(uint32_t offset, uint32_t data, int size, uint32_t who);
+const uint8_t * DSPThreadRAM(void);
+uint16_t DSPThreadRead(uint32_t offset, int size, uint32_t who);
+uint8_t DSPThreadTOMIRQMask(void);
+void DSPThreadSet68KIRQ(unsigned int level);
+
+//
+// The main thread has to wait for the worker to finish before it can touch
+// anything on JERRY's side of the fence. The joystick/GPIO space & wavetable
+// ROM are left out, since the DSP has no business changing either of them.
+//
+static inline void DSPThreadTouch(uint32_t address)
+{
+	if (dspThreadBusy && !(address >= 0xF14000 && address <= 0xF17FFF)
+		&& !(address >= 0xF1D000 && address <= 0xF1DFFF) && !DSPThreadIsWorker())
+		DSPThreadWait();
+}
+
+//
+// The worker has the main thread read anything that the main thread might be
+// changing out from under it: TOM (& the GPU & blitter behind it), the CD-ROM,
+// unmapped space & the joystick/GPIO part of JERRY. RAM has its own copy, and
+// ROM, the BIOS & the rest of JERRY are safe to read directly.
+//
+static inline bool DSPThreadForwardsRead(uint32_t address)
+{
+	return (address >= 0xDFFF00) && !(address >= 0xE00000 && address <= 0xE3FFFF)
+		&& !(address >= 0xF10000 && address <= 0xF1FFFF && !(address >= 0xF14000 && address <= 0xF17FFF))
+		&& DSPThreadIsWorker();
+}
+
+#endif	// __DSPTHREAD_H__
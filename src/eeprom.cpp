@@ -23,8 +23,12 @@
 
 //#define eeprom_LOG
 
-static uint16_t eeprom_ram[64];
-static uint16_t cdromEEPROM[64];
+#ifndef MULTI_INSTANCE
+struct EEPROMState eepromState;
+#endif
+
+#define eeprom_ram				(CONTEXT(eeprom).eeprom_ram)
+#define cdromEEPROM				(CONTEXT(eeprom).cdromEEPROM)
 
 //
 // Private function prototypes
@@ -45,24 +49,28 @@ enum { EE_STATE_START = 1, EE_STATE_OP_A, EE_STATE_OP_B, EE_STATE_0, EE_STATE_1,
 
 // Local global variables
 
-static uint16_t jerry_ee_state = EE_STATE_START;
-static uint16_t jerry_ee_op = 0;
-static uint16_t jerry_ee_rstate = 0;
-static uint16_t jerry_ee_address_data = 0;
-static uint16_t jerry_ee_address_cnt = 6;
-static uint16_t jerry_ee_data = 0;
-static uint16_t jerry_ee_data_cnt = 16;
-static uint16_t jerry_writes_enabled = 0;
-static uint16_t jerry_ee_direct_jump = 0;
+#define jerry_ee_state			(CONTEXT(eeprom).jerry_ee_state)
+#define jerry_ee_op				(CONTEXT(eeprom).jerry_ee_op)
+#define jerry_ee_rstate			(CONTEXT(eeprom).jerry_ee_rstate)
+#define jerry_ee_address_data	(CONTEXT(eeprom).jerry_ee_address_data)
+#define jerry_ee_address_cnt	(CONTEXT(eeprom).jerry_ee_address_cnt)
+#define jerry_ee_data			(CONTEXT(eeprom).jerry_ee_data)
+#define jerry_ee_data_cnt		(CONTEXT(eeprom).jerry_ee_data_cnt)
+#define jerry_writes_enabled	(CONTEXT(eeprom).jerry_writes_enabled)
+#define jerry_ee_direct_jump	(CONTEXT(eeprom).jerry_ee_direct_jump)
 
-static char eeprom_filename[MAX_PATH];
-static char cdromEEPROMFilename[MAX_PATH];
-static bool haveEEPROM = false;
-static bool haveCDROMEEPROM = false;
+#define eeprom_filename			(CONTEXT(eeprom).eeprom_filename)
+#define cdromEEPROMFilename		(CONTEXT(eeprom).cdromEEPROMFilename)
+#define haveEEPROM				(CONTEXT(eeprom).haveEEPROM)
+#define haveCDROMEEPROM			(CONTEXT(eeprom).haveCDROMEEPROM)
 
 
 void EepromInit(void)
 {
+	jerry_ee_state = EE_STATE_START;
+	jerry_ee_address_cnt = 6;
+	jerry_ee_data_cnt = 16;
+
 	// Handle regular cartridge EEPROM
 	sprintf(eeprom_filename, "%s%08X.eeprom", vjs.EEPROMPath, (unsigned int)jaguarMainROMCRC32);
 	sprintf(cdromEEPROMFilename, "%scdrom.eeprom", vjs.EEPROMPath);
@@ -109,6 +117,22 @@ void EepromDone(void)
 }
 
 
+void EepromStateSync(StateBuffer * sb)
+{
+	STATE_SYNC(sb, eeprom_ram);
+	STATE_SYNC(sb, cdromEEPROM);
+	STATE_SYNC(sb, jerry_ee_state);
+	STATE_SYNC(sb, jerry_ee_op);
+	STATE_SYNC(sb, jerry_ee_rstate);
+	STATE_SYNC(sb, jerry_ee_address_data);
+	STATE_SYNC(sb, jerry_ee_address_cnt);
+	STATE_SYNC(sb, jerry_ee_data);
+	STATE_SYNC(sb, jerry_ee_data_cnt);
+	STATE_SYNC(sb, jerry_writes_enabled);
+	STATE_SYNC(sb, jerry_ee_direct_jump);
+}
+
+
 static void EEPROMSave(void)
 {
 	// Write out regular cartridge EEPROM data
@@ -6,14 +6,41 @@
 #define __EEPROM_H__
 
 #include <stdint.h>
+#include "context.h"
+#include "settings.h"
+#include "state.h"
 
 void EepromInit(void);
 void EepromReset(void);
 void EepromDone(void);
+void EepromStateSync(StateBuffer * sb);
 
 uint8_t EepromReadByte(uint32_t offset);
 uint16_t EepromReadWord(uint32_t offset);
 void EepromWriteByte(uint32_t offset, uint8_t data);
 void EepromWriteWord(uint32_t offset, uint16_t data);
 
+// What EEPROM.CPP knows about the machine (see context.h)
+
+struct EEPROMState
+{
+	uint16_t eeprom_ram[64];
+	uint16_t cdromEEPROM[64];
+
+	uint16_t jerry_ee_state;
+	uint16_t jerry_ee_op;
+	uint16_t jerry_ee_rstate;
+	uint16_t jerry_ee_address_data;
+	uint16_t jerry_ee_address_cnt;
+	uint16_t jerry_ee_data;
+	uint16_t jerry_ee_data_cnt;
+	uint16_t jerry_writes_enabled;
+	uint16_t jerry_ee_direct_jump;
+
+	char eeprom_filename[MAX_PATH];
+	char cdromEEPROMFilename[MAX_PATH];
+	bool haveEEPROM;
+	bool haveCDROMEEPROM;
+};
+
 #endif	// __EEPROM_H__
@@ -20,238 +20,317 @@
 #include "event.h"
 
 #include <stdint.h>
+#include "dspthread.h"
 #include "log.h"
+#include "settings.h"
 
 
-//#define EVENT_LIST_SIZE       512
-#define EVENT_LIST_SIZE       32
-
 
 // Now, a bit of weirdness: It seems that the number of lines displayed on the screen
 // makes the effective refresh rate either 30 or 25 Hz!
 
 // NOTE ABOUT TIMING SYSTEM DATA STRUCTURES:
 
-// A queue won't work for this system because we can't guarantee that an event will go
-// in with a time that is later than the ones already queued up. So we just use a simple
-// list.
+// Each timeline (main & JERRY) is kept as a binary min-heap ordered on the
+// absolute time (in RISC cycles) at which the event fires. Since the times are
+// absolute, nothing has to be adjusted when an event is handled--we just bump
+// the timeline's notion of "now" to the time of the event being handled. This
+// gives us O(1) peeks at the next event and O(log n) inserts & removals. Ties
+// are broken by insertion order so that the result is deterministic.
 
-// Although if we used an insertion sort we could, but it wouldn't work for adjusting
-// times... (For that, you would have to remove the event then reinsert it.)
+// (The queues themselves are in event.h, since they're part of the machine's
+// state; see context.h.)
 
-struct Event
-{
-	bool valid;
-	int eventType;
-	double eventTime;
-	void (* timerCallback)(void);
+#ifndef MULTI_INSTANCE
+struct EventState eventState;
+#endif
+
+#define eventQueue		(CONTEXT(event).eventQueue)
+
+// Every callback that can end up in one of the queues. Save states refer to
+// callbacks by their index in this table, so only ever add to the end of it!
+
+void HalflineCallback(void);
+void RenderCallback(void);
+void TOMPITCallback(void);
+void JERRYPIT1Callback(void);
+void JERRYPIT2Callback(void);
+void JERRYI2SCallback(void);
+void DSPSampleCallback(void);
+
+static void (* const eventCallbacks[])(void) = {
+	HalflineCallback, RenderCallback, TOMPITCallback, JERRYPIT1Callback,
+	JERRYPIT2Callback, JERRYI2SCallback, DSPSampleCallback
 };
 
+#define NUM_EVENT_CALLBACKS		(sizeof(eventCallbacks) / sizeof(eventCallbacks[0]))
 
-static Event eventList[EVENT_LIST_SIZE];
-static Event eventListJERRY[EVENT_LIST_SIZE];
-static uint32_t nextEvent;
-static uint32_t nextEventJERRY;
-static uint32_t numberOfEvents;
 
+//
+// Heap helpers
+//
+static inline bool EventEarlier(const Event & a, const Event & b)
+{
+	if (a.eventTime != b.eventTime)
+		return a.eventTime < b.eventTime;
 
-void InitializeEventList(void)
+	// Sequence numbers can wrap, so compare them as a signed difference
+	return (int32_t)(a.sequence - b.sequence) < 0;
+}
+
+
+static void SiftUp(EventQueue & q, uint32_t i)
 {
-	for(uint32_t i=0; i<EVENT_LIST_SIZE; i++)
+	Event e = q.heap[i];
+
+	while (i > 0)
 	{
-		eventList[i].valid = false;
-		eventListJERRY[i].valid = false;
+		uint32_t parent = (i - 1) >> 1;
+
+		if (!EventEarlier(e, q.heap[parent]))
+			break;
+
+		q.heap[i] = q.heap[parent];
+		i = parent;
 	}
 
-	numberOfEvents = 0;
-	WriteLog("EVENT: Cleared event list.\n");
+	q.heap[i] = e;
 }
 
 
-// Set callback time in µs. This is fairly arbitrary, but works well enough for our purposes.
-//We just slap the next event into the list in the first available slot, no checking, no nada...
-void SetCallbackTime(void (* callback)(void), double time, int type/*= EVENT_MAIN*/)
+static void SiftDown(EventQueue & q, uint32_t i)
 {
-	if (type == EVENT_MAIN)
+	Event e = q.heap[i];
+	uint32_t n = q.numberOfEvents;
+
+	while (true)
 	{
-		for(uint32_t i=0; i<EVENT_LIST_SIZE; i++)
-		{
-			if (!eventList[i].valid)
-			{
-//WriteLog("EVENT: Found callback slot #%u...\n", i);
-				eventList[i].timerCallback = callback;
-				eventList[i].eventTime = time;
-				eventList[i].eventType = type;
-				eventList[i].valid = true;
-				numberOfEvents++;
-
-				return;
-			}
-		}
+		uint32_t child = (i << 1) + 1;
+
+		if (child >= n)
+			break;
+
+		if ((child + 1 < n) && EventEarlier(q.heap[child + 1], q.heap[child]))
+			child++;
+
+		if (!EventEarlier(q.heap[child], e))
+			break;
 
-		WriteLog("EVENT: SetCallbackTime() failed to find an empty slot in the main list (%u events)!\n", numberOfEvents);
+		q.heap[i] = q.heap[child];
+		i = child;
 	}
+
+	q.heap[i] = e;
+}
+
+
+static void RemoveAt(EventQueue & q, uint32_t i)
+{
+	q.numberOfEvents--;
+
+	if (i == q.numberOfEvents)
+		return;
+
+	q.heap[i] = q.heap[q.numberOfEvents];
+
+	// The moved event can go either way, depending on where it came from
+	if (i > 0 && EventEarlier(q.heap[i], q.heap[(i - 1) >> 1]))
+		SiftUp(q, i);
 	else
+		SiftDown(q, i);
+}
+
+
+static bool FindCallback(void (* callback)(void), EventQueue * & queue, uint32_t & index)
+{
+	// There are never more than a handful of live events, so a scan of the
+	// heap is cheaper than keeping a separate index up to date. While the DSP
+	// thread is running, each side may only look at its own queue.
+	int first = EVENT_MAIN, last = EVENT_JERRY;
+
+	if (dspThreadBusy)
+		first = last = (DSPThreadIsWorker() ? EVENT_JERRY : EVENT_MAIN);
+
+	for(int type=first; type<=last; type++)
 	{
-		for(uint32_t i=0; i<EVENT_LIST_SIZE; i++)
+		EventQueue & q = eventQueue[type];
+
+		for(uint32_t i=0; i<q.numberOfEvents; i++)
 		{
-			if (!eventListJERRY[i].valid)
+			if (q.heap[i].timerCallback == callback)
 			{
-//WriteLog("EVENT: Found callback slot #%u...\n", i);
-				eventListJERRY[i].timerCallback = callback;
-				eventListJERRY[i].eventTime = time;
-				eventListJERRY[i].eventType = type;
-				eventListJERRY[i].valid = true;
-				numberOfEvents++;
-
-				return;
+				queue = &q;
+				index = i;
+				return true;
 			}
 		}
-
-		WriteLog("EVENT: SetCallbackTime() failed to find an empty slot in the main list (%u events)!\n", numberOfEvents);
 	}
+
+	return false;
 }
 
 
-void RemoveCallback(void (* callback)(void))
+void InitializeEventList(void)
 {
-	for(uint32_t i=0; i<EVENT_LIST_SIZE; i++)
+	for(int type=EVENT_MAIN; type<=EVENT_JERRY; type++)
 	{
-		if (eventList[i].valid && eventList[i].timerCallback == callback)
-		{
-			eventList[i].valid = false;
-			numberOfEvents--;
+		eventQueue[type].numberOfEvents = 0;
+		eventQueue[type].sequence = 0;
+		eventQueue[type].currentTime = 0;
+	}
 
-			return;
-		}
-		else if (eventListJERRY[i].valid && eventListJERRY[i].timerCallback == callback)
-		{
-			eventListJERRY[i].valid = false;
-			numberOfEvents--;
+	WriteLog("EVENT: Cleared event list.\n");
+}
 
-			return;
-		}
-	}
+
+// Set callback time in µs. This is fairly arbitrary, but works well enough for our purposes.
+// The time is converted to RISC cycles (rounded to the nearest cycle) on the way in.
+void SetCallbackTime(void (* callback)(void), double time, int type/*= EVENT_MAIN*/)
+{
+	SetCallbackCycles(callback, USEC_TO_RISC_CYCLES(time), type);
 }
 
 
-void AdjustCallbackTime(void (* callback)(void), double time)
+// Set callback time in RISC cycles, relative to the time of the last handled event.
+void SetCallbackCycles(void (* callback)(void), uint64_t cycles, int type/*= EVENT_MAIN*/)
 {
-	for(uint32_t i=0; i<EVENT_LIST_SIZE; i++)
+	EventQueue & q = eventQueue[type == EVENT_MAIN ? EVENT_MAIN : EVENT_JERRY];
+
+	if (q.numberOfEvents == EVENT_LIST_SIZE)
 	{
-		if (eventList[i].valid && eventList[i].timerCallback == callback)
-		{
-			eventList[i].eventTime = time;
+		WriteLog("EVENT: SetCallbackTime() failed to find an empty slot in the %s list (%u events)!\n", (type == EVENT_MAIN ? "main" : "JERRY"), q.numberOfEvents);
+		return;
+	}
 
-			return;
-		}
-		else if (eventListJERRY[i].valid && eventListJERRY[i].timerCallback == callback)
-		{
-			eventListJERRY[i].eventTime = time;
+	Event & e = q.heap[q.numberOfEvents];
+	e.timerCallback = callback;
+	e.eventTime = q.currentTime + cycles;
+	e.eventType = type;
+	e.sequence = q.sequence++;
+	q.numberOfEvents++;
+	SiftUp(q, q.numberOfEvents - 1);
+}
 
-			return;
-		}
-	}
+
+void RemoveCallback(void (* callback)(void))
+{
+	EventQueue * q;
+	uint32_t i;
+
+	if (FindCallback(callback, q, i))
+		RemoveAt(*q, i);
+}
+
+
+void AdjustCallbackTime(void (* callback)(void), double time)
+{
+	EventQueue * q;
+	uint32_t i;
+
+	if (!FindCallback(callback, q, i))
+		return;
+
+	Event e = q->heap[i];
+	RemoveAt(*q, i);
+	e.eventTime = q->currentTime + USEC_TO_RISC_CYCLES(time);
+	q->heap[q->numberOfEvents] = e;
+	q->numberOfEvents++;
+	SiftUp(*q, q->numberOfEvents - 1);
 }
 
 
 //
-// Since our list is unordered WRT time, we have to search it to find the next event
-// Returns time to next event & sets nextEvent to that event
+// Returns the number of RISC cycles until the next event fires. Since the
+// timelines are heaps, this is just a peek at the top.
 //
+uint32_t GetCyclesToNextEvent(int type/*= EVENT_MAIN*/)
+{
+	EventQueue & q = eventQueue[type == EVENT_MAIN ? EVENT_MAIN : EVENT_JERRY];
+
+	if (q.numberOfEvents == 0)
+		return 0;
+
+	return (uint32_t)(q.heap[0].eventTime - q.currentTime);
+}
+
+
 double GetTimeToNextEvent(int type/*= EVENT_MAIN*/)
 {
-#if 0
-	double time = 0;
-	bool firstTime = true;
+	return (double)GetCyclesToNextEvent(type) * (vjs.hardwareTypeNTSC ? RISC_CYCLE_IN_USEC : RISC_CYCLE_PAL_IN_USEC);
+}
 
-	for(uint32 i=0; i<EVENT_LIST_SIZE; i++)
-	{
-		if (eventList[i].valid)
-		{
-			if (firstTime)
-				time = eventList[i].eventTime, nextEvent = i, firstTime = false;
-			else
-			{
-				if (eventList[i].eventTime < time)
-					time = eventList[i].eventTime, nextEvent = i;
-			}
-		}
-	}
-#else
-	if (type == EVENT_MAIN)
-	{
-		double time = eventList[0].eventTime;
-		nextEvent = 0;
 
-		for(uint32_t i=1; i<EVENT_LIST_SIZE; i++)
-		{
-			if (eventList[i].valid && (eventList[i].eventTime < time))
-			{
-				time = eventList[i].eventTime;
-				nextEvent = i;
-			}
-		}
+void HandleNextEvent(int type/*= EVENT_MAIN*/)
+{
+	EventQueue & q = eventQueue[type == EVENT_MAIN ? EVENT_MAIN : EVENT_JERRY];
 
-		return time;
-	}
-	else
-	{
-		double time = eventListJERRY[0].eventTime;
-		nextEventJERRY = 0;
+	if (q.numberOfEvents == 0)
+		return;
 
-		for(uint32_t i=1; i<EVENT_LIST_SIZE; i++)
-		{
-			if (eventListJERRY[i].valid && (eventListJERRY[i].eventTime < time))
-			{
-				time = eventListJERRY[i].eventTime;
-				nextEventJERRY = i;
-			}
-		}
+	// Remove the event from the heap *before* calling it, since the callback
+	// will more often than not put itself right back in...
+	q.currentTime = q.heap[0].eventTime;
+	void (* event)(void) = q.heap[0].timerCallback;
+	RemoveAt(q, 0);
 
-		return time;
-	}
-#endif
+	(*event)();
 }
 
 
-void HandleNextEvent(int type/*= EVENT_MAIN*/)
+//
+// Save/load both timelines. Since event times are absolute, they can go out
+// as-is along with each timeline's notion of "now". All of the slots are
+// written, used or not, so that the size of a state never changes.
+//
+void EventStateSync(StateBuffer * sb)
 {
-	if (type == EVENT_MAIN)
+	for(int type=EVENT_MAIN; type<=EVENT_JERRY; type++)
 	{
-		double elapsedTime = eventList[nextEvent].eventTime;
-		void (* event)(void) = eventList[nextEvent].timerCallback;
+		EventQueue & q = eventQueue[type];
 
-		for(uint32_t i=0; i<EVENT_LIST_SIZE; i++)
+		STATE_SYNC(sb, q.numberOfEvents);
+		STATE_SYNC(sb, q.sequence);
+		STATE_SYNC(sb, q.currentTime);
+
+		if (q.numberOfEvents > EVENT_LIST_SIZE)
 		{
-	//We can skip the check & just subtract from everything, since the check is probably
-	//just as heavy as the code after and we won't use the elapsed time from an invalid event anyway.
-	//		if (eventList[i].valid)
-				eventList[i].eventTime -= elapsedTime;
+			WriteLog("EVENT: Bad event count (%u) in save state!\n", q.numberOfEvents);
+			q.numberOfEvents = 0;
+			sb->error = true;
 		}
 
-		eventList[nextEvent].valid = false;			// Remove event from list...
-		numberOfEvents--;
-
-		(*event)();
-	}
-	else
-	{
-		double elapsedTime = eventListJERRY[nextEventJERRY].eventTime;
-		void (* event)(void) = eventListJERRY[nextEventJERRY].timerCallback;
-
 		for(uint32_t i=0; i<EVENT_LIST_SIZE; i++)
 		{
-	//We can skip the check & just subtract from everything, since the check is probably
-	//just as heavy as the code after and we won't use the elapsed time from an invalid event anyway.
-	//		if (eventList[i].valid)
-				eventListJERRY[i].eventTime -= elapsedTime;
-		}
+			Event & e = q.heap[i];
+			int32_t eventType = e.eventType;
+			uint8_t id = 0;
+
+			if (sb->mode != STATE_LOAD && i < q.numberOfEvents)
+			{
+				while (id < NUM_EVENT_CALLBACKS && eventCallbacks[id] != e.timerCallback)
+					id++;
+
+				if (id == NUM_EVENT_CALLBACKS)
+					WriteLog("EVENT: Unknown callback in the %s list can't be saved!\n", (type == EVENT_MAIN ? "main" : "JERRY"));
+			}
 
-		eventListJERRY[nextEventJERRY].valid = false;	// Remove event from list...
-		numberOfEvents--;
+			STATE_SYNC(sb, e.eventTime);
+			STATE_SYNC(sb, e.sequence);
+			STATE_SYNC(sb, eventType);
+			STATE_SYNC(sb, id);
 
-		(*event)();
+			if (sb->mode == STATE_LOAD)
+			{
+				if (i < q.numberOfEvents && id >= NUM_EVENT_CALLBACKS)
+				{
+					q.numberOfEvents = 0;
+					sb->error = true;
+				}
+
+				e.eventType = eventType;
+				e.timerCallback = (id < NUM_EVENT_CALLBACKS ? eventCallbacks[id] : 0);
+			}
+		}
 	}
 }
 
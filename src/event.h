@@ -7,8 +7,35 @@
 #ifndef __EVENT_H__
 #define __EVENT_H__
 
+#include <stdint.h>
+#include "context.h"
+#include "state.h"
+
 enum { EVENT_MAIN, EVENT_JERRY };
 
+#define EVENT_LIST_SIZE       32
+
+struct Event
+{
+	uint64_t eventTime;								// Absolute time, in RISC cycles
+	uint32_t sequence;								// Tie breaker for events @ same time
+	int eventType;
+	void (* timerCallback)(void);
+};
+
+struct EventQueue
+{
+	Event heap[EVENT_LIST_SIZE];
+	uint32_t numberOfEvents;
+	uint32_t sequence;
+	uint64_t currentTime;							// Time of the last handled event
+};
+
+struct EventState
+{
+	EventQueue eventQueue[2];
+};
+
 //NTSC Timings...
 #define RISC_CYCLE_IN_USEC			0.03760684198
 #define M68K_CYCLE_IN_USEC			(RISC_CYCLE_IN_USEC * 2)
@@ -24,9 +51,12 @@ enum { EVENT_MAIN, EVENT_JERRY };
 
 void InitializeEventList(void);
 void SetCallbackTime(void (* callback)(void), double time, int type = EVENT_MAIN);
+void SetCallbackCycles(void (* callback)(void), uint64_t cycles, int type = EVENT_MAIN);
 void RemoveCallback(void (* callback)(void));
 void AdjustCallbackTime(void (* callback)(void), double time);
+uint32_t GetCyclesToNextEvent(int type = EVENT_MAIN);
 double GetTimeToNextEvent(int type = EVENT_MAIN);
 void HandleNextEvent(int type = EVENT_MAIN);
+void EventStateSync(StateBuffer * sb);
 
 #endif	// __EVENT_H__
@@ -33,76 +33,16 @@
 #include "jaguar.h"
 #include "log.h"
 #include "m68000/m68kinterface.h"
+#include "profile.h"
+#include "risc.h"
+#include "riscjit.h"
+#include "settings.h"
 //#include "vjag_memory.h"
 #include "tom.h"
 
 
-// Seems alignment in loads & stores was off...
-#define GPU_CORRECT_ALIGNMENT
 //#define GPU_DEBUG
 
-// For GPU dissasembly...
-
-#if 0
-#define GPU_DIS_ABS
-#define GPU_DIS_ADD
-#define GPU_DIS_ADDC
-#define GPU_DIS_ADDQ
-#define GPU_DIS_ADDQT
-#define GPU_DIS_AND
-#define GPU_DIS_BCLR
-#define GPU_DIS_BSET
-#define GPU_DIS_BTST
-#define GPU_DIS_CMP
-#define GPU_DIS_CMPQ
-#define GPU_DIS_DIV
-#define GPU_DIS_IMULT
-#define GPU_DIS_JUMP
-#define GPU_DIS_JR
-#define GPU_DIS_LOAD
-#define GPU_DIS_LOADB
-#define GPU_DIS_LOADW
-#define GPU_DIS_LOAD14I
-#define GPU_DIS_LOAD14R
-#define GPU_DIS_LOAD15I
-#define GPU_DIS_LOAD15R
-#define GPU_DIS_MOVE
-#define GPU_DIS_MOVEFA
-#define GPU_DIS_MOVEI
-#define GPU_DIS_MOVEPC
-#define GPU_DIS_MOVETA
-#define GPU_DIS_MOVEQ
-#define GPU_DIS_MULT
-#define GPU_DIS_NEG
-#define GPU_DIS_NOP
-#define GPU_DIS_NOT
-#define GPU_DIS_OR
-#define GPU_DIS_PACK
-#define GPU_DIS_ROR
-#define GPU_DIS_RORQ
-#define GPU_DIS_SAT8
-#define GPU_DIS_SH
-#define GPU_DIS_SHA
-#define GPU_DIS_SHARQ
-#define GPU_DIS_SHLQ
-#define GPU_DIS_SHRQ
-#define GPU_DIS_STORE
-#define GPU_DIS_STOREB
-#define GPU_DIS_STOREW
-#define GPU_DIS_STORE14I
-#define GPU_DIS_STORE14R
-#define GPU_DIS_STORE15I
-#define GPU_DIS_STORE15R
-#define GPU_DIS_SUB
-#define GPU_DIS_SUBC
-#define GPU_DIS_SUBQ
-#define GPU_DIS_SUBQT
-#define GPU_DIS_XOR
-
-bool doGPUDis = false;
-//bool doGPUDis = true;
-#endif
-
 /*
 GPU opcodes use (BIOS flying ATARI logo):
 +	              add 357416
@@ -184,71 +124,6 @@ void GPUDumpDisassembly(void);
 void GPUDumpRegisters(void);
 void GPUDumpMemory(void);
 
-static void gpu_opcode_add(void);
-static void gpu_opcode_addc(void);
-static void gpu_opcode_addq(void);
-static void gpu_opcode_addqt(void);
-static void gpu_opcode_sub(void);
-static void gpu_opcode_subc(void);
-static void gpu_opcode_subq(void);
-static void gpu_opcode_subqt(void);
-static void gpu_opcode_neg(void);
-static void gpu_opcode_and(void);
-static void gpu_opcode_or(void);
-static void gpu_opcode_xor(void);
-static void gpu_opcode_not(void);
-static void gpu_opcode_btst(void);
-static void gpu_opcode_bset(void);
-static void gpu_opcode_bclr(void);
-static void gpu_opcode_mult(void);
-static void gpu_opcode_imult(void);
-static void gpu_opcode_imultn(void);
-static void gpu_opcode_resmac(void);
-static void gpu_opcode_imacn(void);
-static void gpu_opcode_div(void);
-static void gpu_opcode_abs(void);
-static void gpu_opcode_sh(void);
-static void gpu_opcode_shlq(void);
-static void gpu_opcode_shrq(void);
-static void gpu_opcode_sha(void);
-static void gpu_opcode_sharq(void);
-static void gpu_opcode_ror(void);
-static void gpu_opcode_rorq(void);
-static void gpu_opcode_cmp(void);
-static void gpu_opcode_cmpq(void);
-static void gpu_opcode_sat8(void);
-static void gpu_opcode_sat16(void);
-static void gpu_opcode_move(void);
-static void gpu_opcode_moveq(void);
-static void gpu_opcode_moveta(void);
-static void gpu_opcode_movefa(void);
-static void gpu_opcode_movei(void);
-static void gpu_opcode_loadb(void);
-static void gpu_opcode_loadw(void);
-static void gpu_opcode_load(void);
-static void gpu_opcode_loadp(void);
-static void gpu_opcode_load_r14_indexed(void);
-static void gpu_opcode_load_r15_indexed(void);
-static void gpu_opcode_storeb(void);
-static void gpu_opcode_storew(void);
-static void gpu_opcode_store(void);
-static void gpu_opcode_storep(void);
-static void gpu_opcode_store_r14_indexed(void);
-static void gpu_opcode_store_r15_indexed(void);
-static void gpu_opcode_move_pc(void);
-static void gpu_opcode_jump(void);
-static void gpu_opcode_jr(void);
-static void gpu_opcode_mmult(void);
-static void gpu_opcode_mtoi(void);
-static void gpu_opcode_normi(void);
-static void gpu_opcode_nop(void);
-static void gpu_opcode_load_r14_ri(void);
-static void gpu_opcode_load_r15_ri(void);
-static void gpu_opcode_store_r14_ri(void);
-static void gpu_opcode_store_r15_ri(void);
-static void gpu_opcode_sat24(void);
-static void gpu_opcode_pack(void);
-
 // This is wrong, since it doesn't take pipeline effects into account. !!! FIX !!!
 /*uint8_t gpu_opcode_cycles[64] =
 {
@@ -288,85 +163,35 @@ uint8_t gpu_opcode_cycles[64] =
 	1,  1,  1,  1,  1,  1,  1,  1
 };//*/
 
-void (*gpu_opcode[64])()=
-{
-	gpu_opcode_add,					gpu_opcode_addc,				gpu_opcode_addq,				gpu_opcode_addqt,
-	gpu_opcode_sub,					gpu_opcode_subc,				gpu_opcode_subq,				gpu_opcode_subqt,
-	gpu_opcode_neg,					gpu_opcode_and,					gpu_opcode_or,					gpu_opcode_xor,
-	gpu_opcode_not,					gpu_opcode_btst,				gpu_opcode_bset,				gpu_opcode_bclr,
-	gpu_opcode_mult,				gpu_opcode_imult,				gpu_opcode_imultn,				gpu_opcode_resmac,
-	gpu_opcode_imacn,				gpu_opcode_div,					gpu_opcode_abs,					gpu_opcode_sh,
-	gpu_opcode_shlq,				gpu_opcode_shrq,				gpu_opcode_sha,					gpu_opcode_sharq,
-	gpu_opcode_ror,					gpu_opcode_rorq,				gpu_opcode_cmp,					gpu_opcode_cmpq,
-	gpu_opcode_sat8,				gpu_opcode_sat16,				gpu_opcode_move,				gpu_opcode_moveq,
-	gpu_opcode_moveta,				gpu_opcode_movefa,				gpu_opcode_movei,				gpu_opcode_loadb,
-	gpu_opcode_loadw,				gpu_opcode_load,				gpu_opcode_loadp,				gpu_opcode_load_r14_indexed,
-	gpu_opcode_load_r15_indexed,	gpu_opcode_storeb,				gpu_opcode_storew,				gpu_opcode_store,
-	gpu_opcode_storep,				gpu_opcode_store_r14_indexed,	gpu_opcode_store_r15_indexed,	gpu_opcode_move_pc,
-	gpu_opcode_jump,				gpu_opcode_jr,					gpu_opcode_mmult,				gpu_opcode_mtoi,
-	gpu_opcode_normi,				gpu_opcode_nop,					gpu_opcode_load_r14_ri,			gpu_opcode_load_r15_ri,
-	gpu_opcode_store_r14_ri,		gpu_opcode_store_r15_ri,		gpu_opcode_sat24,				gpu_opcode_pack,
-};
-
-static uint8_t gpu_ram_8[0x1000];
-uint32_t gpu_pc;
-static uint32_t gpu_acc;
-static uint32_t gpu_remain;
-static uint32_t gpu_hidata;
-static uint32_t gpu_flags;
-static uint32_t gpu_matrix_control;
-static uint32_t gpu_pointer_to_matrix;
-static uint32_t gpu_data_organization;
-static uint32_t gpu_control;
-static uint32_t gpu_div_control;
-// There is a distinct advantage to having these separated out--there's no need to clear
-// a bit before writing a result. I.e., if the result of an operation leaves a zero in
-// the carry flag, you don't have to zero gpu_flag_c before you can write that zero!
-static uint8_t gpu_flag_z, gpu_flag_n, gpu_flag_c;
-uint32_t gpu_reg_bank_0[32];
-uint32_t gpu_reg_bank_1[32];
-static uint32_t * gpu_reg;
-static uint32_t * gpu_alternate_reg;
-
-static uint32_t gpu_instruction;
-static uint32_t gpu_opcode_first_parameter;
-static uint32_t gpu_opcode_second_parameter;
+#ifndef MULTI_INSTANCE
+struct GPUState gpuState;
+#endif
+
+#define gpu_ram_8					(CONTEXT(gpu).gpu_ram_8)
+#define gpu_pc						(CONTEXT(gpu).gpu_pc)
+#define gpu_acc						(CONTEXT(gpu).gpu_acc)
+#define gpu_remain					(CONTEXT(gpu).gpu_remain)
+#define gpu_hidata					(CONTEXT(gpu).gpu_hidata)
+#define gpu_flags					(CONTEXT(gpu).gpu_flags)
+#define gpu_matrix_control			(CONTEXT(gpu).gpu_matrix_control)
+#define gpu_pointer_to_matrix		(CONTEXT(gpu).gpu_pointer_to_matrix)
+#define gpu_data_organization		(CONTEXT(gpu).gpu_data_organization)
+#define gpu_control					(CONTEXT(gpu).gpu_control)
+#define gpu_div_control				(CONTEXT(gpu).gpu_div_control)
+#define gpu_flag_zn					(CONTEXT(gpu).gpu_flag_zn)
+#define gpu_flag_c					(CONTEXT(gpu).gpu_flag_c)
+#define gpu_reg						(CONTEXT(gpu).gpu_reg)
+#define gpu_alternate_reg			(CONTEXT(gpu).gpu_alternate_reg)
+#define gpu_opcode_first_parameter	(CONTEXT(gpu).gpu_opcode_first_parameter)
+#define gpu_opcode_second_parameter	(CONTEXT(gpu).gpu_opcode_second_parameter)
+#define gpu_in_exec					(CONTEXT(gpu).gpu_in_exec)
+#define gpu_releaseTimeSlice_flag	(CONTEXT(gpu).gpu_releaseTimeSlice_flag)
+#define gpu_decode_cache			(CONTEXT(gpu).gpu_decode_cache)
+#define gpu_jit_state				(CONTEXT(gpu).gpu_jit_state)
+#define gpu_jit						(CONTEXT(gpu).gpu_jit)
 
 #define GPU_RUNNING		(gpu_control & 0x01)
 
-#define RM				gpu_reg[gpu_opcode_first_parameter]
-#define RN				gpu_reg[gpu_opcode_second_parameter]
-#define ALTERNATE_RM	gpu_alternate_reg[gpu_opcode_first_parameter]
-#define ALTERNATE_RN	gpu_alternate_reg[gpu_opcode_second_parameter]
-#define IMM_1			gpu_opcode_first_parameter
-#define IMM_2			gpu_opcode_second_parameter
-
-#define SET_FLAG_Z(r)	(gpu_flag_z = ((r) == 0));
-#define SET_FLAG_N(r)	(gpu_flag_n = (((uint32_t)(r) >> 31) & 0x01));
-
-#define RESET_FLAG_Z()	gpu_flag_z = 0;
-#define RESET_FLAG_N()	gpu_flag_n = 0;
-#define RESET_FLAG_C()	gpu_flag_c = 0;
-
-#define CLR_Z				(gpu_flag_z = 0)
-#define CLR_ZN				(gpu_flag_z = gpu_flag_n = 0)
-#define CLR_ZNC				(gpu_flag_z = gpu_flag_n = gpu_flag_c = 0)
-#define SET_Z(r)			(gpu_flag_z = ((r) == 0))
-#define SET_N(r)			(gpu_flag_n = (((uint32_t)(r) >> 31) & 0x01))
-#define SET_C_ADD(a,b)		(gpu_flag_c = ((uint32_t)(b) > (uint32_t)(~(a))))
-#define SET_C_SUB(a,b)		(gpu_flag_c = ((uint32_t)(b) > (uint32_t)(a)))
-#define SET_ZN(r)			SET_N(r); SET_Z(r)
-#define SET_ZNC_ADD(a,b,r)	SET_N(r); SET_Z(r); SET_C_ADD(a,b)
-#define SET_ZNC_SUB(a,b,r)	SET_N(r); SET_Z(r); SET_C_SUB(a,b)
-
-uint32_t gpu_convert_zero[32] =
-	{ 32,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31 };
-
-uint8_t * branch_condition_table = 0;
-#define BRANCH_CONDITION(x)	branch_condition_table[(x) + ((jaguar_flags & 7) << 5)]
-
-uint32_t gpu_opcode_use[64];
-
 const char * gpu_opcode_str[64]=
 {
 	"add",				"addc",				"addq",				"addqt",
@@ -387,8 +212,153 @@ const char * gpu_opcode_str[64]=
 	"store_r14_ri",		"store_r15_ri",		"sat24",			"pack",
 };
 
-static uint32_t gpu_in_exec = 0;
-static uint32_t gpu_releaseTimeSlice_flag = 0;
+//
+// What the RISC core (see risc.h) needs to know about the GPU
+//
+struct GPUTraits
+{
+	enum { WHO = GPU, RAM_BASE = GPU_WORK_RAM_BASE, RAM_SIZE = 0x1000, IRQS = 5,
+		PROFILE = PROFILE_GPU, DASM = JAGUAR_GPU };
+	typedef uint32_t Accumulator;
+
+	static inline uint32_t & pc(void) { return gpu_pc; }
+	static inline uint32_t * & reg(void) { return gpu_reg; }
+	static inline uint32_t * & alternateReg(void) { return gpu_alternate_reg; }
+	static inline uint32_t * regBank0(void) { return gpu_reg_bank_0; }
+	static inline uint32_t * regBank1(void) { return gpu_reg_bank_1; }
+	static inline uint32_t & flags(void) { return gpu_flags; }
+	static inline uint32_t & control(void) { return gpu_control; }
+	static inline uint64_t & flagZN(void) { return gpu_flag_zn; }
+	static inline uint8_t & flagC(void) { return gpu_flag_c; }
+	static inline Accumulator & acc(void) { return gpu_acc; }
+	static inline uint32_t & remain(void) { return gpu_remain; }
+	static inline uint32_t & hidata(void) { return gpu_hidata; }
+	static inline uint32_t & divControl(void) { return gpu_div_control; }
+	static inline uint32_t & matrixControl(void) { return gpu_matrix_control; }
+	static inline uint32_t & pointerToMatrix(void) { return gpu_pointer_to_matrix; }
+	static inline uint32_t & firstParameter(void) { return gpu_opcode_first_parameter; }
+	static inline uint32_t & secondParameter(void) { return gpu_opcode_second_parameter; }
+	static inline uint32_t & inExec(void) { return gpu_in_exec; }
+	static inline uint8_t * ram(void) { return gpu_ram_8; }
+	static inline uint32_t * opcodeUse(void) { return gpu_opcode_use; }
+	static inline RISCDecodedOp * decodeCache(void) { return gpu_decode_cache; }
+	static inline RISCJitCore & jit(void) { return gpu_jit; }
+	static void (* (& opcode)[64])();
+	static uint8_t (& opcodeCycles)[64];
+
+	static inline uint16_t ReadWord(uint32_t offset) { return GPUReadWord(offset, GPU); }
+	static inline uint32_t ReadLong(uint32_t offset) { return GPUReadLong(offset, GPU); }
+	static inline void WriteLong(uint32_t offset, uint32_t data) { GPUWriteLong(offset, data, GPU); }
+	static inline void Exec(int32_t cycles) { GPUExec(cycles); }
+
+	static inline void BeforeOpcode(void)
+	{
+#ifdef DEBUG_HOOKS
+if (gpu_ram_8[0x054] == 0x98 && gpu_ram_8[0x055] == 0x0A && gpu_ram_8[0x056] == 0x03
+	&& gpu_ram_8[0x057] == 0x00 && gpu_ram_8[0x058] == 0x00 && gpu_ram_8[0x059] == 0x00)
+{
+	if (gpu_pc == 0xF03000)
+		starCount = 0;
+}
+#endif
+	}
+
+	static inline bool Tracing(void)
+	{
+#ifdef DEBUG_HOOKS
+		return gpu_start_log;
+#else
+		return false;
+#endif
+	}
+};
+
+typedef RISC<GPUTraits> GPURISC;
+
+#define GPU_FLAG_Z		GPURISC::FlagZ()
+#define GPU_FLAG_N		GPURISC::FlagN()
+
+void (* gpu_opcode[64])() =
+{
+	GPURISC::opcode_add,				GPURISC::opcode_addc,				GPURISC::opcode_addq,				GPURISC::opcode_addqt,
+	GPURISC::opcode_sub,				GPURISC::opcode_subc,				GPURISC::opcode_subq,				GPURISC::opcode_subqt,
+	GPURISC::opcode_neg,				GPURISC::opcode_and,				GPURISC::opcode_or,					GPURISC::opcode_xor,
+	GPURISC::opcode_not,				GPURISC::opcode_btst,				GPURISC::opcode_bset,				GPURISC::opcode_bclr,
+	GPURISC::opcode_mult,				GPURISC::opcode_imult,				GPURISC::opcode_imultn,				GPURISC::opcode_resmac,
+	GPURISC::opcode_imacn,				GPURISC::opcode_div,				GPURISC::opcode_abs,				GPURISC::opcode_sh,
+	GPURISC::opcode_shlq,				GPURISC::opcode_shrq,				GPURISC::opcode_sha,				GPURISC::opcode_sharq,
+	GPURISC::opcode_ror,				GPURISC::opcode_rorq,				GPURISC::opcode_cmp,				GPURISC::opcode_cmpq,
+	GPURISC::opcode_sat8,				GPURISC::opcode_sat16,				GPURISC::opcode_move,				GPURISC::opcode_moveq,
+	GPURISC::opcode_moveta,				GPURISC::opcode_movefa,				GPURISC::opcode_movei,				GPURISC::opcode_loadb,
+	GPURISC::opcode_loadw,				GPURISC::opcode_load,				GPURISC::opcode_loadp,				GPURISC::opcode_load_r14_indexed,
+	GPURISC::opcode_load_r15_indexed,	GPURISC::opcode_storeb,				GPURISC::opcode_storew,				GPURISC::opcode_store,
+	GPURISC::opcode_storep,				GPURISC::opcode_store_r14_indexed,	GPURISC::opcode_store_r15_indexed,	GPURISC::opcode_move_pc,
+	GPURISC::opcode_jump,				GPURISC::opcode_jr,					GPURISC::opcode_mmult,				GPURISC::opcode_mtoi,
+	GPURISC::opcode_normi,				GPURISC::opcode_nop,				GPURISC::opcode_load_r14_ri,		GPURISC::opcode_load_r15_ri,
+	GPURISC::opcode_store_r14_ri,		GPURISC::opcode_store_r15_ri,		GPURISC::opcode_sat24,				GPURISC::opcode_pack,
+};
+
+// How the recompiler handles each opcode (see riscjit.h)
+
+static const uint8_t gpu_jit_kind[64] =
+{
+	RJ_ADD,		RJ_CALL,	RJ_ADDQ,	RJ_ADDQT,	RJ_SUB,		RJ_CALL,	RJ_SUBQ,	RJ_SUBQT,
+	RJ_NEG,		RJ_AND,		RJ_OR,		RJ_XOR,		RJ_NOT,		RJ_BTST,	RJ_BSET,	RJ_BCLR,
+	RJ_MULT,	RJ_IMULT,	RJ_CALL,	RJ_CALL,	RJ_CALL,	RJ_CALL,	RJ_CALL,	RJ_CALL,
+	RJ_SHLQ,	RJ_SHRQ,	RJ_CALL,	RJ_SHARQ,	RJ_CALL,	RJ_RORQ,	RJ_CMP,		RJ_CMPQ,
+	RJ_CALL,	RJ_CALL,	RJ_MOVE,	RJ_MOVEQ,	RJ_MOVETA,	RJ_MOVEFA,	RJ_MOVEI,	RJ_LOAD,
+	RJ_LOAD,	RJ_LOAD,	RJ_LOAD,	RJ_LOAD,	RJ_LOAD,	RJ_STORE,	RJ_STORE,	RJ_STORE,
+	RJ_STORE,	RJ_STORE,	RJ_STORE,	RJ_CALL,	RJ_JUMP,	RJ_JR,		RJ_LOAD,	RJ_CALL,
+	RJ_CALL,	RJ_NOP,		RJ_LOAD,	RJ_LOAD,	RJ_STORE,	RJ_STORE,	RJ_CALL,	RJ_CALL
+};
+
+void (* (& GPUTraits::opcode)[64])() = gpu_opcode;
+uint8_t (& GPUTraits::opcodeCycles)[64] = gpu_opcode_cycles;
+
+
+//
+// Tell the recompiler where this machine's GPU keeps everything
+//
+static void GPUJitSetup(void)
+{
+	RISCJitState state[GPU_JIT_STATES] =
+	{
+		{ gpu_reg_bank_0, sizeof(gpu_reg_bank_0), "bank 0" },
+		{ gpu_reg_bank_1, sizeof(gpu_reg_bank_1), "bank 1" },
+		{ &gpu_reg, sizeof(gpu_reg), "gpu_reg" },
+		{ &gpu_alternate_reg, sizeof(gpu_alternate_reg), "gpu_alternate_reg" },
+		{ &gpu_acc, sizeof(gpu_acc), "gpu_acc" },
+		{ &gpu_remain, sizeof(gpu_remain), "gpu_remain" },
+		{ &gpu_hidata, sizeof(gpu_hidata), "gpu_hidata" },
+		{ &gpu_flag_zn, sizeof(gpu_flag_zn), "gpu_flag_zn" },
+		{ &gpu_flag_c, sizeof(gpu_flag_c), "gpu_flag_c" },
+		{ &gpu_pc, sizeof(gpu_pc), "gpu_pc" }
+	};
+
+	memcpy(gpu_jit_state, state, sizeof(state));
+	gpu_jit.name = "GPU";
+	gpu_jit.ramBase = GPU_WORK_RAM_BASE;
+	gpu_jit.ramSize = 0x1000;
+	gpu_jit.ram = gpu_ram_8;
+	gpu_jit.opcode = gpu_opcode;
+	gpu_jit.opcodeCycles = gpu_opcode_cycles;
+	gpu_jit.opcodeUse = gpu_opcode_use;
+	gpu_jit.opcodeKind = gpu_jit_kind;
+	gpu_jit.convertZero = GPURISC::convertZero;
+	gpu_jit.firstParameter = &gpu_opcode_first_parameter;
+	gpu_jit.secondParameter = &gpu_opcode_second_parameter;
+	gpu_jit.pc = &gpu_pc;
+	gpu_jit.reg = &gpu_reg;
+	gpu_jit.alternateReg = &gpu_alternate_reg;
+	gpu_jit.flagZN = &gpu_flag_zn;
+	gpu_jit.flagC = &gpu_flag_c;
+	gpu_jit.control = &gpu_control;
+	gpu_jit.attention = NULL;
+	gpu_jit.delaySlotIRQ = GPURISC::IRQPending;
+	gpu_jit.state = gpu_jit_state;
+	gpu_jit.numState = GPU_JIT_STATES;
+}
+
 
 void GPUReleaseTimeslice(void)
 {
@@ -400,38 +370,6 @@ uint32_t GPUGetPC(void)
 	return gpu_pc;
 }
 
-void build_branch_condition_table(void)
-{
-	if (!branch_condition_table)
-	{
-		branch_condition_table = (uint8_t *)malloc(32 * 8 * sizeof(branch_condition_table[0]));
-
-		if (branch_condition_table)
-		{
-			for(int i=0; i<8; i++)
-			{
-				for(int j=0; j<32; j++)
-				{
-					int result = 1;
-					if (j & 1)
-						if (i & ZERO_FLAG)
-							result = 0;
-					if (j & 2)
-						if (!(i & ZERO_FLAG))
-							result = 0;
-					if (j & 4)
-						if (i & (CARRY_FLAG << (j >> 4)))
-							result = 0;
-					if (j & 8)
-						if (!(i & (CARRY_FLAG << (j >> 4))))
-							result = 0;
-					branch_condition_table[i * 32 + j] = result;
-				}
-			}
-		}
-	}
-}
-
 //
 // GPU byte access (read)
 //
@@ -523,10 +461,8 @@ uint32_t GPUReadLong(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 		{
 		case 0x00:
 			gpu_flag_c = (gpu_flag_c ? 1 : 0);
-			gpu_flag_z = (gpu_flag_z ? 1 : 0);
-			gpu_flag_n = (gpu_flag_n ? 1 : 0);
 
-			gpu_flags = (gpu_flags & 0xFFFFFFF8) | (gpu_flag_n << 2) | (gpu_flag_c << 1) | gpu_flag_z;
+			gpu_flags = (gpu_flags & 0xFFFFFFF8) | (GPU_FLAG_N << 2) | (gpu_flag_c << 1) | GPU_FLAG_Z;
 
 			return gpu_flags & 0xFFFFC1FF;
 		case 0x04:
@@ -570,6 +506,7 @@ void GPUWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 	if ((offset >= GPU_WORK_RAM_BASE) && (offset <= GPU_WORK_RAM_BASE + 0x0FFF))
 	{
 		gpu_ram_8[offset & 0xFFF] = data;
+		GPURISC::LocalWrite(offset & 0xFFF);
 
 //This is the same stupid worthless code that was in the DSP!!! AARRRGGGGHHHHH!!!!!!
 /*		if (!gpu_in_exec)
@@ -612,6 +549,8 @@ void GPUWriteWord(uint32_t offset, uint16_t data, uint32_t who/*=UNKNOWN*/)
 	{
 		gpu_ram_8[offset & 0xFFF] = (data>>8) & 0xFF;
 		gpu_ram_8[(offset+1) & 0xFFF] = data & 0xFF;//*/
+		GPURISC::LocalWrite(offset & 0xFFF);
+		GPURISC::LocalWrite((offset + 1) & 0xFFF);
 /*		offset &= 0xFFF;
 		SET16(gpu_ram_8, offset, data);//*/
 
@@ -696,6 +635,10 @@ void GPUWriteLong(uint32_t offset, uint32_t data, uint32_t who/*=UNKNOWN*/)
 
 		offset &= 0xFFF;
 		SET32(gpu_ram_8, offset, data);
+		// The offset isn't aligned, so this can touch three words
+		GPURISC::LocalWrite(offset);
+		GPURISC::LocalWrite(offset + 2);
+		GPURISC::LocalWrite(offset + 3);
 		return;
 	}
 //	else if ((offset >= GPU_CONTROL_RAM_BASE) && (offset < GPU_CONTROL_RAM_BASE+0x20))
@@ -710,9 +653,7 @@ void GPUWriteLong(uint32_t offset, uint32_t data, uint32_t who/*=UNKNOWN*/)
 			// NOTE: According to the JTRM, writing a 1 to IMASK has no effect; only the
 			//       IRQ logic can set it. So we mask it out here to prevent problems...
 			gpu_flags = data & (~IMASK);
-			gpu_flag_z = gpu_flags & ZERO_FLAG;
-			gpu_flag_c = (gpu_flags & CARRY_FLAG) >> 1;
-			gpu_flag_n = (gpu_flags & NEGA_FLAG) >> 2;
+			GPURISC::SetFlags(gpu_flags);
 			GPUUpdateRegisterBanks();
 			gpu_control &= ~((gpu_flags & CINT04FLAGS) >> 3);	// Interrupt latch clear bits
 //Writing here is only an interrupt enable--this approach is just plain wrong!
@@ -926,67 +867,20 @@ if (GPU_RUNNING && effect_start5 && gpu_pc == 0xF035D8)
 //
 void GPUUpdateRegisterBanks(void)
 {
-	int bank = (gpu_flags & REGPAGE);		// REGPAGE bit
-
-	if (gpu_flags & IMASK)					// IMASK bit
-		bank = 0;							// IMASK forces main bank to be bank 0
-
-	if (bank)
-		gpu_reg = gpu_reg_bank_1, gpu_alternate_reg = gpu_reg_bank_0;
-	else
-		gpu_reg = gpu_reg_bank_0, gpu_alternate_reg = gpu_reg_bank_1;
+	GPURISC::UpdateRegisterBanks();
 }
 
 void GPUHandleIRQs(void)
 {
-	// Bail out if we're already in an interrupt!
-	if (gpu_flags & IMASK)
-		return;
-
-	// Get the interrupt latch & enable bits
-	uint32_t bits = (gpu_control >> 6) & 0x1F, mask = (gpu_flags >> 4) & 0x1F;
-
-	// Bail out if latched interrupts aren't enabled
-	bits &= mask;
-	if (!bits)
-		return;
-
-	// Determine which interrupt to service
-	uint32_t which = 0; //Isn't there a #pragma to disable this warning???
-	if (bits & 0x01)
-		which = 0;
-	if (bits & 0x02)
-		which = 1;
-	if (bits & 0x04)
-		which = 2;
-	if (bits & 0x08)
-		which = 3;
-	if (bits & 0x10)
-		which = 4;
-
-	if (start_logging)
-		WriteLog("GPU: Generating IRQ #%i\n", which);
-
-	// set the interrupt flag
-	gpu_flags |= IMASK;
-	GPUUpdateRegisterBanks();
-
-	// subqt  #4,r31		; pre-decrement stack pointer
-	// move  pc,r30			; address of interrupted code
-	// store  r30,(r31)     ; store return address
-	gpu_reg[31] -= 4;
-	GPUWriteLong(gpu_reg[31], gpu_pc - 2, GPU);
-
-	// movei  #service_address,r30  ; pointer to ISR entry
-	// jump  (r30)					; jump to ISR
-	// nop
-	gpu_pc = gpu_reg[30] = GPU_WORK_RAM_BASE + (which * 0x10);
+	GPURISC::HandleIRQs();
 }
 
 void GPUSetIRQLine(int irqline, int state)
 {
+#ifdef DEBUG_HOOKS
 	if (start_logging)
 		WriteLog("GPU: Setting GPU IRQ line #%i\n", irqline);
+#endif
 
 	uint32_t mask = 0x0040 << irqline;
 	gpu_control &= ~mask;				// Clear the interrupt latch
@@ -1002,14 +896,23 @@ void GPUSetIRQLine(int irqline, int state)
 //#include "gpu2.h"
 //#include "gpu3.h"
 
+//
+// The GPU's branch condition table is shared by every machine (see context.h)
+//
+void GPUFillTables(void)
+{
+	GPURISC::Init();
+}
+
+
 void GPUInit(void)
 {
 //	memory_malloc_secure((void **)&gpu_ram_8, 0x1000, "GPU work RAM");
 //	memory_malloc_secure((void **)&gpu_reg_bank_0, 32 * sizeof(int32_t), "GPU bank 0 regs");
 //	memory_malloc_secure((void **)&gpu_reg_bank_1, 32 * sizeof(int32_t), "GPU bank 1 regs");
 
-	build_branch_condition_table();
-
+	GPUFillTables();
+	GPUJitSetup();
 	GPUReset();
 
 //TEMPORARY: Testing only!
@@ -1039,7 +942,7 @@ void GPUReset(void)
 	for(int i=0; i<32; i++)
 		gpu_reg[i] = gpu_alternate_reg[i] = 0x00000000;
 
-	CLR_ZNC;
+	GPURISC::ClearZNC();
 	memset(gpu_ram_8, 0xFF, 0x1000);
 	gpu_in_exec = 0;
 //not needed	GPUInterruptPending = false;
@@ -1047,7 +950,9 @@ void GPUReset(void)
 
 	// Contents of local RAM are quasi-stable; we simulate this by randomizing RAM contents
 	for(uint32_t i=0; i<4096; i+=4)
-		*((uint32_t *)(&gpu_ram_8[i])) = rand();
+		*((uint32_t *)(&gpu_ram_8[i])) = JaguarRandom();
+
+	GPURISC::Flush();
 }
 
 uint32_t GPUReadPC(void)
@@ -1078,7 +983,7 @@ void GPUDumpDisassembly(void)
 
 void GPUDumpRegisters(void)
 {
-	WriteLog("\n---[GPU flags: NCZ %d%d%d]-----------------------\n", gpu_flag_n, gpu_flag_c, gpu_flag_z);
+	WriteLog("\n---[GPU flags: NCZ %d%d%d]-----------------------\n", GPU_FLAG_N, gpu_flag_c, GPU_FLAG_Z);
 	WriteLog("\nRegisters bank 0\n");
 	for(int j=0; j<8; j++)
 	{
@@ -1126,1530 +1031,77 @@ void GPUDone(void)
 	}
 	WriteLog("\n");
 
+	RISCJitDone(&gpu_jit);
+
 //	memory_free(gpu_ram_8);
 //	memory_free(gpu_reg_bank_0);
 //	memory_free(gpu_reg_bank_1);
 }
 
 //
-// Main GPU execution core
+// Save/load the GPU's state. The register bank pointers are recalculated on
+// load, since they point into this module's memory.
 //
-static int testCount = 1;
-static int len = 0;
-static bool tripwire = false;
-void GPUExec(int32_t cycles)
+void GPUStateSync(StateBuffer * sb)
 {
-	if (!GPU_RUNNING)
-		return;
+	uint8_t bank = (gpu_reg == gpu_reg_bank_1 ? 1 : 0);
 
-#ifdef GPU_SINGLE_STEPPING
-	if (gpu_control & 0x18)
-	{
-		cycles = 1;
-		gpu_control &= ~0x10;
-	}
-#endif
-	GPUHandleIRQs();
-	gpu_releaseTimeSlice_flag = 0;
-	gpu_in_exec++;
+	// Only the decoded instructions & recompiled code for the words that the
+	// state actually changes have to go
+	const uint8_t * newRAM = StatePeek(sb, sizeof(gpu_ram_8));
 
-	while (cycles > 0 && GPU_RUNNING)
-	{
-if (gpu_ram_8[0x054] == 0x98 && gpu_ram_8[0x055] == 0x0A && gpu_ram_8[0x056] == 0x03
-	&& gpu_ram_8[0x057] == 0x00 && gpu_ram_8[0x058] == 0x00 && gpu_ram_8[0x059] == 0x00)
-{
-	if (gpu_pc == 0xF03000)
+	if (newRAM)
 	{
-		extern uint32_t starCount;
-		starCount = 0;
-/*		WriteLog("GPU: Starting starfield generator... Dump of [R03=%08X]:\n", gpu_reg_bank_0[03]);
-		uint32_t base = gpu_reg_bank_0[3];
-		for(uint32_t i=0; i<0x100; i+=16)
+		for(uint32_t i=0; i<0x1000; i+=2)
 		{
-			WriteLog("%02X: ", i);
-			for(uint32_t j=0; j<16; j++)
-			{
-				WriteLog("%02X ", JaguarReadByte(base + i + j));
-			}
-			WriteLog("\n");
-		}*/
-	}
-//	if (gpu_pc == 0xF03)
-	{
+			if (GET16(newRAM, i) != GET16(gpu_ram_8, i))
+				GPURISC::LocalWrite(i);
+		}
 	}
-}//*/
-/*if (gpu_pc == 0xF03B9E && gpu_reg_bank_0[01] == 0)
-{
-	GPUDumpRegisters();
-	WriteLog("GPU: Starting disassembly log...\n");
-	doGPUDis = true;
-}//*/
-/*if (gpu_pc == 0xF0359A)
-{
-	doGPUDis = true;
-	GPUDumpRegisters();
-}*/
-/*		gpu_flag_c = (gpu_flag_c ? 1 : 0);
-		gpu_flag_z = (gpu_flag_z ? 1 : 0);
-		gpu_flag_n = (gpu_flag_n ? 1 : 0);*/
-#if 0
-if (gpu_pc == 0xF03200)
-	doGPUDis = true;
-#endif
-
-		uint16_t opcode = GPUReadWord(gpu_pc, GPU);
-		uint32_t index = opcode >> 10;
-		gpu_instruction = opcode;				// Added for GPU #3...
-		gpu_opcode_first_parameter = (opcode >> 5) & 0x1F;
-		gpu_opcode_second_parameter = opcode & 0x1F;
-/*if (gpu_pc == 0xF03BE8)
-WriteLog("Start of OP frame write...\n");
-if (gpu_pc == 0xF03EEE)
-WriteLog("--> Writing BRANCH object ---\n");
-if (gpu_pc == 0xF03F62)
-WriteLog("--> Writing BITMAP object ***\n");//*/
-/*if (gpu_pc == 0xF03546)
-{
-	WriteLog("\n--> GPU PC: F03546\n");
-	GPUDumpRegisters();
-	GPUDumpDisassembly();
-}//*/
-/*if (gpu_pc == 0xF033F6)
-{
-	WriteLog("\n--> GPU PC: F033F6\n");
-	GPUDumpRegisters();
-	GPUDumpDisassembly();
-}//*/
-/*if (gpu_pc == 0xF033CC)
-{
-	WriteLog("\n--> GPU PC: F033CC\n");
-	GPUDumpRegisters();
-	GPUDumpDisassembly();
-}//*/
-/*if (gpu_pc == 0xF033D6)
-{
-	WriteLog("\n--> GPU PC: F033D6 (#%d)\n", testCount++);
-	GPUDumpRegisters();
-	GPUDumpMemory();
-}//*/
-/*if (gpu_pc == 0xF033D8)
-{
-	WriteLog("\n--> GPU PC: F033D8 (#%d)\n", testCount++);
-	GPUDumpRegisters();
-	GPUDumpMemory();
-}//*/
-/*if (gpu_pc == 0xF0358E)
-{
-	WriteLog("\n--> GPU PC: F0358E (#%d)\n", testCount++);
-	GPUDumpRegisters();
-	GPUDumpMemory();
-}//*/
-/*if (gpu_pc == 0xF034CA)
-{
-	WriteLog("\n--> GPU PC: F034CA (#%d)\n", testCount++);
-	GPUDumpRegisters();
-}//*/
-/*if (gpu_pc == 0xF034CA)
-{
-	len = gpu_reg[1] + 4;//, r9save = gpu_reg[9];
-	WriteLog("\nAbout to subtract [#%d] (R14=%08X, R15=%08X, R9=%08X):\n   ", testCount++, gpu_reg[14], gpu_reg[15], gpu_reg[9]);
-	for(int i=0; i<len; i+=4)
-		WriteLog(" %08X", GPUReadLong(gpu_reg[15]+i));
-	WriteLog("\n   ");
-	for(int i=0; i<len; i+=4)
-		WriteLog(" %08X", GPUReadLong(gpu_reg[14]+i));
-	WriteLog("\n\n");
-}
-if (gpu_pc == 0xF034DE)
-{
-	WriteLog("\nSubtracted! (R14=%08X, R15=%08X):\n   ", gpu_reg[14], gpu_reg[15]);
-	for(int i=0; i<len; i+=4)
-		WriteLog(" %08X", GPUReadLong(gpu_reg[15]+i));
-	WriteLog("\n   ");
-	for(int i=0; i<len; i+=4)
-		WriteLog(" %08X", GPUReadLong(gpu_reg[14]+i));
-	WriteLog("\n   ");
-	for(int i=0; i<len; i+=4)
-		WriteLog(" --------");
-	WriteLog("\n   ");
-	for(int i=0; i<len; i+=4)
-		WriteLog(" %08X", GPUReadLong(gpu_reg[9]+4+i));
-	WriteLog("\n\n");
-}//*/
-/*if (gpu_pc == 0xF035C8)
-{
-	WriteLog("\n--> GPU PC: F035C8 (#%d)\n", testCount++);
-	GPUDumpRegisters();
-	GPUDumpDisassembly();
-}//*/
 
-if (gpu_start_log)
-{
-//	gpu_reset_stats();
-static char buffer[512];
-dasmjag(JAGUAR_GPU, buffer, gpu_pc);
-WriteLog("GPU: [%08X] %s (RM=%08X, RN=%08X) -> ", gpu_pc, buffer, RM, RN);
-}//*/
-//$E400 -> 1110 01 -> $39 -> 57
-//GPU #1
-		gpu_pc += 2;
-		gpu_opcode[index]();
-//GPU #2
-//		gpu2_opcode[index]();
-//		gpu_pc += 2;
-//GPU #3				(Doesn't show ATARI logo! #1 & #2 do...)
-//		gpu_pc += 2;
-//		gpu3_opcode[index]();
-
-// BIOS hacking
-//GPU: [00F03548] jr      nz,00F03560 (0xd561) (RM=00F03114, RN=00000004) ->     --> JR: Branch taken.
-/*static bool firstTime = true;
-if (gpu_pc == 0xF03548 && firstTime)
-{
-	gpu_flag_z = 1;
-//	firstTime = false;
-
-//static char buffer[512];
-//int k=0xF03548;
-//while (k<0xF0356C)
-//{
-//int oldk = k;
-//k += dasmjag(JAGUAR_GPU, buffer, k);
-//WriteLog("GPU: [%08X] %s\n", oldk, buffer);
-//}
-//	gpu_start_log = 1;
-}//*/
-//GPU: [00F0354C] jump    nz,(r29) (0xd3a1) (RM=00F03314, RN=00000004) -> (RM=00F03314, RN=00000004)
-/*if (gpu_pc == 0xF0354C)
-	gpu_flag_z = 0;//, gpu_start_log = 1;//*/
-
-		cycles -= gpu_opcode_cycles[index];
-		gpu_opcode_use[index]++;
-if (gpu_start_log)
-	WriteLog("(RM=%08X, RN=%08X)\n", RM, RN);//*/
-if ((gpu_pc < 0xF03000 || gpu_pc > 0xF03FFF) && !tripwire)
-{
-	WriteLog("GPU: Executing outside local RAM! GPU_PC: %08X\n", gpu_pc);
-	tripwire = true;
-}
+	STATE_SYNC(sb, gpu_ram_8);
+	STATE_SYNC(sb, gpu_pc);
+	STATE_SYNC(sb, gpu_acc);
+	STATE_SYNC(sb, gpu_remain);
+	STATE_SYNC(sb, gpu_hidata);
+	STATE_SYNC(sb, gpu_flags);
+	STATE_SYNC(sb, gpu_matrix_control);
+	STATE_SYNC(sb, gpu_pointer_to_matrix);
+	STATE_SYNC(sb, gpu_data_organization);
+	STATE_SYNC(sb, gpu_control);
+	STATE_SYNC(sb, gpu_div_control);
+	STATE_SYNC(sb, gpu_flag_zn);
+	STATE_SYNC(sb, gpu_flag_c);
+	STATE_SYNC(sb, gpu_reg_bank_0);
+	STATE_SYNC(sb, gpu_reg_bank_1);
+	STATE_SYNC(sb, bank);
+
+	if (sb->mode == STATE_LOAD)
+	{
+		gpu_reg = (bank ? gpu_reg_bank_1 : gpu_reg_bank_0);
+		gpu_alternate_reg = (bank ? gpu_reg_bank_0 : gpu_reg_bank_1);
 	}
-
-	gpu_in_exec--;
 }
 
 //
-// GPU opcodes
+// Main GPU execution core
 //
-
-/*
-GPU opcodes use (offset punch--vertically below bad guy):
-	              add 18686
-	             addq 32621
-	              sub 7483
-	             subq 10252
-	              and 21229
-	               or 15003
-	             btst 1822
-	             bset 2072
-	             mult 141
-	              div 2392
-	             shlq 13449
-	             shrq 10297
-	            sharq 11104
-	              cmp 6775
-	             cmpq 5944
-	             move 31259
-	            moveq 4473
-	            movei 23277
-	            loadb 46
-	            loadw 4201
-	             load 28580
-	 load_r14_indexed 1183
-	 load_r15_indexed 1125
-	           storew 178
-	            store 10144
-	store_r14_indexed 320
-	store_r15_indexed 1
-	          move_pc 1742
-	             jump 24467
-	               jr 18090
-	              nop 41362
-*/
-
-
-static void gpu_opcode_jump(void)
+int32_t GPUExec(int32_t cycles)
 {
-#ifdef GPU_DIS_JUMP
-const char * condition[32] =
-{	"T", "nz", "z", "???", "nc", "nc nz", "nc z", "???", "c", "c nz",
-	"c z", "???", "???", "???", "???", "???", "???", "???", "???",
-	"???", "nn", "nn nz", "nn z", "???", "n", "n nz", "n z", "???",
-	"???", "???", "???", "F" };
-	if (doGPUDis)
-		WriteLog("%06X: JUMP   %s, (R%02u) [NCZ:%u%u%u, R%02u=%08X] ", gpu_pc-2, condition[IMM_2], IMM_1, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM);
-#endif
-	// normalize flags
-/*	gpu_flag_c = (gpu_flag_c ? 1 : 0);
-	gpu_flag_z = (gpu_flag_z ? 1 : 0);
-	gpu_flag_n = (gpu_flag_n ? 1 : 0);*/
-	// KLUDGE: Used by BRANCH_CONDITION
-	uint32_t jaguar_flags = (gpu_flag_n << 2) | (gpu_flag_c << 1) | gpu_flag_z;
-
-	if (BRANCH_CONDITION(IMM_2))
-	{
-#ifdef GPU_DIS_JUMP
-	if (doGPUDis)
-		WriteLog("Branched!\n");
-#endif
-if (gpu_start_log)
-	WriteLog("    --> JUMP: Branch taken.\n");
-		uint32_t delayed_pc = RM;
-		GPUExec(1);
-		gpu_pc = delayed_pc;
-/*		uint16_t opcode = GPUReadWord(gpu_pc, GPU);
-		gpu_opcode_first_parameter = (opcode >> 5) & 0x1F;
-		gpu_opcode_second_parameter = opcode & 0x1F;
-
-		gpu_pc = delayed_pc;
-		gpu_opcode[opcode>>10]();//*/
-	}
-#ifdef GPU_DIS_JUMP
-	else
-		if (doGPUDis)
-			WriteLog("Branch NOT taken.\n");
-#endif
-}
-
+	if (!GPU_RUNNING)
+		return 0;
 
-static void gpu_opcode_jr(void)
-{
-#ifdef GPU_DIS_JR
-const char * condition[32] =
-{	"T", "nz", "z", "???", "nc", "nc nz", "nc z", "???", "c", "c nz",
-	"c z", "???", "???", "???", "???", "???", "???", "???", "???",
-	"???", "nn", "nn nz", "nn z", "???", "n", "n nz", "n z", "???",
-	"???", "???", "???", "F" };
-	if (doGPUDis)
-		WriteLog("%06X: JR     %s, %06X [NCZ:%u%u%u] ", gpu_pc-2, condition[IMM_2], gpu_pc+((IMM_1 & 0x10 ? 0xFFFFFFF0 | IMM_1 : IMM_1) * 2), gpu_flag_n, gpu_flag_c, gpu_flag_z);
-#endif
-/*	if (CONDITION(jaguar.op & 31))
-	{
-		int32_t r1 = (INT8)((jaguar.op >> 2) & 0xF8) >> 2;
-		uint32_t newpc = jaguar.PC + r1;
-		CALL_MAME_DEBUG;
-		jaguar.op = ROPCODE(jaguar.PC);
-		jaguar.PC = newpc;
-		(*jaguar.table[jaguar.op >> 10])();
-
-		jaguar_icount -= 3;	// 3 wait states guaranteed
-	}*/
-	// normalize flags
-/*	gpu_flag_n = (gpu_flag_n ? 1 : 0);
-	gpu_flag_c = (gpu_flag_c ? 1 : 0);
-	gpu_flag_z = (gpu_flag_z ? 1 : 0);*/
-	// KLUDGE: Used by BRANCH_CONDITION
-	uint32_t jaguar_flags = (gpu_flag_n << 2) | (gpu_flag_c << 1) | gpu_flag_z;
-
-	if (BRANCH_CONDITION(IMM_2))
+#ifdef GPU_SINGLE_STEPPING
+	if (gpu_control & 0x18)
 	{
-#ifdef GPU_DIS_JR
-	if (doGPUDis)
-		WriteLog("Branched!\n");
-#endif
-if (gpu_start_log)
-	WriteLog("    --> JR: Branch taken.\n");
-		int32_t offset = (IMM_1 & 0x10 ? 0xFFFFFFF0 | IMM_1 : IMM_1);		// Sign extend IMM_1
-		int32_t delayed_pc = gpu_pc + (offset * 2);
-		GPUExec(1);
-		gpu_pc = delayed_pc;
-/*		uint16_t opcode = GPUReadWord(gpu_pc, GPU);
-		gpu_opcode_first_parameter = (opcode >> 5) & 0x1F;
-		gpu_opcode_second_parameter = opcode & 0x1F;
-
-		gpu_pc = delayed_pc;
-		gpu_opcode[opcode>>10]();//*/
+		cycles = 1;
+		gpu_control &= ~0x10;
 	}
-#ifdef GPU_DIS_JR
-	else
-		if (doGPUDis)
-			WriteLog("Branch NOT taken.\n");
-#endif
-}
-
-
-static void gpu_opcode_add(void)
-{
-#ifdef GPU_DIS_ADD
-	if (doGPUDis)
-		WriteLog("%06X: ADD    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	uint32_t res = RN + RM;
-	CLR_ZNC; SET_ZNC_ADD(RN, RM, res);
-	RN = res;
-#ifdef GPU_DIS_ADD
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_addc(void)
-{
-#ifdef GPU_DIS_ADDC
-	if (doGPUDis)
-		WriteLog("%06X: ADDC   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-/*	int dreg = jaguar.op & 31;
-	uint32_t r1 = jaguar.r[(jaguar.op >> 5) & 31];
-	uint32_t r2 = jaguar.r[dreg];
-	uint32_t res = r2 + r1 + ((jaguar.FLAGS >> 1) & 1);
-	jaguar.r[dreg] = res;
-	CLR_ZNC; SET_ZNC_ADD(r2,r1,res);*/
-
-	uint32_t res = RN + RM + gpu_flag_c;
-	uint32_t carry = gpu_flag_c;
-//	SET_ZNC_ADD(RN, RM, res); //???BUG??? Yes!
-	SET_ZNC_ADD(RN + carry, RM, res);
-//	SET_ZNC_ADD(RN, RM + carry, res);
-	RN = res;
-#ifdef GPU_DIS_ADDC
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_addq(void)
-{
-#ifdef GPU_DIS_ADDQ
-	if (doGPUDis)
-		WriteLog("%06X: ADDQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, gpu_convert_zero[IMM_1], IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	uint32_t r1 = gpu_convert_zero[IMM_1];
-	uint32_t res = RN + r1;
-	CLR_ZNC; SET_ZNC_ADD(RN, r1, res);
-	RN = res;
-#ifdef GPU_DIS_ADDQ
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_addqt(void)
-{
-#ifdef GPU_DIS_ADDQT
-	if (doGPUDis)
-		WriteLog("%06X: ADDQT  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, gpu_convert_zero[IMM_1], IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	RN += gpu_convert_zero[IMM_1];
-#ifdef GPU_DIS_ADDQT
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_sub(void)
-{
-#ifdef GPU_DIS_SUB
-	if (doGPUDis)
-		WriteLog("%06X: SUB    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	uint32_t res = RN - RM;
-	SET_ZNC_SUB(RN, RM, res);
-	RN = res;
-#ifdef GPU_DIS_SUB
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_subc(void)
-{
-#ifdef GPU_DIS_SUBC
-	if (doGPUDis)
-		WriteLog("%06X: SUBC   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	// This is how the GPU ALU does it--Two's complement with inverted carry
-	uint64_t res = (uint64_t)RN + (uint64_t)(RM ^ 0xFFFFFFFF) + (gpu_flag_c ^ 1);
-	// Carry out of the result is inverted too
-	gpu_flag_c = ((res >> 32) & 0x01) ^ 1;
-	RN = (res & 0xFFFFFFFF);
-	SET_ZN(RN);
-#ifdef GPU_DIS_SUBC
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_subq(void)
-{
-#ifdef GPU_DIS_SUBQ
-	if (doGPUDis)
-		WriteLog("%06X: SUBQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, gpu_convert_zero[IMM_1], IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	uint32_t r1 = gpu_convert_zero[IMM_1];
-	uint32_t res = RN - r1;
-	SET_ZNC_SUB(RN, r1, res);
-	RN = res;
-#ifdef GPU_DIS_SUBQ
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_subqt(void)
-{
-#ifdef GPU_DIS_SUBQT
-	if (doGPUDis)
-		WriteLog("%06X: SUBQT  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, gpu_convert_zero[IMM_1], IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
 #endif
-	RN -= gpu_convert_zero[IMM_1];
-#ifdef GPU_DIS_SUBQT
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_cmp(void)
-{
-#ifdef GPU_DIS_CMP
-	if (doGPUDis)
-		WriteLog("%06X: CMP    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	uint32_t res = RN - RM;
-	SET_ZNC_SUB(RN, RM, res);
-#ifdef GPU_DIS_CMP
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z);
-#endif
-}
-
-
-static void gpu_opcode_cmpq(void)
-{
-	static int32_t sqtable[32] =
-		{ 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,-16,-15,-14,-13,-12,-11,-10,-9,-8,-7,-6,-5,-4,-3,-2,-1 };
-#ifdef GPU_DIS_CMPQ
-	if (doGPUDis)
-		WriteLog("%06X: CMPQ   #%d, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, sqtable[IMM_1], IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	uint32_t r1 = sqtable[IMM_1 & 0x1F]; // I like this better -> (INT8)(jaguar.op >> 2) >> 3;
-	uint32_t res = RN - r1;
-	SET_ZNC_SUB(RN, r1, res);
-#ifdef GPU_DIS_CMPQ
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z);
-#endif
-}
-
-
-static void gpu_opcode_and(void)
-{
-#ifdef GPU_DIS_AND
-	if (doGPUDis)
-		WriteLog("%06X: AND    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	RN = RN & RM;
-	SET_ZN(RN);
-#ifdef GPU_DIS_AND
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_or(void)
-{
-#ifdef GPU_DIS_OR
-	if (doGPUDis)
-		WriteLog("%06X: OR     R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	RN = RN | RM;
-	SET_ZN(RN);
-#ifdef GPU_DIS_OR
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
+	GPUHandleIRQs();
+	gpu_releaseTimeSlice_flag = 0;
 
-static void gpu_opcode_xor(void)
-{
-#ifdef GPU_DIS_XOR
-	if (doGPUDis)
-		WriteLog("%06X: XOR    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	RN = RN ^ RM;
-	SET_ZN(RN);
-#ifdef GPU_DIS_XOR
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_not(void)
-{
-#ifdef GPU_DIS_NOT
-	if (doGPUDis)
-		WriteLog("%06X: NOT    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	RN = ~RN;
-	SET_ZN(RN);
-#ifdef GPU_DIS_NOT
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_move_pc(void)
-{
-#ifdef GPU_DIS_MOVEPC
-	if (doGPUDis)
-		WriteLog("%06X: MOVE   PC, R%02u [NCZ:%u%u%u, PC=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, gpu_pc-2, IMM_2, RN);
-#endif
-	// Should be previous PC--this might not always be previous instruction!
-	// Then again, this will point right at the *current* instruction, i.e., MOVE PC,R!
-	RN = gpu_pc - 2;
-#ifdef GPU_DIS_MOVEPC
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_sat8(void)
-{
-#ifdef GPU_DIS_SAT8
-	if (doGPUDis)
-		WriteLog("%06X: SAT8   R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	RN = ((int32_t)RN < 0 ? 0 : (RN > 0xFF ? 0xFF : RN));
-	SET_ZN(RN);
-#ifdef GPU_DIS_SAT8
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_sat16(void)
-{
-	RN = ((int32_t)RN < 0 ? 0 : (RN > 0xFFFF ? 0xFFFF : RN));
-	SET_ZN(RN);
-}
-
-static void gpu_opcode_sat24(void)
-{
-	RN = ((int32_t)RN < 0 ? 0 : (RN > 0xFFFFFF ? 0xFFFFFF : RN));
-	SET_ZN(RN);
-}
-
-
-static void gpu_opcode_store_r14_indexed(void)
-{
-#ifdef GPU_DIS_STORE14I
-	if (doGPUDis)
-		WriteLog("%06X: STORE  R%02u, (R14+$%02X) [NCZ:%u%u%u, R%02u=%08X, R14+$%02X=%08X]\n", gpu_pc-2, IMM_2, gpu_convert_zero[IMM_1] << 2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN, gpu_convert_zero[IMM_1] << 2, gpu_reg[14]+(gpu_convert_zero[IMM_1] << 2));
-#endif
-#ifdef GPU_CORRECT_ALIGNMENT
-	uint32_t address = gpu_reg[14] + (gpu_convert_zero[IMM_1] << 2);
-	
-	if (address >= 0xF03000 && address <= 0xF03FFF)
-		GPUWriteLong(address & 0xFFFFFFFC, RN, GPU);
-	else
-		GPUWriteLong(address, RN, GPU);
-#else
-	GPUWriteLong(gpu_reg[14] + (gpu_convert_zero[IMM_1] << 2), RN, GPU);
-#endif
-}
-
-
-static void gpu_opcode_store_r15_indexed(void)
-{
-#ifdef GPU_DIS_STORE15I
-	if (doGPUDis)
-		WriteLog("%06X: STORE  R%02u, (R15+$%02X) [NCZ:%u%u%u, R%02u=%08X, R15+$%02X=%08X]\n", gpu_pc-2, IMM_2, gpu_convert_zero[IMM_1] << 2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN, gpu_convert_zero[IMM_1] << 2, gpu_reg[15]+(gpu_convert_zero[IMM_1] << 2));
-#endif
-#ifdef GPU_CORRECT_ALIGNMENT
-	uint32_t address = gpu_reg[15] + (gpu_convert_zero[IMM_1] << 2);
-
-	if (address >= 0xF03000 && address <= 0xF03FFF)
-		GPUWriteLong(address & 0xFFFFFFFC, RN, GPU);
-	else
-		GPUWriteLong(address, RN, GPU);
-#else
-	GPUWriteLong(gpu_reg[15] + (gpu_convert_zero[IMM_1] << 2), RN, GPU);
-#endif
-}
-
-
-static void gpu_opcode_load_r14_ri(void)
-{
-#ifdef GPU_DIS_LOAD14R
-	if (doGPUDis)
-		WriteLog("%06X: LOAD   (R14+R%02u), R%02u [NCZ:%u%u%u, R14+R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM+gpu_reg[14], IMM_2, RN);
-#endif
-#ifdef GPU_CORRECT_ALIGNMENT
-	uint32_t address = gpu_reg[14] + RM;
-
-	if (address >= 0xF03000 && address <= 0xF03FFF)
-		RN = GPUReadLong(address & 0xFFFFFFFC, GPU);
-	else
-		RN = GPUReadLong(address, GPU);
-#else
-	RN = GPUReadLong(gpu_reg[14] + RM, GPU);
-#endif
-#ifdef GPU_DIS_LOAD14R
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_load_r15_ri(void)
-{
-#ifdef GPU_DIS_LOAD15R
-	if (doGPUDis)
-		WriteLog("%06X: LOAD   (R15+R%02u), R%02u [NCZ:%u%u%u, R15+R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM+gpu_reg[15], IMM_2, RN);
-#endif
-#ifdef GPU_CORRECT_ALIGNMENT
-	uint32_t address = gpu_reg[15] + RM;
-
-	if (address >= 0xF03000 && address <= 0xF03FFF)
-		RN = GPUReadLong(address & 0xFFFFFFFC, GPU);
-	else
-		RN = GPUReadLong(address, GPU);
-#else
-	RN = GPUReadLong(gpu_reg[15] + RM, GPU);
-#endif
-#ifdef GPU_DIS_LOAD15R
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_store_r14_ri(void)
-{
-#ifdef GPU_DIS_STORE14R
-	if (doGPUDis)
-		WriteLog("%06X: STORE  R%02u, (R14+R%02u) [NCZ:%u%u%u, R%02u=%08X, R14+R%02u=%08X]\n", gpu_pc-2, IMM_2, IMM_1, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN, IMM_1, RM+gpu_reg[14]);
-#endif
-#ifdef GPU_CORRECT_ALIGNMENT
-	uint32_t address = gpu_reg[14] + RM;
-
-	if (address >= 0xF03000 && address <= 0xF03FFF)
-		GPUWriteLong(address & 0xFFFFFFFC, RN, GPU);
-	else
-		GPUWriteLong(address, RN, GPU);
-#else
-	GPUWriteLong(gpu_reg[14] + RM, RN, GPU);
-#endif
-}
-
-
-static void gpu_opcode_store_r15_ri(void)
-{
-#ifdef GPU_DIS_STORE15R
-	if (doGPUDis)
-		WriteLog("%06X: STORE  R%02u, (R15+R%02u) [NCZ:%u%u%u, R%02u=%08X, R15+R%02u=%08X]\n", gpu_pc-2, IMM_2, IMM_1, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN, IMM_1, RM+gpu_reg[15]);
-#endif
-#ifdef GPU_CORRECT_ALIGNMENT_STORE
-	uint32_t address = gpu_reg[15] + RM;
-
-	if (address >= 0xF03000 && address <= 0xF03FFF)
-		GPUWriteLong(address & 0xFFFFFFFC, RN, GPU);
-	else
-		GPUWriteLong(address, RN, GPU);
-#else
-	GPUWriteLong(gpu_reg[15] + RM, RN, GPU);
-#endif
-}
-
-
-static void gpu_opcode_nop(void)
-{
-#ifdef GPU_DIS_NOP
-	if (doGPUDis)
-		WriteLog("%06X: NOP    [NCZ:%u%u%u]\n", gpu_pc-2, gpu_flag_n, gpu_flag_c, gpu_flag_z);
-#endif
-}
-
-
-static void gpu_opcode_pack(void)
-{
-#ifdef GPU_DIS_PACK
-	if (doGPUDis)
-		WriteLog("%06X: %s R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, (!IMM_1 ? "PACK  " : "UNPACK"), IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	uint32_t val = RN;
-
-//BUG!	if (RM == 0)				// Pack
-	if (IMM_1 == 0)				// Pack
-		RN = ((val >> 10) & 0x0000F000) | ((val >> 5) & 0x00000F00) | (val & 0x000000FF);
-	else						// Unpack
-		RN = ((val & 0x0000F000) << 10) | ((val & 0x00000F00) << 5) | (val & 0x000000FF);
-#ifdef GPU_DIS_PACK
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_storeb(void)
-{
-#ifdef GPU_DIS_STOREB
-	if (doGPUDis)
-		WriteLog("%06X: STOREB R%02u, (R%02u) [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_pc-2, IMM_2, IMM_1, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN, IMM_1, RM);
-#endif
-//Is this right???
-// Would appear to be so...!
-	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
-		GPUWriteLong(RM, RN & 0xFF, GPU);
-	else
-		JaguarWriteByte(RM, RN, GPU);
-}
-
-
-static void gpu_opcode_storew(void)
-{
-#ifdef GPU_DIS_STOREW
-	if (doGPUDis)
-		WriteLog("%06X: STOREW R%02u, (R%02u) [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_pc-2, IMM_2, IMM_1, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN, IMM_1, RM);
-#endif
-#ifdef GPU_CORRECT_ALIGNMENT
-	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
-		GPUWriteLong(RM & 0xFFFFFFFE, RN & 0xFFFF, GPU);
-	else
-		JaguarWriteWord(RM, RN, GPU);
-#else
-	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
-		GPUWriteLong(RM, RN & 0xFFFF, GPU);
-	else
-		JaguarWriteWord(RM, RN, GPU);
-#endif
-}
-
-
-static void gpu_opcode_store(void)
-{
-#ifdef GPU_DIS_STORE
-	if (doGPUDis)
-		WriteLog("%06X: STORE  R%02u, (R%02u) [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_pc-2, IMM_2, IMM_1, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN, IMM_1, RM);
-#endif
-#ifdef GPU_CORRECT_ALIGNMENT
-	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
-		GPUWriteLong(RM & 0xFFFFFFFC, RN, GPU);
-	else
-		GPUWriteLong(RM, RN, GPU);
-#else
-	GPUWriteLong(RM, RN, GPU);
-#endif
-}
-
-
-static void gpu_opcode_storep(void)
-{
-#ifdef GPU_CORRECT_ALIGNMENT
-	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
-	{
-		GPUWriteLong((RM & 0xFFFFFFF8) + 0, gpu_hidata, GPU);
-		GPUWriteLong((RM & 0xFFFFFFF8) + 4, RN, GPU);
-	}
-	else
-	{
-		GPUWriteLong(RM + 0, gpu_hidata, GPU);
-		GPUWriteLong(RM + 4, RN, GPU);
-	}
-#else
-	GPUWriteLong(RM + 0, gpu_hidata, GPU);
-	GPUWriteLong(RM + 4, RN, GPU);
-#endif
-}
-
-static void gpu_opcode_loadb(void)
-{
-#ifdef GPU_DIS_LOADB
-	if (doGPUDis)
-		WriteLog("%06X: LOADB  (R%02u), R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
-		RN = GPUReadLong(RM, GPU) & 0xFF;
-	else
-		RN = JaguarReadByte(RM, GPU);
-#ifdef GPU_DIS_LOADB
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_loadw(void)
-{
-#ifdef GPU_DIS_LOADW
-	if (doGPUDis)
-		WriteLog("%06X: LOADW  (R%02u), R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-#ifdef GPU_CORRECT_ALIGNMENT
-	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
-		RN = GPUReadLong(RM & 0xFFFFFFFE, GPU) & 0xFFFF;
-	else
-		RN = JaguarReadWord(RM, GPU);
-#else
-	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
-		RN = GPUReadLong(RM, GPU) & 0xFFFF;
-	else
-		RN = JaguarReadWord(RM, GPU);
-#endif
-#ifdef GPU_DIS_LOADW
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-// According to the docs, & "Do The Same", this address is long aligned...
-// So let's try it:
-// And it works!!! Need to fix all instances...
-// Also, Power Drive Rally seems to contradict the idea that only LOADs in
-// the $F03000-$F03FFF range are aligned...
-#warning "!!! Alignment issues, need to find definitive final word on this !!!"
-/*
-Preliminary testing on real hardware seems to confirm that something strange goes on
-with unaligned reads in main memory. When the address is off by 1, the result is the
-same as the long address with the top byte replaced by something. So if the read is
-from $401, and $400 has 12 34 56 78, the value read will be $nn345678, where nn is a currently unknown vlaue.
-When the address is off by 2, the result would be $nnnn5678, where nnnn is unknown.
-When the address is off by 3, the result would be $nnnnnn78, where nnnnnn is unknown.
-It may be that the "unknown" values come from the prefetch queue, but not sure how
-to test that. They seem to be stable, though, which would indicate such a mechanism.
-Sometimes, however, the off by 2 case returns $12345678!
-*/
-static void gpu_opcode_load(void)
-{
-#ifdef GPU_DIS_LOAD
-	if (doGPUDis)
-		WriteLog("%06X: LOAD   (R%02u), R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-#ifdef GPU_CORRECT_ALIGNMENT
-	uint32_t mask[4] = { 0x00000000, 0xFF000000, 0xFFFF0000, 0xFFFFFF00 };
-//	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
-		RN = GPUReadLong(RM & 0xFFFFFFFC, GPU);
-//		RN = GPUReadLong(RM & 0x00FFFFFC, GPU);
-//	else
-//		RN = GPUReadLong(RM, GPU);
-	// Simulate garbage in unaligned reads...
-//seems that this behavior is different in GPU mem vs. main mem...
-//	if ((RM < 0xF03000) || (RM > 0xF0BFFF))
-//		RN |= mask[RM & 0x03];
-#else
-	RN = GPUReadLong(RM, GPU);
-#endif
-#ifdef GPU_DIS_LOAD
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_loadp(void)
-{
-#ifdef GPU_CORRECT_ALIGNMENT
-	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
-	{
-		gpu_hidata = GPUReadLong((RM & 0xFFFFFFF8) + 0, GPU);
-		RN		   = GPUReadLong((RM & 0xFFFFFFF8) + 4, GPU);
-	}
-	else
-	{
-		gpu_hidata = GPUReadLong(RM + 0, GPU);
-		RN		   = GPUReadLong(RM + 4, GPU);
-	}
-#else
-	gpu_hidata = GPUReadLong(RM + 0, GPU);
-	RN		   = GPUReadLong(RM + 4, GPU);
-#endif
-}
-
-
-static void gpu_opcode_load_r14_indexed(void)
-{
-#ifdef GPU_DIS_LOAD14I
-	if (doGPUDis)
-		WriteLog("%06X: LOAD   (R14+$%02X), R%02u [NCZ:%u%u%u, R14+$%02X=%08X, R%02u=%08X] -> ", gpu_pc-2, gpu_convert_zero[IMM_1] << 2, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, gpu_convert_zero[IMM_1] << 2, gpu_reg[14]+(gpu_convert_zero[IMM_1] << 2), IMM_2, RN);
-#endif
-#ifdef GPU_CORRECT_ALIGNMENT
-	uint32_t address = gpu_reg[14] + (gpu_convert_zero[IMM_1] << 2);
-
-	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
-		RN = GPUReadLong(address & 0xFFFFFFFC, GPU);
-	else
-		RN = GPUReadLong(address, GPU);
-#else
-	RN = GPUReadLong(gpu_reg[14] + (gpu_convert_zero[IMM_1] << 2), GPU);
-#endif
-#ifdef GPU_DIS_LOAD14I
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_load_r15_indexed(void)
-{
-#ifdef GPU_DIS_LOAD15I
-	if (doGPUDis)
-		WriteLog("%06X: LOAD   (R15+$%02X), R%02u [NCZ:%u%u%u, R15+$%02X=%08X, R%02u=%08X] -> ", gpu_pc-2, gpu_convert_zero[IMM_1] << 2, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, gpu_convert_zero[IMM_1] << 2, gpu_reg[15]+(gpu_convert_zero[IMM_1] << 2), IMM_2, RN);
-#endif
-#ifdef GPU_CORRECT_ALIGNMENT
-	uint32_t address = gpu_reg[15] + (gpu_convert_zero[IMM_1] << 2);
-
-	if ((RM >= 0xF03000) && (RM <= 0xF03FFF))
-		RN = GPUReadLong(address & 0xFFFFFFFC, GPU);
-	else
-		RN = GPUReadLong(address, GPU);
-#else
-	RN = GPUReadLong(gpu_reg[15] + (gpu_convert_zero[IMM_1] << 2), GPU);
-#endif
-#ifdef GPU_DIS_LOAD15I
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_movei(void)
-{
-#ifdef GPU_DIS_MOVEI
-	if (doGPUDis)
-		WriteLog("%06X: MOVEI  #$%08X, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, (uint32_t)GPUReadWord(gpu_pc) | ((uint32_t)GPUReadWord(gpu_pc + 2) << 16), IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	// This instruction is followed by 32-bit value in LSW / MSW format...
-	RN = (uint32_t)GPUReadWord(gpu_pc, GPU) | ((uint32_t)GPUReadWord(gpu_pc + 2, GPU) << 16);
-	gpu_pc += 4;
-#ifdef GPU_DIS_MOVEI
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_moveta(void)
-{
-#ifdef GPU_DIS_MOVETA
-	if (doGPUDis)
-		WriteLog("%06X: MOVETA R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u(alt)=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, ALTERNATE_RN);
-#endif
-	ALTERNATE_RN = RM;
-#ifdef GPU_DIS_MOVETA
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u(alt)=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, ALTERNATE_RN);
-#endif
-}
-
-
-static void gpu_opcode_movefa(void)
-{
-#ifdef GPU_DIS_MOVEFA
-	if (doGPUDis)
-		WriteLog("%06X: MOVEFA R%02u, R%02u [NCZ:%u%u%u, R%02u(alt)=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, ALTERNATE_RM, IMM_2, RN);
-#endif
-	RN = ALTERNATE_RM;
-#ifdef GPU_DIS_MOVEFA
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u(alt)=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, ALTERNATE_RM, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_move(void)
-{
-#ifdef GPU_DIS_MOVE
-	if (doGPUDis)
-		WriteLog("%06X: MOVE   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	RN = RM;
-#ifdef GPU_DIS_MOVE
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_moveq(void)
-{
-#ifdef GPU_DIS_MOVEQ
-	if (doGPUDis)
-		WriteLog("%06X: MOVEQ  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	RN = IMM_1;
-#ifdef GPU_DIS_MOVEQ
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_resmac(void)
-{
-	RN = gpu_acc;
-}
-
-
-static void gpu_opcode_imult(void)
-{
-#ifdef GPU_DIS_IMULT
-	if (doGPUDis)
-		WriteLog("%06X: IMULT  R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	RN = (int16_t)RN * (int16_t)RM;
-	SET_ZN(RN);
-#ifdef GPU_DIS_IMULT
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_mult(void)
-{
-#ifdef GPU_DIS_MULT
-	if (doGPUDis)
-		WriteLog("%06X: MULT   R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	RN = (uint16_t)RM * (uint16_t)RN;
-//	RN = (RM & 0xFFFF) * (RN & 0xFFFF);
-	SET_ZN(RN);
-#ifdef GPU_DIS_MULT
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_bclr(void)
-{
-#ifdef GPU_DIS_BCLR
-	if (doGPUDis)
-		WriteLog("%06X: BCLR   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	uint32_t res = RN & ~(1 << IMM_1);
-	RN = res;
-	SET_ZN(res);
-#ifdef GPU_DIS_BCLR
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_btst(void)
-{
-#ifdef GPU_DIS_BTST
-	if (doGPUDis)
-		WriteLog("%06X: BTST   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	gpu_flag_z = (~RN >> IMM_1) & 1;
-#ifdef GPU_DIS_BTST
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_bset(void)
-{
-#ifdef GPU_DIS_BSET
-	if (doGPUDis)
-		WriteLog("%06X: BSET   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	uint32_t res = RN | (1 << IMM_1);
-	RN = res;
-	SET_ZN(res);
-#ifdef GPU_DIS_BSET
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_imacn(void)
-{
-	uint32_t res = (int16_t)RM * (int16_t)(RN);
-	gpu_acc += res;
-}
-
-
-static void gpu_opcode_mtoi(void)
-{
-	uint32_t _RM = RM;
-	uint32_t res = RN = (((int32_t)_RM >> 8) & 0xFF800000) | (_RM & 0x007FFFFF);
-	SET_ZN(res);
-}
-
-
-static void gpu_opcode_normi(void)
-{
-	uint32_t _RM = RM;
-	uint32_t res = 0;
-
-	if (_RM)
-	{
-		while ((_RM & 0xFFC00000) == 0)
-		{
-			_RM <<= 1;
-			res--;
-		}
-		while ((_RM & 0xFF800000) != 0)
-		{
-			_RM >>= 1;
-			res++;
-		}
-	}
-	RN = res;
-	SET_ZN(res);
-}
-
-static void gpu_opcode_mmult(void)
-{
-	int count	= gpu_matrix_control & 0x0F;	// Matrix width
-	uint32_t addr = gpu_pointer_to_matrix;		// In the GPU's RAM
-	int64_t accum = 0;
-	uint32_t res;
-
-	if (gpu_matrix_control & 0x10)				// Column stepping
-	{
-		for(int i=0; i<count; i++)
-		{
-			int16_t a;
-			if (i & 0x01)
-				a = (int16_t)((gpu_alternate_reg[IMM_1 + (i >> 1)] >> 16) & 0xFFFF);
-			else
-				a = (int16_t)(gpu_alternate_reg[IMM_1 + (i >> 1)] & 0xFFFF);
-
-			int16_t b = ((int16_t)GPUReadWord(addr + 2, GPU));
-			accum += a * b;
-			addr += 4 * count;
-		}
-	}
-	else										// Row stepping
-	{
-		for(int i=0; i<count; i++)
-		{
-			int16_t a;
-			if (i & 0x01)
-				a = (int16_t)((gpu_alternate_reg[IMM_1 + (i >> 1)] >> 16) & 0xFFFF);
-			else
-				a = (int16_t)(gpu_alternate_reg[IMM_1 + (i >> 1)] & 0xFFFF);
-
-			int16_t b = ((int16_t)GPUReadWord(addr + 2, GPU));
-			accum += a * b;
-			addr += 4;
-		}
-	}
-	RN = res = (int32_t)accum;
-	// carry flag to do (out of the last add)
-	SET_ZN(res);
-}
-
-
-static void gpu_opcode_abs(void)
-{
-#ifdef GPU_DIS_ABS
-	if (doGPUDis)
-		WriteLog("%06X: ABS    R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	gpu_flag_c = RN >> 31;
-	if (RN == 0x80000000)
-	//Is 0x80000000 a positive number? If so, then we need to set C to 0 as well!
-		gpu_flag_n = 1, gpu_flag_z = 0;
-	else
-	{
-		if (gpu_flag_c)
-			RN = -RN;
-		gpu_flag_n = 0; SET_FLAG_Z(RN);
-	}
-#ifdef GPU_DIS_ABS
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_div(void)	// RN / RM
-{
-#ifdef GPU_DIS_DIV
-	if (doGPUDis)
-		WriteLog("%06X: DIV    R%02u, R%02u (%s) [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, (gpu_div_control & 0x01 ? "16.16" : "32"), gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-#if 0
-	if (RM)
-	{
-		if (gpu_div_control & 0x01)		// 16.16 division
-		{
-			gpu_remain = ((uint64_t)RN << 16) % RM;
-			RN = ((uint64_t)RN << 16) / RM;
-		}
-		else
-		{
-			// We calculate the remainder first because we destroy RN after
-			// this by assigning it to itself.
-			gpu_remain = RN % RM;
-			RN = RN / RM;
-		}
-	}
-	else
-	{
-		// This is what happens according to SCPCD. NYAN!
-		RN = 0xFFFFFFFF;
-		gpu_remain = 0;
-	}
-#else
-	// Real algorithm, courtesy of SCPCD: NYAN!
-	uint32_t q = RN;
-	uint32_t r = 0;
-
-	// If 16.16 division, stuff top 16 bits of RN into remainder and put the
-	// bottom 16 of RN in top 16 of quotient
-	if (gpu_div_control & 0x01)
-		q <<= 16, r = RN >> 16;
-
-	for(int i=0; i<32; i++)
-	{
-//		uint32_t sign = (r >> 31) & 0x01;
-		uint32_t sign = r & 0x80000000;
-		r = (r << 1) | ((q >> 31) & 0x01);
-		r += (sign ? RM : -RM);
-		q = (q << 1) | (((~r) >> 31) & 0x01);
-	}
-
-	RN = q;
-	gpu_remain = r;
-#endif
-
-#ifdef GPU_DIS_DIV
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] Remainder: %08X\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN, gpu_remain);
-#endif
-}
-
-
-static void gpu_opcode_imultn(void)
-{
-	uint32_t res = (int32_t)((int16_t)RN * (int16_t)RM);
-	gpu_acc = (int32_t)res;
-	SET_FLAG_Z(res);
-	SET_FLAG_N(res);
-}
-
-
-static void gpu_opcode_neg(void)
-{
-#ifdef GPU_DIS_NEG
-	if (doGPUDis)
-		WriteLog("%06X: NEG    R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	uint32_t res = -RN;
-	SET_ZNC_SUB(0, RN, res);
-	RN = res;
-#ifdef GPU_DIS_NEG
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_shlq(void)
-{
-#ifdef GPU_DIS_SHLQ
-	if (doGPUDis)
-		WriteLog("%06X: SHLQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, 32 - IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-// Was a bug here...
-// (Look at Aaron's code: If r1 = 32, then 32 - 32 = 0 which is wrong!)
-	int32_t r1 = 32 - IMM_1;
-	uint32_t res = RN << r1;
-	SET_ZN(res); gpu_flag_c = (RN >> 31) & 1;
-	RN = res;
-#ifdef GPU_DIS_SHLQ
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_shrq(void)
-{
-#ifdef GPU_DIS_SHRQ
-	if (doGPUDis)
-		WriteLog("%06X: SHRQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, gpu_convert_zero[IMM_1], IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	int32_t r1 = gpu_convert_zero[IMM_1];
-	uint32_t res = RN >> r1;
-	SET_ZN(res); gpu_flag_c = RN & 1;
-	RN = res;
-#ifdef GPU_DIS_SHRQ
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_ror(void)
-{
-#ifdef GPU_DIS_ROR
-	if (doGPUDis)
-		WriteLog("%06X: ROR    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	uint32_t r1 = RM & 0x1F;
-	uint32_t res = (RN >> r1) | (RN << (32 - r1));
-	SET_ZN(res); gpu_flag_c = (RN >> 31) & 1;
-	RN = res;
-#ifdef GPU_DIS_ROR
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_rorq(void)
-{
-#ifdef GPU_DIS_RORQ
-	if (doGPUDis)
-		WriteLog("%06X: RORQ   #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, gpu_convert_zero[IMM_1], IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	uint32_t r1 = gpu_convert_zero[IMM_1 & 0x1F];
-	uint32_t r2 = RN;
-	uint32_t res = (r2 >> r1) | (r2 << (32 - r1));
-	RN = res;
-	SET_ZN(res); gpu_flag_c = (r2 >> 31) & 0x01;
-#ifdef GPU_DIS_RORQ
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_sha(void)
-{
-/*	int dreg = jaguar.op & 31;
-	int32_t r1 = (int32_t)jaguar.r[(jaguar.op >> 5) & 31];
-	uint32_t r2 = jaguar.r[dreg];
-	uint32_t res;
-
-	CLR_ZNC;
-	if (r1 < 0)
-	{
-		res = (r1 <= -32) ? 0 : (r2 << -r1);
-		jaguar.FLAGS |= (r2 >> 30) & 2;
-	}
-	else
-	{
-		res = (r1 >= 32) ? ((int32_t)r2 >> 31) : ((int32_t)r2 >> r1);
-		jaguar.FLAGS |= (r2 << 1) & 2;
-	}
-	jaguar.r[dreg] = res;
-	SET_ZN(res);*/
-
-#ifdef GPU_DIS_SHA
-	if (doGPUDis)
-		WriteLog("%06X: SHA    R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	uint32_t res;
-
-	if ((int32_t)RM < 0)
-	{
-		res = ((int32_t)RM <= -32) ? 0 : (RN << -(int32_t)RM);
-		gpu_flag_c = RN >> 31;
-	}
-	else
-	{
-		res = ((int32_t)RM >= 32) ? ((int32_t)RN >> 31) : ((int32_t)RN >> (int32_t)RM);
-		gpu_flag_c = RN & 0x01;
-	}
-	RN = res;
-	SET_ZN(res);
-#ifdef GPU_DIS_SHA
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-
-/*	int32_t sRM=(int32_t)RM;
-	uint32_t _RN=RN;
-
-	if (sRM<0)
-	{
-		uint32_t shift=-sRM;
-		if (shift>=32) shift=32;
-		gpu_flag_c=(_RN&0x80000000)>>31;
-		while (shift)
-		{
-			_RN<<=1;
-			shift--;
-		}
-	}
-	else
-	{
-		uint32_t shift=sRM;
-		if (shift>=32) shift=32;
-		gpu_flag_c=_RN&0x1;
-		while (shift)
-		{
-			_RN=((int32_t)_RN)>>1;
-			shift--;
-		}
-	}
-	RN=_RN;
-	SET_FLAG_Z(_RN);
-	SET_FLAG_N(_RN);*/
-}
-
-
-static void gpu_opcode_sharq(void)
-{
-#ifdef GPU_DIS_SHARQ
-	if (doGPUDis)
-		WriteLog("%06X: SHARQ  #%u, R%02u [NCZ:%u%u%u, R%02u=%08X] -> ", gpu_pc-2, gpu_convert_zero[IMM_1], IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-	uint32_t res = (int32_t)RN >> gpu_convert_zero[IMM_1];
-	SET_ZN(res); gpu_flag_c = RN & 0x01;
-	RN = res;
-#ifdef GPU_DIS_SHARQ
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_2, RN);
-#endif
-}
-
-
-static void gpu_opcode_sh(void)
-{
-#ifdef GPU_DIS_SH
-	if (doGPUDis)
-		WriteLog("%06X: SH     R%02u, R%02u [NCZ:%u%u%u, R%02u=%08X, R%02u=%08X] -> ", gpu_pc-2, IMM_1, IMM_2, gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
-	if (RM & 0x80000000)		// Shift left
-	{
-		gpu_flag_c = RN >> 31;
-		RN = ((int32_t)RM <= -32 ? 0 : RN << -(int32_t)RM);
-	}
-	else						// Shift right
-	{
-		gpu_flag_c = RN & 0x01;
-		RN = (RM >= 32 ? 0 : RN >> RM);
-	}
-	SET_ZN(RN);
-#ifdef GPU_DIS_SH
-	if (doGPUDis)
-		WriteLog("[NCZ:%u%u%u, R%02u=%08X, R%02u=%08X]\n", gpu_flag_n, gpu_flag_c, gpu_flag_z, IMM_1, RM, IMM_2, RN);
-#endif
+	return GPURISC::Run(cycles);
 }
 
 
@@ -6,15 +6,20 @@
 #define __GPU_H__
 
 //#include "types.h"
+#include "context.h"
+#include "riscjit.h"
 #include "vjag_memory.h"
+#include "state.h"
 
 #define GPU_CONTROL_RAM_BASE    0x00F02100
 #define GPU_WORK_RAM_BASE		0x00F03000
 
 void GPUInit(void);
+void GPUFillTables(void);
 void GPUReset(void);
-void GPUExec(int32_t);
+int32_t GPUExec(int32_t);
 void GPUDone(void);
+void GPUStateSync(StateBuffer * sb);
 void GPUUpdateRegisterBanks(void);
 void GPUHandleIRQs(void);
 void GPUSetIRQLine(int irqline, int state);
@@ -35,8 +40,48 @@ uint32_t GPUReadPC(void);
 
 enum { GPUIRQ_CPU = 0, GPUIRQ_DSP, GPUIRQ_TIMER, GPUIRQ_OBJECT, GPUIRQ_BLITTER };
 
+// What GPU.CPP knows about the machine (see context.h)
+
+#define GPU_JIT_STATES		10
+
+struct GPUState
+{
+	uint8_t gpu_ram_8[0x1000];
+	uint32_t gpu_pc;
+	uint32_t gpu_acc;
+	uint32_t gpu_remain;
+	uint32_t gpu_hidata;
+	uint32_t gpu_flags;
+	uint32_t gpu_matrix_control;
+	uint32_t gpu_pointer_to_matrix;
+	uint32_t gpu_data_organization;
+	uint32_t gpu_control;
+	uint32_t gpu_div_control;
+	// There is a distinct advantage to having these separated out--there's no need to clear
+	// a bit before writing a result. I.e., if the result of an operation leaves a zero in
+	// the carry flag, you don't have to zero gpu_flag_c before you can write that zero!
+	// Z & N are kept as the result that set them (see risc.h).
+	uint64_t gpu_flag_zn;
+	uint8_t gpu_flag_c;
+	uint32_t gpu_reg_bank_0[32];
+	uint32_t gpu_reg_bank_1[32];
+	uint32_t * gpu_reg;
+	uint32_t * gpu_alternate_reg;
+	uint32_t gpu_opcode_first_parameter;
+	uint32_t gpu_opcode_second_parameter;
+	uint32_t gpu_opcode_use[64];
+	uint32_t gpu_in_exec;
+	uint32_t gpu_releaseTimeSlice_flag;
+	RISCDecodedOp gpu_decode_cache[0x1000 / 2];
+	RISCJitState gpu_jit_state[GPU_JIT_STATES];
+	RISCJitCore gpu_jit;
+};
+
 // Exported vars
 
-extern uint32_t gpu_reg_bank_0[], gpu_reg_bank_1[];
+#define gpu_reg_bank_0		(CONTEXT(gpu).gpu_reg_bank_0)
+#define gpu_reg_bank_1		(CONTEXT(gpu).gpu_reg_bank_1)
+#define gpu_opcode_use		(CONTEXT(gpu).gpu_opcode_use)
+extern const char * gpu_opcode_str[];
 
 #endif	// __GPU_H__
@@ -22,6 +22,7 @@
 #include "blitter.h"
 #include "cdrom.h"
 #include "dac.h"
+#include "dspthread.h"
 #include "dsp.h"
 #include "eeprom.h"
 #include "event.h"
@@ -32,6 +33,7 @@
 #include "m68000/m68kinterface.h"
 //#include "vjag_memory.h"
 #include "mmu.h"
+#include "profile.h"
 #include "settings.h"
 #include "tom.h"
 #include <string.h>
@@ -43,10 +45,20 @@
 //#define ABORT_ON_UNMAPPED_MEMORY_ACCESS
 //#define ABORT_ON_ILLEGAL_INSTRUCTIONS
 //#define ABORT_ON_OFFICIAL_ILLEGAL_INSTRUCTION
-#define CPU_DEBUG_MEMORY
 //#define LOG_CD_BIOS_CALLS
+// The memory watching, tracing & breakpoint hooks sit in the middle of every
+// 68K memory access, so only debug builds (make debug) get them
+#ifdef DEBUG_HOOKS
+#define CPU_DEBUG_MEMORY
 #define CPU_DEBUG_TRACING
 #define ALPINE_FUNCTIONS
+#endif
+
+#ifdef ALPINE_FUNCTIONS
+#define BPM_ACTIVE	bpmActive
+#else
+#define BPM_ACTIVE	false
+#endif
 
 // Private function prototypes
 
@@ -64,16 +76,38 @@ extern int effect_start;
 extern int effect_start2, effect_start3, effect_start4, effect_start5, effect_start6;
 #endif
 
-// Really, need to include memory.h for this, but it might interfere with some stuff...
-extern uint8_t jagMemSpace[];
-
 // Internal variables
 
-uint32_t jaguar_active_memory_dumps = 0;
+#ifndef MULTI_INSTANCE
+struct JaguarState jaguarState;
+#endif
 
-uint32_t jaguarMainROMCRC32, jaguarROMSize, jaguarRunAddress;
-bool jaguarCartInserted = false;
-bool lowerField = false;
+#define lowerField				(CONTEXT(jaguar).lowerField)
+#define m68kReadPage			(CONTEXT(jaguar).m68kReadPage)
+#define randomSeed				(CONTEXT(jaguar).randomSeed)
+#define halflineCycles			(CONTEXT(jaguar).halflineCycles)
+#define m68kCyclesAhead			(CONTEXT(jaguar).m68kCyclesAhead)
+#define gpuCyclesAhead			(CONTEXT(jaguar).gpuCyclesAhead)
+#define frameDone				(CONTEXT(jaguar).frameDone)
+#define renderFrame				(CONTEXT(jaguar).renderFrame)
+#define pcQueue					(CONTEXT(jaguar).pcQueue)
+#define a0Queue					(CONTEXT(jaguar).a0Queue)
+#define a1Queue					(CONTEXT(jaguar).a1Queue)
+#define a2Queue					(CONTEXT(jaguar).a2Queue)
+#define a3Queue					(CONTEXT(jaguar).a3Queue)
+#define a4Queue					(CONTEXT(jaguar).a4Queue)
+#define a5Queue					(CONTEXT(jaguar).a5Queue)
+#define a6Queue					(CONTEXT(jaguar).a6Queue)
+#define a7Queue					(CONTEXT(jaguar).a7Queue)
+#define d0Queue					(CONTEXT(jaguar).d0Queue)
+#define d1Queue					(CONTEXT(jaguar).d1Queue)
+#define d2Queue					(CONTEXT(jaguar).d2Queue)
+#define d3Queue					(CONTEXT(jaguar).d3Queue)
+#define d4Queue					(CONTEXT(jaguar).d4Queue)
+#define d5Queue					(CONTEXT(jaguar).d5Queue)
+#define d6Queue					(CONTEXT(jaguar).d6Queue)
+#define d7Queue					(CONTEXT(jaguar).d7Queue)
+#define pcQPtr					(CONTEXT(jaguar).pcQPtr)
 
 #ifdef CPU_DEBUG_MEMORY
 uint8_t writeMemMax[0x400000], writeMemMin[0x400000];
@@ -81,30 +115,6 @@ uint8_t readMem[0x400000];
 uint32_t returnAddr[4000], raPtr = 0xFFFFFFFF;
 #endif
 
-uint32_t pcQueue[0x400];
-uint32_t a0Queue[0x400];
-uint32_t a1Queue[0x400];
-uint32_t a2Queue[0x400];
-uint32_t a3Queue[0x400];
-uint32_t a4Queue[0x400];
-uint32_t a5Queue[0x400];
-uint32_t a6Queue[0x400];
-uint32_t a7Queue[0x400];
-uint32_t d0Queue[0x400];
-uint32_t d1Queue[0x400];
-uint32_t d2Queue[0x400];
-uint32_t d3Queue[0x400];
-uint32_t d4Queue[0x400];
-uint32_t d5Queue[0x400];
-uint32_t d6Queue[0x400];
-uint32_t d7Queue[0x400];
-uint32_t pcQPtr = 0;
-bool startM68KTracing = false;
-
-// Breakpoint on memory access vars (exported)
-bool bpmActive = false;
-uint32_t bpmAddress1;
-
 
 //
 // Callback function to detect illegal instructions
@@ -113,6 +123,7 @@ void GPUDumpDisassembly(void);
 void GPUDumpRegisters(void);
 static bool start = false;
 
+#ifdef M68K_HOOK_FUNCTION
 void M68KInstructionHook(void)
 {
 	uint32_t m68kPC = m68k_get_reg(NULL, M68K_REG_PC);
@@ -462,6 +473,7 @@ CD_switch::	-> $306C
 	}//*/
 #endif
 }
+#endif
 
 #if 0
 Now here be dragons...
@@ -750,6 +762,8 @@ void WriteByte(uint32_t address, uint8_t byte, uint32_t who/*=UNKNOWN*/)
 	else if (address <= 0xF1FFFF)
 //		;	// Do nothing
 	{
+		DSPThreadTouch(address);
+
 #ifdef JERRY_DEBUG
 		WriteLog("jerry: writing byte %.2x at 0x%.6x\n", byte, address);
 #endif
@@ -1022,6 +1036,60 @@ int irq_ack_handler(int level)
 
 //#define USE_NEW_MMU
 
+#if defined(USE_NEW_MMU) && defined(MULTI_INSTANCE)
+#error "The new MMU only knows about a single instance's memory (see mmu.cpp)"
+#endif
+
+//
+// 68K memory page table. Each 64K page of the 68K's address space either
+// points straight at host memory (RAM, cartridge ROM & BIOS) or is NULL, in
+// which case the read goes thru the regular handlers (I/O, unmapped space
+// and the last ROM page, which is shared with the CD-ROM registers at $DFFF00).
+// Writes don't need a table: RAM is the only thing they can go straight to,
+// and checking for it is cheaper than looking up the page.
+//
+
+static void M68KBuildPageTables(void)
+{
+	for(uint32_t page=0; page<0x100; page++)
+	{
+		// Note that the Jaguar only has 2M of RAM, not 4!
+		if (page <= 0x1F || (page >= 0x80 && page <= 0xDE) || (page >= 0xE0 && page <= 0xE3))
+			m68kReadPage[page] = &jagMemSpace[page << 16];
+		else
+			m68kReadPage[page] = NULL;
+	}
+}
+
+
+//
+// The mapped pages are all in jagMemSpace, one after the other, so a run of
+// them is one block of host memory that 68K code can be fetched straight from
+//
+unsigned char * M68KFetchWindow(unsigned int address, unsigned int * start, unsigned int * size)
+{
+#ifndef USE_NEW_MMU
+	uint32_t first = (address >> 16) & 0xFF, last = first;
+
+	// Instruction fetches have to go thru the handlers for the breakpoint to see them
+	if (!m68kReadPage[first] || BPM_ACTIVE)
+		return NULL;
+
+	while (first > 0x00 && m68kReadPage[first - 1])
+		first--;
+
+	while (last < 0xFF && m68kReadPage[last + 1])
+		last++;
+
+	*start = first << 16;
+	*size = (last - first + 1) << 16;
+	return m68kReadPage[first];
+#else
+	return NULL;
+#endif
+}
+
+
 unsigned int m68k_read_memory_8(unsigned int address)
 {
 #ifdef ALPINE_FUNCTIONS
@@ -1032,6 +1100,7 @@ unsigned int m68k_read_memory_8(unsigned int address)
 
 	// Musashi does this automagically for you, UAE core does not :-P
 	address &= 0x00FFFFFF;
+	ProfileRead(address);
 #ifdef CPU_DEBUG_MEMORY
 	// Note that the Jaguar only has 2M of RAM, not 4!
 	if ((address >= 0x000000) && (address <= 0x1FFFFF))
@@ -1046,6 +1115,11 @@ unsigned int m68k_read_memory_8(unsigned int address)
 		|| address == 0x1AF05E)
 		WriteLog("[RM8  PC=%08X] Addr: %08X, val: %02X\n", m68k_get_reg(NULL, M68K_REG_PC), address, jaguar_mainRam[address]);//*/
 #ifndef USE_NEW_MMU
+	uint8_t * page = m68kReadPage[address >> 16];
+
+	if (page)
+		return page[address & 0xFFFF];
+
 	unsigned int retVal = 0;
 
 	// Note that the Jaguar only has 2M of RAM, not 4!
@@ -1091,6 +1165,7 @@ unsigned int m68k_read_memory_16(unsigned int address)
 
 	// Musashi does this automagically for you, UAE core does not :-P
 	address &= 0x00FFFFFF;
+	ProfileRead(address);
 #ifdef CPU_DEBUG_MEMORY
 /*	if ((address >= 0x000000) && (address <= 0x3FFFFE))
 	{
@@ -1152,6 +1227,12 @@ unsigned int m68k_read_memory_16(unsigned int address)
 		|| address == 0x1AF05E)
 		WriteLog("[RM16  PC=%08X] Addr: %08X, val: %04X\n", m68k_get_reg(NULL, M68K_REG_PC), address, GET16(jaguar_mainRam, address));//*/
 #ifndef USE_NEW_MMU
+	// Odd addresses can straddle a page, so they take the long way around
+	uint8_t * page = m68kReadPage[address >> 16];
+
+	if (page && !(address & 0x01))
+		return GET16(page, address & 0xFFFF);
+
     unsigned int retVal = 0;
 
 	// Note that the Jaguar only has 2M of RAM, not 4!
@@ -1205,6 +1286,15 @@ unsigned int m68k_read_memory_32(unsigned int address)
 
 //WriteLog("--> [RM32]\n");
 #ifndef USE_NEW_MMU
+	uint8_t * page = m68kReadPage[address >> 16];
+
+	// Anything else is two word reads, which get counted on their own
+	if (page && !(address & 0x01) && ((address & 0xFFFF) <= 0xFFFC) && !BPM_ACTIVE)
+	{
+		ProfileRead(address);
+		return GET32(page, address & 0xFFFF);
+	}
+
     return (m68k_read_memory_16(address) << 16) | m68k_read_memory_16(address + 2);
 #else
 	return MMURead32(address, M68K);
@@ -1222,6 +1312,7 @@ void m68k_write_memory_8(unsigned int address, unsigned int value)
 
 	// Musashi does this automagically for you, UAE core does not :-P
 	address &= 0x00FFFFFF;
+	ProfileWrite(address);
 #ifdef CPU_DEBUG_MEMORY
 	// Note that the Jaguar only has 2M of RAM, not 4!
 	if ((address >= 0x000000) && (address <= 0x1FFFFF))
@@ -1253,8 +1344,11 @@ void m68k_write_memory_8(unsigned int address, unsigned int value)
 
 #ifndef USE_NEW_MMU
 	// Note that the Jaguar only has 2M of RAM, not 4!
-	if ((address >= 0x000000) && (address <= 0x1FFFFF))
+	if (address <= 0x1FFFFF)
+	{
 		jaguarMainRAM[address] = value;
+		STATE_MARK_RAM_DIRTY(address);
+	}
 	else if ((address >= 0xDFFF00) && (address <= 0xDFFFFF))
 		CDROMWriteByte(address, value, M68K);
 	else if ((address >= 0xF00000) && (address <= 0xF0FFFF))
@@ -1279,6 +1373,7 @@ void m68k_write_memory_16(unsigned int address, unsigned int value)
 
 	// Musashi does this automagically for you, UAE core does not :-P
 	address &= 0x00FFFFFF;
+	ProfileWrite(address);
 #ifdef CPU_DEBUG_MEMORY
 	// Note that the Jaguar only has 2M of RAM, not 4!
 	if ((address >= 0x000000) && (address <= 0x1FFFFE))
@@ -1337,11 +1432,17 @@ if (address == 0xF02110)
 
 #ifndef USE_NEW_MMU
 	// Note that the Jaguar only has 2M of RAM, not 4!
-	if ((address >= 0x000000) && (address <= 0x1FFFFE))
+	if (address <= 0x1FFFFE)
 	{
 /*		jaguar_mainRam[address] = value >> 8;
 		jaguar_mainRam[address + 1] = value & 0xFF;*/
-		SET16(jaguarMainRAM, address, value);
+		uint8_t * ram = jaguarMainRAM;
+		SET16(ram, address, value);
+		STATE_MARK_RAM_DIRTY(address);
+
+		// An odd address can straddle two dirty pages
+		if (address & 0x01)
+			STATE_MARK_RAM_DIRTY(address + 1);
 	}
 	else if ((address >= 0xDFFF00) && (address <= 0xDFFFFE))
 		CDROMWriteWord(address, value, M68K);
@@ -1397,6 +1498,20 @@ if (address == 0xF03214 && value == 0x88E30047)
 }//*/
 
 #ifndef USE_NEW_MMU
+	if (address <= 0x1FFFFC && !(address & 0x01) && !BPM_ACTIVE)
+	{
+		// (A local copy of the pointer saves reloading it for every byte)
+		uint8_t * ram = jaguarMainRAM;
+		ProfileWrite(address);
+		SET32(ram, address, value);
+		STATE_MARK_RAM_DIRTY(address);
+
+		// The second half can land in the next dirty page
+		if ((address & ((1 << STATE_PAGE_SHIFT) - 1)) > (1 << STATE_PAGE_SHIFT) - 4)
+			STATE_MARK_RAM_DIRTY(address + 3);
+		return;
+	}
+
 	m68k_write_memory_16(address, value >> 16);
 	m68k_write_memory_16(address + 2, value & 0xFFFF);
 #else
@@ -1602,11 +1717,21 @@ uint8_t JaguarReadByte(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 	uint8_t data = 0x00;
 	offset &= 0xFFFFFF;
 
+	if (dspThreadBusy && DSPThreadForwardsRead(offset))
+		return DSPThreadRead(offset, 1, who);
+
+	ProfileRead(offset);
+
 	// First 2M is mirrored in the $0 - $7FFFFF range
 	if (offset < 0x800000)
-		data = jaguarMainRAM[offset & 0x1FFFFF];
+	{
+		const uint8_t * ram = (dspThreadBusy ? DSPThreadRAM() : NULL);
+		data = (ram ? ram : jaguarMainRAM)[offset & 0x1FFFFF];
+	}
 	else if ((offset >= 0x800000) && (offset < 0xDFFF00))
 		data = jaguarMainROM[offset - 0x800000];
+	else if (blitterShadowPass && who == BLITTER && BlitterShadowAccess(offset, false))
+		data = 0x00;
 	else if ((offset >= 0xDFFF00) && (offset <= 0xDFFFFF))
 		data = CDROMReadByte(offset, who);
 	else if ((offset >= 0xE00000) && (offset < 0xE40000))
@@ -1628,16 +1753,28 @@ uint16_t JaguarReadWord(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 {
 	offset &= 0xFFFFFF;
 
+	if (dspThreadBusy && DSPThreadForwardsRead(offset))
+		return DSPThreadRead(offset, 2, who);
+
+	ProfileRead(offset);
+
 	// First 2M is mirrored in the $0 - $7FFFFF range
 	if (offset < 0x800000)
 	{
-		return (jaguarMainRAM[(offset+0) & 0x1FFFFF] << 8) | jaguarMainRAM[(offset+1) & 0x1FFFFF];
+		const uint8_t * ram = (dspThreadBusy ? DSPThreadRAM() : NULL);
+
+		if (!ram)
+			ram = jaguarMainRAM;
+
+		return (ram[(offset+0) & 0x1FFFFF] << 8) | ram[(offset+1) & 0x1FFFFF];
 	}
 	else if ((offset >= 0x800000) && (offset < 0xDFFF00))
 	{
 		offset -= 0x800000;
 		return (jaguarMainROM[offset+0] << 8) | jaguarMainROM[offset+1];
 	}
+	else if (blitterShadowPass && who == BLITTER && BlitterShadowAccess(offset, false))
+		return 0x0000;
 //	else if ((offset >= 0xDFFF00) && (offset < 0xDFFF00))
 	else if ((offset >= 0xDFFF00) && (offset <= 0xDFFFFE))
 		return CDROMReadWord(offset, who);
@@ -1663,14 +1800,22 @@ void JaguarWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 	if (offset >= 0x18FA70 && offset < (0x18FA70 + 8000))
 		WriteLog("JWB: Byte %02X written at %08X by %s\n", data, offset, whoName[who]);//*/
 
+	// The DSP thread holds on to its writes to the rest of the system
+	if (dspThreadBusy && DSPThreadDeferWrite(offset, data, 1, who))
+		return;
+
 	offset &= 0xFFFFFF;
+	ProfileWrite(offset);
 
 	// First 2M is mirrored in the $0 - $7FFFFF range
 	if (offset < 0x800000)
 	{
 		jaguarMainRAM[offset & 0x1FFFFF] = data;
+		STATE_MARK_RAM_DIRTY(offset);
 		return;
 	}
+	else if (blitterShadowPass && who == BLITTER && BlitterShadowAccess(offset, true))
+		return;
 	else if ((offset >= 0xDFFF00) && (offset <= 0xDFFFFF))
 	{
 		CDROMWriteByte(offset, data, who);
@@ -1691,7 +1836,6 @@ void JaguarWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 }
 
 
-uint32_t starCount;
 void JaguarWriteWord(uint32_t offset, uint16_t data, uint32_t who/*=UNKNOWN*/)
 {
 /*	if (offset >= 0x4E00 && offset < 0x4E04)
@@ -1709,7 +1853,11 @@ if (offset == 0x0102)//64*4)
 /*if (offset >= 0x2C00 && offset <= 0x2CFF)
 	WriteLog("Jaguar: Word %04X written to TOC+%02X by %s\n", data, offset-0x2C00, whoName[who]);//*/
 
+	if (dspThreadBusy && DSPThreadDeferWrite(offset, data, 2, who))
+		return;
+
 	offset &= 0xFFFFFF;
+	ProfileWrite(offset);
 
 	// First 2M is mirrored in the $0 - $7FFFFF range
 	if (offset <= 0x7FFFFE)
@@ -1802,8 +1950,12 @@ if (offset == 0x11D31A + 0x48000 || offset == 0x11D31A)
 
 		jaguarMainRAM[(offset+0) & 0x1FFFFF] = data >> 8;
 		jaguarMainRAM[(offset+1) & 0x1FFFFF] = data & 0xFF;
+		STATE_MARK_RAM_DIRTY(offset);
+		STATE_MARK_RAM_DIRTY(offset + 1);
 		return;
 	}
+	else if (blitterShadowPass && who == BLITTER && BlitterShadowAccess(offset, true))
+		return;
 	else if (offset >= 0xDFFF00 && offset <= 0xDFFFFE)
 	{
 		CDROMWriteWord(offset, data, who);
@@ -1865,17 +2017,33 @@ void JaguarSetScreenPitch(uint32_t pitch)
 }
 
 
+//
+// Random numbers for the things that are random on the real hardware (RAM
+// contents at power up & the like). We keep our own generator rather than use
+// rand(), since that one is shared by the whole process & every copy of the
+// core that's loaded into it.
+//
+uint32_t JaguarRandom(void)
+{
+	// Xorshift, which has a period of 2^32 - 1 as long as the seed isn't zero
+	randomSeed ^= randomSeed << 13;
+	randomSeed ^= randomSeed >> 17;
+	randomSeed ^= randomSeed << 5;
+	return randomSeed;
+}
+
+
 //
 // Jaguar console initialization
 //
 void JaguarInit(void)
 {
 	// For randomizing RAM
-	srand(time(NULL));
+	randomSeed = (uint32_t)time(NULL) | 1;
 
 	// Contents of local RAM are quasi-stable; we simulate this by randomizing RAM contents
 	for(uint32_t i=0; i<0x200000; i+=4)
-		*((uint32_t *)(&jaguarMainRAM[i])) = rand();
+		*((uint32_t *)(&jaguarMainRAM[i])) = JaguarRandom();
 
 #ifdef CPU_DEBUG_MEMORY
 	memset(readMem, 0x00, 0x400000);
@@ -1895,6 +2063,7 @@ void JaguarInit(void)
 memset(jaguarMainRAM + 0x804, 0xFF, 4);
 
 	m68k_pulse_reset();							// Need to do this so UAE disasm doesn't segfault on exit
+	M68KBuildPageTables();
 	GPUInit();
 	DSPInit();
 	TOMInit();
@@ -1909,10 +2078,13 @@ void HalflineCallback(void);
 void RenderCallback(void);
 void JaguarReset(void)
 {
+	// Let the DSP thread (if any) finish up before we pull the rug out from under it
+	DSPThreadWait();
+
 	// Only problem with this approach: It wipes out RAM loaded files...!
 	// Contents of local RAM are quasi-stable; we simulate this by randomizing RAM contents
 	for(uint32_t i=8; i<0x200000; i+=4)
-		*((uint32_t *)(&jaguarMainRAM[i])) = rand();
+		*((uint32_t *)(&jaguarMainRAM[i])) = JaguarRandom();
 
 	// New timer base code stuffola...
 	InitializeEventList();
@@ -1936,14 +2108,22 @@ void JaguarReset(void)
 	WriteLog("Jaguar: 68K reset. PC=%06X SP=%08X\n", m68k_get_reg(NULL, M68K_REG_PC), m68k_get_reg(NULL, M68K_REG_A7));
 
 	lowerField = false;								// Reset the lower field flag
+	m68kCyclesAhead = gpuCyclesAhead = 0;
+	halflineCycles = USEC_TO_RISC_CYCLES(vjs.hardwareTypeNTSC ? 31.777777777 : 32.0);
 //	SetCallbackTime(ScanlineCallback, 63.5555);
 //	SetCallbackTime(ScanlineCallback, 31.77775);
-	SetCallbackTime(HalflineCallback, (vjs.hardwareTypeNTSC ? 31.777777777 : 32.0));
+	SetCallbackCycles(HalflineCallback, halflineCycles);
+
+	// RAM was changed behind the dirty page tracking's back, so any delta
+	// states from before this point are worthless now
+	StateResetDeltas();
 }
 
 
 void JaguarDone(void)
 {
+	DSPThreadDone();
+
 #ifdef CPU_DEBUG_MEMORY
 /*	WriteLog("\nJaguar: Memory Usage Stats (return addresses)\n\n");
 
@@ -2044,6 +2224,7 @@ void JaguarDone(void)
 	DSPDone();
 	TOMDone();
 	JERRYDone();
+	StateDone();
     
 
 	// temp, until debugger is in place
@@ -2111,24 +2292,58 @@ uint8_t * GetRamPtr(void)
 
 //
 // New Jaguar execution stack
-// This executes 1 frame's worth of code.
+// This executes 1 frame's worth of code. With render false (frame skipping),
+// everything runs just the same, but nothing gets drawn into the screen buffer.
 //
-bool frameDone;
-void JaguarExecuteNew(void)
+// Everything is timed in RISC cycles on the event timeline. The CPUs only stop
+// on instruction boundaries, so each one usually runs a few cycles past the end
+// of its slice; those are carried over & taken off the next slice, so that
+// neither CPU drifts ahead of the timeline (or of the other).
+//
+void JaguarExecuteNew(bool render/*= true*/)
 {
 	frameDone = false;
+	renderFrame = render;
 
 	do
 	{
-		double timeToNextEvent = GetTimeToNextEvent();
-//WriteLog("JEN: Time to next event (%u) is %f usec (%u RISC cycles)...\n", nextEvent, timeToNextEvent, USEC_TO_RISC_CYCLES(timeToNextEvent));
+		int32_t cyclesToNextEvent = (int32_t)GetCyclesToNextEvent();
+//WriteLog("JEN: Time to next event is %u RISC cycles...\n", cyclesToNextEvent);
 
-		m68k_execute(USEC_TO_M68K_CYCLES(timeToNextEvent));
+		// The 68K runs at half the RISC clock
+		int32_t slice = cyclesToNextEvent - m68kCyclesAhead;
+
+		if (slice > 0)
+		{
+			ProfileEnter(PROFILE_M68K);
+			int m68kCycles = m68k_execute((slice + 1) >> 1);
+			ProfileLeave();
+			ProfileWork(PROFILE_M68K, m68kCycles);
+			m68kCyclesAhead = (m68kCycles * 2 > slice ? (m68kCycles * 2) - slice : 0);
+		}
+		else
+			m68kCyclesAhead = -slice;
 
 		if (vjs.GPUEnabled)
-			GPUExec(USEC_TO_RISC_CYCLES(timeToNextEvent));
+		{
+			slice = cyclesToNextEvent - gpuCyclesAhead;
 
+			if (slice > 0)
+			{
+				ProfileEnter(PROFILE_GPU);
+				int32_t gpuCycles = GPUExec(slice);
+				ProfileLeave();
+
+				// If the GPU stopped part way thru, it doesn't owe anything
+				gpuCyclesAhead = (gpuCycles > slice ? gpuCycles - slice : 0);
+			}
+			else
+				gpuCyclesAhead = -slice;
+		}
+
+		ProfileEnter(PROFILE_EVENTS);
 		HandleNextEvent();
+		ProfileLeave();
  	}
 	while (!frameDone);
     
@@ -2200,7 +2415,7 @@ void HalflineCallback(void)
 		m68k_set_irq(2);
 	}
 
-	TOMExecHalfline(vc, true);
+	TOMExecHalfline(vc, renderFrame);
 
 //Change this to VBB???
 //Doesn't seem to matter (at least for Flip Out & I-War)
@@ -2212,7 +2427,7 @@ void HalflineCallback(void)
 	}//*/
 
 #ifdef USE_CORRECT_PAL_TIMINGS
-	SetCallbackTime(HalflineCallback, (vjs.hardwareTypeNTSC ? 31.777777777 : 32.0));
+	SetCallbackCycles(HalflineCallback, halflineCycles);
 #else
 //	SetCallbackTime(HalflineCallback, 63.5555);
 	SetCallbackTime(HalflineCallback, 31.77775);
@@ -2230,3 +2445,34 @@ void RenderCallback(void)
 //	SetCallbackTime(RenderCallback, 33303.082);	// # Scanlines * scanline time
 	SetCallbackTime(RenderCallback, 16651.541);	// # Scanlines * scanline time
 }
+
+
+//
+// Save/load the 68K & friends. Main RAM is handled by the state code itself,
+// since it tracks which pages of it have been written to.
+//
+void JaguarStateSync(StateBuffer * sb)
+{
+	uint8_t m68kContext[256];
+	uint32_t contextSize = m68k_context_size();
+
+	if (contextSize > sizeof(m68kContext))
+	{
+		WriteLog("Jaguar: 68K context is too large (%u bytes) to save!\n", contextSize);
+		sb->error = true;
+		return;
+	}
+
+	if (sb->mode != STATE_LOAD)
+		m68k_get_context(m68kContext);
+
+	StateSync(sb, m68kContext, contextSize);
+	STATE_SYNC(sb, lowerField);
+	STATE_SYNC(sb, frameDone);
+	STATE_SYNC(sb, m68kCyclesAhead);
+	STATE_SYNC(sb, gpuCyclesAhead);
+	STATE_SYNC(sb, randomSeed);					// HC reads come from it
+
+	if (sb->mode == STATE_LOAD)
+		m68k_set_context(m68kContext);
+}
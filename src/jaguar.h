@@ -2,13 +2,16 @@
 #define __JAGUAR_H__
 
 #include <stdint.h>
+#include "context.h"
 #include "vjag_memory.h"							// For "UNKNOWN" enum
+#include "state.h"
 
 void JaguarSetScreenBuffer(uint32_t * buffer);
 void JaguarSetScreenPitch(uint32_t pitch);
 void JaguarInit(void);
 void JaguarReset(void);
 void JaguarDone(void);
+void JaguarStateSync(StateBuffer * sb);
 
 uint8_t JaguarReadByte(uint32_t offset, uint32_t who = UNKNOWN);
 uint16_t JaguarReadWord(uint32_t offset, uint32_t who = UNKNOWN);
@@ -20,16 +23,51 @@ void JaguarWriteLong(uint32_t offset, uint32_t data, uint32_t who = UNKNOWN);
 bool JaguarInterruptHandlerIsValid(uint32_t i);
 void JaguarDasm(uint32_t offset, uint32_t qt);
 
-void JaguarExecuteNew(void);
+void JaguarExecuteNew(bool render = true);
+uint32_t JaguarRandom(void);
+
+// What JAGUAR.CPP knows about the machine (see context.h)
+
+struct JaguarState
+{
+	uint32_t jaguarMainROMCRC32, jaguarROMSize, jaguarRunAddress;
+	bool jaguarCartInserted;
+	bool lowerField;
+	uint8_t * m68kReadPage[0x100];				// See M68KBuildPageTables()
+	uint32_t randomSeed;						// See JaguarRandom()
+	uint32_t halflineCycles;					// Length of a halfline, in RISC cycles
+	int32_t m68kCyclesAhead;					// How far past the timeline each CPU ran,
+	int32_t gpuCyclesAhead;						// in RISC cycles (see JaguarExecuteNew())
+	bool frameDone;
+	bool renderFrame;
+
+	// Debugging aids
+	uint32_t jaguar_active_memory_dumps;
+	uint32_t pcQueue[0x400];
+	uint32_t a0Queue[0x400], a1Queue[0x400], a2Queue[0x400], a3Queue[0x400];
+	uint32_t a4Queue[0x400], a5Queue[0x400], a6Queue[0x400], a7Queue[0x400];
+	uint32_t d0Queue[0x400], d1Queue[0x400], d2Queue[0x400], d3Queue[0x400];
+	uint32_t d4Queue[0x400], d5Queue[0x400], d6Queue[0x400], d7Queue[0x400];
+	uint32_t pcQPtr;
+	bool startM68KTracing;
+	bool bpmActive;								// Breakpoint on memory access
+	uint32_t bpmAddress1;
+	uint32_t starCount;
+};
 
 // Exports from JAGUAR.CPP
 
 extern int32_t jaguarCPUInExec;
-extern uint32_t jaguarMainROMCRC32, jaguarROMSize, jaguarRunAddress;
 extern char * jaguarEepromsPath;
-extern bool jaguarCartInserted;
-extern bool bpmActive;
-extern uint32_t bpmAddress1;
+#define jaguarMainROMCRC32			(CONTEXT(jaguar).jaguarMainROMCRC32)
+#define jaguarROMSize				(CONTEXT(jaguar).jaguarROMSize)
+#define jaguarRunAddress			(CONTEXT(jaguar).jaguarRunAddress)
+#define jaguarCartInserted			(CONTEXT(jaguar).jaguarCartInserted)
+#define jaguar_active_memory_dumps	(CONTEXT(jaguar).jaguar_active_memory_dumps)
+#define startM68KTracing			(CONTEXT(jaguar).startM68KTracing)
+#define bpmActive					(CONTEXT(jaguar).bpmActive)
+#define bpmAddress1					(CONTEXT(jaguar).bpmAddress1)
+#define starCount					(CONTEXT(jaguar).starCount)
 
 // Various clock rates
 
@@ -157,6 +157,7 @@
 //#include <math.h>
 #include "cdrom.h"
 #include "dac.h"
+#include "dspthread.h"
 #include "dsp.h"
 #include "eeprom.h"
 #include "event.h"
@@ -172,26 +173,30 @@
 //Note that 44100 Hz requires samples every 22.675737 usec.
 //#define JERRY_DEBUG
 
-/*static*/ uint8_t jerry_ram_8[0x10000];
+#ifndef MULTI_INSTANCE
+struct JERRYState jerryState;
+#endif
+
+#define jerry_ram_8				(CONTEXT(jerry).jerry_ram_8)
 
 //#define JERRY_CONFIG	0x4002						// ??? What's this ???
 
-uint8_t analog_x, analog_y;
+#define analog_x				(CONTEXT(jerry).analog_x)
+#define analog_y				(CONTEXT(jerry).analog_y)
 
-static uint32_t JERRYPIT1Prescaler;
-static uint32_t JERRYPIT1Divider;
-static uint32_t JERRYPIT2Prescaler;
-static uint32_t JERRYPIT2Divider;
-static int32_t jerry_timer_1_counter;
-static int32_t jerry_timer_2_counter;
+#define JERRYPIT1Prescaler		(CONTEXT(jerry).JERRYPIT1Prescaler)
+#define JERRYPIT1Divider		(CONTEXT(jerry).JERRYPIT1Divider)
+#define JERRYPIT2Prescaler		(CONTEXT(jerry).JERRYPIT2Prescaler)
+#define JERRYPIT2Divider		(CONTEXT(jerry).JERRYPIT2Divider)
+#define jerry_timer_1_counter	(CONTEXT(jerry).jerry_timer_1_counter)
+#define jerry_timer_2_counter	(CONTEXT(jerry).jerry_timer_2_counter)
 
 //uint32_t JERRYI2SInterruptDivide = 8;
-int32_t JERRYI2SInterruptTimer = -1;
-uint32_t jerryI2SCycles;
-uint32_t jerryIntPending;
+#define jerryI2SCycles			(CONTEXT(jerry).jerryI2SCycles)
+#define jerryIntPending			(CONTEXT(jerry).jerryIntPending)
 
-static uint16_t jerryInterruptMask = 0;
-static uint16_t jerryPendingInterrupt = 0;
+#define jerryInterruptMask		(CONTEXT(jerry).jerryInterruptMask)
+#define jerryPendingInterrupt	(CONTEXT(jerry).jerryPendingInterrupt)
 
 // Private function prototypes
 
@@ -219,8 +224,9 @@ void JERRYResetPIT1(void)
 
 	if (JERRYPIT1Prescaler | JERRYPIT1Divider)
 	{
-		double usecs = (float)(JERRYPIT1Prescaler + 1) * (float)(JERRYPIT1Divider + 1) * RISC_CYCLE_IN_USEC;
-		SetCallbackTime(JERRYPIT1Callback, usecs, EVENT_JERRY);
+		// Like TOM's, these count RISC cycles on PAL as well as NTSC
+		uint64_t cycles = (uint64_t)(JERRYPIT1Prescaler + 1) * (uint64_t)(JERRYPIT1Divider + 1);
+		SetCallbackCycles(JERRYPIT1Callback, cycles, EVENT_JERRY);
 	}
 }
 
@@ -231,8 +237,8 @@ void JERRYResetPIT2(void)
 
 	if (JERRYPIT1Prescaler | JERRYPIT1Divider)
 	{
-		double usecs = (float)(JERRYPIT2Prescaler + 1) * (float)(JERRYPIT2Divider + 1) * RISC_CYCLE_IN_USEC;
-		SetCallbackTime(JERRYPIT2Callback, usecs, EVENT_JERRY);
+		uint64_t cycles = (uint64_t)(JERRYPIT2Prescaler + 1) * (uint64_t)(JERRYPIT2Divider + 1);
+		SetCallbackCycles(JERRYPIT2Callback, cycles, EVENT_JERRY);
 	}
 }
 
@@ -251,7 +257,7 @@ void JERRYPIT1Callback(void)
 // Not sure, but I think we don't generate another IRQ if one's already going...
 // But this seems to work... :-/
 			jerryPendingInterrupt |= IRQ2_TIMER1;
-			m68k_set_irq(2);						// Generate 68K IPL 2
+			DSPThreadSet68KIRQ(2);						// Generate 68K IPL 2
 		}
 	}
 #endif
@@ -270,7 +276,7 @@ void JERRYPIT2Callback(void)
 		if (jerryInterruptMask & IRQ2_TIMER2)		// CPU Timer 2 IRQ
 		{
 			jerryPendingInterrupt |= IRQ2_TIMER2;
-			m68k_set_irq(2);						// Generate 68K IPL 2
+			DSPThreadSet68KIRQ(2);						// Generate 68K IPL 2
 		}
 	}
 #endif
@@ -297,10 +303,8 @@ void JERRYI2SCallback(void)
 	{
 		// This does the 'IRQ enabled' checking...
 		DSPSetIRQLine(DSPIRQ_SSI, ASSERT_LINE);
-//		double usecs = (float)jerryI2SCycles * RISC_CYCLE_IN_USEC;
 //this fix is almost enough to fix timings in tripper, but not quite enough...
-		double usecs = (float)jerryI2SCycles * (vjs.hardwareTypeNTSC ? RISC_CYCLE_IN_USEC : RISC_CYCLE_PAL_IN_USEC);
-		SetCallbackTime(JERRYI2SCallback, usecs, EVENT_JERRY);
+		SetCallbackCycles(JERRYI2SCallback, jerryI2SCycles, EVENT_JERRY);
 	}
 	else
 	{
@@ -350,6 +354,7 @@ void JERRYInit(void)
 	JERRYPIT2Divider = 0xFFFF;
 	jerryInterruptMask = 0x0000;
 	jerryPendingInterrupt = 0x0000;
+	JERRYI2SInterruptTimer = -1;
 
 	DACInit();
 }
@@ -384,6 +389,27 @@ void JERRYDone(void)
 }
 
 
+void JERRYStateSync(StateBuffer * sb)
+{
+	STATE_SYNC(sb, jerry_ram_8);
+	STATE_SYNC(sb, JERRYPIT1Prescaler);
+	STATE_SYNC(sb, JERRYPIT1Divider);
+	STATE_SYNC(sb, JERRYPIT2Prescaler);
+	STATE_SYNC(sb, JERRYPIT2Divider);
+	STATE_SYNC(sb, jerry_timer_1_counter);
+	STATE_SYNC(sb, jerry_timer_2_counter);
+	STATE_SYNC(sb, JERRYI2SInterruptTimer);
+	STATE_SYNC(sb, jerryI2SCycles);
+	STATE_SYNC(sb, jerryIntPending);
+	STATE_SYNC(sb, jerryInterruptMask);
+	STATE_SYNC(sb, jerryPendingInterrupt);
+
+	JoystickStateSync(sb);
+	EepromStateSync(sb);
+	DACStateSync(sb);
+}
+
+
 bool JERRYIRQEnabled(int irq)
 {
 	// Read the word @ $F10020
@@ -408,6 +434,8 @@ uint8_t JERRYReadByte(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 #ifdef JERRY_DEBUG
 	WriteLog("JERRY: Reading byte at %06X\n", offset);
 #endif
+	DSPThreadTouch(offset);
+
 	if ((offset >= DSP_CONTROL_RAM_BASE) && (offset < DSP_CONTROL_RAM_BASE+0x20))
 		return DSPReadByte(offset, who);
 	else if ((offset >= DSP_WORK_RAM_BASE) && (offset < DSP_WORK_RAM_BASE+0x2000))
@@ -462,6 +490,7 @@ uint16_t JERRYReadWord(uint32_t offset, uint32_t who/*=UNKNOWN*/)
 #ifdef JERRY_DEBUG
 	WriteLog("JERRY: Reading word at %06X\n", offset);
 #endif
+	DSPThreadTouch(offset);
 
 	if ((offset >= DSP_CONTROL_RAM_BASE) && (offset < DSP_CONTROL_RAM_BASE+0x20))
 		return DSPReadWord(offset, who);
@@ -512,6 +541,8 @@ void JERRYWriteByte(uint32_t offset, uint8_t data, uint32_t who/*=UNKNOWN*/)
 #ifdef JERRY_DEBUG
 	WriteLog("jerry: writing byte %.2x at 0x%.6x\n",data,offset);
 #endif
+	DSPThreadTouch(offset);
+
 	if ((offset >= DSP_CONTROL_RAM_BASE) && (offset < DSP_CONTROL_RAM_BASE+0x20))
 	{
 		DSPWriteByte(offset, data, who);
@@ -608,6 +639,8 @@ void JERRYWriteWord(uint32_t offset, uint16_t data, uint32_t who/*=UNKNOWN*/)
 #ifdef JERRY_DEBUG
 	WriteLog( "JERRY: Writing word %04X at %06X\n", data, offset);
 #endif
+	DSPThreadTouch(offset);
+
 #if 1
 if (offset == 0xF10000)
 	WriteLog("JERRY: JPIT1 word written by %s: %u\n", whoName[who], data);
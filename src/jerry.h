@@ -6,11 +6,14 @@
 #define __JERRY_H__
 
 //#include "types.h"
+#include "context.h"
 #include "vjag_memory.h"
+#include "state.h"
 
 void JERRYInit(void);
 void JERRYReset(void);
 void JERRYDone(void);
+void JERRYStateSync(StateBuffer * sb);
 
 uint8_t JERRYReadByte(uint32_t offset, uint32_t who = UNKNOWN);
 uint16_t JERRYReadWord(uint32_t offset, uint32_t who = UNKNOWN);
@@ -35,9 +38,28 @@ void JERRYSetPendingIRQ(int irq);
 // Need to set up an interface function so that this can go back
 void JERRYI2SCallback(void);
 
+// What JERRY.CPP knows about the machine (see context.h)
+
+struct JERRYState
+{
+	uint8_t jerry_ram_8[0x10000];
+	uint8_t analog_x, analog_y;
+	uint32_t JERRYPIT1Prescaler;
+	uint32_t JERRYPIT1Divider;
+	uint32_t JERRYPIT2Prescaler;
+	uint32_t JERRYPIT2Divider;
+	int32_t jerry_timer_1_counter;
+	int32_t jerry_timer_2_counter;
+	int32_t JERRYI2SInterruptTimer;
+	uint32_t jerryI2SCycles;
+	uint32_t jerryIntPending;
+	uint16_t jerryInterruptMask;
+	uint16_t jerryPendingInterrupt;
+};
+
 // External variables
 
 //extern uint32_t JERRYI2SInterruptDivide;
-extern int32_t JERRYI2SInterruptTimer;
+#define JERRYI2SInterruptTimer	(CONTEXT(jerry).JERRYI2SInterruptTimer)
 
 #endif
@@ -22,11 +22,13 @@
 
 // Global vars
 
-static uint8_t joystick_ram[4];
-uint8_t joypad0Buttons[21];
-uint8_t joypad1Buttons[21];
-bool audioEnabled = false;
-bool joysticksEnabled = false;
+#ifndef MULTI_INSTANCE
+struct JoystickState joystickState;
+#endif
+
+#define joystick_ram		(CONTEXT(joystick).joystick_ram)
+#define audioEnabled		(CONTEXT(joystick).audioEnabled)
+#define joysticksEnabled	(CONTEXT(joystick).joysticksEnabled)
 
 
 bool GUIKeyHeld = false;
@@ -56,11 +58,13 @@ void JoystickInit(void)
 
 void JoystickExec(void)
 {
+#ifdef DEBUG_HOOKS
 	gpu_start_log = 0;							// Only log while key down!
 	effect_start = 0;
 	effect_start2 = effect_start3 = effect_start4 = effect_start5 = effect_start6 = 0;
 	blit_start_log = 0;
 	iLeft = iRight = false;
+#endif
 }
 
 
@@ -77,6 +81,12 @@ void JoystickDone(void)
 }
 
 
+void JoystickStateSync(StateBuffer * sb)
+{
+	STATE_SYNC(sb, joystick_ram);
+}
+
+
 uint16_t JoystickReadWord(uint32_t offset)
 {
 	// E, D, B, 7
@@ -6,6 +6,8 @@
 #define __JOYSTICK_H__
 
 #include <stdint.h>
+#include "context.h"
+#include "state.h"
 
 enum { BUTTON_FIRST = 0, BUTTON_U = 0,
 BUTTON_D = 1,
@@ -34,16 +36,26 @@ BUTTON_PAUSE = 20, BUTTON_LAST = 20 };
 void JoystickInit(void);
 void JoystickReset(void);
 void JoystickDone(void);
+void JoystickStateSync(StateBuffer * sb);
 //void JoystickWriteByte(uint32_t, uint8_t);
 void JoystickWriteWord(uint32_t, uint16_t);
 //uint8_t JoystickReadByte(uint32_t);
 uint16_t JoystickReadWord(uint32_t);
 void JoystickExec(void);
 
-extern uint8_t joypad0Buttons[];
-extern uint8_t joypad1Buttons[];
-extern bool audioEnabled;
-extern bool joysticksEnabled;
+// What JOYSTICK.CPP knows about the machine (see context.h)
+
+struct JoystickState
+{
+	uint8_t joystick_ram[4];
+	uint8_t joypad0Buttons[21];
+	uint8_t joypad1Buttons[21];
+	bool audioEnabled;
+	bool joysticksEnabled;
+};
+
+#define joypad0Buttons		(CONTEXT(joystick).joypad0Buttons)
+#define joypad1Buttons		(CONTEXT(joystick).joypad1Buttons)
 
 #endif	// __JOYSTICK_H__
 
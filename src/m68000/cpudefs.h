@@ -12,6 +12,7 @@
 #define __CPUDEFS_H__
 
 #include "sysdeps.h"
+#include "context.h"
 
 /* Special flags */
 #define SPCFLAG_DEBUGGER      0x001
@@ -27,9 +28,12 @@
 #define SPCFLAG_EXEC          0x400
 #define SPCFLAG_MODE_CHANGE   0x800
 
+// The longest a 68000 instruction gets, in bytes
+#define M68K_MAX_INSTRUCTION	10
+
 struct regstruct
 {
-	uint32_t regs[16];
+	uint32_t rn[16];					// D0-D7, then A0-A7
 	uint32_t usp, isp;
 	uint16_t sr;
 	uint8_t s;
@@ -43,10 +47,22 @@ struct regstruct
 	unsigned int v; 
 	unsigned int x;
 
+	// Lazy flags: when flag_op isn't FLAGOP_NONE, C, Z, N & V above are stale
+	// and come from the last operation's operands instead (see MakeFlags())
+	uint32_t flag_op;
+	uint32_t flag_src, flag_dst;
+
 	uint32_t pc;
 	uint8_t * pc_p;
 	uint8_t * pc_oldp;
 
+	// Instruction fetch window: pc_p is good as long as
+	// (pc - fetch_base) < fetch_size, and pc_oldp is where fetch_base is in host
+	// memory. Code outside of one gets fetched into fetch_buf instead.
+	uint32_t fetch_base;
+	uint32_t fetch_size;
+	uint8_t fetch_buf[M68K_MAX_INSTRUCTION];
+
 	uint32_t spcflags;
 
 	uint32_t prefetch_pc;
@@ -56,10 +72,42 @@ struct regstruct
 	uint32_t interruptCycles;
 };
 
-extern struct regstruct regs, lastint_regs;
+// What the 68K core knows about the machine (see context.h)
+struct M68KState
+{
+	struct regstruct regs;
+
+	uint16_t last_op_for_exception_3;		// Opcode of faulting instruction
+	uint32_t last_addr_for_exception_3;		// PC at fault time
+	uint32_t last_fault_for_exception_3;	// Address that generated the exception
+
+	// Family of the latest instruction executed (to check for pairing; see
+	// instrmnem in readcpu.h)
+	int OpcodeFamily;
+	// How many cycles to add to the current instruction in case a "misaligned"
+	// bus access is made (used when addressing mode is d8(an,ix))
+	int BusCyclePenalty;
+	int CurrentInstrCycles;
+
+	// m68kinterface.c's
+	int32_t initialCycles;
+	int checkForIRQToHandle;
+	int IRQLevelToHandle;
+
+	// m68kdasm.c's
+	long int m68kpc_offset;
+};
+
+#define regs						(CONTEXT(m68k).regs)
+#define last_op_for_exception_3		(CONTEXT(m68k).last_op_for_exception_3)
+#define last_addr_for_exception_3	(CONTEXT(m68k).last_addr_for_exception_3)
+#define last_fault_for_exception_3	(CONTEXT(m68k).last_fault_for_exception_3)
+#define OpcodeFamily				(CONTEXT(m68k).OpcodeFamily)
+#define BusCyclePenalty				(CONTEXT(m68k).BusCyclePenalty)
+#define CurrentInstrCycles			(CONTEXT(m68k).CurrentInstrCycles)
 
-#define m68k_dreg(r, num) ((r).regs[(num)])
-#define m68k_areg(r, num) (((r).regs + 8)[(num)])
+#define m68k_dreg(r, num) ((r).rn[(num)])
+#define m68k_areg(r, num) (((r).rn + 8)[(num)])
 
 #define ZFLG (regs.z)
 #define NFLG (regs.n)
@@ -73,23 +121,46 @@ extern struct regstruct regs, lastint_regs;
 //#define M68000_EXC_SRC_INT_MFP  3  /* MFP interrupt exception */
 //#define M68000_EXC_SRC_INT_DSP  4  /* DSP interrupt exception */
 
-#define SET_CFLG(x) (CFLG = (x))
-#define SET_NFLG(x) (NFLG = (x))
-#define SET_VFLG(x) (VFLG = (x))
-#define SET_ZFLG(x) (ZFLG = (x))
+// What the last flag setting instruction was, when it hasn't been worked out
+// into C, Z, N & V yet. The operands are shifted up so that the operation's
+// sign bit is bit 31, which makes byte & word flags come out of the same 32
+// bit math as long ones. X is always set right away: most of the instructions
+// that go lazy leave it alone, so a lazy X would have to be worked out before
+// every one of them.
+#define FLAGOP_NONE		0
+#define FLAGOP_LOGIC	1					// flag_dst is the result; C = V = 0
+#define FLAGOP_ADD		2					// flag_dst + flag_src
+#define FLAGOP_SUB		3					// flag_dst - flag_src (also CMP)
+
+extern void MakeFlags(void);
+
+#define FLAGS_SYNC (regs.flag_op != FLAGOP_NONE ? MakeFlags() : (void)0)
+
+#define SET_LAZY_LOGIC(r, shift) (regs.flag_op = FLAGOP_LOGIC, \
+	regs.flag_dst = (uint32_t)(r) << (shift))
+#define SET_LAZY_ADD(s, d, shift) (regs.flag_op = FLAGOP_ADD, \
+	regs.flag_src = (uint32_t)(s) << (shift), regs.flag_dst = (uint32_t)(d) << (shift))
+#define SET_LAZY_SUB(s, d, shift) (regs.flag_op = FLAGOP_SUB, \
+	regs.flag_src = (uint32_t)(s) << (shift), regs.flag_dst = (uint32_t)(d) << (shift))
+
+// Anything that sets or looks at only some of the flags needs the others to be
+// real first. X isn't lazy, so it doesn't have to bother.
+#define SET_CFLG(x) (FLAGS_SYNC, CFLG = (x))
+#define SET_NFLG(x) (FLAGS_SYNC, NFLG = (x))
+#define SET_VFLG(x) (FLAGS_SYNC, VFLG = (x))
+#define SET_ZFLG(x) (FLAGS_SYNC, ZFLG = (x))
 #define SET_XFLG(x) (XFLG = (x))
 
-#define GET_CFLG CFLG
-#define GET_NFLG NFLG
-#define GET_VFLG VFLG
-#define GET_ZFLG ZFLG
+#define GET_CFLG (FLAGS_SYNC, CFLG)
+#define GET_NFLG (FLAGS_SYNC, NFLG)
+#define GET_VFLG (FLAGS_SYNC, VFLG)
+#define GET_ZFLG (FLAGS_SYNC, ZFLG)
 #define GET_XFLG XFLG
 
+// Sets all four, so whatever was pending doesn't matter
 #define CLEAR_CZNV do { \
- SET_CFLG(0); \
- SET_ZFLG(0); \
- SET_NFLG(0); \
- SET_VFLG(0); \
+ regs.flag_op = FLAGOP_NONE; \
+ CFLG = ZFLG = NFLG = VFLG = 0; \
 } while (0)
 
 #define COPY_CARRY (SET_XFLG(GET_CFLG))
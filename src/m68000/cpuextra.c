@@ -11,15 +11,9 @@
 #include "inlines.h"
 
 
-uint16_t last_op_for_exception_3;		// Opcode of faulting instruction
-uint32_t last_addr_for_exception_3;		// PC at fault time
-uint32_t last_fault_for_exception_3;	// Address that generated the exception
-
-int OpcodeFamily;						// Used by cpuemu.c...
-int BusCyclePenalty = 0;				// Used by cpuemu.c...
-int CurrentInstrCycles;
-
-struct regstruct regs;
+#ifndef MULTI_INSTANCE
+struct M68KState m68kState;
+#endif
 
 
 //
@@ -28,7 +22,7 @@ struct regstruct regs;
 uint32_t get_disp_ea_000(uint32_t base, uint32_t dp)
 {
 	int reg = (dp >> 12) & 0x0F;
-	int32_t regd = regs.regs[reg];
+	int32_t regd = regs.rn[reg];
 
 #if 1
 	if ((dp & 0x800) == 0)
@@ -53,6 +47,41 @@ uint32_t get_disp_ea_000(uint32_t base, uint32_t dp)
 }
 
 
+//
+// Work out C, Z, N & V from the last lazy flag setting instruction (see
+// FLAGOP_* in cpudefs.h)
+//
+void MakeFlags(void)
+{
+	uint32_t src = regs.flag_src, dst = regs.flag_dst, result;
+
+	switch (regs.flag_op)
+	{
+	case FLAGOP_LOGIC:
+		regs.c = regs.v = 0;
+		regs.z = (dst == 0);
+		regs.n = dst >> 31;
+		break;
+	case FLAGOP_ADD:
+		result = dst + src;
+		regs.c = (result < dst);
+		regs.v = ((src ^ result) & (dst ^ result)) >> 31;
+		regs.z = (result == 0);
+		regs.n = result >> 31;
+		break;
+	case FLAGOP_SUB:
+		result = dst - src;
+		regs.c = (src > dst);
+		regs.v = ((src ^ dst) & (result ^ dst)) >> 31;
+		regs.z = (result == 0);
+		regs.n = result >> 31;
+		break;
+	}
+
+	regs.flag_op = FLAGOP_NONE;
+}
+
+
 //
 // Create the Status Register from the flags
 //
@@ -72,6 +101,7 @@ void MakeFromSR(void)
 
 	regs.s = (regs.sr >> 13) & 1;
 	regs.intmask = (regs.sr >> 8) & 7;
+	regs.flag_op = FLAGOP_NONE;				// All of them come from the SR
 	SET_XFLG((regs.sr >> 4) & 1);
 	SET_NFLG((regs.sr >> 3) & 1);
 	SET_ZFLG((regs.sr >> 2) & 1);
@@ -6,3167 +6,5687 @@
 #ifdef NOFLAGS
 #include "noflags.h"
 #endif
-const struct cputbl CPUFUNC(op_smalltbl_4)[] = {
-{ CPUFUNC(op_0_4), 0, 0 }, /* OR */
-{ CPUFUNC(op_10_4), 0, 16 }, /* OR */
-{ CPUFUNC(op_18_4), 0, 24 }, /* OR */
-{ CPUFUNC(op_20_4), 0, 32 }, /* OR */
-{ CPUFUNC(op_28_4), 0, 40 }, /* OR */
-{ CPUFUNC(op_30_4), 0, 48 }, /* OR */
-{ CPUFUNC(op_38_4), 0, 56 }, /* OR */
-{ CPUFUNC(op_39_4), 0, 57 }, /* OR */
-{ CPUFUNC(op_3c_4), 0, 60 }, /* ORSR */
-{ CPUFUNC(op_40_4), 0, 64 }, /* OR */
-{ CPUFUNC(op_50_4), 0, 80 }, /* OR */
-{ CPUFUNC(op_58_4), 0, 88 }, /* OR */
-{ CPUFUNC(op_60_4), 0, 96 }, /* OR */
-{ CPUFUNC(op_68_4), 0, 104 }, /* OR */
-{ CPUFUNC(op_70_4), 0, 112 }, /* OR */
-{ CPUFUNC(op_78_4), 0, 120 }, /* OR */
-{ CPUFUNC(op_79_4), 0, 121 }, /* OR */
-{ CPUFUNC(op_7c_4), 0, 124 }, /* ORSR */
-{ CPUFUNC(op_80_4), 0, 128 }, /* OR */
-{ CPUFUNC(op_90_4), 0, 144 }, /* OR */
-{ CPUFUNC(op_98_4), 0, 152 }, /* OR */
-{ CPUFUNC(op_a0_4), 0, 160 }, /* OR */
-{ CPUFUNC(op_a8_4), 0, 168 }, /* OR */
-{ CPUFUNC(op_b0_4), 0, 176 }, /* OR */
-{ CPUFUNC(op_b8_4), 0, 184 }, /* OR */
-{ CPUFUNC(op_b9_4), 0, 185 }, /* OR */
-{ CPUFUNC(op_100_4), 0, 256 }, /* BTST */
-{ CPUFUNC(op_108_4), 0, 264 }, /* MVPMR */
-{ CPUFUNC(op_110_4), 0, 272 }, /* BTST */
-{ CPUFUNC(op_118_4), 0, 280 }, /* BTST */
-{ CPUFUNC(op_120_4), 0, 288 }, /* BTST */
-{ CPUFUNC(op_128_4), 0, 296 }, /* BTST */
-{ CPUFUNC(op_130_4), 0, 304 }, /* BTST */
-{ CPUFUNC(op_138_4), 0, 312 }, /* BTST */
-{ CPUFUNC(op_139_4), 0, 313 }, /* BTST */
-{ CPUFUNC(op_13a_4), 0, 314 }, /* BTST */
-{ CPUFUNC(op_13b_4), 0, 315 }, /* BTST */
-{ CPUFUNC(op_13c_4), 0, 316 }, /* BTST */
-{ CPUFUNC(op_140_4), 0, 320 }, /* BCHG */
-{ CPUFUNC(op_148_4), 0, 328 }, /* MVPMR */
-{ CPUFUNC(op_150_4), 0, 336 }, /* BCHG */
-{ CPUFUNC(op_158_4), 0, 344 }, /* BCHG */
-{ CPUFUNC(op_160_4), 0, 352 }, /* BCHG */
-{ CPUFUNC(op_168_4), 0, 360 }, /* BCHG */
-{ CPUFUNC(op_170_4), 0, 368 }, /* BCHG */
-{ CPUFUNC(op_178_4), 0, 376 }, /* BCHG */
-{ CPUFUNC(op_179_4), 0, 377 }, /* BCHG */
-{ CPUFUNC(op_17a_4), 0, 378 }, /* BCHG */
-{ CPUFUNC(op_17b_4), 0, 379 }, /* BCHG */
-{ CPUFUNC(op_180_4), 0, 384 }, /* BCLR */
-{ CPUFUNC(op_188_4), 0, 392 }, /* MVPRM */
-{ CPUFUNC(op_190_4), 0, 400 }, /* BCLR */
-{ CPUFUNC(op_198_4), 0, 408 }, /* BCLR */
-{ CPUFUNC(op_1a0_4), 0, 416 }, /* BCLR */
-{ CPUFUNC(op_1a8_4), 0, 424 }, /* BCLR */
-{ CPUFUNC(op_1b0_4), 0, 432 }, /* BCLR */
-{ CPUFUNC(op_1b8_4), 0, 440 }, /* BCLR */
-{ CPUFUNC(op_1b9_4), 0, 441 }, /* BCLR */
-{ CPUFUNC(op_1ba_4), 0, 442 }, /* BCLR */
-{ CPUFUNC(op_1bb_4), 0, 443 }, /* BCLR */
-{ CPUFUNC(op_1c0_4), 0, 448 }, /* BSET */
-{ CPUFUNC(op_1c8_4), 0, 456 }, /* MVPRM */
-{ CPUFUNC(op_1d0_4), 0, 464 }, /* BSET */
-{ CPUFUNC(op_1d8_4), 0, 472 }, /* BSET */
-{ CPUFUNC(op_1e0_4), 0, 480 }, /* BSET */
-{ CPUFUNC(op_1e8_4), 0, 488 }, /* BSET */
-{ CPUFUNC(op_1f0_4), 0, 496 }, /* BSET */
-{ CPUFUNC(op_1f8_4), 0, 504 }, /* BSET */
-{ CPUFUNC(op_1f9_4), 0, 505 }, /* BSET */
-{ CPUFUNC(op_1fa_4), 0, 506 }, /* BSET */
-{ CPUFUNC(op_1fb_4), 0, 507 }, /* BSET */
-{ CPUFUNC(op_200_4), 0, 512 }, /* AND */
-{ CPUFUNC(op_210_4), 0, 528 }, /* AND */
-{ CPUFUNC(op_218_4), 0, 536 }, /* AND */
-{ CPUFUNC(op_220_4), 0, 544 }, /* AND */
-{ CPUFUNC(op_228_4), 0, 552 }, /* AND */
-{ CPUFUNC(op_230_4), 0, 560 }, /* AND */
-{ CPUFUNC(op_238_4), 0, 568 }, /* AND */
-{ CPUFUNC(op_239_4), 0, 569 }, /* AND */
-{ CPUFUNC(op_23c_4), 0, 572 }, /* ANDSR */
-{ CPUFUNC(op_240_4), 0, 576 }, /* AND */
-{ CPUFUNC(op_250_4), 0, 592 }, /* AND */
-{ CPUFUNC(op_258_4), 0, 600 }, /* AND */
-{ CPUFUNC(op_260_4), 0, 608 }, /* AND */
-{ CPUFUNC(op_268_4), 0, 616 }, /* AND */
-{ CPUFUNC(op_270_4), 0, 624 }, /* AND */
-{ CPUFUNC(op_278_4), 0, 632 }, /* AND */
-{ CPUFUNC(op_279_4), 0, 633 }, /* AND */
-{ CPUFUNC(op_27c_4), 0, 636 }, /* ANDSR */
-{ CPUFUNC(op_280_4), 0, 640 }, /* AND */
-{ CPUFUNC(op_290_4), 0, 656 }, /* AND */
-{ CPUFUNC(op_298_4), 0, 664 }, /* AND */
-{ CPUFUNC(op_2a0_4), 0, 672 }, /* AND */
-{ CPUFUNC(op_2a8_4), 0, 680 }, /* AND */
-{ CPUFUNC(op_2b0_4), 0, 688 }, /* AND */
-{ CPUFUNC(op_2b8_4), 0, 696 }, /* AND */
-{ CPUFUNC(op_2b9_4), 0, 697 }, /* AND */
-{ CPUFUNC(op_400_4), 0, 1024 }, /* SUB */
-{ CPUFUNC(op_410_4), 0, 1040 }, /* SUB */
-{ CPUFUNC(op_418_4), 0, 1048 }, /* SUB */
-{ CPUFUNC(op_420_4), 0, 1056 }, /* SUB */
-{ CPUFUNC(op_428_4), 0, 1064 }, /* SUB */
-{ CPUFUNC(op_430_4), 0, 1072 }, /* SUB */
-{ CPUFUNC(op_438_4), 0, 1080 }, /* SUB */
-{ CPUFUNC(op_439_4), 0, 1081 }, /* SUB */
-{ CPUFUNC(op_440_4), 0, 1088 }, /* SUB */
-{ CPUFUNC(op_450_4), 0, 1104 }, /* SUB */
-{ CPUFUNC(op_458_4), 0, 1112 }, /* SUB */
-{ CPUFUNC(op_460_4), 0, 1120 }, /* SUB */
-{ CPUFUNC(op_468_4), 0, 1128 }, /* SUB */
-{ CPUFUNC(op_470_4), 0, 1136 }, /* SUB */
-{ CPUFUNC(op_478_4), 0, 1144 }, /* SUB */
-{ CPUFUNC(op_479_4), 0, 1145 }, /* SUB */
-{ CPUFUNC(op_480_4), 0, 1152 }, /* SUB */
-{ CPUFUNC(op_490_4), 0, 1168 }, /* SUB */
-{ CPUFUNC(op_498_4), 0, 1176 }, /* SUB */
-{ CPUFUNC(op_4a0_4), 0, 1184 }, /* SUB */
-{ CPUFUNC(op_4a8_4), 0, 1192 }, /* SUB */
-{ CPUFUNC(op_4b0_4), 0, 1200 }, /* SUB */
-{ CPUFUNC(op_4b8_4), 0, 1208 }, /* SUB */
-{ CPUFUNC(op_4b9_4), 0, 1209 }, /* SUB */
-{ CPUFUNC(op_600_4), 0, 1536 }, /* ADD */
-{ CPUFUNC(op_610_4), 0, 1552 }, /* ADD */
-{ CPUFUNC(op_618_4), 0, 1560 }, /* ADD */
-{ CPUFUNC(op_620_4), 0, 1568 }, /* ADD */
-{ CPUFUNC(op_628_4), 0, 1576 }, /* ADD */
-{ CPUFUNC(op_630_4), 0, 1584 }, /* ADD */
-{ CPUFUNC(op_638_4), 0, 1592 }, /* ADD */
-{ CPUFUNC(op_639_4), 0, 1593 }, /* ADD */
-{ CPUFUNC(op_640_4), 0, 1600 }, /* ADD */
-{ CPUFUNC(op_650_4), 0, 1616 }, /* ADD */
-{ CPUFUNC(op_658_4), 0, 1624 }, /* ADD */
-{ CPUFUNC(op_660_4), 0, 1632 }, /* ADD */
-{ CPUFUNC(op_668_4), 0, 1640 }, /* ADD */
-{ CPUFUNC(op_670_4), 0, 1648 }, /* ADD */
-{ CPUFUNC(op_678_4), 0, 1656 }, /* ADD */
-{ CPUFUNC(op_679_4), 0, 1657 }, /* ADD */
-{ CPUFUNC(op_680_4), 0, 1664 }, /* ADD */
-{ CPUFUNC(op_690_4), 0, 1680 }, /* ADD */
-{ CPUFUNC(op_698_4), 0, 1688 }, /* ADD */
-{ CPUFUNC(op_6a0_4), 0, 1696 }, /* ADD */
-{ CPUFUNC(op_6a8_4), 0, 1704 }, /* ADD */
-{ CPUFUNC(op_6b0_4), 0, 1712 }, /* ADD */
-{ CPUFUNC(op_6b8_4), 0, 1720 }, /* ADD */
-{ CPUFUNC(op_6b9_4), 0, 1721 }, /* ADD */
-{ CPUFUNC(op_800_4), 0, 2048 }, /* BTST */
-{ CPUFUNC(op_810_4), 0, 2064 }, /* BTST */
-{ CPUFUNC(op_818_4), 0, 2072 }, /* BTST */
-{ CPUFUNC(op_820_4), 0, 2080 }, /* BTST */
-{ CPUFUNC(op_828_4), 0, 2088 }, /* BTST */
-{ CPUFUNC(op_830_4), 0, 2096 }, /* BTST */
-{ CPUFUNC(op_838_4), 0, 2104 }, /* BTST */
-{ CPUFUNC(op_839_4), 0, 2105 }, /* BTST */
-{ CPUFUNC(op_83a_4), 0, 2106 }, /* BTST */
-{ CPUFUNC(op_83b_4), 0, 2107 }, /* BTST */
-{ CPUFUNC(op_83c_4), 0, 2108 }, /* BTST */
-{ CPUFUNC(op_840_4), 0, 2112 }, /* BCHG */
-{ CPUFUNC(op_850_4), 0, 2128 }, /* BCHG */
-{ CPUFUNC(op_858_4), 0, 2136 }, /* BCHG */
-{ CPUFUNC(op_860_4), 0, 2144 }, /* BCHG */
-{ CPUFUNC(op_868_4), 0, 2152 }, /* BCHG */
-{ CPUFUNC(op_870_4), 0, 2160 }, /* BCHG */
-{ CPUFUNC(op_878_4), 0, 2168 }, /* BCHG */
-{ CPUFUNC(op_879_4), 0, 2169 }, /* BCHG */
-{ CPUFUNC(op_87a_4), 0, 2170 }, /* BCHG */
-{ CPUFUNC(op_87b_4), 0, 2171 }, /* BCHG */
-{ CPUFUNC(op_880_4), 0, 2176 }, /* BCLR */
-{ CPUFUNC(op_890_4), 0, 2192 }, /* BCLR */
-{ CPUFUNC(op_898_4), 0, 2200 }, /* BCLR */
-{ CPUFUNC(op_8a0_4), 0, 2208 }, /* BCLR */
-{ CPUFUNC(op_8a8_4), 0, 2216 }, /* BCLR */
-{ CPUFUNC(op_8b0_4), 0, 2224 }, /* BCLR */
-{ CPUFUNC(op_8b8_4), 0, 2232 }, /* BCLR */
-{ CPUFUNC(op_8b9_4), 0, 2233 }, /* BCLR */
-{ CPUFUNC(op_8ba_4), 0, 2234 }, /* BCLR */
-{ CPUFUNC(op_8bb_4), 0, 2235 }, /* BCLR */
-{ CPUFUNC(op_8c0_4), 0, 2240 }, /* BSET */
-{ CPUFUNC(op_8d0_4), 0, 2256 }, /* BSET */
-{ CPUFUNC(op_8d8_4), 0, 2264 }, /* BSET */
-{ CPUFUNC(op_8e0_4), 0, 2272 }, /* BSET */
-{ CPUFUNC(op_8e8_4), 0, 2280 }, /* BSET */
-{ CPUFUNC(op_8f0_4), 0, 2288 }, /* BSET */
-{ CPUFUNC(op_8f8_4), 0, 2296 }, /* BSET */
-{ CPUFUNC(op_8f9_4), 0, 2297 }, /* BSET */
-{ CPUFUNC(op_8fa_4), 0, 2298 }, /* BSET */
-{ CPUFUNC(op_8fb_4), 0, 2299 }, /* BSET */
-{ CPUFUNC(op_a00_4), 0, 2560 }, /* EOR */
-{ CPUFUNC(op_a10_4), 0, 2576 }, /* EOR */
-{ CPUFUNC(op_a18_4), 0, 2584 }, /* EOR */
-{ CPUFUNC(op_a20_4), 0, 2592 }, /* EOR */
-{ CPUFUNC(op_a28_4), 0, 2600 }, /* EOR */
-{ CPUFUNC(op_a30_4), 0, 2608 }, /* EOR */
-{ CPUFUNC(op_a38_4), 0, 2616 }, /* EOR */
-{ CPUFUNC(op_a39_4), 0, 2617 }, /* EOR */
-{ CPUFUNC(op_a3c_4), 0, 2620 }, /* EORSR */
-{ CPUFUNC(op_a40_4), 0, 2624 }, /* EOR */
-{ CPUFUNC(op_a50_4), 0, 2640 }, /* EOR */
-{ CPUFUNC(op_a58_4), 0, 2648 }, /* EOR */
-{ CPUFUNC(op_a60_4), 0, 2656 }, /* EOR */
-{ CPUFUNC(op_a68_4), 0, 2664 }, /* EOR */
-{ CPUFUNC(op_a70_4), 0, 2672 }, /* EOR */
-{ CPUFUNC(op_a78_4), 0, 2680 }, /* EOR */
-{ CPUFUNC(op_a79_4), 0, 2681 }, /* EOR */
-{ CPUFUNC(op_a7c_4), 0, 2684 }, /* EORSR */
-{ CPUFUNC(op_a80_4), 0, 2688 }, /* EOR */
-{ CPUFUNC(op_a90_4), 0, 2704 }, /* EOR */
-{ CPUFUNC(op_a98_4), 0, 2712 }, /* EOR */
-{ CPUFUNC(op_aa0_4), 0, 2720 }, /* EOR */
-{ CPUFUNC(op_aa8_4), 0, 2728 }, /* EOR */
-{ CPUFUNC(op_ab0_4), 0, 2736 }, /* EOR */
-{ CPUFUNC(op_ab8_4), 0, 2744 }, /* EOR */
-{ CPUFUNC(op_ab9_4), 0, 2745 }, /* EOR */
-{ CPUFUNC(op_c00_4), 0, 3072 }, /* CMP */
-{ CPUFUNC(op_c10_4), 0, 3088 }, /* CMP */
-{ CPUFUNC(op_c18_4), 0, 3096 }, /* CMP */
-{ CPUFUNC(op_c20_4), 0, 3104 }, /* CMP */
-{ CPUFUNC(op_c28_4), 0, 3112 }, /* CMP */
-{ CPUFUNC(op_c30_4), 0, 3120 }, /* CMP */
-{ CPUFUNC(op_c38_4), 0, 3128 }, /* CMP */
-{ CPUFUNC(op_c39_4), 0, 3129 }, /* CMP */
-{ CPUFUNC(op_c3a_4), 0, 3130 }, /* CMP */
-{ CPUFUNC(op_c3b_4), 0, 3131 }, /* CMP */
-{ CPUFUNC(op_c40_4), 0, 3136 }, /* CMP */
-{ CPUFUNC(op_c50_4), 0, 3152 }, /* CMP */
-{ CPUFUNC(op_c58_4), 0, 3160 }, /* CMP */
-{ CPUFUNC(op_c60_4), 0, 3168 }, /* CMP */
-{ CPUFUNC(op_c68_4), 0, 3176 }, /* CMP */
-{ CPUFUNC(op_c70_4), 0, 3184 }, /* CMP */
-{ CPUFUNC(op_c78_4), 0, 3192 }, /* CMP */
-{ CPUFUNC(op_c79_4), 0, 3193 }, /* CMP */
-{ CPUFUNC(op_c7a_4), 0, 3194 }, /* CMP */
-{ CPUFUNC(op_c7b_4), 0, 3195 }, /* CMP */
-{ CPUFUNC(op_c80_4), 0, 3200 }, /* CMP */
-{ CPUFUNC(op_c90_4), 0, 3216 }, /* CMP */
-{ CPUFUNC(op_c98_4), 0, 3224 }, /* CMP */
-{ CPUFUNC(op_ca0_4), 0, 3232 }, /* CMP */
-{ CPUFUNC(op_ca8_4), 0, 3240 }, /* CMP */
-{ CPUFUNC(op_cb0_4), 0, 3248 }, /* CMP */
-{ CPUFUNC(op_cb8_4), 0, 3256 }, /* CMP */
-{ CPUFUNC(op_cb9_4), 0, 3257 }, /* CMP */
-{ CPUFUNC(op_cba_4), 0, 3258 }, /* CMP */
-{ CPUFUNC(op_cbb_4), 0, 3259 }, /* CMP */
-{ CPUFUNC(op_1000_4), 0, 4096 }, /* MOVE */
-{ CPUFUNC(op_1008_4), 0, 4104 }, /* MOVE */
-{ CPUFUNC(op_1010_4), 0, 4112 }, /* MOVE */
-{ CPUFUNC(op_1018_4), 0, 4120 }, /* MOVE */
-{ CPUFUNC(op_1020_4), 0, 4128 }, /* MOVE */
-{ CPUFUNC(op_1028_4), 0, 4136 }, /* MOVE */
-{ CPUFUNC(op_1030_4), 0, 4144 }, /* MOVE */
-{ CPUFUNC(op_1038_4), 0, 4152 }, /* MOVE */
-{ CPUFUNC(op_1039_4), 0, 4153 }, /* MOVE */
-{ CPUFUNC(op_103a_4), 0, 4154 }, /* MOVE */
-{ CPUFUNC(op_103b_4), 0, 4155 }, /* MOVE */
-{ CPUFUNC(op_103c_4), 0, 4156 }, /* MOVE */
-{ CPUFUNC(op_1080_4), 0, 4224 }, /* MOVE */
-{ CPUFUNC(op_1088_4), 0, 4232 }, /* MOVE */
-{ CPUFUNC(op_1090_4), 0, 4240 }, /* MOVE */
-{ CPUFUNC(op_1098_4), 0, 4248 }, /* MOVE */
-{ CPUFUNC(op_10a0_4), 0, 4256 }, /* MOVE */
-{ CPUFUNC(op_10a8_4), 0, 4264 }, /* MOVE */
-{ CPUFUNC(op_10b0_4), 0, 4272 }, /* MOVE */
-{ CPUFUNC(op_10b8_4), 0, 4280 }, /* MOVE */
-{ CPUFUNC(op_10b9_4), 0, 4281 }, /* MOVE */
-{ CPUFUNC(op_10ba_4), 0, 4282 }, /* MOVE */
-{ CPUFUNC(op_10bb_4), 0, 4283 }, /* MOVE */
-{ CPUFUNC(op_10bc_4), 0, 4284 }, /* MOVE */
-{ CPUFUNC(op_10c0_4), 0, 4288 }, /* MOVE */
-{ CPUFUNC(op_10c8_4), 0, 4296 }, /* MOVE */
-{ CPUFUNC(op_10d0_4), 0, 4304 }, /* MOVE */
-{ CPUFUNC(op_10d8_4), 0, 4312 }, /* MOVE */
-{ CPUFUNC(op_10e0_4), 0, 4320 }, /* MOVE */
-{ CPUFUNC(op_10e8_4), 0, 4328 }, /* MOVE */
-{ CPUFUNC(op_10f0_4), 0, 4336 }, /* MOVE */
-{ CPUFUNC(op_10f8_4), 0, 4344 }, /* MOVE */
-{ CPUFUNC(op_10f9_4), 0, 4345 }, /* MOVE */
-{ CPUFUNC(op_10fa_4), 0, 4346 }, /* MOVE */
-{ CPUFUNC(op_10fb_4), 0, 4347 }, /* MOVE */
-{ CPUFUNC(op_10fc_4), 0, 4348 }, /* MOVE */
-{ CPUFUNC(op_1100_4), 0, 4352 }, /* MOVE */
-{ CPUFUNC(op_1108_4), 0, 4360 }, /* MOVE */
-{ CPUFUNC(op_1110_4), 0, 4368 }, /* MOVE */
-{ CPUFUNC(op_1118_4), 0, 4376 }, /* MOVE */
-{ CPUFUNC(op_1120_4), 0, 4384 }, /* MOVE */
-{ CPUFUNC(op_1128_4), 0, 4392 }, /* MOVE */
-{ CPUFUNC(op_1130_4), 0, 4400 }, /* MOVE */
-{ CPUFUNC(op_1138_4), 0, 4408 }, /* MOVE */
-{ CPUFUNC(op_1139_4), 0, 4409 }, /* MOVE */
-{ CPUFUNC(op_113a_4), 0, 4410 }, /* MOVE */
-{ CPUFUNC(op_113b_4), 0, 4411 }, /* MOVE */
-{ CPUFUNC(op_113c_4), 0, 4412 }, /* MOVE */
-{ CPUFUNC(op_1140_4), 0, 4416 }, /* MOVE */
-{ CPUFUNC(op_1148_4), 0, 4424 }, /* MOVE */
-{ CPUFUNC(op_1150_4), 0, 4432 }, /* MOVE */
-{ CPUFUNC(op_1158_4), 0, 4440 }, /* MOVE */
-{ CPUFUNC(op_1160_4), 0, 4448 }, /* MOVE */
-{ CPUFUNC(op_1168_4), 0, 4456 }, /* MOVE */
-{ CPUFUNC(op_1170_4), 0, 4464 }, /* MOVE */
-{ CPUFUNC(op_1178_4), 0, 4472 }, /* MOVE */
-{ CPUFUNC(op_1179_4), 0, 4473 }, /* MOVE */
-{ CPUFUNC(op_117a_4), 0, 4474 }, /* MOVE */
-{ CPUFUNC(op_117b_4), 0, 4475 }, /* MOVE */
-{ CPUFUNC(op_117c_4), 0, 4476 }, /* MOVE */
-{ CPUFUNC(op_1180_4), 0, 4480 }, /* MOVE */
-{ CPUFUNC(op_1188_4), 0, 4488 }, /* MOVE */
-{ CPUFUNC(op_1190_4), 0, 4496 }, /* MOVE */
-{ CPUFUNC(op_1198_4), 0, 4504 }, /* MOVE */
-{ CPUFUNC(op_11a0_4), 0, 4512 }, /* MOVE */
-{ CPUFUNC(op_11a8_4), 0, 4520 }, /* MOVE */
-{ CPUFUNC(op_11b0_4), 0, 4528 }, /* MOVE */
-{ CPUFUNC(op_11b8_4), 0, 4536 }, /* MOVE */
-{ CPUFUNC(op_11b9_4), 0, 4537 }, /* MOVE */
-{ CPUFUNC(op_11ba_4), 0, 4538 }, /* MOVE */
-{ CPUFUNC(op_11bb_4), 0, 4539 }, /* MOVE */
-{ CPUFUNC(op_11bc_4), 0, 4540 }, /* MOVE */
-{ CPUFUNC(op_11c0_4), 0, 4544 }, /* MOVE */
-{ CPUFUNC(op_11c8_4), 0, 4552 }, /* MOVE */
-{ CPUFUNC(op_11d0_4), 0, 4560 }, /* MOVE */
-{ CPUFUNC(op_11d8_4), 0, 4568 }, /* MOVE */
-{ CPUFUNC(op_11e0_4), 0, 4576 }, /* MOVE */
-{ CPUFUNC(op_11e8_4), 0, 4584 }, /* MOVE */
-{ CPUFUNC(op_11f0_4), 0, 4592 }, /* MOVE */
-{ CPUFUNC(op_11f8_4), 0, 4600 }, /* MOVE */
-{ CPUFUNC(op_11f9_4), 0, 4601 }, /* MOVE */
-{ CPUFUNC(op_11fa_4), 0, 4602 }, /* MOVE */
-{ CPUFUNC(op_11fb_4), 0, 4603 }, /* MOVE */
-{ CPUFUNC(op_11fc_4), 0, 4604 }, /* MOVE */
-{ CPUFUNC(op_13c0_4), 0, 5056 }, /* MOVE */
-{ CPUFUNC(op_13c8_4), 0, 5064 }, /* MOVE */
-{ CPUFUNC(op_13d0_4), 0, 5072 }, /* MOVE */
-{ CPUFUNC(op_13d8_4), 0, 5080 }, /* MOVE */
-{ CPUFUNC(op_13e0_4), 0, 5088 }, /* MOVE */
-{ CPUFUNC(op_13e8_4), 0, 5096 }, /* MOVE */
-{ CPUFUNC(op_13f0_4), 0, 5104 }, /* MOVE */
-{ CPUFUNC(op_13f8_4), 0, 5112 }, /* MOVE */
-{ CPUFUNC(op_13f9_4), 0, 5113 }, /* MOVE */
-{ CPUFUNC(op_13fa_4), 0, 5114 }, /* MOVE */
-{ CPUFUNC(op_13fb_4), 0, 5115 }, /* MOVE */
-{ CPUFUNC(op_13fc_4), 0, 5116 }, /* MOVE */
-{ CPUFUNC(op_2000_4), 0, 8192 }, /* MOVE */
-{ CPUFUNC(op_2008_4), 0, 8200 }, /* MOVE */
-{ CPUFUNC(op_2010_4), 0, 8208 }, /* MOVE */
-{ CPUFUNC(op_2018_4), 0, 8216 }, /* MOVE */
-{ CPUFUNC(op_2020_4), 0, 8224 }, /* MOVE */
-{ CPUFUNC(op_2028_4), 0, 8232 }, /* MOVE */
-{ CPUFUNC(op_2030_4), 0, 8240 }, /* MOVE */
-{ CPUFUNC(op_2038_4), 0, 8248 }, /* MOVE */
-{ CPUFUNC(op_2039_4), 0, 8249 }, /* MOVE */
-{ CPUFUNC(op_203a_4), 0, 8250 }, /* MOVE */
-{ CPUFUNC(op_203b_4), 0, 8251 }, /* MOVE */
-{ CPUFUNC(op_203c_4), 0, 8252 }, /* MOVE */
-{ CPUFUNC(op_2040_4), 0, 8256 }, /* MOVEA */
-{ CPUFUNC(op_2048_4), 0, 8264 }, /* MOVEA */
-{ CPUFUNC(op_2050_4), 0, 8272 }, /* MOVEA */
-{ CPUFUNC(op_2058_4), 0, 8280 }, /* MOVEA */
-{ CPUFUNC(op_2060_4), 0, 8288 }, /* MOVEA */
-{ CPUFUNC(op_2068_4), 0, 8296 }, /* MOVEA */
-{ CPUFUNC(op_2070_4), 0, 8304 }, /* MOVEA */
-{ CPUFUNC(op_2078_4), 0, 8312 }, /* MOVEA */
-{ CPUFUNC(op_2079_4), 0, 8313 }, /* MOVEA */
-{ CPUFUNC(op_207a_4), 0, 8314 }, /* MOVEA */
-{ CPUFUNC(op_207b_4), 0, 8315 }, /* MOVEA */
-{ CPUFUNC(op_207c_4), 0, 8316 }, /* MOVEA */
-{ CPUFUNC(op_2080_4), 0, 8320 }, /* MOVE */
-{ CPUFUNC(op_2088_4), 0, 8328 }, /* MOVE */
-{ CPUFUNC(op_2090_4), 0, 8336 }, /* MOVE */
-{ CPUFUNC(op_2098_4), 0, 8344 }, /* MOVE */
-{ CPUFUNC(op_20a0_4), 0, 8352 }, /* MOVE */
-{ CPUFUNC(op_20a8_4), 0, 8360 }, /* MOVE */
-{ CPUFUNC(op_20b0_4), 0, 8368 }, /* MOVE */
-{ CPUFUNC(op_20b8_4), 0, 8376 }, /* MOVE */
-{ CPUFUNC(op_20b9_4), 0, 8377 }, /* MOVE */
-{ CPUFUNC(op_20ba_4), 0, 8378 }, /* MOVE */
-{ CPUFUNC(op_20bb_4), 0, 8379 }, /* MOVE */
-{ CPUFUNC(op_20bc_4), 0, 8380 }, /* MOVE */
-{ CPUFUNC(op_20c0_4), 0, 8384 }, /* MOVE */
-{ CPUFUNC(op_20c8_4), 0, 8392 }, /* MOVE */
-{ CPUFUNC(op_20d0_4), 0, 8400 }, /* MOVE */
-{ CPUFUNC(op_20d8_4), 0, 8408 }, /* MOVE */
-{ CPUFUNC(op_20e0_4), 0, 8416 }, /* MOVE */
-{ CPUFUNC(op_20e8_4), 0, 8424 }, /* MOVE */
-{ CPUFUNC(op_20f0_4), 0, 8432 }, /* MOVE */
-{ CPUFUNC(op_20f8_4), 0, 8440 }, /* MOVE */
-{ CPUFUNC(op_20f9_4), 0, 8441 }, /* MOVE */
-{ CPUFUNC(op_20fa_4), 0, 8442 }, /* MOVE */
-{ CPUFUNC(op_20fb_4), 0, 8443 }, /* MOVE */
-{ CPUFUNC(op_20fc_4), 0, 8444 }, /* MOVE */
-{ CPUFUNC(op_2100_4), 0, 8448 }, /* MOVE */
-{ CPUFUNC(op_2108_4), 0, 8456 }, /* MOVE */
-{ CPUFUNC(op_2110_4), 0, 8464 }, /* MOVE */
-{ CPUFUNC(op_2118_4), 0, 8472 }, /* MOVE */
-{ CPUFUNC(op_2120_4), 0, 8480 }, /* MOVE */
-{ CPUFUNC(op_2128_4), 0, 8488 }, /* MOVE */
-{ CPUFUNC(op_2130_4), 0, 8496 }, /* MOVE */
-{ CPUFUNC(op_2138_4), 0, 8504 }, /* MOVE */
-{ CPUFUNC(op_2139_4), 0, 8505 }, /* MOVE */
-{ CPUFUNC(op_213a_4), 0, 8506 }, /* MOVE */
-{ CPUFUNC(op_213b_4), 0, 8507 }, /* MOVE */
-{ CPUFUNC(op_213c_4), 0, 8508 }, /* MOVE */
-{ CPUFUNC(op_2140_4), 0, 8512 }, /* MOVE */
-{ CPUFUNC(op_2148_4), 0, 8520 }, /* MOVE */
-{ CPUFUNC(op_2150_4), 0, 8528 }, /* MOVE */
-{ CPUFUNC(op_2158_4), 0, 8536 }, /* MOVE */
-{ CPUFUNC(op_2160_4), 0, 8544 }, /* MOVE */
-{ CPUFUNC(op_2168_4), 0, 8552 }, /* MOVE */
-{ CPUFUNC(op_2170_4), 0, 8560 }, /* MOVE */
-{ CPUFUNC(op_2178_4), 0, 8568 }, /* MOVE */
-{ CPUFUNC(op_2179_4), 0, 8569 }, /* MOVE */
-{ CPUFUNC(op_217a_4), 0, 8570 }, /* MOVE */
-{ CPUFUNC(op_217b_4), 0, 8571 }, /* MOVE */
-{ CPUFUNC(op_217c_4), 0, 8572 }, /* MOVE */
-{ CPUFUNC(op_2180_4), 0, 8576 }, /* MOVE */
-{ CPUFUNC(op_2188_4), 0, 8584 }, /* MOVE */
-{ CPUFUNC(op_2190_4), 0, 8592 }, /* MOVE */
-{ CPUFUNC(op_2198_4), 0, 8600 }, /* MOVE */
-{ CPUFUNC(op_21a0_4), 0, 8608 }, /* MOVE */
-{ CPUFUNC(op_21a8_4), 0, 8616 }, /* MOVE */
-{ CPUFUNC(op_21b0_4), 0, 8624 }, /* MOVE */
-{ CPUFUNC(op_21b8_4), 0, 8632 }, /* MOVE */
-{ CPUFUNC(op_21b9_4), 0, 8633 }, /* MOVE */
-{ CPUFUNC(op_21ba_4), 0, 8634 }, /* MOVE */
-{ CPUFUNC(op_21bb_4), 0, 8635 }, /* MOVE */
-{ CPUFUNC(op_21bc_4), 0, 8636 }, /* MOVE */
-{ CPUFUNC(op_21c0_4), 0, 8640 }, /* MOVE */
-{ CPUFUNC(op_21c8_4), 0, 8648 }, /* MOVE */
-{ CPUFUNC(op_21d0_4), 0, 8656 }, /* MOVE */
-{ CPUFUNC(op_21d8_4), 0, 8664 }, /* MOVE */
-{ CPUFUNC(op_21e0_4), 0, 8672 }, /* MOVE */
-{ CPUFUNC(op_21e8_4), 0, 8680 }, /* MOVE */
-{ CPUFUNC(op_21f0_4), 0, 8688 }, /* MOVE */
-{ CPUFUNC(op_21f8_4), 0, 8696 }, /* MOVE */
-{ CPUFUNC(op_21f9_4), 0, 8697 }, /* MOVE */
-{ CPUFUNC(op_21fa_4), 0, 8698 }, /* MOVE */
-{ CPUFUNC(op_21fb_4), 0, 8699 }, /* MOVE */
-{ CPUFUNC(op_21fc_4), 0, 8700 }, /* MOVE */
-{ CPUFUNC(op_23c0_4), 0, 9152 }, /* MOVE */
-{ CPUFUNC(op_23c8_4), 0, 9160 }, /* MOVE */
-{ CPUFUNC(op_23d0_4), 0, 9168 }, /* MOVE */
-{ CPUFUNC(op_23d8_4), 0, 9176 }, /* MOVE */
-{ CPUFUNC(op_23e0_4), 0, 9184 }, /* MOVE */
-{ CPUFUNC(op_23e8_4), 0, 9192 }, /* MOVE */
-{ CPUFUNC(op_23f0_4), 0, 9200 }, /* MOVE */
-{ CPUFUNC(op_23f8_4), 0, 9208 }, /* MOVE */
-{ CPUFUNC(op_23f9_4), 0, 9209 }, /* MOVE */
-{ CPUFUNC(op_23fa_4), 0, 9210 }, /* MOVE */
-{ CPUFUNC(op_23fb_4), 0, 9211 }, /* MOVE */
-{ CPUFUNC(op_23fc_4), 0, 9212 }, /* MOVE */
-{ CPUFUNC(op_3000_4), 0, 12288 }, /* MOVE */
-{ CPUFUNC(op_3008_4), 0, 12296 }, /* MOVE */
-{ CPUFUNC(op_3010_4), 0, 12304 }, /* MOVE */
-{ CPUFUNC(op_3018_4), 0, 12312 }, /* MOVE */
-{ CPUFUNC(op_3020_4), 0, 12320 }, /* MOVE */
-{ CPUFUNC(op_3028_4), 0, 12328 }, /* MOVE */
-{ CPUFUNC(op_3030_4), 0, 12336 }, /* MOVE */
-{ CPUFUNC(op_3038_4), 0, 12344 }, /* MOVE */
-{ CPUFUNC(op_3039_4), 0, 12345 }, /* MOVE */
-{ CPUFUNC(op_303a_4), 0, 12346 }, /* MOVE */
-{ CPUFUNC(op_303b_4), 0, 12347 }, /* MOVE */
-{ CPUFUNC(op_303c_4), 0, 12348 }, /* MOVE */
-{ CPUFUNC(op_3040_4), 0, 12352 }, /* MOVEA */
-{ CPUFUNC(op_3048_4), 0, 12360 }, /* MOVEA */
-{ CPUFUNC(op_3050_4), 0, 12368 }, /* MOVEA */
-{ CPUFUNC(op_3058_4), 0, 12376 }, /* MOVEA */
-{ CPUFUNC(op_3060_4), 0, 12384 }, /* MOVEA */
-{ CPUFUNC(op_3068_4), 0, 12392 }, /* MOVEA */
-{ CPUFUNC(op_3070_4), 0, 12400 }, /* MOVEA */
-{ CPUFUNC(op_3078_4), 0, 12408 }, /* MOVEA */
-{ CPUFUNC(op_3079_4), 0, 12409 }, /* MOVEA */
-{ CPUFUNC(op_307a_4), 0, 12410 }, /* MOVEA */
-{ CPUFUNC(op_307b_4), 0, 12411 }, /* MOVEA */
-{ CPUFUNC(op_307c_4), 0, 12412 }, /* MOVEA */
-{ CPUFUNC(op_3080_4), 0, 12416 }, /* MOVE */
-{ CPUFUNC(op_3088_4), 0, 12424 }, /* MOVE */
-{ CPUFUNC(op_3090_4), 0, 12432 }, /* MOVE */
-{ CPUFUNC(op_3098_4), 0, 12440 }, /* MOVE */
-{ CPUFUNC(op_30a0_4), 0, 12448 }, /* MOVE */
-{ CPUFUNC(op_30a8_4), 0, 12456 }, /* MOVE */
-{ CPUFUNC(op_30b0_4), 0, 12464 }, /* MOVE */
-{ CPUFUNC(op_30b8_4), 0, 12472 }, /* MOVE */
-{ CPUFUNC(op_30b9_4), 0, 12473 }, /* MOVE */
-{ CPUFUNC(op_30ba_4), 0, 12474 }, /* MOVE */
-{ CPUFUNC(op_30bb_4), 0, 12475 }, /* MOVE */
-{ CPUFUNC(op_30bc_4), 0, 12476 }, /* MOVE */
-{ CPUFUNC(op_30c0_4), 0, 12480 }, /* MOVE */
-{ CPUFUNC(op_30c8_4), 0, 12488 }, /* MOVE */
-{ CPUFUNC(op_30d0_4), 0, 12496 }, /* MOVE */
-{ CPUFUNC(op_30d8_4), 0, 12504 }, /* MOVE */
-{ CPUFUNC(op_30e0_4), 0, 12512 }, /* MOVE */
-{ CPUFUNC(op_30e8_4), 0, 12520 }, /* MOVE */
-{ CPUFUNC(op_30f0_4), 0, 12528 }, /* MOVE */
-{ CPUFUNC(op_30f8_4), 0, 12536 }, /* MOVE */
-{ CPUFUNC(op_30f9_4), 0, 12537 }, /* MOVE */
-{ CPUFUNC(op_30fa_4), 0, 12538 }, /* MOVE */
-{ CPUFUNC(op_30fb_4), 0, 12539 }, /* MOVE */
-{ CPUFUNC(op_30fc_4), 0, 12540 }, /* MOVE */
-{ CPUFUNC(op_3100_4), 0, 12544 }, /* MOVE */
-{ CPUFUNC(op_3108_4), 0, 12552 }, /* MOVE */
-{ CPUFUNC(op_3110_4), 0, 12560 }, /* MOVE */
-{ CPUFUNC(op_3118_4), 0, 12568 }, /* MOVE */
-{ CPUFUNC(op_3120_4), 0, 12576 }, /* MOVE */
-{ CPUFUNC(op_3128_4), 0, 12584 }, /* MOVE */
-{ CPUFUNC(op_3130_4), 0, 12592 }, /* MOVE */
-{ CPUFUNC(op_3138_4), 0, 12600 }, /* MOVE */
-{ CPUFUNC(op_3139_4), 0, 12601 }, /* MOVE */
-{ CPUFUNC(op_313a_4), 0, 12602 }, /* MOVE */
-{ CPUFUNC(op_313b_4), 0, 12603 }, /* MOVE */
-{ CPUFUNC(op_313c_4), 0, 12604 }, /* MOVE */
-{ CPUFUNC(op_3140_4), 0, 12608 }, /* MOVE */
-{ CPUFUNC(op_3148_4), 0, 12616 }, /* MOVE */
-{ CPUFUNC(op_3150_4), 0, 12624 }, /* MOVE */
-{ CPUFUNC(op_3158_4), 0, 12632 }, /* MOVE */
-{ CPUFUNC(op_3160_4), 0, 12640 }, /* MOVE */
-{ CPUFUNC(op_3168_4), 0, 12648 }, /* MOVE */
-{ CPUFUNC(op_3170_4), 0, 12656 }, /* MOVE */
-{ CPUFUNC(op_3178_4), 0, 12664 }, /* MOVE */
-{ CPUFUNC(op_3179_4), 0, 12665 }, /* MOVE */
-{ CPUFUNC(op_317a_4), 0, 12666 }, /* MOVE */
-{ CPUFUNC(op_317b_4), 0, 12667 }, /* MOVE */
-{ CPUFUNC(op_317c_4), 0, 12668 }, /* MOVE */
-{ CPUFUNC(op_3180_4), 0, 12672 }, /* MOVE */
-{ CPUFUNC(op_3188_4), 0, 12680 }, /* MOVE */
-{ CPUFUNC(op_3190_4), 0, 12688 }, /* MOVE */
-{ CPUFUNC(op_3198_4), 0, 12696 }, /* MOVE */
-{ CPUFUNC(op_31a0_4), 0, 12704 }, /* MOVE */
-{ CPUFUNC(op_31a8_4), 0, 12712 }, /* MOVE */
-{ CPUFUNC(op_31b0_4), 0, 12720 }, /* MOVE */
-{ CPUFUNC(op_31b8_4), 0, 12728 }, /* MOVE */
-{ CPUFUNC(op_31b9_4), 0, 12729 }, /* MOVE */
-{ CPUFUNC(op_31ba_4), 0, 12730 }, /* MOVE */
-{ CPUFUNC(op_31bb_4), 0, 12731 }, /* MOVE */
-{ CPUFUNC(op_31bc_4), 0, 12732 }, /* MOVE */
-{ CPUFUNC(op_31c0_4), 0, 12736 }, /* MOVE */
-{ CPUFUNC(op_31c8_4), 0, 12744 }, /* MOVE */
-{ CPUFUNC(op_31d0_4), 0, 12752 }, /* MOVE */
-{ CPUFUNC(op_31d8_4), 0, 12760 }, /* MOVE */
-{ CPUFUNC(op_31e0_4), 0, 12768 }, /* MOVE */
-{ CPUFUNC(op_31e8_4), 0, 12776 }, /* MOVE */
-{ CPUFUNC(op_31f0_4), 0, 12784 }, /* MOVE */
-{ CPUFUNC(op_31f8_4), 0, 12792 }, /* MOVE */
-{ CPUFUNC(op_31f9_4), 0, 12793 }, /* MOVE */
-{ CPUFUNC(op_31fa_4), 0, 12794 }, /* MOVE */
-{ CPUFUNC(op_31fb_4), 0, 12795 }, /* MOVE */
-{ CPUFUNC(op_31fc_4), 0, 12796 }, /* MOVE */
-{ CPUFUNC(op_33c0_4), 0, 13248 }, /* MOVE */
-{ CPUFUNC(op_33c8_4), 0, 13256 }, /* MOVE */
-{ CPUFUNC(op_33d0_4), 0, 13264 }, /* MOVE */
-{ CPUFUNC(op_33d8_4), 0, 13272 }, /* MOVE */
-{ CPUFUNC(op_33e0_4), 0, 13280 }, /* MOVE */
-{ CPUFUNC(op_33e8_4), 0, 13288 }, /* MOVE */
-{ CPUFUNC(op_33f0_4), 0, 13296 }, /* MOVE */
-{ CPUFUNC(op_33f8_4), 0, 13304 }, /* MOVE */
-{ CPUFUNC(op_33f9_4), 0, 13305 }, /* MOVE */
-{ CPUFUNC(op_33fa_4), 0, 13306 }, /* MOVE */
-{ CPUFUNC(op_33fb_4), 0, 13307 }, /* MOVE */
-{ CPUFUNC(op_33fc_4), 0, 13308 }, /* MOVE */
-{ CPUFUNC(op_4000_4), 0, 16384 }, /* NEGX */
-{ CPUFUNC(op_4010_4), 0, 16400 }, /* NEGX */
-{ CPUFUNC(op_4018_4), 0, 16408 }, /* NEGX */
-{ CPUFUNC(op_4020_4), 0, 16416 }, /* NEGX */
-{ CPUFUNC(op_4028_4), 0, 16424 }, /* NEGX */
-{ CPUFUNC(op_4030_4), 0, 16432 }, /* NEGX */
-{ CPUFUNC(op_4038_4), 0, 16440 }, /* NEGX */
-{ CPUFUNC(op_4039_4), 0, 16441 }, /* NEGX */
-{ CPUFUNC(op_4040_4), 0, 16448 }, /* NEGX */
-{ CPUFUNC(op_4050_4), 0, 16464 }, /* NEGX */
-{ CPUFUNC(op_4058_4), 0, 16472 }, /* NEGX */
-{ CPUFUNC(op_4060_4), 0, 16480 }, /* NEGX */
-{ CPUFUNC(op_4068_4), 0, 16488 }, /* NEGX */
-{ CPUFUNC(op_4070_4), 0, 16496 }, /* NEGX */
-{ CPUFUNC(op_4078_4), 0, 16504 }, /* NEGX */
-{ CPUFUNC(op_4079_4), 0, 16505 }, /* NEGX */
-{ CPUFUNC(op_4080_4), 0, 16512 }, /* NEGX */
-{ CPUFUNC(op_4090_4), 0, 16528 }, /* NEGX */
-{ CPUFUNC(op_4098_4), 0, 16536 }, /* NEGX */
-{ CPUFUNC(op_40a0_4), 0, 16544 }, /* NEGX */
-{ CPUFUNC(op_40a8_4), 0, 16552 }, /* NEGX */
-{ CPUFUNC(op_40b0_4), 0, 16560 }, /* NEGX */
-{ CPUFUNC(op_40b8_4), 0, 16568 }, /* NEGX */
-{ CPUFUNC(op_40b9_4), 0, 16569 }, /* NEGX */
-{ CPUFUNC(op_40c0_4), 0, 16576 }, /* MVSR2 */
-{ CPUFUNC(op_40d0_4), 0, 16592 }, /* MVSR2 */
-{ CPUFUNC(op_40d8_4), 0, 16600 }, /* MVSR2 */
-{ CPUFUNC(op_40e0_4), 0, 16608 }, /* MVSR2 */
-{ CPUFUNC(op_40e8_4), 0, 16616 }, /* MVSR2 */
-{ CPUFUNC(op_40f0_4), 0, 16624 }, /* MVSR2 */
-{ CPUFUNC(op_40f8_4), 0, 16632 }, /* MVSR2 */
-{ CPUFUNC(op_40f9_4), 0, 16633 }, /* MVSR2 */
-{ CPUFUNC(op_4180_4), 0, 16768 }, /* CHK */
-{ CPUFUNC(op_4190_4), 0, 16784 }, /* CHK */
-{ CPUFUNC(op_4198_4), 0, 16792 }, /* CHK */
-{ CPUFUNC(op_41a0_4), 0, 16800 }, /* CHK */
-{ CPUFUNC(op_41a8_4), 0, 16808 }, /* CHK */
-{ CPUFUNC(op_41b0_4), 0, 16816 }, /* CHK */
-{ CPUFUNC(op_41b8_4), 0, 16824 }, /* CHK */
-{ CPUFUNC(op_41b9_4), 0, 16825 }, /* CHK */
-{ CPUFUNC(op_41ba_4), 0, 16826 }, /* CHK */
-{ CPUFUNC(op_41bb_4), 0, 16827 }, /* CHK */
-{ CPUFUNC(op_41bc_4), 0, 16828 }, /* CHK */
-{ CPUFUNC(op_41d0_4), 0, 16848 }, /* LEA */
-{ CPUFUNC(op_41e8_4), 0, 16872 }, /* LEA */
-{ CPUFUNC(op_41f0_4), 0, 16880 }, /* LEA */
-{ CPUFUNC(op_41f8_4), 0, 16888 }, /* LEA */
-{ CPUFUNC(op_41f9_4), 0, 16889 }, /* LEA */
-{ CPUFUNC(op_41fa_4), 0, 16890 }, /* LEA */
-{ CPUFUNC(op_41fb_4), 0, 16891 }, /* LEA */
-{ CPUFUNC(op_4200_4), 0, 16896 }, /* CLR */
-{ CPUFUNC(op_4210_4), 0, 16912 }, /* CLR */
-{ CPUFUNC(op_4218_4), 0, 16920 }, /* CLR */
-{ CPUFUNC(op_4220_4), 0, 16928 }, /* CLR */
-{ CPUFUNC(op_4228_4), 0, 16936 }, /* CLR */
-{ CPUFUNC(op_4230_4), 0, 16944 }, /* CLR */
-{ CPUFUNC(op_4238_4), 0, 16952 }, /* CLR */
-{ CPUFUNC(op_4239_4), 0, 16953 }, /* CLR */
-{ CPUFUNC(op_4240_4), 0, 16960 }, /* CLR */
-{ CPUFUNC(op_4250_4), 0, 16976 }, /* CLR */
-{ CPUFUNC(op_4258_4), 0, 16984 }, /* CLR */
-{ CPUFUNC(op_4260_4), 0, 16992 }, /* CLR */
-{ CPUFUNC(op_4268_4), 0, 17000 }, /* CLR */
-{ CPUFUNC(op_4270_4), 0, 17008 }, /* CLR */
-{ CPUFUNC(op_4278_4), 0, 17016 }, /* CLR */
-{ CPUFUNC(op_4279_4), 0, 17017 }, /* CLR */
-{ CPUFUNC(op_4280_4), 0, 17024 }, /* CLR */
-{ CPUFUNC(op_4290_4), 0, 17040 }, /* CLR */
-{ CPUFUNC(op_4298_4), 0, 17048 }, /* CLR */
-{ CPUFUNC(op_42a0_4), 0, 17056 }, /* CLR */
-{ CPUFUNC(op_42a8_4), 0, 17064 }, /* CLR */
-{ CPUFUNC(op_42b0_4), 0, 17072 }, /* CLR */
-{ CPUFUNC(op_42b8_4), 0, 17080 }, /* CLR */
-{ CPUFUNC(op_42b9_4), 0, 17081 }, /* CLR */
-{ CPUFUNC(op_4400_4), 0, 17408 }, /* NEG */
-{ CPUFUNC(op_4410_4), 0, 17424 }, /* NEG */
-{ CPUFUNC(op_4418_4), 0, 17432 }, /* NEG */
-{ CPUFUNC(op_4420_4), 0, 17440 }, /* NEG */
-{ CPUFUNC(op_4428_4), 0, 17448 }, /* NEG */
-{ CPUFUNC(op_4430_4), 0, 17456 }, /* NEG */
-{ CPUFUNC(op_4438_4), 0, 17464 }, /* NEG */
-{ CPUFUNC(op_4439_4), 0, 17465 }, /* NEG */
-{ CPUFUNC(op_4440_4), 0, 17472 }, /* NEG */
-{ CPUFUNC(op_4450_4), 0, 17488 }, /* NEG */
-{ CPUFUNC(op_4458_4), 0, 17496 }, /* NEG */
-{ CPUFUNC(op_4460_4), 0, 17504 }, /* NEG */
-{ CPUFUNC(op_4468_4), 0, 17512 }, /* NEG */
-{ CPUFUNC(op_4470_4), 0, 17520 }, /* NEG */
-{ CPUFUNC(op_4478_4), 0, 17528 }, /* NEG */
-{ CPUFUNC(op_4479_4), 0, 17529 }, /* NEG */
-{ CPUFUNC(op_4480_4), 0, 17536 }, /* NEG */
-{ CPUFUNC(op_4490_4), 0, 17552 }, /* NEG */
-{ CPUFUNC(op_4498_4), 0, 17560 }, /* NEG */
-{ CPUFUNC(op_44a0_4), 0, 17568 }, /* NEG */
-{ CPUFUNC(op_44a8_4), 0, 17576 }, /* NEG */
-{ CPUFUNC(op_44b0_4), 0, 17584 }, /* NEG */
-{ CPUFUNC(op_44b8_4), 0, 17592 }, /* NEG */
-{ CPUFUNC(op_44b9_4), 0, 17593 }, /* NEG */
-{ CPUFUNC(op_44c0_4), 0, 17600 }, /* MV2SR */
-{ CPUFUNC(op_44d0_4), 0, 17616 }, /* MV2SR */
-{ CPUFUNC(op_44d8_4), 0, 17624 }, /* MV2SR */
-{ CPUFUNC(op_44e0_4), 0, 17632 }, /* MV2SR */
-{ CPUFUNC(op_44e8_4), 0, 17640 }, /* MV2SR */
-{ CPUFUNC(op_44f0_4), 0, 17648 }, /* MV2SR */
-{ CPUFUNC(op_44f8_4), 0, 17656 }, /* MV2SR */
-{ CPUFUNC(op_44f9_4), 0, 17657 }, /* MV2SR */
-{ CPUFUNC(op_44fa_4), 0, 17658 }, /* MV2SR */
-{ CPUFUNC(op_44fb_4), 0, 17659 }, /* MV2SR */
-{ CPUFUNC(op_44fc_4), 0, 17660 }, /* MV2SR */
-{ CPUFUNC(op_4600_4), 0, 17920 }, /* NOT */
-{ CPUFUNC(op_4610_4), 0, 17936 }, /* NOT */
-{ CPUFUNC(op_4618_4), 0, 17944 }, /* NOT */
-{ CPUFUNC(op_4620_4), 0, 17952 }, /* NOT */
-{ CPUFUNC(op_4628_4), 0, 17960 }, /* NOT */
-{ CPUFUNC(op_4630_4), 0, 17968 }, /* NOT */
-{ CPUFUNC(op_4638_4), 0, 17976 }, /* NOT */
-{ CPUFUNC(op_4639_4), 0, 17977 }, /* NOT */
-{ CPUFUNC(op_4640_4), 0, 17984 }, /* NOT */
-{ CPUFUNC(op_4650_4), 0, 18000 }, /* NOT */
-{ CPUFUNC(op_4658_4), 0, 18008 }, /* NOT */
-{ CPUFUNC(op_4660_4), 0, 18016 }, /* NOT */
-{ CPUFUNC(op_4668_4), 0, 18024 }, /* NOT */
-{ CPUFUNC(op_4670_4), 0, 18032 }, /* NOT */
-{ CPUFUNC(op_4678_4), 0, 18040 }, /* NOT */
-{ CPUFUNC(op_4679_4), 0, 18041 }, /* NOT */
-{ CPUFUNC(op_4680_4), 0, 18048 }, /* NOT */
-{ CPUFUNC(op_4690_4), 0, 18064 }, /* NOT */
-{ CPUFUNC(op_4698_4), 0, 18072 }, /* NOT */
-{ CPUFUNC(op_46a0_4), 0, 18080 }, /* NOT */
-{ CPUFUNC(op_46a8_4), 0, 18088 }, /* NOT */
-{ CPUFUNC(op_46b0_4), 0, 18096 }, /* NOT */
-{ CPUFUNC(op_46b8_4), 0, 18104 }, /* NOT */
-{ CPUFUNC(op_46b9_4), 0, 18105 }, /* NOT */
-{ CPUFUNC(op_46c0_4), 0, 18112 }, /* MV2SR */
-{ CPUFUNC(op_46d0_4), 0, 18128 }, /* MV2SR */
-{ CPUFUNC(op_46d8_4), 0, 18136 }, /* MV2SR */
-{ CPUFUNC(op_46e0_4), 0, 18144 }, /* MV2SR */
-{ CPUFUNC(op_46e8_4), 0, 18152 }, /* MV2SR */
-{ CPUFUNC(op_46f0_4), 0, 18160 }, /* MV2SR */
-{ CPUFUNC(op_46f8_4), 0, 18168 }, /* MV2SR */
-{ CPUFUNC(op_46f9_4), 0, 18169 }, /* MV2SR */
-{ CPUFUNC(op_46fa_4), 0, 18170 }, /* MV2SR */
-{ CPUFUNC(op_46fb_4), 0, 18171 }, /* MV2SR */
-{ CPUFUNC(op_46fc_4), 0, 18172 }, /* MV2SR */
-{ CPUFUNC(op_4800_4), 0, 18432 }, /* NBCD */
-{ CPUFUNC(op_4810_4), 0, 18448 }, /* NBCD */
-{ CPUFUNC(op_4818_4), 0, 18456 }, /* NBCD */
-{ CPUFUNC(op_4820_4), 0, 18464 }, /* NBCD */
-{ CPUFUNC(op_4828_4), 0, 18472 }, /* NBCD */
-{ CPUFUNC(op_4830_4), 0, 18480 }, /* NBCD */
-{ CPUFUNC(op_4838_4), 0, 18488 }, /* NBCD */
-{ CPUFUNC(op_4839_4), 0, 18489 }, /* NBCD */
-{ CPUFUNC(op_4840_4), 0, 18496 }, /* SWAP */
-{ CPUFUNC(op_4850_4), 0, 18512 }, /* PEA */
-{ CPUFUNC(op_4868_4), 0, 18536 }, /* PEA */
-{ CPUFUNC(op_4870_4), 0, 18544 }, /* PEA */
-{ CPUFUNC(op_4878_4), 0, 18552 }, /* PEA */
-{ CPUFUNC(op_4879_4), 0, 18553 }, /* PEA */
-{ CPUFUNC(op_487a_4), 0, 18554 }, /* PEA */
-{ CPUFUNC(op_487b_4), 0, 18555 }, /* PEA */
-{ CPUFUNC(op_4880_4), 0, 18560 }, /* EXT */
-{ CPUFUNC(op_4890_4), 0, 18576 }, /* MVMLE */
-{ CPUFUNC(op_48a0_4), 0, 18592 }, /* MVMLE */
-{ CPUFUNC(op_48a8_4), 0, 18600 }, /* MVMLE */
-{ CPUFUNC(op_48b0_4), 0, 18608 }, /* MVMLE */
-{ CPUFUNC(op_48b8_4), 0, 18616 }, /* MVMLE */
-{ CPUFUNC(op_48b9_4), 0, 18617 }, /* MVMLE */
-{ CPUFUNC(op_48c0_4), 0, 18624 }, /* EXT */
-{ CPUFUNC(op_48d0_4), 0, 18640 }, /* MVMLE */
-{ CPUFUNC(op_48e0_4), 0, 18656 }, /* MVMLE */
-{ CPUFUNC(op_48e8_4), 0, 18664 }, /* MVMLE */
-{ CPUFUNC(op_48f0_4), 0, 18672 }, /* MVMLE */
-{ CPUFUNC(op_48f8_4), 0, 18680 }, /* MVMLE */
-{ CPUFUNC(op_48f9_4), 0, 18681 }, /* MVMLE */
-{ CPUFUNC(op_4a00_4), 0, 18944 }, /* TST */
-{ CPUFUNC(op_4a10_4), 0, 18960 }, /* TST */
-{ CPUFUNC(op_4a18_4), 0, 18968 }, /* TST */
-{ CPUFUNC(op_4a20_4), 0, 18976 }, /* TST */
-{ CPUFUNC(op_4a28_4), 0, 18984 }, /* TST */
-{ CPUFUNC(op_4a30_4), 0, 18992 }, /* TST */
-{ CPUFUNC(op_4a38_4), 0, 19000 }, /* TST */
-{ CPUFUNC(op_4a39_4), 0, 19001 }, /* TST */
-{ CPUFUNC(op_4a3a_4), 0, 19002 }, /* TST */
-{ CPUFUNC(op_4a3b_4), 0, 19003 }, /* TST */
-{ CPUFUNC(op_4a3c_4), 0, 19004 }, /* TST */
-{ CPUFUNC(op_4a40_4), 0, 19008 }, /* TST */
-{ CPUFUNC(op_4a48_4), 0, 19016 }, /* TST */
-{ CPUFUNC(op_4a50_4), 0, 19024 }, /* TST */
-{ CPUFUNC(op_4a58_4), 0, 19032 }, /* TST */
-{ CPUFUNC(op_4a60_4), 0, 19040 }, /* TST */
-{ CPUFUNC(op_4a68_4), 0, 19048 }, /* TST */
-{ CPUFUNC(op_4a70_4), 0, 19056 }, /* TST */
-{ CPUFUNC(op_4a78_4), 0, 19064 }, /* TST */
-{ CPUFUNC(op_4a79_4), 0, 19065 }, /* TST */
-{ CPUFUNC(op_4a7a_4), 0, 19066 }, /* TST */
-{ CPUFUNC(op_4a7b_4), 0, 19067 }, /* TST */
-{ CPUFUNC(op_4a7c_4), 0, 19068 }, /* TST */
-{ CPUFUNC(op_4a80_4), 0, 19072 }, /* TST */
-{ CPUFUNC(op_4a88_4), 0, 19080 }, /* TST */
-{ CPUFUNC(op_4a90_4), 0, 19088 }, /* TST */
-{ CPUFUNC(op_4a98_4), 0, 19096 }, /* TST */
-{ CPUFUNC(op_4aa0_4), 0, 19104 }, /* TST */
-{ CPUFUNC(op_4aa8_4), 0, 19112 }, /* TST */
-{ CPUFUNC(op_4ab0_4), 0, 19120 }, /* TST */
-{ CPUFUNC(op_4ab8_4), 0, 19128 }, /* TST */
-{ CPUFUNC(op_4ab9_4), 0, 19129 }, /* TST */
-{ CPUFUNC(op_4aba_4), 0, 19130 }, /* TST */
-{ CPUFUNC(op_4abb_4), 0, 19131 }, /* TST */
-{ CPUFUNC(op_4abc_4), 0, 19132 }, /* TST */
-{ CPUFUNC(op_4ac0_4), 0, 19136 }, /* TAS */
-{ CPUFUNC(op_4ad0_4), 0, 19152 }, /* TAS */
-{ CPUFUNC(op_4ad8_4), 0, 19160 }, /* TAS */
-{ CPUFUNC(op_4ae0_4), 0, 19168 }, /* TAS */
-{ CPUFUNC(op_4ae8_4), 0, 19176 }, /* TAS */
-{ CPUFUNC(op_4af0_4), 0, 19184 }, /* TAS */
-{ CPUFUNC(op_4af8_4), 0, 19192 }, /* TAS */
-{ CPUFUNC(op_4af9_4), 0, 19193 }, /* TAS */
-{ CPUFUNC(op_4c90_4), 0, 19600 }, /* MVMEL */
-{ CPUFUNC(op_4c98_4), 0, 19608 }, /* MVMEL */
-{ CPUFUNC(op_4ca8_4), 0, 19624 }, /* MVMEL */
-{ CPUFUNC(op_4cb0_4), 0, 19632 }, /* MVMEL */
-{ CPUFUNC(op_4cb8_4), 0, 19640 }, /* MVMEL */
-{ CPUFUNC(op_4cb9_4), 0, 19641 }, /* MVMEL */
-{ CPUFUNC(op_4cba_4), 0, 19642 }, /* MVMEL */
-{ CPUFUNC(op_4cbb_4), 0, 19643 }, /* MVMEL */
-{ CPUFUNC(op_4cd0_4), 0, 19664 }, /* MVMEL */
-{ CPUFUNC(op_4cd8_4), 0, 19672 }, /* MVMEL */
-{ CPUFUNC(op_4ce8_4), 0, 19688 }, /* MVMEL */
-{ CPUFUNC(op_4cf0_4), 0, 19696 }, /* MVMEL */
-{ CPUFUNC(op_4cf8_4), 0, 19704 }, /* MVMEL */
-{ CPUFUNC(op_4cf9_4), 0, 19705 }, /* MVMEL */
-{ CPUFUNC(op_4cfa_4), 0, 19706 }, /* MVMEL */
-{ CPUFUNC(op_4cfb_4), 0, 19707 }, /* MVMEL */
-{ CPUFUNC(op_4e40_4), 0, 20032 }, /* TRAP */
-{ CPUFUNC(op_4e50_4), 0, 20048 }, /* LINK */
-{ CPUFUNC(op_4e58_4), 0, 20056 }, /* UNLK */
-{ CPUFUNC(op_4e60_4), 0, 20064 }, /* MVR2USP */
-{ CPUFUNC(op_4e68_4), 0, 20072 }, /* MVUSP2R */
-{ CPUFUNC(op_4e70_4), 0, 20080 }, /* RESET */
-{ CPUFUNC(op_4e71_4), 0, 20081 }, /* NOP */
-{ CPUFUNC(op_4e72_4), 0, 20082 }, /* STOP */
-{ CPUFUNC(op_4e73_4), 0, 20083 }, /* RTE */
-{ CPUFUNC(op_4e74_4), 0, 20084 }, /* RTD */
-{ CPUFUNC(op_4e75_4), 0, 20085 }, /* RTS */
-{ CPUFUNC(op_4e76_4), 0, 20086 }, /* TRAPV */
-{ CPUFUNC(op_4e77_4), 0, 20087 }, /* RTR */
-{ CPUFUNC(op_4e90_4), 0, 20112 }, /* JSR */
-{ CPUFUNC(op_4ea8_4), 0, 20136 }, /* JSR */
-{ CPUFUNC(op_4eb0_4), 0, 20144 }, /* JSR */
-{ CPUFUNC(op_4eb8_4), 0, 20152 }, /* JSR */
-{ CPUFUNC(op_4eb9_4), 0, 20153 }, /* JSR */
-{ CPUFUNC(op_4eba_4), 0, 20154 }, /* JSR */
-{ CPUFUNC(op_4ebb_4), 0, 20155 }, /* JSR */
-{ CPUFUNC(op_4ed0_4), 0, 20176 }, /* JMP */
-{ CPUFUNC(op_4ee8_4), 0, 20200 }, /* JMP */
-{ CPUFUNC(op_4ef0_4), 0, 20208 }, /* JMP */
-{ CPUFUNC(op_4ef8_4), 0, 20216 }, /* JMP */
-{ CPUFUNC(op_4ef9_4), 0, 20217 }, /* JMP */
-{ CPUFUNC(op_4efa_4), 0, 20218 }, /* JMP */
-{ CPUFUNC(op_4efb_4), 0, 20219 }, /* JMP */
-{ CPUFUNC(op_5000_4), 0, 20480 }, /* ADD */
-{ CPUFUNC(op_5010_4), 0, 20496 }, /* ADD */
-{ CPUFUNC(op_5018_4), 0, 20504 }, /* ADD */
-{ CPUFUNC(op_5020_4), 0, 20512 }, /* ADD */
-{ CPUFUNC(op_5028_4), 0, 20520 }, /* ADD */
-{ CPUFUNC(op_5030_4), 0, 20528 }, /* ADD */
-{ CPUFUNC(op_5038_4), 0, 20536 }, /* ADD */
-{ CPUFUNC(op_5039_4), 0, 20537 }, /* ADD */
-{ CPUFUNC(op_5040_4), 0, 20544 }, /* ADD */
-{ CPUFUNC(op_5048_4), 0, 20552 }, /* ADDA */
-{ CPUFUNC(op_5050_4), 0, 20560 }, /* ADD */
-{ CPUFUNC(op_5058_4), 0, 20568 }, /* ADD */
-{ CPUFUNC(op_5060_4), 0, 20576 }, /* ADD */
-{ CPUFUNC(op_5068_4), 0, 20584 }, /* ADD */
-{ CPUFUNC(op_5070_4), 0, 20592 }, /* ADD */
-{ CPUFUNC(op_5078_4), 0, 20600 }, /* ADD */
-{ CPUFUNC(op_5079_4), 0, 20601 }, /* ADD */
-{ CPUFUNC(op_5080_4), 0, 20608 }, /* ADD */
-{ CPUFUNC(op_5088_4), 0, 20616 }, /* ADDA */
-{ CPUFUNC(op_5090_4), 0, 20624 }, /* ADD */
-{ CPUFUNC(op_5098_4), 0, 20632 }, /* ADD */
-{ CPUFUNC(op_50a0_4), 0, 20640 }, /* ADD */
-{ CPUFUNC(op_50a8_4), 0, 20648 }, /* ADD */
-{ CPUFUNC(op_50b0_4), 0, 20656 }, /* ADD */
-{ CPUFUNC(op_50b8_4), 0, 20664 }, /* ADD */
-{ CPUFUNC(op_50b9_4), 0, 20665 }, /* ADD */
-{ CPUFUNC(op_50c0_4), 0, 20672 }, /* Scc */
-{ CPUFUNC(op_50c8_4), 0, 20680 }, /* DBcc */
-{ CPUFUNC(op_50d0_4), 0, 20688 }, /* Scc */
-{ CPUFUNC(op_50d8_4), 0, 20696 }, /* Scc */
-{ CPUFUNC(op_50e0_4), 0, 20704 }, /* Scc */
-{ CPUFUNC(op_50e8_4), 0, 20712 }, /* Scc */
-{ CPUFUNC(op_50f0_4), 0, 20720 }, /* Scc */
-{ CPUFUNC(op_50f8_4), 0, 20728 }, /* Scc */
-{ CPUFUNC(op_50f9_4), 0, 20729 }, /* Scc */
-{ CPUFUNC(op_5100_4), 0, 20736 }, /* SUB */
-{ CPUFUNC(op_5110_4), 0, 20752 }, /* SUB */
-{ CPUFUNC(op_5118_4), 0, 20760 }, /* SUB */
-{ CPUFUNC(op_5120_4), 0, 20768 }, /* SUB */
-{ CPUFUNC(op_5128_4), 0, 20776 }, /* SUB */
-{ CPUFUNC(op_5130_4), 0, 20784 }, /* SUB */
-{ CPUFUNC(op_5138_4), 0, 20792 }, /* SUB */
-{ CPUFUNC(op_5139_4), 0, 20793 }, /* SUB */
-{ CPUFUNC(op_5140_4), 0, 20800 }, /* SUB */
-{ CPUFUNC(op_5148_4), 0, 20808 }, /* SUBA */
-{ CPUFUNC(op_5150_4), 0, 20816 }, /* SUB */
-{ CPUFUNC(op_5158_4), 0, 20824 }, /* SUB */
-{ CPUFUNC(op_5160_4), 0, 20832 }, /* SUB */
-{ CPUFUNC(op_5168_4), 0, 20840 }, /* SUB */
-{ CPUFUNC(op_5170_4), 0, 20848 }, /* SUB */
-{ CPUFUNC(op_5178_4), 0, 20856 }, /* SUB */
-{ CPUFUNC(op_5179_4), 0, 20857 }, /* SUB */
-{ CPUFUNC(op_5180_4), 0, 20864 }, /* SUB */
-{ CPUFUNC(op_5188_4), 0, 20872 }, /* SUBA */
-{ CPUFUNC(op_5190_4), 0, 20880 }, /* SUB */
-{ CPUFUNC(op_5198_4), 0, 20888 }, /* SUB */
-{ CPUFUNC(op_51a0_4), 0, 20896 }, /* SUB */
-{ CPUFUNC(op_51a8_4), 0, 20904 }, /* SUB */
-{ CPUFUNC(op_51b0_4), 0, 20912 }, /* SUB */
-{ CPUFUNC(op_51b8_4), 0, 20920 }, /* SUB */
-{ CPUFUNC(op_51b9_4), 0, 20921 }, /* SUB */
-{ CPUFUNC(op_51c0_4), 0, 20928 }, /* Scc */
-{ CPUFUNC(op_51c8_4), 0, 20936 }, /* DBcc */
-{ CPUFUNC(op_51d0_4), 0, 20944 }, /* Scc */
-{ CPUFUNC(op_51d8_4), 0, 20952 }, /* Scc */
-{ CPUFUNC(op_51e0_4), 0, 20960 }, /* Scc */
-{ CPUFUNC(op_51e8_4), 0, 20968 }, /* Scc */
-{ CPUFUNC(op_51f0_4), 0, 20976 }, /* Scc */
-{ CPUFUNC(op_51f8_4), 0, 20984 }, /* Scc */
-{ CPUFUNC(op_51f9_4), 0, 20985 }, /* Scc */
-{ CPUFUNC(op_52c0_4), 0, 21184 }, /* Scc */
-{ CPUFUNC(op_52c8_4), 0, 21192 }, /* DBcc */
-{ CPUFUNC(op_52d0_4), 0, 21200 }, /* Scc */
-{ CPUFUNC(op_52d8_4), 0, 21208 }, /* Scc */
-{ CPUFUNC(op_52e0_4), 0, 21216 }, /* Scc */
-{ CPUFUNC(op_52e8_4), 0, 21224 }, /* Scc */
-{ CPUFUNC(op_52f0_4), 0, 21232 }, /* Scc */
-{ CPUFUNC(op_52f8_4), 0, 21240 }, /* Scc */
-{ CPUFUNC(op_52f9_4), 0, 21241 }, /* Scc */
-{ CPUFUNC(op_53c0_4), 0, 21440 }, /* Scc */
-{ CPUFUNC(op_53c8_4), 0, 21448 }, /* DBcc */
-{ CPUFUNC(op_53d0_4), 0, 21456 }, /* Scc */
-{ CPUFUNC(op_53d8_4), 0, 21464 }, /* Scc */
-{ CPUFUNC(op_53e0_4), 0, 21472 }, /* Scc */
-{ CPUFUNC(op_53e8_4), 0, 21480 }, /* Scc */
-{ CPUFUNC(op_53f0_4), 0, 21488 }, /* Scc */
-{ CPUFUNC(op_53f8_4), 0, 21496 }, /* Scc */
-{ CPUFUNC(op_53f9_4), 0, 21497 }, /* Scc */
-{ CPUFUNC(op_54c0_4), 0, 21696 }, /* Scc */
-{ CPUFUNC(op_54c8_4), 0, 21704 }, /* DBcc */
-{ CPUFUNC(op_54d0_4), 0, 21712 }, /* Scc */
-{ CPUFUNC(op_54d8_4), 0, 21720 }, /* Scc */
-{ CPUFUNC(op_54e0_4), 0, 21728 }, /* Scc */
-{ CPUFUNC(op_54e8_4), 0, 21736 }, /* Scc */
-{ CPUFUNC(op_54f0_4), 0, 21744 }, /* Scc */
-{ CPUFUNC(op_54f8_4), 0, 21752 }, /* Scc */
-{ CPUFUNC(op_54f9_4), 0, 21753 }, /* Scc */
-{ CPUFUNC(op_55c0_4), 0, 21952 }, /* Scc */
-{ CPUFUNC(op_55c8_4), 0, 21960 }, /* DBcc */
-{ CPUFUNC(op_55d0_4), 0, 21968 }, /* Scc */
-{ CPUFUNC(op_55d8_4), 0, 21976 }, /* Scc */
-{ CPUFUNC(op_55e0_4), 0, 21984 }, /* Scc */
-{ CPUFUNC(op_55e8_4), 0, 21992 }, /* Scc */
-{ CPUFUNC(op_55f0_4), 0, 22000 }, /* Scc */
-{ CPUFUNC(op_55f8_4), 0, 22008 }, /* Scc */
-{ CPUFUNC(op_55f9_4), 0, 22009 }, /* Scc */
-{ CPUFUNC(op_56c0_4), 0, 22208 }, /* Scc */
-{ CPUFUNC(op_56c8_4), 0, 22216 }, /* DBcc */
-{ CPUFUNC(op_56d0_4), 0, 22224 }, /* Scc */
-{ CPUFUNC(op_56d8_4), 0, 22232 }, /* Scc */
-{ CPUFUNC(op_56e0_4), 0, 22240 }, /* Scc */
-{ CPUFUNC(op_56e8_4), 0, 22248 }, /* Scc */
-{ CPUFUNC(op_56f0_4), 0, 22256 }, /* Scc */
-{ CPUFUNC(op_56f8_4), 0, 22264 }, /* Scc */
-{ CPUFUNC(op_56f9_4), 0, 22265 }, /* Scc */
-{ CPUFUNC(op_57c0_4), 0, 22464 }, /* Scc */
-{ CPUFUNC(op_57c8_4), 0, 22472 }, /* DBcc */
-{ CPUFUNC(op_57d0_4), 0, 22480 }, /* Scc */
-{ CPUFUNC(op_57d8_4), 0, 22488 }, /* Scc */
-{ CPUFUNC(op_57e0_4), 0, 22496 }, /* Scc */
-{ CPUFUNC(op_57e8_4), 0, 22504 }, /* Scc */
-{ CPUFUNC(op_57f0_4), 0, 22512 }, /* Scc */
-{ CPUFUNC(op_57f8_4), 0, 22520 }, /* Scc */
-{ CPUFUNC(op_57f9_4), 0, 22521 }, /* Scc */
-{ CPUFUNC(op_58c0_4), 0, 22720 }, /* Scc */
-{ CPUFUNC(op_58c8_4), 0, 22728 }, /* DBcc */
-{ CPUFUNC(op_58d0_4), 0, 22736 }, /* Scc */
-{ CPUFUNC(op_58d8_4), 0, 22744 }, /* Scc */
-{ CPUFUNC(op_58e0_4), 0, 22752 }, /* Scc */
-{ CPUFUNC(op_58e8_4), 0, 22760 }, /* Scc */
-{ CPUFUNC(op_58f0_4), 0, 22768 }, /* Scc */
-{ CPUFUNC(op_58f8_4), 0, 22776 }, /* Scc */
-{ CPUFUNC(op_58f9_4), 0, 22777 }, /* Scc */
-{ CPUFUNC(op_59c0_4), 0, 22976 }, /* Scc */
-{ CPUFUNC(op_59c8_4), 0, 22984 }, /* DBcc */
-{ CPUFUNC(op_59d0_4), 0, 22992 }, /* Scc */
-{ CPUFUNC(op_59d8_4), 0, 23000 }, /* Scc */
-{ CPUFUNC(op_59e0_4), 0, 23008 }, /* Scc */
-{ CPUFUNC(op_59e8_4), 0, 23016 }, /* Scc */
-{ CPUFUNC(op_59f0_4), 0, 23024 }, /* Scc */
-{ CPUFUNC(op_59f8_4), 0, 23032 }, /* Scc */
-{ CPUFUNC(op_59f9_4), 0, 23033 }, /* Scc */
-{ CPUFUNC(op_5ac0_4), 0, 23232 }, /* Scc */
-{ CPUFUNC(op_5ac8_4), 0, 23240 }, /* DBcc */
-{ CPUFUNC(op_5ad0_4), 0, 23248 }, /* Scc */
-{ CPUFUNC(op_5ad8_4), 0, 23256 }, /* Scc */
-{ CPUFUNC(op_5ae0_4), 0, 23264 }, /* Scc */
-{ CPUFUNC(op_5ae8_4), 0, 23272 }, /* Scc */
-{ CPUFUNC(op_5af0_4), 0, 23280 }, /* Scc */
-{ CPUFUNC(op_5af8_4), 0, 23288 }, /* Scc */
-{ CPUFUNC(op_5af9_4), 0, 23289 }, /* Scc */
-{ CPUFUNC(op_5bc0_4), 0, 23488 }, /* Scc */
-{ CPUFUNC(op_5bc8_4), 0, 23496 }, /* DBcc */
-{ CPUFUNC(op_5bd0_4), 0, 23504 }, /* Scc */
-{ CPUFUNC(op_5bd8_4), 0, 23512 }, /* Scc */
-{ CPUFUNC(op_5be0_4), 0, 23520 }, /* Scc */
-{ CPUFUNC(op_5be8_4), 0, 23528 }, /* Scc */
-{ CPUFUNC(op_5bf0_4), 0, 23536 }, /* Scc */
-{ CPUFUNC(op_5bf8_4), 0, 23544 }, /* Scc */
-{ CPUFUNC(op_5bf9_4), 0, 23545 }, /* Scc */
-{ CPUFUNC(op_5cc0_4), 0, 23744 }, /* Scc */
-{ CPUFUNC(op_5cc8_4), 0, 23752 }, /* DBcc */
-{ CPUFUNC(op_5cd0_4), 0, 23760 }, /* Scc */
-{ CPUFUNC(op_5cd8_4), 0, 23768 }, /* Scc */
-{ CPUFUNC(op_5ce0_4), 0, 23776 }, /* Scc */
-{ CPUFUNC(op_5ce8_4), 0, 23784 }, /* Scc */
-{ CPUFUNC(op_5cf0_4), 0, 23792 }, /* Scc */
-{ CPUFUNC(op_5cf8_4), 0, 23800 }, /* Scc */
-{ CPUFUNC(op_5cf9_4), 0, 23801 }, /* Scc */
-{ CPUFUNC(op_5dc0_4), 0, 24000 }, /* Scc */
-{ CPUFUNC(op_5dc8_4), 0, 24008 }, /* DBcc */
-{ CPUFUNC(op_5dd0_4), 0, 24016 }, /* Scc */
-{ CPUFUNC(op_5dd8_4), 0, 24024 }, /* Scc */
-{ CPUFUNC(op_5de0_4), 0, 24032 }, /* Scc */
-{ CPUFUNC(op_5de8_4), 0, 24040 }, /* Scc */
-{ CPUFUNC(op_5df0_4), 0, 24048 }, /* Scc */
-{ CPUFUNC(op_5df8_4), 0, 24056 }, /* Scc */
-{ CPUFUNC(op_5df9_4), 0, 24057 }, /* Scc */
-{ CPUFUNC(op_5ec0_4), 0, 24256 }, /* Scc */
-{ CPUFUNC(op_5ec8_4), 0, 24264 }, /* DBcc */
-{ CPUFUNC(op_5ed0_4), 0, 24272 }, /* Scc */
-{ CPUFUNC(op_5ed8_4), 0, 24280 }, /* Scc */
-{ CPUFUNC(op_5ee0_4), 0, 24288 }, /* Scc */
-{ CPUFUNC(op_5ee8_4), 0, 24296 }, /* Scc */
-{ CPUFUNC(op_5ef0_4), 0, 24304 }, /* Scc */
-{ CPUFUNC(op_5ef8_4), 0, 24312 }, /* Scc */
-{ CPUFUNC(op_5ef9_4), 0, 24313 }, /* Scc */
-{ CPUFUNC(op_5fc0_4), 0, 24512 }, /* Scc */
-{ CPUFUNC(op_5fc8_4), 0, 24520 }, /* DBcc */
-{ CPUFUNC(op_5fd0_4), 0, 24528 }, /* Scc */
-{ CPUFUNC(op_5fd8_4), 0, 24536 }, /* Scc */
-{ CPUFUNC(op_5fe0_4), 0, 24544 }, /* Scc */
-{ CPUFUNC(op_5fe8_4), 0, 24552 }, /* Scc */
-{ CPUFUNC(op_5ff0_4), 0, 24560 }, /* Scc */
-{ CPUFUNC(op_5ff8_4), 0, 24568 }, /* Scc */
-{ CPUFUNC(op_5ff9_4), 0, 24569 }, /* Scc */
-{ CPUFUNC(op_6000_4), 0, 24576 }, /* Bcc */
-{ CPUFUNC(op_6001_4), 0, 24577 }, /* Bcc */
-{ CPUFUNC(op_60ff_4), 0, 24831 }, /* Bcc */
-{ CPUFUNC(op_6100_4), 0, 24832 }, /* BSR */
-{ CPUFUNC(op_6101_4), 0, 24833 }, /* BSR */
-{ CPUFUNC(op_61ff_4), 0, 25087 }, /* BSR */
-{ CPUFUNC(op_6200_4), 0, 25088 }, /* Bcc */
-{ CPUFUNC(op_6201_4), 0, 25089 }, /* Bcc */
-{ CPUFUNC(op_62ff_4), 0, 25343 }, /* Bcc */
-{ CPUFUNC(op_6300_4), 0, 25344 }, /* Bcc */
-{ CPUFUNC(op_6301_4), 0, 25345 }, /* Bcc */
-{ CPUFUNC(op_63ff_4), 0, 25599 }, /* Bcc */
-{ CPUFUNC(op_6400_4), 0, 25600 }, /* Bcc */
-{ CPUFUNC(op_6401_4), 0, 25601 }, /* Bcc */
-{ CPUFUNC(op_64ff_4), 0, 25855 }, /* Bcc */
-{ CPUFUNC(op_6500_4), 0, 25856 }, /* Bcc */
-{ CPUFUNC(op_6501_4), 0, 25857 }, /* Bcc */
-{ CPUFUNC(op_65ff_4), 0, 26111 }, /* Bcc */
-{ CPUFUNC(op_6600_4), 0, 26112 }, /* Bcc */
-{ CPUFUNC(op_6601_4), 0, 26113 }, /* Bcc */
-{ CPUFUNC(op_66ff_4), 0, 26367 }, /* Bcc */
-{ CPUFUNC(op_6700_4), 0, 26368 }, /* Bcc */
-{ CPUFUNC(op_6701_4), 0, 26369 }, /* Bcc */
-{ CPUFUNC(op_67ff_4), 0, 26623 }, /* Bcc */
-{ CPUFUNC(op_6800_4), 0, 26624 }, /* Bcc */
-{ CPUFUNC(op_6801_4), 0, 26625 }, /* Bcc */
-{ CPUFUNC(op_68ff_4), 0, 26879 }, /* Bcc */
-{ CPUFUNC(op_6900_4), 0, 26880 }, /* Bcc */
-{ CPUFUNC(op_6901_4), 0, 26881 }, /* Bcc */
-{ CPUFUNC(op_69ff_4), 0, 27135 }, /* Bcc */
-{ CPUFUNC(op_6a00_4), 0, 27136 }, /* Bcc */
-{ CPUFUNC(op_6a01_4), 0, 27137 }, /* Bcc */
-{ CPUFUNC(op_6aff_4), 0, 27391 }, /* Bcc */
-{ CPUFUNC(op_6b00_4), 0, 27392 }, /* Bcc */
-{ CPUFUNC(op_6b01_4), 0, 27393 }, /* Bcc */
-{ CPUFUNC(op_6bff_4), 0, 27647 }, /* Bcc */
-{ CPUFUNC(op_6c00_4), 0, 27648 }, /* Bcc */
-{ CPUFUNC(op_6c01_4), 0, 27649 }, /* Bcc */
-{ CPUFUNC(op_6cff_4), 0, 27903 }, /* Bcc */
-{ CPUFUNC(op_6d00_4), 0, 27904 }, /* Bcc */
-{ CPUFUNC(op_6d01_4), 0, 27905 }, /* Bcc */
-{ CPUFUNC(op_6dff_4), 0, 28159 }, /* Bcc */
-{ CPUFUNC(op_6e00_4), 0, 28160 }, /* Bcc */
-{ CPUFUNC(op_6e01_4), 0, 28161 }, /* Bcc */
-{ CPUFUNC(op_6eff_4), 0, 28415 }, /* Bcc */
-{ CPUFUNC(op_6f00_4), 0, 28416 }, /* Bcc */
-{ CPUFUNC(op_6f01_4), 0, 28417 }, /* Bcc */
-{ CPUFUNC(op_6fff_4), 0, 28671 }, /* Bcc */
-{ CPUFUNC(op_7000_4), 0, 28672 }, /* MOVE */
-{ CPUFUNC(op_8000_4), 0, 32768 }, /* OR */
-{ CPUFUNC(op_8010_4), 0, 32784 }, /* OR */
-{ CPUFUNC(op_8018_4), 0, 32792 }, /* OR */
-{ CPUFUNC(op_8020_4), 0, 32800 }, /* OR */
-{ CPUFUNC(op_8028_4), 0, 32808 }, /* OR */
-{ CPUFUNC(op_8030_4), 0, 32816 }, /* OR */
-{ CPUFUNC(op_8038_4), 0, 32824 }, /* OR */
-{ CPUFUNC(op_8039_4), 0, 32825 }, /* OR */
-{ CPUFUNC(op_803a_4), 0, 32826 }, /* OR */
-{ CPUFUNC(op_803b_4), 0, 32827 }, /* OR */
-{ CPUFUNC(op_803c_4), 0, 32828 }, /* OR */
-{ CPUFUNC(op_8040_4), 0, 32832 }, /* OR */
-{ CPUFUNC(op_8050_4), 0, 32848 }, /* OR */
-{ CPUFUNC(op_8058_4), 0, 32856 }, /* OR */
-{ CPUFUNC(op_8060_4), 0, 32864 }, /* OR */
-{ CPUFUNC(op_8068_4), 0, 32872 }, /* OR */
-{ CPUFUNC(op_8070_4), 0, 32880 }, /* OR */
-{ CPUFUNC(op_8078_4), 0, 32888 }, /* OR */
-{ CPUFUNC(op_8079_4), 0, 32889 }, /* OR */
-{ CPUFUNC(op_807a_4), 0, 32890 }, /* OR */
-{ CPUFUNC(op_807b_4), 0, 32891 }, /* OR */
-{ CPUFUNC(op_807c_4), 0, 32892 }, /* OR */
-{ CPUFUNC(op_8080_4), 0, 32896 }, /* OR */
-{ CPUFUNC(op_8090_4), 0, 32912 }, /* OR */
-{ CPUFUNC(op_8098_4), 0, 32920 }, /* OR */
-{ CPUFUNC(op_80a0_4), 0, 32928 }, /* OR */
-{ CPUFUNC(op_80a8_4), 0, 32936 }, /* OR */
-{ CPUFUNC(op_80b0_4), 0, 32944 }, /* OR */
-{ CPUFUNC(op_80b8_4), 0, 32952 }, /* OR */
-{ CPUFUNC(op_80b9_4), 0, 32953 }, /* OR */
-{ CPUFUNC(op_80ba_4), 0, 32954 }, /* OR */
-{ CPUFUNC(op_80bb_4), 0, 32955 }, /* OR */
-{ CPUFUNC(op_80bc_4), 0, 32956 }, /* OR */
-{ CPUFUNC(op_80c0_4), 0, 32960 }, /* DIVU */
-{ CPUFUNC(op_80d0_4), 0, 32976 }, /* DIVU */
-{ CPUFUNC(op_80d8_4), 0, 32984 }, /* DIVU */
-{ CPUFUNC(op_80e0_4), 0, 32992 }, /* DIVU */
-{ CPUFUNC(op_80e8_4), 0, 33000 }, /* DIVU */
-{ CPUFUNC(op_80f0_4), 0, 33008 }, /* DIVU */
-{ CPUFUNC(op_80f8_4), 0, 33016 }, /* DIVU */
-{ CPUFUNC(op_80f9_4), 0, 33017 }, /* DIVU */
-{ CPUFUNC(op_80fa_4), 0, 33018 }, /* DIVU */
-{ CPUFUNC(op_80fb_4), 0, 33019 }, /* DIVU */
-{ CPUFUNC(op_80fc_4), 0, 33020 }, /* DIVU */
-{ CPUFUNC(op_8100_4), 0, 33024 }, /* SBCD */
-{ CPUFUNC(op_8108_4), 0, 33032 }, /* SBCD */
-{ CPUFUNC(op_8110_4), 0, 33040 }, /* OR */
-{ CPUFUNC(op_8118_4), 0, 33048 }, /* OR */
-{ CPUFUNC(op_8120_4), 0, 33056 }, /* OR */
-{ CPUFUNC(op_8128_4), 0, 33064 }, /* OR */
-{ CPUFUNC(op_8130_4), 0, 33072 }, /* OR */
-{ CPUFUNC(op_8138_4), 0, 33080 }, /* OR */
-{ CPUFUNC(op_8139_4), 0, 33081 }, /* OR */
-{ CPUFUNC(op_8150_4), 0, 33104 }, /* OR */
-{ CPUFUNC(op_8158_4), 0, 33112 }, /* OR */
-{ CPUFUNC(op_8160_4), 0, 33120 }, /* OR */
-{ CPUFUNC(op_8168_4), 0, 33128 }, /* OR */
-{ CPUFUNC(op_8170_4), 0, 33136 }, /* OR */
-{ CPUFUNC(op_8178_4), 0, 33144 }, /* OR */
-{ CPUFUNC(op_8179_4), 0, 33145 }, /* OR */
-{ CPUFUNC(op_8190_4), 0, 33168 }, /* OR */
-{ CPUFUNC(op_8198_4), 0, 33176 }, /* OR */
-{ CPUFUNC(op_81a0_4), 0, 33184 }, /* OR */
-{ CPUFUNC(op_81a8_4), 0, 33192 }, /* OR */
-{ CPUFUNC(op_81b0_4), 0, 33200 }, /* OR */
-{ CPUFUNC(op_81b8_4), 0, 33208 }, /* OR */
-{ CPUFUNC(op_81b9_4), 0, 33209 }, /* OR */
-{ CPUFUNC(op_81c0_4), 0, 33216 }, /* DIVS */
-{ CPUFUNC(op_81d0_4), 0, 33232 }, /* DIVS */
-{ CPUFUNC(op_81d8_4), 0, 33240 }, /* DIVS */
-{ CPUFUNC(op_81e0_4), 0, 33248 }, /* DIVS */
-{ CPUFUNC(op_81e8_4), 0, 33256 }, /* DIVS */
-{ CPUFUNC(op_81f0_4), 0, 33264 }, /* DIVS */
-{ CPUFUNC(op_81f8_4), 0, 33272 }, /* DIVS */
-{ CPUFUNC(op_81f9_4), 0, 33273 }, /* DIVS */
-{ CPUFUNC(op_81fa_4), 0, 33274 }, /* DIVS */
-{ CPUFUNC(op_81fb_4), 0, 33275 }, /* DIVS */
-{ CPUFUNC(op_81fc_4), 0, 33276 }, /* DIVS */
-{ CPUFUNC(op_9000_4), 0, 36864 }, /* SUB */
-{ CPUFUNC(op_9010_4), 0, 36880 }, /* SUB */
-{ CPUFUNC(op_9018_4), 0, 36888 }, /* SUB */
-{ CPUFUNC(op_9020_4), 0, 36896 }, /* SUB */
-{ CPUFUNC(op_9028_4), 0, 36904 }, /* SUB */
-{ CPUFUNC(op_9030_4), 0, 36912 }, /* SUB */
-{ CPUFUNC(op_9038_4), 0, 36920 }, /* SUB */
-{ CPUFUNC(op_9039_4), 0, 36921 }, /* SUB */
-{ CPUFUNC(op_903a_4), 0, 36922 }, /* SUB */
-{ CPUFUNC(op_903b_4), 0, 36923 }, /* SUB */
-{ CPUFUNC(op_903c_4), 0, 36924 }, /* SUB */
-{ CPUFUNC(op_9040_4), 0, 36928 }, /* SUB */
-{ CPUFUNC(op_9048_4), 0, 36936 }, /* SUB */
-{ CPUFUNC(op_9050_4), 0, 36944 }, /* SUB */
-{ CPUFUNC(op_9058_4), 0, 36952 }, /* SUB */
-{ CPUFUNC(op_9060_4), 0, 36960 }, /* SUB */
-{ CPUFUNC(op_9068_4), 0, 36968 }, /* SUB */
-{ CPUFUNC(op_9070_4), 0, 36976 }, /* SUB */
-{ CPUFUNC(op_9078_4), 0, 36984 }, /* SUB */
-{ CPUFUNC(op_9079_4), 0, 36985 }, /* SUB */
-{ CPUFUNC(op_907a_4), 0, 36986 }, /* SUB */
-{ CPUFUNC(op_907b_4), 0, 36987 }, /* SUB */
-{ CPUFUNC(op_907c_4), 0, 36988 }, /* SUB */
-{ CPUFUNC(op_9080_4), 0, 36992 }, /* SUB */
-{ CPUFUNC(op_9088_4), 0, 37000 }, /* SUB */
-{ CPUFUNC(op_9090_4), 0, 37008 }, /* SUB */
-{ CPUFUNC(op_9098_4), 0, 37016 }, /* SUB */
-{ CPUFUNC(op_90a0_4), 0, 37024 }, /* SUB */
-{ CPUFUNC(op_90a8_4), 0, 37032 }, /* SUB */
-{ CPUFUNC(op_90b0_4), 0, 37040 }, /* SUB */
-{ CPUFUNC(op_90b8_4), 0, 37048 }, /* SUB */
-{ CPUFUNC(op_90b9_4), 0, 37049 }, /* SUB */
-{ CPUFUNC(op_90ba_4), 0, 37050 }, /* SUB */
-{ CPUFUNC(op_90bb_4), 0, 37051 }, /* SUB */
-{ CPUFUNC(op_90bc_4), 0, 37052 }, /* SUB */
-{ CPUFUNC(op_90c0_4), 0, 37056 }, /* SUBA */
-{ CPUFUNC(op_90c8_4), 0, 37064 }, /* SUBA */
-{ CPUFUNC(op_90d0_4), 0, 37072 }, /* SUBA */
-{ CPUFUNC(op_90d8_4), 0, 37080 }, /* SUBA */
-{ CPUFUNC(op_90e0_4), 0, 37088 }, /* SUBA */
-{ CPUFUNC(op_90e8_4), 0, 37096 }, /* SUBA */
-{ CPUFUNC(op_90f0_4), 0, 37104 }, /* SUBA */
-{ CPUFUNC(op_90f8_4), 0, 37112 }, /* SUBA */
-{ CPUFUNC(op_90f9_4), 0, 37113 }, /* SUBA */
-{ CPUFUNC(op_90fa_4), 0, 37114 }, /* SUBA */
-{ CPUFUNC(op_90fb_4), 0, 37115 }, /* SUBA */
-{ CPUFUNC(op_90fc_4), 0, 37116 }, /* SUBA */
-{ CPUFUNC(op_9100_4), 0, 37120 }, /* SUBX */
-{ CPUFUNC(op_9108_4), 0, 37128 }, /* SUBX */
-{ CPUFUNC(op_9110_4), 0, 37136 }, /* SUB */
-{ CPUFUNC(op_9118_4), 0, 37144 }, /* SUB */
-{ CPUFUNC(op_9120_4), 0, 37152 }, /* SUB */
-{ CPUFUNC(op_9128_4), 0, 37160 }, /* SUB */
-{ CPUFUNC(op_9130_4), 0, 37168 }, /* SUB */
-{ CPUFUNC(op_9138_4), 0, 37176 }, /* SUB */
-{ CPUFUNC(op_9139_4), 0, 37177 }, /* SUB */
-{ CPUFUNC(op_9140_4), 0, 37184 }, /* SUBX */
-{ CPUFUNC(op_9148_4), 0, 37192 }, /* SUBX */
-{ CPUFUNC(op_9150_4), 0, 37200 }, /* SUB */
-{ CPUFUNC(op_9158_4), 0, 37208 }, /* SUB */
-{ CPUFUNC(op_9160_4), 0, 37216 }, /* SUB */
-{ CPUFUNC(op_9168_4), 0, 37224 }, /* SUB */
-{ CPUFUNC(op_9170_4), 0, 37232 }, /* SUB */
-{ CPUFUNC(op_9178_4), 0, 37240 }, /* SUB */
-{ CPUFUNC(op_9179_4), 0, 37241 }, /* SUB */
-{ CPUFUNC(op_9180_4), 0, 37248 }, /* SUBX */
-{ CPUFUNC(op_9188_4), 0, 37256 }, /* SUBX */
-{ CPUFUNC(op_9190_4), 0, 37264 }, /* SUB */
-{ CPUFUNC(op_9198_4), 0, 37272 }, /* SUB */
-{ CPUFUNC(op_91a0_4), 0, 37280 }, /* SUB */
-{ CPUFUNC(op_91a8_4), 0, 37288 }, /* SUB */
-{ CPUFUNC(op_91b0_4), 0, 37296 }, /* SUB */
-{ CPUFUNC(op_91b8_4), 0, 37304 }, /* SUB */
-{ CPUFUNC(op_91b9_4), 0, 37305 }, /* SUB */
-{ CPUFUNC(op_91c0_4), 0, 37312 }, /* SUBA */
-{ CPUFUNC(op_91c8_4), 0, 37320 }, /* SUBA */
-{ CPUFUNC(op_91d0_4), 0, 37328 }, /* SUBA */
-{ CPUFUNC(op_91d8_4), 0, 37336 }, /* SUBA */
-{ CPUFUNC(op_91e0_4), 0, 37344 }, /* SUBA */
-{ CPUFUNC(op_91e8_4), 0, 37352 }, /* SUBA */
-{ CPUFUNC(op_91f0_4), 0, 37360 }, /* SUBA */
-{ CPUFUNC(op_91f8_4), 0, 37368 }, /* SUBA */
-{ CPUFUNC(op_91f9_4), 0, 37369 }, /* SUBA */
-{ CPUFUNC(op_91fa_4), 0, 37370 }, /* SUBA */
-{ CPUFUNC(op_91fb_4), 0, 37371 }, /* SUBA */
-{ CPUFUNC(op_91fc_4), 0, 37372 }, /* SUBA */
-{ CPUFUNC(op_b000_4), 0, 45056 }, /* CMP */
-{ CPUFUNC(op_b010_4), 0, 45072 }, /* CMP */
-{ CPUFUNC(op_b018_4), 0, 45080 }, /* CMP */
-{ CPUFUNC(op_b020_4), 0, 45088 }, /* CMP */
-{ CPUFUNC(op_b028_4), 0, 45096 }, /* CMP */
-{ CPUFUNC(op_b030_4), 0, 45104 }, /* CMP */
-{ CPUFUNC(op_b038_4), 0, 45112 }, /* CMP */
-{ CPUFUNC(op_b039_4), 0, 45113 }, /* CMP */
-{ CPUFUNC(op_b03a_4), 0, 45114 }, /* CMP */
-{ CPUFUNC(op_b03b_4), 0, 45115 }, /* CMP */
-{ CPUFUNC(op_b03c_4), 0, 45116 }, /* CMP */
-{ CPUFUNC(op_b040_4), 0, 45120 }, /* CMP */
-{ CPUFUNC(op_b048_4), 0, 45128 }, /* CMP */
-{ CPUFUNC(op_b050_4), 0, 45136 }, /* CMP */
-{ CPUFUNC(op_b058_4), 0, 45144 }, /* CMP */
-{ CPUFUNC(op_b060_4), 0, 45152 }, /* CMP */
-{ CPUFUNC(op_b068_4), 0, 45160 }, /* CMP */
-{ CPUFUNC(op_b070_4), 0, 45168 }, /* CMP */
-{ CPUFUNC(op_b078_4), 0, 45176 }, /* CMP */
-{ CPUFUNC(op_b079_4), 0, 45177 }, /* CMP */
-{ CPUFUNC(op_b07a_4), 0, 45178 }, /* CMP */
-{ CPUFUNC(op_b07b_4), 0, 45179 }, /* CMP */
-{ CPUFUNC(op_b07c_4), 0, 45180 }, /* CMP */
-{ CPUFUNC(op_b080_4), 0, 45184 }, /* CMP */
-{ CPUFUNC(op_b088_4), 0, 45192 }, /* CMP */
-{ CPUFUNC(op_b090_4), 0, 45200 }, /* CMP */
-{ CPUFUNC(op_b098_4), 0, 45208 }, /* CMP */
-{ CPUFUNC(op_b0a0_4), 0, 45216 }, /* CMP */
-{ CPUFUNC(op_b0a8_4), 0, 45224 }, /* CMP */
-{ CPUFUNC(op_b0b0_4), 0, 45232 }, /* CMP */
-{ CPUFUNC(op_b0b8_4), 0, 45240 }, /* CMP */
-{ CPUFUNC(op_b0b9_4), 0, 45241 }, /* CMP */
-{ CPUFUNC(op_b0ba_4), 0, 45242 }, /* CMP */
-{ CPUFUNC(op_b0bb_4), 0, 45243 }, /* CMP */
-{ CPUFUNC(op_b0bc_4), 0, 45244 }, /* CMP */
-{ CPUFUNC(op_b0c0_4), 0, 45248 }, /* CMPA */
-{ CPUFUNC(op_b0c8_4), 0, 45256 }, /* CMPA */
-{ CPUFUNC(op_b0d0_4), 0, 45264 }, /* CMPA */
-{ CPUFUNC(op_b0d8_4), 0, 45272 }, /* CMPA */
-{ CPUFUNC(op_b0e0_4), 0, 45280 }, /* CMPA */
-{ CPUFUNC(op_b0e8_4), 0, 45288 }, /* CMPA */
-{ CPUFUNC(op_b0f0_4), 0, 45296 }, /* CMPA */
-{ CPUFUNC(op_b0f8_4), 0, 45304 }, /* CMPA */
-{ CPUFUNC(op_b0f9_4), 0, 45305 }, /* CMPA */
-{ CPUFUNC(op_b0fa_4), 0, 45306 }, /* CMPA */
-{ CPUFUNC(op_b0fb_4), 0, 45307 }, /* CMPA */
-{ CPUFUNC(op_b0fc_4), 0, 45308 }, /* CMPA */
-{ CPUFUNC(op_b100_4), 0, 45312 }, /* EOR */
-{ CPUFUNC(op_b108_4), 0, 45320 }, /* CMPM */
-{ CPUFUNC(op_b110_4), 0, 45328 }, /* EOR */
-{ CPUFUNC(op_b118_4), 0, 45336 }, /* EOR */
-{ CPUFUNC(op_b120_4), 0, 45344 }, /* EOR */
-{ CPUFUNC(op_b128_4), 0, 45352 }, /* EOR */
-{ CPUFUNC(op_b130_4), 0, 45360 }, /* EOR */
-{ CPUFUNC(op_b138_4), 0, 45368 }, /* EOR */
-{ CPUFUNC(op_b139_4), 0, 45369 }, /* EOR */
-{ CPUFUNC(op_b140_4), 0, 45376 }, /* EOR */
-{ CPUFUNC(op_b148_4), 0, 45384 }, /* CMPM */
-{ CPUFUNC(op_b150_4), 0, 45392 }, /* EOR */
-{ CPUFUNC(op_b158_4), 0, 45400 }, /* EOR */
-{ CPUFUNC(op_b160_4), 0, 45408 }, /* EOR */
-{ CPUFUNC(op_b168_4), 0, 45416 }, /* EOR */
-{ CPUFUNC(op_b170_4), 0, 45424 }, /* EOR */
-{ CPUFUNC(op_b178_4), 0, 45432 }, /* EOR */
-{ CPUFUNC(op_b179_4), 0, 45433 }, /* EOR */
-{ CPUFUNC(op_b180_4), 0, 45440 }, /* EOR */
-{ CPUFUNC(op_b188_4), 0, 45448 }, /* CMPM */
-{ CPUFUNC(op_b190_4), 0, 45456 }, /* EOR */
-{ CPUFUNC(op_b198_4), 0, 45464 }, /* EOR */
-{ CPUFUNC(op_b1a0_4), 0, 45472 }, /* EOR */
-{ CPUFUNC(op_b1a8_4), 0, 45480 }, /* EOR */
-{ CPUFUNC(op_b1b0_4), 0, 45488 }, /* EOR */
-{ CPUFUNC(op_b1b8_4), 0, 45496 }, /* EOR */
-{ CPUFUNC(op_b1b9_4), 0, 45497 }, /* EOR */
-{ CPUFUNC(op_b1c0_4), 0, 45504 }, /* CMPA */
-{ CPUFUNC(op_b1c8_4), 0, 45512 }, /* CMPA */
-{ CPUFUNC(op_b1d0_4), 0, 45520 }, /* CMPA */
-{ CPUFUNC(op_b1d8_4), 0, 45528 }, /* CMPA */
-{ CPUFUNC(op_b1e0_4), 0, 45536 }, /* CMPA */
-{ CPUFUNC(op_b1e8_4), 0, 45544 }, /* CMPA */
-{ CPUFUNC(op_b1f0_4), 0, 45552 }, /* CMPA */
-{ CPUFUNC(op_b1f8_4), 0, 45560 }, /* CMPA */
-{ CPUFUNC(op_b1f9_4), 0, 45561 }, /* CMPA */
-{ CPUFUNC(op_b1fa_4), 0, 45562 }, /* CMPA */
-{ CPUFUNC(op_b1fb_4), 0, 45563 }, /* CMPA */
-{ CPUFUNC(op_b1fc_4), 0, 45564 }, /* CMPA */
-{ CPUFUNC(op_c000_4), 0, 49152 }, /* AND */
-{ CPUFUNC(op_c010_4), 0, 49168 }, /* AND */
-{ CPUFUNC(op_c018_4), 0, 49176 }, /* AND */
-{ CPUFUNC(op_c020_4), 0, 49184 }, /* AND */
-{ CPUFUNC(op_c028_4), 0, 49192 }, /* AND */
-{ CPUFUNC(op_c030_4), 0, 49200 }, /* AND */
-{ CPUFUNC(op_c038_4), 0, 49208 }, /* AND */
-{ CPUFUNC(op_c039_4), 0, 49209 }, /* AND */
-{ CPUFUNC(op_c03a_4), 0, 49210 }, /* AND */
-{ CPUFUNC(op_c03b_4), 0, 49211 }, /* AND */
-{ CPUFUNC(op_c03c_4), 0, 49212 }, /* AND */
-{ CPUFUNC(op_c040_4), 0, 49216 }, /* AND */
-{ CPUFUNC(op_c050_4), 0, 49232 }, /* AND */
-{ CPUFUNC(op_c058_4), 0, 49240 }, /* AND */
-{ CPUFUNC(op_c060_4), 0, 49248 }, /* AND */
-{ CPUFUNC(op_c068_4), 0, 49256 }, /* AND */
-{ CPUFUNC(op_c070_4), 0, 49264 }, /* AND */
-{ CPUFUNC(op_c078_4), 0, 49272 }, /* AND */
-{ CPUFUNC(op_c079_4), 0, 49273 }, /* AND */
-{ CPUFUNC(op_c07a_4), 0, 49274 }, /* AND */
-{ CPUFUNC(op_c07b_4), 0, 49275 }, /* AND */
-{ CPUFUNC(op_c07c_4), 0, 49276 }, /* AND */
-{ CPUFUNC(op_c080_4), 0, 49280 }, /* AND */
-{ CPUFUNC(op_c090_4), 0, 49296 }, /* AND */
-{ CPUFUNC(op_c098_4), 0, 49304 }, /* AND */
-{ CPUFUNC(op_c0a0_4), 0, 49312 }, /* AND */
-{ CPUFUNC(op_c0a8_4), 0, 49320 }, /* AND */
-{ CPUFUNC(op_c0b0_4), 0, 49328 }, /* AND */
-{ CPUFUNC(op_c0b8_4), 0, 49336 }, /* AND */
-{ CPUFUNC(op_c0b9_4), 0, 49337 }, /* AND */
-{ CPUFUNC(op_c0ba_4), 0, 49338 }, /* AND */
-{ CPUFUNC(op_c0bb_4), 0, 49339 }, /* AND */
-{ CPUFUNC(op_c0bc_4), 0, 49340 }, /* AND */
-{ CPUFUNC(op_c0c0_4), 0, 49344 }, /* MULU */
-{ CPUFUNC(op_c0d0_4), 0, 49360 }, /* MULU */
-{ CPUFUNC(op_c0d8_4), 0, 49368 }, /* MULU */
-{ CPUFUNC(op_c0e0_4), 0, 49376 }, /* MULU */
-{ CPUFUNC(op_c0e8_4), 0, 49384 }, /* MULU */
-{ CPUFUNC(op_c0f0_4), 0, 49392 }, /* MULU */
-{ CPUFUNC(op_c0f8_4), 0, 49400 }, /* MULU */
-{ CPUFUNC(op_c0f9_4), 0, 49401 }, /* MULU */
-{ CPUFUNC(op_c0fa_4), 0, 49402 }, /* MULU */
-{ CPUFUNC(op_c0fb_4), 0, 49403 }, /* MULU */
-{ CPUFUNC(op_c0fc_4), 0, 49404 }, /* MULU */
-{ CPUFUNC(op_c100_4), 0, 49408 }, /* ABCD */
-{ CPUFUNC(op_c108_4), 0, 49416 }, /* ABCD */
-{ CPUFUNC(op_c110_4), 0, 49424 }, /* AND */
-{ CPUFUNC(op_c118_4), 0, 49432 }, /* AND */
-{ CPUFUNC(op_c120_4), 0, 49440 }, /* AND */
-{ CPUFUNC(op_c128_4), 0, 49448 }, /* AND */
-{ CPUFUNC(op_c130_4), 0, 49456 }, /* AND */
-{ CPUFUNC(op_c138_4), 0, 49464 }, /* AND */
-{ CPUFUNC(op_c139_4), 0, 49465 }, /* AND */
-{ CPUFUNC(op_c140_4), 0, 49472 }, /* EXG */
-{ CPUFUNC(op_c148_4), 0, 49480 }, /* EXG */
-{ CPUFUNC(op_c150_4), 0, 49488 }, /* AND */
-{ CPUFUNC(op_c158_4), 0, 49496 }, /* AND */
-{ CPUFUNC(op_c160_4), 0, 49504 }, /* AND */
-{ CPUFUNC(op_c168_4), 0, 49512 }, /* AND */
-{ CPUFUNC(op_c170_4), 0, 49520 }, /* AND */
-{ CPUFUNC(op_c178_4), 0, 49528 }, /* AND */
-{ CPUFUNC(op_c179_4), 0, 49529 }, /* AND */
-{ CPUFUNC(op_c188_4), 0, 49544 }, /* EXG */
-{ CPUFUNC(op_c190_4), 0, 49552 }, /* AND */
-{ CPUFUNC(op_c198_4), 0, 49560 }, /* AND */
-{ CPUFUNC(op_c1a0_4), 0, 49568 }, /* AND */
-{ CPUFUNC(op_c1a8_4), 0, 49576 }, /* AND */
-{ CPUFUNC(op_c1b0_4), 0, 49584 }, /* AND */
-{ CPUFUNC(op_c1b8_4), 0, 49592 }, /* AND */
-{ CPUFUNC(op_c1b9_4), 0, 49593 }, /* AND */
-{ CPUFUNC(op_c1c0_4), 0, 49600 }, /* MULS */
-{ CPUFUNC(op_c1d0_4), 0, 49616 }, /* MULS */
-{ CPUFUNC(op_c1d8_4), 0, 49624 }, /* MULS */
-{ CPUFUNC(op_c1e0_4), 0, 49632 }, /* MULS */
-{ CPUFUNC(op_c1e8_4), 0, 49640 }, /* MULS */
-{ CPUFUNC(op_c1f0_4), 0, 49648 }, /* MULS */
-{ CPUFUNC(op_c1f8_4), 0, 49656 }, /* MULS */
-{ CPUFUNC(op_c1f9_4), 0, 49657 }, /* MULS */
-{ CPUFUNC(op_c1fa_4), 0, 49658 }, /* MULS */
-{ CPUFUNC(op_c1fb_4), 0, 49659 }, /* MULS */
-{ CPUFUNC(op_c1fc_4), 0, 49660 }, /* MULS */
-{ CPUFUNC(op_d000_4), 0, 53248 }, /* ADD */
-{ CPUFUNC(op_d010_4), 0, 53264 }, /* ADD */
-{ CPUFUNC(op_d018_4), 0, 53272 }, /* ADD */
-{ CPUFUNC(op_d020_4), 0, 53280 }, /* ADD */
-{ CPUFUNC(op_d028_4), 0, 53288 }, /* ADD */
-{ CPUFUNC(op_d030_4), 0, 53296 }, /* ADD */
-{ CPUFUNC(op_d038_4), 0, 53304 }, /* ADD */
-{ CPUFUNC(op_d039_4), 0, 53305 }, /* ADD */
-{ CPUFUNC(op_d03a_4), 0, 53306 }, /* ADD */
-{ CPUFUNC(op_d03b_4), 0, 53307 }, /* ADD */
-{ CPUFUNC(op_d03c_4), 0, 53308 }, /* ADD */
-{ CPUFUNC(op_d040_4), 0, 53312 }, /* ADD */
-{ CPUFUNC(op_d048_4), 0, 53320 }, /* ADD */
-{ CPUFUNC(op_d050_4), 0, 53328 }, /* ADD */
-{ CPUFUNC(op_d058_4), 0, 53336 }, /* ADD */
-{ CPUFUNC(op_d060_4), 0, 53344 }, /* ADD */
-{ CPUFUNC(op_d068_4), 0, 53352 }, /* ADD */
-{ CPUFUNC(op_d070_4), 0, 53360 }, /* ADD */
-{ CPUFUNC(op_d078_4), 0, 53368 }, /* ADD */
-{ CPUFUNC(op_d079_4), 0, 53369 }, /* ADD */
-{ CPUFUNC(op_d07a_4), 0, 53370 }, /* ADD */
-{ CPUFUNC(op_d07b_4), 0, 53371 }, /* ADD */
-{ CPUFUNC(op_d07c_4), 0, 53372 }, /* ADD */
-{ CPUFUNC(op_d080_4), 0, 53376 }, /* ADD */
-{ CPUFUNC(op_d088_4), 0, 53384 }, /* ADD */
-{ CPUFUNC(op_d090_4), 0, 53392 }, /* ADD */
-{ CPUFUNC(op_d098_4), 0, 53400 }, /* ADD */
-{ CPUFUNC(op_d0a0_4), 0, 53408 }, /* ADD */
-{ CPUFUNC(op_d0a8_4), 0, 53416 }, /* ADD */
-{ CPUFUNC(op_d0b0_4), 0, 53424 }, /* ADD */
-{ CPUFUNC(op_d0b8_4), 0, 53432 }, /* ADD */
-{ CPUFUNC(op_d0b9_4), 0, 53433 }, /* ADD */
-{ CPUFUNC(op_d0ba_4), 0, 53434 }, /* ADD */
-{ CPUFUNC(op_d0bb_4), 0, 53435 }, /* ADD */
-{ CPUFUNC(op_d0bc_4), 0, 53436 }, /* ADD */
-{ CPUFUNC(op_d0c0_4), 0, 53440 }, /* ADDA */
-{ CPUFUNC(op_d0c8_4), 0, 53448 }, /* ADDA */
-{ CPUFUNC(op_d0d0_4), 0, 53456 }, /* ADDA */
-{ CPUFUNC(op_d0d8_4), 0, 53464 }, /* ADDA */
-{ CPUFUNC(op_d0e0_4), 0, 53472 }, /* ADDA */
-{ CPUFUNC(op_d0e8_4), 0, 53480 }, /* ADDA */
-{ CPUFUNC(op_d0f0_4), 0, 53488 }, /* ADDA */
-{ CPUFUNC(op_d0f8_4), 0, 53496 }, /* ADDA */
-{ CPUFUNC(op_d0f9_4), 0, 53497 }, /* ADDA */
-{ CPUFUNC(op_d0fa_4), 0, 53498 }, /* ADDA */
-{ CPUFUNC(op_d0fb_4), 0, 53499 }, /* ADDA */
-{ CPUFUNC(op_d0fc_4), 0, 53500 }, /* ADDA */
-{ CPUFUNC(op_d100_4), 0, 53504 }, /* ADDX */
-{ CPUFUNC(op_d108_4), 0, 53512 }, /* ADDX */
-{ CPUFUNC(op_d110_4), 0, 53520 }, /* ADD */
-{ CPUFUNC(op_d118_4), 0, 53528 }, /* ADD */
-{ CPUFUNC(op_d120_4), 0, 53536 }, /* ADD */
-{ CPUFUNC(op_d128_4), 0, 53544 }, /* ADD */
-{ CPUFUNC(op_d130_4), 0, 53552 }, /* ADD */
-{ CPUFUNC(op_d138_4), 0, 53560 }, /* ADD */
-{ CPUFUNC(op_d139_4), 0, 53561 }, /* ADD */
-{ CPUFUNC(op_d140_4), 0, 53568 }, /* ADDX */
-{ CPUFUNC(op_d148_4), 0, 53576 }, /* ADDX */
-{ CPUFUNC(op_d150_4), 0, 53584 }, /* ADD */
-{ CPUFUNC(op_d158_4), 0, 53592 }, /* ADD */
-{ CPUFUNC(op_d160_4), 0, 53600 }, /* ADD */
-{ CPUFUNC(op_d168_4), 0, 53608 }, /* ADD */
-{ CPUFUNC(op_d170_4), 0, 53616 }, /* ADD */
-{ CPUFUNC(op_d178_4), 0, 53624 }, /* ADD */
-{ CPUFUNC(op_d179_4), 0, 53625 }, /* ADD */
-{ CPUFUNC(op_d180_4), 0, 53632 }, /* ADDX */
-{ CPUFUNC(op_d188_4), 0, 53640 }, /* ADDX */
-{ CPUFUNC(op_d190_4), 0, 53648 }, /* ADD */
-{ CPUFUNC(op_d198_4), 0, 53656 }, /* ADD */
-{ CPUFUNC(op_d1a0_4), 0, 53664 }, /* ADD */
-{ CPUFUNC(op_d1a8_4), 0, 53672 }, /* ADD */
-{ CPUFUNC(op_d1b0_4), 0, 53680 }, /* ADD */
-{ CPUFUNC(op_d1b8_4), 0, 53688 }, /* ADD */
-{ CPUFUNC(op_d1b9_4), 0, 53689 }, /* ADD */
-{ CPUFUNC(op_d1c0_4), 0, 53696 }, /* ADDA */
-{ CPUFUNC(op_d1c8_4), 0, 53704 }, /* ADDA */
-{ CPUFUNC(op_d1d0_4), 0, 53712 }, /* ADDA */
-{ CPUFUNC(op_d1d8_4), 0, 53720 }, /* ADDA */
-{ CPUFUNC(op_d1e0_4), 0, 53728 }, /* ADDA */
-{ CPUFUNC(op_d1e8_4), 0, 53736 }, /* ADDA */
-{ CPUFUNC(op_d1f0_4), 0, 53744 }, /* ADDA */
-{ CPUFUNC(op_d1f8_4), 0, 53752 }, /* ADDA */
-{ CPUFUNC(op_d1f9_4), 0, 53753 }, /* ADDA */
-{ CPUFUNC(op_d1fa_4), 0, 53754 }, /* ADDA */
-{ CPUFUNC(op_d1fb_4), 0, 53755 }, /* ADDA */
-{ CPUFUNC(op_d1fc_4), 0, 53756 }, /* ADDA */
-{ CPUFUNC(op_e000_4), 0, 57344 }, /* ASR */
-{ CPUFUNC(op_e008_4), 0, 57352 }, /* LSR */
-{ CPUFUNC(op_e010_4), 0, 57360 }, /* ROXR */
-{ CPUFUNC(op_e018_4), 0, 57368 }, /* ROR */
-{ CPUFUNC(op_e020_4), 0, 57376 }, /* ASR */
-{ CPUFUNC(op_e028_4), 0, 57384 }, /* LSR */
-{ CPUFUNC(op_e030_4), 0, 57392 }, /* ROXR */
-{ CPUFUNC(op_e038_4), 0, 57400 }, /* ROR */
-{ CPUFUNC(op_e040_4), 0, 57408 }, /* ASR */
-{ CPUFUNC(op_e048_4), 0, 57416 }, /* LSR */
-{ CPUFUNC(op_e050_4), 0, 57424 }, /* ROXR */
-{ CPUFUNC(op_e058_4), 0, 57432 }, /* ROR */
-{ CPUFUNC(op_e060_4), 0, 57440 }, /* ASR */
-{ CPUFUNC(op_e068_4), 0, 57448 }, /* LSR */
-{ CPUFUNC(op_e070_4), 0, 57456 }, /* ROXR */
-{ CPUFUNC(op_e078_4), 0, 57464 }, /* ROR */
-{ CPUFUNC(op_e080_4), 0, 57472 }, /* ASR */
-{ CPUFUNC(op_e088_4), 0, 57480 }, /* LSR */
-{ CPUFUNC(op_e090_4), 0, 57488 }, /* ROXR */
-{ CPUFUNC(op_e098_4), 0, 57496 }, /* ROR */
-{ CPUFUNC(op_e0a0_4), 0, 57504 }, /* ASR */
-{ CPUFUNC(op_e0a8_4), 0, 57512 }, /* LSR */
-{ CPUFUNC(op_e0b0_4), 0, 57520 }, /* ROXR */
-{ CPUFUNC(op_e0b8_4), 0, 57528 }, /* ROR */
-{ CPUFUNC(op_e0d0_4), 0, 57552 }, /* ASRW */
-{ CPUFUNC(op_e0d8_4), 0, 57560 }, /* ASRW */
-{ CPUFUNC(op_e0e0_4), 0, 57568 }, /* ASRW */
-{ CPUFUNC(op_e0e8_4), 0, 57576 }, /* ASRW */
-{ CPUFUNC(op_e0f0_4), 0, 57584 }, /* ASRW */
-{ CPUFUNC(op_e0f8_4), 0, 57592 }, /* ASRW */
-{ CPUFUNC(op_e0f9_4), 0, 57593 }, /* ASRW */
-{ CPUFUNC(op_e100_4), 0, 57600 }, /* ASL */
-{ CPUFUNC(op_e108_4), 0, 57608 }, /* LSL */
-{ CPUFUNC(op_e110_4), 0, 57616 }, /* ROXL */
-{ CPUFUNC(op_e118_4), 0, 57624 }, /* ROL */
-{ CPUFUNC(op_e120_4), 0, 57632 }, /* ASL */
-{ CPUFUNC(op_e128_4), 0, 57640 }, /* LSL */
-{ CPUFUNC(op_e130_4), 0, 57648 }, /* ROXL */
-{ CPUFUNC(op_e138_4), 0, 57656 }, /* ROL */
-{ CPUFUNC(op_e140_4), 0, 57664 }, /* ASL */
-{ CPUFUNC(op_e148_4), 0, 57672 }, /* LSL */
-{ CPUFUNC(op_e150_4), 0, 57680 }, /* ROXL */
-{ CPUFUNC(op_e158_4), 0, 57688 }, /* ROL */
-{ CPUFUNC(op_e160_4), 0, 57696 }, /* ASL */
-{ CPUFUNC(op_e168_4), 0, 57704 }, /* LSL */
-{ CPUFUNC(op_e170_4), 0, 57712 }, /* ROXL */
-{ CPUFUNC(op_e178_4), 0, 57720 }, /* ROL */
-{ CPUFUNC(op_e180_4), 0, 57728 }, /* ASL */
-{ CPUFUNC(op_e188_4), 0, 57736 }, /* LSL */
-{ CPUFUNC(op_e190_4), 0, 57744 }, /* ROXL */
-{ CPUFUNC(op_e198_4), 0, 57752 }, /* ROL */
-{ CPUFUNC(op_e1a0_4), 0, 57760 }, /* ASL */
-{ CPUFUNC(op_e1a8_4), 0, 57768 }, /* LSL */
-{ CPUFUNC(op_e1b0_4), 0, 57776 }, /* ROXL */
-{ CPUFUNC(op_e1b8_4), 0, 57784 }, /* ROL */
-{ CPUFUNC(op_e1d0_4), 0, 57808 }, /* ASLW */
-{ CPUFUNC(op_e1d8_4), 0, 57816 }, /* ASLW */
-{ CPUFUNC(op_e1e0_4), 0, 57824 }, /* ASLW */
-{ CPUFUNC(op_e1e8_4), 0, 57832 }, /* ASLW */
-{ CPUFUNC(op_e1f0_4), 0, 57840 }, /* ASLW */
-{ CPUFUNC(op_e1f8_4), 0, 57848 }, /* ASLW */
-{ CPUFUNC(op_e1f9_4), 0, 57849 }, /* ASLW */
-{ CPUFUNC(op_e2d0_4), 0, 58064 }, /* LSRW */
-{ CPUFUNC(op_e2d8_4), 0, 58072 }, /* LSRW */
-{ CPUFUNC(op_e2e0_4), 0, 58080 }, /* LSRW */
-{ CPUFUNC(op_e2e8_4), 0, 58088 }, /* LSRW */
-{ CPUFUNC(op_e2f0_4), 0, 58096 }, /* LSRW */
-{ CPUFUNC(op_e2f8_4), 0, 58104 }, /* LSRW */
-{ CPUFUNC(op_e2f9_4), 0, 58105 }, /* LSRW */
-{ CPUFUNC(op_e3d0_4), 0, 58320 }, /* LSLW */
-{ CPUFUNC(op_e3d8_4), 0, 58328 }, /* LSLW */
-{ CPUFUNC(op_e3e0_4), 0, 58336 }, /* LSLW */
-{ CPUFUNC(op_e3e8_4), 0, 58344 }, /* LSLW */
-{ CPUFUNC(op_e3f0_4), 0, 58352 }, /* LSLW */
-{ CPUFUNC(op_e3f8_4), 0, 58360 }, /* LSLW */
-{ CPUFUNC(op_e3f9_4), 0, 58361 }, /* LSLW */
-{ CPUFUNC(op_e4d0_4), 0, 58576 }, /* ROXRW */
-{ CPUFUNC(op_e4d8_4), 0, 58584 }, /* ROXRW */
-{ CPUFUNC(op_e4e0_4), 0, 58592 }, /* ROXRW */
-{ CPUFUNC(op_e4e8_4), 0, 58600 }, /* ROXRW */
-{ CPUFUNC(op_e4f0_4), 0, 58608 }, /* ROXRW */
-{ CPUFUNC(op_e4f8_4), 0, 58616 }, /* ROXRW */
-{ CPUFUNC(op_e4f9_4), 0, 58617 }, /* ROXRW */
-{ CPUFUNC(op_e5d0_4), 0, 58832 }, /* ROXLW */
-{ CPUFUNC(op_e5d8_4), 0, 58840 }, /* ROXLW */
-{ CPUFUNC(op_e5e0_4), 0, 58848 }, /* ROXLW */
-{ CPUFUNC(op_e5e8_4), 0, 58856 }, /* ROXLW */
-{ CPUFUNC(op_e5f0_4), 0, 58864 }, /* ROXLW */
-{ CPUFUNC(op_e5f8_4), 0, 58872 }, /* ROXLW */
-{ CPUFUNC(op_e5f9_4), 0, 58873 }, /* ROXLW */
-{ CPUFUNC(op_e6d0_4), 0, 59088 }, /* RORW */
-{ CPUFUNC(op_e6d8_4), 0, 59096 }, /* RORW */
-{ CPUFUNC(op_e6e0_4), 0, 59104 }, /* RORW */
-{ CPUFUNC(op_e6e8_4), 0, 59112 }, /* RORW */
-{ CPUFUNC(op_e6f0_4), 0, 59120 }, /* RORW */
-{ CPUFUNC(op_e6f8_4), 0, 59128 }, /* RORW */
-{ CPUFUNC(op_e6f9_4), 0, 59129 }, /* RORW */
-{ CPUFUNC(op_e7d0_4), 0, 59344 }, /* ROLW */
-{ CPUFUNC(op_e7d8_4), 0, 59352 }, /* ROLW */
-{ CPUFUNC(op_e7e0_4), 0, 59360 }, /* ROLW */
-{ CPUFUNC(op_e7e8_4), 0, 59368 }, /* ROLW */
-{ CPUFUNC(op_e7f0_4), 0, 59376 }, /* ROLW */
-{ CPUFUNC(op_e7f8_4), 0, 59384 }, /* ROLW */
-{ CPUFUNC(op_e7f9_4), 0, 59385 }, /* ROLW */
-{ 0, 0, 0 }};
-const struct cputbl CPUFUNC(op_smalltbl_5)[] = {
-{ CPUFUNC(op_0_5), 0, 0 }, /* OR */
-{ CPUFUNC(op_10_5), 0, 16 }, /* OR */
-{ CPUFUNC(op_18_5), 0, 24 }, /* OR */
-{ CPUFUNC(op_20_5), 0, 32 }, /* OR */
-{ CPUFUNC(op_28_5), 0, 40 }, /* OR */
-{ CPUFUNC(op_30_5), 0, 48 }, /* OR */
-{ CPUFUNC(op_38_5), 0, 56 }, /* OR */
-{ CPUFUNC(op_39_5), 0, 57 }, /* OR */
-{ CPUFUNC(op_3c_5), 0, 60 }, /* ORSR */
-{ CPUFUNC(op_40_5), 0, 64 }, /* OR */
-{ CPUFUNC(op_50_5), 0, 80 }, /* OR */
-{ CPUFUNC(op_58_5), 0, 88 }, /* OR */
-{ CPUFUNC(op_60_5), 0, 96 }, /* OR */
-{ CPUFUNC(op_68_5), 0, 104 }, /* OR */
-{ CPUFUNC(op_70_5), 0, 112 }, /* OR */
-{ CPUFUNC(op_78_5), 0, 120 }, /* OR */
-{ CPUFUNC(op_79_5), 0, 121 }, /* OR */
-{ CPUFUNC(op_7c_5), 0, 124 }, /* ORSR */
-{ CPUFUNC(op_80_5), 0, 128 }, /* OR */
-{ CPUFUNC(op_90_5), 0, 144 }, /* OR */
-{ CPUFUNC(op_98_5), 0, 152 }, /* OR */
-{ CPUFUNC(op_a0_5), 0, 160 }, /* OR */
-{ CPUFUNC(op_a8_5), 0, 168 }, /* OR */
-{ CPUFUNC(op_b0_5), 0, 176 }, /* OR */
-{ CPUFUNC(op_b8_5), 0, 184 }, /* OR */
-{ CPUFUNC(op_b9_5), 0, 185 }, /* OR */
-{ CPUFUNC(op_100_5), 0, 256 }, /* BTST */
-{ CPUFUNC(op_108_5), 0, 264 }, /* MVPMR */
-{ CPUFUNC(op_110_5), 0, 272 }, /* BTST */
-{ CPUFUNC(op_118_5), 0, 280 }, /* BTST */
-{ CPUFUNC(op_120_5), 0, 288 }, /* BTST */
-{ CPUFUNC(op_128_5), 0, 296 }, /* BTST */
-{ CPUFUNC(op_130_5), 0, 304 }, /* BTST */
-{ CPUFUNC(op_138_5), 0, 312 }, /* BTST */
-{ CPUFUNC(op_139_5), 0, 313 }, /* BTST */
-{ CPUFUNC(op_13a_5), 0, 314 }, /* BTST */
-{ CPUFUNC(op_13b_5), 0, 315 }, /* BTST */
-{ CPUFUNC(op_13c_5), 0, 316 }, /* BTST */
-{ CPUFUNC(op_140_5), 0, 320 }, /* BCHG */
-{ CPUFUNC(op_148_5), 0, 328 }, /* MVPMR */
-{ CPUFUNC(op_150_5), 0, 336 }, /* BCHG */
-{ CPUFUNC(op_158_5), 0, 344 }, /* BCHG */
-{ CPUFUNC(op_160_5), 0, 352 }, /* BCHG */
-{ CPUFUNC(op_168_5), 0, 360 }, /* BCHG */
-{ CPUFUNC(op_170_5), 0, 368 }, /* BCHG */
-{ CPUFUNC(op_178_5), 0, 376 }, /* BCHG */
-{ CPUFUNC(op_179_5), 0, 377 }, /* BCHG */
-{ CPUFUNC(op_17a_5), 0, 378 }, /* BCHG */
-{ CPUFUNC(op_17b_5), 0, 379 }, /* BCHG */
-{ CPUFUNC(op_180_5), 0, 384 }, /* BCLR */
-{ CPUFUNC(op_188_5), 0, 392 }, /* MVPRM */
-{ CPUFUNC(op_190_5), 0, 400 }, /* BCLR */
-{ CPUFUNC(op_198_5), 0, 408 }, /* BCLR */
-{ CPUFUNC(op_1a0_5), 0, 416 }, /* BCLR */
-{ CPUFUNC(op_1a8_5), 0, 424 }, /* BCLR */
-{ CPUFUNC(op_1b0_5), 0, 432 }, /* BCLR */
-{ CPUFUNC(op_1b8_5), 0, 440 }, /* BCLR */
-{ CPUFUNC(op_1b9_5), 0, 441 }, /* BCLR */
-{ CPUFUNC(op_1ba_5), 0, 442 }, /* BCLR */
-{ CPUFUNC(op_1bb_5), 0, 443 }, /* BCLR */
-{ CPUFUNC(op_1c0_5), 0, 448 }, /* BSET */
-{ CPUFUNC(op_1c8_5), 0, 456 }, /* MVPRM */
-{ CPUFUNC(op_1d0_5), 0, 464 }, /* BSET */
-{ CPUFUNC(op_1d8_5), 0, 472 }, /* BSET */
-{ CPUFUNC(op_1e0_5), 0, 480 }, /* BSET */
-{ CPUFUNC(op_1e8_5), 0, 488 }, /* BSET */
-{ CPUFUNC(op_1f0_5), 0, 496 }, /* BSET */
-{ CPUFUNC(op_1f8_5), 0, 504 }, /* BSET */
-{ CPUFUNC(op_1f9_5), 0, 505 }, /* BSET */
-{ CPUFUNC(op_1fa_5), 0, 506 }, /* BSET */
-{ CPUFUNC(op_1fb_5), 0, 507 }, /* BSET */
-{ CPUFUNC(op_200_5), 0, 512 }, /* AND */
-{ CPUFUNC(op_210_5), 0, 528 }, /* AND */
-{ CPUFUNC(op_218_5), 0, 536 }, /* AND */
-{ CPUFUNC(op_220_5), 0, 544 }, /* AND */
-{ CPUFUNC(op_228_5), 0, 552 }, /* AND */
-{ CPUFUNC(op_230_5), 0, 560 }, /* AND */
-{ CPUFUNC(op_238_5), 0, 568 }, /* AND */
-{ CPUFUNC(op_239_5), 0, 569 }, /* AND */
-{ CPUFUNC(op_23c_5), 0, 572 }, /* ANDSR */
-{ CPUFUNC(op_240_5), 0, 576 }, /* AND */
-{ CPUFUNC(op_250_5), 0, 592 }, /* AND */
-{ CPUFUNC(op_258_5), 0, 600 }, /* AND */
-{ CPUFUNC(op_260_5), 0, 608 }, /* AND */
-{ CPUFUNC(op_268_5), 0, 616 }, /* AND */
-{ CPUFUNC(op_270_5), 0, 624 }, /* AND */
-{ CPUFUNC(op_278_5), 0, 632 }, /* AND */
-{ CPUFUNC(op_279_5), 0, 633 }, /* AND */
-{ CPUFUNC(op_27c_5), 0, 636 }, /* ANDSR */
-{ CPUFUNC(op_280_5), 0, 640 }, /* AND */
-{ CPUFUNC(op_290_5), 0, 656 }, /* AND */
-{ CPUFUNC(op_298_5), 0, 664 }, /* AND */
-{ CPUFUNC(op_2a0_5), 0, 672 }, /* AND */
-{ CPUFUNC(op_2a8_5), 0, 680 }, /* AND */
-{ CPUFUNC(op_2b0_5), 0, 688 }, /* AND */
-{ CPUFUNC(op_2b8_5), 0, 696 }, /* AND */
-{ CPUFUNC(op_2b9_5), 0, 697 }, /* AND */
-{ CPUFUNC(op_400_5), 0, 1024 }, /* SUB */
-{ CPUFUNC(op_410_5), 0, 1040 }, /* SUB */
-{ CPUFUNC(op_418_5), 0, 1048 }, /* SUB */
-{ CPUFUNC(op_420_5), 0, 1056 }, /* SUB */
-{ CPUFUNC(op_428_5), 0, 1064 }, /* SUB */
-{ CPUFUNC(op_430_5), 0, 1072 }, /* SUB */
-{ CPUFUNC(op_438_5), 0, 1080 }, /* SUB */
-{ CPUFUNC(op_439_5), 0, 1081 }, /* SUB */
-{ CPUFUNC(op_440_5), 0, 1088 }, /* SUB */
-{ CPUFUNC(op_450_5), 0, 1104 }, /* SUB */
-{ CPUFUNC(op_458_5), 0, 1112 }, /* SUB */
-{ CPUFUNC(op_460_5), 0, 1120 }, /* SUB */
-{ CPUFUNC(op_468_5), 0, 1128 }, /* SUB */
-{ CPUFUNC(op_470_5), 0, 1136 }, /* SUB */
-{ CPUFUNC(op_478_5), 0, 1144 }, /* SUB */
-{ CPUFUNC(op_479_5), 0, 1145 }, /* SUB */
-{ CPUFUNC(op_480_5), 0, 1152 }, /* SUB */
-{ CPUFUNC(op_490_5), 0, 1168 }, /* SUB */
-{ CPUFUNC(op_498_5), 0, 1176 }, /* SUB */
-{ CPUFUNC(op_4a0_5), 0, 1184 }, /* SUB */
-{ CPUFUNC(op_4a8_5), 0, 1192 }, /* SUB */
-{ CPUFUNC(op_4b0_5), 0, 1200 }, /* SUB */
-{ CPUFUNC(op_4b8_5), 0, 1208 }, /* SUB */
-{ CPUFUNC(op_4b9_5), 0, 1209 }, /* SUB */
-{ CPUFUNC(op_600_5), 0, 1536 }, /* ADD */
-{ CPUFUNC(op_610_5), 0, 1552 }, /* ADD */
-{ CPUFUNC(op_618_5), 0, 1560 }, /* ADD */
-{ CPUFUNC(op_620_5), 0, 1568 }, /* ADD */
-{ CPUFUNC(op_628_5), 0, 1576 }, /* ADD */
-{ CPUFUNC(op_630_5), 0, 1584 }, /* ADD */
-{ CPUFUNC(op_638_5), 0, 1592 }, /* ADD */
-{ CPUFUNC(op_639_5), 0, 1593 }, /* ADD */
-{ CPUFUNC(op_640_5), 0, 1600 }, /* ADD */
-{ CPUFUNC(op_650_5), 0, 1616 }, /* ADD */
-{ CPUFUNC(op_658_5), 0, 1624 }, /* ADD */
-{ CPUFUNC(op_660_5), 0, 1632 }, /* ADD */
-{ CPUFUNC(op_668_5), 0, 1640 }, /* ADD */
-{ CPUFUNC(op_670_5), 0, 1648 }, /* ADD */
-{ CPUFUNC(op_678_5), 0, 1656 }, /* ADD */
-{ CPUFUNC(op_679_5), 0, 1657 }, /* ADD */
-{ CPUFUNC(op_680_5), 0, 1664 }, /* ADD */
-{ CPUFUNC(op_690_5), 0, 1680 }, /* ADD */
-{ CPUFUNC(op_698_5), 0, 1688 }, /* ADD */
-{ CPUFUNC(op_6a0_5), 0, 1696 }, /* ADD */
-{ CPUFUNC(op_6a8_5), 0, 1704 }, /* ADD */
-{ CPUFUNC(op_6b0_5), 0, 1712 }, /* ADD */
-{ CPUFUNC(op_6b8_5), 0, 1720 }, /* ADD */
-{ CPUFUNC(op_6b9_5), 0, 1721 }, /* ADD */
-{ CPUFUNC(op_800_5), 0, 2048 }, /* BTST */
-{ CPUFUNC(op_810_5), 0, 2064 }, /* BTST */
-{ CPUFUNC(op_818_5), 0, 2072 }, /* BTST */
-{ CPUFUNC(op_820_5), 0, 2080 }, /* BTST */
-{ CPUFUNC(op_828_5), 0, 2088 }, /* BTST */
-{ CPUFUNC(op_830_5), 0, 2096 }, /* BTST */
-{ CPUFUNC(op_838_5), 0, 2104 }, /* BTST */
-{ CPUFUNC(op_839_5), 0, 2105 }, /* BTST */
-{ CPUFUNC(op_83a_5), 0, 2106 }, /* BTST */
-{ CPUFUNC(op_83b_5), 0, 2107 }, /* BTST */
-{ CPUFUNC(op_83c_5), 0, 2108 }, /* BTST */
-{ CPUFUNC(op_840_5), 0, 2112 }, /* BCHG */
-{ CPUFUNC(op_850_5), 0, 2128 }, /* BCHG */
-{ CPUFUNC(op_858_5), 0, 2136 }, /* BCHG */
-{ CPUFUNC(op_860_5), 0, 2144 }, /* BCHG */
-{ CPUFUNC(op_868_5), 0, 2152 }, /* BCHG */
-{ CPUFUNC(op_870_5), 0, 2160 }, /* BCHG */
-{ CPUFUNC(op_878_5), 0, 2168 }, /* BCHG */
-{ CPUFUNC(op_879_5), 0, 2169 }, /* BCHG */
-{ CPUFUNC(op_87a_5), 0, 2170 }, /* BCHG */
-{ CPUFUNC(op_87b_5), 0, 2171 }, /* BCHG */
-{ CPUFUNC(op_880_5), 0, 2176 }, /* BCLR */
-{ CPUFUNC(op_890_5), 0, 2192 }, /* BCLR */
-{ CPUFUNC(op_898_5), 0, 2200 }, /* BCLR */
-{ CPUFUNC(op_8a0_5), 0, 2208 }, /* BCLR */
-{ CPUFUNC(op_8a8_5), 0, 2216 }, /* BCLR */
-{ CPUFUNC(op_8b0_5), 0, 2224 }, /* BCLR */
-{ CPUFUNC(op_8b8_5), 0, 2232 }, /* BCLR */
-{ CPUFUNC(op_8b9_5), 0, 2233 }, /* BCLR */
-{ CPUFUNC(op_8ba_5), 0, 2234 }, /* BCLR */
-{ CPUFUNC(op_8bb_5), 0, 2235 }, /* BCLR */
-{ CPUFUNC(op_8c0_5), 0, 2240 }, /* BSET */
-{ CPUFUNC(op_8d0_5), 0, 2256 }, /* BSET */
-{ CPUFUNC(op_8d8_5), 0, 2264 }, /* BSET */
-{ CPUFUNC(op_8e0_5), 0, 2272 }, /* BSET */
-{ CPUFUNC(op_8e8_5), 0, 2280 }, /* BSET */
-{ CPUFUNC(op_8f0_5), 0, 2288 }, /* BSET */
-{ CPUFUNC(op_8f8_5), 0, 2296 }, /* BSET */
-{ CPUFUNC(op_8f9_5), 0, 2297 }, /* BSET */
-{ CPUFUNC(op_8fa_5), 0, 2298 }, /* BSET */
-{ CPUFUNC(op_8fb_5), 0, 2299 }, /* BSET */
-{ CPUFUNC(op_a00_5), 0, 2560 }, /* EOR */
-{ CPUFUNC(op_a10_5), 0, 2576 }, /* EOR */
-{ CPUFUNC(op_a18_5), 0, 2584 }, /* EOR */
-{ CPUFUNC(op_a20_5), 0, 2592 }, /* EOR */
-{ CPUFUNC(op_a28_5), 0, 2600 }, /* EOR */
-{ CPUFUNC(op_a30_5), 0, 2608 }, /* EOR */
-{ CPUFUNC(op_a38_5), 0, 2616 }, /* EOR */
-{ CPUFUNC(op_a39_5), 0, 2617 }, /* EOR */
-{ CPUFUNC(op_a3c_5), 0, 2620 }, /* EORSR */
-{ CPUFUNC(op_a40_5), 0, 2624 }, /* EOR */
-{ CPUFUNC(op_a50_5), 0, 2640 }, /* EOR */
-{ CPUFUNC(op_a58_5), 0, 2648 }, /* EOR */
-{ CPUFUNC(op_a60_5), 0, 2656 }, /* EOR */
-{ CPUFUNC(op_a68_5), 0, 2664 }, /* EOR */
-{ CPUFUNC(op_a70_5), 0, 2672 }, /* EOR */
-{ CPUFUNC(op_a78_5), 0, 2680 }, /* EOR */
-{ CPUFUNC(op_a79_5), 0, 2681 }, /* EOR */
-{ CPUFUNC(op_a7c_5), 0, 2684 }, /* EORSR */
-{ CPUFUNC(op_a80_5), 0, 2688 }, /* EOR */
-{ CPUFUNC(op_a90_5), 0, 2704 }, /* EOR */
-{ CPUFUNC(op_a98_5), 0, 2712 }, /* EOR */
-{ CPUFUNC(op_aa0_5), 0, 2720 }, /* EOR */
-{ CPUFUNC(op_aa8_5), 0, 2728 }, /* EOR */
-{ CPUFUNC(op_ab0_5), 0, 2736 }, /* EOR */
-{ CPUFUNC(op_ab8_5), 0, 2744 }, /* EOR */
-{ CPUFUNC(op_ab9_5), 0, 2745 }, /* EOR */
-{ CPUFUNC(op_c00_5), 0, 3072 }, /* CMP */
-{ CPUFUNC(op_c10_5), 0, 3088 }, /* CMP */
-{ CPUFUNC(op_c18_5), 0, 3096 }, /* CMP */
-{ CPUFUNC(op_c20_5), 0, 3104 }, /* CMP */
-{ CPUFUNC(op_c28_5), 0, 3112 }, /* CMP */
-{ CPUFUNC(op_c30_5), 0, 3120 }, /* CMP */
-{ CPUFUNC(op_c38_5), 0, 3128 }, /* CMP */
-{ CPUFUNC(op_c39_5), 0, 3129 }, /* CMP */
-{ CPUFUNC(op_c3a_5), 0, 3130 }, /* CMP */
-{ CPUFUNC(op_c3b_5), 0, 3131 }, /* CMP */
-{ CPUFUNC(op_c40_5), 0, 3136 }, /* CMP */
-{ CPUFUNC(op_c50_5), 0, 3152 }, /* CMP */
-{ CPUFUNC(op_c58_5), 0, 3160 }, /* CMP */
-{ CPUFUNC(op_c60_5), 0, 3168 }, /* CMP */
-{ CPUFUNC(op_c68_5), 0, 3176 }, /* CMP */
-{ CPUFUNC(op_c70_5), 0, 3184 }, /* CMP */
-{ CPUFUNC(op_c78_5), 0, 3192 }, /* CMP */
-{ CPUFUNC(op_c79_5), 0, 3193 }, /* CMP */
-{ CPUFUNC(op_c7a_5), 0, 3194 }, /* CMP */
-{ CPUFUNC(op_c7b_5), 0, 3195 }, /* CMP */
-{ CPUFUNC(op_c80_5), 0, 3200 }, /* CMP */
-{ CPUFUNC(op_c90_5), 0, 3216 }, /* CMP */
-{ CPUFUNC(op_c98_5), 0, 3224 }, /* CMP */
-{ CPUFUNC(op_ca0_5), 0, 3232 }, /* CMP */
-{ CPUFUNC(op_ca8_5), 0, 3240 }, /* CMP */
-{ CPUFUNC(op_cb0_5), 0, 3248 }, /* CMP */
-{ CPUFUNC(op_cb8_5), 0, 3256 }, /* CMP */
-{ CPUFUNC(op_cb9_5), 0, 3257 }, /* CMP */
-{ CPUFUNC(op_cba_5), 0, 3258 }, /* CMP */
-{ CPUFUNC(op_cbb_5), 0, 3259 }, /* CMP */
-{ CPUFUNC(op_1000_5), 0, 4096 }, /* MOVE */
-{ CPUFUNC(op_1008_5), 0, 4104 }, /* MOVE */
-{ CPUFUNC(op_1010_5), 0, 4112 }, /* MOVE */
-{ CPUFUNC(op_1018_5), 0, 4120 }, /* MOVE */
-{ CPUFUNC(op_1020_5), 0, 4128 }, /* MOVE */
-{ CPUFUNC(op_1028_5), 0, 4136 }, /* MOVE */
-{ CPUFUNC(op_1030_5), 0, 4144 }, /* MOVE */
-{ CPUFUNC(op_1038_5), 0, 4152 }, /* MOVE */
-{ CPUFUNC(op_1039_5), 0, 4153 }, /* MOVE */
-{ CPUFUNC(op_103a_5), 0, 4154 }, /* MOVE */
-{ CPUFUNC(op_103b_5), 0, 4155 }, /* MOVE */
-{ CPUFUNC(op_103c_5), 0, 4156 }, /* MOVE */
-{ CPUFUNC(op_1080_5), 0, 4224 }, /* MOVE */
-{ CPUFUNC(op_1088_5), 0, 4232 }, /* MOVE */
-{ CPUFUNC(op_1090_5), 0, 4240 }, /* MOVE */
-{ CPUFUNC(op_1098_5), 0, 4248 }, /* MOVE */
-{ CPUFUNC(op_10a0_5), 0, 4256 }, /* MOVE */
-{ CPUFUNC(op_10a8_5), 0, 4264 }, /* MOVE */
-{ CPUFUNC(op_10b0_5), 0, 4272 }, /* MOVE */
-{ CPUFUNC(op_10b8_5), 0, 4280 }, /* MOVE */
-{ CPUFUNC(op_10b9_5), 0, 4281 }, /* MOVE */
-{ CPUFUNC(op_10ba_5), 0, 4282 }, /* MOVE */
-{ CPUFUNC(op_10bb_5), 0, 4283 }, /* MOVE */
-{ CPUFUNC(op_10bc_5), 0, 4284 }, /* MOVE */
-{ CPUFUNC(op_10c0_5), 0, 4288 }, /* MOVE */
-{ CPUFUNC(op_10c8_5), 0, 4296 }, /* MOVE */
-{ CPUFUNC(op_10d0_5), 0, 4304 }, /* MOVE */
-{ CPUFUNC(op_10d8_5), 0, 4312 }, /* MOVE */
-{ CPUFUNC(op_10e0_5), 0, 4320 }, /* MOVE */
-{ CPUFUNC(op_10e8_5), 0, 4328 }, /* MOVE */
-{ CPUFUNC(op_10f0_5), 0, 4336 }, /* MOVE */
-{ CPUFUNC(op_10f8_5), 0, 4344 }, /* MOVE */
-{ CPUFUNC(op_10f9_5), 0, 4345 }, /* MOVE */
-{ CPUFUNC(op_10fa_5), 0, 4346 }, /* MOVE */
-{ CPUFUNC(op_10fb_5), 0, 4347 }, /* MOVE */
-{ CPUFUNC(op_10fc_5), 0, 4348 }, /* MOVE */
-{ CPUFUNC(op_1100_5), 0, 4352 }, /* MOVE */
-{ CPUFUNC(op_1108_5), 0, 4360 }, /* MOVE */
-{ CPUFUNC(op_1110_5), 0, 4368 }, /* MOVE */
-{ CPUFUNC(op_1118_5), 0, 4376 }, /* MOVE */
-{ CPUFUNC(op_1120_5), 0, 4384 }, /* MOVE */
-{ CPUFUNC(op_1128_5), 0, 4392 }, /* MOVE */
-{ CPUFUNC(op_1130_5), 0, 4400 }, /* MOVE */
-{ CPUFUNC(op_1138_5), 0, 4408 }, /* MOVE */
-{ CPUFUNC(op_1139_5), 0, 4409 }, /* MOVE */
-{ CPUFUNC(op_113a_5), 0, 4410 }, /* MOVE */
-{ CPUFUNC(op_113b_5), 0, 4411 }, /* MOVE */
-{ CPUFUNC(op_113c_5), 0, 4412 }, /* MOVE */
-{ CPUFUNC(op_1140_5), 0, 4416 }, /* MOVE */
-{ CPUFUNC(op_1148_5), 0, 4424 }, /* MOVE */
-{ CPUFUNC(op_1150_5), 0, 4432 }, /* MOVE */
-{ CPUFUNC(op_1158_5), 0, 4440 }, /* MOVE */
-{ CPUFUNC(op_1160_5), 0, 4448 }, /* MOVE */
-{ CPUFUNC(op_1168_5), 0, 4456 }, /* MOVE */
-{ CPUFUNC(op_1170_5), 0, 4464 }, /* MOVE */
-{ CPUFUNC(op_1178_5), 0, 4472 }, /* MOVE */
-{ CPUFUNC(op_1179_5), 0, 4473 }, /* MOVE */
-{ CPUFUNC(op_117a_5), 0, 4474 }, /* MOVE */
-{ CPUFUNC(op_117b_5), 0, 4475 }, /* MOVE */
-{ CPUFUNC(op_117c_5), 0, 4476 }, /* MOVE */
-{ CPUFUNC(op_1180_5), 0, 4480 }, /* MOVE */
-{ CPUFUNC(op_1188_5), 0, 4488 }, /* MOVE */
-{ CPUFUNC(op_1190_5), 0, 4496 }, /* MOVE */
-{ CPUFUNC(op_1198_5), 0, 4504 }, /* MOVE */
-{ CPUFUNC(op_11a0_5), 0, 4512 }, /* MOVE */
-{ CPUFUNC(op_11a8_5), 0, 4520 }, /* MOVE */
-{ CPUFUNC(op_11b0_5), 0, 4528 }, /* MOVE */
-{ CPUFUNC(op_11b8_5), 0, 4536 }, /* MOVE */
-{ CPUFUNC(op_11b9_5), 0, 4537 }, /* MOVE */
-{ CPUFUNC(op_11ba_5), 0, 4538 }, /* MOVE */
-{ CPUFUNC(op_11bb_5), 0, 4539 }, /* MOVE */
-{ CPUFUNC(op_11bc_5), 0, 4540 }, /* MOVE */
-{ CPUFUNC(op_11c0_5), 0, 4544 }, /* MOVE */
-{ CPUFUNC(op_11c8_5), 0, 4552 }, /* MOVE */
-{ CPUFUNC(op_11d0_5), 0, 4560 }, /* MOVE */
-{ CPUFUNC(op_11d8_5), 0, 4568 }, /* MOVE */
-{ CPUFUNC(op_11e0_5), 0, 4576 }, /* MOVE */
-{ CPUFUNC(op_11e8_5), 0, 4584 }, /* MOVE */
-{ CPUFUNC(op_11f0_5), 0, 4592 }, /* MOVE */
-{ CPUFUNC(op_11f8_5), 0, 4600 }, /* MOVE */
-{ CPUFUNC(op_11f9_5), 0, 4601 }, /* MOVE */
-{ CPUFUNC(op_11fa_5), 0, 4602 }, /* MOVE */
-{ CPUFUNC(op_11fb_5), 0, 4603 }, /* MOVE */
-{ CPUFUNC(op_11fc_5), 0, 4604 }, /* MOVE */
-{ CPUFUNC(op_13c0_5), 0, 5056 }, /* MOVE */
-{ CPUFUNC(op_13c8_5), 0, 5064 }, /* MOVE */
-{ CPUFUNC(op_13d0_5), 0, 5072 }, /* MOVE */
-{ CPUFUNC(op_13d8_5), 0, 5080 }, /* MOVE */
-{ CPUFUNC(op_13e0_5), 0, 5088 }, /* MOVE */
-{ CPUFUNC(op_13e8_5), 0, 5096 }, /* MOVE */
-{ CPUFUNC(op_13f0_5), 0, 5104 }, /* MOVE */
-{ CPUFUNC(op_13f8_5), 0, 5112 }, /* MOVE */
-{ CPUFUNC(op_13f9_5), 0, 5113 }, /* MOVE */
-{ CPUFUNC(op_13fa_5), 0, 5114 }, /* MOVE */
-{ CPUFUNC(op_13fb_5), 0, 5115 }, /* MOVE */
-{ CPUFUNC(op_13fc_5), 0, 5116 }, /* MOVE */
-{ CPUFUNC(op_2000_5), 0, 8192 }, /* MOVE */
-{ CPUFUNC(op_2008_5), 0, 8200 }, /* MOVE */
-{ CPUFUNC(op_2010_5), 0, 8208 }, /* MOVE */
-{ CPUFUNC(op_2018_5), 0, 8216 }, /* MOVE */
-{ CPUFUNC(op_2020_5), 0, 8224 }, /* MOVE */
-{ CPUFUNC(op_2028_5), 0, 8232 }, /* MOVE */
-{ CPUFUNC(op_2030_5), 0, 8240 }, /* MOVE */
-{ CPUFUNC(op_2038_5), 0, 8248 }, /* MOVE */
-{ CPUFUNC(op_2039_5), 0, 8249 }, /* MOVE */
-{ CPUFUNC(op_203a_5), 0, 8250 }, /* MOVE */
-{ CPUFUNC(op_203b_5), 0, 8251 }, /* MOVE */
-{ CPUFUNC(op_203c_5), 0, 8252 }, /* MOVE */
-{ CPUFUNC(op_2040_5), 0, 8256 }, /* MOVEA */
-{ CPUFUNC(op_2048_5), 0, 8264 }, /* MOVEA */
-{ CPUFUNC(op_2050_5), 0, 8272 }, /* MOVEA */
-{ CPUFUNC(op_2058_5), 0, 8280 }, /* MOVEA */
-{ CPUFUNC(op_2060_5), 0, 8288 }, /* MOVEA */
-{ CPUFUNC(op_2068_5), 0, 8296 }, /* MOVEA */
-{ CPUFUNC(op_2070_5), 0, 8304 }, /* MOVEA */
-{ CPUFUNC(op_2078_5), 0, 8312 }, /* MOVEA */
-{ CPUFUNC(op_2079_5), 0, 8313 }, /* MOVEA */
-{ CPUFUNC(op_207a_5), 0, 8314 }, /* MOVEA */
-{ CPUFUNC(op_207b_5), 0, 8315 }, /* MOVEA */
-{ CPUFUNC(op_207c_5), 0, 8316 }, /* MOVEA */
-{ CPUFUNC(op_2080_5), 0, 8320 }, /* MOVE */
-{ CPUFUNC(op_2088_5), 0, 8328 }, /* MOVE */
-{ CPUFUNC(op_2090_5), 0, 8336 }, /* MOVE */
-{ CPUFUNC(op_2098_5), 0, 8344 }, /* MOVE */
-{ CPUFUNC(op_20a0_5), 0, 8352 }, /* MOVE */
-{ CPUFUNC(op_20a8_5), 0, 8360 }, /* MOVE */
-{ CPUFUNC(op_20b0_5), 0, 8368 }, /* MOVE */
-{ CPUFUNC(op_20b8_5), 0, 8376 }, /* MOVE */
-{ CPUFUNC(op_20b9_5), 0, 8377 }, /* MOVE */
-{ CPUFUNC(op_20ba_5), 0, 8378 }, /* MOVE */
-{ CPUFUNC(op_20bb_5), 0, 8379 }, /* MOVE */
-{ CPUFUNC(op_20bc_5), 0, 8380 }, /* MOVE */
-{ CPUFUNC(op_20c0_5), 0, 8384 }, /* MOVE */
-{ CPUFUNC(op_20c8_5), 0, 8392 }, /* MOVE */
-{ CPUFUNC(op_20d0_5), 0, 8400 }, /* MOVE */
-{ CPUFUNC(op_20d8_5), 0, 8408 }, /* MOVE */
-{ CPUFUNC(op_20e0_5), 0, 8416 }, /* MOVE */
-{ CPUFUNC(op_20e8_5), 0, 8424 }, /* MOVE */
-{ CPUFUNC(op_20f0_5), 0, 8432 }, /* MOVE */
-{ CPUFUNC(op_20f8_5), 0, 8440 }, /* MOVE */
-{ CPUFUNC(op_20f9_5), 0, 8441 }, /* MOVE */
-{ CPUFUNC(op_20fa_5), 0, 8442 }, /* MOVE */
-{ CPUFUNC(op_20fb_5), 0, 8443 }, /* MOVE */
-{ CPUFUNC(op_20fc_5), 0, 8444 }, /* MOVE */
-{ CPUFUNC(op_2100_5), 0, 8448 }, /* MOVE */
-{ CPUFUNC(op_2108_5), 0, 8456 }, /* MOVE */
-{ CPUFUNC(op_2110_5), 0, 8464 }, /* MOVE */
-{ CPUFUNC(op_2118_5), 0, 8472 }, /* MOVE */
-{ CPUFUNC(op_2120_5), 0, 8480 }, /* MOVE */
-{ CPUFUNC(op_2128_5), 0, 8488 }, /* MOVE */
-{ CPUFUNC(op_2130_5), 0, 8496 }, /* MOVE */
-{ CPUFUNC(op_2138_5), 0, 8504 }, /* MOVE */
-{ CPUFUNC(op_2139_5), 0, 8505 }, /* MOVE */
-{ CPUFUNC(op_213a_5), 0, 8506 }, /* MOVE */
-{ CPUFUNC(op_213b_5), 0, 8507 }, /* MOVE */
-{ CPUFUNC(op_213c_5), 0, 8508 }, /* MOVE */
-{ CPUFUNC(op_2140_5), 0, 8512 }, /* MOVE */
-{ CPUFUNC(op_2148_5), 0, 8520 }, /* MOVE */
-{ CPUFUNC(op_2150_5), 0, 8528 }, /* MOVE */
-{ CPUFUNC(op_2158_5), 0, 8536 }, /* MOVE */
-{ CPUFUNC(op_2160_5), 0, 8544 }, /* MOVE */
-{ CPUFUNC(op_2168_5), 0, 8552 }, /* MOVE */
-{ CPUFUNC(op_2170_5), 0, 8560 }, /* MOVE */
-{ CPUFUNC(op_2178_5), 0, 8568 }, /* MOVE */
-{ CPUFUNC(op_2179_5), 0, 8569 }, /* MOVE */
-{ CPUFUNC(op_217a_5), 0, 8570 }, /* MOVE */
-{ CPUFUNC(op_217b_5), 0, 8571 }, /* MOVE */
-{ CPUFUNC(op_217c_5), 0, 8572 }, /* MOVE */
-{ CPUFUNC(op_2180_5), 0, 8576 }, /* MOVE */
-{ CPUFUNC(op_2188_5), 0, 8584 }, /* MOVE */
-{ CPUFUNC(op_2190_5), 0, 8592 }, /* MOVE */
-{ CPUFUNC(op_2198_5), 0, 8600 }, /* MOVE */
-{ CPUFUNC(op_21a0_5), 0, 8608 }, /* MOVE */
-{ CPUFUNC(op_21a8_5), 0, 8616 }, /* MOVE */
-{ CPUFUNC(op_21b0_5), 0, 8624 }, /* MOVE */
-{ CPUFUNC(op_21b8_5), 0, 8632 }, /* MOVE */
-{ CPUFUNC(op_21b9_5), 0, 8633 }, /* MOVE */
-{ CPUFUNC(op_21ba_5), 0, 8634 }, /* MOVE */
-{ CPUFUNC(op_21bb_5), 0, 8635 }, /* MOVE */
-{ CPUFUNC(op_21bc_5), 0, 8636 }, /* MOVE */
-{ CPUFUNC(op_21c0_5), 0, 8640 }, /* MOVE */
-{ CPUFUNC(op_21c8_5), 0, 8648 }, /* MOVE */
-{ CPUFUNC(op_21d0_5), 0, 8656 }, /* MOVE */
-{ CPUFUNC(op_21d8_5), 0, 8664 }, /* MOVE */
-{ CPUFUNC(op_21e0_5), 0, 8672 }, /* MOVE */
-{ CPUFUNC(op_21e8_5), 0, 8680 }, /* MOVE */
-{ CPUFUNC(op_21f0_5), 0, 8688 }, /* MOVE */
-{ CPUFUNC(op_21f8_5), 0, 8696 }, /* MOVE */
-{ CPUFUNC(op_21f9_5), 0, 8697 }, /* MOVE */
-{ CPUFUNC(op_21fa_5), 0, 8698 }, /* MOVE */
-{ CPUFUNC(op_21fb_5), 0, 8699 }, /* MOVE */
-{ CPUFUNC(op_21fc_5), 0, 8700 }, /* MOVE */
-{ CPUFUNC(op_23c0_5), 0, 9152 }, /* MOVE */
-{ CPUFUNC(op_23c8_5), 0, 9160 }, /* MOVE */
-{ CPUFUNC(op_23d0_5), 0, 9168 }, /* MOVE */
-{ CPUFUNC(op_23d8_5), 0, 9176 }, /* MOVE */
-{ CPUFUNC(op_23e0_5), 0, 9184 }, /* MOVE */
-{ CPUFUNC(op_23e8_5), 0, 9192 }, /* MOVE */
-{ CPUFUNC(op_23f0_5), 0, 9200 }, /* MOVE */
-{ CPUFUNC(op_23f8_5), 0, 9208 }, /* MOVE */
-{ CPUFUNC(op_23f9_5), 0, 9209 }, /* MOVE */
-{ CPUFUNC(op_23fa_5), 0, 9210 }, /* MOVE */
-{ CPUFUNC(op_23fb_5), 0, 9211 }, /* MOVE */
-{ CPUFUNC(op_23fc_5), 0, 9212 }, /* MOVE */
-{ CPUFUNC(op_3000_5), 0, 12288 }, /* MOVE */
-{ CPUFUNC(op_3008_5), 0, 12296 }, /* MOVE */
-{ CPUFUNC(op_3010_5), 0, 12304 }, /* MOVE */
-{ CPUFUNC(op_3018_5), 0, 12312 }, /* MOVE */
-{ CPUFUNC(op_3020_5), 0, 12320 }, /* MOVE */
-{ CPUFUNC(op_3028_5), 0, 12328 }, /* MOVE */
-{ CPUFUNC(op_3030_5), 0, 12336 }, /* MOVE */
-{ CPUFUNC(op_3038_5), 0, 12344 }, /* MOVE */
-{ CPUFUNC(op_3039_5), 0, 12345 }, /* MOVE */
-{ CPUFUNC(op_303a_5), 0, 12346 }, /* MOVE */
-{ CPUFUNC(op_303b_5), 0, 12347 }, /* MOVE */
-{ CPUFUNC(op_303c_5), 0, 12348 }, /* MOVE */
-{ CPUFUNC(op_3040_5), 0, 12352 }, /* MOVEA */
-{ CPUFUNC(op_3048_5), 0, 12360 }, /* MOVEA */
-{ CPUFUNC(op_3050_5), 0, 12368 }, /* MOVEA */
-{ CPUFUNC(op_3058_5), 0, 12376 }, /* MOVEA */
-{ CPUFUNC(op_3060_5), 0, 12384 }, /* MOVEA */
-{ CPUFUNC(op_3068_5), 0, 12392 }, /* MOVEA */
-{ CPUFUNC(op_3070_5), 0, 12400 }, /* MOVEA */
-{ CPUFUNC(op_3078_5), 0, 12408 }, /* MOVEA */
-{ CPUFUNC(op_3079_5), 0, 12409 }, /* MOVEA */
-{ CPUFUNC(op_307a_5), 0, 12410 }, /* MOVEA */
-{ CPUFUNC(op_307b_5), 0, 12411 }, /* MOVEA */
-{ CPUFUNC(op_307c_5), 0, 12412 }, /* MOVEA */
-{ CPUFUNC(op_3080_5), 0, 12416 }, /* MOVE */
-{ CPUFUNC(op_3088_5), 0, 12424 }, /* MOVE */
-{ CPUFUNC(op_3090_5), 0, 12432 }, /* MOVE */
-{ CPUFUNC(op_3098_5), 0, 12440 }, /* MOVE */
-{ CPUFUNC(op_30a0_5), 0, 12448 }, /* MOVE */
-{ CPUFUNC(op_30a8_5), 0, 12456 }, /* MOVE */
-{ CPUFUNC(op_30b0_5), 0, 12464 }, /* MOVE */
-{ CPUFUNC(op_30b8_5), 0, 12472 }, /* MOVE */
-{ CPUFUNC(op_30b9_5), 0, 12473 }, /* MOVE */
-{ CPUFUNC(op_30ba_5), 0, 12474 }, /* MOVE */
-{ CPUFUNC(op_30bb_5), 0, 12475 }, /* MOVE */
-{ CPUFUNC(op_30bc_5), 0, 12476 }, /* MOVE */
-{ CPUFUNC(op_30c0_5), 0, 12480 }, /* MOVE */
-{ CPUFUNC(op_30c8_5), 0, 12488 }, /* MOVE */
-{ CPUFUNC(op_30d0_5), 0, 12496 }, /* MOVE */
-{ CPUFUNC(op_30d8_5), 0, 12504 }, /* MOVE */
-{ CPUFUNC(op_30e0_5), 0, 12512 }, /* MOVE */
-{ CPUFUNC(op_30e8_5), 0, 12520 }, /* MOVE */
-{ CPUFUNC(op_30f0_5), 0, 12528 }, /* MOVE */
-{ CPUFUNC(op_30f8_5), 0, 12536 }, /* MOVE */
-{ CPUFUNC(op_30f9_5), 0, 12537 }, /* MOVE */
-{ CPUFUNC(op_30fa_5), 0, 12538 }, /* MOVE */
-{ CPUFUNC(op_30fb_5), 0, 12539 }, /* MOVE */
-{ CPUFUNC(op_30fc_5), 0, 12540 }, /* MOVE */
-{ CPUFUNC(op_3100_5), 0, 12544 }, /* MOVE */
-{ CPUFUNC(op_3108_5), 0, 12552 }, /* MOVE */
-{ CPUFUNC(op_3110_5), 0, 12560 }, /* MOVE */
-{ CPUFUNC(op_3118_5), 0, 12568 }, /* MOVE */
-{ CPUFUNC(op_3120_5), 0, 12576 }, /* MOVE */
-{ CPUFUNC(op_3128_5), 0, 12584 }, /* MOVE */
-{ CPUFUNC(op_3130_5), 0, 12592 }, /* MOVE */
-{ CPUFUNC(op_3138_5), 0, 12600 }, /* MOVE */
-{ CPUFUNC(op_3139_5), 0, 12601 }, /* MOVE */
-{ CPUFUNC(op_313a_5), 0, 12602 }, /* MOVE */
-{ CPUFUNC(op_313b_5), 0, 12603 }, /* MOVE */
-{ CPUFUNC(op_313c_5), 0, 12604 }, /* MOVE */
-{ CPUFUNC(op_3140_5), 0, 12608 }, /* MOVE */
-{ CPUFUNC(op_3148_5), 0, 12616 }, /* MOVE */
-{ CPUFUNC(op_3150_5), 0, 12624 }, /* MOVE */
-{ CPUFUNC(op_3158_5), 0, 12632 }, /* MOVE */
-{ CPUFUNC(op_3160_5), 0, 12640 }, /* MOVE */
-{ CPUFUNC(op_3168_5), 0, 12648 }, /* MOVE */
-{ CPUFUNC(op_3170_5), 0, 12656 }, /* MOVE */
-{ CPUFUNC(op_3178_5), 0, 12664 }, /* MOVE */
-{ CPUFUNC(op_3179_5), 0, 12665 }, /* MOVE */
-{ CPUFUNC(op_317a_5), 0, 12666 }, /* MOVE */
-{ CPUFUNC(op_317b_5), 0, 12667 }, /* MOVE */
-{ CPUFUNC(op_317c_5), 0, 12668 }, /* MOVE */
-{ CPUFUNC(op_3180_5), 0, 12672 }, /* MOVE */
-{ CPUFUNC(op_3188_5), 0, 12680 }, /* MOVE */
-{ CPUFUNC(op_3190_5), 0, 12688 }, /* MOVE */
-{ CPUFUNC(op_3198_5), 0, 12696 }, /* MOVE */
-{ CPUFUNC(op_31a0_5), 0, 12704 }, /* MOVE */
-{ CPUFUNC(op_31a8_5), 0, 12712 }, /* MOVE */
-{ CPUFUNC(op_31b0_5), 0, 12720 }, /* MOVE */
-{ CPUFUNC(op_31b8_5), 0, 12728 }, /* MOVE */
-{ CPUFUNC(op_31b9_5), 0, 12729 }, /* MOVE */
-{ CPUFUNC(op_31ba_5), 0, 12730 }, /* MOVE */
-{ CPUFUNC(op_31bb_5), 0, 12731 }, /* MOVE */
-{ CPUFUNC(op_31bc_5), 0, 12732 }, /* MOVE */
-{ CPUFUNC(op_31c0_5), 0, 12736 }, /* MOVE */
-{ CPUFUNC(op_31c8_5), 0, 12744 }, /* MOVE */
-{ CPUFUNC(op_31d0_5), 0, 12752 }, /* MOVE */
-{ CPUFUNC(op_31d8_5), 0, 12760 }, /* MOVE */
-{ CPUFUNC(op_31e0_5), 0, 12768 }, /* MOVE */
-{ CPUFUNC(op_31e8_5), 0, 12776 }, /* MOVE */
-{ CPUFUNC(op_31f0_5), 0, 12784 }, /* MOVE */
-{ CPUFUNC(op_31f8_5), 0, 12792 }, /* MOVE */
-{ CPUFUNC(op_31f9_5), 0, 12793 }, /* MOVE */
-{ CPUFUNC(op_31fa_5), 0, 12794 }, /* MOVE */
-{ CPUFUNC(op_31fb_5), 0, 12795 }, /* MOVE */
-{ CPUFUNC(op_31fc_5), 0, 12796 }, /* MOVE */
-{ CPUFUNC(op_33c0_5), 0, 13248 }, /* MOVE */
-{ CPUFUNC(op_33c8_5), 0, 13256 }, /* MOVE */
-{ CPUFUNC(op_33d0_5), 0, 13264 }, /* MOVE */
-{ CPUFUNC(op_33d8_5), 0, 13272 }, /* MOVE */
-{ CPUFUNC(op_33e0_5), 0, 13280 }, /* MOVE */
-{ CPUFUNC(op_33e8_5), 0, 13288 }, /* MOVE */
-{ CPUFUNC(op_33f0_5), 0, 13296 }, /* MOVE */
-{ CPUFUNC(op_33f8_5), 0, 13304 }, /* MOVE */
-{ CPUFUNC(op_33f9_5), 0, 13305 }, /* MOVE */
-{ CPUFUNC(op_33fa_5), 0, 13306 }, /* MOVE */
-{ CPUFUNC(op_33fb_5), 0, 13307 }, /* MOVE */
-{ CPUFUNC(op_33fc_5), 0, 13308 }, /* MOVE */
-{ CPUFUNC(op_4000_5), 0, 16384 }, /* NEGX */
-{ CPUFUNC(op_4010_5), 0, 16400 }, /* NEGX */
-{ CPUFUNC(op_4018_5), 0, 16408 }, /* NEGX */
-{ CPUFUNC(op_4020_5), 0, 16416 }, /* NEGX */
-{ CPUFUNC(op_4028_5), 0, 16424 }, /* NEGX */
-{ CPUFUNC(op_4030_5), 0, 16432 }, /* NEGX */
-{ CPUFUNC(op_4038_5), 0, 16440 }, /* NEGX */
-{ CPUFUNC(op_4039_5), 0, 16441 }, /* NEGX */
-{ CPUFUNC(op_4040_5), 0, 16448 }, /* NEGX */
-{ CPUFUNC(op_4050_5), 0, 16464 }, /* NEGX */
-{ CPUFUNC(op_4058_5), 0, 16472 }, /* NEGX */
-{ CPUFUNC(op_4060_5), 0, 16480 }, /* NEGX */
-{ CPUFUNC(op_4068_5), 0, 16488 }, /* NEGX */
-{ CPUFUNC(op_4070_5), 0, 16496 }, /* NEGX */
-{ CPUFUNC(op_4078_5), 0, 16504 }, /* NEGX */
-{ CPUFUNC(op_4079_5), 0, 16505 }, /* NEGX */
-{ CPUFUNC(op_4080_5), 0, 16512 }, /* NEGX */
-{ CPUFUNC(op_4090_5), 0, 16528 }, /* NEGX */
-{ CPUFUNC(op_4098_5), 0, 16536 }, /* NEGX */
-{ CPUFUNC(op_40a0_5), 0, 16544 }, /* NEGX */
-{ CPUFUNC(op_40a8_5), 0, 16552 }, /* NEGX */
-{ CPUFUNC(op_40b0_5), 0, 16560 }, /* NEGX */
-{ CPUFUNC(op_40b8_5), 0, 16568 }, /* NEGX */
-{ CPUFUNC(op_40b9_5), 0, 16569 }, /* NEGX */
-{ CPUFUNC(op_40c0_5), 0, 16576 }, /* MVSR2 */
-{ CPUFUNC(op_40d0_5), 0, 16592 }, /* MVSR2 */
-{ CPUFUNC(op_40d8_5), 0, 16600 }, /* MVSR2 */
-{ CPUFUNC(op_40e0_5), 0, 16608 }, /* MVSR2 */
-{ CPUFUNC(op_40e8_5), 0, 16616 }, /* MVSR2 */
-{ CPUFUNC(op_40f0_5), 0, 16624 }, /* MVSR2 */
-{ CPUFUNC(op_40f8_5), 0, 16632 }, /* MVSR2 */
-{ CPUFUNC(op_40f9_5), 0, 16633 }, /* MVSR2 */
-{ CPUFUNC(op_4180_5), 0, 16768 }, /* CHK */
-{ CPUFUNC(op_4190_5), 0, 16784 }, /* CHK */
-{ CPUFUNC(op_4198_5), 0, 16792 }, /* CHK */
-{ CPUFUNC(op_41a0_5), 0, 16800 }, /* CHK */
-{ CPUFUNC(op_41a8_5), 0, 16808 }, /* CHK */
-{ CPUFUNC(op_41b0_5), 0, 16816 }, /* CHK */
-{ CPUFUNC(op_41b8_5), 0, 16824 }, /* CHK */
-{ CPUFUNC(op_41b9_5), 0, 16825 }, /* CHK */
-{ CPUFUNC(op_41ba_5), 0, 16826 }, /* CHK */
-{ CPUFUNC(op_41bb_5), 0, 16827 }, /* CHK */
-{ CPUFUNC(op_41bc_5), 0, 16828 }, /* CHK */
-{ CPUFUNC(op_41d0_5), 0, 16848 }, /* LEA */
-{ CPUFUNC(op_41e8_5), 0, 16872 }, /* LEA */
-{ CPUFUNC(op_41f0_5), 0, 16880 }, /* LEA */
-{ CPUFUNC(op_41f8_5), 0, 16888 }, /* LEA */
-{ CPUFUNC(op_41f9_5), 0, 16889 }, /* LEA */
-{ CPUFUNC(op_41fa_5), 0, 16890 }, /* LEA */
-{ CPUFUNC(op_41fb_5), 0, 16891 }, /* LEA */
-{ CPUFUNC(op_4200_5), 0, 16896 }, /* CLR */
-{ CPUFUNC(op_4210_5), 0, 16912 }, /* CLR */
-{ CPUFUNC(op_4218_5), 0, 16920 }, /* CLR */
-{ CPUFUNC(op_4220_5), 0, 16928 }, /* CLR */
-{ CPUFUNC(op_4228_5), 0, 16936 }, /* CLR */
-{ CPUFUNC(op_4230_5), 0, 16944 }, /* CLR */
-{ CPUFUNC(op_4238_5), 0, 16952 }, /* CLR */
-{ CPUFUNC(op_4239_5), 0, 16953 }, /* CLR */
-{ CPUFUNC(op_4240_5), 0, 16960 }, /* CLR */
-{ CPUFUNC(op_4250_5), 0, 16976 }, /* CLR */
-{ CPUFUNC(op_4258_5), 0, 16984 }, /* CLR */
-{ CPUFUNC(op_4260_5), 0, 16992 }, /* CLR */
-{ CPUFUNC(op_4268_5), 0, 17000 }, /* CLR */
-{ CPUFUNC(op_4270_5), 0, 17008 }, /* CLR */
-{ CPUFUNC(op_4278_5), 0, 17016 }, /* CLR */
-{ CPUFUNC(op_4279_5), 0, 17017 }, /* CLR */
-{ CPUFUNC(op_4280_5), 0, 17024 }, /* CLR */
-{ CPUFUNC(op_4290_5), 0, 17040 }, /* CLR */
-{ CPUFUNC(op_4298_5), 0, 17048 }, /* CLR */
-{ CPUFUNC(op_42a0_5), 0, 17056 }, /* CLR */
-{ CPUFUNC(op_42a8_5), 0, 17064 }, /* CLR */
-{ CPUFUNC(op_42b0_5), 0, 17072 }, /* CLR */
-{ CPUFUNC(op_42b8_5), 0, 17080 }, /* CLR */
-{ CPUFUNC(op_42b9_5), 0, 17081 }, /* CLR */
-{ CPUFUNC(op_4400_5), 0, 17408 }, /* NEG */
-{ CPUFUNC(op_4410_5), 0, 17424 }, /* NEG */
-{ CPUFUNC(op_4418_5), 0, 17432 }, /* NEG */
-{ CPUFUNC(op_4420_5), 0, 17440 }, /* NEG */
-{ CPUFUNC(op_4428_5), 0, 17448 }, /* NEG */
-{ CPUFUNC(op_4430_5), 0, 17456 }, /* NEG */
-{ CPUFUNC(op_4438_5), 0, 17464 }, /* NEG */
-{ CPUFUNC(op_4439_5), 0, 17465 }, /* NEG */
-{ CPUFUNC(op_4440_5), 0, 17472 }, /* NEG */
-{ CPUFUNC(op_4450_5), 0, 17488 }, /* NEG */
-{ CPUFUNC(op_4458_5), 0, 17496 }, /* NEG */
-{ CPUFUNC(op_4460_5), 0, 17504 }, /* NEG */
-{ CPUFUNC(op_4468_5), 0, 17512 }, /* NEG */
-{ CPUFUNC(op_4470_5), 0, 17520 }, /* NEG */
-{ CPUFUNC(op_4478_5), 0, 17528 }, /* NEG */
-{ CPUFUNC(op_4479_5), 0, 17529 }, /* NEG */
-{ CPUFUNC(op_4480_5), 0, 17536 }, /* NEG */
-{ CPUFUNC(op_4490_5), 0, 17552 }, /* NEG */
-{ CPUFUNC(op_4498_5), 0, 17560 }, /* NEG */
-{ CPUFUNC(op_44a0_5), 0, 17568 }, /* NEG */
-{ CPUFUNC(op_44a8_5), 0, 17576 }, /* NEG */
-{ CPUFUNC(op_44b0_5), 0, 17584 }, /* NEG */
-{ CPUFUNC(op_44b8_5), 0, 17592 }, /* NEG */
-{ CPUFUNC(op_44b9_5), 0, 17593 }, /* NEG */
-{ CPUFUNC(op_44c0_5), 0, 17600 }, /* MV2SR */
-{ CPUFUNC(op_44d0_5), 0, 17616 }, /* MV2SR */
-{ CPUFUNC(op_44d8_5), 0, 17624 }, /* MV2SR */
-{ CPUFUNC(op_44e0_5), 0, 17632 }, /* MV2SR */
-{ CPUFUNC(op_44e8_5), 0, 17640 }, /* MV2SR */
-{ CPUFUNC(op_44f0_5), 0, 17648 }, /* MV2SR */
-{ CPUFUNC(op_44f8_5), 0, 17656 }, /* MV2SR */
-{ CPUFUNC(op_44f9_5), 0, 17657 }, /* MV2SR */
-{ CPUFUNC(op_44fa_5), 0, 17658 }, /* MV2SR */
-{ CPUFUNC(op_44fb_5), 0, 17659 }, /* MV2SR */
-{ CPUFUNC(op_44fc_5), 0, 17660 }, /* MV2SR */
-{ CPUFUNC(op_4600_5), 0, 17920 }, /* NOT */
-{ CPUFUNC(op_4610_5), 0, 17936 }, /* NOT */
-{ CPUFUNC(op_4618_5), 0, 17944 }, /* NOT */
-{ CPUFUNC(op_4620_5), 0, 17952 }, /* NOT */
-{ CPUFUNC(op_4628_5), 0, 17960 }, /* NOT */
-{ CPUFUNC(op_4630_5), 0, 17968 }, /* NOT */
-{ CPUFUNC(op_4638_5), 0, 17976 }, /* NOT */
-{ CPUFUNC(op_4639_5), 0, 17977 }, /* NOT */
-{ CPUFUNC(op_4640_5), 0, 17984 }, /* NOT */
-{ CPUFUNC(op_4650_5), 0, 18000 }, /* NOT */
-{ CPUFUNC(op_4658_5), 0, 18008 }, /* NOT */
-{ CPUFUNC(op_4660_5), 0, 18016 }, /* NOT */
-{ CPUFUNC(op_4668_5), 0, 18024 }, /* NOT */
-{ CPUFUNC(op_4670_5), 0, 18032 }, /* NOT */
-{ CPUFUNC(op_4678_5), 0, 18040 }, /* NOT */
-{ CPUFUNC(op_4679_5), 0, 18041 }, /* NOT */
-{ CPUFUNC(op_4680_5), 0, 18048 }, /* NOT */
-{ CPUFUNC(op_4690_5), 0, 18064 }, /* NOT */
-{ CPUFUNC(op_4698_5), 0, 18072 }, /* NOT */
-{ CPUFUNC(op_46a0_5), 0, 18080 }, /* NOT */
-{ CPUFUNC(op_46a8_5), 0, 18088 }, /* NOT */
-{ CPUFUNC(op_46b0_5), 0, 18096 }, /* NOT */
-{ CPUFUNC(op_46b8_5), 0, 18104 }, /* NOT */
-{ CPUFUNC(op_46b9_5), 0, 18105 }, /* NOT */
-{ CPUFUNC(op_46c0_5), 0, 18112 }, /* MV2SR */
-{ CPUFUNC(op_46d0_5), 0, 18128 }, /* MV2SR */
-{ CPUFUNC(op_46d8_5), 0, 18136 }, /* MV2SR */
-{ CPUFUNC(op_46e0_5), 0, 18144 }, /* MV2SR */
-{ CPUFUNC(op_46e8_5), 0, 18152 }, /* MV2SR */
-{ CPUFUNC(op_46f0_5), 0, 18160 }, /* MV2SR */
-{ CPUFUNC(op_46f8_5), 0, 18168 }, /* MV2SR */
-{ CPUFUNC(op_46f9_5), 0, 18169 }, /* MV2SR */
-{ CPUFUNC(op_46fa_5), 0, 18170 }, /* MV2SR */
-{ CPUFUNC(op_46fb_5), 0, 18171 }, /* MV2SR */
-{ CPUFUNC(op_46fc_5), 0, 18172 }, /* MV2SR */
-{ CPUFUNC(op_4800_5), 0, 18432 }, /* NBCD */
-{ CPUFUNC(op_4810_5), 0, 18448 }, /* NBCD */
-{ CPUFUNC(op_4818_5), 0, 18456 }, /* NBCD */
-{ CPUFUNC(op_4820_5), 0, 18464 }, /* NBCD */
-{ CPUFUNC(op_4828_5), 0, 18472 }, /* NBCD */
-{ CPUFUNC(op_4830_5), 0, 18480 }, /* NBCD */
-{ CPUFUNC(op_4838_5), 0, 18488 }, /* NBCD */
-{ CPUFUNC(op_4839_5), 0, 18489 }, /* NBCD */
-{ CPUFUNC(op_4840_5), 0, 18496 }, /* SWAP */
-{ CPUFUNC(op_4850_5), 0, 18512 }, /* PEA */
-{ CPUFUNC(op_4868_5), 0, 18536 }, /* PEA */
-{ CPUFUNC(op_4870_5), 0, 18544 }, /* PEA */
-{ CPUFUNC(op_4878_5), 0, 18552 }, /* PEA */
-{ CPUFUNC(op_4879_5), 0, 18553 }, /* PEA */
-{ CPUFUNC(op_487a_5), 0, 18554 }, /* PEA */
-{ CPUFUNC(op_487b_5), 0, 18555 }, /* PEA */
-{ CPUFUNC(op_4880_5), 0, 18560 }, /* EXT */
-{ CPUFUNC(op_4890_5), 0, 18576 }, /* MVMLE */
-{ CPUFUNC(op_48a0_5), 0, 18592 }, /* MVMLE */
-{ CPUFUNC(op_48a8_5), 0, 18600 }, /* MVMLE */
-{ CPUFUNC(op_48b0_5), 0, 18608 }, /* MVMLE */
-{ CPUFUNC(op_48b8_5), 0, 18616 }, /* MVMLE */
-{ CPUFUNC(op_48b9_5), 0, 18617 }, /* MVMLE */
-{ CPUFUNC(op_48c0_5), 0, 18624 }, /* EXT */
-{ CPUFUNC(op_48d0_5), 0, 18640 }, /* MVMLE */
-{ CPUFUNC(op_48e0_5), 0, 18656 }, /* MVMLE */
-{ CPUFUNC(op_48e8_5), 0, 18664 }, /* MVMLE */
-{ CPUFUNC(op_48f0_5), 0, 18672 }, /* MVMLE */
-{ CPUFUNC(op_48f8_5), 0, 18680 }, /* MVMLE */
-{ CPUFUNC(op_48f9_5), 0, 18681 }, /* MVMLE */
-{ CPUFUNC(op_4a00_5), 0, 18944 }, /* TST */
-{ CPUFUNC(op_4a10_5), 0, 18960 }, /* TST */
-{ CPUFUNC(op_4a18_5), 0, 18968 }, /* TST */
-{ CPUFUNC(op_4a20_5), 0, 18976 }, /* TST */
-{ CPUFUNC(op_4a28_5), 0, 18984 }, /* TST */
-{ CPUFUNC(op_4a30_5), 0, 18992 }, /* TST */
-{ CPUFUNC(op_4a38_5), 0, 19000 }, /* TST */
-{ CPUFUNC(op_4a39_5), 0, 19001 }, /* TST */
-{ CPUFUNC(op_4a3a_5), 0, 19002 }, /* TST */
-{ CPUFUNC(op_4a3b_5), 0, 19003 }, /* TST */
-{ CPUFUNC(op_4a3c_5), 0, 19004 }, /* TST */
-{ CPUFUNC(op_4a40_5), 0, 19008 }, /* TST */
-{ CPUFUNC(op_4a48_5), 0, 19016 }, /* TST */
-{ CPUFUNC(op_4a50_5), 0, 19024 }, /* TST */
-{ CPUFUNC(op_4a58_5), 0, 19032 }, /* TST */
-{ CPUFUNC(op_4a60_5), 0, 19040 }, /* TST */
-{ CPUFUNC(op_4a68_5), 0, 19048 }, /* TST */
-{ CPUFUNC(op_4a70_5), 0, 19056 }, /* TST */
-{ CPUFUNC(op_4a78_5), 0, 19064 }, /* TST */
-{ CPUFUNC(op_4a79_5), 0, 19065 }, /* TST */
-{ CPUFUNC(op_4a7a_5), 0, 19066 }, /* TST */
-{ CPUFUNC(op_4a7b_5), 0, 19067 }, /* TST */
-{ CPUFUNC(op_4a7c_5), 0, 19068 }, /* TST */
-{ CPUFUNC(op_4a80_5), 0, 19072 }, /* TST */
-{ CPUFUNC(op_4a88_5), 0, 19080 }, /* TST */
-{ CPUFUNC(op_4a90_5), 0, 19088 }, /* TST */
-{ CPUFUNC(op_4a98_5), 0, 19096 }, /* TST */
-{ CPUFUNC(op_4aa0_5), 0, 19104 }, /* TST */
-{ CPUFUNC(op_4aa8_5), 0, 19112 }, /* TST */
-{ CPUFUNC(op_4ab0_5), 0, 19120 }, /* TST */
-{ CPUFUNC(op_4ab8_5), 0, 19128 }, /* TST */
-{ CPUFUNC(op_4ab9_5), 0, 19129 }, /* TST */
-{ CPUFUNC(op_4aba_5), 0, 19130 }, /* TST */
-{ CPUFUNC(op_4abb_5), 0, 19131 }, /* TST */
-{ CPUFUNC(op_4abc_5), 0, 19132 }, /* TST */
-{ CPUFUNC(op_4ac0_5), 0, 19136 }, /* TAS */
-{ CPUFUNC(op_4ad0_5), 0, 19152 }, /* TAS */
-{ CPUFUNC(op_4ad8_5), 0, 19160 }, /* TAS */
-{ CPUFUNC(op_4ae0_5), 0, 19168 }, /* TAS */
-{ CPUFUNC(op_4ae8_5), 0, 19176 }, /* TAS */
-{ CPUFUNC(op_4af0_5), 0, 19184 }, /* TAS */
-{ CPUFUNC(op_4af8_5), 0, 19192 }, /* TAS */
-{ CPUFUNC(op_4af9_5), 0, 19193 }, /* TAS */
-{ CPUFUNC(op_4c90_5), 0, 19600 }, /* MVMEL */
-{ CPUFUNC(op_4c98_5), 0, 19608 }, /* MVMEL */
-{ CPUFUNC(op_4ca8_5), 0, 19624 }, /* MVMEL */
-{ CPUFUNC(op_4cb0_5), 0, 19632 }, /* MVMEL */
-{ CPUFUNC(op_4cb8_5), 0, 19640 }, /* MVMEL */
-{ CPUFUNC(op_4cb9_5), 0, 19641 }, /* MVMEL */
-{ CPUFUNC(op_4cba_5), 0, 19642 }, /* MVMEL */
-{ CPUFUNC(op_4cbb_5), 0, 19643 }, /* MVMEL */
-{ CPUFUNC(op_4cd0_5), 0, 19664 }, /* MVMEL */
-{ CPUFUNC(op_4cd8_5), 0, 19672 }, /* MVMEL */
-{ CPUFUNC(op_4ce8_5), 0, 19688 }, /* MVMEL */
-{ CPUFUNC(op_4cf0_5), 0, 19696 }, /* MVMEL */
-{ CPUFUNC(op_4cf8_5), 0, 19704 }, /* MVMEL */
-{ CPUFUNC(op_4cf9_5), 0, 19705 }, /* MVMEL */
-{ CPUFUNC(op_4cfa_5), 0, 19706 }, /* MVMEL */
-{ CPUFUNC(op_4cfb_5), 0, 19707 }, /* MVMEL */
-{ CPUFUNC(op_4e40_5), 0, 20032 }, /* TRAP */
-{ CPUFUNC(op_4e50_5), 0, 20048 }, /* LINK */
-{ CPUFUNC(op_4e58_5), 0, 20056 }, /* UNLK */
-{ CPUFUNC(op_4e60_5), 0, 20064 }, /* MVR2USP */
-{ CPUFUNC(op_4e68_5), 0, 20072 }, /* MVUSP2R */
-{ CPUFUNC(op_4e70_5), 0, 20080 }, /* RESET */
-{ CPUFUNC(op_4e71_5), 0, 20081 }, /* NOP */
-{ CPUFUNC(op_4e72_5), 0, 20082 }, /* STOP */
-{ CPUFUNC(op_4e73_5), 0, 20083 }, /* RTE */
-{ CPUFUNC(op_4e74_5), 0, 20084 }, /* RTD */
-{ CPUFUNC(op_4e75_5), 0, 20085 }, /* RTS */
-{ CPUFUNC(op_4e76_5), 0, 20086 }, /* TRAPV */
-{ CPUFUNC(op_4e77_5), 0, 20087 }, /* RTR */
-{ CPUFUNC(op_4e90_5), 0, 20112 }, /* JSR */
-{ CPUFUNC(op_4ea8_5), 0, 20136 }, /* JSR */
-{ CPUFUNC(op_4eb0_5), 0, 20144 }, /* JSR */
-{ CPUFUNC(op_4eb8_5), 0, 20152 }, /* JSR */
-{ CPUFUNC(op_4eb9_5), 0, 20153 }, /* JSR */
-{ CPUFUNC(op_4eba_5), 0, 20154 }, /* JSR */
-{ CPUFUNC(op_4ebb_5), 0, 20155 }, /* JSR */
-{ CPUFUNC(op_4ed0_5), 0, 20176 }, /* JMP */
-{ CPUFUNC(op_4ee8_5), 0, 20200 }, /* JMP */
-{ CPUFUNC(op_4ef0_5), 0, 20208 }, /* JMP */
-{ CPUFUNC(op_4ef8_5), 0, 20216 }, /* JMP */
-{ CPUFUNC(op_4ef9_5), 0, 20217 }, /* JMP */
-{ CPUFUNC(op_4efa_5), 0, 20218 }, /* JMP */
-{ CPUFUNC(op_4efb_5), 0, 20219 }, /* JMP */
-{ CPUFUNC(op_5000_5), 0, 20480 }, /* ADD */
-{ CPUFUNC(op_5010_5), 0, 20496 }, /* ADD */
-{ CPUFUNC(op_5018_5), 0, 20504 }, /* ADD */
-{ CPUFUNC(op_5020_5), 0, 20512 }, /* ADD */
-{ CPUFUNC(op_5028_5), 0, 20520 }, /* ADD */
-{ CPUFUNC(op_5030_5), 0, 20528 }, /* ADD */
-{ CPUFUNC(op_5038_5), 0, 20536 }, /* ADD */
-{ CPUFUNC(op_5039_5), 0, 20537 }, /* ADD */
-{ CPUFUNC(op_5040_5), 0, 20544 }, /* ADD */
-{ CPUFUNC(op_5048_5), 0, 20552 }, /* ADDA */
-{ CPUFUNC(op_5050_5), 0, 20560 }, /* ADD */
-{ CPUFUNC(op_5058_5), 0, 20568 }, /* ADD */
-{ CPUFUNC(op_5060_5), 0, 20576 }, /* ADD */
-{ CPUFUNC(op_5068_5), 0, 20584 }, /* ADD */
-{ CPUFUNC(op_5070_5), 0, 20592 }, /* ADD */
-{ CPUFUNC(op_5078_5), 0, 20600 }, /* ADD */
-{ CPUFUNC(op_5079_5), 0, 20601 }, /* ADD */
-{ CPUFUNC(op_5080_5), 0, 20608 }, /* ADD */
-{ CPUFUNC(op_5088_5), 0, 20616 }, /* ADDA */
-{ CPUFUNC(op_5090_5), 0, 20624 }, /* ADD */
-{ CPUFUNC(op_5098_5), 0, 20632 }, /* ADD */
-{ CPUFUNC(op_50a0_5), 0, 20640 }, /* ADD */
-{ CPUFUNC(op_50a8_5), 0, 20648 }, /* ADD */
-{ CPUFUNC(op_50b0_5), 0, 20656 }, /* ADD */
-{ CPUFUNC(op_50b8_5), 0, 20664 }, /* ADD */
-{ CPUFUNC(op_50b9_5), 0, 20665 }, /* ADD */
-{ CPUFUNC(op_50c0_5), 0, 20672 }, /* Scc */
-{ CPUFUNC(op_50c8_5), 0, 20680 }, /* DBcc */
-{ CPUFUNC(op_50d0_5), 0, 20688 }, /* Scc */
-{ CPUFUNC(op_50d8_5), 0, 20696 }, /* Scc */
-{ CPUFUNC(op_50e0_5), 0, 20704 }, /* Scc */
-{ CPUFUNC(op_50e8_5), 0, 20712 }, /* Scc */
-{ CPUFUNC(op_50f0_5), 0, 20720 }, /* Scc */
-{ CPUFUNC(op_50f8_5), 0, 20728 }, /* Scc */
-{ CPUFUNC(op_50f9_5), 0, 20729 }, /* Scc */
-{ CPUFUNC(op_5100_5), 0, 20736 }, /* SUB */
-{ CPUFUNC(op_5110_5), 0, 20752 }, /* SUB */
-{ CPUFUNC(op_5118_5), 0, 20760 }, /* SUB */
-{ CPUFUNC(op_5120_5), 0, 20768 }, /* SUB */
-{ CPUFUNC(op_5128_5), 0, 20776 }, /* SUB */
-{ CPUFUNC(op_5130_5), 0, 20784 }, /* SUB */
-{ CPUFUNC(op_5138_5), 0, 20792 }, /* SUB */
-{ CPUFUNC(op_5139_5), 0, 20793 }, /* SUB */
-{ CPUFUNC(op_5140_5), 0, 20800 }, /* SUB */
-{ CPUFUNC(op_5148_5), 0, 20808 }, /* SUBA */
-{ CPUFUNC(op_5150_5), 0, 20816 }, /* SUB */
-{ CPUFUNC(op_5158_5), 0, 20824 }, /* SUB */
-{ CPUFUNC(op_5160_5), 0, 20832 }, /* SUB */
-{ CPUFUNC(op_5168_5), 0, 20840 }, /* SUB */
-{ CPUFUNC(op_5170_5), 0, 20848 }, /* SUB */
-{ CPUFUNC(op_5178_5), 0, 20856 }, /* SUB */
-{ CPUFUNC(op_5179_5), 0, 20857 }, /* SUB */
-{ CPUFUNC(op_5180_5), 0, 20864 }, /* SUB */
-{ CPUFUNC(op_5188_5), 0, 20872 }, /* SUBA */
-{ CPUFUNC(op_5190_5), 0, 20880 }, /* SUB */
-{ CPUFUNC(op_5198_5), 0, 20888 }, /* SUB */
-{ CPUFUNC(op_51a0_5), 0, 20896 }, /* SUB */
-{ CPUFUNC(op_51a8_5), 0, 20904 }, /* SUB */
-{ CPUFUNC(op_51b0_5), 0, 20912 }, /* SUB */
-{ CPUFUNC(op_51b8_5), 0, 20920 }, /* SUB */
-{ CPUFUNC(op_51b9_5), 0, 20921 }, /* SUB */
-{ CPUFUNC(op_51c0_5), 0, 20928 }, /* Scc */
-{ CPUFUNC(op_51c8_5), 0, 20936 }, /* DBcc */
-{ CPUFUNC(op_51d0_5), 0, 20944 }, /* Scc */
-{ CPUFUNC(op_51d8_5), 0, 20952 }, /* Scc */
-{ CPUFUNC(op_51e0_5), 0, 20960 }, /* Scc */
-{ CPUFUNC(op_51e8_5), 0, 20968 }, /* Scc */
-{ CPUFUNC(op_51f0_5), 0, 20976 }, /* Scc */
-{ CPUFUNC(op_51f8_5), 0, 20984 }, /* Scc */
-{ CPUFUNC(op_51f9_5), 0, 20985 }, /* Scc */
-{ CPUFUNC(op_52c0_5), 0, 21184 }, /* Scc */
-{ CPUFUNC(op_52c8_5), 0, 21192 }, /* DBcc */
-{ CPUFUNC(op_52d0_5), 0, 21200 }, /* Scc */
-{ CPUFUNC(op_52d8_5), 0, 21208 }, /* Scc */
-{ CPUFUNC(op_52e0_5), 0, 21216 }, /* Scc */
-{ CPUFUNC(op_52e8_5), 0, 21224 }, /* Scc */
-{ CPUFUNC(op_52f0_5), 0, 21232 }, /* Scc */
-{ CPUFUNC(op_52f8_5), 0, 21240 }, /* Scc */
-{ CPUFUNC(op_52f9_5), 0, 21241 }, /* Scc */
-{ CPUFUNC(op_53c0_5), 0, 21440 }, /* Scc */
-{ CPUFUNC(op_53c8_5), 0, 21448 }, /* DBcc */
-{ CPUFUNC(op_53d0_5), 0, 21456 }, /* Scc */
-{ CPUFUNC(op_53d8_5), 0, 21464 }, /* Scc */
-{ CPUFUNC(op_53e0_5), 0, 21472 }, /* Scc */
-{ CPUFUNC(op_53e8_5), 0, 21480 }, /* Scc */
-{ CPUFUNC(op_53f0_5), 0, 21488 }, /* Scc */
-{ CPUFUNC(op_53f8_5), 0, 21496 }, /* Scc */
-{ CPUFUNC(op_53f9_5), 0, 21497 }, /* Scc */
-{ CPUFUNC(op_54c0_5), 0, 21696 }, /* Scc */
-{ CPUFUNC(op_54c8_5), 0, 21704 }, /* DBcc */
-{ CPUFUNC(op_54d0_5), 0, 21712 }, /* Scc */
-{ CPUFUNC(op_54d8_5), 0, 21720 }, /* Scc */
-{ CPUFUNC(op_54e0_5), 0, 21728 }, /* Scc */
-{ CPUFUNC(op_54e8_5), 0, 21736 }, /* Scc */
-{ CPUFUNC(op_54f0_5), 0, 21744 }, /* Scc */
-{ CPUFUNC(op_54f8_5), 0, 21752 }, /* Scc */
-{ CPUFUNC(op_54f9_5), 0, 21753 }, /* Scc */
-{ CPUFUNC(op_55c0_5), 0, 21952 }, /* Scc */
-{ CPUFUNC(op_55c8_5), 0, 21960 }, /* DBcc */
-{ CPUFUNC(op_55d0_5), 0, 21968 }, /* Scc */
-{ CPUFUNC(op_55d8_5), 0, 21976 }, /* Scc */
-{ CPUFUNC(op_55e0_5), 0, 21984 }, /* Scc */
-{ CPUFUNC(op_55e8_5), 0, 21992 }, /* Scc */
-{ CPUFUNC(op_55f0_5), 0, 22000 }, /* Scc */
-{ CPUFUNC(op_55f8_5), 0, 22008 }, /* Scc */
-{ CPUFUNC(op_55f9_5), 0, 22009 }, /* Scc */
-{ CPUFUNC(op_56c0_5), 0, 22208 }, /* Scc */
-{ CPUFUNC(op_56c8_5), 0, 22216 }, /* DBcc */
-{ CPUFUNC(op_56d0_5), 0, 22224 }, /* Scc */
-{ CPUFUNC(op_56d8_5), 0, 22232 }, /* Scc */
-{ CPUFUNC(op_56e0_5), 0, 22240 }, /* Scc */
-{ CPUFUNC(op_56e8_5), 0, 22248 }, /* Scc */
-{ CPUFUNC(op_56f0_5), 0, 22256 }, /* Scc */
-{ CPUFUNC(op_56f8_5), 0, 22264 }, /* Scc */
-{ CPUFUNC(op_56f9_5), 0, 22265 }, /* Scc */
-{ CPUFUNC(op_57c0_5), 0, 22464 }, /* Scc */
-{ CPUFUNC(op_57c8_5), 0, 22472 }, /* DBcc */
-{ CPUFUNC(op_57d0_5), 0, 22480 }, /* Scc */
-{ CPUFUNC(op_57d8_5), 0, 22488 }, /* Scc */
-{ CPUFUNC(op_57e0_5), 0, 22496 }, /* Scc */
-{ CPUFUNC(op_57e8_5), 0, 22504 }, /* Scc */
-{ CPUFUNC(op_57f0_5), 0, 22512 }, /* Scc */
-{ CPUFUNC(op_57f8_5), 0, 22520 }, /* Scc */
-{ CPUFUNC(op_57f9_5), 0, 22521 }, /* Scc */
-{ CPUFUNC(op_58c0_5), 0, 22720 }, /* Scc */
-{ CPUFUNC(op_58c8_5), 0, 22728 }, /* DBcc */
-{ CPUFUNC(op_58d0_5), 0, 22736 }, /* Scc */
-{ CPUFUNC(op_58d8_5), 0, 22744 }, /* Scc */
-{ CPUFUNC(op_58e0_5), 0, 22752 }, /* Scc */
-{ CPUFUNC(op_58e8_5), 0, 22760 }, /* Scc */
-{ CPUFUNC(op_58f0_5), 0, 22768 }, /* Scc */
-{ CPUFUNC(op_58f8_5), 0, 22776 }, /* Scc */
-{ CPUFUNC(op_58f9_5), 0, 22777 }, /* Scc */
-{ CPUFUNC(op_59c0_5), 0, 22976 }, /* Scc */
-{ CPUFUNC(op_59c8_5), 0, 22984 }, /* DBcc */
-{ CPUFUNC(op_59d0_5), 0, 22992 }, /* Scc */
-{ CPUFUNC(op_59d8_5), 0, 23000 }, /* Scc */
-{ CPUFUNC(op_59e0_5), 0, 23008 }, /* Scc */
-{ CPUFUNC(op_59e8_5), 0, 23016 }, /* Scc */
-{ CPUFUNC(op_59f0_5), 0, 23024 }, /* Scc */
-{ CPUFUNC(op_59f8_5), 0, 23032 }, /* Scc */
-{ CPUFUNC(op_59f9_5), 0, 23033 }, /* Scc */
-{ CPUFUNC(op_5ac0_5), 0, 23232 }, /* Scc */
-{ CPUFUNC(op_5ac8_5), 0, 23240 }, /* DBcc */
-{ CPUFUNC(op_5ad0_5), 0, 23248 }, /* Scc */
-{ CPUFUNC(op_5ad8_5), 0, 23256 }, /* Scc */
-{ CPUFUNC(op_5ae0_5), 0, 23264 }, /* Scc */
-{ CPUFUNC(op_5ae8_5), 0, 23272 }, /* Scc */
-{ CPUFUNC(op_5af0_5), 0, 23280 }, /* Scc */
-{ CPUFUNC(op_5af8_5), 0, 23288 }, /* Scc */
-{ CPUFUNC(op_5af9_5), 0, 23289 }, /* Scc */
-{ CPUFUNC(op_5bc0_5), 0, 23488 }, /* Scc */
-{ CPUFUNC(op_5bc8_5), 0, 23496 }, /* DBcc */
-{ CPUFUNC(op_5bd0_5), 0, 23504 }, /* Scc */
-{ CPUFUNC(op_5bd8_5), 0, 23512 }, /* Scc */
-{ CPUFUNC(op_5be0_5), 0, 23520 }, /* Scc */
-{ CPUFUNC(op_5be8_5), 0, 23528 }, /* Scc */
-{ CPUFUNC(op_5bf0_5), 0, 23536 }, /* Scc */
-{ CPUFUNC(op_5bf8_5), 0, 23544 }, /* Scc */
-{ CPUFUNC(op_5bf9_5), 0, 23545 }, /* Scc */
-{ CPUFUNC(op_5cc0_5), 0, 23744 }, /* Scc */
-{ CPUFUNC(op_5cc8_5), 0, 23752 }, /* DBcc */
-{ CPUFUNC(op_5cd0_5), 0, 23760 }, /* Scc */
-{ CPUFUNC(op_5cd8_5), 0, 23768 }, /* Scc */
-{ CPUFUNC(op_5ce0_5), 0, 23776 }, /* Scc */
-{ CPUFUNC(op_5ce8_5), 0, 23784 }, /* Scc */
-{ CPUFUNC(op_5cf0_5), 0, 23792 }, /* Scc */
-{ CPUFUNC(op_5cf8_5), 0, 23800 }, /* Scc */
-{ CPUFUNC(op_5cf9_5), 0, 23801 }, /* Scc */
-{ CPUFUNC(op_5dc0_5), 0, 24000 }, /* Scc */
-{ CPUFUNC(op_5dc8_5), 0, 24008 }, /* DBcc */
-{ CPUFUNC(op_5dd0_5), 0, 24016 }, /* Scc */
-{ CPUFUNC(op_5dd8_5), 0, 24024 }, /* Scc */
-{ CPUFUNC(op_5de0_5), 0, 24032 }, /* Scc */
-{ CPUFUNC(op_5de8_5), 0, 24040 }, /* Scc */
-{ CPUFUNC(op_5df0_5), 0, 24048 }, /* Scc */
-{ CPUFUNC(op_5df8_5), 0, 24056 }, /* Scc */
-{ CPUFUNC(op_5df9_5), 0, 24057 }, /* Scc */
-{ CPUFUNC(op_5ec0_5), 0, 24256 }, /* Scc */
-{ CPUFUNC(op_5ec8_5), 0, 24264 }, /* DBcc */
-{ CPUFUNC(op_5ed0_5), 0, 24272 }, /* Scc */
-{ CPUFUNC(op_5ed8_5), 0, 24280 }, /* Scc */
-{ CPUFUNC(op_5ee0_5), 0, 24288 }, /* Scc */
-{ CPUFUNC(op_5ee8_5), 0, 24296 }, /* Scc */
-{ CPUFUNC(op_5ef0_5), 0, 24304 }, /* Scc */
-{ CPUFUNC(op_5ef8_5), 0, 24312 }, /* Scc */
-{ CPUFUNC(op_5ef9_5), 0, 24313 }, /* Scc */
-{ CPUFUNC(op_5fc0_5), 0, 24512 }, /* Scc */
-{ CPUFUNC(op_5fc8_5), 0, 24520 }, /* DBcc */
-{ CPUFUNC(op_5fd0_5), 0, 24528 }, /* Scc */
-{ CPUFUNC(op_5fd8_5), 0, 24536 }, /* Scc */
-{ CPUFUNC(op_5fe0_5), 0, 24544 }, /* Scc */
-{ CPUFUNC(op_5fe8_5), 0, 24552 }, /* Scc */
-{ CPUFUNC(op_5ff0_5), 0, 24560 }, /* Scc */
-{ CPUFUNC(op_5ff8_5), 0, 24568 }, /* Scc */
-{ CPUFUNC(op_5ff9_5), 0, 24569 }, /* Scc */
-{ CPUFUNC(op_6000_5), 0, 24576 }, /* Bcc */
-{ CPUFUNC(op_6001_5), 0, 24577 }, /* Bcc */
-{ CPUFUNC(op_60ff_5), 0, 24831 }, /* Bcc */
-{ CPUFUNC(op_6100_5), 0, 24832 }, /* BSR */
-{ CPUFUNC(op_6101_5), 0, 24833 }, /* BSR */
-{ CPUFUNC(op_61ff_5), 0, 25087 }, /* BSR */
-{ CPUFUNC(op_6200_5), 0, 25088 }, /* Bcc */
-{ CPUFUNC(op_6201_5), 0, 25089 }, /* Bcc */
-{ CPUFUNC(op_62ff_5), 0, 25343 }, /* Bcc */
-{ CPUFUNC(op_6300_5), 0, 25344 }, /* Bcc */
-{ CPUFUNC(op_6301_5), 0, 25345 }, /* Bcc */
-{ CPUFUNC(op_63ff_5), 0, 25599 }, /* Bcc */
-{ CPUFUNC(op_6400_5), 0, 25600 }, /* Bcc */
-{ CPUFUNC(op_6401_5), 0, 25601 }, /* Bcc */
-{ CPUFUNC(op_64ff_5), 0, 25855 }, /* Bcc */
-{ CPUFUNC(op_6500_5), 0, 25856 }, /* Bcc */
-{ CPUFUNC(op_6501_5), 0, 25857 }, /* Bcc */
-{ CPUFUNC(op_65ff_5), 0, 26111 }, /* Bcc */
-{ CPUFUNC(op_6600_5), 0, 26112 }, /* Bcc */
-{ CPUFUNC(op_6601_5), 0, 26113 }, /* Bcc */
-{ CPUFUNC(op_66ff_5), 0, 26367 }, /* Bcc */
-{ CPUFUNC(op_6700_5), 0, 26368 }, /* Bcc */
-{ CPUFUNC(op_6701_5), 0, 26369 }, /* Bcc */
-{ CPUFUNC(op_67ff_5), 0, 26623 }, /* Bcc */
-{ CPUFUNC(op_6800_5), 0, 26624 }, /* Bcc */
-{ CPUFUNC(op_6801_5), 0, 26625 }, /* Bcc */
-{ CPUFUNC(op_68ff_5), 0, 26879 }, /* Bcc */
-{ CPUFUNC(op_6900_5), 0, 26880 }, /* Bcc */
-{ CPUFUNC(op_6901_5), 0, 26881 }, /* Bcc */
-{ CPUFUNC(op_69ff_5), 0, 27135 }, /* Bcc */
-{ CPUFUNC(op_6a00_5), 0, 27136 }, /* Bcc */
-{ CPUFUNC(op_6a01_5), 0, 27137 }, /* Bcc */
-{ CPUFUNC(op_6aff_5), 0, 27391 }, /* Bcc */
-{ CPUFUNC(op_6b00_5), 0, 27392 }, /* Bcc */
-{ CPUFUNC(op_6b01_5), 0, 27393 }, /* Bcc */
-{ CPUFUNC(op_6bff_5), 0, 27647 }, /* Bcc */
-{ CPUFUNC(op_6c00_5), 0, 27648 }, /* Bcc */
-{ CPUFUNC(op_6c01_5), 0, 27649 }, /* Bcc */
-{ CPUFUNC(op_6cff_5), 0, 27903 }, /* Bcc */
-{ CPUFUNC(op_6d00_5), 0, 27904 }, /* Bcc */
-{ CPUFUNC(op_6d01_5), 0, 27905 }, /* Bcc */
-{ CPUFUNC(op_6dff_5), 0, 28159 }, /* Bcc */
-{ CPUFUNC(op_6e00_5), 0, 28160 }, /* Bcc */
-{ CPUFUNC(op_6e01_5), 0, 28161 }, /* Bcc */
-{ CPUFUNC(op_6eff_5), 0, 28415 }, /* Bcc */
-{ CPUFUNC(op_6f00_5), 0, 28416 }, /* Bcc */
-{ CPUFUNC(op_6f01_5), 0, 28417 }, /* Bcc */
-{ CPUFUNC(op_6fff_5), 0, 28671 }, /* Bcc */
-{ CPUFUNC(op_7000_5), 0, 28672 }, /* MOVE */
-{ CPUFUNC(op_8000_5), 0, 32768 }, /* OR */
-{ CPUFUNC(op_8010_5), 0, 32784 }, /* OR */
-{ CPUFUNC(op_8018_5), 0, 32792 }, /* OR */
-{ CPUFUNC(op_8020_5), 0, 32800 }, /* OR */
-{ CPUFUNC(op_8028_5), 0, 32808 }, /* OR */
-{ CPUFUNC(op_8030_5), 0, 32816 }, /* OR */
-{ CPUFUNC(op_8038_5), 0, 32824 }, /* OR */
-{ CPUFUNC(op_8039_5), 0, 32825 }, /* OR */
-{ CPUFUNC(op_803a_5), 0, 32826 }, /* OR */
-{ CPUFUNC(op_803b_5), 0, 32827 }, /* OR */
-{ CPUFUNC(op_803c_5), 0, 32828 }, /* OR */
-{ CPUFUNC(op_8040_5), 0, 32832 }, /* OR */
-{ CPUFUNC(op_8050_5), 0, 32848 }, /* OR */
-{ CPUFUNC(op_8058_5), 0, 32856 }, /* OR */
-{ CPUFUNC(op_8060_5), 0, 32864 }, /* OR */
-{ CPUFUNC(op_8068_5), 0, 32872 }, /* OR */
-{ CPUFUNC(op_8070_5), 0, 32880 }, /* OR */
-{ CPUFUNC(op_8078_5), 0, 32888 }, /* OR */
-{ CPUFUNC(op_8079_5), 0, 32889 }, /* OR */
-{ CPUFUNC(op_807a_5), 0, 32890 }, /* OR */
-{ CPUFUNC(op_807b_5), 0, 32891 }, /* OR */
-{ CPUFUNC(op_807c_5), 0, 32892 }, /* OR */
-{ CPUFUNC(op_8080_5), 0, 32896 }, /* OR */
-{ CPUFUNC(op_8090_5), 0, 32912 }, /* OR */
-{ CPUFUNC(op_8098_5), 0, 32920 }, /* OR */
-{ CPUFUNC(op_80a0_5), 0, 32928 }, /* OR */
-{ CPUFUNC(op_80a8_5), 0, 32936 }, /* OR */
-{ CPUFUNC(op_80b0_5), 0, 32944 }, /* OR */
-{ CPUFUNC(op_80b8_5), 0, 32952 }, /* OR */
-{ CPUFUNC(op_80b9_5), 0, 32953 }, /* OR */
-{ CPUFUNC(op_80ba_5), 0, 32954 }, /* OR */
-{ CPUFUNC(op_80bb_5), 0, 32955 }, /* OR */
-{ CPUFUNC(op_80bc_5), 0, 32956 }, /* OR */
-{ CPUFUNC(op_80c0_5), 0, 32960 }, /* DIVU */
-{ CPUFUNC(op_80d0_5), 0, 32976 }, /* DIVU */
-{ CPUFUNC(op_80d8_5), 0, 32984 }, /* DIVU */
-{ CPUFUNC(op_80e0_5), 0, 32992 }, /* DIVU */
-{ CPUFUNC(op_80e8_5), 0, 33000 }, /* DIVU */
-{ CPUFUNC(op_80f0_5), 0, 33008 }, /* DIVU */
-{ CPUFUNC(op_80f8_5), 0, 33016 }, /* DIVU */
-{ CPUFUNC(op_80f9_5), 0, 33017 }, /* DIVU */
-{ CPUFUNC(op_80fa_5), 0, 33018 }, /* DIVU */
-{ CPUFUNC(op_80fb_5), 0, 33019 }, /* DIVU */
-{ CPUFUNC(op_80fc_5), 0, 33020 }, /* DIVU */
-{ CPUFUNC(op_8100_5), 0, 33024 }, /* SBCD */
-{ CPUFUNC(op_8108_5), 0, 33032 }, /* SBCD */
-{ CPUFUNC(op_8110_5), 0, 33040 }, /* OR */
-{ CPUFUNC(op_8118_5), 0, 33048 }, /* OR */
-{ CPUFUNC(op_8120_5), 0, 33056 }, /* OR */
-{ CPUFUNC(op_8128_5), 0, 33064 }, /* OR */
-{ CPUFUNC(op_8130_5), 0, 33072 }, /* OR */
-{ CPUFUNC(op_8138_5), 0, 33080 }, /* OR */
-{ CPUFUNC(op_8139_5), 0, 33081 }, /* OR */
-{ CPUFUNC(op_8150_5), 0, 33104 }, /* OR */
-{ CPUFUNC(op_8158_5), 0, 33112 }, /* OR */
-{ CPUFUNC(op_8160_5), 0, 33120 }, /* OR */
-{ CPUFUNC(op_8168_5), 0, 33128 }, /* OR */
-{ CPUFUNC(op_8170_5), 0, 33136 }, /* OR */
-{ CPUFUNC(op_8178_5), 0, 33144 }, /* OR */
-{ CPUFUNC(op_8179_5), 0, 33145 }, /* OR */
-{ CPUFUNC(op_8190_5), 0, 33168 }, /* OR */
-{ CPUFUNC(op_8198_5), 0, 33176 }, /* OR */
-{ CPUFUNC(op_81a0_5), 0, 33184 }, /* OR */
-{ CPUFUNC(op_81a8_5), 0, 33192 }, /* OR */
-{ CPUFUNC(op_81b0_5), 0, 33200 }, /* OR */
-{ CPUFUNC(op_81b8_5), 0, 33208 }, /* OR */
-{ CPUFUNC(op_81b9_5), 0, 33209 }, /* OR */
-{ CPUFUNC(op_81c0_5), 0, 33216 }, /* DIVS */
-{ CPUFUNC(op_81d0_5), 0, 33232 }, /* DIVS */
-{ CPUFUNC(op_81d8_5), 0, 33240 }, /* DIVS */
-{ CPUFUNC(op_81e0_5), 0, 33248 }, /* DIVS */
-{ CPUFUNC(op_81e8_5), 0, 33256 }, /* DIVS */
-{ CPUFUNC(op_81f0_5), 0, 33264 }, /* DIVS */
-{ CPUFUNC(op_81f8_5), 0, 33272 }, /* DIVS */
-{ CPUFUNC(op_81f9_5), 0, 33273 }, /* DIVS */
-{ CPUFUNC(op_81fa_5), 0, 33274 }, /* DIVS */
-{ CPUFUNC(op_81fb_5), 0, 33275 }, /* DIVS */
-{ CPUFUNC(op_81fc_5), 0, 33276 }, /* DIVS */
-{ CPUFUNC(op_9000_5), 0, 36864 }, /* SUB */
-{ CPUFUNC(op_9010_5), 0, 36880 }, /* SUB */
-{ CPUFUNC(op_9018_5), 0, 36888 }, /* SUB */
-{ CPUFUNC(op_9020_5), 0, 36896 }, /* SUB */
-{ CPUFUNC(op_9028_5), 0, 36904 }, /* SUB */
-{ CPUFUNC(op_9030_5), 0, 36912 }, /* SUB */
-{ CPUFUNC(op_9038_5), 0, 36920 }, /* SUB */
-{ CPUFUNC(op_9039_5), 0, 36921 }, /* SUB */
-{ CPUFUNC(op_903a_5), 0, 36922 }, /* SUB */
-{ CPUFUNC(op_903b_5), 0, 36923 }, /* SUB */
-{ CPUFUNC(op_903c_5), 0, 36924 }, /* SUB */
-{ CPUFUNC(op_9040_5), 0, 36928 }, /* SUB */
-{ CPUFUNC(op_9048_5), 0, 36936 }, /* SUB */
-{ CPUFUNC(op_9050_5), 0, 36944 }, /* SUB */
-{ CPUFUNC(op_9058_5), 0, 36952 }, /* SUB */
-{ CPUFUNC(op_9060_5), 0, 36960 }, /* SUB */
-{ CPUFUNC(op_9068_5), 0, 36968 }, /* SUB */
-{ CPUFUNC(op_9070_5), 0, 36976 }, /* SUB */
-{ CPUFUNC(op_9078_5), 0, 36984 }, /* SUB */
-{ CPUFUNC(op_9079_5), 0, 36985 }, /* SUB */
-{ CPUFUNC(op_907a_5), 0, 36986 }, /* SUB */
-{ CPUFUNC(op_907b_5), 0, 36987 }, /* SUB */
-{ CPUFUNC(op_907c_5), 0, 36988 }, /* SUB */
-{ CPUFUNC(op_9080_5), 0, 36992 }, /* SUB */
-{ CPUFUNC(op_9088_5), 0, 37000 }, /* SUB */
-{ CPUFUNC(op_9090_5), 0, 37008 }, /* SUB */
-{ CPUFUNC(op_9098_5), 0, 37016 }, /* SUB */
-{ CPUFUNC(op_90a0_5), 0, 37024 }, /* SUB */
-{ CPUFUNC(op_90a8_5), 0, 37032 }, /* SUB */
-{ CPUFUNC(op_90b0_5), 0, 37040 }, /* SUB */
-{ CPUFUNC(op_90b8_5), 0, 37048 }, /* SUB */
-{ CPUFUNC(op_90b9_5), 0, 37049 }, /* SUB */
-{ CPUFUNC(op_90ba_5), 0, 37050 }, /* SUB */
-{ CPUFUNC(op_90bb_5), 0, 37051 }, /* SUB */
-{ CPUFUNC(op_90bc_5), 0, 37052 }, /* SUB */
-{ CPUFUNC(op_90c0_5), 0, 37056 }, /* SUBA */
-{ CPUFUNC(op_90c8_5), 0, 37064 }, /* SUBA */
-{ CPUFUNC(op_90d0_5), 0, 37072 }, /* SUBA */
-{ CPUFUNC(op_90d8_5), 0, 37080 }, /* SUBA */
-{ CPUFUNC(op_90e0_5), 0, 37088 }, /* SUBA */
-{ CPUFUNC(op_90e8_5), 0, 37096 }, /* SUBA */
-{ CPUFUNC(op_90f0_5), 0, 37104 }, /* SUBA */
-{ CPUFUNC(op_90f8_5), 0, 37112 }, /* SUBA */
-{ CPUFUNC(op_90f9_5), 0, 37113 }, /* SUBA */
-{ CPUFUNC(op_90fa_5), 0, 37114 }, /* SUBA */
-{ CPUFUNC(op_90fb_5), 0, 37115 }, /* SUBA */
-{ CPUFUNC(op_90fc_5), 0, 37116 }, /* SUBA */
-{ CPUFUNC(op_9100_5), 0, 37120 }, /* SUBX */
-{ CPUFUNC(op_9108_5), 0, 37128 }, /* SUBX */
-{ CPUFUNC(op_9110_5), 0, 37136 }, /* SUB */
-{ CPUFUNC(op_9118_5), 0, 37144 }, /* SUB */
-{ CPUFUNC(op_9120_5), 0, 37152 }, /* SUB */
-{ CPUFUNC(op_9128_5), 0, 37160 }, /* SUB */
-{ CPUFUNC(op_9130_5), 0, 37168 }, /* SUB */
-{ CPUFUNC(op_9138_5), 0, 37176 }, /* SUB */
-{ CPUFUNC(op_9139_5), 0, 37177 }, /* SUB */
-{ CPUFUNC(op_9140_5), 0, 37184 }, /* SUBX */
-{ CPUFUNC(op_9148_5), 0, 37192 }, /* SUBX */
-{ CPUFUNC(op_9150_5), 0, 37200 }, /* SUB */
-{ CPUFUNC(op_9158_5), 0, 37208 }, /* SUB */
-{ CPUFUNC(op_9160_5), 0, 37216 }, /* SUB */
-{ CPUFUNC(op_9168_5), 0, 37224 }, /* SUB */
-{ CPUFUNC(op_9170_5), 0, 37232 }, /* SUB */
-{ CPUFUNC(op_9178_5), 0, 37240 }, /* SUB */
-{ CPUFUNC(op_9179_5), 0, 37241 }, /* SUB */
-{ CPUFUNC(op_9180_5), 0, 37248 }, /* SUBX */
-{ CPUFUNC(op_9188_5), 0, 37256 }, /* SUBX */
-{ CPUFUNC(op_9190_5), 0, 37264 }, /* SUB */
-{ CPUFUNC(op_9198_5), 0, 37272 }, /* SUB */
-{ CPUFUNC(op_91a0_5), 0, 37280 }, /* SUB */
-{ CPUFUNC(op_91a8_5), 0, 37288 }, /* SUB */
-{ CPUFUNC(op_91b0_5), 0, 37296 }, /* SUB */
-{ CPUFUNC(op_91b8_5), 0, 37304 }, /* SUB */
-{ CPUFUNC(op_91b9_5), 0, 37305 }, /* SUB */
-{ CPUFUNC(op_91c0_5), 0, 37312 }, /* SUBA */
-{ CPUFUNC(op_91c8_5), 0, 37320 }, /* SUBA */
-{ CPUFUNC(op_91d0_5), 0, 37328 }, /* SUBA */
-{ CPUFUNC(op_91d8_5), 0, 37336 }, /* SUBA */
-{ CPUFUNC(op_91e0_5), 0, 37344 }, /* SUBA */
-{ CPUFUNC(op_91e8_5), 0, 37352 }, /* SUBA */
-{ CPUFUNC(op_91f0_5), 0, 37360 }, /* SUBA */
-{ CPUFUNC(op_91f8_5), 0, 37368 }, /* SUBA */
-{ CPUFUNC(op_91f9_5), 0, 37369 }, /* SUBA */
-{ CPUFUNC(op_91fa_5), 0, 37370 }, /* SUBA */
-{ CPUFUNC(op_91fb_5), 0, 37371 }, /* SUBA */
-{ CPUFUNC(op_91fc_5), 0, 37372 }, /* SUBA */
-{ CPUFUNC(op_b000_5), 0, 45056 }, /* CMP */
-{ CPUFUNC(op_b010_5), 0, 45072 }, /* CMP */
-{ CPUFUNC(op_b018_5), 0, 45080 }, /* CMP */
-{ CPUFUNC(op_b020_5), 0, 45088 }, /* CMP */
-{ CPUFUNC(op_b028_5), 0, 45096 }, /* CMP */
-{ CPUFUNC(op_b030_5), 0, 45104 }, /* CMP */
-{ CPUFUNC(op_b038_5), 0, 45112 }, /* CMP */
-{ CPUFUNC(op_b039_5), 0, 45113 }, /* CMP */
-{ CPUFUNC(op_b03a_5), 0, 45114 }, /* CMP */
-{ CPUFUNC(op_b03b_5), 0, 45115 }, /* CMP */
-{ CPUFUNC(op_b03c_5), 0, 45116 }, /* CMP */
-{ CPUFUNC(op_b040_5), 0, 45120 }, /* CMP */
-{ CPUFUNC(op_b048_5), 0, 45128 }, /* CMP */
-{ CPUFUNC(op_b050_5), 0, 45136 }, /* CMP */
-{ CPUFUNC(op_b058_5), 0, 45144 }, /* CMP */
-{ CPUFUNC(op_b060_5), 0, 45152 }, /* CMP */
-{ CPUFUNC(op_b068_5), 0, 45160 }, /* CMP */
-{ CPUFUNC(op_b070_5), 0, 45168 }, /* CMP */
-{ CPUFUNC(op_b078_5), 0, 45176 }, /* CMP */
-{ CPUFUNC(op_b079_5), 0, 45177 }, /* CMP */
-{ CPUFUNC(op_b07a_5), 0, 45178 }, /* CMP */
-{ CPUFUNC(op_b07b_5), 0, 45179 }, /* CMP */
-{ CPUFUNC(op_b07c_5), 0, 45180 }, /* CMP */
-{ CPUFUNC(op_b080_5), 0, 45184 }, /* CMP */
-{ CPUFUNC(op_b088_5), 0, 45192 }, /* CMP */
-{ CPUFUNC(op_b090_5), 0, 45200 }, /* CMP */
-{ CPUFUNC(op_b098_5), 0, 45208 }, /* CMP */
-{ CPUFUNC(op_b0a0_5), 0, 45216 }, /* CMP */
-{ CPUFUNC(op_b0a8_5), 0, 45224 }, /* CMP */
-{ CPUFUNC(op_b0b0_5), 0, 45232 }, /* CMP */
-{ CPUFUNC(op_b0b8_5), 0, 45240 }, /* CMP */
-{ CPUFUNC(op_b0b9_5), 0, 45241 }, /* CMP */
-{ CPUFUNC(op_b0ba_5), 0, 45242 }, /* CMP */
-{ CPUFUNC(op_b0bb_5), 0, 45243 }, /* CMP */
-{ CPUFUNC(op_b0bc_5), 0, 45244 }, /* CMP */
-{ CPUFUNC(op_b0c0_5), 0, 45248 }, /* CMPA */
-{ CPUFUNC(op_b0c8_5), 0, 45256 }, /* CMPA */
-{ CPUFUNC(op_b0d0_5), 0, 45264 }, /* CMPA */
-{ CPUFUNC(op_b0d8_5), 0, 45272 }, /* CMPA */
-{ CPUFUNC(op_b0e0_5), 0, 45280 }, /* CMPA */
-{ CPUFUNC(op_b0e8_5), 0, 45288 }, /* CMPA */
-{ CPUFUNC(op_b0f0_5), 0, 45296 }, /* CMPA */
-{ CPUFUNC(op_b0f8_5), 0, 45304 }, /* CMPA */
-{ CPUFUNC(op_b0f9_5), 0, 45305 }, /* CMPA */
-{ CPUFUNC(op_b0fa_5), 0, 45306 }, /* CMPA */
-{ CPUFUNC(op_b0fb_5), 0, 45307 }, /* CMPA */
-{ CPUFUNC(op_b0fc_5), 0, 45308 }, /* CMPA */
-{ CPUFUNC(op_b100_5), 0, 45312 }, /* EOR */
-{ CPUFUNC(op_b108_5), 0, 45320 }, /* CMPM */
-{ CPUFUNC(op_b110_5), 0, 45328 }, /* EOR */
-{ CPUFUNC(op_b118_5), 0, 45336 }, /* EOR */
-{ CPUFUNC(op_b120_5), 0, 45344 }, /* EOR */
-{ CPUFUNC(op_b128_5), 0, 45352 }, /* EOR */
-{ CPUFUNC(op_b130_5), 0, 45360 }, /* EOR */
-{ CPUFUNC(op_b138_5), 0, 45368 }, /* EOR */
-{ CPUFUNC(op_b139_5), 0, 45369 }, /* EOR */
-{ CPUFUNC(op_b140_5), 0, 45376 }, /* EOR */
-{ CPUFUNC(op_b148_5), 0, 45384 }, /* CMPM */
-{ CPUFUNC(op_b150_5), 0, 45392 }, /* EOR */
-{ CPUFUNC(op_b158_5), 0, 45400 }, /* EOR */
-{ CPUFUNC(op_b160_5), 0, 45408 }, /* EOR */
-{ CPUFUNC(op_b168_5), 0, 45416 }, /* EOR */
-{ CPUFUNC(op_b170_5), 0, 45424 }, /* EOR */
-{ CPUFUNC(op_b178_5), 0, 45432 }, /* EOR */
-{ CPUFUNC(op_b179_5), 0, 45433 }, /* EOR */
-{ CPUFUNC(op_b180_5), 0, 45440 }, /* EOR */
-{ CPUFUNC(op_b188_5), 0, 45448 }, /* CMPM */
-{ CPUFUNC(op_b190_5), 0, 45456 }, /* EOR */
-{ CPUFUNC(op_b198_5), 0, 45464 }, /* EOR */
-{ CPUFUNC(op_b1a0_5), 0, 45472 }, /* EOR */
-{ CPUFUNC(op_b1a8_5), 0, 45480 }, /* EOR */
-{ CPUFUNC(op_b1b0_5), 0, 45488 }, /* EOR */
-{ CPUFUNC(op_b1b8_5), 0, 45496 }, /* EOR */
-{ CPUFUNC(op_b1b9_5), 0, 45497 }, /* EOR */
-{ CPUFUNC(op_b1c0_5), 0, 45504 }, /* CMPA */
-{ CPUFUNC(op_b1c8_5), 0, 45512 }, /* CMPA */
-{ CPUFUNC(op_b1d0_5), 0, 45520 }, /* CMPA */
-{ CPUFUNC(op_b1d8_5), 0, 45528 }, /* CMPA */
-{ CPUFUNC(op_b1e0_5), 0, 45536 }, /* CMPA */
-{ CPUFUNC(op_b1e8_5), 0, 45544 }, /* CMPA */
-{ CPUFUNC(op_b1f0_5), 0, 45552 }, /* CMPA */
-{ CPUFUNC(op_b1f8_5), 0, 45560 }, /* CMPA */
-{ CPUFUNC(op_b1f9_5), 0, 45561 }, /* CMPA */
-{ CPUFUNC(op_b1fa_5), 0, 45562 }, /* CMPA */
-{ CPUFUNC(op_b1fb_5), 0, 45563 }, /* CMPA */
-{ CPUFUNC(op_b1fc_5), 0, 45564 }, /* CMPA */
-{ CPUFUNC(op_c000_5), 0, 49152 }, /* AND */
-{ CPUFUNC(op_c010_5), 0, 49168 }, /* AND */
-{ CPUFUNC(op_c018_5), 0, 49176 }, /* AND */
-{ CPUFUNC(op_c020_5), 0, 49184 }, /* AND */
-{ CPUFUNC(op_c028_5), 0, 49192 }, /* AND */
-{ CPUFUNC(op_c030_5), 0, 49200 }, /* AND */
-{ CPUFUNC(op_c038_5), 0, 49208 }, /* AND */
-{ CPUFUNC(op_c039_5), 0, 49209 }, /* AND */
-{ CPUFUNC(op_c03a_5), 0, 49210 }, /* AND */
-{ CPUFUNC(op_c03b_5), 0, 49211 }, /* AND */
-{ CPUFUNC(op_c03c_5), 0, 49212 }, /* AND */
-{ CPUFUNC(op_c040_5), 0, 49216 }, /* AND */
-{ CPUFUNC(op_c050_5), 0, 49232 }, /* AND */
-{ CPUFUNC(op_c058_5), 0, 49240 }, /* AND */
-{ CPUFUNC(op_c060_5), 0, 49248 }, /* AND */
-{ CPUFUNC(op_c068_5), 0, 49256 }, /* AND */
-{ CPUFUNC(op_c070_5), 0, 49264 }, /* AND */
-{ CPUFUNC(op_c078_5), 0, 49272 }, /* AND */
-{ CPUFUNC(op_c079_5), 0, 49273 }, /* AND */
-{ CPUFUNC(op_c07a_5), 0, 49274 }, /* AND */
-{ CPUFUNC(op_c07b_5), 0, 49275 }, /* AND */
-{ CPUFUNC(op_c07c_5), 0, 49276 }, /* AND */
-{ CPUFUNC(op_c080_5), 0, 49280 }, /* AND */
-{ CPUFUNC(op_c090_5), 0, 49296 }, /* AND */
-{ CPUFUNC(op_c098_5), 0, 49304 }, /* AND */
-{ CPUFUNC(op_c0a0_5), 0, 49312 }, /* AND */
-{ CPUFUNC(op_c0a8_5), 0, 49320 }, /* AND */
-{ CPUFUNC(op_c0b0_5), 0, 49328 }, /* AND */
-{ CPUFUNC(op_c0b8_5), 0, 49336 }, /* AND */
-{ CPUFUNC(op_c0b9_5), 0, 49337 }, /* AND */
-{ CPUFUNC(op_c0ba_5), 0, 49338 }, /* AND */
-{ CPUFUNC(op_c0bb_5), 0, 49339 }, /* AND */
-{ CPUFUNC(op_c0bc_5), 0, 49340 }, /* AND */
-{ CPUFUNC(op_c0c0_5), 0, 49344 }, /* MULU */
-{ CPUFUNC(op_c0d0_5), 0, 49360 }, /* MULU */
-{ CPUFUNC(op_c0d8_5), 0, 49368 }, /* MULU */
-{ CPUFUNC(op_c0e0_5), 0, 49376 }, /* MULU */
-{ CPUFUNC(op_c0e8_5), 0, 49384 }, /* MULU */
-{ CPUFUNC(op_c0f0_5), 0, 49392 }, /* MULU */
-{ CPUFUNC(op_c0f8_5), 0, 49400 }, /* MULU */
-{ CPUFUNC(op_c0f9_5), 0, 49401 }, /* MULU */
-{ CPUFUNC(op_c0fa_5), 0, 49402 }, /* MULU */
-{ CPUFUNC(op_c0fb_5), 0, 49403 }, /* MULU */
-{ CPUFUNC(op_c0fc_5), 0, 49404 }, /* MULU */
-{ CPUFUNC(op_c100_5), 0, 49408 }, /* ABCD */
-{ CPUFUNC(op_c108_5), 0, 49416 }, /* ABCD */
-{ CPUFUNC(op_c110_5), 0, 49424 }, /* AND */
-{ CPUFUNC(op_c118_5), 0, 49432 }, /* AND */
-{ CPUFUNC(op_c120_5), 0, 49440 }, /* AND */
-{ CPUFUNC(op_c128_5), 0, 49448 }, /* AND */
-{ CPUFUNC(op_c130_5), 0, 49456 }, /* AND */
-{ CPUFUNC(op_c138_5), 0, 49464 }, /* AND */
-{ CPUFUNC(op_c139_5), 0, 49465 }, /* AND */
-{ CPUFUNC(op_c140_5), 0, 49472 }, /* EXG */
-{ CPUFUNC(op_c148_5), 0, 49480 }, /* EXG */
-{ CPUFUNC(op_c150_5), 0, 49488 }, /* AND */
-{ CPUFUNC(op_c158_5), 0, 49496 }, /* AND */
-{ CPUFUNC(op_c160_5), 0, 49504 }, /* AND */
-{ CPUFUNC(op_c168_5), 0, 49512 }, /* AND */
-{ CPUFUNC(op_c170_5), 0, 49520 }, /* AND */
-{ CPUFUNC(op_c178_5), 0, 49528 }, /* AND */
-{ CPUFUNC(op_c179_5), 0, 49529 }, /* AND */
-{ CPUFUNC(op_c188_5), 0, 49544 }, /* EXG */
-{ CPUFUNC(op_c190_5), 0, 49552 }, /* AND */
-{ CPUFUNC(op_c198_5), 0, 49560 }, /* AND */
-{ CPUFUNC(op_c1a0_5), 0, 49568 }, /* AND */
-{ CPUFUNC(op_c1a8_5), 0, 49576 }, /* AND */
-{ CPUFUNC(op_c1b0_5), 0, 49584 }, /* AND */
-{ CPUFUNC(op_c1b8_5), 0, 49592 }, /* AND */
-{ CPUFUNC(op_c1b9_5), 0, 49593 }, /* AND */
-{ CPUFUNC(op_c1c0_5), 0, 49600 }, /* MULS */
-{ CPUFUNC(op_c1d0_5), 0, 49616 }, /* MULS */
-{ CPUFUNC(op_c1d8_5), 0, 49624 }, /* MULS */
-{ CPUFUNC(op_c1e0_5), 0, 49632 }, /* MULS */
-{ CPUFUNC(op_c1e8_5), 0, 49640 }, /* MULS */
-{ CPUFUNC(op_c1f0_5), 0, 49648 }, /* MULS */
-{ CPUFUNC(op_c1f8_5), 0, 49656 }, /* MULS */
-{ CPUFUNC(op_c1f9_5), 0, 49657 }, /* MULS */
-{ CPUFUNC(op_c1fa_5), 0, 49658 }, /* MULS */
-{ CPUFUNC(op_c1fb_5), 0, 49659 }, /* MULS */
-{ CPUFUNC(op_c1fc_5), 0, 49660 }, /* MULS */
-{ CPUFUNC(op_d000_5), 0, 53248 }, /* ADD */
-{ CPUFUNC(op_d010_5), 0, 53264 }, /* ADD */
-{ CPUFUNC(op_d018_5), 0, 53272 }, /* ADD */
-{ CPUFUNC(op_d020_5), 0, 53280 }, /* ADD */
-{ CPUFUNC(op_d028_5), 0, 53288 }, /* ADD */
-{ CPUFUNC(op_d030_5), 0, 53296 }, /* ADD */
-{ CPUFUNC(op_d038_5), 0, 53304 }, /* ADD */
-{ CPUFUNC(op_d039_5), 0, 53305 }, /* ADD */
-{ CPUFUNC(op_d03a_5), 0, 53306 }, /* ADD */
-{ CPUFUNC(op_d03b_5), 0, 53307 }, /* ADD */
-{ CPUFUNC(op_d03c_5), 0, 53308 }, /* ADD */
-{ CPUFUNC(op_d040_5), 0, 53312 }, /* ADD */
-{ CPUFUNC(op_d048_5), 0, 53320 }, /* ADD */
-{ CPUFUNC(op_d050_5), 0, 53328 }, /* ADD */
-{ CPUFUNC(op_d058_5), 0, 53336 }, /* ADD */
-{ CPUFUNC(op_d060_5), 0, 53344 }, /* ADD */
-{ CPUFUNC(op_d068_5), 0, 53352 }, /* ADD */
-{ CPUFUNC(op_d070_5), 0, 53360 }, /* ADD */
-{ CPUFUNC(op_d078_5), 0, 53368 }, /* ADD */
-{ CPUFUNC(op_d079_5), 0, 53369 }, /* ADD */
-{ CPUFUNC(op_d07a_5), 0, 53370 }, /* ADD */
-{ CPUFUNC(op_d07b_5), 0, 53371 }, /* ADD */
-{ CPUFUNC(op_d07c_5), 0, 53372 }, /* ADD */
-{ CPUFUNC(op_d080_5), 0, 53376 }, /* ADD */
-{ CPUFUNC(op_d088_5), 0, 53384 }, /* ADD */
-{ CPUFUNC(op_d090_5), 0, 53392 }, /* ADD */
-{ CPUFUNC(op_d098_5), 0, 53400 }, /* ADD */
-{ CPUFUNC(op_d0a0_5), 0, 53408 }, /* ADD */
-{ CPUFUNC(op_d0a8_5), 0, 53416 }, /* ADD */
-{ CPUFUNC(op_d0b0_5), 0, 53424 }, /* ADD */
-{ CPUFUNC(op_d0b8_5), 0, 53432 }, /* ADD */
-{ CPUFUNC(op_d0b9_5), 0, 53433 }, /* ADD */
-{ CPUFUNC(op_d0ba_5), 0, 53434 }, /* ADD */
-{ CPUFUNC(op_d0bb_5), 0, 53435 }, /* ADD */
-{ CPUFUNC(op_d0bc_5), 0, 53436 }, /* ADD */
-{ CPUFUNC(op_d0c0_5), 0, 53440 }, /* ADDA */
-{ CPUFUNC(op_d0c8_5), 0, 53448 }, /* ADDA */
-{ CPUFUNC(op_d0d0_5), 0, 53456 }, /* ADDA */
-{ CPUFUNC(op_d0d8_5), 0, 53464 }, /* ADDA */
-{ CPUFUNC(op_d0e0_5), 0, 53472 }, /* ADDA */
-{ CPUFUNC(op_d0e8_5), 0, 53480 }, /* ADDA */
-{ CPUFUNC(op_d0f0_5), 0, 53488 }, /* ADDA */
-{ CPUFUNC(op_d0f8_5), 0, 53496 }, /* ADDA */
-{ CPUFUNC(op_d0f9_5), 0, 53497 }, /* ADDA */
-{ CPUFUNC(op_d0fa_5), 0, 53498 }, /* ADDA */
-{ CPUFUNC(op_d0fb_5), 0, 53499 }, /* ADDA */
-{ CPUFUNC(op_d0fc_5), 0, 53500 }, /* ADDA */
-{ CPUFUNC(op_d100_5), 0, 53504 }, /* ADDX */
-{ CPUFUNC(op_d108_5), 0, 53512 }, /* ADDX */
-{ CPUFUNC(op_d110_5), 0, 53520 }, /* ADD */
-{ CPUFUNC(op_d118_5), 0, 53528 }, /* ADD */
-{ CPUFUNC(op_d120_5), 0, 53536 }, /* ADD */
-{ CPUFUNC(op_d128_5), 0, 53544 }, /* ADD */
-{ CPUFUNC(op_d130_5), 0, 53552 }, /* ADD */
-{ CPUFUNC(op_d138_5), 0, 53560 }, /* ADD */
-{ CPUFUNC(op_d139_5), 0, 53561 }, /* ADD */
-{ CPUFUNC(op_d140_5), 0, 53568 }, /* ADDX */
-{ CPUFUNC(op_d148_5), 0, 53576 }, /* ADDX */
-{ CPUFUNC(op_d150_5), 0, 53584 }, /* ADD */
-{ CPUFUNC(op_d158_5), 0, 53592 }, /* ADD */
-{ CPUFUNC(op_d160_5), 0, 53600 }, /* ADD */
-{ CPUFUNC(op_d168_5), 0, 53608 }, /* ADD */
-{ CPUFUNC(op_d170_5), 0, 53616 }, /* ADD */
-{ CPUFUNC(op_d178_5), 0, 53624 }, /* ADD */
-{ CPUFUNC(op_d179_5), 0, 53625 }, /* ADD */
-{ CPUFUNC(op_d180_5), 0, 53632 }, /* ADDX */
-{ CPUFUNC(op_d188_5), 0, 53640 }, /* ADDX */
-{ CPUFUNC(op_d190_5), 0, 53648 }, /* ADD */
-{ CPUFUNC(op_d198_5), 0, 53656 }, /* ADD */
-{ CPUFUNC(op_d1a0_5), 0, 53664 }, /* ADD */
-{ CPUFUNC(op_d1a8_5), 0, 53672 }, /* ADD */
-{ CPUFUNC(op_d1b0_5), 0, 53680 }, /* ADD */
-{ CPUFUNC(op_d1b8_5), 0, 53688 }, /* ADD */
-{ CPUFUNC(op_d1b9_5), 0, 53689 }, /* ADD */
-{ CPUFUNC(op_d1c0_5), 0, 53696 }, /* ADDA */
-{ CPUFUNC(op_d1c8_5), 0, 53704 }, /* ADDA */
-{ CPUFUNC(op_d1d0_5), 0, 53712 }, /* ADDA */
-{ CPUFUNC(op_d1d8_5), 0, 53720 }, /* ADDA */
-{ CPUFUNC(op_d1e0_5), 0, 53728 }, /* ADDA */
-{ CPUFUNC(op_d1e8_5), 0, 53736 }, /* ADDA */
-{ CPUFUNC(op_d1f0_5), 0, 53744 }, /* ADDA */
-{ CPUFUNC(op_d1f8_5), 0, 53752 }, /* ADDA */
-{ CPUFUNC(op_d1f9_5), 0, 53753 }, /* ADDA */
-{ CPUFUNC(op_d1fa_5), 0, 53754 }, /* ADDA */
-{ CPUFUNC(op_d1fb_5), 0, 53755 }, /* ADDA */
-{ CPUFUNC(op_d1fc_5), 0, 53756 }, /* ADDA */
-{ CPUFUNC(op_e000_5), 0, 57344 }, /* ASR */
-{ CPUFUNC(op_e008_5), 0, 57352 }, /* LSR */
-{ CPUFUNC(op_e010_5), 0, 57360 }, /* ROXR */
-{ CPUFUNC(op_e018_5), 0, 57368 }, /* ROR */
-{ CPUFUNC(op_e020_5), 0, 57376 }, /* ASR */
-{ CPUFUNC(op_e028_5), 0, 57384 }, /* LSR */
-{ CPUFUNC(op_e030_5), 0, 57392 }, /* ROXR */
-{ CPUFUNC(op_e038_5), 0, 57400 }, /* ROR */
-{ CPUFUNC(op_e040_5), 0, 57408 }, /* ASR */
-{ CPUFUNC(op_e048_5), 0, 57416 }, /* LSR */
-{ CPUFUNC(op_e050_5), 0, 57424 }, /* ROXR */
-{ CPUFUNC(op_e058_5), 0, 57432 }, /* ROR */
-{ CPUFUNC(op_e060_5), 0, 57440 }, /* ASR */
-{ CPUFUNC(op_e068_5), 0, 57448 }, /* LSR */
-{ CPUFUNC(op_e070_5), 0, 57456 }, /* ROXR */
-{ CPUFUNC(op_e078_5), 0, 57464 }, /* ROR */
-{ CPUFUNC(op_e080_5), 0, 57472 }, /* ASR */
-{ CPUFUNC(op_e088_5), 0, 57480 }, /* LSR */
-{ CPUFUNC(op_e090_5), 0, 57488 }, /* ROXR */
-{ CPUFUNC(op_e098_5), 0, 57496 }, /* ROR */
-{ CPUFUNC(op_e0a0_5), 0, 57504 }, /* ASR */
-{ CPUFUNC(op_e0a8_5), 0, 57512 }, /* LSR */
-{ CPUFUNC(op_e0b0_5), 0, 57520 }, /* ROXR */
-{ CPUFUNC(op_e0b8_5), 0, 57528 }, /* ROR */
-{ CPUFUNC(op_e0d0_5), 0, 57552 }, /* ASRW */
-{ CPUFUNC(op_e0d8_5), 0, 57560 }, /* ASRW */
-{ CPUFUNC(op_e0e0_5), 0, 57568 }, /* ASRW */
-{ CPUFUNC(op_e0e8_5), 0, 57576 }, /* ASRW */
-{ CPUFUNC(op_e0f0_5), 0, 57584 }, /* ASRW */
-{ CPUFUNC(op_e0f8_5), 0, 57592 }, /* ASRW */
-{ CPUFUNC(op_e0f9_5), 0, 57593 }, /* ASRW */
-{ CPUFUNC(op_e100_5), 0, 57600 }, /* ASL */
-{ CPUFUNC(op_e108_5), 0, 57608 }, /* LSL */
-{ CPUFUNC(op_e110_5), 0, 57616 }, /* ROXL */
-{ CPUFUNC(op_e118_5), 0, 57624 }, /* ROL */
-{ CPUFUNC(op_e120_5), 0, 57632 }, /* ASL */
-{ CPUFUNC(op_e128_5), 0, 57640 }, /* LSL */
-{ CPUFUNC(op_e130_5), 0, 57648 }, /* ROXL */
-{ CPUFUNC(op_e138_5), 0, 57656 }, /* ROL */
-{ CPUFUNC(op_e140_5), 0, 57664 }, /* ASL */
-{ CPUFUNC(op_e148_5), 0, 57672 }, /* LSL */
-{ CPUFUNC(op_e150_5), 0, 57680 }, /* ROXL */
-{ CPUFUNC(op_e158_5), 0, 57688 }, /* ROL */
-{ CPUFUNC(op_e160_5), 0, 57696 }, /* ASL */
-{ CPUFUNC(op_e168_5), 0, 57704 }, /* LSL */
-{ CPUFUNC(op_e170_5), 0, 57712 }, /* ROXL */
-{ CPUFUNC(op_e178_5), 0, 57720 }, /* ROL */
-{ CPUFUNC(op_e180_5), 0, 57728 }, /* ASL */
-{ CPUFUNC(op_e188_5), 0, 57736 }, /* LSL */
-{ CPUFUNC(op_e190_5), 0, 57744 }, /* ROXL */
-{ CPUFUNC(op_e198_5), 0, 57752 }, /* ROL */
-{ CPUFUNC(op_e1a0_5), 0, 57760 }, /* ASL */
-{ CPUFUNC(op_e1a8_5), 0, 57768 }, /* LSL */
-{ CPUFUNC(op_e1b0_5), 0, 57776 }, /* ROXL */
-{ CPUFUNC(op_e1b8_5), 0, 57784 }, /* ROL */
-{ CPUFUNC(op_e1d0_5), 0, 57808 }, /* ASLW */
-{ CPUFUNC(op_e1d8_5), 0, 57816 }, /* ASLW */
-{ CPUFUNC(op_e1e0_5), 0, 57824 }, /* ASLW */
-{ CPUFUNC(op_e1e8_5), 0, 57832 }, /* ASLW */
-{ CPUFUNC(op_e1f0_5), 0, 57840 }, /* ASLW */
-{ CPUFUNC(op_e1f8_5), 0, 57848 }, /* ASLW */
-{ CPUFUNC(op_e1f9_5), 0, 57849 }, /* ASLW */
-{ CPUFUNC(op_e2d0_5), 0, 58064 }, /* LSRW */
-{ CPUFUNC(op_e2d8_5), 0, 58072 }, /* LSRW */
-{ CPUFUNC(op_e2e0_5), 0, 58080 }, /* LSRW */
-{ CPUFUNC(op_e2e8_5), 0, 58088 }, /* LSRW */
-{ CPUFUNC(op_e2f0_5), 0, 58096 }, /* LSRW */
-{ CPUFUNC(op_e2f8_5), 0, 58104 }, /* LSRW */
-{ CPUFUNC(op_e2f9_5), 0, 58105 }, /* LSRW */
-{ CPUFUNC(op_e3d0_5), 0, 58320 }, /* LSLW */
-{ CPUFUNC(op_e3d8_5), 0, 58328 }, /* LSLW */
-{ CPUFUNC(op_e3e0_5), 0, 58336 }, /* LSLW */
-{ CPUFUNC(op_e3e8_5), 0, 58344 }, /* LSLW */
-{ CPUFUNC(op_e3f0_5), 0, 58352 }, /* LSLW */
-{ CPUFUNC(op_e3f8_5), 0, 58360 }, /* LSLW */
-{ CPUFUNC(op_e3f9_5), 0, 58361 }, /* LSLW */
-{ CPUFUNC(op_e4d0_5), 0, 58576 }, /* ROXRW */
-{ CPUFUNC(op_e4d8_5), 0, 58584 }, /* ROXRW */
-{ CPUFUNC(op_e4e0_5), 0, 58592 }, /* ROXRW */
-{ CPUFUNC(op_e4e8_5), 0, 58600 }, /* ROXRW */
-{ CPUFUNC(op_e4f0_5), 0, 58608 }, /* ROXRW */
-{ CPUFUNC(op_e4f8_5), 0, 58616 }, /* ROXRW */
-{ CPUFUNC(op_e4f9_5), 0, 58617 }, /* ROXRW */
-{ CPUFUNC(op_e5d0_5), 0, 58832 }, /* ROXLW */
-{ CPUFUNC(op_e5d8_5), 0, 58840 }, /* ROXLW */
-{ CPUFUNC(op_e5e0_5), 0, 58848 }, /* ROXLW */
-{ CPUFUNC(op_e5e8_5), 0, 58856 }, /* ROXLW */
-{ CPUFUNC(op_e5f0_5), 0, 58864 }, /* ROXLW */
-{ CPUFUNC(op_e5f8_5), 0, 58872 }, /* ROXLW */
-{ CPUFUNC(op_e5f9_5), 0, 58873 }, /* ROXLW */
-{ CPUFUNC(op_e6d0_5), 0, 59088 }, /* RORW */
-{ CPUFUNC(op_e6d8_5), 0, 59096 }, /* RORW */
-{ CPUFUNC(op_e6e0_5), 0, 59104 }, /* RORW */
-{ CPUFUNC(op_e6e8_5), 0, 59112 }, /* RORW */
-{ CPUFUNC(op_e6f0_5), 0, 59120 }, /* RORW */
-{ CPUFUNC(op_e6f8_5), 0, 59128 }, /* RORW */
-{ CPUFUNC(op_e6f9_5), 0, 59129 }, /* RORW */
-{ CPUFUNC(op_e7d0_5), 0, 59344 }, /* ROLW */
-{ CPUFUNC(op_e7d8_5), 0, 59352 }, /* ROLW */
-{ CPUFUNC(op_e7e0_5), 0, 59360 }, /* ROLW */
-{ CPUFUNC(op_e7e8_5), 0, 59368 }, /* ROLW */
-{ CPUFUNC(op_e7f0_5), 0, 59376 }, /* ROLW */
-{ CPUFUNC(op_e7f8_5), 0, 59384 }, /* ROLW */
-{ CPUFUNC(op_e7f9_5), 0, 59385 }, /* ROLW */
-{ 0, 0, 0 }};
+// Every handler, in the order cpuOpcodeIndex[] numbers them
+cpuop_func * const cpuFunctionTable[] = {
+	IllegalOpcode,
+	CPUFUNC(op_0_5),	/* OR */
+	CPUFUNC(op_10_5),	/* OR */
+	CPUFUNC(op_18_5),	/* OR */
+	CPUFUNC(op_20_5),	/* OR */
+	CPUFUNC(op_28_5),	/* OR */
+	CPUFUNC(op_30_5),	/* OR */
+	CPUFUNC(op_38_5),	/* OR */
+	CPUFUNC(op_39_5),	/* OR */
+	CPUFUNC(op_3c_5),	/* ORSR */
+	CPUFUNC(op_40_5),	/* OR */
+	CPUFUNC(op_50_5),	/* OR */
+	CPUFUNC(op_58_5),	/* OR */
+	CPUFUNC(op_60_5),	/* OR */
+	CPUFUNC(op_68_5),	/* OR */
+	CPUFUNC(op_70_5),	/* OR */
+	CPUFUNC(op_78_5),	/* OR */
+	CPUFUNC(op_79_5),	/* OR */
+	CPUFUNC(op_7c_5),	/* ORSR */
+	CPUFUNC(op_80_5),	/* OR */
+	CPUFUNC(op_90_5),	/* OR */
+	CPUFUNC(op_98_5),	/* OR */
+	CPUFUNC(op_a0_5),	/* OR */
+	CPUFUNC(op_a8_5),	/* OR */
+	CPUFUNC(op_b0_5),	/* OR */
+	CPUFUNC(op_b8_5),	/* OR */
+	CPUFUNC(op_b9_5),	/* OR */
+	CPUFUNC(op_100_5),	/* BTST */
+	CPUFUNC(op_108_5),	/* MVPMR */
+	CPUFUNC(op_110_5),	/* BTST */
+	CPUFUNC(op_118_5),	/* BTST */
+	CPUFUNC(op_120_5),	/* BTST */
+	CPUFUNC(op_128_5),	/* BTST */
+	CPUFUNC(op_130_5),	/* BTST */
+	CPUFUNC(op_138_5),	/* BTST */
+	CPUFUNC(op_139_5),	/* BTST */
+	CPUFUNC(op_13a_5),	/* BTST */
+	CPUFUNC(op_13b_5),	/* BTST */
+	CPUFUNC(op_13c_5),	/* BTST */
+	CPUFUNC(op_140_5),	/* BCHG */
+	CPUFUNC(op_148_5),	/* MVPMR */
+	CPUFUNC(op_150_5),	/* BCHG */
+	CPUFUNC(op_158_5),	/* BCHG */
+	CPUFUNC(op_160_5),	/* BCHG */
+	CPUFUNC(op_168_5),	/* BCHG */
+	CPUFUNC(op_170_5),	/* BCHG */
+	CPUFUNC(op_178_5),	/* BCHG */
+	CPUFUNC(op_179_5),	/* BCHG */
+	CPUFUNC(op_17a_5),	/* BCHG */
+	CPUFUNC(op_17b_5),	/* BCHG */
+	CPUFUNC(op_180_5),	/* BCLR */
+	CPUFUNC(op_188_5),	/* MVPRM */
+	CPUFUNC(op_190_5),	/* BCLR */
+	CPUFUNC(op_198_5),	/* BCLR */
+	CPUFUNC(op_1a0_5),	/* BCLR */
+	CPUFUNC(op_1a8_5),	/* BCLR */
+	CPUFUNC(op_1b0_5),	/* BCLR */
+	CPUFUNC(op_1b8_5),	/* BCLR */
+	CPUFUNC(op_1b9_5),	/* BCLR */
+	CPUFUNC(op_1ba_5),	/* BCLR */
+	CPUFUNC(op_1bb_5),	/* BCLR */
+	CPUFUNC(op_1c0_5),	/* BSET */
+	CPUFUNC(op_1c8_5),	/* MVPRM */
+	CPUFUNC(op_1d0_5),	/* BSET */
+	CPUFUNC(op_1d8_5),	/* BSET */
+	CPUFUNC(op_1e0_5),	/* BSET */
+	CPUFUNC(op_1e8_5),	/* BSET */
+	CPUFUNC(op_1f0_5),	/* BSET */
+	CPUFUNC(op_1f8_5),	/* BSET */
+	CPUFUNC(op_1f9_5),	/* BSET */
+	CPUFUNC(op_1fa_5),	/* BSET */
+	CPUFUNC(op_1fb_5),	/* BSET */
+	CPUFUNC(op_200_5),	/* AND */
+	CPUFUNC(op_210_5),	/* AND */
+	CPUFUNC(op_218_5),	/* AND */
+	CPUFUNC(op_220_5),	/* AND */
+	CPUFUNC(op_228_5),	/* AND */
+	CPUFUNC(op_230_5),	/* AND */
+	CPUFUNC(op_238_5),	/* AND */
+	CPUFUNC(op_239_5),	/* AND */
+	CPUFUNC(op_23c_5),	/* ANDSR */
+	CPUFUNC(op_240_5),	/* AND */
+	CPUFUNC(op_250_5),	/* AND */
+	CPUFUNC(op_258_5),	/* AND */
+	CPUFUNC(op_260_5),	/* AND */
+	CPUFUNC(op_268_5),	/* AND */
+	CPUFUNC(op_270_5),	/* AND */
+	CPUFUNC(op_278_5),	/* AND */
+	CPUFUNC(op_279_5),	/* AND */
+	CPUFUNC(op_27c_5),	/* ANDSR */
+	CPUFUNC(op_280_5),	/* AND */
+	CPUFUNC(op_290_5),	/* AND */
+	CPUFUNC(op_298_5),	/* AND */
+	CPUFUNC(op_2a0_5),	/* AND */
+	CPUFUNC(op_2a8_5),	/* AND */
+	CPUFUNC(op_2b0_5),	/* AND */
+	CPUFUNC(op_2b8_5),	/* AND */
+	CPUFUNC(op_2b9_5),	/* AND */
+	CPUFUNC(op_400_5),	/* SUB */
+	CPUFUNC(op_410_5),	/* SUB */
+	CPUFUNC(op_418_5),	/* SUB */
+	CPUFUNC(op_420_5),	/* SUB */
+	CPUFUNC(op_428_5),	/* SUB */
+	CPUFUNC(op_430_5),	/* SUB */
+	CPUFUNC(op_438_5),	/* SUB */
+	CPUFUNC(op_439_5),	/* SUB */
+	CPUFUNC(op_440_5),	/* SUB */
+	CPUFUNC(op_450_5),	/* SUB */
+	CPUFUNC(op_458_5),	/* SUB */
+	CPUFUNC(op_460_5),	/* SUB */
+	CPUFUNC(op_468_5),	/* SUB */
+	CPUFUNC(op_470_5),	/* SUB */
+	CPUFUNC(op_478_5),	/* SUB */
+	CPUFUNC(op_479_5),	/* SUB */
+	CPUFUNC(op_480_5),	/* SUB */
+	CPUFUNC(op_490_5),	/* SUB */
+	CPUFUNC(op_498_5),	/* SUB */
+	CPUFUNC(op_4a0_5),	/* SUB */
+	CPUFUNC(op_4a8_5),	/* SUB */
+	CPUFUNC(op_4b0_5),	/* SUB */
+	CPUFUNC(op_4b8_5),	/* SUB */
+	CPUFUNC(op_4b9_5),	/* SUB */
+	CPUFUNC(op_600_5),	/* ADD */
+	CPUFUNC(op_610_5),	/* ADD */
+	CPUFUNC(op_618_5),	/* ADD */
+	CPUFUNC(op_620_5),	/* ADD */
+	CPUFUNC(op_628_5),	/* ADD */
+	CPUFUNC(op_630_5),	/* ADD */
+	CPUFUNC(op_638_5),	/* ADD */
+	CPUFUNC(op_639_5),	/* ADD */
+	CPUFUNC(op_640_5),	/* ADD */
+	CPUFUNC(op_650_5),	/* ADD */
+	CPUFUNC(op_658_5),	/* ADD */
+	CPUFUNC(op_660_5),	/* ADD */
+	CPUFUNC(op_668_5),	/* ADD */
+	CPUFUNC(op_670_5),	/* ADD */
+	CPUFUNC(op_678_5),	/* ADD */
+	CPUFUNC(op_679_5),	/* ADD */
+	CPUFUNC(op_680_5),	/* ADD */
+	CPUFUNC(op_690_5),	/* ADD */
+	CPUFUNC(op_698_5),	/* ADD */
+	CPUFUNC(op_6a0_5),	/* ADD */
+	CPUFUNC(op_6a8_5),	/* ADD */
+	CPUFUNC(op_6b0_5),	/* ADD */
+	CPUFUNC(op_6b8_5),	/* ADD */
+	CPUFUNC(op_6b9_5),	/* ADD */
+	CPUFUNC(op_800_5),	/* BTST */
+	CPUFUNC(op_810_5),	/* BTST */
+	CPUFUNC(op_818_5),	/* BTST */
+	CPUFUNC(op_820_5),	/* BTST */
+	CPUFUNC(op_828_5),	/* BTST */
+	CPUFUNC(op_830_5),	/* BTST */
+	CPUFUNC(op_838_5),	/* BTST */
+	CPUFUNC(op_839_5),	/* BTST */
+	CPUFUNC(op_83a_5),	/* BTST */
+	CPUFUNC(op_83b_5),	/* BTST */
+	CPUFUNC(op_83c_5),	/* BTST */
+	CPUFUNC(op_840_5),	/* BCHG */
+	CPUFUNC(op_850_5),	/* BCHG */
+	CPUFUNC(op_858_5),	/* BCHG */
+	CPUFUNC(op_860_5),	/* BCHG */
+	CPUFUNC(op_868_5),	/* BCHG */
+	CPUFUNC(op_870_5),	/* BCHG */
+	CPUFUNC(op_878_5),	/* BCHG */
+	CPUFUNC(op_879_5),	/* BCHG */
+	CPUFUNC(op_87a_5),	/* BCHG */
+	CPUFUNC(op_87b_5),	/* BCHG */
+	CPUFUNC(op_880_5),	/* BCLR */
+	CPUFUNC(op_890_5),	/* BCLR */
+	CPUFUNC(op_898_5),	/* BCLR */
+	CPUFUNC(op_8a0_5),	/* BCLR */
+	CPUFUNC(op_8a8_5),	/* BCLR */
+	CPUFUNC(op_8b0_5),	/* BCLR */
+	CPUFUNC(op_8b8_5),	/* BCLR */
+	CPUFUNC(op_8b9_5),	/* BCLR */
+	CPUFUNC(op_8ba_5),	/* BCLR */
+	CPUFUNC(op_8bb_5),	/* BCLR */
+	CPUFUNC(op_8c0_5),	/* BSET */
+	CPUFUNC(op_8d0_5),	/* BSET */
+	CPUFUNC(op_8d8_5),	/* BSET */
+	CPUFUNC(op_8e0_5),	/* BSET */
+	CPUFUNC(op_8e8_5),	/* BSET */
+	CPUFUNC(op_8f0_5),	/* BSET */
+	CPUFUNC(op_8f8_5),	/* BSET */
+	CPUFUNC(op_8f9_5),	/* BSET */
+	CPUFUNC(op_8fa_5),	/* BSET */
+	CPUFUNC(op_8fb_5),	/* BSET */
+	CPUFUNC(op_a00_5),	/* EOR */
+	CPUFUNC(op_a10_5),	/* EOR */
+	CPUFUNC(op_a18_5),	/* EOR */
+	CPUFUNC(op_a20_5),	/* EOR */
+	CPUFUNC(op_a28_5),	/* EOR */
+	CPUFUNC(op_a30_5),	/* EOR */
+	CPUFUNC(op_a38_5),	/* EOR */
+	CPUFUNC(op_a39_5),	/* EOR */
+	CPUFUNC(op_a3c_5),	/* EORSR */
+	CPUFUNC(op_a40_5),	/* EOR */
+	CPUFUNC(op_a50_5),	/* EOR */
+	CPUFUNC(op_a58_5),	/* EOR */
+	CPUFUNC(op_a60_5),	/* EOR */
+	CPUFUNC(op_a68_5),	/* EOR */
+	CPUFUNC(op_a70_5),	/* EOR */
+	CPUFUNC(op_a78_5),	/* EOR */
+	CPUFUNC(op_a79_5),	/* EOR */
+	CPUFUNC(op_a7c_5),	/* EORSR */
+	CPUFUNC(op_a80_5),	/* EOR */
+	CPUFUNC(op_a90_5),	/* EOR */
+	CPUFUNC(op_a98_5),	/* EOR */
+	CPUFUNC(op_aa0_5),	/* EOR */
+	CPUFUNC(op_aa8_5),	/* EOR */
+	CPUFUNC(op_ab0_5),	/* EOR */
+	CPUFUNC(op_ab8_5),	/* EOR */
+	CPUFUNC(op_ab9_5),	/* EOR */
+	CPUFUNC(op_c00_5),	/* CMP */
+	CPUFUNC(op_c10_5),	/* CMP */
+	CPUFUNC(op_c18_5),	/* CMP */
+	CPUFUNC(op_c20_5),	/* CMP */
+	CPUFUNC(op_c28_5),	/* CMP */
+	CPUFUNC(op_c30_5),	/* CMP */
+	CPUFUNC(op_c38_5),	/* CMP */
+	CPUFUNC(op_c39_5),	/* CMP */
+	CPUFUNC(op_c3a_5),	/* CMP */
+	CPUFUNC(op_c3b_5),	/* CMP */
+	CPUFUNC(op_c40_5),	/* CMP */
+	CPUFUNC(op_c50_5),	/* CMP */
+	CPUFUNC(op_c58_5),	/* CMP */
+	CPUFUNC(op_c60_5),	/* CMP */
+	CPUFUNC(op_c68_5),	/* CMP */
+	CPUFUNC(op_c70_5),	/* CMP */
+	CPUFUNC(op_c78_5),	/* CMP */
+	CPUFUNC(op_c79_5),	/* CMP */
+	CPUFUNC(op_c7a_5),	/* CMP */
+	CPUFUNC(op_c7b_5),	/* CMP */
+	CPUFUNC(op_c80_5),	/* CMP */
+	CPUFUNC(op_c90_5),	/* CMP */
+	CPUFUNC(op_c98_5),	/* CMP */
+	CPUFUNC(op_ca0_5),	/* CMP */
+	CPUFUNC(op_ca8_5),	/* CMP */
+	CPUFUNC(op_cb0_5),	/* CMP */
+	CPUFUNC(op_cb8_5),	/* CMP */
+	CPUFUNC(op_cb9_5),	/* CMP */
+	CPUFUNC(op_cba_5),	/* CMP */
+	CPUFUNC(op_cbb_5),	/* CMP */
+	CPUFUNC(op_1000_5),	/* MOVE */
+	CPUFUNC(op_1008_5),	/* MOVE */
+	CPUFUNC(op_1010_5),	/* MOVE */
+	CPUFUNC(op_1018_5),	/* MOVE */
+	CPUFUNC(op_1020_5),	/* MOVE */
+	CPUFUNC(op_1028_5),	/* MOVE */
+	CPUFUNC(op_1030_5),	/* MOVE */
+	CPUFUNC(op_1038_5),	/* MOVE */
+	CPUFUNC(op_1039_5),	/* MOVE */
+	CPUFUNC(op_103a_5),	/* MOVE */
+	CPUFUNC(op_103b_5),	/* MOVE */
+	CPUFUNC(op_103c_5),	/* MOVE */
+	CPUFUNC(op_1080_5),	/* MOVE */
+	CPUFUNC(op_1088_5),	/* MOVE */
+	CPUFUNC(op_1090_5),	/* MOVE */
+	CPUFUNC(op_1098_5),	/* MOVE */
+	CPUFUNC(op_10a0_5),	/* MOVE */
+	CPUFUNC(op_10a8_5),	/* MOVE */
+	CPUFUNC(op_10b0_5),	/* MOVE */
+	CPUFUNC(op_10b8_5),	/* MOVE */
+	CPUFUNC(op_10b9_5),	/* MOVE */
+	CPUFUNC(op_10ba_5),	/* MOVE */
+	CPUFUNC(op_10bb_5),	/* MOVE */
+	CPUFUNC(op_10bc_5),	/* MOVE */
+	CPUFUNC(op_10c0_5),	/* MOVE */
+	CPUFUNC(op_10c8_5),	/* MOVE */
+	CPUFUNC(op_10d0_5),	/* MOVE */
+	CPUFUNC(op_10d8_5),	/* MOVE */
+	CPUFUNC(op_10e0_5),	/* MOVE */
+	CPUFUNC(op_10e8_5),	/* MOVE */
+	CPUFUNC(op_10f0_5),	/* MOVE */
+	CPUFUNC(op_10f8_5),	/* MOVE */
+	CPUFUNC(op_10f9_5),	/* MOVE */
+	CPUFUNC(op_10fa_5),	/* MOVE */
+	CPUFUNC(op_10fb_5),	/* MOVE */
+	CPUFUNC(op_10fc_5),	/* MOVE */
+	CPUFUNC(op_1100_5),	/* MOVE */
+	CPUFUNC(op_1108_5),	/* MOVE */
+	CPUFUNC(op_1110_5),	/* MOVE */
+	CPUFUNC(op_1118_5),	/* MOVE */
+	CPUFUNC(op_1120_5),	/* MOVE */
+	CPUFUNC(op_1128_5),	/* MOVE */
+	CPUFUNC(op_1130_5),	/* MOVE */
+	CPUFUNC(op_1138_5),	/* MOVE */
+	CPUFUNC(op_1139_5),	/* MOVE */
+	CPUFUNC(op_113a_5),	/* MOVE */
+	CPUFUNC(op_113b_5),	/* MOVE */
+	CPUFUNC(op_113c_5),	/* MOVE */
+	CPUFUNC(op_1140_5),	/* MOVE */
+	CPUFUNC(op_1148_5),	/* MOVE */
+	CPUFUNC(op_1150_5),	/* MOVE */
+	CPUFUNC(op_1158_5),	/* MOVE */
+	CPUFUNC(op_1160_5),	/* MOVE */
+	CPUFUNC(op_1168_5),	/* MOVE */
+	CPUFUNC(op_1170_5),	/* MOVE */
+	CPUFUNC(op_1178_5),	/* MOVE */
+	CPUFUNC(op_1179_5),	/* MOVE */
+	CPUFUNC(op_117a_5),	/* MOVE */
+	CPUFUNC(op_117b_5),	/* MOVE */
+	CPUFUNC(op_117c_5),	/* MOVE */
+	CPUFUNC(op_1180_5),	/* MOVE */
+	CPUFUNC(op_1188_5),	/* MOVE */
+	CPUFUNC(op_1190_5),	/* MOVE */
+	CPUFUNC(op_1198_5),	/* MOVE */
+	CPUFUNC(op_11a0_5),	/* MOVE */
+	CPUFUNC(op_11a8_5),	/* MOVE */
+	CPUFUNC(op_11b0_5),	/* MOVE */
+	CPUFUNC(op_11b8_5),	/* MOVE */
+	CPUFUNC(op_11b9_5),	/* MOVE */
+	CPUFUNC(op_11ba_5),	/* MOVE */
+	CPUFUNC(op_11bb_5),	/* MOVE */
+	CPUFUNC(op_11bc_5),	/* MOVE */
+	CPUFUNC(op_11c0_5),	/* MOVE */
+	CPUFUNC(op_11c8_5),	/* MOVE */
+	CPUFUNC(op_11d0_5),	/* MOVE */
+	CPUFUNC(op_11d8_5),	/* MOVE */
+	CPUFUNC(op_11e0_5),	/* MOVE */
+	CPUFUNC(op_11e8_5),	/* MOVE */
+	CPUFUNC(op_11f0_5),	/* MOVE */
+	CPUFUNC(op_11f8_5),	/* MOVE */
+	CPUFUNC(op_11f9_5),	/* MOVE */
+	CPUFUNC(op_11fa_5),	/* MOVE */
+	CPUFUNC(op_11fb_5),	/* MOVE */
+	CPUFUNC(op_11fc_5),	/* MOVE */
+	CPUFUNC(op_13c0_5),	/* MOVE */
+	CPUFUNC(op_13c8_5),	/* MOVE */
+	CPUFUNC(op_13d0_5),	/* MOVE */
+	CPUFUNC(op_13d8_5),	/* MOVE */
+	CPUFUNC(op_13e0_5),	/* MOVE */
+	CPUFUNC(op_13e8_5),	/* MOVE */
+	CPUFUNC(op_13f0_5),	/* MOVE */
+	CPUFUNC(op_13f8_5),	/* MOVE */
+	CPUFUNC(op_13f9_5),	/* MOVE */
+	CPUFUNC(op_13fa_5),	/* MOVE */
+	CPUFUNC(op_13fb_5),	/* MOVE */
+	CPUFUNC(op_13fc_5),	/* MOVE */
+	CPUFUNC(op_2000_5),	/* MOVE */
+	CPUFUNC(op_2008_5),	/* MOVE */
+	CPUFUNC(op_2010_5),	/* MOVE */
+	CPUFUNC(op_2018_5),	/* MOVE */
+	CPUFUNC(op_2020_5),	/* MOVE */
+	CPUFUNC(op_2028_5),	/* MOVE */
+	CPUFUNC(op_2030_5),	/* MOVE */
+	CPUFUNC(op_2038_5),	/* MOVE */
+	CPUFUNC(op_2039_5),	/* MOVE */
+	CPUFUNC(op_203a_5),	/* MOVE */
+	CPUFUNC(op_203b_5),	/* MOVE */
+	CPUFUNC(op_203c_5),	/* MOVE */
+	CPUFUNC(op_2040_5),	/* MOVEA */
+	CPUFUNC(op_2048_5),	/* MOVEA */
+	CPUFUNC(op_2050_5),	/* MOVEA */
+	CPUFUNC(op_2058_5),	/* MOVEA */
+	CPUFUNC(op_2060_5),	/* MOVEA */
+	CPUFUNC(op_2068_5),	/* MOVEA */
+	CPUFUNC(op_2070_5),	/* MOVEA */
+	CPUFUNC(op_2078_5),	/* MOVEA */
+	CPUFUNC(op_2079_5),	/* MOVEA */
+	CPUFUNC(op_207a_5),	/* MOVEA */
+	CPUFUNC(op_207b_5),	/* MOVEA */
+	CPUFUNC(op_207c_5),	/* MOVEA */
+	CPUFUNC(op_2080_5),	/* MOVE */
+	CPUFUNC(op_2088_5),	/* MOVE */
+	CPUFUNC(op_2090_5),	/* MOVE */
+	CPUFUNC(op_2098_5),	/* MOVE */
+	CPUFUNC(op_20a0_5),	/* MOVE */
+	CPUFUNC(op_20a8_5),	/* MOVE */
+	CPUFUNC(op_20b0_5),	/* MOVE */
+	CPUFUNC(op_20b8_5),	/* MOVE */
+	CPUFUNC(op_20b9_5),	/* MOVE */
+	CPUFUNC(op_20ba_5),	/* MOVE */
+	CPUFUNC(op_20bb_5),	/* MOVE */
+	CPUFUNC(op_20bc_5),	/* MOVE */
+	CPUFUNC(op_20c0_5),	/* MOVE */
+	CPUFUNC(op_20c8_5),	/* MOVE */
+	CPUFUNC(op_20d0_5),	/* MOVE */
+	CPUFUNC(op_20d8_5),	/* MOVE */
+	CPUFUNC(op_20e0_5),	/* MOVE */
+	CPUFUNC(op_20e8_5),	/* MOVE */
+	CPUFUNC(op_20f0_5),	/* MOVE */
+	CPUFUNC(op_20f8_5),	/* MOVE */
+	CPUFUNC(op_20f9_5),	/* MOVE */
+	CPUFUNC(op_20fa_5),	/* MOVE */
+	CPUFUNC(op_20fb_5),	/* MOVE */
+	CPUFUNC(op_20fc_5),	/* MOVE */
+	CPUFUNC(op_2100_5),	/* MOVE */
+	CPUFUNC(op_2108_5),	/* MOVE */
+	CPUFUNC(op_2110_5),	/* MOVE */
+	CPUFUNC(op_2118_5),	/* MOVE */
+	CPUFUNC(op_2120_5),	/* MOVE */
+	CPUFUNC(op_2128_5),	/* MOVE */
+	CPUFUNC(op_2130_5),	/* MOVE */
+	CPUFUNC(op_2138_5),	/* MOVE */
+	CPUFUNC(op_2139_5),	/* MOVE */
+	CPUFUNC(op_213a_5),	/* MOVE */
+	CPUFUNC(op_213b_5),	/* MOVE */
+	CPUFUNC(op_213c_5),	/* MOVE */
+	CPUFUNC(op_2140_5),	/* MOVE */
+	CPUFUNC(op_2148_5),	/* MOVE */
+	CPUFUNC(op_2150_5),	/* MOVE */
+	CPUFUNC(op_2158_5),	/* MOVE */
+	CPUFUNC(op_2160_5),	/* MOVE */
+	CPUFUNC(op_2168_5),	/* MOVE */
+	CPUFUNC(op_2170_5),	/* MOVE */
+	CPUFUNC(op_2178_5),	/* MOVE */
+	CPUFUNC(op_2179_5),	/* MOVE */
+	CPUFUNC(op_217a_5),	/* MOVE */
+	CPUFUNC(op_217b_5),	/* MOVE */
+	CPUFUNC(op_217c_5),	/* MOVE */
+	CPUFUNC(op_2180_5),	/* MOVE */
+	CPUFUNC(op_2188_5),	/* MOVE */
+	CPUFUNC(op_2190_5),	/* MOVE */
+	CPUFUNC(op_2198_5),	/* MOVE */
+	CPUFUNC(op_21a0_5),	/* MOVE */
+	CPUFUNC(op_21a8_5),	/* MOVE */
+	CPUFUNC(op_21b0_5),	/* MOVE */
+	CPUFUNC(op_21b8_5),	/* MOVE */
+	CPUFUNC(op_21b9_5),	/* MOVE */
+	CPUFUNC(op_21ba_5),	/* MOVE */
+	CPUFUNC(op_21bb_5),	/* MOVE */
+	CPUFUNC(op_21bc_5),	/* MOVE */
+	CPUFUNC(op_21c0_5),	/* MOVE */
+	CPUFUNC(op_21c8_5),	/* MOVE */
+	CPUFUNC(op_21d0_5),	/* MOVE */
+	CPUFUNC(op_21d8_5),	/* MOVE */
+	CPUFUNC(op_21e0_5),	/* MOVE */
+	CPUFUNC(op_21e8_5),	/* MOVE */
+	CPUFUNC(op_21f0_5),	/* MOVE */
+	CPUFUNC(op_21f8_5),	/* MOVE */
+	CPUFUNC(op_21f9_5),	/* MOVE */
+	CPUFUNC(op_21fa_5),	/* MOVE */
+	CPUFUNC(op_21fb_5),	/* MOVE */
+	CPUFUNC(op_21fc_5),	/* MOVE */
+	CPUFUNC(op_23c0_5),	/* MOVE */
+	CPUFUNC(op_23c8_5),	/* MOVE */
+	CPUFUNC(op_23d0_5),	/* MOVE */
+	CPUFUNC(op_23d8_5),	/* MOVE */
+	CPUFUNC(op_23e0_5),	/* MOVE */
+	CPUFUNC(op_23e8_5),	/* MOVE */
+	CPUFUNC(op_23f0_5),	/* MOVE */
+	CPUFUNC(op_23f8_5),	/* MOVE */
+	CPUFUNC(op_23f9_5),	/* MOVE */
+	CPUFUNC(op_23fa_5),	/* MOVE */
+	CPUFUNC(op_23fb_5),	/* MOVE */
+	CPUFUNC(op_23fc_5),	/* MOVE */
+	CPUFUNC(op_3000_5),	/* MOVE */
+	CPUFUNC(op_3008_5),	/* MOVE */
+	CPUFUNC(op_3010_5),	/* MOVE */
+	CPUFUNC(op_3018_5),	/* MOVE */
+	CPUFUNC(op_3020_5),	/* MOVE */
+	CPUFUNC(op_3028_5),	/* MOVE */
+	CPUFUNC(op_3030_5),	/* MOVE */
+	CPUFUNC(op_3038_5),	/* MOVE */
+	CPUFUNC(op_3039_5),	/* MOVE */
+	CPUFUNC(op_303a_5),	/* MOVE */
+	CPUFUNC(op_303b_5),	/* MOVE */
+	CPUFUNC(op_303c_5),	/* MOVE */
+	CPUFUNC(op_3040_5),	/* MOVEA */
+	CPUFUNC(op_3048_5),	/* MOVEA */
+	CPUFUNC(op_3050_5),	/* MOVEA */
+	CPUFUNC(op_3058_5),	/* MOVEA */
+	CPUFUNC(op_3060_5),	/* MOVEA */
+	CPUFUNC(op_3068_5),	/* MOVEA */
+	CPUFUNC(op_3070_5),	/* MOVEA */
+	CPUFUNC(op_3078_5),	/* MOVEA */
+	CPUFUNC(op_3079_5),	/* MOVEA */
+	CPUFUNC(op_307a_5),	/* MOVEA */
+	CPUFUNC(op_307b_5),	/* MOVEA */
+	CPUFUNC(op_307c_5),	/* MOVEA */
+	CPUFUNC(op_3080_5),	/* MOVE */
+	CPUFUNC(op_3088_5),	/* MOVE */
+	CPUFUNC(op_3090_5),	/* MOVE */
+	CPUFUNC(op_3098_5),	/* MOVE */
+	CPUFUNC(op_30a0_5),	/* MOVE */
+	CPUFUNC(op_30a8_5),	/* MOVE */
+	CPUFUNC(op_30b0_5),	/* MOVE */
+	CPUFUNC(op_30b8_5),	/* MOVE */
+	CPUFUNC(op_30b9_5),	/* MOVE */
+	CPUFUNC(op_30ba_5),	/* MOVE */
+	CPUFUNC(op_30bb_5),	/* MOVE */
+	CPUFUNC(op_30bc_5),	/* MOVE */
+	CPUFUNC(op_30c0_5),	/* MOVE */
+	CPUFUNC(op_30c8_5),	/* MOVE */
+	CPUFUNC(op_30d0_5),	/* MOVE */
+	CPUFUNC(op_30d8_5),	/* MOVE */
+	CPUFUNC(op_30e0_5),	/* MOVE */
+	CPUFUNC(op_30e8_5),	/* MOVE */
+	CPUFUNC(op_30f0_5),	/* MOVE */
+	CPUFUNC(op_30f8_5),	/* MOVE */
+	CPUFUNC(op_30f9_5),	/* MOVE */
+	CPUFUNC(op_30fa_5),	/* MOVE */
+	CPUFUNC(op_30fb_5),	/* MOVE */
+	CPUFUNC(op_30fc_5),	/* MOVE */
+	CPUFUNC(op_3100_5),	/* MOVE */
+	CPUFUNC(op_3108_5),	/* MOVE */
+	CPUFUNC(op_3110_5),	/* MOVE */
+	CPUFUNC(op_3118_5),	/* MOVE */
+	CPUFUNC(op_3120_5),	/* MOVE */
+	CPUFUNC(op_3128_5),	/* MOVE */
+	CPUFUNC(op_3130_5),	/* MOVE */
+	CPUFUNC(op_3138_5),	/* MOVE */
+	CPUFUNC(op_3139_5),	/* MOVE */
+	CPUFUNC(op_313a_5),	/* MOVE */
+	CPUFUNC(op_313b_5),	/* MOVE */
+	CPUFUNC(op_313c_5),	/* MOVE */
+	CPUFUNC(op_3140_5),	/* MOVE */
+	CPUFUNC(op_3148_5),	/* MOVE */
+	CPUFUNC(op_3150_5),	/* MOVE */
+	CPUFUNC(op_3158_5),	/* MOVE */
+	CPUFUNC(op_3160_5),	/* MOVE */
+	CPUFUNC(op_3168_5),	/* MOVE */
+	CPUFUNC(op_3170_5),	/* MOVE */
+	CPUFUNC(op_3178_5),	/* MOVE */
+	CPUFUNC(op_3179_5),	/* MOVE */
+	CPUFUNC(op_317a_5),	/* MOVE */
+	CPUFUNC(op_317b_5),	/* MOVE */
+	CPUFUNC(op_317c_5),	/* MOVE */
+	CPUFUNC(op_3180_5),	/* MOVE */
+	CPUFUNC(op_3188_5),	/* MOVE */
+	CPUFUNC(op_3190_5),	/* MOVE */
+	CPUFUNC(op_3198_5),	/* MOVE */
+	CPUFUNC(op_31a0_5),	/* MOVE */
+	CPUFUNC(op_31a8_5),	/* MOVE */
+	CPUFUNC(op_31b0_5),	/* MOVE */
+	CPUFUNC(op_31b8_5),	/* MOVE */
+	CPUFUNC(op_31b9_5),	/* MOVE */
+	CPUFUNC(op_31ba_5),	/* MOVE */
+	CPUFUNC(op_31bb_5),	/* MOVE */
+	CPUFUNC(op_31bc_5),	/* MOVE */
+	CPUFUNC(op_31c0_5),	/* MOVE */
+	CPUFUNC(op_31c8_5),	/* MOVE */
+	CPUFUNC(op_31d0_5),	/* MOVE */
+	CPUFUNC(op_31d8_5),	/* MOVE */
+	CPUFUNC(op_31e0_5),	/* MOVE */
+	CPUFUNC(op_31e8_5),	/* MOVE */
+	CPUFUNC(op_31f0_5),	/* MOVE */
+	CPUFUNC(op_31f8_5),	/* MOVE */
+	CPUFUNC(op_31f9_5),	/* MOVE */
+	CPUFUNC(op_31fa_5),	/* MOVE */
+	CPUFUNC(op_31fb_5),	/* MOVE */
+	CPUFUNC(op_31fc_5),	/* MOVE */
+	CPUFUNC(op_33c0_5),	/* MOVE */
+	CPUFUNC(op_33c8_5),	/* MOVE */
+	CPUFUNC(op_33d0_5),	/* MOVE */
+	CPUFUNC(op_33d8_5),	/* MOVE */
+	CPUFUNC(op_33e0_5),	/* MOVE */
+	CPUFUNC(op_33e8_5),	/* MOVE */
+	CPUFUNC(op_33f0_5),	/* MOVE */
+	CPUFUNC(op_33f8_5),	/* MOVE */
+	CPUFUNC(op_33f9_5),	/* MOVE */
+	CPUFUNC(op_33fa_5),	/* MOVE */
+	CPUFUNC(op_33fb_5),	/* MOVE */
+	CPUFUNC(op_33fc_5),	/* MOVE */
+	CPUFUNC(op_4000_5),	/* NEGX */
+	CPUFUNC(op_4010_5),	/* NEGX */
+	CPUFUNC(op_4018_5),	/* NEGX */
+	CPUFUNC(op_4020_5),	/* NEGX */
+	CPUFUNC(op_4028_5),	/* NEGX */
+	CPUFUNC(op_4030_5),	/* NEGX */
+	CPUFUNC(op_4038_5),	/* NEGX */
+	CPUFUNC(op_4039_5),	/* NEGX */
+	CPUFUNC(op_4040_5),	/* NEGX */
+	CPUFUNC(op_4050_5),	/* NEGX */
+	CPUFUNC(op_4058_5),	/* NEGX */
+	CPUFUNC(op_4060_5),	/* NEGX */
+	CPUFUNC(op_4068_5),	/* NEGX */
+	CPUFUNC(op_4070_5),	/* NEGX */
+	CPUFUNC(op_4078_5),	/* NEGX */
+	CPUFUNC(op_4079_5),	/* NEGX */
+	CPUFUNC(op_4080_5),	/* NEGX */
+	CPUFUNC(op_4090_5),	/* NEGX */
+	CPUFUNC(op_4098_5),	/* NEGX */
+	CPUFUNC(op_40a0_5),	/* NEGX */
+	CPUFUNC(op_40a8_5),	/* NEGX */
+	CPUFUNC(op_40b0_5),	/* NEGX */
+	CPUFUNC(op_40b8_5),	/* NEGX */
+	CPUFUNC(op_40b9_5),	/* NEGX */
+	CPUFUNC(op_40c0_5),	/* MVSR2 */
+	CPUFUNC(op_40d0_5),	/* MVSR2 */
+	CPUFUNC(op_40d8_5),	/* MVSR2 */
+	CPUFUNC(op_40e0_5),	/* MVSR2 */
+	CPUFUNC(op_40e8_5),	/* MVSR2 */
+	CPUFUNC(op_40f0_5),	/* MVSR2 */
+	CPUFUNC(op_40f8_5),	/* MVSR2 */
+	CPUFUNC(op_40f9_5),	/* MVSR2 */
+	CPUFUNC(op_4180_5),	/* CHK */
+	CPUFUNC(op_4190_5),	/* CHK */
+	CPUFUNC(op_4198_5),	/* CHK */
+	CPUFUNC(op_41a0_5),	/* CHK */
+	CPUFUNC(op_41a8_5),	/* CHK */
+	CPUFUNC(op_41b0_5),	/* CHK */
+	CPUFUNC(op_41b8_5),	/* CHK */
+	CPUFUNC(op_41b9_5),	/* CHK */
+	CPUFUNC(op_41ba_5),	/* CHK */
+	CPUFUNC(op_41bb_5),	/* CHK */
+	CPUFUNC(op_41bc_5),	/* CHK */
+	CPUFUNC(op_41d0_5),	/* LEA */
+	CPUFUNC(op_41e8_5),	/* LEA */
+	CPUFUNC(op_41f0_5),	/* LEA */
+	CPUFUNC(op_41f8_5),	/* LEA */
+	CPUFUNC(op_41f9_5),	/* LEA */
+	CPUFUNC(op_41fa_5),	/* LEA */
+	CPUFUNC(op_41fb_5),	/* LEA */
+	CPUFUNC(op_4200_5),	/* CLR */
+	CPUFUNC(op_4210_5),	/* CLR */
+	CPUFUNC(op_4218_5),	/* CLR */
+	CPUFUNC(op_4220_5),	/* CLR */
+	CPUFUNC(op_4228_5),	/* CLR */
+	CPUFUNC(op_4230_5),	/* CLR */
+	CPUFUNC(op_4238_5),	/* CLR */
+	CPUFUNC(op_4239_5),	/* CLR */
+	CPUFUNC(op_4240_5),	/* CLR */
+	CPUFUNC(op_4250_5),	/* CLR */
+	CPUFUNC(op_4258_5),	/* CLR */
+	CPUFUNC(op_4260_5),	/* CLR */
+	CPUFUNC(op_4268_5),	/* CLR */
+	CPUFUNC(op_4270_5),	/* CLR */
+	CPUFUNC(op_4278_5),	/* CLR */
+	CPUFUNC(op_4279_5),	/* CLR */
+	CPUFUNC(op_4280_5),	/* CLR */
+	CPUFUNC(op_4290_5),	/* CLR */
+	CPUFUNC(op_4298_5),	/* CLR */
+	CPUFUNC(op_42a0_5),	/* CLR */
+	CPUFUNC(op_42a8_5),	/* CLR */
+	CPUFUNC(op_42b0_5),	/* CLR */
+	CPUFUNC(op_42b8_5),	/* CLR */
+	CPUFUNC(op_42b9_5),	/* CLR */
+	CPUFUNC(op_4400_5),	/* NEG */
+	CPUFUNC(op_4410_5),	/* NEG */
+	CPUFUNC(op_4418_5),	/* NEG */
+	CPUFUNC(op_4420_5),	/* NEG */
+	CPUFUNC(op_4428_5),	/* NEG */
+	CPUFUNC(op_4430_5),	/* NEG */
+	CPUFUNC(op_4438_5),	/* NEG */
+	CPUFUNC(op_4439_5),	/* NEG */
+	CPUFUNC(op_4440_5),	/* NEG */
+	CPUFUNC(op_4450_5),	/* NEG */
+	CPUFUNC(op_4458_5),	/* NEG */
+	CPUFUNC(op_4460_5),	/* NEG */
+	CPUFUNC(op_4468_5),	/* NEG */
+	CPUFUNC(op_4470_5),	/* NEG */
+	CPUFUNC(op_4478_5),	/* NEG */
+	CPUFUNC(op_4479_5),	/* NEG */
+	CPUFUNC(op_4480_5),	/* NEG */
+	CPUFUNC(op_4490_5),	/* NEG */
+	CPUFUNC(op_4498_5),	/* NEG */
+	CPUFUNC(op_44a0_5),	/* NEG */
+	CPUFUNC(op_44a8_5),	/* NEG */
+	CPUFUNC(op_44b0_5),	/* NEG */
+	CPUFUNC(op_44b8_5),	/* NEG */
+	CPUFUNC(op_44b9_5),	/* NEG */
+	CPUFUNC(op_44c0_5),	/* MV2SR */
+	CPUFUNC(op_44d0_5),	/* MV2SR */
+	CPUFUNC(op_44d8_5),	/* MV2SR */
+	CPUFUNC(op_44e0_5),	/* MV2SR */
+	CPUFUNC(op_44e8_5),	/* MV2SR */
+	CPUFUNC(op_44f0_5),	/* MV2SR */
+	CPUFUNC(op_44f8_5),	/* MV2SR */
+	CPUFUNC(op_44f9_5),	/* MV2SR */
+	CPUFUNC(op_44fa_5),	/* MV2SR */
+	CPUFUNC(op_44fb_5),	/* MV2SR */
+	CPUFUNC(op_44fc_5),	/* MV2SR */
+	CPUFUNC(op_4600_5),	/* NOT */
+	CPUFUNC(op_4610_5),	/* NOT */
+	CPUFUNC(op_4618_5),	/* NOT */
+	CPUFUNC(op_4620_5),	/* NOT */
+	CPUFUNC(op_4628_5),	/* NOT */
+	CPUFUNC(op_4630_5),	/* NOT */
+	CPUFUNC(op_4638_5),	/* NOT */
+	CPUFUNC(op_4639_5),	/* NOT */
+	CPUFUNC(op_4640_5),	/* NOT */
+	CPUFUNC(op_4650_5),	/* NOT */
+	CPUFUNC(op_4658_5),	/* NOT */
+	CPUFUNC(op_4660_5),	/* NOT */
+	CPUFUNC(op_4668_5),	/* NOT */
+	CPUFUNC(op_4670_5),	/* NOT */
+	CPUFUNC(op_4678_5),	/* NOT */
+	CPUFUNC(op_4679_5),	/* NOT */
+	CPUFUNC(op_4680_5),	/* NOT */
+	CPUFUNC(op_4690_5),	/* NOT */
+	CPUFUNC(op_4698_5),	/* NOT */
+	CPUFUNC(op_46a0_5),	/* NOT */
+	CPUFUNC(op_46a8_5),	/* NOT */
+	CPUFUNC(op_46b0_5),	/* NOT */
+	CPUFUNC(op_46b8_5),	/* NOT */
+	CPUFUNC(op_46b9_5),	/* NOT */
+	CPUFUNC(op_46c0_5),	/* MV2SR */
+	CPUFUNC(op_46d0_5),	/* MV2SR */
+	CPUFUNC(op_46d8_5),	/* MV2SR */
+	CPUFUNC(op_46e0_5),	/* MV2SR */
+	CPUFUNC(op_46e8_5),	/* MV2SR */
+	CPUFUNC(op_46f0_5),	/* MV2SR */
+	CPUFUNC(op_46f8_5),	/* MV2SR */
+	CPUFUNC(op_46f9_5),	/* MV2SR */
+	CPUFUNC(op_46fa_5),	/* MV2SR */
+	CPUFUNC(op_46fb_5),	/* MV2SR */
+	CPUFUNC(op_46fc_5),	/* MV2SR */
+	CPUFUNC(op_4800_5),	/* NBCD */
+	CPUFUNC(op_4810_5),	/* NBCD */
+	CPUFUNC(op_4818_5),	/* NBCD */
+	CPUFUNC(op_4820_5),	/* NBCD */
+	CPUFUNC(op_4828_5),	/* NBCD */
+	CPUFUNC(op_4830_5),	/* NBCD */
+	CPUFUNC(op_4838_5),	/* NBCD */
+	CPUFUNC(op_4839_5),	/* NBCD */
+	CPUFUNC(op_4840_5),	/* SWAP */
+	CPUFUNC(op_4850_5),	/* PEA */
+	CPUFUNC(op_4868_5),	/* PEA */
+	CPUFUNC(op_4870_5),	/* PEA */
+	CPUFUNC(op_4878_5),	/* PEA */
+	CPUFUNC(op_4879_5),	/* PEA */
+	CPUFUNC(op_487a_5),	/* PEA */
+	CPUFUNC(op_487b_5),	/* PEA */
+	CPUFUNC(op_4880_5),	/* EXT */
+	CPUFUNC(op_4890_5),	/* MVMLE */
+	CPUFUNC(op_48a0_5),	/* MVMLE */
+	CPUFUNC(op_48a8_5),	/* MVMLE */
+	CPUFUNC(op_48b0_5),	/* MVMLE */
+	CPUFUNC(op_48b8_5),	/* MVMLE */
+	CPUFUNC(op_48b9_5),	/* MVMLE */
+	CPUFUNC(op_48c0_5),	/* EXT */
+	CPUFUNC(op_48d0_5),	/* MVMLE */
+	CPUFUNC(op_48e0_5),	/* MVMLE */
+	CPUFUNC(op_48e8_5),	/* MVMLE */
+	CPUFUNC(op_48f0_5),	/* MVMLE */
+	CPUFUNC(op_48f8_5),	/* MVMLE */
+	CPUFUNC(op_48f9_5),	/* MVMLE */
+	CPUFUNC(op_4a00_5),	/* TST */
+	CPUFUNC(op_4a10_5),	/* TST */
+	CPUFUNC(op_4a18_5),	/* TST */
+	CPUFUNC(op_4a20_5),	/* TST */
+	CPUFUNC(op_4a28_5),	/* TST */
+	CPUFUNC(op_4a30_5),	/* TST */
+	CPUFUNC(op_4a38_5),	/* TST */
+	CPUFUNC(op_4a39_5),	/* TST */
+	CPUFUNC(op_4a3a_5),	/* TST */
+	CPUFUNC(op_4a3b_5),	/* TST */
+	CPUFUNC(op_4a3c_5),	/* TST */
+	CPUFUNC(op_4a40_5),	/* TST */
+	CPUFUNC(op_4a48_5),	/* TST */
+	CPUFUNC(op_4a50_5),	/* TST */
+	CPUFUNC(op_4a58_5),	/* TST */
+	CPUFUNC(op_4a60_5),	/* TST */
+	CPUFUNC(op_4a68_5),	/* TST */
+	CPUFUNC(op_4a70_5),	/* TST */
+	CPUFUNC(op_4a78_5),	/* TST */
+	CPUFUNC(op_4a79_5),	/* TST */
+	CPUFUNC(op_4a7a_5),	/* TST */
+	CPUFUNC(op_4a7b_5),	/* TST */
+	CPUFUNC(op_4a7c_5),	/* TST */
+	CPUFUNC(op_4a80_5),	/* TST */
+	CPUFUNC(op_4a88_5),	/* TST */
+	CPUFUNC(op_4a90_5),	/* TST */
+	CPUFUNC(op_4a98_5),	/* TST */
+	CPUFUNC(op_4aa0_5),	/* TST */
+	CPUFUNC(op_4aa8_5),	/* TST */
+	CPUFUNC(op_4ab0_5),	/* TST */
+	CPUFUNC(op_4ab8_5),	/* TST */
+	CPUFUNC(op_4ab9_5),	/* TST */
+	CPUFUNC(op_4aba_5),	/* TST */
+	CPUFUNC(op_4abb_5),	/* TST */
+	CPUFUNC(op_4abc_5),	/* TST */
+	CPUFUNC(op_4ac0_5),	/* TAS */
+	CPUFUNC(op_4ad0_5),	/* TAS */
+	CPUFUNC(op_4ad8_5),	/* TAS */
+	CPUFUNC(op_4ae0_5),	/* TAS */
+	CPUFUNC(op_4ae8_5),	/* TAS */
+	CPUFUNC(op_4af0_5),	/* TAS */
+	CPUFUNC(op_4af8_5),	/* TAS */
+	CPUFUNC(op_4af9_5),	/* TAS */
+	CPUFUNC(op_4c90_5),	/* MVMEL */
+	CPUFUNC(op_4c98_5),	/* MVMEL */
+	CPUFUNC(op_4ca8_5),	/* MVMEL */
+	CPUFUNC(op_4cb0_5),	/* MVMEL */
+	CPUFUNC(op_4cb8_5),	/* MVMEL */
+	CPUFUNC(op_4cb9_5),	/* MVMEL */
+	CPUFUNC(op_4cba_5),	/* MVMEL */
+	CPUFUNC(op_4cbb_5),	/* MVMEL */
+	CPUFUNC(op_4cd0_5),	/* MVMEL */
+	CPUFUNC(op_4cd8_5),	/* MVMEL */
+	CPUFUNC(op_4ce8_5),	/* MVMEL */
+	CPUFUNC(op_4cf0_5),	/* MVMEL */
+	CPUFUNC(op_4cf8_5),	/* MVMEL */
+	CPUFUNC(op_4cf9_5),	/* MVMEL */
+	CPUFUNC(op_4cfa_5),	/* MVMEL */
+	CPUFUNC(op_4cfb_5),	/* MVMEL */
+	CPUFUNC(op_4e40_5),	/* TRAP */
+	CPUFUNC(op_4e50_5),	/* LINK */
+	CPUFUNC(op_4e58_5),	/* UNLK */
+	CPUFUNC(op_4e60_5),	/* MVR2USP */
+	CPUFUNC(op_4e68_5),	/* MVUSP2R */
+	CPUFUNC(op_4e70_5),	/* RESET */
+	CPUFUNC(op_4e71_5),	/* NOP */
+	CPUFUNC(op_4e72_5),	/* STOP */
+	CPUFUNC(op_4e73_5),	/* RTE */
+	CPUFUNC(op_4e74_5),	/* RTD */
+	CPUFUNC(op_4e75_5),	/* RTS */
+	CPUFUNC(op_4e76_5),	/* TRAPV */
+	CPUFUNC(op_4e77_5),	/* RTR */
+	CPUFUNC(op_4e90_5),	/* JSR */
+	CPUFUNC(op_4ea8_5),	/* JSR */
+	CPUFUNC(op_4eb0_5),	/* JSR */
+	CPUFUNC(op_4eb8_5),	/* JSR */
+	CPUFUNC(op_4eb9_5),	/* JSR */
+	CPUFUNC(op_4eba_5),	/* JSR */
+	CPUFUNC(op_4ebb_5),	/* JSR */
+	CPUFUNC(op_4ed0_5),	/* JMP */
+	CPUFUNC(op_4ee8_5),	/* JMP */
+	CPUFUNC(op_4ef0_5),	/* JMP */
+	CPUFUNC(op_4ef8_5),	/* JMP */
+	CPUFUNC(op_4ef9_5),	/* JMP */
+	CPUFUNC(op_4efa_5),	/* JMP */
+	CPUFUNC(op_4efb_5),	/* JMP */
+	CPUFUNC(op_5000_5),	/* ADD */
+	CPUFUNC(op_5010_5),	/* ADD */
+	CPUFUNC(op_5018_5),	/* ADD */
+	CPUFUNC(op_5020_5),	/* ADD */
+	CPUFUNC(op_5028_5),	/* ADD */
+	CPUFUNC(op_5030_5),	/* ADD */
+	CPUFUNC(op_5038_5),	/* ADD */
+	CPUFUNC(op_5039_5),	/* ADD */
+	CPUFUNC(op_5040_5),	/* ADD */
+	CPUFUNC(op_5048_5),	/* ADDA */
+	CPUFUNC(op_5050_5),	/* ADD */
+	CPUFUNC(op_5058_5),	/* ADD */
+	CPUFUNC(op_5060_5),	/* ADD */
+	CPUFUNC(op_5068_5),	/* ADD */
+	CPUFUNC(op_5070_5),	/* ADD */
+	CPUFUNC(op_5078_5),	/* ADD */
+	CPUFUNC(op_5079_5),	/* ADD */
+	CPUFUNC(op_5080_5),	/* ADD */
+	CPUFUNC(op_5088_5),	/* ADDA */
+	CPUFUNC(op_5090_5),	/* ADD */
+	CPUFUNC(op_5098_5),	/* ADD */
+	CPUFUNC(op_50a0_5),	/* ADD */
+	CPUFUNC(op_50a8_5),	/* ADD */
+	CPUFUNC(op_50b0_5),	/* ADD */
+	CPUFUNC(op_50b8_5),	/* ADD */
+	CPUFUNC(op_50b9_5),	/* ADD */
+	CPUFUNC(op_50c0_5),	/* Scc */
+	CPUFUNC(op_50c8_5),	/* DBcc */
+	CPUFUNC(op_50d0_5),	/* Scc */
+	CPUFUNC(op_50d8_5),	/* Scc */
+	CPUFUNC(op_50e0_5),	/* Scc */
+	CPUFUNC(op_50e8_5),	/* Scc */
+	CPUFUNC(op_50f0_5),	/* Scc */
+	CPUFUNC(op_50f8_5),	/* Scc */
+	CPUFUNC(op_50f9_5),	/* Scc */
+	CPUFUNC(op_5100_5),	/* SUB */
+	CPUFUNC(op_5110_5),	/* SUB */
+	CPUFUNC(op_5118_5),	/* SUB */
+	CPUFUNC(op_5120_5),	/* SUB */
+	CPUFUNC(op_5128_5),	/* SUB */
+	CPUFUNC(op_5130_5),	/* SUB */
+	CPUFUNC(op_5138_5),	/* SUB */
+	CPUFUNC(op_5139_5),	/* SUB */
+	CPUFUNC(op_5140_5),	/* SUB */
+	CPUFUNC(op_5148_5),	/* SUBA */
+	CPUFUNC(op_5150_5),	/* SUB */
+	CPUFUNC(op_5158_5),	/* SUB */
+	CPUFUNC(op_5160_5),	/* SUB */
+	CPUFUNC(op_5168_5),	/* SUB */
+	CPUFUNC(op_5170_5),	/* SUB */
+	CPUFUNC(op_5178_5),	/* SUB */
+	CPUFUNC(op_5179_5),	/* SUB */
+	CPUFUNC(op_5180_5),	/* SUB */
+	CPUFUNC(op_5188_5),	/* SUBA */
+	CPUFUNC(op_5190_5),	/* SUB */
+	CPUFUNC(op_5198_5),	/* SUB */
+	CPUFUNC(op_51a0_5),	/* SUB */
+	CPUFUNC(op_51a8_5),	/* SUB */
+	CPUFUNC(op_51b0_5),	/* SUB */
+	CPUFUNC(op_51b8_5),	/* SUB */
+	CPUFUNC(op_51b9_5),	/* SUB */
+	CPUFUNC(op_51c0_5),	/* Scc */
+	CPUFUNC(op_51c8_5),	/* DBcc */
+	CPUFUNC(op_51d0_5),	/* Scc */
+	CPUFUNC(op_51d8_5),	/* Scc */
+	CPUFUNC(op_51e0_5),	/* Scc */
+	CPUFUNC(op_51e8_5),	/* Scc */
+	CPUFUNC(op_51f0_5),	/* Scc */
+	CPUFUNC(op_51f8_5),	/* Scc */
+	CPUFUNC(op_51f9_5),	/* Scc */
+	CPUFUNC(op_52c0_5),	/* Scc */
+	CPUFUNC(op_52c8_5),	/* DBcc */
+	CPUFUNC(op_52d0_5),	/* Scc */
+	CPUFUNC(op_52d8_5),	/* Scc */
+	CPUFUNC(op_52e0_5),	/* Scc */
+	CPUFUNC(op_52e8_5),	/* Scc */
+	CPUFUNC(op_52f0_5),	/* Scc */
+	CPUFUNC(op_52f8_5),	/* Scc */
+	CPUFUNC(op_52f9_5),	/* Scc */
+	CPUFUNC(op_53c0_5),	/* Scc */
+	CPUFUNC(op_53c8_5),	/* DBcc */
+	CPUFUNC(op_53d0_5),	/* Scc */
+	CPUFUNC(op_53d8_5),	/* Scc */
+	CPUFUNC(op_53e0_5),	/* Scc */
+	CPUFUNC(op_53e8_5),	/* Scc */
+	CPUFUNC(op_53f0_5),	/* Scc */
+	CPUFUNC(op_53f8_5),	/* Scc */
+	CPUFUNC(op_53f9_5),	/* Scc */
+	CPUFUNC(op_54c0_5),	/* Scc */
+	CPUFUNC(op_54c8_5),	/* DBcc */
+	CPUFUNC(op_54d0_5),	/* Scc */
+	CPUFUNC(op_54d8_5),	/* Scc */
+	CPUFUNC(op_54e0_5),	/* Scc */
+	CPUFUNC(op_54e8_5),	/* Scc */
+	CPUFUNC(op_54f0_5),	/* Scc */
+	CPUFUNC(op_54f8_5),	/* Scc */
+	CPUFUNC(op_54f9_5),	/* Scc */
+	CPUFUNC(op_55c0_5),	/* Scc */
+	CPUFUNC(op_55c8_5),	/* DBcc */
+	CPUFUNC(op_55d0_5),	/* Scc */
+	CPUFUNC(op_55d8_5),	/* Scc */
+	CPUFUNC(op_55e0_5),	/* Scc */
+	CPUFUNC(op_55e8_5),	/* Scc */
+	CPUFUNC(op_55f0_5),	/* Scc */
+	CPUFUNC(op_55f8_5),	/* Scc */
+	CPUFUNC(op_55f9_5),	/* Scc */
+	CPUFUNC(op_56c0_5),	/* Scc */
+	CPUFUNC(op_56c8_5),	/* DBcc */
+	CPUFUNC(op_56d0_5),	/* Scc */
+	CPUFUNC(op_56d8_5),	/* Scc */
+	CPUFUNC(op_56e0_5),	/* Scc */
+	CPUFUNC(op_56e8_5),	/* Scc */
+	CPUFUNC(op_56f0_5),	/* Scc */
+	CPUFUNC(op_56f8_5),	/* Scc */
+	CPUFUNC(op_56f9_5),	/* Scc */
+	CPUFUNC(op_57c0_5),	/* Scc */
+	CPUFUNC(op_57c8_5),	/* DBcc */
+	CPUFUNC(op_57d0_5),	/* Scc */
+	CPUFUNC(op_57d8_5),	/* Scc */
+	CPUFUNC(op_57e0_5),	/* Scc */
+	CPUFUNC(op_57e8_5),	/* Scc */
+	CPUFUNC(op_57f0_5),	/* Scc */
+	CPUFUNC(op_57f8_5),	/* Scc */
+	CPUFUNC(op_57f9_5),	/* Scc */
+	CPUFUNC(op_58c0_5),	/* Scc */
+	CPUFUNC(op_58c8_5),	/* DBcc */
+	CPUFUNC(op_58d0_5),	/* Scc */
+	CPUFUNC(op_58d8_5),	/* Scc */
+	CPUFUNC(op_58e0_5),	/* Scc */
+	CPUFUNC(op_58e8_5),	/* Scc */
+	CPUFUNC(op_58f0_5),	/* Scc */
+	CPUFUNC(op_58f8_5),	/* Scc */
+	CPUFUNC(op_58f9_5),	/* Scc */
+	CPUFUNC(op_59c0_5),	/* Scc */
+	CPUFUNC(op_59c8_5),	/* DBcc */
+	CPUFUNC(op_59d0_5),	/* Scc */
+	CPUFUNC(op_59d8_5),	/* Scc */
+	CPUFUNC(op_59e0_5),	/* Scc */
+	CPUFUNC(op_59e8_5),	/* Scc */
+	CPUFUNC(op_59f0_5),	/* Scc */
+	CPUFUNC(op_59f8_5),	/* Scc */
+	CPUFUNC(op_59f9_5),	/* Scc */
+	CPUFUNC(op_5ac0_5),	/* Scc */
+	CPUFUNC(op_5ac8_5),	/* DBcc */
+	CPUFUNC(op_5ad0_5),	/* Scc */
+	CPUFUNC(op_5ad8_5),	/* Scc */
+	CPUFUNC(op_5ae0_5),	/* Scc */
+	CPUFUNC(op_5ae8_5),	/* Scc */
+	CPUFUNC(op_5af0_5),	/* Scc */
+	CPUFUNC(op_5af8_5),	/* Scc */
+	CPUFUNC(op_5af9_5),	/* Scc */
+	CPUFUNC(op_5bc0_5),	/* Scc */
+	CPUFUNC(op_5bc8_5),	/* DBcc */
+	CPUFUNC(op_5bd0_5),	/* Scc */
+	CPUFUNC(op_5bd8_5),	/* Scc */
+	CPUFUNC(op_5be0_5),	/* Scc */
+	CPUFUNC(op_5be8_5),	/* Scc */
+	CPUFUNC(op_5bf0_5),	/* Scc */
+	CPUFUNC(op_5bf8_5),	/* Scc */
+	CPUFUNC(op_5bf9_5),	/* Scc */
+	CPUFUNC(op_5cc0_5),	/* Scc */
+	CPUFUNC(op_5cc8_5),	/* DBcc */
+	CPUFUNC(op_5cd0_5),	/* Scc */
+	CPUFUNC(op_5cd8_5),	/* Scc */
+	CPUFUNC(op_5ce0_5),	/* Scc */
+	CPUFUNC(op_5ce8_5),	/* Scc */
+	CPUFUNC(op_5cf0_5),	/* Scc */
+	CPUFUNC(op_5cf8_5),	/* Scc */
+	CPUFUNC(op_5cf9_5),	/* Scc */
+	CPUFUNC(op_5dc0_5),	/* Scc */
+	CPUFUNC(op_5dc8_5),	/* DBcc */
+	CPUFUNC(op_5dd0_5),	/* Scc */
+	CPUFUNC(op_5dd8_5),	/* Scc */
+	CPUFUNC(op_5de0_5),	/* Scc */
+	CPUFUNC(op_5de8_5),	/* Scc */
+	CPUFUNC(op_5df0_5),	/* Scc */
+	CPUFUNC(op_5df8_5),	/* Scc */
+	CPUFUNC(op_5df9_5),	/* Scc */
+	CPUFUNC(op_5ec0_5),	/* Scc */
+	CPUFUNC(op_5ec8_5),	/* DBcc */
+	CPUFUNC(op_5ed0_5),	/* Scc */
+	CPUFUNC(op_5ed8_5),	/* Scc */
+	CPUFUNC(op_5ee0_5),	/* Scc */
+	CPUFUNC(op_5ee8_5),	/* Scc */
+	CPUFUNC(op_5ef0_5),	/* Scc */
+	CPUFUNC(op_5ef8_5),	/* Scc */
+	CPUFUNC(op_5ef9_5),	/* Scc */
+	CPUFUNC(op_5fc0_5),	/* Scc */
+	CPUFUNC(op_5fc8_5),	/* DBcc */
+	CPUFUNC(op_5fd0_5),	/* Scc */
+	CPUFUNC(op_5fd8_5),	/* Scc */
+	CPUFUNC(op_5fe0_5),	/* Scc */
+	CPUFUNC(op_5fe8_5),	/* Scc */
+	CPUFUNC(op_5ff0_5),	/* Scc */
+	CPUFUNC(op_5ff8_5),	/* Scc */
+	CPUFUNC(op_5ff9_5),	/* Scc */
+	CPUFUNC(op_6000_5),	/* Bcc */
+	CPUFUNC(op_6001_5),	/* Bcc */
+	CPUFUNC(op_60ff_5),	/* Bcc */
+	CPUFUNC(op_6100_5),	/* BSR */
+	CPUFUNC(op_6101_5),	/* BSR */
+	CPUFUNC(op_61ff_5),	/* BSR */
+	CPUFUNC(op_6200_5),	/* Bcc */
+	CPUFUNC(op_6201_5),	/* Bcc */
+	CPUFUNC(op_62ff_5),	/* Bcc */
+	CPUFUNC(op_6300_5),	/* Bcc */
+	CPUFUNC(op_6301_5),	/* Bcc */
+	CPUFUNC(op_63ff_5),	/* Bcc */
+	CPUFUNC(op_6400_5),	/* Bcc */
+	CPUFUNC(op_6401_5),	/* Bcc */
+	CPUFUNC(op_64ff_5),	/* Bcc */
+	CPUFUNC(op_6500_5),	/* Bcc */
+	CPUFUNC(op_6501_5),	/* Bcc */
+	CPUFUNC(op_65ff_5),	/* Bcc */
+	CPUFUNC(op_6600_5),	/* Bcc */
+	CPUFUNC(op_6601_5),	/* Bcc */
+	CPUFUNC(op_66ff_5),	/* Bcc */
+	CPUFUNC(op_6700_5),	/* Bcc */
+	CPUFUNC(op_6701_5),	/* Bcc */
+	CPUFUNC(op_67ff_5),	/* Bcc */
+	CPUFUNC(op_6800_5),	/* Bcc */
+	CPUFUNC(op_6801_5),	/* Bcc */
+	CPUFUNC(op_68ff_5),	/* Bcc */
+	CPUFUNC(op_6900_5),	/* Bcc */
+	CPUFUNC(op_6901_5),	/* Bcc */
+	CPUFUNC(op_69ff_5),	/* Bcc */
+	CPUFUNC(op_6a00_5),	/* Bcc */
+	CPUFUNC(op_6a01_5),	/* Bcc */
+	CPUFUNC(op_6aff_5),	/* Bcc */
+	CPUFUNC(op_6b00_5),	/* Bcc */
+	CPUFUNC(op_6b01_5),	/* Bcc */
+	CPUFUNC(op_6bff_5),	/* Bcc */
+	CPUFUNC(op_6c00_5),	/* Bcc */
+	CPUFUNC(op_6c01_5),	/* Bcc */
+	CPUFUNC(op_6cff_5),	/* Bcc */
+	CPUFUNC(op_6d00_5),	/* Bcc */
+	CPUFUNC(op_6d01_5),	/* Bcc */
+	CPUFUNC(op_6dff_5),	/* Bcc */
+	CPUFUNC(op_6e00_5),	/* Bcc */
+	CPUFUNC(op_6e01_5),	/* Bcc */
+	CPUFUNC(op_6eff_5),	/* Bcc */
+	CPUFUNC(op_6f00_5),	/* Bcc */
+	CPUFUNC(op_6f01_5),	/* Bcc */
+	CPUFUNC(op_6fff_5),	/* Bcc */
+	CPUFUNC(op_7000_5),	/* MOVE */
+	CPUFUNC(op_8000_5),	/* OR */
+	CPUFUNC(op_8010_5),	/* OR */
+	CPUFUNC(op_8018_5),	/* OR */
+	CPUFUNC(op_8020_5),	/* OR */
+	CPUFUNC(op_8028_5),	/* OR */
+	CPUFUNC(op_8030_5),	/* OR */
+	CPUFUNC(op_8038_5),	/* OR */
+	CPUFUNC(op_8039_5),	/* OR */
+	CPUFUNC(op_803a_5),	/* OR */
+	CPUFUNC(op_803b_5),	/* OR */
+	CPUFUNC(op_803c_5),	/* OR */
+	CPUFUNC(op_8040_5),	/* OR */
+	CPUFUNC(op_8050_5),	/* OR */
+	CPUFUNC(op_8058_5),	/* OR */
+	CPUFUNC(op_8060_5),	/* OR */
+	CPUFUNC(op_8068_5),	/* OR */
+	CPUFUNC(op_8070_5),	/* OR */
+	CPUFUNC(op_8078_5),	/* OR */
+	CPUFUNC(op_8079_5),	/* OR */
+	CPUFUNC(op_807a_5),	/* OR */
+	CPUFUNC(op_807b_5),	/* OR */
+	CPUFUNC(op_807c_5),	/* OR */
+	CPUFUNC(op_8080_5),	/* OR */
+	CPUFUNC(op_8090_5),	/* OR */
+	CPUFUNC(op_8098_5),	/* OR */
+	CPUFUNC(op_80a0_5),	/* OR */
+	CPUFUNC(op_80a8_5),	/* OR */
+	CPUFUNC(op_80b0_5),	/* OR */
+	CPUFUNC(op_80b8_5),	/* OR */
+	CPUFUNC(op_80b9_5),	/* OR */
+	CPUFUNC(op_80ba_5),	/* OR */
+	CPUFUNC(op_80bb_5),	/* OR */
+	CPUFUNC(op_80bc_5),	/* OR */
+	CPUFUNC(op_80c0_5),	/* DIVU */
+	CPUFUNC(op_80d0_5),	/* DIVU */
+	CPUFUNC(op_80d8_5),	/* DIVU */
+	CPUFUNC(op_80e0_5),	/* DIVU */
+	CPUFUNC(op_80e8_5),	/* DIVU */
+	CPUFUNC(op_80f0_5),	/* DIVU */
+	CPUFUNC(op_80f8_5),	/* DIVU */
+	CPUFUNC(op_80f9_5),	/* DIVU */
+	CPUFUNC(op_80fa_5),	/* DIVU */
+	CPUFUNC(op_80fb_5),	/* DIVU */
+	CPUFUNC(op_80fc_5),	/* DIVU */
+	CPUFUNC(op_8100_5),	/* SBCD */
+	CPUFUNC(op_8108_5),	/* SBCD */
+	CPUFUNC(op_8110_5),	/* OR */
+	CPUFUNC(op_8118_5),	/* OR */
+	CPUFUNC(op_8120_5),	/* OR */
+	CPUFUNC(op_8128_5),	/* OR */
+	CPUFUNC(op_8130_5),	/* OR */
+	CPUFUNC(op_8138_5),	/* OR */
+	CPUFUNC(op_8139_5),	/* OR */
+	CPUFUNC(op_8150_5),	/* OR */
+	CPUFUNC(op_8158_5),	/* OR */
+	CPUFUNC(op_8160_5),	/* OR */
+	CPUFUNC(op_8168_5),	/* OR */
+	CPUFUNC(op_8170_5),	/* OR */
+	CPUFUNC(op_8178_5),	/* OR */
+	CPUFUNC(op_8179_5),	/* OR */
+	CPUFUNC(op_8190_5),	/* OR */
+	CPUFUNC(op_8198_5),	/* OR */
+	CPUFUNC(op_81a0_5),	/* OR */
+	CPUFUNC(op_81a8_5),	/* OR */
+	CPUFUNC(op_81b0_5),	/* OR */
+	CPUFUNC(op_81b8_5),	/* OR */
+	CPUFUNC(op_81b9_5),	/* OR */
+	CPUFUNC(op_81c0_5),	/* DIVS */
+	CPUFUNC(op_81d0_5),	/* DIVS */
+	CPUFUNC(op_81d8_5),	/* DIVS */
+	CPUFUNC(op_81e0_5),	/* DIVS */
+	CPUFUNC(op_81e8_5),	/* DIVS */
+	CPUFUNC(op_81f0_5),	/* DIVS */
+	CPUFUNC(op_81f8_5),	/* DIVS */
+	CPUFUNC(op_81f9_5),	/* DIVS */
+	CPUFUNC(op_81fa_5),	/* DIVS */
+	CPUFUNC(op_81fb_5),	/* DIVS */
+	CPUFUNC(op_81fc_5),	/* DIVS */
+	CPUFUNC(op_9000_5),	/* SUB */
+	CPUFUNC(op_9010_5),	/* SUB */
+	CPUFUNC(op_9018_5),	/* SUB */
+	CPUFUNC(op_9020_5),	/* SUB */
+	CPUFUNC(op_9028_5),	/* SUB */
+	CPUFUNC(op_9030_5),	/* SUB */
+	CPUFUNC(op_9038_5),	/* SUB */
+	CPUFUNC(op_9039_5),	/* SUB */
+	CPUFUNC(op_903a_5),	/* SUB */
+	CPUFUNC(op_903b_5),	/* SUB */
+	CPUFUNC(op_903c_5),	/* SUB */
+	CPUFUNC(op_9040_5),	/* SUB */
+	CPUFUNC(op_9048_5),	/* SUB */
+	CPUFUNC(op_9050_5),	/* SUB */
+	CPUFUNC(op_9058_5),	/* SUB */
+	CPUFUNC(op_9060_5),	/* SUB */
+	CPUFUNC(op_9068_5),	/* SUB */
+	CPUFUNC(op_9070_5),	/* SUB */
+	CPUFUNC(op_9078_5),	/* SUB */
+	CPUFUNC(op_9079_5),	/* SUB */
+	CPUFUNC(op_907a_5),	/* SUB */
+	CPUFUNC(op_907b_5),	/* SUB */
+	CPUFUNC(op_907c_5),	/* SUB */
+	CPUFUNC(op_9080_5),	/* SUB */
+	CPUFUNC(op_9088_5),	/* SUB */
+	CPUFUNC(op_9090_5),	/* SUB */
+	CPUFUNC(op_9098_5),	/* SUB */
+	CPUFUNC(op_90a0_5),	/* SUB */
+	CPUFUNC(op_90a8_5),	/* SUB */
+	CPUFUNC(op_90b0_5),	/* SUB */
+	CPUFUNC(op_90b8_5),	/* SUB */
+	CPUFUNC(op_90b9_5),	/* SUB */
+	CPUFUNC(op_90ba_5),	/* SUB */
+	CPUFUNC(op_90bb_5),	/* SUB */
+	CPUFUNC(op_90bc_5),	/* SUB */
+	CPUFUNC(op_90c0_5),	/* SUBA */
+	CPUFUNC(op_90c8_5),	/* SUBA */
+	CPUFUNC(op_90d0_5),	/* SUBA */
+	CPUFUNC(op_90d8_5),	/* SUBA */
+	CPUFUNC(op_90e0_5),	/* SUBA */
+	CPUFUNC(op_90e8_5),	/* SUBA */
+	CPUFUNC(op_90f0_5),	/* SUBA */
+	CPUFUNC(op_90f8_5),	/* SUBA */
+	CPUFUNC(op_90f9_5),	/* SUBA */
+	CPUFUNC(op_90fa_5),	/* SUBA */
+	CPUFUNC(op_90fb_5),	/* SUBA */
+	CPUFUNC(op_90fc_5),	/* SUBA */
+	CPUFUNC(op_9100_5),	/* SUBX */
+	CPUFUNC(op_9108_5),	/* SUBX */
+	CPUFUNC(op_9110_5),	/* SUB */
+	CPUFUNC(op_9118_5),	/* SUB */
+	CPUFUNC(op_9120_5),	/* SUB */
+	CPUFUNC(op_9128_5),	/* SUB */
+	CPUFUNC(op_9130_5),	/* SUB */
+	CPUFUNC(op_9138_5),	/* SUB */
+	CPUFUNC(op_9139_5),	/* SUB */
+	CPUFUNC(op_9140_5),	/* SUBX */
+	CPUFUNC(op_9148_5),	/* SUBX */
+	CPUFUNC(op_9150_5),	/* SUB */
+	CPUFUNC(op_9158_5),	/* SUB */
+	CPUFUNC(op_9160_5),	/* SUB */
+	CPUFUNC(op_9168_5),	/* SUB */
+	CPUFUNC(op_9170_5),	/* SUB */
+	CPUFUNC(op_9178_5),	/* SUB */
+	CPUFUNC(op_9179_5),	/* SUB */
+	CPUFUNC(op_9180_5),	/* SUBX */
+	CPUFUNC(op_9188_5),	/* SUBX */
+	CPUFUNC(op_9190_5),	/* SUB */
+	CPUFUNC(op_9198_5),	/* SUB */
+	CPUFUNC(op_91a0_5),	/* SUB */
+	CPUFUNC(op_91a8_5),	/* SUB */
+	CPUFUNC(op_91b0_5),	/* SUB */
+	CPUFUNC(op_91b8_5),	/* SUB */
+	CPUFUNC(op_91b9_5),	/* SUB */
+	CPUFUNC(op_91c0_5),	/* SUBA */
+	CPUFUNC(op_91c8_5),	/* SUBA */
+	CPUFUNC(op_91d0_5),	/* SUBA */
+	CPUFUNC(op_91d8_5),	/* SUBA */
+	CPUFUNC(op_91e0_5),	/* SUBA */
+	CPUFUNC(op_91e8_5),	/* SUBA */
+	CPUFUNC(op_91f0_5),	/* SUBA */
+	CPUFUNC(op_91f8_5),	/* SUBA */
+	CPUFUNC(op_91f9_5),	/* SUBA */
+	CPUFUNC(op_91fa_5),	/* SUBA */
+	CPUFUNC(op_91fb_5),	/* SUBA */
+	CPUFUNC(op_91fc_5),	/* SUBA */
+	CPUFUNC(op_b000_5),	/* CMP */
+	CPUFUNC(op_b010_5),	/* CMP */
+	CPUFUNC(op_b018_5),	/* CMP */
+	CPUFUNC(op_b020_5),	/* CMP */
+	CPUFUNC(op_b028_5),	/* CMP */
+	CPUFUNC(op_b030_5),	/* CMP */
+	CPUFUNC(op_b038_5),	/* CMP */
+	CPUFUNC(op_b039_5),	/* CMP */
+	CPUFUNC(op_b03a_5),	/* CMP */
+	CPUFUNC(op_b03b_5),	/* CMP */
+	CPUFUNC(op_b03c_5),	/* CMP */
+	CPUFUNC(op_b040_5),	/* CMP */
+	CPUFUNC(op_b048_5),	/* CMP */
+	CPUFUNC(op_b050_5),	/* CMP */
+	CPUFUNC(op_b058_5),	/* CMP */
+	CPUFUNC(op_b060_5),	/* CMP */
+	CPUFUNC(op_b068_5),	/* CMP */
+	CPUFUNC(op_b070_5),	/* CMP */
+	CPUFUNC(op_b078_5),	/* CMP */
+	CPUFUNC(op_b079_5),	/* CMP */
+	CPUFUNC(op_b07a_5),	/* CMP */
+	CPUFUNC(op_b07b_5),	/* CMP */
+	CPUFUNC(op_b07c_5),	/* CMP */
+	CPUFUNC(op_b080_5),	/* CMP */
+	CPUFUNC(op_b088_5),	/* CMP */
+	CPUFUNC(op_b090_5),	/* CMP */
+	CPUFUNC(op_b098_5),	/* CMP */
+	CPUFUNC(op_b0a0_5),	/* CMP */
+	CPUFUNC(op_b0a8_5),	/* CMP */
+	CPUFUNC(op_b0b0_5),	/* CMP */
+	CPUFUNC(op_b0b8_5),	/* CMP */
+	CPUFUNC(op_b0b9_5),	/* CMP */
+	CPUFUNC(op_b0ba_5),	/* CMP */
+	CPUFUNC(op_b0bb_5),	/* CMP */
+	CPUFUNC(op_b0bc_5),	/* CMP */
+	CPUFUNC(op_b0c0_5),	/* CMPA */
+	CPUFUNC(op_b0c8_5),	/* CMPA */
+	CPUFUNC(op_b0d0_5),	/* CMPA */
+	CPUFUNC(op_b0d8_5),	/* CMPA */
+	CPUFUNC(op_b0e0_5),	/* CMPA */
+	CPUFUNC(op_b0e8_5),	/* CMPA */
+	CPUFUNC(op_b0f0_5),	/* CMPA */
+	CPUFUNC(op_b0f8_5),	/* CMPA */
+	CPUFUNC(op_b0f9_5),	/* CMPA */
+	CPUFUNC(op_b0fa_5),	/* CMPA */
+	CPUFUNC(op_b0fb_5),	/* CMPA */
+	CPUFUNC(op_b0fc_5),	/* CMPA */
+	CPUFUNC(op_b100_5),	/* EOR */
+	CPUFUNC(op_b108_5),	/* CMPM */
+	CPUFUNC(op_b110_5),	/* EOR */
+	CPUFUNC(op_b118_5),	/* EOR */
+	CPUFUNC(op_b120_5),	/* EOR */
+	CPUFUNC(op_b128_5),	/* EOR */
+	CPUFUNC(op_b130_5),	/* EOR */
+	CPUFUNC(op_b138_5),	/* EOR */
+	CPUFUNC(op_b139_5),	/* EOR */
+	CPUFUNC(op_b140_5),	/* EOR */
+	CPUFUNC(op_b148_5),	/* CMPM */
+	CPUFUNC(op_b150_5),	/* EOR */
+	CPUFUNC(op_b158_5),	/* EOR */
+	CPUFUNC(op_b160_5),	/* EOR */
+	CPUFUNC(op_b168_5),	/* EOR */
+	CPUFUNC(op_b170_5),	/* EOR */
+	CPUFUNC(op_b178_5),	/* EOR */
+	CPUFUNC(op_b179_5),	/* EOR */
+	CPUFUNC(op_b180_5),	/* EOR */
+	CPUFUNC(op_b188_5),	/* CMPM */
+	CPUFUNC(op_b190_5),	/* EOR */
+	CPUFUNC(op_b198_5),	/* EOR */
+	CPUFUNC(op_b1a0_5),	/* EOR */
+	CPUFUNC(op_b1a8_5),	/* EOR */
+	CPUFUNC(op_b1b0_5),	/* EOR */
+	CPUFUNC(op_b1b8_5),	/* EOR */
+	CPUFUNC(op_b1b9_5),	/* EOR */
+	CPUFUNC(op_b1c0_5),	/* CMPA */
+	CPUFUNC(op_b1c8_5),	/* CMPA */
+	CPUFUNC(op_b1d0_5),	/* CMPA */
+	CPUFUNC(op_b1d8_5),	/* CMPA */
+	CPUFUNC(op_b1e0_5),	/* CMPA */
+	CPUFUNC(op_b1e8_5),	/* CMPA */
+	CPUFUNC(op_b1f0_5),	/* CMPA */
+	CPUFUNC(op_b1f8_5),	/* CMPA */
+	CPUFUNC(op_b1f9_5),	/* CMPA */
+	CPUFUNC(op_b1fa_5),	/* CMPA */
+	CPUFUNC(op_b1fb_5),	/* CMPA */
+	CPUFUNC(op_b1fc_5),	/* CMPA */
+	CPUFUNC(op_c000_5),	/* AND */
+	CPUFUNC(op_c010_5),	/* AND */
+	CPUFUNC(op_c018_5),	/* AND */
+	CPUFUNC(op_c020_5),	/* AND */
+	CPUFUNC(op_c028_5),	/* AND */
+	CPUFUNC(op_c030_5),	/* AND */
+	CPUFUNC(op_c038_5),	/* AND */
+	CPUFUNC(op_c039_5),	/* AND */
+	CPUFUNC(op_c03a_5),	/* AND */
+	CPUFUNC(op_c03b_5),	/* AND */
+	CPUFUNC(op_c03c_5),	/* AND */
+	CPUFUNC(op_c040_5),	/* AND */
+	CPUFUNC(op_c050_5),	/* AND */
+	CPUFUNC(op_c058_5),	/* AND */
+	CPUFUNC(op_c060_5),	/* AND */
+	CPUFUNC(op_c068_5),	/* AND */
+	CPUFUNC(op_c070_5),	/* AND */
+	CPUFUNC(op_c078_5),	/* AND */
+	CPUFUNC(op_c079_5),	/* AND */
+	CPUFUNC(op_c07a_5),	/* AND */
+	CPUFUNC(op_c07b_5),	/* AND */
+	CPUFUNC(op_c07c_5),	/* AND */
+	CPUFUNC(op_c080_5),	/* AND */
+	CPUFUNC(op_c090_5),	/* AND */
+	CPUFUNC(op_c098_5),	/* AND */
+	CPUFUNC(op_c0a0_5),	/* AND */
+	CPUFUNC(op_c0a8_5),	/* AND */
+	CPUFUNC(op_c0b0_5),	/* AND */
+	CPUFUNC(op_c0b8_5),	/* AND */
+	CPUFUNC(op_c0b9_5),	/* AND */
+	CPUFUNC(op_c0ba_5),	/* AND */
+	CPUFUNC(op_c0bb_5),	/* AND */
+	CPUFUNC(op_c0bc_5),	/* AND */
+	CPUFUNC(op_c0c0_5),	/* MULU */
+	CPUFUNC(op_c0d0_5),	/* MULU */
+	CPUFUNC(op_c0d8_5),	/* MULU */
+	CPUFUNC(op_c0e0_5),	/* MULU */
+	CPUFUNC(op_c0e8_5),	/* MULU */
+	CPUFUNC(op_c0f0_5),	/* MULU */
+	CPUFUNC(op_c0f8_5),	/* MULU */
+	CPUFUNC(op_c0f9_5),	/* MULU */
+	CPUFUNC(op_c0fa_5),	/* MULU */
+	CPUFUNC(op_c0fb_5),	/* MULU */
+	CPUFUNC(op_c0fc_5),	/* MULU */
+	CPUFUNC(op_c100_5),	/* ABCD */
+	CPUFUNC(op_c108_5),	/* ABCD */
+	CPUFUNC(op_c110_5),	/* AND */
+	CPUFUNC(op_c118_5),	/* AND */
+	CPUFUNC(op_c120_5),	/* AND */
+	CPUFUNC(op_c128_5),	/* AND */
+	CPUFUNC(op_c130_5),	/* AND */
+	CPUFUNC(op_c138_5),	/* AND */
+	CPUFUNC(op_c139_5),	/* AND */
+	CPUFUNC(op_c140_5),	/* EXG */
+	CPUFUNC(op_c148_5),	/* EXG */
+	CPUFUNC(op_c150_5),	/* AND */
+	CPUFUNC(op_c158_5),	/* AND */
+	CPUFUNC(op_c160_5),	/* AND */
+	CPUFUNC(op_c168_5),	/* AND */
+	CPUFUNC(op_c170_5),	/* AND */
+	CPUFUNC(op_c178_5),	/* AND */
+	CPUFUNC(op_c179_5),	/* AND */
+	CPUFUNC(op_c188_5),	/* EXG */
+	CPUFUNC(op_c190_5),	/* AND */
+	CPUFUNC(op_c198_5),	/* AND */
+	CPUFUNC(op_c1a0_5),	/* AND */
+	CPUFUNC(op_c1a8_5),	/* AND */
+	CPUFUNC(op_c1b0_5),	/* AND */
+	CPUFUNC(op_c1b8_5),	/* AND */
+	CPUFUNC(op_c1b9_5),	/* AND */
+	CPUFUNC(op_c1c0_5),	/* MULS */
+	CPUFUNC(op_c1d0_5),	/* MULS */
+	CPUFUNC(op_c1d8_5),	/* MULS */
+	CPUFUNC(op_c1e0_5),	/* MULS */
+	CPUFUNC(op_c1e8_5),	/* MULS */
+	CPUFUNC(op_c1f0_5),	/* MULS */
+	CPUFUNC(op_c1f8_5),	/* MULS */
+	CPUFUNC(op_c1f9_5),	/* MULS */
+	CPUFUNC(op_c1fa_5),	/* MULS */
+	CPUFUNC(op_c1fb_5),	/* MULS */
+	CPUFUNC(op_c1fc_5),	/* MULS */
+	CPUFUNC(op_d000_5),	/* ADD */
+	CPUFUNC(op_d010_5),	/* ADD */
+	CPUFUNC(op_d018_5),	/* ADD */
+	CPUFUNC(op_d020_5),	/* ADD */
+	CPUFUNC(op_d028_5),	/* ADD */
+	CPUFUNC(op_d030_5),	/* ADD */
+	CPUFUNC(op_d038_5),	/* ADD */
+	CPUFUNC(op_d039_5),	/* ADD */
+	CPUFUNC(op_d03a_5),	/* ADD */
+	CPUFUNC(op_d03b_5),	/* ADD */
+	CPUFUNC(op_d03c_5),	/* ADD */
+	CPUFUNC(op_d040_5),	/* ADD */
+	CPUFUNC(op_d048_5),	/* ADD */
+	CPUFUNC(op_d050_5),	/* ADD */
+	CPUFUNC(op_d058_5),	/* ADD */
+	CPUFUNC(op_d060_5),	/* ADD */
+	CPUFUNC(op_d068_5),	/* ADD */
+	CPUFUNC(op_d070_5),	/* ADD */
+	CPUFUNC(op_d078_5),	/* ADD */
+	CPUFUNC(op_d079_5),	/* ADD */
+	CPUFUNC(op_d07a_5),	/* ADD */
+	CPUFUNC(op_d07b_5),	/* ADD */
+	CPUFUNC(op_d07c_5),	/* ADD */
+	CPUFUNC(op_d080_5),	/* ADD */
+	CPUFUNC(op_d088_5),	/* ADD */
+	CPUFUNC(op_d090_5),	/* ADD */
+	CPUFUNC(op_d098_5),	/* ADD */
+	CPUFUNC(op_d0a0_5),	/* ADD */
+	CPUFUNC(op_d0a8_5),	/* ADD */
+	CPUFUNC(op_d0b0_5),	/* ADD */
+	CPUFUNC(op_d0b8_5),	/* ADD */
+	CPUFUNC(op_d0b9_5),	/* ADD */
+	CPUFUNC(op_d0ba_5),	/* ADD */
+	CPUFUNC(op_d0bb_5),	/* ADD */
+	CPUFUNC(op_d0bc_5),	/* ADD */
+	CPUFUNC(op_d0c0_5),	/* ADDA */
+	CPUFUNC(op_d0c8_5),	/* ADDA */
+	CPUFUNC(op_d0d0_5),	/* ADDA */
+	CPUFUNC(op_d0d8_5),	/* ADDA */
+	CPUFUNC(op_d0e0_5),	/* ADDA */
+	CPUFUNC(op_d0e8_5),	/* ADDA */
+	CPUFUNC(op_d0f0_5),	/* ADDA */
+	CPUFUNC(op_d0f8_5),	/* ADDA */
+	CPUFUNC(op_d0f9_5),	/* ADDA */
+	CPUFUNC(op_d0fa_5),	/* ADDA */
+	CPUFUNC(op_d0fb_5),	/* ADDA */
+	CPUFUNC(op_d0fc_5),	/* ADDA */
+	CPUFUNC(op_d100_5),	/* ADDX */
+	CPUFUNC(op_d108_5),	/* ADDX */
+	CPUFUNC(op_d110_5),	/* ADD */
+	CPUFUNC(op_d118_5),	/* ADD */
+	CPUFUNC(op_d120_5),	/* ADD */
+	CPUFUNC(op_d128_5),	/* ADD */
+	CPUFUNC(op_d130_5),	/* ADD */
+	CPUFUNC(op_d138_5),	/* ADD */
+	CPUFUNC(op_d139_5),	/* ADD */
+	CPUFUNC(op_d140_5),	/* ADDX */
+	CPUFUNC(op_d148_5),	/* ADDX */
+	CPUFUNC(op_d150_5),	/* ADD */
+	CPUFUNC(op_d158_5),	/* ADD */
+	CPUFUNC(op_d160_5),	/* ADD */
+	CPUFUNC(op_d168_5),	/* ADD */
+	CPUFUNC(op_d170_5),	/* ADD */
+	CPUFUNC(op_d178_5),	/* ADD */
+	CPUFUNC(op_d179_5),	/* ADD */
+	CPUFUNC(op_d180_5),	/* ADDX */
+	CPUFUNC(op_d188_5),	/* ADDX */
+	CPUFUNC(op_d190_5),	/* ADD */
+	CPUFUNC(op_d198_5),	/* ADD */
+	CPUFUNC(op_d1a0_5),	/* ADD */
+	CPUFUNC(op_d1a8_5),	/* ADD */
+	CPUFUNC(op_d1b0_5),	/* ADD */
+	CPUFUNC(op_d1b8_5),	/* ADD */
+	CPUFUNC(op_d1b9_5),	/* ADD */
+	CPUFUNC(op_d1c0_5),	/* ADDA */
+	CPUFUNC(op_d1c8_5),	/* ADDA */
+	CPUFUNC(op_d1d0_5),	/* ADDA */
+	CPUFUNC(op_d1d8_5),	/* ADDA */
+	CPUFUNC(op_d1e0_5),	/* ADDA */
+	CPUFUNC(op_d1e8_5),	/* ADDA */
+	CPUFUNC(op_d1f0_5),	/* ADDA */
+	CPUFUNC(op_d1f8_5),	/* ADDA */
+	CPUFUNC(op_d1f9_5),	/* ADDA */
+	CPUFUNC(op_d1fa_5),	/* ADDA */
+	CPUFUNC(op_d1fb_5),	/* ADDA */
+	CPUFUNC(op_d1fc_5),	/* ADDA */
+	CPUFUNC(op_e000_5),	/* ASR */
+	CPUFUNC(op_e008_5),	/* LSR */
+	CPUFUNC(op_e010_5),	/* ROXR */
+	CPUFUNC(op_e018_5),	/* ROR */
+	CPUFUNC(op_e020_5),	/* ASR */
+	CPUFUNC(op_e028_5),	/* LSR */
+	CPUFUNC(op_e030_5),	/* ROXR */
+	CPUFUNC(op_e038_5),	/* ROR */
+	CPUFUNC(op_e040_5),	/* ASR */
+	CPUFUNC(op_e048_5),	/* LSR */
+	CPUFUNC(op_e050_5),	/* ROXR */
+	CPUFUNC(op_e058_5),	/* ROR */
+	CPUFUNC(op_e060_5),	/* ASR */
+	CPUFUNC(op_e068_5),	/* LSR */
+	CPUFUNC(op_e070_5),	/* ROXR */
+	CPUFUNC(op_e078_5),	/* ROR */
+	CPUFUNC(op_e080_5),	/* ASR */
+	CPUFUNC(op_e088_5),	/* LSR */
+	CPUFUNC(op_e090_5),	/* ROXR */
+	CPUFUNC(op_e098_5),	/* ROR */
+	CPUFUNC(op_e0a0_5),	/* ASR */
+	CPUFUNC(op_e0a8_5),	/* LSR */
+	CPUFUNC(op_e0b0_5),	/* ROXR */
+	CPUFUNC(op_e0b8_5),	/* ROR */
+	CPUFUNC(op_e0d0_5),	/* ASRW */
+	CPUFUNC(op_e0d8_5),	/* ASRW */
+	CPUFUNC(op_e0e0_5),	/* ASRW */
+	CPUFUNC(op_e0e8_5),	/* ASRW */
+	CPUFUNC(op_e0f0_5),	/* ASRW */
+	CPUFUNC(op_e0f8_5),	/* ASRW */
+	CPUFUNC(op_e0f9_5),	/* ASRW */
+	CPUFUNC(op_e100_5),	/* ASL */
+	CPUFUNC(op_e108_5),	/* LSL */
+	CPUFUNC(op_e110_5),	/* ROXL */
+	CPUFUNC(op_e118_5),	/* ROL */
+	CPUFUNC(op_e120_5),	/* ASL */
+	CPUFUNC(op_e128_5),	/* LSL */
+	CPUFUNC(op_e130_5),	/* ROXL */
+	CPUFUNC(op_e138_5),	/* ROL */
+	CPUFUNC(op_e140_5),	/* ASL */
+	CPUFUNC(op_e148_5),	/* LSL */
+	CPUFUNC(op_e150_5),	/* ROXL */
+	CPUFUNC(op_e158_5),	/* ROL */
+	CPUFUNC(op_e160_5),	/* ASL */
+	CPUFUNC(op_e168_5),	/* LSL */
+	CPUFUNC(op_e170_5),	/* ROXL */
+	CPUFUNC(op_e178_5),	/* ROL */
+	CPUFUNC(op_e180_5),	/* ASL */
+	CPUFUNC(op_e188_5),	/* LSL */
+	CPUFUNC(op_e190_5),	/* ROXL */
+	CPUFUNC(op_e198_5),	/* ROL */
+	CPUFUNC(op_e1a0_5),	/* ASL */
+	CPUFUNC(op_e1a8_5),	/* LSL */
+	CPUFUNC(op_e1b0_5),	/* ROXL */
+	CPUFUNC(op_e1b8_5),	/* ROL */
+	CPUFUNC(op_e1d0_5),	/* ASLW */
+	CPUFUNC(op_e1d8_5),	/* ASLW */
+	CPUFUNC(op_e1e0_5),	/* ASLW */
+	CPUFUNC(op_e1e8_5),	/* ASLW */
+	CPUFUNC(op_e1f0_5),	/* ASLW */
+	CPUFUNC(op_e1f8_5),	/* ASLW */
+	CPUFUNC(op_e1f9_5),	/* ASLW */
+	CPUFUNC(op_e2d0_5),	/* LSRW */
+	CPUFUNC(op_e2d8_5),	/* LSRW */
+	CPUFUNC(op_e2e0_5),	/* LSRW */
+	CPUFUNC(op_e2e8_5),	/* LSRW */
+	CPUFUNC(op_e2f0_5),	/* LSRW */
+	CPUFUNC(op_e2f8_5),	/* LSRW */
+	CPUFUNC(op_e2f9_5),	/* LSRW */
+	CPUFUNC(op_e3d0_5),	/* LSLW */
+	CPUFUNC(op_e3d8_5),	/* LSLW */
+	CPUFUNC(op_e3e0_5),	/* LSLW */
+	CPUFUNC(op_e3e8_5),	/* LSLW */
+	CPUFUNC(op_e3f0_5),	/* LSLW */
+	CPUFUNC(op_e3f8_5),	/* LSLW */
+	CPUFUNC(op_e3f9_5),	/* LSLW */
+	CPUFUNC(op_e4d0_5),	/* ROXRW */
+	CPUFUNC(op_e4d8_5),	/* ROXRW */
+	CPUFUNC(op_e4e0_5),	/* ROXRW */
+	CPUFUNC(op_e4e8_5),	/* ROXRW */
+	CPUFUNC(op_e4f0_5),	/* ROXRW */
+	CPUFUNC(op_e4f8_5),	/* ROXRW */
+	CPUFUNC(op_e4f9_5),	/* ROXRW */
+	CPUFUNC(op_e5d0_5),	/* ROXLW */
+	CPUFUNC(op_e5d8_5),	/* ROXLW */
+	CPUFUNC(op_e5e0_5),	/* ROXLW */
+	CPUFUNC(op_e5e8_5),	/* ROXLW */
+	CPUFUNC(op_e5f0_5),	/* ROXLW */
+	CPUFUNC(op_e5f8_5),	/* ROXLW */
+	CPUFUNC(op_e5f9_5),	/* ROXLW */
+	CPUFUNC(op_e6d0_5),	/* RORW */
+	CPUFUNC(op_e6d8_5),	/* RORW */
+	CPUFUNC(op_e6e0_5),	/* RORW */
+	CPUFUNC(op_e6e8_5),	/* RORW */
+	CPUFUNC(op_e6f0_5),	/* RORW */
+	CPUFUNC(op_e6f8_5),	/* RORW */
+	CPUFUNC(op_e6f9_5),	/* RORW */
+	CPUFUNC(op_e7d0_5),	/* ROLW */
+	CPUFUNC(op_e7d8_5),	/* ROLW */
+	CPUFUNC(op_e7e0_5),	/* ROLW */
+	CPUFUNC(op_e7e8_5),	/* ROLW */
+	CPUFUNC(op_e7f0_5),	/* ROLW */
+	CPUFUNC(op_e7f8_5),	/* ROLW */
+	CPUFUNC(op_e7f9_5),	/* ROLW */
+};
+
+// Which handler each opcode goes to (0 is IllegalOpcode)
+const uint16_t cpuOpcodeIndex[65536] = {
+	1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5,
+	6, 6, 6, 6, 6, 6, 6, 6, 7, 8, 0, 0, 9, 0, 0, 0,
+	10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+	11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12,
+	13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14,
+	15, 15, 15, 15, 15, 15, 15, 15, 16, 17, 0, 0, 18, 0, 0, 0,
+	19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 0, 0,
+	20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21,
+	22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23,
+	24, 24, 24, 24, 24, 24, 24, 24, 25, 26, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28,
+	29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30,
+	31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+	33, 33, 33, 33, 33, 33, 33, 33, 34, 35, 36, 37, 38, 0, 0, 0,
+	39, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 40,
+	41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 42, 42,
+	43, 43, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44,
+	45, 45, 45, 45, 45, 45, 45, 45, 46, 47, 48, 49, 0, 0, 0, 0,
+	50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51,
+	52, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53,
+	54, 54, 54, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55,
+	56, 56, 56, 56, 56, 56, 56, 56, 57, 58, 59, 60, 0, 0, 0, 0,
+	61, 61, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 62, 62, 62,
+	63, 63, 63, 63, 63, 63, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64,
+	65, 65, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66, 66, 66,
+	67, 67, 67, 67, 67, 67, 67, 67, 68, 69, 70, 71, 0, 0, 0, 0,
+	72, 72, 72, 72, 72, 72, 72, 72, 0, 0, 0, 0, 0, 0, 0, 0,
+	73, 73, 73, 73, 73, 73, 73, 73, 74, 74, 74, 74, 74, 74, 74, 74,
+	75, 75, 75, 75, 75, 75, 75, 75, 76, 76, 76, 76, 76, 76, 76, 76,
+	77, 77, 77, 77, 77, 77, 77, 77, 78, 79, 0, 0, 80, 0, 0, 0,
+	81, 81, 81, 81, 81, 81, 81, 81, 0, 0, 0, 0, 0, 0, 0, 0,
+	82, 82, 82, 82, 82, 82, 82, 82, 83, 83, 83, 83, 83, 83, 83, 83,
+	84, 84, 84, 84, 84, 84, 84, 84, 85, 85, 85, 85, 85, 85, 85, 85,
+	86, 86, 86, 86, 86, 86, 86, 86, 87, 88, 0, 0, 89, 0, 0, 0,
+	90, 90, 90, 90, 90, 90, 90, 90, 0, 0, 0, 0, 0, 0, 0, 0,
+	91, 91, 91, 91, 91, 91, 91, 91, 92, 92, 92, 92, 92, 92, 92, 92,
+	93, 93, 93, 93, 93, 93, 93, 93, 94, 94, 94, 94, 94, 94, 94, 94,
+	95, 95, 95, 95, 95, 95, 95, 95, 96, 97, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28,
+	29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30,
+	31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+	33, 33, 33, 33, 33, 33, 33, 33, 34, 35, 36, 37, 38, 0, 0, 0,
+	39, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 40,
+	41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 42, 42,
+	43, 43, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44,
+	45, 45, 45, 45, 45, 45, 45, 45, 46, 47, 48, 49, 0, 0, 0, 0,
+	50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51,
+	52, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53,
+	54, 54, 54, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55,
+	56, 56, 56, 56, 56, 56, 56, 56, 57, 58, 59, 60, 0, 0, 0, 0,
+	61, 61, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 62, 62, 62,
+	63, 63, 63, 63, 63, 63, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64,
+	65, 65, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66, 66, 66,
+	67, 67, 67, 67, 67, 67, 67, 67, 68, 69, 70, 71, 0, 0, 0, 0,
+	98, 98, 98, 98, 98, 98, 98, 98, 0, 0, 0, 0, 0, 0, 0, 0,
+	99, 99, 99, 99, 99, 99, 99, 99, 100, 100, 100, 100, 100, 100, 100, 100,
+	101, 101, 101, 101, 101, 101, 101, 101, 102, 102, 102, 102, 102, 102, 102, 102,
+	103, 103, 103, 103, 103, 103, 103, 103, 104, 105, 0, 0, 0, 0, 0, 0,
+	106, 106, 106, 106, 106, 106, 106, 106, 0, 0, 0, 0, 0, 0, 0, 0,
+	107, 107, 107, 107, 107, 107, 107, 107, 108, 108, 108, 108, 108, 108, 108, 108,
+	109, 109, 109, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 110, 110, 110,
+	111, 111, 111, 111, 111, 111, 111, 111, 112, 113, 0, 0, 0, 0, 0, 0,
+	114, 114, 114, 114, 114, 114, 114, 114, 0, 0, 0, 0, 0, 0, 0, 0,
+	115, 115, 115, 115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 116, 116, 116,
+	117, 117, 117, 117, 117, 117, 117, 117, 118, 118, 118, 118, 118, 118, 118, 118,
+	119, 119, 119, 119, 119, 119, 119, 119, 120, 121, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28,
+	29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30,
+	31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+	33, 33, 33, 33, 33, 33, 33, 33, 34, 35, 36, 37, 38, 0, 0, 0,
+	39, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 40,
+	41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 42, 42,
+	43, 43, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44,
+	45, 45, 45, 45, 45, 45, 45, 45, 46, 47, 48, 49, 0, 0, 0, 0,
+	50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51,
+	52, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53,
+	54, 54, 54, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55,
+	56, 56, 56, 56, 56, 56, 56, 56, 57, 58, 59, 60, 0, 0, 0, 0,
+	61, 61, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 62, 62, 62,
+	63, 63, 63, 63, 63, 63, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64,
+	65, 65, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66, 66, 66,
+	67, 67, 67, 67, 67, 67, 67, 67, 68, 69, 70, 71, 0, 0, 0, 0,
+	122, 122, 122, 122, 122, 122, 122, 122, 0, 0, 0, 0, 0, 0, 0, 0,
+	123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124,
+	125, 125, 125, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126,
+	127, 127, 127, 127, 127, 127, 127, 127, 128, 129, 0, 0, 0, 0, 0, 0,
+	130, 130, 130, 130, 130, 130, 130, 130, 0, 0, 0, 0, 0, 0, 0, 0,
+	131, 131, 131, 131, 131, 131, 131, 131, 132, 132, 132, 132, 132, 132, 132, 132,
+	133, 133, 133, 133, 133, 133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134,
+	135, 135, 135, 135, 135, 135, 135, 135, 136, 137, 0, 0, 0, 0, 0, 0,
+	138, 138, 138, 138, 138, 138, 138, 138, 0, 0, 0, 0, 0, 0, 0, 0,
+	139, 139, 139, 139, 139, 139, 139, 139, 140, 140, 140, 140, 140, 140, 140, 140,
+	141, 141, 141, 141, 141, 141, 141, 141, 142, 142, 142, 142, 142, 142, 142, 142,
+	143, 143, 143, 143, 143, 143, 143, 143, 144, 145, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28,
+	29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30,
+	31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+	33, 33, 33, 33, 33, 33, 33, 33, 34, 35, 36, 37, 38, 0, 0, 0,
+	39, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 40,
+	41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 42, 42,
+	43, 43, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44,
+	45, 45, 45, 45, 45, 45, 45, 45, 46, 47, 48, 49, 0, 0, 0, 0,
+	50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51,
+	52, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53,
+	54, 54, 54, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55,
+	56, 56, 56, 56, 56, 56, 56, 56, 57, 58, 59, 60, 0, 0, 0, 0,
+	61, 61, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 62, 62, 62,
+	63, 63, 63, 63, 63, 63, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64,
+	65, 65, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66, 66, 66,
+	67, 67, 67, 67, 67, 67, 67, 67, 68, 69, 70, 71, 0, 0, 0, 0,
+	146, 146, 146, 146, 146, 146, 146, 146, 0, 0, 0, 0, 0, 0, 0, 0,
+	147, 147, 147, 147, 147, 147, 147, 147, 148, 148, 148, 148, 148, 148, 148, 148,
+	149, 149, 149, 149, 149, 149, 149, 149, 150, 150, 150, 150, 150, 150, 150, 150,
+	151, 151, 151, 151, 151, 151, 151, 151, 152, 153, 154, 155, 156, 0, 0, 0,
+	157, 157, 157, 157, 157, 157, 157, 157, 0, 0, 0, 0, 0, 0, 0, 0,
+	158, 158, 158, 158, 158, 158, 158, 158, 159, 159, 159, 159, 159, 159, 159, 159,
+	160, 160, 160, 160, 160, 160, 160, 160, 161, 161, 161, 161, 161, 161, 161, 161,
+	162, 162, 162, 162, 162, 162, 162, 162, 163, 164, 165, 166, 0, 0, 0, 0,
+	167, 167, 167, 167, 167, 167, 167, 167, 0, 0, 0, 0, 0, 0, 0, 0,
+	168, 168, 168, 168, 168, 168, 168, 168, 169, 169, 169, 169, 169, 169, 169, 169,
+	170, 170, 170, 170, 170, 170, 170, 170, 171, 171, 171, 171, 171, 171, 171, 171,
+	172, 172, 172, 172, 172, 172, 172, 172, 173, 174, 175, 176, 0, 0, 0, 0,
+	177, 177, 177, 177, 177, 177, 177, 177, 0, 0, 0, 0, 0, 0, 0, 0,
+	178, 178, 178, 178, 178, 178, 178, 178, 179, 179, 179, 179, 179, 179, 179, 179,
+	180, 180, 180, 180, 180, 180, 180, 180, 181, 181, 181, 181, 181, 181, 181, 181,
+	182, 182, 182, 182, 182, 182, 182, 182, 183, 184, 185, 186, 0, 0, 0, 0,
+	27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28,
+	29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30,
+	31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+	33, 33, 33, 33, 33, 33, 33, 33, 34, 35, 36, 37, 38, 0, 0, 0,
+	39, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 40,
+	41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 42, 42,
+	43, 43, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44,
+	45, 45, 45, 45, 45, 45, 45, 45, 46, 47, 48, 49, 0, 0, 0, 0,
+	50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51,
+	52, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53,
+	54, 54, 54, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55,
+	56, 56, 56, 56, 56, 56, 56, 56, 57, 58, 59, 60, 0, 0, 0, 0,
+	61, 61, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 62, 62, 62,
+	63, 63, 63, 63, 63, 63, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64,
+	65, 65, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66, 66, 66,
+	67, 67, 67, 67, 67, 67, 67, 67, 68, 69, 70, 71, 0, 0, 0, 0,
+	187, 187, 187, 187, 187, 187, 187, 187, 0, 0, 0, 0, 0, 0, 0, 0,
+	188, 188, 188, 188, 188, 188, 188, 188, 189, 189, 189, 189, 189, 189, 189, 189,
+	190, 190, 190, 190, 190, 190, 190, 190, 191, 191, 191, 191, 191, 191, 191, 191,
+	192, 192, 192, 192, 192, 192, 192, 192, 193, 194, 0, 0, 195, 0, 0, 0,
+	196, 196, 196, 196, 196, 196, 196, 196, 0, 0, 0, 0, 0, 0, 0, 0,
+	197, 197, 197, 197, 197, 197, 197, 197, 198, 198, 198, 198, 198, 198, 198, 198,
+	199, 199, 199, 199, 199, 199, 199, 199, 200, 200, 200, 200, 200, 200, 200, 200,
+	201, 201, 201, 201, 201, 201, 201, 201, 202, 203, 0, 0, 204, 0, 0, 0,
+	205, 205, 205, 205, 205, 205, 205, 205, 0, 0, 0, 0, 0, 0, 0, 0,
+	206, 206, 206, 206, 206, 206, 206, 206, 207, 207, 207, 207, 207, 207, 207, 207,
+	208, 208, 208, 208, 208, 208, 208, 208, 209, 209, 209, 209, 209, 209, 209, 209,
+	210, 210, 210, 210, 210, 210, 210, 210, 211, 212, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28,
+	29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30,
+	31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+	33, 33, 33, 33, 33, 33, 33, 33, 34, 35, 36, 37, 38, 0, 0, 0,
+	39, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 40,
+	41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 42, 42,
+	43, 43, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44,
+	45, 45, 45, 45, 45, 45, 45, 45, 46, 47, 48, 49, 0, 0, 0, 0,
+	50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51,
+	52, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53,
+	54, 54, 54, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55,
+	56, 56, 56, 56, 56, 56, 56, 56, 57, 58, 59, 60, 0, 0, 0, 0,
+	61, 61, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 62, 62, 62,
+	63, 63, 63, 63, 63, 63, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64,
+	65, 65, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66, 66, 66,
+	67, 67, 67, 67, 67, 67, 67, 67, 68, 69, 70, 71, 0, 0, 0, 0,
+	213, 213, 213, 213, 213, 213, 213, 213, 0, 0, 0, 0, 0, 0, 0, 0,
+	214, 214, 214, 214, 214, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215,
+	216, 216, 216, 216, 216, 216, 216, 216, 217, 217, 217, 217, 217, 217, 217, 217,
+	218, 218, 218, 218, 218, 218, 218, 218, 219, 220, 221, 222, 0, 0, 0, 0,
+	223, 223, 223, 223, 223, 223, 223, 223, 0, 0, 0, 0, 0, 0, 0, 0,
+	224, 224, 224, 224, 224, 224, 224, 224, 225, 225, 225, 225, 225, 225, 225, 225,
+	226, 226, 226, 226, 226, 226, 226, 226, 227, 227, 227, 227, 227, 227, 227, 227,
+	228, 228, 228, 228, 228, 228, 228, 228, 229, 230, 231, 232, 0, 0, 0, 0,
+	233, 233, 233, 233, 233, 233, 233, 233, 0, 0, 0, 0, 0, 0, 0, 0,
+	234, 234, 234, 234, 234, 234, 234, 234, 235, 235, 235, 235, 235, 235, 235, 235,
+	236, 236, 236, 236, 236, 236, 236, 236, 237, 237, 237, 237, 237, 237, 237, 237,
+	238, 238, 238, 238, 238, 238, 238, 238, 239, 240, 241, 242, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28,
+	29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30,
+	31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+	33, 33, 33, 33, 33, 33, 33, 33, 34, 35, 36, 37, 38, 0, 0, 0,
+	39, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 40,
+	41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 42, 42,
+	43, 43, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44,
+	45, 45, 45, 45, 45, 45, 45, 45, 46, 47, 48, 49, 0, 0, 0, 0,
+	50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51,
+	52, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53,
+	54, 54, 54, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55,
+	56, 56, 56, 56, 56, 56, 56, 56, 57, 58, 59, 60, 0, 0, 0, 0,
+	61, 61, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 62, 62, 62,
+	63, 63, 63, 63, 63, 63, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64,
+	65, 65, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66, 66, 66,
+	67, 67, 67, 67, 67, 67, 67, 67, 68, 69, 70, 71, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28,
+	29, 29, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30,
+	31, 31, 31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32,
+	33, 33, 33, 33, 33, 33, 33, 33, 34, 35, 36, 37, 38, 0, 0, 0,
+	39, 39, 39, 39, 39, 39, 39, 39, 40, 40, 40, 40, 40, 40, 40, 40,
+	41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42, 42, 42, 42, 42, 42,
+	43, 43, 43, 43, 43, 43, 43, 43, 44, 44, 44, 44, 44, 44, 44, 44,
+	45, 45, 45, 45, 45, 45, 45, 45, 46, 47, 48, 49, 0, 0, 0, 0,
+	50, 50, 50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51,
+	52, 52, 52, 52, 52, 52, 52, 52, 53, 53, 53, 53, 53, 53, 53, 53,
+	54, 54, 54, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55,
+	56, 56, 56, 56, 56, 56, 56, 56, 57, 58, 59, 60, 0, 0, 0, 0,
+	61, 61, 61, 61, 61, 61, 61, 61, 62, 62, 62, 62, 62, 62, 62, 62,
+	63, 63, 63, 63, 63, 63, 63, 63, 64, 64, 64, 64, 64, 64, 64, 64,
+	65, 65, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66, 66, 66,
+	67, 67, 67, 67, 67, 67, 67, 67, 68, 69, 70, 71, 0, 0, 0, 0,
+	243, 243, 243, 243, 243, 243, 243, 243, 244, 244, 244, 244, 244, 244, 244, 244,
+	245, 245, 245, 245, 245, 245, 245, 245, 246, 246, 246, 246, 246, 246, 246, 246,
+	247, 247, 247, 247, 247, 247, 247, 247, 248, 248, 248, 248, 248, 248, 248, 248,
+	249, 249, 249, 249, 249, 249, 249, 249, 250, 251, 252, 253, 254, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	255, 255, 255, 255, 255, 255, 255, 255, 256, 256, 256, 256, 256, 256, 256, 256,
+	257, 257, 257, 257, 257, 257, 257, 257, 258, 258, 258, 258, 258, 258, 258, 258,
+	259, 259, 259, 259, 259, 259, 259, 259, 260, 260, 260, 260, 260, 260, 260, 260,
+	261, 261, 261, 261, 261, 261, 261, 261, 262, 263, 264, 265, 266, 0, 0, 0,
+	267, 267, 267, 267, 267, 267, 267, 267, 268, 268, 268, 268, 268, 268, 268, 268,
+	269, 269, 269, 269, 269, 269, 269, 269, 270, 270, 270, 270, 270, 270, 270, 270,
+	271, 271, 271, 271, 271, 271, 271, 271, 272, 272, 272, 272, 272, 272, 272, 272,
+	273, 273, 273, 273, 273, 273, 273, 273, 274, 275, 276, 277, 278, 0, 0, 0,
+	279, 279, 279, 279, 279, 279, 279, 279, 280, 280, 280, 280, 280, 280, 280, 280,
+	281, 281, 281, 281, 281, 281, 281, 281, 282, 282, 282, 282, 282, 282, 282, 282,
+	283, 283, 283, 283, 283, 283, 283, 283, 284, 284, 284, 284, 284, 284, 284, 284,
+	285, 285, 285, 285, 285, 285, 285, 285, 286, 287, 288, 289, 290, 0, 0, 0,
+	291, 291, 291, 291, 291, 291, 291, 291, 292, 292, 292, 292, 292, 292, 292, 292,
+	293, 293, 293, 293, 293, 293, 293, 293, 294, 294, 294, 294, 294, 294, 294, 294,
+	295, 295, 295, 295, 295, 295, 295, 295, 296, 296, 296, 296, 296, 296, 296, 296,
+	297, 297, 297, 297, 297, 297, 297, 297, 298, 299, 300, 301, 302, 0, 0, 0,
+	303, 303, 303, 303, 303, 303, 303, 303, 304, 304, 304, 304, 304, 304, 304, 304,
+	305, 305, 305, 305, 305, 305, 305, 305, 306, 306, 306, 306, 306, 306, 306, 306,
+	307, 307, 307, 307, 307, 307, 307, 307, 308, 308, 308, 308, 308, 308, 308, 308,
+	309, 309, 309, 309, 309, 309, 309, 309, 310, 311, 312, 313, 314, 0, 0, 0,
+	315, 315, 315, 315, 315, 315, 315, 315, 316, 316, 316, 316, 316, 316, 316, 316,
+	317, 317, 317, 317, 317, 317, 317, 317, 318, 318, 318, 318, 318, 318, 318, 318,
+	319, 319, 319, 319, 319, 319, 319, 319, 320, 320, 320, 320, 320, 320, 320, 320,
+	321, 321, 321, 321, 321, 321, 321, 321, 322, 323, 324, 325, 326, 0, 0, 0,
+	243, 243, 243, 243, 243, 243, 243, 243, 244, 244, 244, 244, 244, 244, 244, 244,
+	245, 245, 245, 245, 245, 245, 245, 245, 246, 246, 246, 246, 246, 246, 246, 246,
+	247, 247, 247, 247, 247, 247, 247, 247, 248, 248, 248, 248, 248, 248, 248, 248,
+	249, 249, 249, 249, 249, 249, 249, 249, 250, 251, 252, 253, 254, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	255, 255, 255, 255, 255, 255, 255, 255, 256, 256, 256, 256, 256, 256, 256, 256,
+	257, 257, 257, 257, 257, 257, 257, 257, 258, 258, 258, 258, 258, 258, 258, 258,
+	259, 259, 259, 259, 259, 259, 259, 259, 260, 260, 260, 260, 260, 260, 260, 260,
+	261, 261, 261, 261, 261, 261, 261, 261, 262, 263, 264, 265, 266, 0, 0, 0,
+	267, 267, 267, 267, 267, 267, 267, 267, 268, 268, 268, 268, 268, 268, 268, 268,
+	269, 269, 269, 269, 269, 269, 269, 269, 270, 270, 270, 270, 270, 270, 270, 270,
+	271, 271, 271, 271, 271, 271, 271, 271, 272, 272, 272, 272, 272, 272, 272, 272,
+	273, 273, 273, 273, 273, 273, 273, 273, 274, 275, 276, 277, 278, 0, 0, 0,
+	279, 279, 279, 279, 279, 279, 279, 279, 280, 280, 280, 280, 280, 280, 280, 280,
+	281, 281, 281, 281, 281, 281, 281, 281, 282, 282, 282, 282, 282, 282, 282, 282,
+	283, 283, 283, 283, 283, 283, 283, 283, 284, 284, 284, 284, 284, 284, 284, 284,
+	285, 285, 285, 285, 285, 285, 285, 285, 286, 287, 288, 289, 290, 0, 0, 0,
+	291, 291, 291, 291, 291, 291, 291, 291, 292, 292, 292, 292, 292, 292, 292, 292,
+	293, 293, 293, 293, 293, 293, 293, 293, 294, 294, 294, 294, 294, 294, 294, 294,
+	295, 295, 295, 295, 295, 295, 295, 295, 296, 296, 296, 296, 296, 296, 296, 296,
+	297, 297, 297, 297, 297, 297, 297, 297, 298, 299, 300, 301, 302, 0, 0, 0,
+	303, 303, 303, 303, 303, 303, 303, 303, 304, 304, 304, 304, 304, 304, 304, 304,
+	305, 305, 305, 305, 305, 305, 305, 305, 306, 306, 306, 306, 306, 306, 306, 306,
+	307, 307, 307, 307, 307, 307, 307, 307, 308, 308, 308, 308, 308, 308, 308, 308,
+	309, 309, 309, 309, 309, 309, 309, 309, 310, 311, 312, 313, 314, 0, 0, 0,
+	327, 327, 327, 327, 327, 327, 327, 327, 328, 328, 328, 328, 328, 328, 328, 328,
+	329, 329, 329, 329, 329, 329, 329, 329, 330, 330, 330, 330, 330, 330, 330, 330,
+	331, 331, 331, 331, 331, 331, 331, 331, 332, 332, 332, 332, 332, 332, 332, 332,
+	333, 333, 333, 333, 333, 333, 333, 333, 334, 335, 336, 337, 338, 0, 0, 0,
+	243, 243, 243, 243, 243, 243, 243, 243, 244, 244, 244, 244, 244, 244, 244, 244,
+	245, 245, 245, 245, 245, 245, 245, 245, 246, 246, 246, 246, 246, 246, 246, 246,
+	247, 247, 247, 247, 247, 247, 247, 247, 248, 248, 248, 248, 248, 248, 248, 248,
+	249, 249, 249, 249, 249, 249, 249, 249, 250, 251, 252, 253, 254, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	255, 255, 255, 255, 255, 255, 255, 255, 256, 256, 256, 256, 256, 256, 256, 256,
+	257, 257, 257, 257, 257, 257, 257, 257, 258, 258, 258, 258, 258, 258, 258, 258,
+	259, 259, 259, 259, 259, 259, 259, 259, 260, 260, 260, 260, 260, 260, 260, 260,
+	261, 261, 261, 261, 261, 261, 261, 261, 262, 263, 264, 265, 266, 0, 0, 0,
+	267, 267, 267, 267, 267, 267, 267, 267, 268, 268, 268, 268, 268, 268, 268, 268,
+	269, 269, 269, 269, 269, 269, 269, 269, 270, 270, 270, 270, 270, 270, 270, 270,
+	271, 271, 271, 271, 271, 271, 271, 271, 272, 272, 272, 272, 272, 272, 272, 272,
+	273, 273, 273, 273, 273, 273, 273, 273, 274, 275, 276, 277, 278, 0, 0, 0,
+	279, 279, 279, 279, 279, 279, 279, 279, 280, 280, 280, 280, 280, 280, 280, 280,
+	281, 281, 281, 281, 281, 281, 281, 281, 282, 282, 282, 282, 282, 282, 282, 282,
+	283, 283, 283, 283, 283, 283, 283, 283, 284, 284, 284, 284, 284, 284, 284, 284,
+	285, 285, 285, 285, 285, 285, 285, 285, 286, 287, 288, 289, 290, 0, 0, 0,
+	291, 291, 291, 291, 291, 291, 291, 291, 292, 292, 292, 292, 292, 292, 292, 292,
+	293, 293, 293, 293, 293, 293, 293, 293, 294, 294, 294, 294, 294, 294, 294, 294,
+	295, 295, 295, 295, 295, 295, 295, 295, 296, 296, 296, 296, 296, 296, 296, 296,
+	297, 297, 297, 297, 297, 297, 297, 297, 298, 299, 300, 301, 302, 0, 0, 0,
+	303, 303, 303, 303, 303, 303, 303, 303, 304, 304, 304, 304, 304, 304, 304, 304,
+	305, 305, 305, 305, 305, 305, 305, 305, 306, 306, 306, 306, 306, 306, 306, 306,
+	307, 307, 307, 307, 307, 307, 307, 307, 308, 308, 308, 308, 308, 308, 308, 308,
+	309, 309, 309, 309, 309, 309, 309, 309, 310, 311, 312, 313, 314, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	243, 243, 243, 243, 243, 243, 243, 243, 244, 244, 244, 244, 244, 244, 244, 244,
+	245, 245, 245, 245, 245, 245, 245, 245, 246, 246, 246, 246, 246, 246, 246, 246,
+	247, 247, 247, 247, 247, 247, 247, 247, 248, 248, 248, 248, 248, 248, 248, 248,
+	249, 249, 249, 249, 249, 249, 249, 249, 250, 251, 252, 253, 254, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	255, 255, 255, 255, 255, 255, 255, 255, 256, 256, 256, 256, 256, 256, 256, 256,
+	257, 257, 257, 257, 257, 257, 257, 257, 258, 258, 258, 258, 258, 258, 258, 258,
+	259, 259, 259, 259, 259, 259, 259, 259, 260, 260, 260, 260, 260, 260, 260, 260,
+	261, 261, 261, 261, 261, 261, 261, 261, 262, 263, 264, 265, 266, 0, 0, 0,
+	267, 267, 267, 267, 267, 267, 267, 267, 268, 268, 268, 268, 268, 268, 268, 268,
+	269, 269, 269, 269, 269, 269, 269, 269, 270, 270, 270, 270, 270, 270, 270, 270,
+	271, 271, 271, 271, 271, 271, 271, 271, 272, 272, 272, 272, 272, 272, 272, 272,
+	273, 273, 273, 273, 273, 273, 273, 273, 274, 275, 276, 277, 278, 0, 0, 0,
+	279, 279, 279, 279, 279, 279, 279, 279, 280, 280, 280, 280, 280, 280, 280, 280,
+	281, 281, 281, 281, 281, 281, 281, 281, 282, 282, 282, 282, 282, 282, 282, 282,
+	283, 283, 283, 283, 283, 283, 283, 283, 284, 284, 284, 284, 284, 284, 284, 284,
+	285, 285, 285, 285, 285, 285, 285, 285, 286, 287, 288, 289, 290, 0, 0, 0,
+	291, 291, 291, 291, 291, 291, 291, 291, 292, 292, 292, 292, 292, 292, 292, 292,
+	293, 293, 293, 293, 293, 293, 293, 293, 294, 294, 294, 294, 294, 294, 294, 294,
+	295, 295, 295, 295, 295, 295, 295, 295, 296, 296, 296, 296, 296, 296, 296, 296,
+	297, 297, 297, 297, 297, 297, 297, 297, 298, 299, 300, 301, 302, 0, 0, 0,
+	303, 303, 303, 303, 303, 303, 303, 303, 304, 304, 304, 304, 304, 304, 304, 304,
+	305, 305, 305, 305, 305, 305, 305, 305, 306, 306, 306, 306, 306, 306, 306, 306,
+	307, 307, 307, 307, 307, 307, 307, 307, 308, 308, 308, 308, 308, 308, 308, 308,
+	309, 309, 309, 309, 309, 309, 309, 309, 310, 311, 312, 313, 314, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	243, 243, 243, 243, 243, 243, 243, 243, 244, 244, 244, 244, 244, 244, 244, 244,
+	245, 245, 245, 245, 245, 245, 245, 245, 246, 246, 246, 246, 246, 246, 246, 246,
+	247, 247, 247, 247, 247, 247, 247, 247, 248, 248, 248, 248, 248, 248, 248, 248,
+	249, 249, 249, 249, 249, 249, 249, 249, 250, 251, 252, 253, 254, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	255, 255, 255, 255, 255, 255, 255, 255, 256, 256, 256, 256, 256, 256, 256, 256,
+	257, 257, 257, 257, 257, 257, 257, 257, 258, 258, 258, 258, 258, 258, 258, 258,
+	259, 259, 259, 259, 259, 259, 259, 259, 260, 260, 260, 260, 260, 260, 260, 260,
+	261, 261, 261, 261, 261, 261, 261, 261, 262, 263, 264, 265, 266, 0, 0, 0,
+	267, 267, 267, 267, 267, 267, 267, 267, 268, 268, 268, 268, 268, 268, 268, 268,
+	269, 269, 269, 269, 269, 269, 269, 269, 270, 270, 270, 270, 270, 270, 270, 270,
+	271, 271, 271, 271, 271, 271, 271, 271, 272, 272, 272, 272, 272, 272, 272, 272,
+	273, 273, 273, 273, 273, 273, 273, 273, 274, 275, 276, 277, 278, 0, 0, 0,
+	279, 279, 279, 279, 279, 279, 279, 279, 280, 280, 280, 280, 280, 280, 280, 280,
+	281, 281, 281, 281, 281, 281, 281, 281, 282, 282, 282, 282, 282, 282, 282, 282,
+	283, 283, 283, 283, 283, 283, 283, 283, 284, 284, 284, 284, 284, 284, 284, 284,
+	285, 285, 285, 285, 285, 285, 285, 285, 286, 287, 288, 289, 290, 0, 0, 0,
+	291, 291, 291, 291, 291, 291, 291, 291, 292, 292, 292, 292, 292, 292, 292, 292,
+	293, 293, 293, 293, 293, 293, 293, 293, 294, 294, 294, 294, 294, 294, 294, 294,
+	295, 295, 295, 295, 295, 295, 295, 295, 296, 296, 296, 296, 296, 296, 296, 296,
+	297, 297, 297, 297, 297, 297, 297, 297, 298, 299, 300, 301, 302, 0, 0, 0,
+	303, 303, 303, 303, 303, 303, 303, 303, 304, 304, 304, 304, 304, 304, 304, 304,
+	305, 305, 305, 305, 305, 305, 305, 305, 306, 306, 306, 306, 306, 306, 306, 306,
+	307, 307, 307, 307, 307, 307, 307, 307, 308, 308, 308, 308, 308, 308, 308, 308,
+	309, 309, 309, 309, 309, 309, 309, 309, 310, 311, 312, 313, 314, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	243, 243, 243, 243, 243, 243, 243, 243, 244, 244, 244, 244, 244, 244, 244, 244,
+	245, 245, 245, 245, 245, 245, 245, 245, 246, 246, 246, 246, 246, 246, 246, 246,
+	247, 247, 247, 247, 247, 247, 247, 247, 248, 248, 248, 248, 248, 248, 248, 248,
+	249, 249, 249, 249, 249, 249, 249, 249, 250, 251, 252, 253, 254, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	255, 255, 255, 255, 255, 255, 255, 255, 256, 256, 256, 256, 256, 256, 256, 256,
+	257, 257, 257, 257, 257, 257, 257, 257, 258, 258, 258, 258, 258, 258, 258, 258,
+	259, 259, 259, 259, 259, 259, 259, 259, 260, 260, 260, 260, 260, 260, 260, 260,
+	261, 261, 261, 261, 261, 261, 261, 261, 262, 263, 264, 265, 266, 0, 0, 0,
+	267, 267, 267, 267, 267, 267, 267, 267, 268, 268, 268, 268, 268, 268, 268, 268,
+	269, 269, 269, 269, 269, 269, 269, 269, 270, 270, 270, 270, 270, 270, 270, 270,
+	271, 271, 271, 271, 271, 271, 271, 271, 272, 272, 272, 272, 272, 272, 272, 272,
+	273, 273, 273, 273, 273, 273, 273, 273, 274, 275, 276, 277, 278, 0, 0, 0,
+	279, 279, 279, 279, 279, 279, 279, 279, 280, 280, 280, 280, 280, 280, 280, 280,
+	281, 281, 281, 281, 281, 281, 281, 281, 282, 282, 282, 282, 282, 282, 282, 282,
+	283, 283, 283, 283, 283, 283, 283, 283, 284, 284, 284, 284, 284, 284, 284, 284,
+	285, 285, 285, 285, 285, 285, 285, 285, 286, 287, 288, 289, 290, 0, 0, 0,
+	291, 291, 291, 291, 291, 291, 291, 291, 292, 292, 292, 292, 292, 292, 292, 292,
+	293, 293, 293, 293, 293, 293, 293, 293, 294, 294, 294, 294, 294, 294, 294, 294,
+	295, 295, 295, 295, 295, 295, 295, 295, 296, 296, 296, 296, 296, 296, 296, 296,
+	297, 297, 297, 297, 297, 297, 297, 297, 298, 299, 300, 301, 302, 0, 0, 0,
+	303, 303, 303, 303, 303, 303, 303, 303, 304, 304, 304, 304, 304, 304, 304, 304,
+	305, 305, 305, 305, 305, 305, 305, 305, 306, 306, 306, 306, 306, 306, 306, 306,
+	307, 307, 307, 307, 307, 307, 307, 307, 308, 308, 308, 308, 308, 308, 308, 308,
+	309, 309, 309, 309, 309, 309, 309, 309, 310, 311, 312, 313, 314, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	243, 243, 243, 243, 243, 243, 243, 243, 244, 244, 244, 244, 244, 244, 244, 244,
+	245, 245, 245, 245, 245, 245, 245, 245, 246, 246, 246, 246, 246, 246, 246, 246,
+	247, 247, 247, 247, 247, 247, 247, 247, 248, 248, 248, 248, 248, 248, 248, 248,
+	249, 249, 249, 249, 249, 249, 249, 249, 250, 251, 252, 253, 254, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	255, 255, 255, 255, 255, 255, 255, 255, 256, 256, 256, 256, 256, 256, 256, 256,
+	257, 257, 257, 257, 257, 257, 257, 257, 258, 258, 258, 258, 258, 258, 258, 258,
+	259, 259, 259, 259, 259, 259, 259, 259, 260, 260, 260, 260, 260, 260, 260, 260,
+	261, 261, 261, 261, 261, 261, 261, 261, 262, 263, 264, 265, 266, 0, 0, 0,
+	267, 267, 267, 267, 267, 267, 267, 267, 268, 268, 268, 268, 268, 268, 268, 268,
+	269, 269, 269, 269, 269, 269, 269, 269, 270, 270, 270, 270, 270, 270, 270, 270,
+	271, 271, 271, 271, 271, 271, 271, 271, 272, 272, 272, 272, 272, 272, 272, 272,
+	273, 273, 273, 273, 273, 273, 273, 273, 274, 275, 276, 277, 278, 0, 0, 0,
+	279, 279, 279, 279, 279, 279, 279, 279, 280, 280, 280, 280, 280, 280, 280, 280,
+	281, 281, 281, 281, 281, 281, 281, 281, 282, 282, 282, 282, 282, 282, 282, 282,
+	283, 283, 283, 283, 283, 283, 283, 283, 284, 284, 284, 284, 284, 284, 284, 284,
+	285, 285, 285, 285, 285, 285, 285, 285, 286, 287, 288, 289, 290, 0, 0, 0,
+	291, 291, 291, 291, 291, 291, 291, 291, 292, 292, 292, 292, 292, 292, 292, 292,
+	293, 293, 293, 293, 293, 293, 293, 293, 294, 294, 294, 294, 294, 294, 294, 294,
+	295, 295, 295, 295, 295, 295, 295, 295, 296, 296, 296, 296, 296, 296, 296, 296,
+	297, 297, 297, 297, 297, 297, 297, 297, 298, 299, 300, 301, 302, 0, 0, 0,
+	303, 303, 303, 303, 303, 303, 303, 303, 304, 304, 304, 304, 304, 304, 304, 304,
+	305, 305, 305, 305, 305, 305, 305, 305, 306, 306, 306, 306, 306, 306, 306, 306,
+	307, 307, 307, 307, 307, 307, 307, 307, 308, 308, 308, 308, 308, 308, 308, 308,
+	309, 309, 309, 309, 309, 309, 309, 309, 310, 311, 312, 313, 314, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	243, 243, 243, 243, 243, 243, 243, 243, 244, 244, 244, 244, 244, 244, 244, 244,
+	245, 245, 245, 245, 245, 245, 245, 245, 246, 246, 246, 246, 246, 246, 246, 246,
+	247, 247, 247, 247, 247, 247, 247, 247, 248, 248, 248, 248, 248, 248, 248, 248,
+	249, 249, 249, 249, 249, 249, 249, 249, 250, 251, 252, 253, 254, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	255, 255, 255, 255, 255, 255, 255, 255, 256, 256, 256, 256, 256, 256, 256, 256,
+	257, 257, 257, 257, 257, 257, 257, 257, 258, 258, 258, 258, 258, 258, 258, 258,
+	259, 259, 259, 259, 259, 259, 259, 259, 260, 260, 260, 260, 260, 260, 260, 260,
+	261, 261, 261, 261, 261, 261, 261, 261, 262, 263, 264, 265, 266, 0, 0, 0,
+	267, 267, 267, 267, 267, 267, 267, 267, 268, 268, 268, 268, 268, 268, 268, 268,
+	269, 269, 269, 269, 269, 269, 269, 269, 270, 270, 270, 270, 270, 270, 270, 270,
+	271, 271, 271, 271, 271, 271, 271, 271, 272, 272, 272, 272, 272, 272, 272, 272,
+	273, 273, 273, 273, 273, 273, 273, 273, 274, 275, 276, 277, 278, 0, 0, 0,
+	279, 279, 279, 279, 279, 279, 279, 279, 280, 280, 280, 280, 280, 280, 280, 280,
+	281, 281, 281, 281, 281, 281, 281, 281, 282, 282, 282, 282, 282, 282, 282, 282,
+	283, 283, 283, 283, 283, 283, 283, 283, 284, 284, 284, 284, 284, 284, 284, 284,
+	285, 285, 285, 285, 285, 285, 285, 285, 286, 287, 288, 289, 290, 0, 0, 0,
+	291, 291, 291, 291, 291, 291, 291, 291, 292, 292, 292, 292, 292, 292, 292, 292,
+	293, 293, 293, 293, 293, 293, 293, 293, 294, 294, 294, 294, 294, 294, 294, 294,
+	295, 295, 295, 295, 295, 295, 295, 295, 296, 296, 296, 296, 296, 296, 296, 296,
+	297, 297, 297, 297, 297, 297, 297, 297, 298, 299, 300, 301, 302, 0, 0, 0,
+	303, 303, 303, 303, 303, 303, 303, 303, 304, 304, 304, 304, 304, 304, 304, 304,
+	305, 305, 305, 305, 305, 305, 305, 305, 306, 306, 306, 306, 306, 306, 306, 306,
+	307, 307, 307, 307, 307, 307, 307, 307, 308, 308, 308, 308, 308, 308, 308, 308,
+	309, 309, 309, 309, 309, 309, 309, 309, 310, 311, 312, 313, 314, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	339, 339, 339, 339, 339, 339, 339, 339, 340, 340, 340, 340, 340, 340, 340, 340,
+	341, 341, 341, 341, 341, 341, 341, 341, 342, 342, 342, 342, 342, 342, 342, 342,
+	343, 343, 343, 343, 343, 343, 343, 343, 344, 344, 344, 344, 344, 344, 344, 344,
+	345, 345, 345, 345, 345, 345, 345, 345, 346, 347, 348, 349, 350, 0, 0, 0,
+	351, 351, 351, 351, 351, 351, 351, 351, 352, 352, 352, 352, 352, 352, 352, 352,
+	353, 353, 353, 353, 353, 353, 353, 353, 354, 354, 354, 354, 354, 354, 354, 354,
+	355, 355, 355, 355, 355, 355, 355, 355, 356, 356, 356, 356, 356, 356, 356, 356,
+	357, 357, 357, 357, 357, 357, 357, 357, 358, 359, 360, 361, 362, 0, 0, 0,
+	363, 363, 363, 363, 363, 363, 363, 363, 364, 364, 364, 364, 364, 364, 364, 364,
+	365, 365, 365, 365, 365, 365, 365, 365, 366, 366, 366, 366, 366, 366, 366, 366,
+	367, 367, 367, 367, 367, 367, 367, 367, 368, 368, 368, 368, 368, 368, 368, 368,
+	369, 369, 369, 369, 369, 369, 369, 369, 370, 371, 372, 373, 374, 0, 0, 0,
+	375, 375, 375, 375, 375, 375, 375, 375, 376, 376, 376, 376, 376, 376, 376, 376,
+	377, 377, 377, 377, 377, 377, 377, 377, 378, 378, 378, 378, 378, 378, 378, 378,
+	379, 379, 379, 379, 379, 379, 379, 379, 380, 380, 380, 380, 380, 380, 380, 380,
+	381, 381, 381, 381, 381, 381, 381, 381, 382, 383, 384, 385, 386, 0, 0, 0,
+	387, 387, 387, 387, 387, 387, 387, 387, 388, 388, 388, 388, 388, 388, 388, 388,
+	389, 389, 389, 389, 389, 389, 389, 389, 390, 390, 390, 390, 390, 390, 390, 390,
+	391, 391, 391, 391, 391, 391, 391, 391, 392, 392, 392, 392, 392, 392, 392, 392,
+	393, 393, 393, 393, 393, 393, 393, 393, 394, 395, 396, 397, 398, 0, 0, 0,
+	399, 399, 399, 399, 399, 399, 399, 399, 400, 400, 400, 400, 400, 400, 400, 400,
+	401, 401, 401, 401, 401, 401, 401, 401, 402, 402, 402, 402, 402, 402, 402, 402,
+	403, 403, 403, 403, 403, 403, 403, 403, 404, 404, 404, 404, 404, 404, 404, 404,
+	405, 405, 405, 405, 405, 405, 405, 405, 406, 407, 408, 409, 410, 0, 0, 0,
+	411, 411, 411, 411, 411, 411, 411, 411, 412, 412, 412, 412, 412, 412, 412, 412,
+	413, 413, 413, 413, 413, 413, 413, 413, 414, 414, 414, 414, 414, 414, 414, 414,
+	415, 415, 415, 415, 415, 415, 415, 415, 416, 416, 416, 416, 416, 416, 416, 416,
+	417, 417, 417, 417, 417, 417, 417, 417, 418, 419, 420, 421, 422, 0, 0, 0,
+	423, 423, 423, 423, 423, 423, 423, 423, 424, 424, 424, 424, 424, 424, 424, 424,
+	425, 425, 425, 425, 425, 425, 425, 425, 426, 426, 426, 426, 426, 426, 426, 426,
+	427, 427, 427, 427, 427, 427, 427, 427, 428, 428, 428, 428, 428, 428, 428, 428,
+	429, 429, 429, 429, 429, 429, 429, 429, 430, 431, 432, 433, 434, 0, 0, 0,
+	339, 339, 339, 339, 339, 339, 339, 339, 340, 340, 340, 340, 340, 340, 340, 340,
+	341, 341, 341, 341, 341, 341, 341, 341, 342, 342, 342, 342, 342, 342, 342, 342,
+	343, 343, 343, 343, 343, 343, 343, 343, 344, 344, 344, 344, 344, 344, 344, 344,
+	345, 345, 345, 345, 345, 345, 345, 345, 346, 347, 348, 349, 350, 0, 0, 0,
+	351, 351, 351, 351, 351, 351, 351, 351, 352, 352, 352, 352, 352, 352, 352, 352,
+	353, 353, 353, 353, 353, 353, 353, 353, 354, 354, 354, 354, 354, 354, 354, 354,
+	355, 355, 355, 355, 355, 355, 355, 355, 356, 356, 356, 356, 356, 356, 356, 356,
+	357, 357, 357, 357, 357, 357, 357, 357, 358, 359, 360, 361, 362, 0, 0, 0,
+	363, 363, 363, 363, 363, 363, 363, 363, 364, 364, 364, 364, 364, 364, 364, 364,
+	365, 365, 365, 365, 365, 365, 365, 365, 366, 366, 366, 366, 366, 366, 366, 366,
+	367, 367, 367, 367, 367, 367, 367, 367, 368, 368, 368, 368, 368, 368, 368, 368,
+	369, 369, 369, 369, 369, 369, 369, 369, 370, 371, 372, 373, 374, 0, 0, 0,
+	375, 375, 375, 375, 375, 375, 375, 375, 376, 376, 376, 376, 376, 376, 376, 376,
+	377, 377, 377, 377, 377, 377, 377, 377, 378, 378, 378, 378, 378, 378, 378, 378,
+	379, 379, 379, 379, 379, 379, 379, 379, 380, 380, 380, 380, 380, 380, 380, 380,
+	381, 381, 381, 381, 381, 381, 381, 381, 382, 383, 384, 385, 386, 0, 0, 0,
+	387, 387, 387, 387, 387, 387, 387, 387, 388, 388, 388, 388, 388, 388, 388, 388,
+	389, 389, 389, 389, 389, 389, 389, 389, 390, 390, 390, 390, 390, 390, 390, 390,
+	391, 391, 391, 391, 391, 391, 391, 391, 392, 392, 392, 392, 392, 392, 392, 392,
+	393, 393, 393, 393, 393, 393, 393, 393, 394, 395, 396, 397, 398, 0, 0, 0,
+	399, 399, 399, 399, 399, 399, 399, 399, 400, 400, 400, 400, 400, 400, 400, 400,
+	401, 401, 401, 401, 401, 401, 401, 401, 402, 402, 402, 402, 402, 402, 402, 402,
+	403, 403, 403, 403, 403, 403, 403, 403, 404, 404, 404, 404, 404, 404, 404, 404,
+	405, 405, 405, 405, 405, 405, 405, 405, 406, 407, 408, 409, 410, 0, 0, 0,
+	411, 411, 411, 411, 411, 411, 411, 411, 412, 412, 412, 412, 412, 412, 412, 412,
+	413, 413, 413, 413, 413, 413, 413, 413, 414, 414, 414, 414, 414, 414, 414, 414,
+	415, 415, 415, 415, 415, 415, 415, 415, 416, 416, 416, 416, 416, 416, 416, 416,
+	417, 417, 417, 417, 417, 417, 417, 417, 418, 419, 420, 421, 422, 0, 0, 0,
+	435, 435, 435, 435, 435, 435, 435, 435, 436, 436, 436, 436, 436, 436, 436, 436,
+	437, 437, 437, 437, 437, 437, 437, 437, 438, 438, 438, 438, 438, 438, 438, 438,
+	439, 439, 439, 439, 439, 439, 439, 439, 440, 440, 440, 440, 440, 440, 440, 440,
+	441, 441, 441, 441, 441, 441, 441, 441, 442, 443, 444, 445, 446, 0, 0, 0,
+	339, 339, 339, 339, 339, 339, 339, 339, 340, 340, 340, 340, 340, 340, 340, 340,
+	341, 341, 341, 341, 341, 341, 341, 341, 342, 342, 342, 342, 342, 342, 342, 342,
+	343, 343, 343, 343, 343, 343, 343, 343, 344, 344, 344, 344, 344, 344, 344, 344,
+	345, 345, 345, 345, 345, 345, 345, 345, 346, 347, 348, 349, 350, 0, 0, 0,
+	351, 351, 351, 351, 351, 351, 351, 351, 352, 352, 352, 352, 352, 352, 352, 352,
+	353, 353, 353, 353, 353, 353, 353, 353, 354, 354, 354, 354, 354, 354, 354, 354,
+	355, 355, 355, 355, 355, 355, 355, 355, 356, 356, 356, 356, 356, 356, 356, 356,
+	357, 357, 357, 357, 357, 357, 357, 357, 358, 359, 360, 361, 362, 0, 0, 0,
+	363, 363, 363, 363, 363, 363, 363, 363, 364, 364, 364, 364, 364, 364, 364, 364,
+	365, 365, 365, 365, 365, 365, 365, 365, 366, 366, 366, 366, 366, 366, 366, 366,
+	367, 367, 367, 367, 367, 367, 367, 367, 368, 368, 368, 368, 368, 368, 368, 368,
+	369, 369, 369, 369, 369, 369, 369, 369, 370, 371, 372, 373, 374, 0, 0, 0,
+	375, 375, 375, 375, 375, 375, 375, 375, 376, 376, 376, 376, 376, 376, 376, 376,
+	377, 377, 377, 377, 377, 377, 377, 377, 378, 378, 378, 378, 378, 378, 378, 378,
+	379, 379, 379, 379, 379, 379, 379, 379, 380, 380, 380, 380, 380, 380, 380, 380,
+	381, 381, 381, 381, 381, 381, 381, 381, 382, 383, 384, 385, 386, 0, 0, 0,
+	387, 387, 387, 387, 387, 387, 387, 387, 388, 388, 388, 388, 388, 388, 388, 388,
+	389, 389, 389, 389, 389, 389, 389, 389, 390, 390, 390, 390, 390, 390, 390, 390,
+	391, 391, 391, 391, 391, 391, 391, 391, 392, 392, 392, 392, 392, 392, 392, 392,
+	393, 393, 393, 393, 393, 393, 393, 393, 394, 395, 396, 397, 398, 0, 0, 0,
+	399, 399, 399, 399, 399, 399, 399, 399, 400, 400, 400, 400, 400, 400, 400, 400,
+	401, 401, 401, 401, 401, 401, 401, 401, 402, 402, 402, 402, 402, 402, 402, 402,
+	403, 403, 403, 403, 403, 403, 403, 403, 404, 404, 404, 404, 404, 404, 404, 404,
+	405, 405, 405, 405, 405, 405, 405, 405, 406, 407, 408, 409, 410, 0, 0, 0,
+	411, 411, 411, 411, 411, 411, 411, 411, 412, 412, 412, 412, 412, 412, 412, 412,
+	413, 413, 413, 413, 413, 413, 413, 413, 414, 414, 414, 414, 414, 414, 414, 414,
+	415, 415, 415, 415, 415, 415, 415, 415, 416, 416, 416, 416, 416, 416, 416, 416,
+	417, 417, 417, 417, 417, 417, 417, 417, 418, 419, 420, 421, 422, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	339, 339, 339, 339, 339, 339, 339, 339, 340, 340, 340, 340, 340, 340, 340, 340,
+	341, 341, 341, 341, 341, 341, 341, 341, 342, 342, 342, 342, 342, 342, 342, 342,
+	343, 343, 343, 343, 343, 343, 343, 343, 344, 344, 344, 344, 344, 344, 344, 344,
+	345, 345, 345, 345, 345, 345, 345, 345, 346, 347, 348, 349, 350, 0, 0, 0,
+	351, 351, 351, 351, 351, 351, 351, 351, 352, 352, 352, 352, 352, 352, 352, 352,
+	353, 353, 353, 353, 353, 353, 353, 353, 354, 354, 354, 354, 354, 354, 354, 354,
+	355, 355, 355, 355, 355, 355, 355, 355, 356, 356, 356, 356, 356, 356, 356, 356,
+	357, 357, 357, 357, 357, 357, 357, 357, 358, 359, 360, 361, 362, 0, 0, 0,
+	363, 363, 363, 363, 363, 363, 363, 363, 364, 364, 364, 364, 364, 364, 364, 364,
+	365, 365, 365, 365, 365, 365, 365, 365, 366, 366, 366, 366, 366, 366, 366, 366,
+	367, 367, 367, 367, 367, 367, 367, 367, 368, 368, 368, 368, 368, 368, 368, 368,
+	369, 369, 369, 369, 369, 369, 369, 369, 370, 371, 372, 373, 374, 0, 0, 0,
+	375, 375, 375, 375, 375, 375, 375, 375, 376, 376, 376, 376, 376, 376, 376, 376,
+	377, 377, 377, 377, 377, 377, 377, 377, 378, 378, 378, 378, 378, 378, 378, 378,
+	379, 379, 379, 379, 379, 379, 379, 379, 380, 380, 380, 380, 380, 380, 380, 380,
+	381, 381, 381, 381, 381, 381, 381, 381, 382, 383, 384, 385, 386, 0, 0, 0,
+	387, 387, 387, 387, 387, 387, 387, 387, 388, 388, 388, 388, 388, 388, 388, 388,
+	389, 389, 389, 389, 389, 389, 389, 389, 390, 390, 390, 390, 390, 390, 390, 390,
+	391, 391, 391, 391, 391, 391, 391, 391, 392, 392, 392, 392, 392, 392, 392, 392,
+	393, 393, 393, 393, 393, 393, 393, 393, 394, 395, 396, 397, 398, 0, 0, 0,
+	399, 399, 399, 399, 399, 399, 399, 399, 400, 400, 400, 400, 400, 400, 400, 400,
+	401, 401, 401, 401, 401, 401, 401, 401, 402, 402, 402, 402, 402, 402, 402, 402,
+	403, 403, 403, 403, 403, 403, 403, 403, 404, 404, 404, 404, 404, 404, 404, 404,
+	405, 405, 405, 405, 405, 405, 405, 405, 406, 407, 408, 409, 410, 0, 0, 0,
+	411, 411, 411, 411, 411, 411, 411, 411, 412, 412, 412, 412, 412, 412, 412, 412,
+	413, 413, 413, 413, 413, 413, 413, 413, 414, 414, 414, 414, 414, 414, 414, 414,
+	415, 415, 415, 415, 415, 415, 415, 415, 416, 416, 416, 416, 416, 416, 416, 416,
+	417, 417, 417, 417, 417, 417, 417, 417, 418, 419, 420, 421, 422, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	339, 339, 339, 339, 339, 339, 339, 339, 340, 340, 340, 340, 340, 340, 340, 340,
+	341, 341, 341, 341, 341, 341, 341, 341, 342, 342, 342, 342, 342, 342, 342, 342,
+	343, 343, 343, 343, 343, 343, 343, 343, 344, 344, 344, 344, 344, 344, 344, 344,
+	345, 345, 345, 345, 345, 345, 345, 345, 346, 347, 348, 349, 350, 0, 0, 0,
+	351, 351, 351, 351, 351, 351, 351, 351, 352, 352, 352, 352, 352, 352, 352, 352,
+	353, 353, 353, 353, 353, 353, 353, 353, 354, 354, 354, 354, 354, 354, 354, 354,
+	355, 355, 355, 355, 355, 355, 355, 355, 356, 356, 356, 356, 356, 356, 356, 356,
+	357, 357, 357, 357, 357, 357, 357, 357, 358, 359, 360, 361, 362, 0, 0, 0,
+	363, 363, 363, 363, 363, 363, 363, 363, 364, 364, 364, 364, 364, 364, 364, 364,
+	365, 365, 365, 365, 365, 365, 365, 365, 366, 366, 366, 366, 366, 366, 366, 366,
+	367, 367, 367, 367, 367, 367, 367, 367, 368, 368, 368, 368, 368, 368, 368, 368,
+	369, 369, 369, 369, 369, 369, 369, 369, 370, 371, 372, 373, 374, 0, 0, 0,
+	375, 375, 375, 375, 375, 375, 375, 375, 376, 376, 376, 376, 376, 376, 376, 376,
+	377, 377, 377, 377, 377, 377, 377, 377, 378, 378, 378, 378, 378, 378, 378, 378,
+	379, 379, 379, 379, 379, 379, 379, 379, 380, 380, 380, 380, 380, 380, 380, 380,
+	381, 381, 381, 381, 381, 381, 381, 381, 382, 383, 384, 385, 386, 0, 0, 0,
+	387, 387, 387, 387, 387, 387, 387, 387, 388, 388, 388, 388, 388, 388, 388, 388,
+	389, 389, 389, 389, 389, 389, 389, 389, 390, 390, 390, 390, 390, 390, 390, 390,
+	391, 391, 391, 391, 391, 391, 391, 391, 392, 392, 392, 392, 392, 392, 392, 392,
+	393, 393, 393, 393, 393, 393, 393, 393, 394, 395, 396, 397, 398, 0, 0, 0,
+	399, 399, 399, 399, 399, 399, 399, 399, 400, 400, 400, 400, 400, 400, 400, 400,
+	401, 401, 401, 401, 401, 401, 401, 401, 402, 402, 402, 402, 402, 402, 402, 402,
+	403, 403, 403, 403, 403, 403, 403, 403, 404, 404, 404, 404, 404, 404, 404, 404,
+	405, 405, 405, 405, 405, 405, 405, 405, 406, 407, 408, 409, 410, 0, 0, 0,
+	411, 411, 411, 411, 411, 411, 411, 411, 412, 412, 412, 412, 412, 412, 412, 412,
+	413, 413, 413, 413, 413, 413, 413, 413, 414, 414, 414, 414, 414, 414, 414, 414,
+	415, 415, 415, 415, 415, 415, 415, 415, 416, 416, 416, 416, 416, 416, 416, 416,
+	417, 417, 417, 417, 417, 417, 417, 417, 418, 419, 420, 421, 422, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	339, 339, 339, 339, 339, 339, 339, 339, 340, 340, 340, 340, 340, 340, 340, 340,
+	341, 341, 341, 341, 341, 341, 341, 341, 342, 342, 342, 342, 342, 342, 342, 342,
+	343, 343, 343, 343, 343, 343, 343, 343, 344, 344, 344, 344, 344, 344, 344, 344,
+	345, 345, 345, 345, 345, 345, 345, 345, 346, 347, 348, 349, 350, 0, 0, 0,
+	351, 351, 351, 351, 351, 351, 351, 351, 352, 352, 352, 352, 352, 352, 352, 352,
+	353, 353, 353, 353, 353, 353, 353, 353, 354, 354, 354, 354, 354, 354, 354, 354,
+	355, 355, 355, 355, 355, 355, 355, 355, 356, 356, 356, 356, 356, 356, 356, 356,
+	357, 357, 357, 357, 357, 357, 357, 357, 358, 359, 360, 361, 362, 0, 0, 0,
+	363, 363, 363, 363, 363, 363, 363, 363, 364, 364, 364, 364, 364, 364, 364, 364,
+	365, 365, 365, 365, 365, 365, 365, 365, 366, 366, 366, 366, 366, 366, 366, 366,
+	367, 367, 367, 367, 367, 367, 367, 367, 368, 368, 368, 368, 368, 368, 368, 368,
+	369, 369, 369, 369, 369, 369, 369, 369, 370, 371, 372, 373, 374, 0, 0, 0,
+	375, 375, 375, 375, 375, 375, 375, 375, 376, 376, 376, 376, 376, 376, 376, 376,
+	377, 377, 377, 377, 377, 377, 377, 377, 378, 378, 378, 378, 378, 378, 378, 378,
+	379, 379, 379, 379, 379, 379, 379, 379, 380, 380, 380, 380, 380, 380, 380, 380,
+	381, 381, 381, 381, 381, 381, 381, 381, 382, 383, 384, 385, 386, 0, 0, 0,
+	387, 387, 387, 387, 387, 387, 387, 387, 388, 388, 388, 388, 388, 388, 388, 388,
+	389, 389, 389, 389, 389, 389, 389, 389, 390, 390, 390, 390, 390, 390, 390, 390,
+	391, 391, 391, 391, 391, 391, 391, 391, 392, 392, 392, 392, 392, 392, 392, 392,
+	393, 393, 393, 393, 393, 393, 393, 393, 394, 395, 396, 397, 398, 0, 0, 0,
+	399, 399, 399, 399, 399, 399, 399, 399, 400, 400, 400, 400, 400, 400, 400, 400,
+	401, 401, 401, 401, 401, 401, 401, 401, 402, 402, 402, 402, 402, 402, 402, 402,
+	403, 403, 403, 403, 403, 403, 403, 403, 404, 404, 404, 404, 404, 404, 404, 404,
+	405, 405, 405, 405, 405, 405, 405, 405, 406, 407, 408, 409, 410, 0, 0, 0,
+	411, 411, 411, 411, 411, 411, 411, 411, 412, 412, 412, 412, 412, 412, 412, 412,
+	413, 413, 413, 413, 413, 413, 413, 413, 414, 414, 414, 414, 414, 414, 414, 414,
+	415, 415, 415, 415, 415, 415, 415, 415, 416, 416, 416, 416, 416, 416, 416, 416,
+	417, 417, 417, 417, 417, 417, 417, 417, 418, 419, 420, 421, 422, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	339, 339, 339, 339, 339, 339, 339, 339, 340, 340, 340, 340, 340, 340, 340, 340,
+	341, 341, 341, 341, 341, 341, 341, 341, 342, 342, 342, 342, 342, 342, 342, 342,
+	343, 343, 343, 343, 343, 343, 343, 343, 344, 344, 344, 344, 344, 344, 344, 344,
+	345, 345, 345, 345, 345, 345, 345, 345, 346, 347, 348, 349, 350, 0, 0, 0,
+	351, 351, 351, 351, 351, 351, 351, 351, 352, 352, 352, 352, 352, 352, 352, 352,
+	353, 353, 353, 353, 353, 353, 353, 353, 354, 354, 354, 354, 354, 354, 354, 354,
+	355, 355, 355, 355, 355, 355, 355, 355, 356, 356, 356, 356, 356, 356, 356, 356,
+	357, 357, 357, 357, 357, 357, 357, 357, 358, 359, 360, 361, 362, 0, 0, 0,
+	363, 363, 363, 363, 363, 363, 363, 363, 364, 364, 364, 364, 364, 364, 364, 364,
+	365, 365, 365, 365, 365, 365, 365, 365, 366, 366, 366, 366, 366, 366, 366, 366,
+	367, 367, 367, 367, 367, 367, 367, 367, 368, 368, 368, 368, 368, 368, 368, 368,
+	369, 369, 369, 369, 369, 369, 369, 369, 370, 371, 372, 373, 374, 0, 0, 0,
+	375, 375, 375, 375, 375, 375, 375, 375, 376, 376, 376, 376, 376, 376, 376, 376,
+	377, 377, 377, 377, 377, 377, 377, 377, 378, 378, 378, 378, 378, 378, 378, 378,
+	379, 379, 379, 379, 379, 379, 379, 379, 380, 380, 380, 380, 380, 380, 380, 380,
+	381, 381, 381, 381, 381, 381, 381, 381, 382, 383, 384, 385, 386, 0, 0, 0,
+	387, 387, 387, 387, 387, 387, 387, 387, 388, 388, 388, 388, 388, 388, 388, 388,
+	389, 389, 389, 389, 389, 389, 389, 389, 390, 390, 390, 390, 390, 390, 390, 390,
+	391, 391, 391, 391, 391, 391, 391, 391, 392, 392, 392, 392, 392, 392, 392, 392,
+	393, 393, 393, 393, 393, 393, 393, 393, 394, 395, 396, 397, 398, 0, 0, 0,
+	399, 399, 399, 399, 399, 399, 399, 399, 400, 400, 400, 400, 400, 400, 400, 400,
+	401, 401, 401, 401, 401, 401, 401, 401, 402, 402, 402, 402, 402, 402, 402, 402,
+	403, 403, 403, 403, 403, 403, 403, 403, 404, 404, 404, 404, 404, 404, 404, 404,
+	405, 405, 405, 405, 405, 405, 405, 405, 406, 407, 408, 409, 410, 0, 0, 0,
+	411, 411, 411, 411, 411, 411, 411, 411, 412, 412, 412, 412, 412, 412, 412, 412,
+	413, 413, 413, 413, 413, 413, 413, 413, 414, 414, 414, 414, 414, 414, 414, 414,
+	415, 415, 415, 415, 415, 415, 415, 415, 416, 416, 416, 416, 416, 416, 416, 416,
+	417, 417, 417, 417, 417, 417, 417, 417, 418, 419, 420, 421, 422, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	339, 339, 339, 339, 339, 339, 339, 339, 340, 340, 340, 340, 340, 340, 340, 340,
+	341, 341, 341, 341, 341, 341, 341, 341, 342, 342, 342, 342, 342, 342, 342, 342,
+	343, 343, 343, 343, 343, 343, 343, 343, 344, 344, 344, 344, 344, 344, 344, 344,
+	345, 345, 345, 345, 345, 345, 345, 345, 346, 347, 348, 349, 350, 0, 0, 0,
+	351, 351, 351, 351, 351, 351, 351, 351, 352, 352, 352, 352, 352, 352, 352, 352,
+	353, 353, 353, 353, 353, 353, 353, 353, 354, 354, 354, 354, 354, 354, 354, 354,
+	355, 355, 355, 355, 355, 355, 355, 355, 356, 356, 356, 356, 356, 356, 356, 356,
+	357, 357, 357, 357, 357, 357, 357, 357, 358, 359, 360, 361, 362, 0, 0, 0,
+	363, 363, 363, 363, 363, 363, 363, 363, 364, 364, 364, 364, 364, 364, 364, 364,
+	365, 365, 365, 365, 365, 365, 365, 365, 366, 366, 366, 366, 366, 366, 366, 366,
+	367, 367, 367, 367, 367, 367, 367, 367, 368, 368, 368, 368, 368, 368, 368, 368,
+	369, 369, 369, 369, 369, 369, 369, 369, 370, 371, 372, 373, 374, 0, 0, 0,
+	375, 375, 375, 375, 375, 375, 375, 375, 376, 376, 376, 376, 376, 376, 376, 376,
+	377, 377, 377, 377, 377, 377, 377, 377, 378, 378, 378, 378, 378, 378, 378, 378,
+	379, 379, 379, 379, 379, 379, 379, 379, 380, 380, 380, 380, 380, 380, 380, 380,
+	381, 381, 381, 381, 381, 381, 381, 381, 382, 383, 384, 385, 386, 0, 0, 0,
+	387, 387, 387, 387, 387, 387, 387, 387, 388, 388, 388, 388, 388, 388, 388, 388,
+	389, 389, 389, 389, 389, 389, 389, 389, 390, 390, 390, 390, 390, 390, 390, 390,
+	391, 391, 391, 391, 391, 391, 391, 391, 392, 392, 392, 392, 392, 392, 392, 392,
+	393, 393, 393, 393, 393, 393, 393, 393, 394, 395, 396, 397, 398, 0, 0, 0,
+	399, 399, 399, 399, 399, 399, 399, 399, 400, 400, 400, 400, 400, 400, 400, 400,
+	401, 401, 401, 401, 401, 401, 401, 401, 402, 402, 402, 402, 402, 402, 402, 402,
+	403, 403, 403, 403, 403, 403, 403, 403, 404, 404, 404, 404, 404, 404, 404, 404,
+	405, 405, 405, 405, 405, 405, 405, 405, 406, 407, 408, 409, 410, 0, 0, 0,
+	411, 411, 411, 411, 411, 411, 411, 411, 412, 412, 412, 412, 412, 412, 412, 412,
+	413, 413, 413, 413, 413, 413, 413, 413, 414, 414, 414, 414, 414, 414, 414, 414,
+	415, 415, 415, 415, 415, 415, 415, 415, 416, 416, 416, 416, 416, 416, 416, 416,
+	417, 417, 417, 417, 417, 417, 417, 417, 418, 419, 420, 421, 422, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	447, 447, 447, 447, 447, 447, 447, 447, 448, 448, 448, 448, 448, 448, 448, 448,
+	449, 449, 449, 449, 449, 449, 449, 449, 450, 450, 450, 450, 450, 450, 450, 450,
+	451, 451, 451, 451, 451, 451, 451, 451, 452, 452, 452, 452, 452, 452, 452, 452,
+	453, 453, 453, 453, 453, 453, 453, 453, 454, 455, 456, 457, 458, 0, 0, 0,
+	459, 459, 459, 459, 459, 459, 459, 459, 460, 460, 460, 460, 460, 460, 460, 460,
+	461, 461, 461, 461, 461, 461, 461, 461, 462, 462, 462, 462, 462, 462, 462, 462,
+	463, 463, 463, 463, 463, 463, 463, 463, 464, 464, 464, 464, 464, 464, 464, 464,
+	465, 465, 465, 465, 465, 465, 465, 465, 466, 467, 468, 469, 470, 0, 0, 0,
+	471, 471, 471, 471, 471, 471, 471, 471, 472, 472, 472, 472, 472, 472, 472, 472,
+	473, 473, 473, 473, 473, 473, 473, 473, 474, 474, 474, 474, 474, 474, 474, 474,
+	475, 475, 475, 475, 475, 475, 475, 475, 476, 476, 476, 476, 476, 476, 476, 476,
+	477, 477, 477, 477, 477, 477, 477, 477, 478, 479, 480, 481, 482, 0, 0, 0,
+	483, 483, 483, 483, 483, 483, 483, 483, 484, 484, 484, 484, 484, 484, 484, 484,
+	485, 485, 485, 485, 485, 485, 485, 485, 486, 486, 486, 486, 486, 486, 486, 486,
+	487, 487, 487, 487, 487, 487, 487, 487, 488, 488, 488, 488, 488, 488, 488, 488,
+	489, 489, 489, 489, 489, 489, 489, 489, 490, 491, 492, 493, 494, 0, 0, 0,
+	495, 495, 495, 495, 495, 495, 495, 495, 496, 496, 496, 496, 496, 496, 496, 496,
+	497, 497, 497, 497, 497, 497, 497, 497, 498, 498, 498, 498, 498, 498, 498, 498,
+	499, 499, 499, 499, 499, 499, 499, 499, 500, 500, 500, 500, 500, 500, 500, 500,
+	501, 501, 501, 501, 501, 501, 501, 501, 502, 503, 504, 505, 506, 0, 0, 0,
+	507, 507, 507, 507, 507, 507, 507, 507, 508, 508, 508, 508, 508, 508, 508, 508,
+	509, 509, 509, 509, 509, 509, 509, 509, 510, 510, 510, 510, 510, 510, 510, 510,
+	511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512,
+	513, 513, 513, 513, 513, 513, 513, 513, 514, 515, 516, 517, 518, 0, 0, 0,
+	519, 519, 519, 519, 519, 519, 519, 519, 520, 520, 520, 520, 520, 520, 520, 520,
+	521, 521, 521, 521, 521, 521, 521, 521, 522, 522, 522, 522, 522, 522, 522, 522,
+	523, 523, 523, 523, 523, 523, 523, 523, 524, 524, 524, 524, 524, 524, 524, 524,
+	525, 525, 525, 525, 525, 525, 525, 525, 526, 527, 528, 529, 530, 0, 0, 0,
+	531, 531, 531, 531, 531, 531, 531, 531, 532, 532, 532, 532, 532, 532, 532, 532,
+	533, 533, 533, 533, 533, 533, 533, 533, 534, 534, 534, 534, 534, 534, 534, 534,
+	535, 535, 535, 535, 535, 535, 535, 535, 536, 536, 536, 536, 536, 536, 536, 536,
+	537, 537, 537, 537, 537, 537, 537, 537, 538, 539, 540, 541, 542, 0, 0, 0,
+	447, 447, 447, 447, 447, 447, 447, 447, 448, 448, 448, 448, 448, 448, 448, 448,
+	449, 449, 449, 449, 449, 449, 449, 449, 450, 450, 450, 450, 450, 450, 450, 450,
+	451, 451, 451, 451, 451, 451, 451, 451, 452, 452, 452, 452, 452, 452, 452, 452,
+	453, 453, 453, 453, 453, 453, 453, 453, 454, 455, 456, 457, 458, 0, 0, 0,
+	459, 459, 459, 459, 459, 459, 459, 459, 460, 460, 460, 460, 460, 460, 460, 460,
+	461, 461, 461, 461, 461, 461, 461, 461, 462, 462, 462, 462, 462, 462, 462, 462,
+	463, 463, 463, 463, 463, 463, 463, 463, 464, 464, 464, 464, 464, 464, 464, 464,
+	465, 465, 465, 465, 465, 465, 465, 465, 466, 467, 468, 469, 470, 0, 0, 0,
+	471, 471, 471, 471, 471, 471, 471, 471, 472, 472, 472, 472, 472, 472, 472, 472,
+	473, 473, 473, 473, 473, 473, 473, 473, 474, 474, 474, 474, 474, 474, 474, 474,
+	475, 475, 475, 475, 475, 475, 475, 475, 476, 476, 476, 476, 476, 476, 476, 476,
+	477, 477, 477, 477, 477, 477, 477, 477, 478, 479, 480, 481, 482, 0, 0, 0,
+	483, 483, 483, 483, 483, 483, 483, 483, 484, 484, 484, 484, 484, 484, 484, 484,
+	485, 485, 485, 485, 485, 485, 485, 485, 486, 486, 486, 486, 486, 486, 486, 486,
+	487, 487, 487, 487, 487, 487, 487, 487, 488, 488, 488, 488, 488, 488, 488, 488,
+	489, 489, 489, 489, 489, 489, 489, 489, 490, 491, 492, 493, 494, 0, 0, 0,
+	495, 495, 495, 495, 495, 495, 495, 495, 496, 496, 496, 496, 496, 496, 496, 496,
+	497, 497, 497, 497, 497, 497, 497, 497, 498, 498, 498, 498, 498, 498, 498, 498,
+	499, 499, 499, 499, 499, 499, 499, 499, 500, 500, 500, 500, 500, 500, 500, 500,
+	501, 501, 501, 501, 501, 501, 501, 501, 502, 503, 504, 505, 506, 0, 0, 0,
+	507, 507, 507, 507, 507, 507, 507, 507, 508, 508, 508, 508, 508, 508, 508, 508,
+	509, 509, 509, 509, 509, 509, 509, 509, 510, 510, 510, 510, 510, 510, 510, 510,
+	511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512,
+	513, 513, 513, 513, 513, 513, 513, 513, 514, 515, 516, 517, 518, 0, 0, 0,
+	519, 519, 519, 519, 519, 519, 519, 519, 520, 520, 520, 520, 520, 520, 520, 520,
+	521, 521, 521, 521, 521, 521, 521, 521, 522, 522, 522, 522, 522, 522, 522, 522,
+	523, 523, 523, 523, 523, 523, 523, 523, 524, 524, 524, 524, 524, 524, 524, 524,
+	525, 525, 525, 525, 525, 525, 525, 525, 526, 527, 528, 529, 530, 0, 0, 0,
+	543, 543, 543, 543, 543, 543, 543, 543, 544, 544, 544, 544, 544, 544, 544, 544,
+	545, 545, 545, 545, 545, 545, 545, 545, 546, 546, 546, 546, 546, 546, 546, 546,
+	547, 547, 547, 547, 547, 547, 547, 547, 548, 548, 548, 548, 548, 548, 548, 548,
+	549, 549, 549, 549, 549, 549, 549, 549, 550, 551, 552, 553, 554, 0, 0, 0,
+	447, 447, 447, 447, 447, 447, 447, 447, 448, 448, 448, 448, 448, 448, 448, 448,
+	449, 449, 449, 449, 449, 449, 449, 449, 450, 450, 450, 450, 450, 450, 450, 450,
+	451, 451, 451, 451, 451, 451, 451, 451, 452, 452, 452, 452, 452, 452, 452, 452,
+	453, 453, 453, 453, 453, 453, 453, 453, 454, 455, 456, 457, 458, 0, 0, 0,
+	459, 459, 459, 459, 459, 459, 459, 459, 460, 460, 460, 460, 460, 460, 460, 460,
+	461, 461, 461, 461, 461, 461, 461, 461, 462, 462, 462, 462, 462, 462, 462, 462,
+	463, 463, 463, 463, 463, 463, 463, 463, 464, 464, 464, 464, 464, 464, 464, 464,
+	465, 465, 465, 465, 465, 465, 465, 465, 466, 467, 468, 469, 470, 0, 0, 0,
+	471, 471, 471, 471, 471, 471, 471, 471, 472, 472, 472, 472, 472, 472, 472, 472,
+	473, 473, 473, 473, 473, 473, 473, 473, 474, 474, 474, 474, 474, 474, 474, 474,
+	475, 475, 475, 475, 475, 475, 475, 475, 476, 476, 476, 476, 476, 476, 476, 476,
+	477, 477, 477, 477, 477, 477, 477, 477, 478, 479, 480, 481, 482, 0, 0, 0,
+	483, 483, 483, 483, 483, 483, 483, 483, 484, 484, 484, 484, 484, 484, 484, 484,
+	485, 485, 485, 485, 485, 485, 485, 485, 486, 486, 486, 486, 486, 486, 486, 486,
+	487, 487, 487, 487, 487, 487, 487, 487, 488, 488, 488, 488, 488, 488, 488, 488,
+	489, 489, 489, 489, 489, 489, 489, 489, 490, 491, 492, 493, 494, 0, 0, 0,
+	495, 495, 495, 495, 495, 495, 495, 495, 496, 496, 496, 496, 496, 496, 496, 496,
+	497, 497, 497, 497, 497, 497, 497, 497, 498, 498, 498, 498, 498, 498, 498, 498,
+	499, 499, 499, 499, 499, 499, 499, 499, 500, 500, 500, 500, 500, 500, 500, 500,
+	501, 501, 501, 501, 501, 501, 501, 501, 502, 503, 504, 505, 506, 0, 0, 0,
+	507, 507, 507, 507, 507, 507, 507, 507, 508, 508, 508, 508, 508, 508, 508, 508,
+	509, 509, 509, 509, 509, 509, 509, 509, 510, 510, 510, 510, 510, 510, 510, 510,
+	511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512,
+	513, 513, 513, 513, 513, 513, 513, 513, 514, 515, 516, 517, 518, 0, 0, 0,
+	519, 519, 519, 519, 519, 519, 519, 519, 520, 520, 520, 520, 520, 520, 520, 520,
+	521, 521, 521, 521, 521, 521, 521, 521, 522, 522, 522, 522, 522, 522, 522, 522,
+	523, 523, 523, 523, 523, 523, 523, 523, 524, 524, 524, 524, 524, 524, 524, 524,
+	525, 525, 525, 525, 525, 525, 525, 525, 526, 527, 528, 529, 530, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	447, 447, 447, 447, 447, 447, 447, 447, 448, 448, 448, 448, 448, 448, 448, 448,
+	449, 449, 449, 449, 449, 449, 449, 449, 450, 450, 450, 450, 450, 450, 450, 450,
+	451, 451, 451, 451, 451, 451, 451, 451, 452, 452, 452, 452, 452, 452, 452, 452,
+	453, 453, 453, 453, 453, 453, 453, 453, 454, 455, 456, 457, 458, 0, 0, 0,
+	459, 459, 459, 459, 459, 459, 459, 459, 460, 460, 460, 460, 460, 460, 460, 460,
+	461, 461, 461, 461, 461, 461, 461, 461, 462, 462, 462, 462, 462, 462, 462, 462,
+	463, 463, 463, 463, 463, 463, 463, 463, 464, 464, 464, 464, 464, 464, 464, 464,
+	465, 465, 465, 465, 465, 465, 465, 465, 466, 467, 468, 469, 470, 0, 0, 0,
+	471, 471, 471, 471, 471, 471, 471, 471, 472, 472, 472, 472, 472, 472, 472, 472,
+	473, 473, 473, 473, 473, 473, 473, 473, 474, 474, 474, 474, 474, 474, 474, 474,
+	475, 475, 475, 475, 475, 475, 475, 475, 476, 476, 476, 476, 476, 476, 476, 476,
+	477, 477, 477, 477, 477, 477, 477, 477, 478, 479, 480, 481, 482, 0, 0, 0,
+	483, 483, 483, 483, 483, 483, 483, 483, 484, 484, 484, 484, 484, 484, 484, 484,
+	485, 485, 485, 485, 485, 485, 485, 485, 486, 486, 486, 486, 486, 486, 486, 486,
+	487, 487, 487, 487, 487, 487, 487, 487, 488, 488, 488, 488, 488, 488, 488, 488,
+	489, 489, 489, 489, 489, 489, 489, 489, 490, 491, 492, 493, 494, 0, 0, 0,
+	495, 495, 495, 495, 495, 495, 495, 495, 496, 496, 496, 496, 496, 496, 496, 496,
+	497, 497, 497, 497, 497, 497, 497, 497, 498, 498, 498, 498, 498, 498, 498, 498,
+	499, 499, 499, 499, 499, 499, 499, 499, 500, 500, 500, 500, 500, 500, 500, 500,
+	501, 501, 501, 501, 501, 501, 501, 501, 502, 503, 504, 505, 506, 0, 0, 0,
+	507, 507, 507, 507, 507, 507, 507, 507, 508, 508, 508, 508, 508, 508, 508, 508,
+	509, 509, 509, 509, 509, 509, 509, 509, 510, 510, 510, 510, 510, 510, 510, 510,
+	511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512,
+	513, 513, 513, 513, 513, 513, 513, 513, 514, 515, 516, 517, 518, 0, 0, 0,
+	519, 519, 519, 519, 519, 519, 519, 519, 520, 520, 520, 520, 520, 520, 520, 520,
+	521, 521, 521, 521, 521, 521, 521, 521, 522, 522, 522, 522, 522, 522, 522, 522,
+	523, 523, 523, 523, 523, 523, 523, 523, 524, 524, 524, 524, 524, 524, 524, 524,
+	525, 525, 525, 525, 525, 525, 525, 525, 526, 527, 528, 529, 530, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	447, 447, 447, 447, 447, 447, 447, 447, 448, 448, 448, 448, 448, 448, 448, 448,
+	449, 449, 449, 449, 449, 449, 449, 449, 450, 450, 450, 450, 450, 450, 450, 450,
+	451, 451, 451, 451, 451, 451, 451, 451, 452, 452, 452, 452, 452, 452, 452, 452,
+	453, 453, 453, 453, 453, 453, 453, 453, 454, 455, 456, 457, 458, 0, 0, 0,
+	459, 459, 459, 459, 459, 459, 459, 459, 460, 460, 460, 460, 460, 460, 460, 460,
+	461, 461, 461, 461, 461, 461, 461, 461, 462, 462, 462, 462, 462, 462, 462, 462,
+	463, 463, 463, 463, 463, 463, 463, 463, 464, 464, 464, 464, 464, 464, 464, 464,
+	465, 465, 465, 465, 465, 465, 465, 465, 466, 467, 468, 469, 470, 0, 0, 0,
+	471, 471, 471, 471, 471, 471, 471, 471, 472, 472, 472, 472, 472, 472, 472, 472,
+	473, 473, 473, 473, 473, 473, 473, 473, 474, 474, 474, 474, 474, 474, 474, 474,
+	475, 475, 475, 475, 475, 475, 475, 475, 476, 476, 476, 476, 476, 476, 476, 476,
+	477, 477, 477, 477, 477, 477, 477, 477, 478, 479, 480, 481, 482, 0, 0, 0,
+	483, 483, 483, 483, 483, 483, 483, 483, 484, 484, 484, 484, 484, 484, 484, 484,
+	485, 485, 485, 485, 485, 485, 485, 485, 486, 486, 486, 486, 486, 486, 486, 486,
+	487, 487, 487, 487, 487, 487, 487, 487, 488, 488, 488, 488, 488, 488, 488, 488,
+	489, 489, 489, 489, 489, 489, 489, 489, 490, 491, 492, 493, 494, 0, 0, 0,
+	495, 495, 495, 495, 495, 495, 495, 495, 496, 496, 496, 496, 496, 496, 496, 496,
+	497, 497, 497, 497, 497, 497, 497, 497, 498, 498, 498, 498, 498, 498, 498, 498,
+	499, 499, 499, 499, 499, 499, 499, 499, 500, 500, 500, 500, 500, 500, 500, 500,
+	501, 501, 501, 501, 501, 501, 501, 501, 502, 503, 504, 505, 506, 0, 0, 0,
+	507, 507, 507, 507, 507, 507, 507, 507, 508, 508, 508, 508, 508, 508, 508, 508,
+	509, 509, 509, 509, 509, 509, 509, 509, 510, 510, 510, 510, 510, 510, 510, 510,
+	511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512,
+	513, 513, 513, 513, 513, 513, 513, 513, 514, 515, 516, 517, 518, 0, 0, 0,
+	519, 519, 519, 519, 519, 519, 519, 519, 520, 520, 520, 520, 520, 520, 520, 520,
+	521, 521, 521, 521, 521, 521, 521, 521, 522, 522, 522, 522, 522, 522, 522, 522,
+	523, 523, 523, 523, 523, 523, 523, 523, 524, 524, 524, 524, 524, 524, 524, 524,
+	525, 525, 525, 525, 525, 525, 525, 525, 526, 527, 528, 529, 530, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	447, 447, 447, 447, 447, 447, 447, 447, 448, 448, 448, 448, 448, 448, 448, 448,
+	449, 449, 449, 449, 449, 449, 449, 449, 450, 450, 450, 450, 450, 450, 450, 450,
+	451, 451, 451, 451, 451, 451, 451, 451, 452, 452, 452, 452, 452, 452, 452, 452,
+	453, 453, 453, 453, 453, 453, 453, 453, 454, 455, 456, 457, 458, 0, 0, 0,
+	459, 459, 459, 459, 459, 459, 459, 459, 460, 460, 460, 460, 460, 460, 460, 460,
+	461, 461, 461, 461, 461, 461, 461, 461, 462, 462, 462, 462, 462, 462, 462, 462,
+	463, 463, 463, 463, 463, 463, 463, 463, 464, 464, 464, 464, 464, 464, 464, 464,
+	465, 465, 465, 465, 465, 465, 465, 465, 466, 467, 468, 469, 470, 0, 0, 0,
+	471, 471, 471, 471, 471, 471, 471, 471, 472, 472, 472, 472, 472, 472, 472, 472,
+	473, 473, 473, 473, 473, 473, 473, 473, 474, 474, 474, 474, 474, 474, 474, 474,
+	475, 475, 475, 475, 475, 475, 475, 475, 476, 476, 476, 476, 476, 476, 476, 476,
+	477, 477, 477, 477, 477, 477, 477, 477, 478, 479, 480, 481, 482, 0, 0, 0,
+	483, 483, 483, 483, 483, 483, 483, 483, 484, 484, 484, 484, 484, 484, 484, 484,
+	485, 485, 485, 485, 485, 485, 485, 485, 486, 486, 486, 486, 486, 486, 486, 486,
+	487, 487, 487, 487, 487, 487, 487, 487, 488, 488, 488, 488, 488, 488, 488, 488,
+	489, 489, 489, 489, 489, 489, 489, 489, 490, 491, 492, 493, 494, 0, 0, 0,
+	495, 495, 495, 495, 495, 495, 495, 495, 496, 496, 496, 496, 496, 496, 496, 496,
+	497, 497, 497, 497, 497, 497, 497, 497, 498, 498, 498, 498, 498, 498, 498, 498,
+	499, 499, 499, 499, 499, 499, 499, 499, 500, 500, 500, 500, 500, 500, 500, 500,
+	501, 501, 501, 501, 501, 501, 501, 501, 502, 503, 504, 505, 506, 0, 0, 0,
+	507, 507, 507, 507, 507, 507, 507, 507, 508, 508, 508, 508, 508, 508, 508, 508,
+	509, 509, 509, 509, 509, 509, 509, 509, 510, 510, 510, 510, 510, 510, 510, 510,
+	511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512,
+	513, 513, 513, 513, 513, 513, 513, 513, 514, 515, 516, 517, 518, 0, 0, 0,
+	519, 519, 519, 519, 519, 519, 519, 519, 520, 520, 520, 520, 520, 520, 520, 520,
+	521, 521, 521, 521, 521, 521, 521, 521, 522, 522, 522, 522, 522, 522, 522, 522,
+	523, 523, 523, 523, 523, 523, 523, 523, 524, 524, 524, 524, 524, 524, 524, 524,
+	525, 525, 525, 525, 525, 525, 525, 525, 526, 527, 528, 529, 530, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	447, 447, 447, 447, 447, 447, 447, 447, 448, 448, 448, 448, 448, 448, 448, 448,
+	449, 449, 449, 449, 449, 449, 449, 449, 450, 450, 450, 450, 450, 450, 450, 450,
+	451, 451, 451, 451, 451, 451, 451, 451, 452, 452, 452, 452, 452, 452, 452, 452,
+	453, 453, 453, 453, 453, 453, 453, 453, 454, 455, 456, 457, 458, 0, 0, 0,
+	459, 459, 459, 459, 459, 459, 459, 459, 460, 460, 460, 460, 460, 460, 460, 460,
+	461, 461, 461, 461, 461, 461, 461, 461, 462, 462, 462, 462, 462, 462, 462, 462,
+	463, 463, 463, 463, 463, 463, 463, 463, 464, 464, 464, 464, 464, 464, 464, 464,
+	465, 465, 465, 465, 465, 465, 465, 465, 466, 467, 468, 469, 470, 0, 0, 0,
+	471, 471, 471, 471, 471, 471, 471, 471, 472, 472, 472, 472, 472, 472, 472, 472,
+	473, 473, 473, 473, 473, 473, 473, 473, 474, 474, 474, 474, 474, 474, 474, 474,
+	475, 475, 475, 475, 475, 475, 475, 475, 476, 476, 476, 476, 476, 476, 476, 476,
+	477, 477, 477, 477, 477, 477, 477, 477, 478, 479, 480, 481, 482, 0, 0, 0,
+	483, 483, 483, 483, 483, 483, 483, 483, 484, 484, 484, 484, 484, 484, 484, 484,
+	485, 485, 485, 485, 485, 485, 485, 485, 486, 486, 486, 486, 486, 486, 486, 486,
+	487, 487, 487, 487, 487, 487, 487, 487, 488, 488, 488, 488, 488, 488, 488, 488,
+	489, 489, 489, 489, 489, 489, 489, 489, 490, 491, 492, 493, 494, 0, 0, 0,
+	495, 495, 495, 495, 495, 495, 495, 495, 496, 496, 496, 496, 496, 496, 496, 496,
+	497, 497, 497, 497, 497, 497, 497, 497, 498, 498, 498, 498, 498, 498, 498, 498,
+	499, 499, 499, 499, 499, 499, 499, 499, 500, 500, 500, 500, 500, 500, 500, 500,
+	501, 501, 501, 501, 501, 501, 501, 501, 502, 503, 504, 505, 506, 0, 0, 0,
+	507, 507, 507, 507, 507, 507, 507, 507, 508, 508, 508, 508, 508, 508, 508, 508,
+	509, 509, 509, 509, 509, 509, 509, 509, 510, 510, 510, 510, 510, 510, 510, 510,
+	511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512,
+	513, 513, 513, 513, 513, 513, 513, 513, 514, 515, 516, 517, 518, 0, 0, 0,
+	519, 519, 519, 519, 519, 519, 519, 519, 520, 520, 520, 520, 520, 520, 520, 520,
+	521, 521, 521, 521, 521, 521, 521, 521, 522, 522, 522, 522, 522, 522, 522, 522,
+	523, 523, 523, 523, 523, 523, 523, 523, 524, 524, 524, 524, 524, 524, 524, 524,
+	525, 525, 525, 525, 525, 525, 525, 525, 526, 527, 528, 529, 530, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	447, 447, 447, 447, 447, 447, 447, 447, 448, 448, 448, 448, 448, 448, 448, 448,
+	449, 449, 449, 449, 449, 449, 449, 449, 450, 450, 450, 450, 450, 450, 450, 450,
+	451, 451, 451, 451, 451, 451, 451, 451, 452, 452, 452, 452, 452, 452, 452, 452,
+	453, 453, 453, 453, 453, 453, 453, 453, 454, 455, 456, 457, 458, 0, 0, 0,
+	459, 459, 459, 459, 459, 459, 459, 459, 460, 460, 460, 460, 460, 460, 460, 460,
+	461, 461, 461, 461, 461, 461, 461, 461, 462, 462, 462, 462, 462, 462, 462, 462,
+	463, 463, 463, 463, 463, 463, 463, 463, 464, 464, 464, 464, 464, 464, 464, 464,
+	465, 465, 465, 465, 465, 465, 465, 465, 466, 467, 468, 469, 470, 0, 0, 0,
+	471, 471, 471, 471, 471, 471, 471, 471, 472, 472, 472, 472, 472, 472, 472, 472,
+	473, 473, 473, 473, 473, 473, 473, 473, 474, 474, 474, 474, 474, 474, 474, 474,
+	475, 475, 475, 475, 475, 475, 475, 475, 476, 476, 476, 476, 476, 476, 476, 476,
+	477, 477, 477, 477, 477, 477, 477, 477, 478, 479, 480, 481, 482, 0, 0, 0,
+	483, 483, 483, 483, 483, 483, 483, 483, 484, 484, 484, 484, 484, 484, 484, 484,
+	485, 485, 485, 485, 485, 485, 485, 485, 486, 486, 486, 486, 486, 486, 486, 486,
+	487, 487, 487, 487, 487, 487, 487, 487, 488, 488, 488, 488, 488, 488, 488, 488,
+	489, 489, 489, 489, 489, 489, 489, 489, 490, 491, 492, 493, 494, 0, 0, 0,
+	495, 495, 495, 495, 495, 495, 495, 495, 496, 496, 496, 496, 496, 496, 496, 496,
+	497, 497, 497, 497, 497, 497, 497, 497, 498, 498, 498, 498, 498, 498, 498, 498,
+	499, 499, 499, 499, 499, 499, 499, 499, 500, 500, 500, 500, 500, 500, 500, 500,
+	501, 501, 501, 501, 501, 501, 501, 501, 502, 503, 504, 505, 506, 0, 0, 0,
+	507, 507, 507, 507, 507, 507, 507, 507, 508, 508, 508, 508, 508, 508, 508, 508,
+	509, 509, 509, 509, 509, 509, 509, 509, 510, 510, 510, 510, 510, 510, 510, 510,
+	511, 511, 511, 511, 511, 511, 511, 511, 512, 512, 512, 512, 512, 512, 512, 512,
+	513, 513, 513, 513, 513, 513, 513, 513, 514, 515, 516, 517, 518, 0, 0, 0,
+	519, 519, 519, 519, 519, 519, 519, 519, 520, 520, 520, 520, 520, 520, 520, 520,
+	521, 521, 521, 521, 521, 521, 521, 521, 522, 522, 522, 522, 522, 522, 522, 522,
+	523, 523, 523, 523, 523, 523, 523, 523, 524, 524, 524, 524, 524, 524, 524, 524,
+	525, 525, 525, 525, 525, 525, 525, 525, 526, 527, 528, 529, 530, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	555, 555, 555, 555, 555, 555, 555, 555, 0, 0, 0, 0, 0, 0, 0, 0,
+	556, 556, 556, 556, 556, 556, 556, 556, 557, 557, 557, 557, 557, 557, 557, 557,
+	558, 558, 558, 558, 558, 558, 558, 558, 559, 559, 559, 559, 559, 559, 559, 559,
+	560, 560, 560, 560, 560, 560, 560, 560, 561, 562, 0, 0, 0, 0, 0, 0,
+	563, 563, 563, 563, 563, 563, 563, 563, 0, 0, 0, 0, 0, 0, 0, 0,
+	564, 564, 564, 564, 564, 564, 564, 564, 565, 565, 565, 565, 565, 565, 565, 565,
+	566, 566, 566, 566, 566, 566, 566, 566, 567, 567, 567, 567, 567, 567, 567, 567,
+	568, 568, 568, 568, 568, 568, 568, 568, 569, 570, 0, 0, 0, 0, 0, 0,
+	571, 571, 571, 571, 571, 571, 571, 571, 0, 0, 0, 0, 0, 0, 0, 0,
+	572, 572, 572, 572, 572, 572, 572, 572, 573, 573, 573, 573, 573, 573, 573, 573,
+	574, 574, 574, 574, 574, 574, 574, 574, 575, 575, 575, 575, 575, 575, 575, 575,
+	576, 576, 576, 576, 576, 576, 576, 576, 577, 578, 0, 0, 0, 0, 0, 0,
+	579, 579, 579, 579, 579, 579, 579, 579, 0, 0, 0, 0, 0, 0, 0, 0,
+	580, 580, 580, 580, 580, 580, 580, 580, 581, 581, 581, 581, 581, 581, 581, 581,
+	582, 582, 582, 582, 582, 582, 582, 582, 583, 583, 583, 583, 583, 583, 583, 583,
+	584, 584, 584, 584, 584, 584, 584, 584, 585, 586, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	587, 587, 587, 587, 587, 587, 587, 587, 0, 0, 0, 0, 0, 0, 0, 0,
+	588, 588, 588, 588, 588, 588, 588, 588, 589, 589, 589, 589, 589, 589, 589, 589,
+	590, 590, 590, 590, 590, 590, 590, 590, 591, 591, 591, 591, 591, 591, 591, 591,
+	592, 592, 592, 592, 592, 592, 592, 592, 593, 594, 595, 596, 597, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	598, 598, 598, 598, 598, 598, 598, 598, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 599, 599, 599, 599, 599, 599, 599, 599,
+	600, 600, 600, 600, 600, 600, 600, 600, 601, 602, 603, 604, 0, 0, 0, 0,
+	605, 605, 605, 605, 605, 605, 605, 605, 0, 0, 0, 0, 0, 0, 0, 0,
+	606, 606, 606, 606, 606, 606, 606, 606, 607, 607, 607, 607, 607, 607, 607, 607,
+	608, 608, 608, 608, 608, 608, 608, 608, 609, 609, 609, 609, 609, 609, 609, 609,
+	610, 610, 610, 610, 610, 610, 610, 610, 611, 612, 0, 0, 0, 0, 0, 0,
+	613, 613, 613, 613, 613, 613, 613, 613, 0, 0, 0, 0, 0, 0, 0, 0,
+	614, 614, 614, 614, 614, 614, 614, 614, 615, 615, 615, 615, 615, 615, 615, 615,
+	616, 616, 616, 616, 616, 616, 616, 616, 617, 617, 617, 617, 617, 617, 617, 617,
+	618, 618, 618, 618, 618, 618, 618, 618, 619, 620, 0, 0, 0, 0, 0, 0,
+	621, 621, 621, 621, 621, 621, 621, 621, 0, 0, 0, 0, 0, 0, 0, 0,
+	622, 622, 622, 622, 622, 622, 622, 622, 623, 623, 623, 623, 623, 623, 623, 623,
+	624, 624, 624, 624, 624, 624, 624, 624, 625, 625, 625, 625, 625, 625, 625, 625,
+	626, 626, 626, 626, 626, 626, 626, 626, 627, 628, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	587, 587, 587, 587, 587, 587, 587, 587, 0, 0, 0, 0, 0, 0, 0, 0,
+	588, 588, 588, 588, 588, 588, 588, 588, 589, 589, 589, 589, 589, 589, 589, 589,
+	590, 590, 590, 590, 590, 590, 590, 590, 591, 591, 591, 591, 591, 591, 591, 591,
+	592, 592, 592, 592, 592, 592, 592, 592, 593, 594, 595, 596, 597, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	598, 598, 598, 598, 598, 598, 598, 598, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 599, 599, 599, 599, 599, 599, 599, 599,
+	600, 600, 600, 600, 600, 600, 600, 600, 601, 602, 603, 604, 0, 0, 0, 0,
+	629, 629, 629, 629, 629, 629, 629, 629, 0, 0, 0, 0, 0, 0, 0, 0,
+	630, 630, 630, 630, 630, 630, 630, 630, 631, 631, 631, 631, 631, 631, 631, 631,
+	632, 632, 632, 632, 632, 632, 632, 632, 633, 633, 633, 633, 633, 633, 633, 633,
+	634, 634, 634, 634, 634, 634, 634, 634, 635, 636, 0, 0, 0, 0, 0, 0,
+	637, 637, 637, 637, 637, 637, 637, 637, 0, 0, 0, 0, 0, 0, 0, 0,
+	638, 638, 638, 638, 638, 638, 638, 638, 639, 639, 639, 639, 639, 639, 639, 639,
+	640, 640, 640, 640, 640, 640, 640, 640, 641, 641, 641, 641, 641, 641, 641, 641,
+	642, 642, 642, 642, 642, 642, 642, 642, 643, 644, 0, 0, 0, 0, 0, 0,
+	645, 645, 645, 645, 645, 645, 645, 645, 0, 0, 0, 0, 0, 0, 0, 0,
+	646, 646, 646, 646, 646, 646, 646, 646, 647, 647, 647, 647, 647, 647, 647, 647,
+	648, 648, 648, 648, 648, 648, 648, 648, 649, 649, 649, 649, 649, 649, 649, 649,
+	650, 650, 650, 650, 650, 650, 650, 650, 651, 652, 0, 0, 0, 0, 0, 0,
+	653, 653, 653, 653, 653, 653, 653, 653, 0, 0, 0, 0, 0, 0, 0, 0,
+	654, 654, 654, 654, 654, 654, 654, 654, 655, 655, 655, 655, 655, 655, 655, 655,
+	656, 656, 656, 656, 656, 656, 656, 656, 657, 657, 657, 657, 657, 657, 657, 657,
+	658, 658, 658, 658, 658, 658, 658, 658, 659, 660, 661, 662, 663, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	587, 587, 587, 587, 587, 587, 587, 587, 0, 0, 0, 0, 0, 0, 0, 0,
+	588, 588, 588, 588, 588, 588, 588, 588, 589, 589, 589, 589, 589, 589, 589, 589,
+	590, 590, 590, 590, 590, 590, 590, 590, 591, 591, 591, 591, 591, 591, 591, 591,
+	592, 592, 592, 592, 592, 592, 592, 592, 593, 594, 595, 596, 597, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	598, 598, 598, 598, 598, 598, 598, 598, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 599, 599, 599, 599, 599, 599, 599, 599,
+	600, 600, 600, 600, 600, 600, 600, 600, 601, 602, 603, 604, 0, 0, 0, 0,
+	664, 664, 664, 664, 664, 664, 664, 664, 0, 0, 0, 0, 0, 0, 0, 0,
+	665, 665, 665, 665, 665, 665, 665, 665, 666, 666, 666, 666, 666, 666, 666, 666,
+	667, 667, 667, 667, 667, 667, 667, 667, 668, 668, 668, 668, 668, 668, 668, 668,
+	669, 669, 669, 669, 669, 669, 669, 669, 670, 671, 0, 0, 0, 0, 0, 0,
+	672, 672, 672, 672, 672, 672, 672, 672, 0, 0, 0, 0, 0, 0, 0, 0,
+	673, 673, 673, 673, 673, 673, 673, 673, 674, 674, 674, 674, 674, 674, 674, 674,
+	675, 675, 675, 675, 675, 675, 675, 675, 676, 676, 676, 676, 676, 676, 676, 676,
+	677, 677, 677, 677, 677, 677, 677, 677, 678, 679, 0, 0, 0, 0, 0, 0,
+	680, 680, 680, 680, 680, 680, 680, 680, 0, 0, 0, 0, 0, 0, 0, 0,
+	681, 681, 681, 681, 681, 681, 681, 681, 682, 682, 682, 682, 682, 682, 682, 682,
+	683, 683, 683, 683, 683, 683, 683, 683, 684, 684, 684, 684, 684, 684, 684, 684,
+	685, 685, 685, 685, 685, 685, 685, 685, 686, 687, 0, 0, 0, 0, 0, 0,
+	688, 688, 688, 688, 688, 688, 688, 688, 0, 0, 0, 0, 0, 0, 0, 0,
+	689, 689, 689, 689, 689, 689, 689, 689, 690, 690, 690, 690, 690, 690, 690, 690,
+	691, 691, 691, 691, 691, 691, 691, 691, 692, 692, 692, 692, 692, 692, 692, 692,
+	693, 693, 693, 693, 693, 693, 693, 693, 694, 695, 696, 697, 698, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	587, 587, 587, 587, 587, 587, 587, 587, 0, 0, 0, 0, 0, 0, 0, 0,
+	588, 588, 588, 588, 588, 588, 588, 588, 589, 589, 589, 589, 589, 589, 589, 589,
+	590, 590, 590, 590, 590, 590, 590, 590, 591, 591, 591, 591, 591, 591, 591, 591,
+	592, 592, 592, 592, 592, 592, 592, 592, 593, 594, 595, 596, 597, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	598, 598, 598, 598, 598, 598, 598, 598, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 599, 599, 599, 599, 599, 599, 599, 599,
+	600, 600, 600, 600, 600, 600, 600, 600, 601, 602, 603, 604, 0, 0, 0, 0,
+	699, 699, 699, 699, 699, 699, 699, 699, 0, 0, 0, 0, 0, 0, 0, 0,
+	700, 700, 700, 700, 700, 700, 700, 700, 701, 701, 701, 701, 701, 701, 701, 701,
+	702, 702, 702, 702, 702, 702, 702, 702, 703, 703, 703, 703, 703, 703, 703, 703,
+	704, 704, 704, 704, 704, 704, 704, 704, 705, 706, 0, 0, 0, 0, 0, 0,
+	707, 707, 707, 707, 707, 707, 707, 707, 0, 0, 0, 0, 0, 0, 0, 0,
+	708, 708, 708, 708, 708, 708, 708, 708, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 709, 709, 709, 709, 709, 709, 709, 709,
+	710, 710, 710, 710, 710, 710, 710, 710, 711, 712, 713, 714, 0, 0, 0, 0,
+	715, 715, 715, 715, 715, 715, 715, 715, 0, 0, 0, 0, 0, 0, 0, 0,
+	716, 716, 716, 716, 716, 716, 716, 716, 0, 0, 0, 0, 0, 0, 0, 0,
+	717, 717, 717, 717, 717, 717, 717, 717, 718, 718, 718, 718, 718, 718, 718, 718,
+	719, 719, 719, 719, 719, 719, 719, 719, 720, 721, 0, 0, 0, 0, 0, 0,
+	722, 722, 722, 722, 722, 722, 722, 722, 0, 0, 0, 0, 0, 0, 0, 0,
+	723, 723, 723, 723, 723, 723, 723, 723, 0, 0, 0, 0, 0, 0, 0, 0,
+	724, 724, 724, 724, 724, 724, 724, 724, 725, 725, 725, 725, 725, 725, 725, 725,
+	726, 726, 726, 726, 726, 726, 726, 726, 727, 728, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	587, 587, 587, 587, 587, 587, 587, 587, 0, 0, 0, 0, 0, 0, 0, 0,
+	588, 588, 588, 588, 588, 588, 588, 588, 589, 589, 589, 589, 589, 589, 589, 589,
+	590, 590, 590, 590, 590, 590, 590, 590, 591, 591, 591, 591, 591, 591, 591, 591,
+	592, 592, 592, 592, 592, 592, 592, 592, 593, 594, 595, 596, 597, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	598, 598, 598, 598, 598, 598, 598, 598, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 599, 599, 599, 599, 599, 599, 599, 599,
+	600, 600, 600, 600, 600, 600, 600, 600, 601, 602, 603, 604, 0, 0, 0, 0,
+	729, 729, 729, 729, 729, 729, 729, 729, 0, 0, 0, 0, 0, 0, 0, 0,
+	730, 730, 730, 730, 730, 730, 730, 730, 731, 731, 731, 731, 731, 731, 731, 731,
+	732, 732, 732, 732, 732, 732, 732, 732, 733, 733, 733, 733, 733, 733, 733, 733,
+	734, 734, 734, 734, 734, 734, 734, 734, 735, 736, 737, 738, 739, 0, 0, 0,
+	740, 740, 740, 740, 740, 740, 740, 740, 741, 741, 741, 741, 741, 741, 741, 741,
+	742, 742, 742, 742, 742, 742, 742, 742, 743, 743, 743, 743, 743, 743, 743, 743,
+	744, 744, 744, 744, 744, 744, 744, 744, 745, 745, 745, 745, 745, 745, 745, 745,
+	746, 746, 746, 746, 746, 746, 746, 746, 747, 748, 749, 750, 751, 0, 0, 0,
+	752, 752, 752, 752, 752, 752, 752, 752, 753, 753, 753, 753, 753, 753, 753, 753,
+	754, 754, 754, 754, 754, 754, 754, 754, 755, 755, 755, 755, 755, 755, 755, 755,
+	756, 756, 756, 756, 756, 756, 756, 756, 757, 757, 757, 757, 757, 757, 757, 757,
+	758, 758, 758, 758, 758, 758, 758, 758, 759, 760, 761, 762, 763, 0, 0, 0,
+	764, 764, 764, 764, 764, 764, 764, 764, 0, 0, 0, 0, 0, 0, 0, 0,
+	765, 765, 765, 765, 765, 765, 765, 765, 766, 766, 766, 766, 766, 766, 766, 766,
+	767, 767, 767, 767, 767, 767, 767, 767, 768, 768, 768, 768, 768, 768, 768, 768,
+	769, 769, 769, 769, 769, 769, 769, 769, 770, 771, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	587, 587, 587, 587, 587, 587, 587, 587, 0, 0, 0, 0, 0, 0, 0, 0,
+	588, 588, 588, 588, 588, 588, 588, 588, 589, 589, 589, 589, 589, 589, 589, 589,
+	590, 590, 590, 590, 590, 590, 590, 590, 591, 591, 591, 591, 591, 591, 591, 591,
+	592, 592, 592, 592, 592, 592, 592, 592, 593, 594, 595, 596, 597, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	598, 598, 598, 598, 598, 598, 598, 598, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 599, 599, 599, 599, 599, 599, 599, 599,
+	600, 600, 600, 600, 600, 600, 600, 600, 601, 602, 603, 604, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	772, 772, 772, 772, 772, 772, 772, 772, 773, 773, 773, 773, 773, 773, 773, 773,
+	0, 0, 0, 0, 0, 0, 0, 0, 774, 774, 774, 774, 774, 774, 774, 774,
+	775, 775, 775, 775, 775, 775, 775, 775, 776, 777, 778, 779, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	780, 780, 780, 780, 780, 780, 780, 780, 781, 781, 781, 781, 781, 781, 781, 781,
+	0, 0, 0, 0, 0, 0, 0, 0, 782, 782, 782, 782, 782, 782, 782, 782,
+	783, 783, 783, 783, 783, 783, 783, 783, 784, 785, 786, 787, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	587, 587, 587, 587, 587, 587, 587, 587, 0, 0, 0, 0, 0, 0, 0, 0,
+	588, 588, 588, 588, 588, 588, 588, 588, 589, 589, 589, 589, 589, 589, 589, 589,
+	590, 590, 590, 590, 590, 590, 590, 590, 591, 591, 591, 591, 591, 591, 591, 591,
+	592, 592, 592, 592, 592, 592, 592, 592, 593, 594, 595, 596, 597, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	598, 598, 598, 598, 598, 598, 598, 598, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 599, 599, 599, 599, 599, 599, 599, 599,
+	600, 600, 600, 600, 600, 600, 600, 600, 601, 602, 603, 604, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788, 788,
+	789, 789, 789, 789, 789, 789, 789, 789, 790, 790, 790, 790, 790, 790, 790, 790,
+	791, 791, 791, 791, 791, 791, 791, 791, 792, 792, 792, 792, 792, 792, 792, 792,
+	793, 794, 795, 796, 797, 798, 799, 800, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	801, 801, 801, 801, 801, 801, 801, 801, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 802, 802, 802, 802, 802, 802, 802, 802,
+	803, 803, 803, 803, 803, 803, 803, 803, 804, 805, 806, 807, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	808, 808, 808, 808, 808, 808, 808, 808, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 809, 809, 809, 809, 809, 809, 809, 809,
+	810, 810, 810, 810, 810, 810, 810, 810, 811, 812, 813, 814, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	587, 587, 587, 587, 587, 587, 587, 587, 0, 0, 0, 0, 0, 0, 0, 0,
+	588, 588, 588, 588, 588, 588, 588, 588, 589, 589, 589, 589, 589, 589, 589, 589,
+	590, 590, 590, 590, 590, 590, 590, 590, 591, 591, 591, 591, 591, 591, 591, 591,
+	592, 592, 592, 592, 592, 592, 592, 592, 593, 594, 595, 596, 597, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	598, 598, 598, 598, 598, 598, 598, 598, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 599, 599, 599, 599, 599, 599, 599, 599,
+	600, 600, 600, 600, 600, 600, 600, 600, 601, 602, 603, 604, 0, 0, 0, 0,
+	815, 815, 815, 815, 815, 815, 815, 815, 0, 0, 0, 0, 0, 0, 0, 0,
+	816, 816, 816, 816, 816, 816, 816, 816, 817, 817, 817, 817, 817, 817, 817, 817,
+	818, 818, 818, 818, 818, 818, 818, 818, 819, 819, 819, 819, 819, 819, 819, 819,
+	820, 820, 820, 820, 820, 820, 820, 820, 821, 822, 0, 0, 0, 0, 0, 0,
+	823, 823, 823, 823, 823, 823, 823, 823, 824, 824, 824, 824, 824, 824, 824, 824,
+	825, 825, 825, 825, 825, 825, 825, 825, 826, 826, 826, 826, 826, 826, 826, 826,
+	827, 827, 827, 827, 827, 827, 827, 827, 828, 828, 828, 828, 828, 828, 828, 828,
+	829, 829, 829, 829, 829, 829, 829, 829, 830, 831, 0, 0, 0, 0, 0, 0,
+	832, 832, 832, 832, 832, 832, 832, 832, 833, 833, 833, 833, 833, 833, 833, 833,
+	834, 834, 834, 834, 834, 834, 834, 834, 835, 835, 835, 835, 835, 835, 835, 835,
+	836, 836, 836, 836, 836, 836, 836, 836, 837, 837, 837, 837, 837, 837, 837, 837,
+	838, 838, 838, 838, 838, 838, 838, 838, 839, 840, 0, 0, 0, 0, 0, 0,
+	841, 841, 841, 841, 841, 841, 841, 841, 842, 842, 842, 842, 842, 842, 842, 842,
+	843, 843, 843, 843, 843, 843, 843, 843, 844, 844, 844, 844, 844, 844, 844, 844,
+	845, 845, 845, 845, 845, 845, 845, 845, 846, 846, 846, 846, 846, 846, 846, 846,
+	847, 847, 847, 847, 847, 847, 847, 847, 848, 849, 0, 0, 0, 0, 0, 0,
+	850, 850, 850, 850, 850, 850, 850, 850, 0, 0, 0, 0, 0, 0, 0, 0,
+	851, 851, 851, 851, 851, 851, 851, 851, 852, 852, 852, 852, 852, 852, 852, 852,
+	853, 853, 853, 853, 853, 853, 853, 853, 854, 854, 854, 854, 854, 854, 854, 854,
+	855, 855, 855, 855, 855, 855, 855, 855, 856, 857, 0, 0, 0, 0, 0, 0,
+	858, 858, 858, 858, 858, 858, 858, 858, 859, 859, 859, 859, 859, 859, 859, 859,
+	860, 860, 860, 860, 860, 860, 860, 860, 861, 861, 861, 861, 861, 861, 861, 861,
+	862, 862, 862, 862, 862, 862, 862, 862, 863, 863, 863, 863, 863, 863, 863, 863,
+	864, 864, 864, 864, 864, 864, 864, 864, 865, 866, 0, 0, 0, 0, 0, 0,
+	867, 867, 867, 867, 867, 867, 867, 867, 868, 868, 868, 868, 868, 868, 868, 868,
+	869, 869, 869, 869, 869, 869, 869, 869, 870, 870, 870, 870, 870, 870, 870, 870,
+	871, 871, 871, 871, 871, 871, 871, 871, 872, 872, 872, 872, 872, 872, 872, 872,
+	873, 873, 873, 873, 873, 873, 873, 873, 874, 875, 0, 0, 0, 0, 0, 0,
+	876, 876, 876, 876, 876, 876, 876, 876, 877, 877, 877, 877, 877, 877, 877, 877,
+	878, 878, 878, 878, 878, 878, 878, 878, 879, 879, 879, 879, 879, 879, 879, 879,
+	880, 880, 880, 880, 880, 880, 880, 880, 881, 881, 881, 881, 881, 881, 881, 881,
+	882, 882, 882, 882, 882, 882, 882, 882, 883, 884, 0, 0, 0, 0, 0, 0,
+	815, 815, 815, 815, 815, 815, 815, 815, 0, 0, 0, 0, 0, 0, 0, 0,
+	816, 816, 816, 816, 816, 816, 816, 816, 817, 817, 817, 817, 817, 817, 817, 817,
+	818, 818, 818, 818, 818, 818, 818, 818, 819, 819, 819, 819, 819, 819, 819, 819,
+	820, 820, 820, 820, 820, 820, 820, 820, 821, 822, 0, 0, 0, 0, 0, 0,
+	823, 823, 823, 823, 823, 823, 823, 823, 824, 824, 824, 824, 824, 824, 824, 824,
+	825, 825, 825, 825, 825, 825, 825, 825, 826, 826, 826, 826, 826, 826, 826, 826,
+	827, 827, 827, 827, 827, 827, 827, 827, 828, 828, 828, 828, 828, 828, 828, 828,
+	829, 829, 829, 829, 829, 829, 829, 829, 830, 831, 0, 0, 0, 0, 0, 0,
+	832, 832, 832, 832, 832, 832, 832, 832, 833, 833, 833, 833, 833, 833, 833, 833,
+	834, 834, 834, 834, 834, 834, 834, 834, 835, 835, 835, 835, 835, 835, 835, 835,
+	836, 836, 836, 836, 836, 836, 836, 836, 837, 837, 837, 837, 837, 837, 837, 837,
+	838, 838, 838, 838, 838, 838, 838, 838, 839, 840, 0, 0, 0, 0, 0, 0,
+	885, 885, 885, 885, 885, 885, 885, 885, 886, 886, 886, 886, 886, 886, 886, 886,
+	887, 887, 887, 887, 887, 887, 887, 887, 888, 888, 888, 888, 888, 888, 888, 888,
+	889, 889, 889, 889, 889, 889, 889, 889, 890, 890, 890, 890, 890, 890, 890, 890,
+	891, 891, 891, 891, 891, 891, 891, 891, 892, 893, 0, 0, 0, 0, 0, 0,
+	850, 850, 850, 850, 850, 850, 850, 850, 0, 0, 0, 0, 0, 0, 0, 0,
+	851, 851, 851, 851, 851, 851, 851, 851, 852, 852, 852, 852, 852, 852, 852, 852,
+	853, 853, 853, 853, 853, 853, 853, 853, 854, 854, 854, 854, 854, 854, 854, 854,
+	855, 855, 855, 855, 855, 855, 855, 855, 856, 857, 0, 0, 0, 0, 0, 0,
+	858, 858, 858, 858, 858, 858, 858, 858, 859, 859, 859, 859, 859, 859, 859, 859,
+	860, 860, 860, 860, 860, 860, 860, 860, 861, 861, 861, 861, 861, 861, 861, 861,
+	862, 862, 862, 862, 862, 862, 862, 862, 863, 863, 863, 863, 863, 863, 863, 863,
+	864, 864, 864, 864, 864, 864, 864, 864, 865, 866, 0, 0, 0, 0, 0, 0,
+	867, 867, 867, 867, 867, 867, 867, 867, 868, 868, 868, 868, 868, 868, 868, 868,
+	869, 869, 869, 869, 869, 869, 869, 869, 870, 870, 870, 870, 870, 870, 870, 870,
+	871, 871, 871, 871, 871, 871, 871, 871, 872, 872, 872, 872, 872, 872, 872, 872,
+	873, 873, 873, 873, 873, 873, 873, 873, 874, 875, 0, 0, 0, 0, 0, 0,
+	894, 894, 894, 894, 894, 894, 894, 894, 895, 895, 895, 895, 895, 895, 895, 895,
+	896, 896, 896, 896, 896, 896, 896, 896, 897, 897, 897, 897, 897, 897, 897, 897,
+	898, 898, 898, 898, 898, 898, 898, 898, 899, 899, 899, 899, 899, 899, 899, 899,
+	900, 900, 900, 900, 900, 900, 900, 900, 901, 902, 0, 0, 0, 0, 0, 0,
+	815, 815, 815, 815, 815, 815, 815, 815, 0, 0, 0, 0, 0, 0, 0, 0,
+	816, 816, 816, 816, 816, 816, 816, 816, 817, 817, 817, 817, 817, 817, 817, 817,
+	818, 818, 818, 818, 818, 818, 818, 818, 819, 819, 819, 819, 819, 819, 819, 819,
+	820, 820, 820, 820, 820, 820, 820, 820, 821, 822, 0, 0, 0, 0, 0, 0,
+	823, 823, 823, 823, 823, 823, 823, 823, 824, 824, 824, 824, 824, 824, 824, 824,
+	825, 825, 825, 825, 825, 825, 825, 825, 826, 826, 826, 826, 826, 826, 826, 826,
+	827, 827, 827, 827, 827, 827, 827, 827, 828, 828, 828, 828, 828, 828, 828, 828,
+	829, 829, 829, 829, 829, 829, 829, 829, 830, 831, 0, 0, 0, 0, 0, 0,
+	832, 832, 832, 832, 832, 832, 832, 832, 833, 833, 833, 833, 833, 833, 833, 833,
+	834, 834, 834, 834, 834, 834, 834, 834, 835, 835, 835, 835, 835, 835, 835, 835,
+	836, 836, 836, 836, 836, 836, 836, 836, 837, 837, 837, 837, 837, 837, 837, 837,
+	838, 838, 838, 838, 838, 838, 838, 838, 839, 840, 0, 0, 0, 0, 0, 0,
+	903, 903, 903, 903, 903, 903, 903, 903, 904, 904, 904, 904, 904, 904, 904, 904,
+	905, 905, 905, 905, 905, 905, 905, 905, 906, 906, 906, 906, 906, 906, 906, 906,
+	907, 907, 907, 907, 907, 907, 907, 907, 908, 908, 908, 908, 908, 908, 908, 908,
+	909, 909, 909, 909, 909, 909, 909, 909, 910, 911, 0, 0, 0, 0, 0, 0,
+	850, 850, 850, 850, 850, 850, 850, 850, 0, 0, 0, 0, 0, 0, 0, 0,
+	851, 851, 851, 851, 851, 851, 851, 851, 852, 852, 852, 852, 852, 852, 852, 852,
+	853, 853, 853, 853, 853, 853, 853, 853, 854, 854, 854, 854, 854, 854, 854, 854,
+	855, 855, 855, 855, 855, 855, 855, 855, 856, 857, 0, 0, 0, 0, 0, 0,
+	858, 858, 858, 858, 858, 858, 858, 858, 859, 859, 859, 859, 859, 859, 859, 859,
+	860, 860, 860, 860, 860, 860, 860, 860, 861, 861, 861, 861, 861, 861, 861, 861,
+	862, 862, 862, 862, 862, 862, 862, 862, 863, 863, 863, 863, 863, 863, 863, 863,
+	864, 864, 864, 864, 864, 864, 864, 864, 865, 866, 0, 0, 0, 0, 0, 0,
+	867, 867, 867, 867, 867, 867, 867, 867, 868, 868, 868, 868, 868, 868, 868, 868,
+	869, 869, 869, 869, 869, 869, 869, 869, 870, 870, 870, 870, 870, 870, 870, 870,
+	871, 871, 871, 871, 871, 871, 871, 871, 872, 872, 872, 872, 872, 872, 872, 872,
+	873, 873, 873, 873, 873, 873, 873, 873, 874, 875, 0, 0, 0, 0, 0, 0,
+	912, 912, 912, 912, 912, 912, 912, 912, 913, 913, 913, 913, 913, 913, 913, 913,
+	914, 914, 914, 914, 914, 914, 914, 914, 915, 915, 915, 915, 915, 915, 915, 915,
+	916, 916, 916, 916, 916, 916, 916, 916, 917, 917, 917, 917, 917, 917, 917, 917,
+	918, 918, 918, 918, 918, 918, 918, 918, 919, 920, 0, 0, 0, 0, 0, 0,
+	815, 815, 815, 815, 815, 815, 815, 815, 0, 0, 0, 0, 0, 0, 0, 0,
+	816, 816, 816, 816, 816, 816, 816, 816, 817, 817, 817, 817, 817, 817, 817, 817,
+	818, 818, 818, 818, 818, 818, 818, 818, 819, 819, 819, 819, 819, 819, 819, 819,
+	820, 820, 820, 820, 820, 820, 820, 820, 821, 822, 0, 0, 0, 0, 0, 0,
+	823, 823, 823, 823, 823, 823, 823, 823, 824, 824, 824, 824, 824, 824, 824, 824,
+	825, 825, 825, 825, 825, 825, 825, 825, 826, 826, 826, 826, 826, 826, 826, 826,
+	827, 827, 827, 827, 827, 827, 827, 827, 828, 828, 828, 828, 828, 828, 828, 828,
+	829, 829, 829, 829, 829, 829, 829, 829, 830, 831, 0, 0, 0, 0, 0, 0,
+	832, 832, 832, 832, 832, 832, 832, 832, 833, 833, 833, 833, 833, 833, 833, 833,
+	834, 834, 834, 834, 834, 834, 834, 834, 835, 835, 835, 835, 835, 835, 835, 835,
+	836, 836, 836, 836, 836, 836, 836, 836, 837, 837, 837, 837, 837, 837, 837, 837,
+	838, 838, 838, 838, 838, 838, 838, 838, 839, 840, 0, 0, 0, 0, 0, 0,
+	921, 921, 921, 921, 921, 921, 921, 921, 922, 922, 922, 922, 922, 922, 922, 922,
+	923, 923, 923, 923, 923, 923, 923, 923, 924, 924, 924, 924, 924, 924, 924, 924,
+	925, 925, 925, 925, 925, 925, 925, 925, 926, 926, 926, 926, 926, 926, 926, 926,
+	927, 927, 927, 927, 927, 927, 927, 927, 928, 929, 0, 0, 0, 0, 0, 0,
+	850, 850, 850, 850, 850, 850, 850, 850, 0, 0, 0, 0, 0, 0, 0, 0,
+	851, 851, 851, 851, 851, 851, 851, 851, 852, 852, 852, 852, 852, 852, 852, 852,
+	853, 853, 853, 853, 853, 853, 853, 853, 854, 854, 854, 854, 854, 854, 854, 854,
+	855, 855, 855, 855, 855, 855, 855, 855, 856, 857, 0, 0, 0, 0, 0, 0,
+	858, 858, 858, 858, 858, 858, 858, 858, 859, 859, 859, 859, 859, 859, 859, 859,
+	860, 860, 860, 860, 860, 860, 860, 860, 861, 861, 861, 861, 861, 861, 861, 861,
+	862, 862, 862, 862, 862, 862, 862, 862, 863, 863, 863, 863, 863, 863, 863, 863,
+	864, 864, 864, 864, 864, 864, 864, 864, 865, 866, 0, 0, 0, 0, 0, 0,
+	867, 867, 867, 867, 867, 867, 867, 867, 868, 868, 868, 868, 868, 868, 868, 868,
+	869, 869, 869, 869, 869, 869, 869, 869, 870, 870, 870, 870, 870, 870, 870, 870,
+	871, 871, 871, 871, 871, 871, 871, 871, 872, 872, 872, 872, 872, 872, 872, 872,
+	873, 873, 873, 873, 873, 873, 873, 873, 874, 875, 0, 0, 0, 0, 0, 0,
+	930, 930, 930, 930, 930, 930, 930, 930, 931, 931, 931, 931, 931, 931, 931, 931,
+	932, 932, 932, 932, 932, 932, 932, 932, 933, 933, 933, 933, 933, 933, 933, 933,
+	934, 934, 934, 934, 934, 934, 934, 934, 935, 935, 935, 935, 935, 935, 935, 935,
+	936, 936, 936, 936, 936, 936, 936, 936, 937, 938, 0, 0, 0, 0, 0, 0,
+	815, 815, 815, 815, 815, 815, 815, 815, 0, 0, 0, 0, 0, 0, 0, 0,
+	816, 816, 816, 816, 816, 816, 816, 816, 817, 817, 817, 817, 817, 817, 817, 817,
+	818, 818, 818, 818, 818, 818, 818, 818, 819, 819, 819, 819, 819, 819, 819, 819,
+	820, 820, 820, 820, 820, 820, 820, 820, 821, 822, 0, 0, 0, 0, 0, 0,
+	823, 823, 823, 823, 823, 823, 823, 823, 824, 824, 824, 824, 824, 824, 824, 824,
+	825, 825, 825, 825, 825, 825, 825, 825, 826, 826, 826, 826, 826, 826, 826, 826,
+	827, 827, 827, 827, 827, 827, 827, 827, 828, 828, 828, 828, 828, 828, 828, 828,
+	829, 829, 829, 829, 829, 829, 829, 829, 830, 831, 0, 0, 0, 0, 0, 0,
+	832, 832, 832, 832, 832, 832, 832, 832, 833, 833, 833, 833, 833, 833, 833, 833,
+	834, 834, 834, 834, 834, 834, 834, 834, 835, 835, 835, 835, 835, 835, 835, 835,
+	836, 836, 836, 836, 836, 836, 836, 836, 837, 837, 837, 837, 837, 837, 837, 837,
+	838, 838, 838, 838, 838, 838, 838, 838, 839, 840, 0, 0, 0, 0, 0, 0,
+	939, 939, 939, 939, 939, 939, 939, 939, 940, 940, 940, 940, 940, 940, 940, 940,
+	941, 941, 941, 941, 941, 941, 941, 941, 942, 942, 942, 942, 942, 942, 942, 942,
+	943, 943, 943, 943, 943, 943, 943, 943, 944, 944, 944, 944, 944, 944, 944, 944,
+	945, 945, 945, 945, 945, 945, 945, 945, 946, 947, 0, 0, 0, 0, 0, 0,
+	850, 850, 850, 850, 850, 850, 850, 850, 0, 0, 0, 0, 0, 0, 0, 0,
+	851, 851, 851, 851, 851, 851, 851, 851, 852, 852, 852, 852, 852, 852, 852, 852,
+	853, 853, 853, 853, 853, 853, 853, 853, 854, 854, 854, 854, 854, 854, 854, 854,
+	855, 855, 855, 855, 855, 855, 855, 855, 856, 857, 0, 0, 0, 0, 0, 0,
+	858, 858, 858, 858, 858, 858, 858, 858, 859, 859, 859, 859, 859, 859, 859, 859,
+	860, 860, 860, 860, 860, 860, 860, 860, 861, 861, 861, 861, 861, 861, 861, 861,
+	862, 862, 862, 862, 862, 862, 862, 862, 863, 863, 863, 863, 863, 863, 863, 863,
+	864, 864, 864, 864, 864, 864, 864, 864, 865, 866, 0, 0, 0, 0, 0, 0,
+	867, 867, 867, 867, 867, 867, 867, 867, 868, 868, 868, 868, 868, 868, 868, 868,
+	869, 869, 869, 869, 869, 869, 869, 869, 870, 870, 870, 870, 870, 870, 870, 870,
+	871, 871, 871, 871, 871, 871, 871, 871, 872, 872, 872, 872, 872, 872, 872, 872,
+	873, 873, 873, 873, 873, 873, 873, 873, 874, 875, 0, 0, 0, 0, 0, 0,
+	948, 948, 948, 948, 948, 948, 948, 948, 949, 949, 949, 949, 949, 949, 949, 949,
+	950, 950, 950, 950, 950, 950, 950, 950, 951, 951, 951, 951, 951, 951, 951, 951,
+	952, 952, 952, 952, 952, 952, 952, 952, 953, 953, 953, 953, 953, 953, 953, 953,
+	954, 954, 954, 954, 954, 954, 954, 954, 955, 956, 0, 0, 0, 0, 0, 0,
+	815, 815, 815, 815, 815, 815, 815, 815, 0, 0, 0, 0, 0, 0, 0, 0,
+	816, 816, 816, 816, 816, 816, 816, 816, 817, 817, 817, 817, 817, 817, 817, 817,
+	818, 818, 818, 818, 818, 818, 818, 818, 819, 819, 819, 819, 819, 819, 819, 819,
+	820, 820, 820, 820, 820, 820, 820, 820, 821, 822, 0, 0, 0, 0, 0, 0,
+	823, 823, 823, 823, 823, 823, 823, 823, 824, 824, 824, 824, 824, 824, 824, 824,
+	825, 825, 825, 825, 825, 825, 825, 825, 826, 826, 826, 826, 826, 826, 826, 826,
+	827, 827, 827, 827, 827, 827, 827, 827, 828, 828, 828, 828, 828, 828, 828, 828,
+	829, 829, 829, 829, 829, 829, 829, 829, 830, 831, 0, 0, 0, 0, 0, 0,
+	832, 832, 832, 832, 832, 832, 832, 832, 833, 833, 833, 833, 833, 833, 833, 833,
+	834, 834, 834, 834, 834, 834, 834, 834, 835, 835, 835, 835, 835, 835, 835, 835,
+	836, 836, 836, 836, 836, 836, 836, 836, 837, 837, 837, 837, 837, 837, 837, 837,
+	838, 838, 838, 838, 838, 838, 838, 838, 839, 840, 0, 0, 0, 0, 0, 0,
+	957, 957, 957, 957, 957, 957, 957, 957, 958, 958, 958, 958, 958, 958, 958, 958,
+	959, 959, 959, 959, 959, 959, 959, 959, 960, 960, 960, 960, 960, 960, 960, 960,
+	961, 961, 961, 961, 961, 961, 961, 961, 962, 962, 962, 962, 962, 962, 962, 962,
+	963, 963, 963, 963, 963, 963, 963, 963, 964, 965, 0, 0, 0, 0, 0, 0,
+	850, 850, 850, 850, 850, 850, 850, 850, 0, 0, 0, 0, 0, 0, 0, 0,
+	851, 851, 851, 851, 851, 851, 851, 851, 852, 852, 852, 852, 852, 852, 852, 852,
+	853, 853, 853, 853, 853, 853, 853, 853, 854, 854, 854, 854, 854, 854, 854, 854,
+	855, 855, 855, 855, 855, 855, 855, 855, 856, 857, 0, 0, 0, 0, 0, 0,
+	858, 858, 858, 858, 858, 858, 858, 858, 859, 859, 859, 859, 859, 859, 859, 859,
+	860, 860, 860, 860, 860, 860, 860, 860, 861, 861, 861, 861, 861, 861, 861, 861,
+	862, 862, 862, 862, 862, 862, 862, 862, 863, 863, 863, 863, 863, 863, 863, 863,
+	864, 864, 864, 864, 864, 864, 864, 864, 865, 866, 0, 0, 0, 0, 0, 0,
+	867, 867, 867, 867, 867, 867, 867, 867, 868, 868, 868, 868, 868, 868, 868, 868,
+	869, 869, 869, 869, 869, 869, 869, 869, 870, 870, 870, 870, 870, 870, 870, 870,
+	871, 871, 871, 871, 871, 871, 871, 871, 872, 872, 872, 872, 872, 872, 872, 872,
+	873, 873, 873, 873, 873, 873, 873, 873, 874, 875, 0, 0, 0, 0, 0, 0,
+	966, 966, 966, 966, 966, 966, 966, 966, 967, 967, 967, 967, 967, 967, 967, 967,
+	968, 968, 968, 968, 968, 968, 968, 968, 969, 969, 969, 969, 969, 969, 969, 969,
+	970, 970, 970, 970, 970, 970, 970, 970, 971, 971, 971, 971, 971, 971, 971, 971,
+	972, 972, 972, 972, 972, 972, 972, 972, 973, 974, 0, 0, 0, 0, 0, 0,
+	815, 815, 815, 815, 815, 815, 815, 815, 0, 0, 0, 0, 0, 0, 0, 0,
+	816, 816, 816, 816, 816, 816, 816, 816, 817, 817, 817, 817, 817, 817, 817, 817,
+	818, 818, 818, 818, 818, 818, 818, 818, 819, 819, 819, 819, 819, 819, 819, 819,
+	820, 820, 820, 820, 820, 820, 820, 820, 821, 822, 0, 0, 0, 0, 0, 0,
+	823, 823, 823, 823, 823, 823, 823, 823, 824, 824, 824, 824, 824, 824, 824, 824,
+	825, 825, 825, 825, 825, 825, 825, 825, 826, 826, 826, 826, 826, 826, 826, 826,
+	827, 827, 827, 827, 827, 827, 827, 827, 828, 828, 828, 828, 828, 828, 828, 828,
+	829, 829, 829, 829, 829, 829, 829, 829, 830, 831, 0, 0, 0, 0, 0, 0,
+	832, 832, 832, 832, 832, 832, 832, 832, 833, 833, 833, 833, 833, 833, 833, 833,
+	834, 834, 834, 834, 834, 834, 834, 834, 835, 835, 835, 835, 835, 835, 835, 835,
+	836, 836, 836, 836, 836, 836, 836, 836, 837, 837, 837, 837, 837, 837, 837, 837,
+	838, 838, 838, 838, 838, 838, 838, 838, 839, 840, 0, 0, 0, 0, 0, 0,
+	975, 975, 975, 975, 975, 975, 975, 975, 976, 976, 976, 976, 976, 976, 976, 976,
+	977, 977, 977, 977, 977, 977, 977, 977, 978, 978, 978, 978, 978, 978, 978, 978,
+	979, 979, 979, 979, 979, 979, 979, 979, 980, 980, 980, 980, 980, 980, 980, 980,
+	981, 981, 981, 981, 981, 981, 981, 981, 982, 983, 0, 0, 0, 0, 0, 0,
+	850, 850, 850, 850, 850, 850, 850, 850, 0, 0, 0, 0, 0, 0, 0, 0,
+	851, 851, 851, 851, 851, 851, 851, 851, 852, 852, 852, 852, 852, 852, 852, 852,
+	853, 853, 853, 853, 853, 853, 853, 853, 854, 854, 854, 854, 854, 854, 854, 854,
+	855, 855, 855, 855, 855, 855, 855, 855, 856, 857, 0, 0, 0, 0, 0, 0,
+	858, 858, 858, 858, 858, 858, 858, 858, 859, 859, 859, 859, 859, 859, 859, 859,
+	860, 860, 860, 860, 860, 860, 860, 860, 861, 861, 861, 861, 861, 861, 861, 861,
+	862, 862, 862, 862, 862, 862, 862, 862, 863, 863, 863, 863, 863, 863, 863, 863,
+	864, 864, 864, 864, 864, 864, 864, 864, 865, 866, 0, 0, 0, 0, 0, 0,
+	867, 867, 867, 867, 867, 867, 867, 867, 868, 868, 868, 868, 868, 868, 868, 868,
+	869, 869, 869, 869, 869, 869, 869, 869, 870, 870, 870, 870, 870, 870, 870, 870,
+	871, 871, 871, 871, 871, 871, 871, 871, 872, 872, 872, 872, 872, 872, 872, 872,
+	873, 873, 873, 873, 873, 873, 873, 873, 874, 875, 0, 0, 0, 0, 0, 0,
+	984, 984, 984, 984, 984, 984, 984, 984, 985, 985, 985, 985, 985, 985, 985, 985,
+	986, 986, 986, 986, 986, 986, 986, 986, 987, 987, 987, 987, 987, 987, 987, 987,
+	988, 988, 988, 988, 988, 988, 988, 988, 989, 989, 989, 989, 989, 989, 989, 989,
+	990, 990, 990, 990, 990, 990, 990, 990, 991, 992, 0, 0, 0, 0, 0, 0,
+	815, 815, 815, 815, 815, 815, 815, 815, 0, 0, 0, 0, 0, 0, 0, 0,
+	816, 816, 816, 816, 816, 816, 816, 816, 817, 817, 817, 817, 817, 817, 817, 817,
+	818, 818, 818, 818, 818, 818, 818, 818, 819, 819, 819, 819, 819, 819, 819, 819,
+	820, 820, 820, 820, 820, 820, 820, 820, 821, 822, 0, 0, 0, 0, 0, 0,
+	823, 823, 823, 823, 823, 823, 823, 823, 824, 824, 824, 824, 824, 824, 824, 824,
+	825, 825, 825, 825, 825, 825, 825, 825, 826, 826, 826, 826, 826, 826, 826, 826,
+	827, 827, 827, 827, 827, 827, 827, 827, 828, 828, 828, 828, 828, 828, 828, 828,
+	829, 829, 829, 829, 829, 829, 829, 829, 830, 831, 0, 0, 0, 0, 0, 0,
+	832, 832, 832, 832, 832, 832, 832, 832, 833, 833, 833, 833, 833, 833, 833, 833,
+	834, 834, 834, 834, 834, 834, 834, 834, 835, 835, 835, 835, 835, 835, 835, 835,
+	836, 836, 836, 836, 836, 836, 836, 836, 837, 837, 837, 837, 837, 837, 837, 837,
+	838, 838, 838, 838, 838, 838, 838, 838, 839, 840, 0, 0, 0, 0, 0, 0,
+	993, 993, 993, 993, 993, 993, 993, 993, 994, 994, 994, 994, 994, 994, 994, 994,
+	995, 995, 995, 995, 995, 995, 995, 995, 996, 996, 996, 996, 996, 996, 996, 996,
+	997, 997, 997, 997, 997, 997, 997, 997, 998, 998, 998, 998, 998, 998, 998, 998,
+	999, 999, 999, 999, 999, 999, 999, 999, 1000, 1001, 0, 0, 0, 0, 0, 0,
+	850, 850, 850, 850, 850, 850, 850, 850, 0, 0, 0, 0, 0, 0, 0, 0,
+	851, 851, 851, 851, 851, 851, 851, 851, 852, 852, 852, 852, 852, 852, 852, 852,
+	853, 853, 853, 853, 853, 853, 853, 853, 854, 854, 854, 854, 854, 854, 854, 854,
+	855, 855, 855, 855, 855, 855, 855, 855, 856, 857, 0, 0, 0, 0, 0, 0,
+	858, 858, 858, 858, 858, 858, 858, 858, 859, 859, 859, 859, 859, 859, 859, 859,
+	860, 860, 860, 860, 860, 860, 860, 860, 861, 861, 861, 861, 861, 861, 861, 861,
+	862, 862, 862, 862, 862, 862, 862, 862, 863, 863, 863, 863, 863, 863, 863, 863,
+	864, 864, 864, 864, 864, 864, 864, 864, 865, 866, 0, 0, 0, 0, 0, 0,
+	867, 867, 867, 867, 867, 867, 867, 867, 868, 868, 868, 868, 868, 868, 868, 868,
+	869, 869, 869, 869, 869, 869, 869, 869, 870, 870, 870, 870, 870, 870, 870, 870,
+	871, 871, 871, 871, 871, 871, 871, 871, 872, 872, 872, 872, 872, 872, 872, 872,
+	873, 873, 873, 873, 873, 873, 873, 873, 874, 875, 0, 0, 0, 0, 0, 0,
+	1002, 1002, 1002, 1002, 1002, 1002, 1002, 1002, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+	1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005,
+	1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007,
+	1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1009, 1010, 0, 0, 0, 0, 0, 0,
+	1011, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1013,
+	1014, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1016,
+	1017, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1019,
+	1020, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021,
+	1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1022,
+	1023, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+	1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1025,
+	1026, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+	1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1028,
+	1029, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1031,
+	1032, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+	1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1034,
+	1035, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1037,
+	1038, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1040,
+	1041, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1043,
+	1044, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 1046,
+	1047, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1049,
+	1050, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1052,
+	1053, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+	1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1055,
+	1056, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+	1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1058,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 0, 0, 0, 0, 0, 0, 0, 0,
+	1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
+	1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+	1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1066, 1067, 1068, 1069, 1070, 0, 0, 0,
+	1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 0, 0, 0, 0, 0, 0, 0, 0,
+	1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073,
+	1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075,
+	1076, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 1077, 1078, 1079, 1080, 1081, 0, 0, 0,
+	1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 0, 0, 0, 0, 0, 0, 0, 0,
+	1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
+	1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1086, 1086, 1086, 1086, 1086, 1086, 1086, 1086,
+	1087, 1087, 1087, 1087, 1087, 1087, 1087, 1087, 1088, 1089, 1090, 1091, 1092, 0, 0, 0,
+	1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 0, 0, 0, 0, 0, 0, 0, 0,
+	1094, 1094, 1094, 1094, 1094, 1094, 1094, 1094, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1099, 1100, 1101, 1102, 1103, 0, 0, 0,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1111, 1112, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1118, 1119, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1125, 1126, 0, 0, 0, 0, 0, 0,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 0, 0, 0, 0, 0, 0, 0, 0,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129,
+	1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1135, 1136, 1137, 0, 0, 0,
+	1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 0, 0, 0, 0, 0, 0, 0, 0,
+	1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
+	1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+	1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1066, 1067, 1068, 1069, 1070, 0, 0, 0,
+	1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 0, 0, 0, 0, 0, 0, 0, 0,
+	1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073,
+	1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075,
+	1076, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 1077, 1078, 1079, 1080, 1081, 0, 0, 0,
+	1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 0, 0, 0, 0, 0, 0, 0, 0,
+	1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
+	1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1086, 1086, 1086, 1086, 1086, 1086, 1086, 1086,
+	1087, 1087, 1087, 1087, 1087, 1087, 1087, 1087, 1088, 1089, 1090, 1091, 1092, 0, 0, 0,
+	1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 0, 0, 0, 0, 0, 0, 0, 0,
+	1094, 1094, 1094, 1094, 1094, 1094, 1094, 1094, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1099, 1100, 1101, 1102, 1103, 0, 0, 0,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1111, 1112, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1118, 1119, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1125, 1126, 0, 0, 0, 0, 0, 0,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 0, 0, 0, 0, 0, 0, 0, 0,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129,
+	1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1135, 1136, 1137, 0, 0, 0,
+	1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 0, 0, 0, 0, 0, 0, 0, 0,
+	1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
+	1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+	1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1066, 1067, 1068, 1069, 1070, 0, 0, 0,
+	1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 0, 0, 0, 0, 0, 0, 0, 0,
+	1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073,
+	1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075,
+	1076, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 1077, 1078, 1079, 1080, 1081, 0, 0, 0,
+	1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 0, 0, 0, 0, 0, 0, 0, 0,
+	1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
+	1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1086, 1086, 1086, 1086, 1086, 1086, 1086, 1086,
+	1087, 1087, 1087, 1087, 1087, 1087, 1087, 1087, 1088, 1089, 1090, 1091, 1092, 0, 0, 0,
+	1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 0, 0, 0, 0, 0, 0, 0, 0,
+	1094, 1094, 1094, 1094, 1094, 1094, 1094, 1094, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1099, 1100, 1101, 1102, 1103, 0, 0, 0,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1111, 1112, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1118, 1119, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1125, 1126, 0, 0, 0, 0, 0, 0,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 0, 0, 0, 0, 0, 0, 0, 0,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129,
+	1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1135, 1136, 1137, 0, 0, 0,
+	1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 0, 0, 0, 0, 0, 0, 0, 0,
+	1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
+	1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+	1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1066, 1067, 1068, 1069, 1070, 0, 0, 0,
+	1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 0, 0, 0, 0, 0, 0, 0, 0,
+	1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073,
+	1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075,
+	1076, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 1077, 1078, 1079, 1080, 1081, 0, 0, 0,
+	1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 0, 0, 0, 0, 0, 0, 0, 0,
+	1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
+	1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1086, 1086, 1086, 1086, 1086, 1086, 1086, 1086,
+	1087, 1087, 1087, 1087, 1087, 1087, 1087, 1087, 1088, 1089, 1090, 1091, 1092, 0, 0, 0,
+	1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 0, 0, 0, 0, 0, 0, 0, 0,
+	1094, 1094, 1094, 1094, 1094, 1094, 1094, 1094, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1099, 1100, 1101, 1102, 1103, 0, 0, 0,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1111, 1112, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1118, 1119, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1125, 1126, 0, 0, 0, 0, 0, 0,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 0, 0, 0, 0, 0, 0, 0, 0,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129,
+	1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1135, 1136, 1137, 0, 0, 0,
+	1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 0, 0, 0, 0, 0, 0, 0, 0,
+	1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
+	1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+	1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1066, 1067, 1068, 1069, 1070, 0, 0, 0,
+	1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 0, 0, 0, 0, 0, 0, 0, 0,
+	1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073,
+	1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075,
+	1076, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 1077, 1078, 1079, 1080, 1081, 0, 0, 0,
+	1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 0, 0, 0, 0, 0, 0, 0, 0,
+	1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
+	1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1086, 1086, 1086, 1086, 1086, 1086, 1086, 1086,
+	1087, 1087, 1087, 1087, 1087, 1087, 1087, 1087, 1088, 1089, 1090, 1091, 1092, 0, 0, 0,
+	1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 0, 0, 0, 0, 0, 0, 0, 0,
+	1094, 1094, 1094, 1094, 1094, 1094, 1094, 1094, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1099, 1100, 1101, 1102, 1103, 0, 0, 0,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1111, 1112, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1118, 1119, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1125, 1126, 0, 0, 0, 0, 0, 0,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 0, 0, 0, 0, 0, 0, 0, 0,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129,
+	1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1135, 1136, 1137, 0, 0, 0,
+	1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 0, 0, 0, 0, 0, 0, 0, 0,
+	1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
+	1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+	1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1066, 1067, 1068, 1069, 1070, 0, 0, 0,
+	1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 0, 0, 0, 0, 0, 0, 0, 0,
+	1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073,
+	1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075,
+	1076, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 1077, 1078, 1079, 1080, 1081, 0, 0, 0,
+	1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 0, 0, 0, 0, 0, 0, 0, 0,
+	1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
+	1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1086, 1086, 1086, 1086, 1086, 1086, 1086, 1086,
+	1087, 1087, 1087, 1087, 1087, 1087, 1087, 1087, 1088, 1089, 1090, 1091, 1092, 0, 0, 0,
+	1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 0, 0, 0, 0, 0, 0, 0, 0,
+	1094, 1094, 1094, 1094, 1094, 1094, 1094, 1094, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1099, 1100, 1101, 1102, 1103, 0, 0, 0,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1111, 1112, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1118, 1119, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1125, 1126, 0, 0, 0, 0, 0, 0,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 0, 0, 0, 0, 0, 0, 0, 0,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129,
+	1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1135, 1136, 1137, 0, 0, 0,
+	1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 0, 0, 0, 0, 0, 0, 0, 0,
+	1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
+	1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+	1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1066, 1067, 1068, 1069, 1070, 0, 0, 0,
+	1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 0, 0, 0, 0, 0, 0, 0, 0,
+	1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073,
+	1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075,
+	1076, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 1077, 1078, 1079, 1080, 1081, 0, 0, 0,
+	1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 0, 0, 0, 0, 0, 0, 0, 0,
+	1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
+	1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1086, 1086, 1086, 1086, 1086, 1086, 1086, 1086,
+	1087, 1087, 1087, 1087, 1087, 1087, 1087, 1087, 1088, 1089, 1090, 1091, 1092, 0, 0, 0,
+	1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 0, 0, 0, 0, 0, 0, 0, 0,
+	1094, 1094, 1094, 1094, 1094, 1094, 1094, 1094, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1099, 1100, 1101, 1102, 1103, 0, 0, 0,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1111, 1112, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1118, 1119, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1125, 1126, 0, 0, 0, 0, 0, 0,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 0, 0, 0, 0, 0, 0, 0, 0,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129,
+	1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1135, 1136, 1137, 0, 0, 0,
+	1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 0, 0, 0, 0, 0, 0, 0, 0,
+	1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
+	1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+	1065, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1066, 1067, 1068, 1069, 1070, 0, 0, 0,
+	1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 0, 0, 0, 0, 0, 0, 0, 0,
+	1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073,
+	1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075,
+	1076, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 1077, 1078, 1079, 1080, 1081, 0, 0, 0,
+	1082, 1082, 1082, 1082, 1082, 1082, 1082, 1082, 0, 0, 0, 0, 0, 0, 0, 0,
+	1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
+	1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1086, 1086, 1086, 1086, 1086, 1086, 1086, 1086,
+	1087, 1087, 1087, 1087, 1087, 1087, 1087, 1087, 1088, 1089, 1090, 1091, 1092, 0, 0, 0,
+	1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 0, 0, 0, 0, 0, 0, 0, 0,
+	1094, 1094, 1094, 1094, 1094, 1094, 1094, 1094, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1099, 1100, 1101, 1102, 1103, 0, 0, 0,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1105, 1105, 1105, 1105, 1105, 1105, 1105, 1105,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1109, 1109, 1109, 1109, 1109, 1109, 1109, 1109,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1111, 1112, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1115, 1115, 1115, 1115, 1115, 1115, 1115, 1115, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1118, 1119, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1121, 1121, 1121, 1121, 1121, 1121, 1121, 1121,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1123, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1125, 1126, 0, 0, 0, 0, 0, 0,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 0, 0, 0, 0, 0, 0, 0, 0,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129,
+	1130, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1135, 1136, 1137, 0, 0, 0,
+	1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 0, 0, 0, 0, 0, 0, 0, 0,
+	1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142,
+	1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1144, 1145, 1146, 1147, 1148, 0, 0, 0,
+	1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+	1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1157, 1158, 1159, 1160, 0, 0, 0,
+	1161, 1161, 1161, 1161, 1161, 1161, 1161, 1161, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+	1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166,
+	1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1168, 1169, 1170, 1171, 1172, 0, 0, 0,
+	1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174,
+	1175, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
+	1179, 1179, 1179, 1179, 1179, 1179, 1179, 1179, 1180, 1181, 1182, 1183, 1184, 0, 0, 0,
+	1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186,
+	1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188,
+	1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
+	1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191, 1192, 1193, 0, 0, 0, 0, 0, 0,
+	1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195,
+	1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+	1198, 1198, 1198, 1198, 1198, 1198, 1198, 1198, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1201, 1202, 0, 0, 0, 0, 0, 0,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1206, 1206, 1206, 1206, 1206, 1206, 1206,
+	1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208,
+	1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1210, 1211, 0, 0, 0, 0, 0, 0,
+	1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1215,
+	1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1217, 1217, 1217, 1217, 1217, 1217, 1217, 1217,
+	1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1219, 1220, 1221, 1222, 1223, 0, 0, 0,
+	1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 0, 0, 0, 0, 0, 0, 0, 0,
+	1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142,
+	1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1144, 1145, 1146, 1147, 1148, 0, 0, 0,
+	1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+	1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1157, 1158, 1159, 1160, 0, 0, 0,
+	1161, 1161, 1161, 1161, 1161, 1161, 1161, 1161, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+	1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166,
+	1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1168, 1169, 1170, 1171, 1172, 0, 0, 0,
+	1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174,
+	1175, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
+	1179, 1179, 1179, 1179, 1179, 1179, 1179, 1179, 1180, 1181, 1182, 1183, 1184, 0, 0, 0,
+	1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186,
+	1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188,
+	1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
+	1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191, 1192, 1193, 0, 0, 0, 0, 0, 0,
+	1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195,
+	1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+	1198, 1198, 1198, 1198, 1198, 1198, 1198, 1198, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1201, 1202, 0, 0, 0, 0, 0, 0,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1206, 1206, 1206, 1206, 1206, 1206, 1206,
+	1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208,
+	1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1210, 1211, 0, 0, 0, 0, 0, 0,
+	1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1215,
+	1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1217, 1217, 1217, 1217, 1217, 1217, 1217, 1217,
+	1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1219, 1220, 1221, 1222, 1223, 0, 0, 0,
+	1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 0, 0, 0, 0, 0, 0, 0, 0,
+	1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142,
+	1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1144, 1145, 1146, 1147, 1148, 0, 0, 0,
+	1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+	1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1157, 1158, 1159, 1160, 0, 0, 0,
+	1161, 1161, 1161, 1161, 1161, 1161, 1161, 1161, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+	1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166,
+	1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1168, 1169, 1170, 1171, 1172, 0, 0, 0,
+	1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174,
+	1175, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
+	1179, 1179, 1179, 1179, 1179, 1179, 1179, 1179, 1180, 1181, 1182, 1183, 1184, 0, 0, 0,
+	1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186,
+	1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188,
+	1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
+	1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191, 1192, 1193, 0, 0, 0, 0, 0, 0,
+	1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195,
+	1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+	1198, 1198, 1198, 1198, 1198, 1198, 1198, 1198, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1201, 1202, 0, 0, 0, 0, 0, 0,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1206, 1206, 1206, 1206, 1206, 1206, 1206,
+	1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208,
+	1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1210, 1211, 0, 0, 0, 0, 0, 0,
+	1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1215,
+	1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1217, 1217, 1217, 1217, 1217, 1217, 1217, 1217,
+	1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1219, 1220, 1221, 1222, 1223, 0, 0, 0,
+	1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 0, 0, 0, 0, 0, 0, 0, 0,
+	1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142,
+	1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1144, 1145, 1146, 1147, 1148, 0, 0, 0,
+	1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+	1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1157, 1158, 1159, 1160, 0, 0, 0,
+	1161, 1161, 1161, 1161, 1161, 1161, 1161, 1161, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+	1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166,
+	1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1168, 1169, 1170, 1171, 1172, 0, 0, 0,
+	1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174,
+	1175, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
+	1179, 1179, 1179, 1179, 1179, 1179, 1179, 1179, 1180, 1181, 1182, 1183, 1184, 0, 0, 0,
+	1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186,
+	1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188,
+	1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
+	1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191, 1192, 1193, 0, 0, 0, 0, 0, 0,
+	1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195,
+	1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+	1198, 1198, 1198, 1198, 1198, 1198, 1198, 1198, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1201, 1202, 0, 0, 0, 0, 0, 0,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1206, 1206, 1206, 1206, 1206, 1206, 1206,
+	1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208,
+	1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1210, 1211, 0, 0, 0, 0, 0, 0,
+	1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1215,
+	1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1217, 1217, 1217, 1217, 1217, 1217, 1217, 1217,
+	1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1219, 1220, 1221, 1222, 1223, 0, 0, 0,
+	1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 0, 0, 0, 0, 0, 0, 0, 0,
+	1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142,
+	1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1144, 1145, 1146, 1147, 1148, 0, 0, 0,
+	1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+	1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1157, 1158, 1159, 1160, 0, 0, 0,
+	1161, 1161, 1161, 1161, 1161, 1161, 1161, 1161, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+	1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166,
+	1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1168, 1169, 1170, 1171, 1172, 0, 0, 0,
+	1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174,
+	1175, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
+	1179, 1179, 1179, 1179, 1179, 1179, 1179, 1179, 1180, 1181, 1182, 1183, 1184, 0, 0, 0,
+	1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186,
+	1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188,
+	1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
+	1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191, 1192, 1193, 0, 0, 0, 0, 0, 0,
+	1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195,
+	1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+	1198, 1198, 1198, 1198, 1198, 1198, 1198, 1198, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1201, 1202, 0, 0, 0, 0, 0, 0,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1206, 1206, 1206, 1206, 1206, 1206, 1206,
+	1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208,
+	1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1210, 1211, 0, 0, 0, 0, 0, 0,
+	1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1215,
+	1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1217, 1217, 1217, 1217, 1217, 1217, 1217, 1217,
+	1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1219, 1220, 1221, 1222, 1223, 0, 0, 0,
+	1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 0, 0, 0, 0, 0, 0, 0, 0,
+	1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142,
+	1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1144, 1145, 1146, 1147, 1148, 0, 0, 0,
+	1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+	1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1157, 1158, 1159, 1160, 0, 0, 0,
+	1161, 1161, 1161, 1161, 1161, 1161, 1161, 1161, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+	1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166,
+	1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1168, 1169, 1170, 1171, 1172, 0, 0, 0,
+	1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174,
+	1175, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
+	1179, 1179, 1179, 1179, 1179, 1179, 1179, 1179, 1180, 1181, 1182, 1183, 1184, 0, 0, 0,
+	1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186,
+	1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188,
+	1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
+	1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191, 1192, 1193, 0, 0, 0, 0, 0, 0,
+	1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195,
+	1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+	1198, 1198, 1198, 1198, 1198, 1198, 1198, 1198, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1201, 1202, 0, 0, 0, 0, 0, 0,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1206, 1206, 1206, 1206, 1206, 1206, 1206,
+	1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208,
+	1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1210, 1211, 0, 0, 0, 0, 0, 0,
+	1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1215,
+	1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1217, 1217, 1217, 1217, 1217, 1217, 1217, 1217,
+	1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1219, 1220, 1221, 1222, 1223, 0, 0, 0,
+	1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 0, 0, 0, 0, 0, 0, 0, 0,
+	1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142,
+	1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1144, 1145, 1146, 1147, 1148, 0, 0, 0,
+	1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+	1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1157, 1158, 1159, 1160, 0, 0, 0,
+	1161, 1161, 1161, 1161, 1161, 1161, 1161, 1161, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+	1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166,
+	1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1168, 1169, 1170, 1171, 1172, 0, 0, 0,
+	1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174,
+	1175, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
+	1179, 1179, 1179, 1179, 1179, 1179, 1179, 1179, 1180, 1181, 1182, 1183, 1184, 0, 0, 0,
+	1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186,
+	1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188,
+	1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
+	1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191, 1192, 1193, 0, 0, 0, 0, 0, 0,
+	1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195,
+	1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+	1198, 1198, 1198, 1198, 1198, 1198, 1198, 1198, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1201, 1202, 0, 0, 0, 0, 0, 0,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1206, 1206, 1206, 1206, 1206, 1206, 1206,
+	1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208,
+	1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1210, 1211, 0, 0, 0, 0, 0, 0,
+	1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1215,
+	1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1217, 1217, 1217, 1217, 1217, 1217, 1217, 1217,
+	1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1219, 1220, 1221, 1222, 1223, 0, 0, 0,
+	1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 0, 0, 0, 0, 0, 0, 0, 0,
+	1139, 1139, 1139, 1139, 1139, 1139, 1139, 1139, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142,
+	1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1144, 1145, 1146, 1147, 1148, 0, 0, 0,
+	1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150,
+	1151, 1151, 1151, 1151, 1151, 1151, 1151, 1151, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1157, 1158, 1159, 1160, 0, 0, 0,
+	1161, 1161, 1161, 1161, 1161, 1161, 1161, 1161, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 1162,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164,
+	1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166,
+	1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1168, 1169, 1170, 1171, 1172, 0, 0, 0,
+	1173, 1173, 1173, 1173, 1173, 1173, 1173, 1173, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174,
+	1175, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176, 1176, 1176, 1176, 1176, 1176, 1176, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,
+	1179, 1179, 1179, 1179, 1179, 1179, 1179, 1179, 1180, 1181, 1182, 1183, 1184, 0, 0, 0,
+	1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186,
+	1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188,
+	1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
+	1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191, 1192, 1193, 0, 0, 0, 0, 0, 0,
+	1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195,
+	1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+	1198, 1198, 1198, 1198, 1198, 1198, 1198, 1198, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1201, 1202, 0, 0, 0, 0, 0, 0,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1206, 1206, 1206, 1206, 1206, 1206, 1206,
+	1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208,
+	1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1210, 1211, 0, 0, 0, 0, 0, 0,
+	1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1215,
+	1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1217, 1217, 1217, 1217, 1217, 1217, 1217, 1217,
+	1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1219, 1220, 1221, 1222, 1223, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1224, 1224, 1224, 1224, 1224, 1224, 1224, 1224, 0, 0, 0, 0, 0, 0, 0, 0,
+	1225, 1225, 1225, 1225, 1225, 1225, 1225, 1225, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226,
+	1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228,
+	1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1230, 1231, 1232, 1233, 1234, 0, 0, 0,
+	1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236,
+	1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238,
+	1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240,
+	1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1242, 1243, 1244, 1245, 1246, 0, 0, 0,
+	1247, 1247, 1247, 1247, 1247, 1247, 1247, 1247, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248,
+	1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
+	1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252,
+	1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1254, 1255, 1256, 1257, 1258, 0, 0, 0,
+	1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260,
+	1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262,
+	1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1267, 1268, 1269, 1270, 0, 0, 0,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1272, 1272, 1272, 1272, 1272, 1272, 1272,
+	1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
+	1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276,
+	1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1278, 1279, 0, 0, 0, 0, 0, 0,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+	1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283,
+	1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+	1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1287, 1288, 0, 0, 0, 0, 0, 0,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290,
+	1291, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292,
+	1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294,
+	1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1296, 1297, 0, 0, 0, 0, 0, 0,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1299, 1299, 1299, 1299, 1299, 1299, 1299,
+	1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1301, 1301, 1301, 1301, 1301, 1301, 1301, 1301,
+	1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303,
+	1304, 1304, 1304, 1304, 1304, 1304, 1304, 1304, 1305, 1306, 1307, 1308, 1309, 0, 0, 0,
+	1224, 1224, 1224, 1224, 1224, 1224, 1224, 1224, 0, 0, 0, 0, 0, 0, 0, 0,
+	1225, 1225, 1225, 1225, 1225, 1225, 1225, 1225, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226,
+	1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228,
+	1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1230, 1231, 1232, 1233, 1234, 0, 0, 0,
+	1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236,
+	1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238,
+	1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240,
+	1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1242, 1243, 1244, 1245, 1246, 0, 0, 0,
+	1247, 1247, 1247, 1247, 1247, 1247, 1247, 1247, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248,
+	1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
+	1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252,
+	1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1254, 1255, 1256, 1257, 1258, 0, 0, 0,
+	1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260,
+	1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262,
+	1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1267, 1268, 1269, 1270, 0, 0, 0,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1272, 1272, 1272, 1272, 1272, 1272, 1272,
+	1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
+	1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276,
+	1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1278, 1279, 0, 0, 0, 0, 0, 0,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+	1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283,
+	1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+	1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1287, 1288, 0, 0, 0, 0, 0, 0,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290,
+	1291, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292,
+	1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294,
+	1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1296, 1297, 0, 0, 0, 0, 0, 0,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1299, 1299, 1299, 1299, 1299, 1299, 1299,
+	1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1301, 1301, 1301, 1301, 1301, 1301, 1301, 1301,
+	1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303,
+	1304, 1304, 1304, 1304, 1304, 1304, 1304, 1304, 1305, 1306, 1307, 1308, 1309, 0, 0, 0,
+	1224, 1224, 1224, 1224, 1224, 1224, 1224, 1224, 0, 0, 0, 0, 0, 0, 0, 0,
+	1225, 1225, 1225, 1225, 1225, 1225, 1225, 1225, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226,
+	1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228,
+	1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1230, 1231, 1232, 1233, 1234, 0, 0, 0,
+	1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236,
+	1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238,
+	1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240,
+	1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1242, 1243, 1244, 1245, 1246, 0, 0, 0,
+	1247, 1247, 1247, 1247, 1247, 1247, 1247, 1247, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248,
+	1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
+	1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252,
+	1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1254, 1255, 1256, 1257, 1258, 0, 0, 0,
+	1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260,
+	1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262,
+	1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1267, 1268, 1269, 1270, 0, 0, 0,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1272, 1272, 1272, 1272, 1272, 1272, 1272,
+	1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
+	1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276,
+	1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1278, 1279, 0, 0, 0, 0, 0, 0,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+	1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283,
+	1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+	1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1287, 1288, 0, 0, 0, 0, 0, 0,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290,
+	1291, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292,
+	1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294,
+	1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1296, 1297, 0, 0, 0, 0, 0, 0,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1299, 1299, 1299, 1299, 1299, 1299, 1299,
+	1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1301, 1301, 1301, 1301, 1301, 1301, 1301, 1301,
+	1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303,
+	1304, 1304, 1304, 1304, 1304, 1304, 1304, 1304, 1305, 1306, 1307, 1308, 1309, 0, 0, 0,
+	1224, 1224, 1224, 1224, 1224, 1224, 1224, 1224, 0, 0, 0, 0, 0, 0, 0, 0,
+	1225, 1225, 1225, 1225, 1225, 1225, 1225, 1225, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226,
+	1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228,
+	1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1230, 1231, 1232, 1233, 1234, 0, 0, 0,
+	1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236,
+	1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238,
+	1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240,
+	1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1242, 1243, 1244, 1245, 1246, 0, 0, 0,
+	1247, 1247, 1247, 1247, 1247, 1247, 1247, 1247, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248,
+	1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
+	1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252,
+	1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1254, 1255, 1256, 1257, 1258, 0, 0, 0,
+	1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260,
+	1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262,
+	1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1267, 1268, 1269, 1270, 0, 0, 0,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1272, 1272, 1272, 1272, 1272, 1272, 1272,
+	1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
+	1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276,
+	1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1278, 1279, 0, 0, 0, 0, 0, 0,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+	1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283,
+	1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+	1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1287, 1288, 0, 0, 0, 0, 0, 0,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290,
+	1291, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292,
+	1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294,
+	1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1296, 1297, 0, 0, 0, 0, 0, 0,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1299, 1299, 1299, 1299, 1299, 1299, 1299,
+	1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1301, 1301, 1301, 1301, 1301, 1301, 1301, 1301,
+	1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303,
+	1304, 1304, 1304, 1304, 1304, 1304, 1304, 1304, 1305, 1306, 1307, 1308, 1309, 0, 0, 0,
+	1224, 1224, 1224, 1224, 1224, 1224, 1224, 1224, 0, 0, 0, 0, 0, 0, 0, 0,
+	1225, 1225, 1225, 1225, 1225, 1225, 1225, 1225, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226,
+	1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228,
+	1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1230, 1231, 1232, 1233, 1234, 0, 0, 0,
+	1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236,
+	1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238,
+	1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240,
+	1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1242, 1243, 1244, 1245, 1246, 0, 0, 0,
+	1247, 1247, 1247, 1247, 1247, 1247, 1247, 1247, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248,
+	1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
+	1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252,
+	1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1254, 1255, 1256, 1257, 1258, 0, 0, 0,
+	1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260,
+	1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262,
+	1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1267, 1268, 1269, 1270, 0, 0, 0,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1272, 1272, 1272, 1272, 1272, 1272, 1272,
+	1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
+	1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276,
+	1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1278, 1279, 0, 0, 0, 0, 0, 0,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+	1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283,
+	1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+	1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1287, 1288, 0, 0, 0, 0, 0, 0,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290,
+	1291, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292,
+	1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294,
+	1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1296, 1297, 0, 0, 0, 0, 0, 0,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1299, 1299, 1299, 1299, 1299, 1299, 1299,
+	1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1301, 1301, 1301, 1301, 1301, 1301, 1301, 1301,
+	1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303,
+	1304, 1304, 1304, 1304, 1304, 1304, 1304, 1304, 1305, 1306, 1307, 1308, 1309, 0, 0, 0,
+	1224, 1224, 1224, 1224, 1224, 1224, 1224, 1224, 0, 0, 0, 0, 0, 0, 0, 0,
+	1225, 1225, 1225, 1225, 1225, 1225, 1225, 1225, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226,
+	1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228,
+	1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1230, 1231, 1232, 1233, 1234, 0, 0, 0,
+	1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236,
+	1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238,
+	1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240,
+	1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1242, 1243, 1244, 1245, 1246, 0, 0, 0,
+	1247, 1247, 1247, 1247, 1247, 1247, 1247, 1247, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248,
+	1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
+	1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252,
+	1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1254, 1255, 1256, 1257, 1258, 0, 0, 0,
+	1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260,
+	1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262,
+	1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1267, 1268, 1269, 1270, 0, 0, 0,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1272, 1272, 1272, 1272, 1272, 1272, 1272,
+	1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
+	1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276,
+	1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1278, 1279, 0, 0, 0, 0, 0, 0,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+	1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283,
+	1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+	1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1287, 1288, 0, 0, 0, 0, 0, 0,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290,
+	1291, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292,
+	1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294,
+	1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1296, 1297, 0, 0, 0, 0, 0, 0,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1299, 1299, 1299, 1299, 1299, 1299, 1299,
+	1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1301, 1301, 1301, 1301, 1301, 1301, 1301, 1301,
+	1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303,
+	1304, 1304, 1304, 1304, 1304, 1304, 1304, 1304, 1305, 1306, 1307, 1308, 1309, 0, 0, 0,
+	1224, 1224, 1224, 1224, 1224, 1224, 1224, 1224, 0, 0, 0, 0, 0, 0, 0, 0,
+	1225, 1225, 1225, 1225, 1225, 1225, 1225, 1225, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226,
+	1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228,
+	1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1230, 1231, 1232, 1233, 1234, 0, 0, 0,
+	1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236,
+	1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238,
+	1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240,
+	1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1242, 1243, 1244, 1245, 1246, 0, 0, 0,
+	1247, 1247, 1247, 1247, 1247, 1247, 1247, 1247, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248,
+	1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
+	1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252,
+	1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1254, 1255, 1256, 1257, 1258, 0, 0, 0,
+	1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260,
+	1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262,
+	1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1267, 1268, 1269, 1270, 0, 0, 0,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1272, 1272, 1272, 1272, 1272, 1272, 1272,
+	1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
+	1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276,
+	1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1278, 1279, 0, 0, 0, 0, 0, 0,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+	1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283,
+	1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+	1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1287, 1288, 0, 0, 0, 0, 0, 0,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290,
+	1291, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292,
+	1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294,
+	1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1296, 1297, 0, 0, 0, 0, 0, 0,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1299, 1299, 1299, 1299, 1299, 1299, 1299,
+	1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1301, 1301, 1301, 1301, 1301, 1301, 1301, 1301,
+	1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303,
+	1304, 1304, 1304, 1304, 1304, 1304, 1304, 1304, 1305, 1306, 1307, 1308, 1309, 0, 0, 0,
+	1224, 1224, 1224, 1224, 1224, 1224, 1224, 1224, 0, 0, 0, 0, 0, 0, 0, 0,
+	1225, 1225, 1225, 1225, 1225, 1225, 1225, 1225, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226,
+	1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228,
+	1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1230, 1231, 1232, 1233, 1234, 0, 0, 0,
+	1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1236, 1236, 1236, 1236, 1236, 1236, 1236, 1236,
+	1237, 1237, 1237, 1237, 1237, 1237, 1237, 1237, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238,
+	1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240,
+	1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1242, 1243, 1244, 1245, 1246, 0, 0, 0,
+	1247, 1247, 1247, 1247, 1247, 1247, 1247, 1247, 1248, 1248, 1248, 1248, 1248, 1248, 1248, 1248,
+	1249, 1249, 1249, 1249, 1249, 1249, 1249, 1249, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250,
+	1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252,
+	1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1254, 1255, 1256, 1257, 1258, 0, 0, 0,
+	1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260,
+	1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262,
+	1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1267, 1268, 1269, 1270, 0, 0, 0,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1272, 1272, 1272, 1272, 1272, 1272, 1272,
+	1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274,
+	1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276,
+	1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1278, 1279, 0, 0, 0, 0, 0, 0,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+	1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283,
+	1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+	1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1287, 1288, 0, 0, 0, 0, 0, 0,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290,
+	1291, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292,
+	1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294,
+	1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1296, 1297, 0, 0, 0, 0, 0, 0,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1299, 1299, 1299, 1299, 1299, 1299, 1299,
+	1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1301, 1301, 1301, 1301, 1301, 1301, 1301, 1301,
+	1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303,
+	1304, 1304, 1304, 1304, 1304, 1304, 1304, 1304, 1305, 1306, 1307, 1308, 1309, 0, 0, 0,
+	1310, 1310, 1310, 1310, 1310, 1310, 1310, 1310, 0, 0, 0, 0, 0, 0, 0, 0,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312,
+	1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314,
+	1315, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1316, 1317, 1318, 1319, 1320, 0, 0, 0,
+	1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 0, 0, 0, 0, 0, 0, 0, 0,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331, 0, 0, 0,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 0, 0, 0, 0, 0, 0, 0, 0,
+	1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
+	1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336,
+	1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1338, 1339, 1340, 1341, 1342, 0, 0, 0,
+	1343, 1343, 1343, 1343, 1343, 1343, 1343, 1343, 0, 0, 0, 0, 0, 0, 0, 0,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1350, 1351, 1352, 1353, 0, 0, 0,
+	1354, 1354, 1354, 1354, 1354, 1354, 1354, 1354, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 1355,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1357,
+	1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359,
+	1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361, 1362, 0, 0, 0, 0, 0, 0,
+	1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1366, 1366, 1366, 1366, 1366, 1366, 1366,
+	1367, 1367, 1367, 1367, 1367, 1367, 1367, 1367, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368,
+	1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1370, 1371, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372,
+	1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374,
+	1375, 1375, 1375, 1375, 1375, 1375, 1375, 1375, 1376, 1376, 1376, 1376, 1376, 1376, 1376, 1376,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1379, 0, 0, 0, 0, 0, 0,
+	1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 0, 0, 0, 0, 0, 0, 0, 0,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1384, 1384, 1384, 1384, 1384, 1384, 1384,
+	1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1386, 1387, 1388, 1389, 1390, 0, 0, 0,
+	1310, 1310, 1310, 1310, 1310, 1310, 1310, 1310, 0, 0, 0, 0, 0, 0, 0, 0,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312,
+	1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314,
+	1315, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1316, 1317, 1318, 1319, 1320, 0, 0, 0,
+	1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 0, 0, 0, 0, 0, 0, 0, 0,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331, 0, 0, 0,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 0, 0, 0, 0, 0, 0, 0, 0,
+	1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
+	1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336,
+	1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1338, 1339, 1340, 1341, 1342, 0, 0, 0,
+	1343, 1343, 1343, 1343, 1343, 1343, 1343, 1343, 0, 0, 0, 0, 0, 0, 0, 0,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1350, 1351, 1352, 1353, 0, 0, 0,
+	1354, 1354, 1354, 1354, 1354, 1354, 1354, 1354, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 1355,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1357,
+	1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359,
+	1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361, 1362, 0, 0, 0, 0, 0, 0,
+	1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1366, 1366, 1366, 1366, 1366, 1366, 1366,
+	1367, 1367, 1367, 1367, 1367, 1367, 1367, 1367, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368,
+	1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1370, 1371, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372,
+	1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374,
+	1375, 1375, 1375, 1375, 1375, 1375, 1375, 1375, 1376, 1376, 1376, 1376, 1376, 1376, 1376, 1376,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1379, 0, 0, 0, 0, 0, 0,
+	1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 0, 0, 0, 0, 0, 0, 0, 0,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1384, 1384, 1384, 1384, 1384, 1384, 1384,
+	1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1386, 1387, 1388, 1389, 1390, 0, 0, 0,
+	1310, 1310, 1310, 1310, 1310, 1310, 1310, 1310, 0, 0, 0, 0, 0, 0, 0, 0,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312,
+	1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314,
+	1315, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1316, 1317, 1318, 1319, 1320, 0, 0, 0,
+	1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 0, 0, 0, 0, 0, 0, 0, 0,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331, 0, 0, 0,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 0, 0, 0, 0, 0, 0, 0, 0,
+	1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
+	1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336,
+	1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1338, 1339, 1340, 1341, 1342, 0, 0, 0,
+	1343, 1343, 1343, 1343, 1343, 1343, 1343, 1343, 0, 0, 0, 0, 0, 0, 0, 0,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1350, 1351, 1352, 1353, 0, 0, 0,
+	1354, 1354, 1354, 1354, 1354, 1354, 1354, 1354, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 1355,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1357,
+	1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359,
+	1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361, 1362, 0, 0, 0, 0, 0, 0,
+	1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1366, 1366, 1366, 1366, 1366, 1366, 1366,
+	1367, 1367, 1367, 1367, 1367, 1367, 1367, 1367, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368,
+	1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1370, 1371, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372,
+	1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374,
+	1375, 1375, 1375, 1375, 1375, 1375, 1375, 1375, 1376, 1376, 1376, 1376, 1376, 1376, 1376, 1376,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1379, 0, 0, 0, 0, 0, 0,
+	1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 0, 0, 0, 0, 0, 0, 0, 0,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1384, 1384, 1384, 1384, 1384, 1384, 1384,
+	1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1386, 1387, 1388, 1389, 1390, 0, 0, 0,
+	1310, 1310, 1310, 1310, 1310, 1310, 1310, 1310, 0, 0, 0, 0, 0, 0, 0, 0,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312,
+	1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314,
+	1315, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1316, 1317, 1318, 1319, 1320, 0, 0, 0,
+	1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 0, 0, 0, 0, 0, 0, 0, 0,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331, 0, 0, 0,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 0, 0, 0, 0, 0, 0, 0, 0,
+	1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
+	1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336,
+	1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1338, 1339, 1340, 1341, 1342, 0, 0, 0,
+	1343, 1343, 1343, 1343, 1343, 1343, 1343, 1343, 0, 0, 0, 0, 0, 0, 0, 0,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1350, 1351, 1352, 1353, 0, 0, 0,
+	1354, 1354, 1354, 1354, 1354, 1354, 1354, 1354, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 1355,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1357,
+	1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359,
+	1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361, 1362, 0, 0, 0, 0, 0, 0,
+	1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1366, 1366, 1366, 1366, 1366, 1366, 1366,
+	1367, 1367, 1367, 1367, 1367, 1367, 1367, 1367, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368,
+	1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1370, 1371, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372,
+	1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374,
+	1375, 1375, 1375, 1375, 1375, 1375, 1375, 1375, 1376, 1376, 1376, 1376, 1376, 1376, 1376, 1376,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1379, 0, 0, 0, 0, 0, 0,
+	1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 0, 0, 0, 0, 0, 0, 0, 0,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1384, 1384, 1384, 1384, 1384, 1384, 1384,
+	1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1386, 1387, 1388, 1389, 1390, 0, 0, 0,
+	1310, 1310, 1310, 1310, 1310, 1310, 1310, 1310, 0, 0, 0, 0, 0, 0, 0, 0,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312,
+	1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314,
+	1315, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1316, 1317, 1318, 1319, 1320, 0, 0, 0,
+	1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 0, 0, 0, 0, 0, 0, 0, 0,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331, 0, 0, 0,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 0, 0, 0, 0, 0, 0, 0, 0,
+	1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
+	1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336,
+	1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1338, 1339, 1340, 1341, 1342, 0, 0, 0,
+	1343, 1343, 1343, 1343, 1343, 1343, 1343, 1343, 0, 0, 0, 0, 0, 0, 0, 0,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1350, 1351, 1352, 1353, 0, 0, 0,
+	1354, 1354, 1354, 1354, 1354, 1354, 1354, 1354, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 1355,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1357,
+	1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359,
+	1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361, 1362, 0, 0, 0, 0, 0, 0,
+	1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1366, 1366, 1366, 1366, 1366, 1366, 1366,
+	1367, 1367, 1367, 1367, 1367, 1367, 1367, 1367, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368,
+	1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1370, 1371, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372,
+	1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374,
+	1375, 1375, 1375, 1375, 1375, 1375, 1375, 1375, 1376, 1376, 1376, 1376, 1376, 1376, 1376, 1376,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1379, 0, 0, 0, 0, 0, 0,
+	1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 0, 0, 0, 0, 0, 0, 0, 0,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1384, 1384, 1384, 1384, 1384, 1384, 1384,
+	1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1386, 1387, 1388, 1389, 1390, 0, 0, 0,
+	1310, 1310, 1310, 1310, 1310, 1310, 1310, 1310, 0, 0, 0, 0, 0, 0, 0, 0,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312,
+	1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314,
+	1315, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1316, 1317, 1318, 1319, 1320, 0, 0, 0,
+	1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 0, 0, 0, 0, 0, 0, 0, 0,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331, 0, 0, 0,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 0, 0, 0, 0, 0, 0, 0, 0,
+	1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
+	1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336,
+	1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1338, 1339, 1340, 1341, 1342, 0, 0, 0,
+	1343, 1343, 1343, 1343, 1343, 1343, 1343, 1343, 0, 0, 0, 0, 0, 0, 0, 0,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1350, 1351, 1352, 1353, 0, 0, 0,
+	1354, 1354, 1354, 1354, 1354, 1354, 1354, 1354, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 1355,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1357,
+	1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359,
+	1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361, 1362, 0, 0, 0, 0, 0, 0,
+	1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1366, 1366, 1366, 1366, 1366, 1366, 1366,
+	1367, 1367, 1367, 1367, 1367, 1367, 1367, 1367, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368,
+	1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1370, 1371, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372,
+	1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374,
+	1375, 1375, 1375, 1375, 1375, 1375, 1375, 1375, 1376, 1376, 1376, 1376, 1376, 1376, 1376, 1376,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1379, 0, 0, 0, 0, 0, 0,
+	1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 0, 0, 0, 0, 0, 0, 0, 0,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1384, 1384, 1384, 1384, 1384, 1384, 1384,
+	1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1386, 1387, 1388, 1389, 1390, 0, 0, 0,
+	1310, 1310, 1310, 1310, 1310, 1310, 1310, 1310, 0, 0, 0, 0, 0, 0, 0, 0,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312,
+	1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314,
+	1315, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1316, 1317, 1318, 1319, 1320, 0, 0, 0,
+	1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 0, 0, 0, 0, 0, 0, 0, 0,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331, 0, 0, 0,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 0, 0, 0, 0, 0, 0, 0, 0,
+	1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
+	1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336,
+	1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1338, 1339, 1340, 1341, 1342, 0, 0, 0,
+	1343, 1343, 1343, 1343, 1343, 1343, 1343, 1343, 0, 0, 0, 0, 0, 0, 0, 0,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1350, 1351, 1352, 1353, 0, 0, 0,
+	1354, 1354, 1354, 1354, 1354, 1354, 1354, 1354, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 1355,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1357,
+	1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359,
+	1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361, 1362, 0, 0, 0, 0, 0, 0,
+	1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1366, 1366, 1366, 1366, 1366, 1366, 1366,
+	1367, 1367, 1367, 1367, 1367, 1367, 1367, 1367, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368,
+	1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1370, 1371, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372,
+	1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374,
+	1375, 1375, 1375, 1375, 1375, 1375, 1375, 1375, 1376, 1376, 1376, 1376, 1376, 1376, 1376, 1376,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1379, 0, 0, 0, 0, 0, 0,
+	1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 0, 0, 0, 0, 0, 0, 0, 0,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1384, 1384, 1384, 1384, 1384, 1384, 1384,
+	1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1386, 1387, 1388, 1389, 1390, 0, 0, 0,
+	1310, 1310, 1310, 1310, 1310, 1310, 1310, 1310, 0, 0, 0, 0, 0, 0, 0, 0,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312,
+	1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314,
+	1315, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1316, 1317, 1318, 1319, 1320, 0, 0, 0,
+	1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 0, 0, 0, 0, 0, 0, 0, 0,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331, 0, 0, 0,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 0, 0, 0, 0, 0, 0, 0, 0,
+	1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
+	1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336,
+	1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1338, 1339, 1340, 1341, 1342, 0, 0, 0,
+	1343, 1343, 1343, 1343, 1343, 1343, 1343, 1343, 0, 0, 0, 0, 0, 0, 0, 0,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1350, 1351, 1352, 1353, 0, 0, 0,
+	1354, 1354, 1354, 1354, 1354, 1354, 1354, 1354, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 1355,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1357,
+	1358, 1358, 1358, 1358, 1358, 1358, 1358, 1358, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359,
+	1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361, 1362, 0, 0, 0, 0, 0, 0,
+	1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1366, 1366, 1366, 1366, 1366, 1366, 1366,
+	1367, 1367, 1367, 1367, 1367, 1367, 1367, 1367, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368,
+	1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1370, 1371, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372,
+	1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374,
+	1375, 1375, 1375, 1375, 1375, 1375, 1375, 1375, 1376, 1376, 1376, 1376, 1376, 1376, 1376, 1376,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1379, 0, 0, 0, 0, 0, 0,
+	1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 0, 0, 0, 0, 0, 0, 0, 0,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1384, 1384, 1384, 1384, 1384, 1384, 1384,
+	1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1386, 1387, 1388, 1389, 1390, 0, 0, 0,
+	1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 0, 0, 0, 0, 0, 0, 0, 0,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393,
+	1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395,
+	1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1397, 1398, 1399, 1400, 1401, 0, 0, 0,
+	1402, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
+	1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407,
+	1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1409, 1410, 1411, 1412, 1413, 0, 0, 0,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
+	1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1421, 1422, 1423, 1424, 1425, 0, 0, 0,
+	1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
+	1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
+	1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
+	1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1433, 1434, 1435, 1436, 1437, 0, 0, 0,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
+	1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
+	1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1445, 1446, 0, 0, 0, 0, 0, 0,
+	1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
+	1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
+	1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1454, 1455, 0, 0, 0, 0, 0, 0,
+	1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1464, 0, 0, 0, 0, 0, 0,
+	1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
+	1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
+	1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
+	1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1472, 1473, 1474, 1475, 1476, 0, 0, 0,
+	1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 0, 0, 0, 0, 0, 0, 0, 0,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393,
+	1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395,
+	1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1397, 1398, 1399, 1400, 1401, 0, 0, 0,
+	1402, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
+	1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407,
+	1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1409, 1410, 1411, 1412, 1413, 0, 0, 0,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
+	1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1421, 1422, 1423, 1424, 1425, 0, 0, 0,
+	1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
+	1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
+	1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
+	1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1433, 1434, 1435, 1436, 1437, 0, 0, 0,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
+	1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
+	1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1445, 1446, 0, 0, 0, 0, 0, 0,
+	1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
+	1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
+	1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1454, 1455, 0, 0, 0, 0, 0, 0,
+	1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1464, 0, 0, 0, 0, 0, 0,
+	1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
+	1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
+	1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
+	1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1472, 1473, 1474, 1475, 1476, 0, 0, 0,
+	1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 0, 0, 0, 0, 0, 0, 0, 0,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393,
+	1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395,
+	1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1397, 1398, 1399, 1400, 1401, 0, 0, 0,
+	1402, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
+	1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407,
+	1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1409, 1410, 1411, 1412, 1413, 0, 0, 0,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
+	1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1421, 1422, 1423, 1424, 1425, 0, 0, 0,
+	1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
+	1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
+	1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
+	1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1433, 1434, 1435, 1436, 1437, 0, 0, 0,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
+	1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
+	1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1445, 1446, 0, 0, 0, 0, 0, 0,
+	1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
+	1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
+	1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1454, 1455, 0, 0, 0, 0, 0, 0,
+	1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1464, 0, 0, 0, 0, 0, 0,
+	1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
+	1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
+	1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
+	1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1472, 1473, 1474, 1475, 1476, 0, 0, 0,
+	1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 0, 0, 0, 0, 0, 0, 0, 0,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393,
+	1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395,
+	1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1397, 1398, 1399, 1400, 1401, 0, 0, 0,
+	1402, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
+	1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407,
+	1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1409, 1410, 1411, 1412, 1413, 0, 0, 0,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
+	1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1421, 1422, 1423, 1424, 1425, 0, 0, 0,
+	1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
+	1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
+	1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
+	1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1433, 1434, 1435, 1436, 1437, 0, 0, 0,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
+	1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
+	1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1445, 1446, 0, 0, 0, 0, 0, 0,
+	1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
+	1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
+	1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1454, 1455, 0, 0, 0, 0, 0, 0,
+	1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1464, 0, 0, 0, 0, 0, 0,
+	1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
+	1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
+	1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
+	1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1472, 1473, 1474, 1475, 1476, 0, 0, 0,
+	1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 0, 0, 0, 0, 0, 0, 0, 0,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393,
+	1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395,
+	1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1397, 1398, 1399, 1400, 1401, 0, 0, 0,
+	1402, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
+	1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407,
+	1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1409, 1410, 1411, 1412, 1413, 0, 0, 0,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
+	1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1421, 1422, 1423, 1424, 1425, 0, 0, 0,
+	1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
+	1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
+	1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
+	1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1433, 1434, 1435, 1436, 1437, 0, 0, 0,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
+	1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
+	1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1445, 1446, 0, 0, 0, 0, 0, 0,
+	1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
+	1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
+	1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1454, 1455, 0, 0, 0, 0, 0, 0,
+	1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1464, 0, 0, 0, 0, 0, 0,
+	1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
+	1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
+	1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
+	1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1472, 1473, 1474, 1475, 1476, 0, 0, 0,
+	1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 0, 0, 0, 0, 0, 0, 0, 0,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393,
+	1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395,
+	1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1397, 1398, 1399, 1400, 1401, 0, 0, 0,
+	1402, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
+	1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407,
+	1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1409, 1410, 1411, 1412, 1413, 0, 0, 0,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
+	1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1421, 1422, 1423, 1424, 1425, 0, 0, 0,
+	1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
+	1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
+	1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
+	1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1433, 1434, 1435, 1436, 1437, 0, 0, 0,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
+	1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
+	1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1445, 1446, 0, 0, 0, 0, 0, 0,
+	1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
+	1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
+	1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1454, 1455, 0, 0, 0, 0, 0, 0,
+	1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1464, 0, 0, 0, 0, 0, 0,
+	1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
+	1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
+	1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
+	1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1472, 1473, 1474, 1475, 1476, 0, 0, 0,
+	1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 0, 0, 0, 0, 0, 0, 0, 0,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393,
+	1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395,
+	1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1397, 1398, 1399, 1400, 1401, 0, 0, 0,
+	1402, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
+	1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407,
+	1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1409, 1410, 1411, 1412, 1413, 0, 0, 0,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
+	1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1421, 1422, 1423, 1424, 1425, 0, 0, 0,
+	1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
+	1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
+	1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
+	1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1433, 1434, 1435, 1436, 1437, 0, 0, 0,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
+	1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
+	1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1445, 1446, 0, 0, 0, 0, 0, 0,
+	1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
+	1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
+	1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1454, 1455, 0, 0, 0, 0, 0, 0,
+	1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1464, 0, 0, 0, 0, 0, 0,
+	1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
+	1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
+	1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
+	1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1472, 1473, 1474, 1475, 1476, 0, 0, 0,
+	1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 0, 0, 0, 0, 0, 0, 0, 0,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393,
+	1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395,
+	1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1397, 1398, 1399, 1400, 1401, 0, 0, 0,
+	1402, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405,
+	1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407,
+	1408, 1408, 1408, 1408, 1408, 1408, 1408, 1408, 1409, 1410, 1411, 1412, 1413, 0, 0, 0,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
+	1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1421, 1422, 1423, 1424, 1425, 0, 0, 0,
+	1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427,
+	1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429,
+	1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431,
+	1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1433, 1434, 1435, 1436, 1437, 0, 0, 0,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
+	1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
+	1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1445, 1446, 0, 0, 0, 0, 0, 0,
+	1447, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448, 1448, 1448, 1448, 1448, 1448, 1448, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,
+	1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
+	1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1454, 1455, 0, 0, 0, 0, 0, 0,
+	1456, 1456, 1456, 1456, 1456, 1456, 1456, 1456, 1457, 1457, 1457, 1457, 1457, 1457, 1457, 1457,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1464, 0, 0, 0, 0, 0, 0,
+	1465, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1466, 1466, 1466, 1466, 1466, 1466, 1466, 1466,
+	1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468,
+	1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470,
+	1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1472, 1473, 1474, 1475, 1476, 0, 0, 0,
+	1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+	1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
+	1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
+	1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+	1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+	1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
+	1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+	1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
+	1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
+	1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
+	1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
+	1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1506, 1507, 0, 0, 0, 0, 0, 0,
+	1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
+	1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+	1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
+	1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+	1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517,
+	1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519,
+	1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1521, 1521, 1521, 1521, 1521, 1521, 1521, 1521,
+	1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+	1524, 1524, 1524, 1524, 1524, 1524, 1524, 1524, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+	1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527,
+	1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529,
+	1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1532, 1532, 1532, 1532, 1532, 1532, 1532, 1532, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533,
+	1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535,
+	1536, 1536, 1536, 1536, 1536, 1536, 1536, 1536, 1537, 1538, 0, 0, 0, 0, 0, 0,
+	1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+	1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
+	1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
+	1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+	1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+	1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
+	1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+	1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
+	1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
+	1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1539, 1539, 1539, 1539, 1539, 1539, 1539, 1539, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540,
+	1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542,
+	1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1544, 1545, 0, 0, 0, 0, 0, 0,
+	1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
+	1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+	1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
+	1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+	1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517,
+	1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519,
+	1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1521, 1521, 1521, 1521, 1521, 1521, 1521, 1521,
+	1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+	1524, 1524, 1524, 1524, 1524, 1524, 1524, 1524, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+	1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527,
+	1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529,
+	1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1546, 1546, 1546, 1546, 1546, 1546, 1546, 1546, 1547, 1547, 1547, 1547, 1547, 1547, 1547, 1547,
+	1548, 1548, 1548, 1548, 1548, 1548, 1548, 1548, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549,
+	1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1551, 1552, 0, 0, 0, 0, 0, 0,
+	1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+	1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
+	1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
+	1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+	1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+	1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
+	1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+	1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
+	1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
+	1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1553, 1553, 1553, 1553, 1553, 1553, 1553, 1553, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554,
+	1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1556,
+	1557, 1557, 1557, 1557, 1557, 1557, 1557, 1557, 1558, 1559, 0, 0, 0, 0, 0, 0,
+	1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
+	1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+	1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
+	1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+	1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517,
+	1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519,
+	1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1521, 1521, 1521, 1521, 1521, 1521, 1521, 1521,
+	1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+	1524, 1524, 1524, 1524, 1524, 1524, 1524, 1524, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+	1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527,
+	1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529,
+	1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+	1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1563, 1563, 1563, 1563, 1563, 1563, 1563, 1563,
+	1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1565, 1566, 0, 0, 0, 0, 0, 0,
+	1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+	1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
+	1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
+	1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+	1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+	1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
+	1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+	1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
+	1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
+	1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568,
+	1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570,
+	1571, 1571, 1571, 1571, 1571, 1571, 1571, 1571, 1572, 1573, 0, 0, 0, 0, 0, 0,
+	1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
+	1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+	1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
+	1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+	1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517,
+	1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519,
+	1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1521, 1521, 1521, 1521, 1521, 1521, 1521, 1521,
+	1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+	1524, 1524, 1524, 1524, 1524, 1524, 1524, 1524, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+	1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527,
+	1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529,
+	1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1574, 1574, 1574, 1574, 1574, 1574, 1574, 1574, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575,
+	1576, 1576, 1576, 1576, 1576, 1576, 1576, 1576, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577,
+	1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1579, 1580, 0, 0, 0, 0, 0, 0,
+	1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+	1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
+	1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
+	1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+	1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+	1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
+	1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+	1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
+	1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
+	1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
+	1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+	1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
+	1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+	1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517,
+	1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519,
+	1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1521, 1521, 1521, 1521, 1521, 1521, 1521, 1521,
+	1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+	1524, 1524, 1524, 1524, 1524, 1524, 1524, 1524, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+	1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527,
+	1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529,
+	1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+	1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
+	1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
+	1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+	1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+	1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
+	1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+	1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
+	1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
+	1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
+	1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+	1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
+	1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+	1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517,
+	1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519,
+	1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1521, 1521, 1521, 1521, 1521, 1521, 1521, 1521,
+	1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+	1524, 1524, 1524, 1524, 1524, 1524, 1524, 1524, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+	1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527,
+	1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529,
+	1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+	1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
+	1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
+	1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+	1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+	1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
+	1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+	1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
+	1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
+	1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
+	1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+	1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
+	1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+	1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517,
+	1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519,
+	1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1521, 1521, 1521, 1521, 1521, 1521, 1521, 1521,
+	1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+	1524, 1524, 1524, 1524, 1524, 1524, 1524, 1524, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+	1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527,
+	1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529,
+	1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+	1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480,
+	1481, 1481, 1481, 1481, 1481, 1481, 1481, 1481, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
+	1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+	1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+	1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,
+	1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+	1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1496, 1496, 1496, 1496, 1496, 1496, 1496,
+	1497, 1497, 1497, 1497, 1497, 1497, 1497, 1497, 1498, 1498, 1498, 1498, 1498, 1498, 1498, 1498,
+	1499, 1499, 1499, 1499, 1499, 1499, 1499, 1499, 1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
+	1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511,
+	1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513,
+	1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515,
+	1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517,
+	1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519,
+	1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1521, 1521, 1521, 1521, 1521, 1521, 1521, 1521,
+	1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+	1524, 1524, 1524, 1524, 1524, 1524, 1524, 1524, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525,
+	1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527,
+	1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529,
+	1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
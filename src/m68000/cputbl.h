@@ -1,6320 +1,1584 @@
-extern cpuop_func op_0_4_nf;
-extern cpuop_func op_0_4_ff;
-extern cpuop_func op_10_4_nf;
-extern cpuop_func op_10_4_ff;
-extern cpuop_func op_18_4_nf;
-extern cpuop_func op_18_4_ff;
-extern cpuop_func op_20_4_nf;
-extern cpuop_func op_20_4_ff;
-extern cpuop_func op_28_4_nf;
-extern cpuop_func op_28_4_ff;
-extern cpuop_func op_30_4_nf;
-extern cpuop_func op_30_4_ff;
-extern cpuop_func op_38_4_nf;
-extern cpuop_func op_38_4_ff;
-extern cpuop_func op_39_4_nf;
-extern cpuop_func op_39_4_ff;
-extern cpuop_func op_3c_4_nf;
-extern cpuop_func op_3c_4_ff;
-extern cpuop_func op_40_4_nf;
-extern cpuop_func op_40_4_ff;
-extern cpuop_func op_50_4_nf;
-extern cpuop_func op_50_4_ff;
-extern cpuop_func op_58_4_nf;
-extern cpuop_func op_58_4_ff;
-extern cpuop_func op_60_4_nf;
-extern cpuop_func op_60_4_ff;
-extern cpuop_func op_68_4_nf;
-extern cpuop_func op_68_4_ff;
-extern cpuop_func op_70_4_nf;
-extern cpuop_func op_70_4_ff;
-extern cpuop_func op_78_4_nf;
-extern cpuop_func op_78_4_ff;
-extern cpuop_func op_79_4_nf;
-extern cpuop_func op_79_4_ff;
-extern cpuop_func op_7c_4_nf;
-extern cpuop_func op_7c_4_ff;
-extern cpuop_func op_80_4_nf;
-extern cpuop_func op_80_4_ff;
-extern cpuop_func op_90_4_nf;
-extern cpuop_func op_90_4_ff;
-extern cpuop_func op_98_4_nf;
-extern cpuop_func op_98_4_ff;
-extern cpuop_func op_a0_4_nf;
-extern cpuop_func op_a0_4_ff;
-extern cpuop_func op_a8_4_nf;
-extern cpuop_func op_a8_4_ff;
-extern cpuop_func op_b0_4_nf;
-extern cpuop_func op_b0_4_ff;
-extern cpuop_func op_b8_4_nf;
-extern cpuop_func op_b8_4_ff;
-extern cpuop_func op_b9_4_nf;
-extern cpuop_func op_b9_4_ff;
-extern cpuop_func op_100_4_nf;
-extern cpuop_func op_100_4_ff;
-extern cpuop_func op_108_4_nf;
-extern cpuop_func op_108_4_ff;
-extern cpuop_func op_110_4_nf;
-extern cpuop_func op_110_4_ff;
-extern cpuop_func op_118_4_nf;
-extern cpuop_func op_118_4_ff;
-extern cpuop_func op_120_4_nf;
-extern cpuop_func op_120_4_ff;
-extern cpuop_func op_128_4_nf;
-extern cpuop_func op_128_4_ff;
-extern cpuop_func op_130_4_nf;
-extern cpuop_func op_130_4_ff;
-extern cpuop_func op_138_4_nf;
-extern cpuop_func op_138_4_ff;
-extern cpuop_func op_139_4_nf;
-extern cpuop_func op_139_4_ff;
-extern cpuop_func op_13a_4_nf;
-extern cpuop_func op_13a_4_ff;
-extern cpuop_func op_13b_4_nf;
-extern cpuop_func op_13b_4_ff;
-extern cpuop_func op_13c_4_nf;
-extern cpuop_func op_13c_4_ff;
-extern cpuop_func op_140_4_nf;
-extern cpuop_func op_140_4_ff;
-extern cpuop_func op_148_4_nf;
-extern cpuop_func op_148_4_ff;
-extern cpuop_func op_150_4_nf;
-extern cpuop_func op_150_4_ff;
-extern cpuop_func op_158_4_nf;
-extern cpuop_func op_158_4_ff;
-extern cpuop_func op_160_4_nf;
-extern cpuop_func op_160_4_ff;
-extern cpuop_func op_168_4_nf;
-extern cpuop_func op_168_4_ff;
-extern cpuop_func op_170_4_nf;
-extern cpuop_func op_170_4_ff;
-extern cpuop_func op_178_4_nf;
-extern cpuop_func op_178_4_ff;
-extern cpuop_func op_179_4_nf;
-extern cpuop_func op_179_4_ff;
-extern cpuop_func op_17a_4_nf;
-extern cpuop_func op_17a_4_ff;
-extern cpuop_func op_17b_4_nf;
-extern cpuop_func op_17b_4_ff;
-extern cpuop_func op_180_4_nf;
-extern cpuop_func op_180_4_ff;
-extern cpuop_func op_188_4_nf;
-extern cpuop_func op_188_4_ff;
-extern cpuop_func op_190_4_nf;
-extern cpuop_func op_190_4_ff;
-extern cpuop_func op_198_4_nf;
-extern cpuop_func op_198_4_ff;
-extern cpuop_func op_1a0_4_nf;
-extern cpuop_func op_1a0_4_ff;
-extern cpuop_func op_1a8_4_nf;
-extern cpuop_func op_1a8_4_ff;
-extern cpuop_func op_1b0_4_nf;
-extern cpuop_func op_1b0_4_ff;
-extern cpuop_func op_1b8_4_nf;
-extern cpuop_func op_1b8_4_ff;
-extern cpuop_func op_1b9_4_nf;
-extern cpuop_func op_1b9_4_ff;
-extern cpuop_func op_1ba_4_nf;
-extern cpuop_func op_1ba_4_ff;
-extern cpuop_func op_1bb_4_nf;
-extern cpuop_func op_1bb_4_ff;
-extern cpuop_func op_1c0_4_nf;
-extern cpuop_func op_1c0_4_ff;
-extern cpuop_func op_1c8_4_nf;
-extern cpuop_func op_1c8_4_ff;
-extern cpuop_func op_1d0_4_nf;
-extern cpuop_func op_1d0_4_ff;
-extern cpuop_func op_1d8_4_nf;
-extern cpuop_func op_1d8_4_ff;
-extern cpuop_func op_1e0_4_nf;
-extern cpuop_func op_1e0_4_ff;
-extern cpuop_func op_1e8_4_nf;
-extern cpuop_func op_1e8_4_ff;
-extern cpuop_func op_1f0_4_nf;
-extern cpuop_func op_1f0_4_ff;
-extern cpuop_func op_1f8_4_nf;
-extern cpuop_func op_1f8_4_ff;
-extern cpuop_func op_1f9_4_nf;
-extern cpuop_func op_1f9_4_ff;
-extern cpuop_func op_1fa_4_nf;
-extern cpuop_func op_1fa_4_ff;
-extern cpuop_func op_1fb_4_nf;
-extern cpuop_func op_1fb_4_ff;
-extern cpuop_func op_200_4_nf;
-extern cpuop_func op_200_4_ff;
-extern cpuop_func op_210_4_nf;
-extern cpuop_func op_210_4_ff;
-extern cpuop_func op_218_4_nf;
-extern cpuop_func op_218_4_ff;
-extern cpuop_func op_220_4_nf;
-extern cpuop_func op_220_4_ff;
-extern cpuop_func op_228_4_nf;
-extern cpuop_func op_228_4_ff;
-extern cpuop_func op_230_4_nf;
-extern cpuop_func op_230_4_ff;
-extern cpuop_func op_238_4_nf;
-extern cpuop_func op_238_4_ff;
-extern cpuop_func op_239_4_nf;
-extern cpuop_func op_239_4_ff;
-extern cpuop_func op_23c_4_nf;
-extern cpuop_func op_23c_4_ff;
-extern cpuop_func op_240_4_nf;
-extern cpuop_func op_240_4_ff;
-extern cpuop_func op_250_4_nf;
-extern cpuop_func op_250_4_ff;
-extern cpuop_func op_258_4_nf;
-extern cpuop_func op_258_4_ff;
-extern cpuop_func op_260_4_nf;
-extern cpuop_func op_260_4_ff;
-extern cpuop_func op_268_4_nf;
-extern cpuop_func op_268_4_ff;
-extern cpuop_func op_270_4_nf;
-extern cpuop_func op_270_4_ff;
-extern cpuop_func op_278_4_nf;
-extern cpuop_func op_278_4_ff;
-extern cpuop_func op_279_4_nf;
-extern cpuop_func op_279_4_ff;
-extern cpuop_func op_27c_4_nf;
-extern cpuop_func op_27c_4_ff;
-extern cpuop_func op_280_4_nf;
-extern cpuop_func op_280_4_ff;
-extern cpuop_func op_290_4_nf;
-extern cpuop_func op_290_4_ff;
-extern cpuop_func op_298_4_nf;
-extern cpuop_func op_298_4_ff;
-extern cpuop_func op_2a0_4_nf;
-extern cpuop_func op_2a0_4_ff;
-extern cpuop_func op_2a8_4_nf;
-extern cpuop_func op_2a8_4_ff;
-extern cpuop_func op_2b0_4_nf;
-extern cpuop_func op_2b0_4_ff;
-extern cpuop_func op_2b8_4_nf;
-extern cpuop_func op_2b8_4_ff;
-extern cpuop_func op_2b9_4_nf;
-extern cpuop_func op_2b9_4_ff;
-extern cpuop_func op_400_4_nf;
-extern cpuop_func op_400_4_ff;
-extern cpuop_func op_410_4_nf;
-extern cpuop_func op_410_4_ff;
-extern cpuop_func op_418_4_nf;
-extern cpuop_func op_418_4_ff;
-extern cpuop_func op_420_4_nf;
-extern cpuop_func op_420_4_ff;
-extern cpuop_func op_428_4_nf;
-extern cpuop_func op_428_4_ff;
-extern cpuop_func op_430_4_nf;
-extern cpuop_func op_430_4_ff;
-extern cpuop_func op_438_4_nf;
-extern cpuop_func op_438_4_ff;
-extern cpuop_func op_439_4_nf;
-extern cpuop_func op_439_4_ff;
-extern cpuop_func op_440_4_nf;
-extern cpuop_func op_440_4_ff;
-extern cpuop_func op_450_4_nf;
-extern cpuop_func op_450_4_ff;
-extern cpuop_func op_458_4_nf;
-extern cpuop_func op_458_4_ff;
-extern cpuop_func op_460_4_nf;
-extern cpuop_func op_460_4_ff;
-extern cpuop_func op_468_4_nf;
-extern cpuop_func op_468_4_ff;
-extern cpuop_func op_470_4_nf;
-extern cpuop_func op_470_4_ff;
-extern cpuop_func op_478_4_nf;
-extern cpuop_func op_478_4_ff;
-extern cpuop_func op_479_4_nf;
-extern cpuop_func op_479_4_ff;
-extern cpuop_func op_480_4_nf;
-extern cpuop_func op_480_4_ff;
-extern cpuop_func op_490_4_nf;
-extern cpuop_func op_490_4_ff;
-extern cpuop_func op_498_4_nf;
-extern cpuop_func op_498_4_ff;
-extern cpuop_func op_4a0_4_nf;
-extern cpuop_func op_4a0_4_ff;
-extern cpuop_func op_4a8_4_nf;
-extern cpuop_func op_4a8_4_ff;
-extern cpuop_func op_4b0_4_nf;
-extern cpuop_func op_4b0_4_ff;
-extern cpuop_func op_4b8_4_nf;
-extern cpuop_func op_4b8_4_ff;
-extern cpuop_func op_4b9_4_nf;
-extern cpuop_func op_4b9_4_ff;
-extern cpuop_func op_600_4_nf;
-extern cpuop_func op_600_4_ff;
-extern cpuop_func op_610_4_nf;
-extern cpuop_func op_610_4_ff;
-extern cpuop_func op_618_4_nf;
-extern cpuop_func op_618_4_ff;
-extern cpuop_func op_620_4_nf;
-extern cpuop_func op_620_4_ff;
-extern cpuop_func op_628_4_nf;
-extern cpuop_func op_628_4_ff;
-extern cpuop_func op_630_4_nf;
-extern cpuop_func op_630_4_ff;
-extern cpuop_func op_638_4_nf;
-extern cpuop_func op_638_4_ff;
-extern cpuop_func op_639_4_nf;
-extern cpuop_func op_639_4_ff;
-extern cpuop_func op_640_4_nf;
-extern cpuop_func op_640_4_ff;
-extern cpuop_func op_650_4_nf;
-extern cpuop_func op_650_4_ff;
-extern cpuop_func op_658_4_nf;
-extern cpuop_func op_658_4_ff;
-extern cpuop_func op_660_4_nf;
-extern cpuop_func op_660_4_ff;
-extern cpuop_func op_668_4_nf;
-extern cpuop_func op_668_4_ff;
-extern cpuop_func op_670_4_nf;
-extern cpuop_func op_670_4_ff;
-extern cpuop_func op_678_4_nf;
-extern cpuop_func op_678_4_ff;
-extern cpuop_func op_679_4_nf;
-extern cpuop_func op_679_4_ff;
-extern cpuop_func op_680_4_nf;
-extern cpuop_func op_680_4_ff;
-extern cpuop_func op_690_4_nf;
-extern cpuop_func op_690_4_ff;
-extern cpuop_func op_698_4_nf;
-extern cpuop_func op_698_4_ff;
-extern cpuop_func op_6a0_4_nf;
-extern cpuop_func op_6a0_4_ff;
-extern cpuop_func op_6a8_4_nf;
-extern cpuop_func op_6a8_4_ff;
-extern cpuop_func op_6b0_4_nf;
-extern cpuop_func op_6b0_4_ff;
-extern cpuop_func op_6b8_4_nf;
-extern cpuop_func op_6b8_4_ff;
-extern cpuop_func op_6b9_4_nf;
-extern cpuop_func op_6b9_4_ff;
-extern cpuop_func op_800_4_nf;
-extern cpuop_func op_800_4_ff;
-extern cpuop_func op_810_4_nf;
-extern cpuop_func op_810_4_ff;
-extern cpuop_func op_818_4_nf;
-extern cpuop_func op_818_4_ff;
-extern cpuop_func op_820_4_nf;
-extern cpuop_func op_820_4_ff;
-extern cpuop_func op_828_4_nf;
-extern cpuop_func op_828_4_ff;
-extern cpuop_func op_830_4_nf;
-extern cpuop_func op_830_4_ff;
-extern cpuop_func op_838_4_nf;
-extern cpuop_func op_838_4_ff;
-extern cpuop_func op_839_4_nf;
-extern cpuop_func op_839_4_ff;
-extern cpuop_func op_83a_4_nf;
-extern cpuop_func op_83a_4_ff;
-extern cpuop_func op_83b_4_nf;
-extern cpuop_func op_83b_4_ff;
-extern cpuop_func op_83c_4_nf;
-extern cpuop_func op_83c_4_ff;
-extern cpuop_func op_840_4_nf;
-extern cpuop_func op_840_4_ff;
-extern cpuop_func op_850_4_nf;
-extern cpuop_func op_850_4_ff;
-extern cpuop_func op_858_4_nf;
-extern cpuop_func op_858_4_ff;
-extern cpuop_func op_860_4_nf;
-extern cpuop_func op_860_4_ff;
-extern cpuop_func op_868_4_nf;
-extern cpuop_func op_868_4_ff;
-extern cpuop_func op_870_4_nf;
-extern cpuop_func op_870_4_ff;
-extern cpuop_func op_878_4_nf;
-extern cpuop_func op_878_4_ff;
-extern cpuop_func op_879_4_nf;
-extern cpuop_func op_879_4_ff;
-extern cpuop_func op_87a_4_nf;
-extern cpuop_func op_87a_4_ff;
-extern cpuop_func op_87b_4_nf;
-extern cpuop_func op_87b_4_ff;
-extern cpuop_func op_880_4_nf;
-extern cpuop_func op_880_4_ff;
-extern cpuop_func op_890_4_nf;
-extern cpuop_func op_890_4_ff;
-extern cpuop_func op_898_4_nf;
-extern cpuop_func op_898_4_ff;
-extern cpuop_func op_8a0_4_nf;
-extern cpuop_func op_8a0_4_ff;
-extern cpuop_func op_8a8_4_nf;
-extern cpuop_func op_8a8_4_ff;
-extern cpuop_func op_8b0_4_nf;
-extern cpuop_func op_8b0_4_ff;
-extern cpuop_func op_8b8_4_nf;
-extern cpuop_func op_8b8_4_ff;
-extern cpuop_func op_8b9_4_nf;
-extern cpuop_func op_8b9_4_ff;
-extern cpuop_func op_8ba_4_nf;
-extern cpuop_func op_8ba_4_ff;
-extern cpuop_func op_8bb_4_nf;
-extern cpuop_func op_8bb_4_ff;
-extern cpuop_func op_8c0_4_nf;
-extern cpuop_func op_8c0_4_ff;
-extern cpuop_func op_8d0_4_nf;
-extern cpuop_func op_8d0_4_ff;
-extern cpuop_func op_8d8_4_nf;
-extern cpuop_func op_8d8_4_ff;
-extern cpuop_func op_8e0_4_nf;
-extern cpuop_func op_8e0_4_ff;
-extern cpuop_func op_8e8_4_nf;
-extern cpuop_func op_8e8_4_ff;
-extern cpuop_func op_8f0_4_nf;
-extern cpuop_func op_8f0_4_ff;
-extern cpuop_func op_8f8_4_nf;
-extern cpuop_func op_8f8_4_ff;
-extern cpuop_func op_8f9_4_nf;
-extern cpuop_func op_8f9_4_ff;
-extern cpuop_func op_8fa_4_nf;
-extern cpuop_func op_8fa_4_ff;
-extern cpuop_func op_8fb_4_nf;
-extern cpuop_func op_8fb_4_ff;
-extern cpuop_func op_a00_4_nf;
-extern cpuop_func op_a00_4_ff;
-extern cpuop_func op_a10_4_nf;
-extern cpuop_func op_a10_4_ff;
-extern cpuop_func op_a18_4_nf;
-extern cpuop_func op_a18_4_ff;
-extern cpuop_func op_a20_4_nf;
-extern cpuop_func op_a20_4_ff;
-extern cpuop_func op_a28_4_nf;
-extern cpuop_func op_a28_4_ff;
-extern cpuop_func op_a30_4_nf;
-extern cpuop_func op_a30_4_ff;
-extern cpuop_func op_a38_4_nf;
-extern cpuop_func op_a38_4_ff;
-extern cpuop_func op_a39_4_nf;
-extern cpuop_func op_a39_4_ff;
-extern cpuop_func op_a3c_4_nf;
-extern cpuop_func op_a3c_4_ff;
-extern cpuop_func op_a40_4_nf;
-extern cpuop_func op_a40_4_ff;
-extern cpuop_func op_a50_4_nf;
-extern cpuop_func op_a50_4_ff;
-extern cpuop_func op_a58_4_nf;
-extern cpuop_func op_a58_4_ff;
-extern cpuop_func op_a60_4_nf;
-extern cpuop_func op_a60_4_ff;
-extern cpuop_func op_a68_4_nf;
-extern cpuop_func op_a68_4_ff;
-extern cpuop_func op_a70_4_nf;
-extern cpuop_func op_a70_4_ff;
-extern cpuop_func op_a78_4_nf;
-extern cpuop_func op_a78_4_ff;
-extern cpuop_func op_a79_4_nf;
-extern cpuop_func op_a79_4_ff;
-extern cpuop_func op_a7c_4_nf;
-extern cpuop_func op_a7c_4_ff;
-extern cpuop_func op_a80_4_nf;
-extern cpuop_func op_a80_4_ff;
-extern cpuop_func op_a90_4_nf;
-extern cpuop_func op_a90_4_ff;
-extern cpuop_func op_a98_4_nf;
-extern cpuop_func op_a98_4_ff;
-extern cpuop_func op_aa0_4_nf;
-extern cpuop_func op_aa0_4_ff;
-extern cpuop_func op_aa8_4_nf;
-extern cpuop_func op_aa8_4_ff;
-extern cpuop_func op_ab0_4_nf;
-extern cpuop_func op_ab0_4_ff;
-extern cpuop_func op_ab8_4_nf;
-extern cpuop_func op_ab8_4_ff;
-extern cpuop_func op_ab9_4_nf;
-extern cpuop_func op_ab9_4_ff;
-extern cpuop_func op_c00_4_nf;
-extern cpuop_func op_c00_4_ff;
-extern cpuop_func op_c10_4_nf;
-extern cpuop_func op_c10_4_ff;
-extern cpuop_func op_c18_4_nf;
-extern cpuop_func op_c18_4_ff;
-extern cpuop_func op_c20_4_nf;
-extern cpuop_func op_c20_4_ff;
-extern cpuop_func op_c28_4_nf;
-extern cpuop_func op_c28_4_ff;
-extern cpuop_func op_c30_4_nf;
-extern cpuop_func op_c30_4_ff;
-extern cpuop_func op_c38_4_nf;
-extern cpuop_func op_c38_4_ff;
-extern cpuop_func op_c39_4_nf;
-extern cpuop_func op_c39_4_ff;
-extern cpuop_func op_c3a_4_nf;
-extern cpuop_func op_c3a_4_ff;
-extern cpuop_func op_c3b_4_nf;
-extern cpuop_func op_c3b_4_ff;
-extern cpuop_func op_c40_4_nf;
-extern cpuop_func op_c40_4_ff;
-extern cpuop_func op_c50_4_nf;
-extern cpuop_func op_c50_4_ff;
-extern cpuop_func op_c58_4_nf;
-extern cpuop_func op_c58_4_ff;
-extern cpuop_func op_c60_4_nf;
-extern cpuop_func op_c60_4_ff;
-extern cpuop_func op_c68_4_nf;
-extern cpuop_func op_c68_4_ff;
-extern cpuop_func op_c70_4_nf;
-extern cpuop_func op_c70_4_ff;
-extern cpuop_func op_c78_4_nf;
-extern cpuop_func op_c78_4_ff;
-extern cpuop_func op_c79_4_nf;
-extern cpuop_func op_c79_4_ff;
-extern cpuop_func op_c7a_4_nf;
-extern cpuop_func op_c7a_4_ff;
-extern cpuop_func op_c7b_4_nf;
-extern cpuop_func op_c7b_4_ff;
-extern cpuop_func op_c80_4_nf;
-extern cpuop_func op_c80_4_ff;
-extern cpuop_func op_c90_4_nf;
-extern cpuop_func op_c90_4_ff;
-extern cpuop_func op_c98_4_nf;
-extern cpuop_func op_c98_4_ff;
-extern cpuop_func op_ca0_4_nf;
-extern cpuop_func op_ca0_4_ff;
-extern cpuop_func op_ca8_4_nf;
-extern cpuop_func op_ca8_4_ff;
-extern cpuop_func op_cb0_4_nf;
-extern cpuop_func op_cb0_4_ff;
-extern cpuop_func op_cb8_4_nf;
-extern cpuop_func op_cb8_4_ff;
-extern cpuop_func op_cb9_4_nf;
-extern cpuop_func op_cb9_4_ff;
-extern cpuop_func op_cba_4_nf;
-extern cpuop_func op_cba_4_ff;
-extern cpuop_func op_cbb_4_nf;
-extern cpuop_func op_cbb_4_ff;
-extern cpuop_func op_1000_4_nf;
-extern cpuop_func op_1000_4_ff;
-extern cpuop_func op_1008_4_nf;
-extern cpuop_func op_1008_4_ff;
-extern cpuop_func op_1010_4_nf;
-extern cpuop_func op_1010_4_ff;
-extern cpuop_func op_1018_4_nf;
-extern cpuop_func op_1018_4_ff;
-extern cpuop_func op_1020_4_nf;
-extern cpuop_func op_1020_4_ff;
-extern cpuop_func op_1028_4_nf;
-extern cpuop_func op_1028_4_ff;
-extern cpuop_func op_1030_4_nf;
-extern cpuop_func op_1030_4_ff;
-extern cpuop_func op_1038_4_nf;
-extern cpuop_func op_1038_4_ff;
-extern cpuop_func op_1039_4_nf;
-extern cpuop_func op_1039_4_ff;
-extern cpuop_func op_103a_4_nf;
-extern cpuop_func op_103a_4_ff;
-extern cpuop_func op_103b_4_nf;
-extern cpuop_func op_103b_4_ff;
-extern cpuop_func op_103c_4_nf;
-extern cpuop_func op_103c_4_ff;
-extern cpuop_func op_1080_4_nf;
-extern cpuop_func op_1080_4_ff;
-extern cpuop_func op_1088_4_nf;
-extern cpuop_func op_1088_4_ff;
-extern cpuop_func op_1090_4_nf;
-extern cpuop_func op_1090_4_ff;
-extern cpuop_func op_1098_4_nf;
-extern cpuop_func op_1098_4_ff;
-extern cpuop_func op_10a0_4_nf;
-extern cpuop_func op_10a0_4_ff;
-extern cpuop_func op_10a8_4_nf;
-extern cpuop_func op_10a8_4_ff;
-extern cpuop_func op_10b0_4_nf;
-extern cpuop_func op_10b0_4_ff;
-extern cpuop_func op_10b8_4_nf;
-extern cpuop_func op_10b8_4_ff;
-extern cpuop_func op_10b9_4_nf;
-extern cpuop_func op_10b9_4_ff;
-extern cpuop_func op_10ba_4_nf;
-extern cpuop_func op_10ba_4_ff;
-extern cpuop_func op_10bb_4_nf;
-extern cpuop_func op_10bb_4_ff;
-extern cpuop_func op_10bc_4_nf;
-extern cpuop_func op_10bc_4_ff;
-extern cpuop_func op_10c0_4_nf;
-extern cpuop_func op_10c0_4_ff;
-extern cpuop_func op_10c8_4_nf;
-extern cpuop_func op_10c8_4_ff;
-extern cpuop_func op_10d0_4_nf;
-extern cpuop_func op_10d0_4_ff;
-extern cpuop_func op_10d8_4_nf;
-extern cpuop_func op_10d8_4_ff;
-extern cpuop_func op_10e0_4_nf;
-extern cpuop_func op_10e0_4_ff;
-extern cpuop_func op_10e8_4_nf;
-extern cpuop_func op_10e8_4_ff;
-extern cpuop_func op_10f0_4_nf;
-extern cpuop_func op_10f0_4_ff;
-extern cpuop_func op_10f8_4_nf;
-extern cpuop_func op_10f8_4_ff;
-extern cpuop_func op_10f9_4_nf;
-extern cpuop_func op_10f9_4_ff;
-extern cpuop_func op_10fa_4_nf;
-extern cpuop_func op_10fa_4_ff;
-extern cpuop_func op_10fb_4_nf;
-extern cpuop_func op_10fb_4_ff;
-extern cpuop_func op_10fc_4_nf;
-extern cpuop_func op_10fc_4_ff;
-extern cpuop_func op_1100_4_nf;
-extern cpuop_func op_1100_4_ff;
-extern cpuop_func op_1108_4_nf;
-extern cpuop_func op_1108_4_ff;
-extern cpuop_func op_1110_4_nf;
-extern cpuop_func op_1110_4_ff;
-extern cpuop_func op_1118_4_nf;
-extern cpuop_func op_1118_4_ff;
-extern cpuop_func op_1120_4_nf;
-extern cpuop_func op_1120_4_ff;
-extern cpuop_func op_1128_4_nf;
-extern cpuop_func op_1128_4_ff;
-extern cpuop_func op_1130_4_nf;
-extern cpuop_func op_1130_4_ff;
-extern cpuop_func op_1138_4_nf;
-extern cpuop_func op_1138_4_ff;
-extern cpuop_func op_1139_4_nf;
-extern cpuop_func op_1139_4_ff;
-extern cpuop_func op_113a_4_nf;
-extern cpuop_func op_113a_4_ff;
-extern cpuop_func op_113b_4_nf;
-extern cpuop_func op_113b_4_ff;
-extern cpuop_func op_113c_4_nf;
-extern cpuop_func op_113c_4_ff;
-extern cpuop_func op_1140_4_nf;
-extern cpuop_func op_1140_4_ff;
-extern cpuop_func op_1148_4_nf;
-extern cpuop_func op_1148_4_ff;
-extern cpuop_func op_1150_4_nf;
-extern cpuop_func op_1150_4_ff;
-extern cpuop_func op_1158_4_nf;
-extern cpuop_func op_1158_4_ff;
-extern cpuop_func op_1160_4_nf;
-extern cpuop_func op_1160_4_ff;
-extern cpuop_func op_1168_4_nf;
-extern cpuop_func op_1168_4_ff;
-extern cpuop_func op_1170_4_nf;
-extern cpuop_func op_1170_4_ff;
-extern cpuop_func op_1178_4_nf;
-extern cpuop_func op_1178_4_ff;
-extern cpuop_func op_1179_4_nf;
-extern cpuop_func op_1179_4_ff;
-extern cpuop_func op_117a_4_nf;
-extern cpuop_func op_117a_4_ff;
-extern cpuop_func op_117b_4_nf;
-extern cpuop_func op_117b_4_ff;
-extern cpuop_func op_117c_4_nf;
-extern cpuop_func op_117c_4_ff;
-extern cpuop_func op_1180_4_nf;
-extern cpuop_func op_1180_4_ff;
-extern cpuop_func op_1188_4_nf;
-extern cpuop_func op_1188_4_ff;
-extern cpuop_func op_1190_4_nf;
-extern cpuop_func op_1190_4_ff;
-extern cpuop_func op_1198_4_nf;
-extern cpuop_func op_1198_4_ff;
-extern cpuop_func op_11a0_4_nf;
-extern cpuop_func op_11a0_4_ff;
-extern cpuop_func op_11a8_4_nf;
-extern cpuop_func op_11a8_4_ff;
-extern cpuop_func op_11b0_4_nf;
-extern cpuop_func op_11b0_4_ff;
-extern cpuop_func op_11b8_4_nf;
-extern cpuop_func op_11b8_4_ff;
-extern cpuop_func op_11b9_4_nf;
-extern cpuop_func op_11b9_4_ff;
-extern cpuop_func op_11ba_4_nf;
-extern cpuop_func op_11ba_4_ff;
-extern cpuop_func op_11bb_4_nf;
-extern cpuop_func op_11bb_4_ff;
-extern cpuop_func op_11bc_4_nf;
-extern cpuop_func op_11bc_4_ff;
-extern cpuop_func op_11c0_4_nf;
-extern cpuop_func op_11c0_4_ff;
-extern cpuop_func op_11c8_4_nf;
-extern cpuop_func op_11c8_4_ff;
-extern cpuop_func op_11d0_4_nf;
-extern cpuop_func op_11d0_4_ff;
-extern cpuop_func op_11d8_4_nf;
-extern cpuop_func op_11d8_4_ff;
-extern cpuop_func op_11e0_4_nf;
-extern cpuop_func op_11e0_4_ff;
-extern cpuop_func op_11e8_4_nf;
-extern cpuop_func op_11e8_4_ff;
-extern cpuop_func op_11f0_4_nf;
-extern cpuop_func op_11f0_4_ff;
-extern cpuop_func op_11f8_4_nf;
-extern cpuop_func op_11f8_4_ff;
-extern cpuop_func op_11f9_4_nf;
-extern cpuop_func op_11f9_4_ff;
-extern cpuop_func op_11fa_4_nf;
-extern cpuop_func op_11fa_4_ff;
-extern cpuop_func op_11fb_4_nf;
-extern cpuop_func op_11fb_4_ff;
-extern cpuop_func op_11fc_4_nf;
-extern cpuop_func op_11fc_4_ff;
-extern cpuop_func op_13c0_4_nf;
-extern cpuop_func op_13c0_4_ff;
-extern cpuop_func op_13c8_4_nf;
-extern cpuop_func op_13c8_4_ff;
-extern cpuop_func op_13d0_4_nf;
-extern cpuop_func op_13d0_4_ff;
-extern cpuop_func op_13d8_4_nf;
-extern cpuop_func op_13d8_4_ff;
-extern cpuop_func op_13e0_4_nf;
-extern cpuop_func op_13e0_4_ff;
-extern cpuop_func op_13e8_4_nf;
-extern cpuop_func op_13e8_4_ff;
-extern cpuop_func op_13f0_4_nf;
-extern cpuop_func op_13f0_4_ff;
-extern cpuop_func op_13f8_4_nf;
-extern cpuop_func op_13f8_4_ff;
-extern cpuop_func op_13f9_4_nf;
-extern cpuop_func op_13f9_4_ff;
-extern cpuop_func op_13fa_4_nf;
-extern cpuop_func op_13fa_4_ff;
-extern cpuop_func op_13fb_4_nf;
-extern cpuop_func op_13fb_4_ff;
-extern cpuop_func op_13fc_4_nf;
-extern cpuop_func op_13fc_4_ff;
-extern cpuop_func op_2000_4_nf;
-extern cpuop_func op_2000_4_ff;
-extern cpuop_func op_2008_4_nf;
-extern cpuop_func op_2008_4_ff;
-extern cpuop_func op_2010_4_nf;
-extern cpuop_func op_2010_4_ff;
-extern cpuop_func op_2018_4_nf;
-extern cpuop_func op_2018_4_ff;
-extern cpuop_func op_2020_4_nf;
-extern cpuop_func op_2020_4_ff;
-extern cpuop_func op_2028_4_nf;
-extern cpuop_func op_2028_4_ff;
-extern cpuop_func op_2030_4_nf;
-extern cpuop_func op_2030_4_ff;
-extern cpuop_func op_2038_4_nf;
-extern cpuop_func op_2038_4_ff;
-extern cpuop_func op_2039_4_nf;
-extern cpuop_func op_2039_4_ff;
-extern cpuop_func op_203a_4_nf;
-extern cpuop_func op_203a_4_ff;
-extern cpuop_func op_203b_4_nf;
-extern cpuop_func op_203b_4_ff;
-extern cpuop_func op_203c_4_nf;
-extern cpuop_func op_203c_4_ff;
-extern cpuop_func op_2040_4_nf;
-extern cpuop_func op_2040_4_ff;
-extern cpuop_func op_2048_4_nf;
-extern cpuop_func op_2048_4_ff;
-extern cpuop_func op_2050_4_nf;
-extern cpuop_func op_2050_4_ff;
-extern cpuop_func op_2058_4_nf;
-extern cpuop_func op_2058_4_ff;
-extern cpuop_func op_2060_4_nf;
-extern cpuop_func op_2060_4_ff;
-extern cpuop_func op_2068_4_nf;
-extern cpuop_func op_2068_4_ff;
-extern cpuop_func op_2070_4_nf;
-extern cpuop_func op_2070_4_ff;
-extern cpuop_func op_2078_4_nf;
-extern cpuop_func op_2078_4_ff;
-extern cpuop_func op_2079_4_nf;
-extern cpuop_func op_2079_4_ff;
-extern cpuop_func op_207a_4_nf;
-extern cpuop_func op_207a_4_ff;
-extern cpuop_func op_207b_4_nf;
-extern cpuop_func op_207b_4_ff;
-extern cpuop_func op_207c_4_nf;
-extern cpuop_func op_207c_4_ff;
-extern cpuop_func op_2080_4_nf;
-extern cpuop_func op_2080_4_ff;
-extern cpuop_func op_2088_4_nf;
-extern cpuop_func op_2088_4_ff;
-extern cpuop_func op_2090_4_nf;
-extern cpuop_func op_2090_4_ff;
-extern cpuop_func op_2098_4_nf;
-extern cpuop_func op_2098_4_ff;
-extern cpuop_func op_20a0_4_nf;
-extern cpuop_func op_20a0_4_ff;
-extern cpuop_func op_20a8_4_nf;
-extern cpuop_func op_20a8_4_ff;
-extern cpuop_func op_20b0_4_nf;
-extern cpuop_func op_20b0_4_ff;
-extern cpuop_func op_20b8_4_nf;
-extern cpuop_func op_20b8_4_ff;
-extern cpuop_func op_20b9_4_nf;
-extern cpuop_func op_20b9_4_ff;
-extern cpuop_func op_20ba_4_nf;
-extern cpuop_func op_20ba_4_ff;
-extern cpuop_func op_20bb_4_nf;
-extern cpuop_func op_20bb_4_ff;
-extern cpuop_func op_20bc_4_nf;
-extern cpuop_func op_20bc_4_ff;
-extern cpuop_func op_20c0_4_nf;
-extern cpuop_func op_20c0_4_ff;
-extern cpuop_func op_20c8_4_nf;
-extern cpuop_func op_20c8_4_ff;
-extern cpuop_func op_20d0_4_nf;
-extern cpuop_func op_20d0_4_ff;
-extern cpuop_func op_20d8_4_nf;
-extern cpuop_func op_20d8_4_ff;
-extern cpuop_func op_20e0_4_nf;
-extern cpuop_func op_20e0_4_ff;
-extern cpuop_func op_20e8_4_nf;
-extern cpuop_func op_20e8_4_ff;
-extern cpuop_func op_20f0_4_nf;
-extern cpuop_func op_20f0_4_ff;
-extern cpuop_func op_20f8_4_nf;
-extern cpuop_func op_20f8_4_ff;
-extern cpuop_func op_20f9_4_nf;
-extern cpuop_func op_20f9_4_ff;
-extern cpuop_func op_20fa_4_nf;
-extern cpuop_func op_20fa_4_ff;
-extern cpuop_func op_20fb_4_nf;
-extern cpuop_func op_20fb_4_ff;
-extern cpuop_func op_20fc_4_nf;
-extern cpuop_func op_20fc_4_ff;
-extern cpuop_func op_2100_4_nf;
-extern cpuop_func op_2100_4_ff;
-extern cpuop_func op_2108_4_nf;
-extern cpuop_func op_2108_4_ff;
-extern cpuop_func op_2110_4_nf;
-extern cpuop_func op_2110_4_ff;
-extern cpuop_func op_2118_4_nf;
-extern cpuop_func op_2118_4_ff;
-extern cpuop_func op_2120_4_nf;
-extern cpuop_func op_2120_4_ff;
-extern cpuop_func op_2128_4_nf;
-extern cpuop_func op_2128_4_ff;
-extern cpuop_func op_2130_4_nf;
-extern cpuop_func op_2130_4_ff;
-extern cpuop_func op_2138_4_nf;
-extern cpuop_func op_2138_4_ff;
-extern cpuop_func op_2139_4_nf;
-extern cpuop_func op_2139_4_ff;
-extern cpuop_func op_213a_4_nf;
-extern cpuop_func op_213a_4_ff;
-extern cpuop_func op_213b_4_nf;
-extern cpuop_func op_213b_4_ff;
-extern cpuop_func op_213c_4_nf;
-extern cpuop_func op_213c_4_ff;
-extern cpuop_func op_2140_4_nf;
-extern cpuop_func op_2140_4_ff;
-extern cpuop_func op_2148_4_nf;
-extern cpuop_func op_2148_4_ff;
-extern cpuop_func op_2150_4_nf;
-extern cpuop_func op_2150_4_ff;
-extern cpuop_func op_2158_4_nf;
-extern cpuop_func op_2158_4_ff;
-extern cpuop_func op_2160_4_nf;
-extern cpuop_func op_2160_4_ff;
-extern cpuop_func op_2168_4_nf;
-extern cpuop_func op_2168_4_ff;
-extern cpuop_func op_2170_4_nf;
-extern cpuop_func op_2170_4_ff;
-extern cpuop_func op_2178_4_nf;
-extern cpuop_func op_2178_4_ff;
-extern cpuop_func op_2179_4_nf;
-extern cpuop_func op_2179_4_ff;
-extern cpuop_func op_217a_4_nf;
-extern cpuop_func op_217a_4_ff;
-extern cpuop_func op_217b_4_nf;
-extern cpuop_func op_217b_4_ff;
-extern cpuop_func op_217c_4_nf;
-extern cpuop_func op_217c_4_ff;
-extern cpuop_func op_2180_4_nf;
-extern cpuop_func op_2180_4_ff;
-extern cpuop_func op_2188_4_nf;
-extern cpuop_func op_2188_4_ff;
-extern cpuop_func op_2190_4_nf;
-extern cpuop_func op_2190_4_ff;
-extern cpuop_func op_2198_4_nf;
-extern cpuop_func op_2198_4_ff;
-extern cpuop_func op_21a0_4_nf;
-extern cpuop_func op_21a0_4_ff;
-extern cpuop_func op_21a8_4_nf;
-extern cpuop_func op_21a8_4_ff;
-extern cpuop_func op_21b0_4_nf;
-extern cpuop_func op_21b0_4_ff;
-extern cpuop_func op_21b8_4_nf;
-extern cpuop_func op_21b8_4_ff;
-extern cpuop_func op_21b9_4_nf;
-extern cpuop_func op_21b9_4_ff;
-extern cpuop_func op_21ba_4_nf;
-extern cpuop_func op_21ba_4_ff;
-extern cpuop_func op_21bb_4_nf;
-extern cpuop_func op_21bb_4_ff;
-extern cpuop_func op_21bc_4_nf;
-extern cpuop_func op_21bc_4_ff;
-extern cpuop_func op_21c0_4_nf;
-extern cpuop_func op_21c0_4_ff;
-extern cpuop_func op_21c8_4_nf;
-extern cpuop_func op_21c8_4_ff;
-extern cpuop_func op_21d0_4_nf;
-extern cpuop_func op_21d0_4_ff;
-extern cpuop_func op_21d8_4_nf;
-extern cpuop_func op_21d8_4_ff;
-extern cpuop_func op_21e0_4_nf;
-extern cpuop_func op_21e0_4_ff;
-extern cpuop_func op_21e8_4_nf;
-extern cpuop_func op_21e8_4_ff;
-extern cpuop_func op_21f0_4_nf;
-extern cpuop_func op_21f0_4_ff;
-extern cpuop_func op_21f8_4_nf;
-extern cpuop_func op_21f8_4_ff;
-extern cpuop_func op_21f9_4_nf;
-extern cpuop_func op_21f9_4_ff;
-extern cpuop_func op_21fa_4_nf;
-extern cpuop_func op_21fa_4_ff;
-extern cpuop_func op_21fb_4_nf;
-extern cpuop_func op_21fb_4_ff;
-extern cpuop_func op_21fc_4_nf;
-extern cpuop_func op_21fc_4_ff;
-extern cpuop_func op_23c0_4_nf;
-extern cpuop_func op_23c0_4_ff;
-extern cpuop_func op_23c8_4_nf;
-extern cpuop_func op_23c8_4_ff;
-extern cpuop_func op_23d0_4_nf;
-extern cpuop_func op_23d0_4_ff;
-extern cpuop_func op_23d8_4_nf;
-extern cpuop_func op_23d8_4_ff;
-extern cpuop_func op_23e0_4_nf;
-extern cpuop_func op_23e0_4_ff;
-extern cpuop_func op_23e8_4_nf;
-extern cpuop_func op_23e8_4_ff;
-extern cpuop_func op_23f0_4_nf;
-extern cpuop_func op_23f0_4_ff;
-extern cpuop_func op_23f8_4_nf;
-extern cpuop_func op_23f8_4_ff;
-extern cpuop_func op_23f9_4_nf;
-extern cpuop_func op_23f9_4_ff;
-extern cpuop_func op_23fa_4_nf;
-extern cpuop_func op_23fa_4_ff;
-extern cpuop_func op_23fb_4_nf;
-extern cpuop_func op_23fb_4_ff;
-extern cpuop_func op_23fc_4_nf;
-extern cpuop_func op_23fc_4_ff;
-extern cpuop_func op_3000_4_nf;
-extern cpuop_func op_3000_4_ff;
-extern cpuop_func op_3008_4_nf;
-extern cpuop_func op_3008_4_ff;
-extern cpuop_func op_3010_4_nf;
-extern cpuop_func op_3010_4_ff;
-extern cpuop_func op_3018_4_nf;
-extern cpuop_func op_3018_4_ff;
-extern cpuop_func op_3020_4_nf;
-extern cpuop_func op_3020_4_ff;
-extern cpuop_func op_3028_4_nf;
-extern cpuop_func op_3028_4_ff;
-extern cpuop_func op_3030_4_nf;
-extern cpuop_func op_3030_4_ff;
-extern cpuop_func op_3038_4_nf;
-extern cpuop_func op_3038_4_ff;
-extern cpuop_func op_3039_4_nf;
-extern cpuop_func op_3039_4_ff;
-extern cpuop_func op_303a_4_nf;
-extern cpuop_func op_303a_4_ff;
-extern cpuop_func op_303b_4_nf;
-extern cpuop_func op_303b_4_ff;
-extern cpuop_func op_303c_4_nf;
-extern cpuop_func op_303c_4_ff;
-extern cpuop_func op_3040_4_nf;
-extern cpuop_func op_3040_4_ff;
-extern cpuop_func op_3048_4_nf;
-extern cpuop_func op_3048_4_ff;
-extern cpuop_func op_3050_4_nf;
-extern cpuop_func op_3050_4_ff;
-extern cpuop_func op_3058_4_nf;
-extern cpuop_func op_3058_4_ff;
-extern cpuop_func op_3060_4_nf;
-extern cpuop_func op_3060_4_ff;
-extern cpuop_func op_3068_4_nf;
-extern cpuop_func op_3068_4_ff;
-extern cpuop_func op_3070_4_nf;
-extern cpuop_func op_3070_4_ff;
-extern cpuop_func op_3078_4_nf;
-extern cpuop_func op_3078_4_ff;
-extern cpuop_func op_3079_4_nf;
-extern cpuop_func op_3079_4_ff;
-extern cpuop_func op_307a_4_nf;
-extern cpuop_func op_307a_4_ff;
-extern cpuop_func op_307b_4_nf;
-extern cpuop_func op_307b_4_ff;
-extern cpuop_func op_307c_4_nf;
-extern cpuop_func op_307c_4_ff;
-extern cpuop_func op_3080_4_nf;
-extern cpuop_func op_3080_4_ff;
-extern cpuop_func op_3088_4_nf;
-extern cpuop_func op_3088_4_ff;
-extern cpuop_func op_3090_4_nf;
-extern cpuop_func op_3090_4_ff;
-extern cpuop_func op_3098_4_nf;
-extern cpuop_func op_3098_4_ff;
-extern cpuop_func op_30a0_4_nf;
-extern cpuop_func op_30a0_4_ff;
-extern cpuop_func op_30a8_4_nf;
-extern cpuop_func op_30a8_4_ff;
-extern cpuop_func op_30b0_4_nf;
-extern cpuop_func op_30b0_4_ff;
-extern cpuop_func op_30b8_4_nf;
-extern cpuop_func op_30b8_4_ff;
-extern cpuop_func op_30b9_4_nf;
-extern cpuop_func op_30b9_4_ff;
-extern cpuop_func op_30ba_4_nf;
-extern cpuop_func op_30ba_4_ff;
-extern cpuop_func op_30bb_4_nf;
-extern cpuop_func op_30bb_4_ff;
-extern cpuop_func op_30bc_4_nf;
-extern cpuop_func op_30bc_4_ff;
-extern cpuop_func op_30c0_4_nf;
-extern cpuop_func op_30c0_4_ff;
-extern cpuop_func op_30c8_4_nf;
-extern cpuop_func op_30c8_4_ff;
-extern cpuop_func op_30d0_4_nf;
-extern cpuop_func op_30d0_4_ff;
-extern cpuop_func op_30d8_4_nf;
-extern cpuop_func op_30d8_4_ff;
-extern cpuop_func op_30e0_4_nf;
-extern cpuop_func op_30e0_4_ff;
-extern cpuop_func op_30e8_4_nf;
-extern cpuop_func op_30e8_4_ff;
-extern cpuop_func op_30f0_4_nf;
-extern cpuop_func op_30f0_4_ff;
-extern cpuop_func op_30f8_4_nf;
-extern cpuop_func op_30f8_4_ff;
-extern cpuop_func op_30f9_4_nf;
-extern cpuop_func op_30f9_4_ff;
-extern cpuop_func op_30fa_4_nf;
-extern cpuop_func op_30fa_4_ff;
-extern cpuop_func op_30fb_4_nf;
-extern cpuop_func op_30fb_4_ff;
-extern cpuop_func op_30fc_4_nf;
-extern cpuop_func op_30fc_4_ff;
-extern cpuop_func op_3100_4_nf;
-extern cpuop_func op_3100_4_ff;
-extern cpuop_func op_3108_4_nf;
-extern cpuop_func op_3108_4_ff;
-extern cpuop_func op_3110_4_nf;
-extern cpuop_func op_3110_4_ff;
-extern cpuop_func op_3118_4_nf;
-extern cpuop_func op_3118_4_ff;
-extern cpuop_func op_3120_4_nf;
-extern cpuop_func op_3120_4_ff;
-extern cpuop_func op_3128_4_nf;
-extern cpuop_func op_3128_4_ff;
-extern cpuop_func op_3130_4_nf;
-extern cpuop_func op_3130_4_ff;
-extern cpuop_func op_3138_4_nf;
-extern cpuop_func op_3138_4_ff;
-extern cpuop_func op_3139_4_nf;
-extern cpuop_func op_3139_4_ff;
-extern cpuop_func op_313a_4_nf;
-extern cpuop_func op_313a_4_ff;
-extern cpuop_func op_313b_4_nf;
-extern cpuop_func op_313b_4_ff;
-extern cpuop_func op_313c_4_nf;
-extern cpuop_func op_313c_4_ff;
-extern cpuop_func op_3140_4_nf;
-extern cpuop_func op_3140_4_ff;
-extern cpuop_func op_3148_4_nf;
-extern cpuop_func op_3148_4_ff;
-extern cpuop_func op_3150_4_nf;
-extern cpuop_func op_3150_4_ff;
-extern cpuop_func op_3158_4_nf;
-extern cpuop_func op_3158_4_ff;
-extern cpuop_func op_3160_4_nf;
-extern cpuop_func op_3160_4_ff;
-extern cpuop_func op_3168_4_nf;
-extern cpuop_func op_3168_4_ff;
-extern cpuop_func op_3170_4_nf;
-extern cpuop_func op_3170_4_ff;
-extern cpuop_func op_3178_4_nf;
-extern cpuop_func op_3178_4_ff;
-extern cpuop_func op_3179_4_nf;
-extern cpuop_func op_3179_4_ff;
-extern cpuop_func op_317a_4_nf;
-extern cpuop_func op_317a_4_ff;
-extern cpuop_func op_317b_4_nf;
-extern cpuop_func op_317b_4_ff;
-extern cpuop_func op_317c_4_nf;
-extern cpuop_func op_317c_4_ff;
-extern cpuop_func op_3180_4_nf;
-extern cpuop_func op_3180_4_ff;
-extern cpuop_func op_3188_4_nf;
-extern cpuop_func op_3188_4_ff;
-extern cpuop_func op_3190_4_nf;
-extern cpuop_func op_3190_4_ff;
-extern cpuop_func op_3198_4_nf;
-extern cpuop_func op_3198_4_ff;
-extern cpuop_func op_31a0_4_nf;
-extern cpuop_func op_31a0_4_ff;
-extern cpuop_func op_31a8_4_nf;
-extern cpuop_func op_31a8_4_ff;
-extern cpuop_func op_31b0_4_nf;
-extern cpuop_func op_31b0_4_ff;
-extern cpuop_func op_31b8_4_nf;
-extern cpuop_func op_31b8_4_ff;
-extern cpuop_func op_31b9_4_nf;
-extern cpuop_func op_31b9_4_ff;
-extern cpuop_func op_31ba_4_nf;
-extern cpuop_func op_31ba_4_ff;
-extern cpuop_func op_31bb_4_nf;
-extern cpuop_func op_31bb_4_ff;
-extern cpuop_func op_31bc_4_nf;
-extern cpuop_func op_31bc_4_ff;
-extern cpuop_func op_31c0_4_nf;
-extern cpuop_func op_31c0_4_ff;
-extern cpuop_func op_31c8_4_nf;
-extern cpuop_func op_31c8_4_ff;
-extern cpuop_func op_31d0_4_nf;
-extern cpuop_func op_31d0_4_ff;
-extern cpuop_func op_31d8_4_nf;
-extern cpuop_func op_31d8_4_ff;
-extern cpuop_func op_31e0_4_nf;
-extern cpuop_func op_31e0_4_ff;
-extern cpuop_func op_31e8_4_nf;
-extern cpuop_func op_31e8_4_ff;
-extern cpuop_func op_31f0_4_nf;
-extern cpuop_func op_31f0_4_ff;
-extern cpuop_func op_31f8_4_nf;
-extern cpuop_func op_31f8_4_ff;
-extern cpuop_func op_31f9_4_nf;
-extern cpuop_func op_31f9_4_ff;
-extern cpuop_func op_31fa_4_nf;
-extern cpuop_func op_31fa_4_ff;
-extern cpuop_func op_31fb_4_nf;
-extern cpuop_func op_31fb_4_ff;
-extern cpuop_func op_31fc_4_nf;
-extern cpuop_func op_31fc_4_ff;
-extern cpuop_func op_33c0_4_nf;
-extern cpuop_func op_33c0_4_ff;
-extern cpuop_func op_33c8_4_nf;
-extern cpuop_func op_33c8_4_ff;
-extern cpuop_func op_33d0_4_nf;
-extern cpuop_func op_33d0_4_ff;
-extern cpuop_func op_33d8_4_nf;
-extern cpuop_func op_33d8_4_ff;
-extern cpuop_func op_33e0_4_nf;
-extern cpuop_func op_33e0_4_ff;
-extern cpuop_func op_33e8_4_nf;
-extern cpuop_func op_33e8_4_ff;
-extern cpuop_func op_33f0_4_nf;
-extern cpuop_func op_33f0_4_ff;
-extern cpuop_func op_33f8_4_nf;
-extern cpuop_func op_33f8_4_ff;
-extern cpuop_func op_33f9_4_nf;
-extern cpuop_func op_33f9_4_ff;
-extern cpuop_func op_33fa_4_nf;
-extern cpuop_func op_33fa_4_ff;
-extern cpuop_func op_33fb_4_nf;
-extern cpuop_func op_33fb_4_ff;
-extern cpuop_func op_33fc_4_nf;
-extern cpuop_func op_33fc_4_ff;
-extern cpuop_func op_4000_4_nf;
-extern cpuop_func op_4000_4_ff;
-extern cpuop_func op_4010_4_nf;
-extern cpuop_func op_4010_4_ff;
-extern cpuop_func op_4018_4_nf;
-extern cpuop_func op_4018_4_ff;
-extern cpuop_func op_4020_4_nf;
-extern cpuop_func op_4020_4_ff;
-extern cpuop_func op_4028_4_nf;
-extern cpuop_func op_4028_4_ff;
-extern cpuop_func op_4030_4_nf;
-extern cpuop_func op_4030_4_ff;
-extern cpuop_func op_4038_4_nf;
-extern cpuop_func op_4038_4_ff;
-extern cpuop_func op_4039_4_nf;
-extern cpuop_func op_4039_4_ff;
-extern cpuop_func op_4040_4_nf;
-extern cpuop_func op_4040_4_ff;
-extern cpuop_func op_4050_4_nf;
-extern cpuop_func op_4050_4_ff;
-extern cpuop_func op_4058_4_nf;
-extern cpuop_func op_4058_4_ff;
-extern cpuop_func op_4060_4_nf;
-extern cpuop_func op_4060_4_ff;
-extern cpuop_func op_4068_4_nf;
-extern cpuop_func op_4068_4_ff;
-extern cpuop_func op_4070_4_nf;
-extern cpuop_func op_4070_4_ff;
-extern cpuop_func op_4078_4_nf;
-extern cpuop_func op_4078_4_ff;
-extern cpuop_func op_4079_4_nf;
-extern cpuop_func op_4079_4_ff;
-extern cpuop_func op_4080_4_nf;
-extern cpuop_func op_4080_4_ff;
-extern cpuop_func op_4090_4_nf;
-extern cpuop_func op_4090_4_ff;
-extern cpuop_func op_4098_4_nf;
-extern cpuop_func op_4098_4_ff;
-extern cpuop_func op_40a0_4_nf;
-extern cpuop_func op_40a0_4_ff;
-extern cpuop_func op_40a8_4_nf;
-extern cpuop_func op_40a8_4_ff;
-extern cpuop_func op_40b0_4_nf;
-extern cpuop_func op_40b0_4_ff;
-extern cpuop_func op_40b8_4_nf;
-extern cpuop_func op_40b8_4_ff;
-extern cpuop_func op_40b9_4_nf;
-extern cpuop_func op_40b9_4_ff;
-extern cpuop_func op_40c0_4_nf;
-extern cpuop_func op_40c0_4_ff;
-extern cpuop_func op_40d0_4_nf;
-extern cpuop_func op_40d0_4_ff;
-extern cpuop_func op_40d8_4_nf;
-extern cpuop_func op_40d8_4_ff;
-extern cpuop_func op_40e0_4_nf;
-extern cpuop_func op_40e0_4_ff;
-extern cpuop_func op_40e8_4_nf;
-extern cpuop_func op_40e8_4_ff;
-extern cpuop_func op_40f0_4_nf;
-extern cpuop_func op_40f0_4_ff;
-extern cpuop_func op_40f8_4_nf;
-extern cpuop_func op_40f8_4_ff;
-extern cpuop_func op_40f9_4_nf;
-extern cpuop_func op_40f9_4_ff;
-extern cpuop_func op_4180_4_nf;
-extern cpuop_func op_4180_4_ff;
-extern cpuop_func op_4190_4_nf;
-extern cpuop_func op_4190_4_ff;
-extern cpuop_func op_4198_4_nf;
-extern cpuop_func op_4198_4_ff;
-extern cpuop_func op_41a0_4_nf;
-extern cpuop_func op_41a0_4_ff;
-extern cpuop_func op_41a8_4_nf;
-extern cpuop_func op_41a8_4_ff;
-extern cpuop_func op_41b0_4_nf;
-extern cpuop_func op_41b0_4_ff;
-extern cpuop_func op_41b8_4_nf;
-extern cpuop_func op_41b8_4_ff;
-extern cpuop_func op_41b9_4_nf;
-extern cpuop_func op_41b9_4_ff;
-extern cpuop_func op_41ba_4_nf;
-extern cpuop_func op_41ba_4_ff;
-extern cpuop_func op_41bb_4_nf;
-extern cpuop_func op_41bb_4_ff;
-extern cpuop_func op_41bc_4_nf;
-extern cpuop_func op_41bc_4_ff;
-extern cpuop_func op_41d0_4_nf;
-extern cpuop_func op_41d0_4_ff;
-extern cpuop_func op_41e8_4_nf;
-extern cpuop_func op_41e8_4_ff;
-extern cpuop_func op_41f0_4_nf;
-extern cpuop_func op_41f0_4_ff;
-extern cpuop_func op_41f8_4_nf;
-extern cpuop_func op_41f8_4_ff;
-extern cpuop_func op_41f9_4_nf;
-extern cpuop_func op_41f9_4_ff;
-extern cpuop_func op_41fa_4_nf;
-extern cpuop_func op_41fa_4_ff;
-extern cpuop_func op_41fb_4_nf;
-extern cpuop_func op_41fb_4_ff;
-extern cpuop_func op_4200_4_nf;
-extern cpuop_func op_4200_4_ff;
-extern cpuop_func op_4210_4_nf;
-extern cpuop_func op_4210_4_ff;
-extern cpuop_func op_4218_4_nf;
-extern cpuop_func op_4218_4_ff;
-extern cpuop_func op_4220_4_nf;
-extern cpuop_func op_4220_4_ff;
-extern cpuop_func op_4228_4_nf;
-extern cpuop_func op_4228_4_ff;
-extern cpuop_func op_4230_4_nf;
-extern cpuop_func op_4230_4_ff;
-extern cpuop_func op_4238_4_nf;
-extern cpuop_func op_4238_4_ff;
-extern cpuop_func op_4239_4_nf;
-extern cpuop_func op_4239_4_ff;
-extern cpuop_func op_4240_4_nf;
-extern cpuop_func op_4240_4_ff;
-extern cpuop_func op_4250_4_nf;
-extern cpuop_func op_4250_4_ff;
-extern cpuop_func op_4258_4_nf;
-extern cpuop_func op_4258_4_ff;
-extern cpuop_func op_4260_4_nf;
-extern cpuop_func op_4260_4_ff;
-extern cpuop_func op_4268_4_nf;
-extern cpuop_func op_4268_4_ff;
-extern cpuop_func op_4270_4_nf;
-extern cpuop_func op_4270_4_ff;
-extern cpuop_func op_4278_4_nf;
-extern cpuop_func op_4278_4_ff;
-extern cpuop_func op_4279_4_nf;
-extern cpuop_func op_4279_4_ff;
-extern cpuop_func op_4280_4_nf;
-extern cpuop_func op_4280_4_ff;
-extern cpuop_func op_4290_4_nf;
-extern cpuop_func op_4290_4_ff;
-extern cpuop_func op_4298_4_nf;
-extern cpuop_func op_4298_4_ff;
-extern cpuop_func op_42a0_4_nf;
-extern cpuop_func op_42a0_4_ff;
-extern cpuop_func op_42a8_4_nf;
-extern cpuop_func op_42a8_4_ff;
-extern cpuop_func op_42b0_4_nf;
-extern cpuop_func op_42b0_4_ff;
-extern cpuop_func op_42b8_4_nf;
-extern cpuop_func op_42b8_4_ff;
-extern cpuop_func op_42b9_4_nf;
-extern cpuop_func op_42b9_4_ff;
-extern cpuop_func op_4400_4_nf;
-extern cpuop_func op_4400_4_ff;
-extern cpuop_func op_4410_4_nf;
-extern cpuop_func op_4410_4_ff;
-extern cpuop_func op_4418_4_nf;
-extern cpuop_func op_4418_4_ff;
-extern cpuop_func op_4420_4_nf;
-extern cpuop_func op_4420_4_ff;
-extern cpuop_func op_4428_4_nf;
-extern cpuop_func op_4428_4_ff;
-extern cpuop_func op_4430_4_nf;
-extern cpuop_func op_4430_4_ff;
-extern cpuop_func op_4438_4_nf;
-extern cpuop_func op_4438_4_ff;
-extern cpuop_func op_4439_4_nf;
-extern cpuop_func op_4439_4_ff;
-extern cpuop_func op_4440_4_nf;
-extern cpuop_func op_4440_4_ff;
-extern cpuop_func op_4450_4_nf;
-extern cpuop_func op_4450_4_ff;
-extern cpuop_func op_4458_4_nf;
-extern cpuop_func op_4458_4_ff;
-extern cpuop_func op_4460_4_nf;
-extern cpuop_func op_4460_4_ff;
-extern cpuop_func op_4468_4_nf;
-extern cpuop_func op_4468_4_ff;
-extern cpuop_func op_4470_4_nf;
-extern cpuop_func op_4470_4_ff;
-extern cpuop_func op_4478_4_nf;
-extern cpuop_func op_4478_4_ff;
-extern cpuop_func op_4479_4_nf;
-extern cpuop_func op_4479_4_ff;
-extern cpuop_func op_4480_4_nf;
-extern cpuop_func op_4480_4_ff;
-extern cpuop_func op_4490_4_nf;
-extern cpuop_func op_4490_4_ff;
-extern cpuop_func op_4498_4_nf;
-extern cpuop_func op_4498_4_ff;
-extern cpuop_func op_44a0_4_nf;
-extern cpuop_func op_44a0_4_ff;
-extern cpuop_func op_44a8_4_nf;
-extern cpuop_func op_44a8_4_ff;
-extern cpuop_func op_44b0_4_nf;
-extern cpuop_func op_44b0_4_ff;
-extern cpuop_func op_44b8_4_nf;
-extern cpuop_func op_44b8_4_ff;
-extern cpuop_func op_44b9_4_nf;
-extern cpuop_func op_44b9_4_ff;
-extern cpuop_func op_44c0_4_nf;
-extern cpuop_func op_44c0_4_ff;
-extern cpuop_func op_44d0_4_nf;
-extern cpuop_func op_44d0_4_ff;
-extern cpuop_func op_44d8_4_nf;
-extern cpuop_func op_44d8_4_ff;
-extern cpuop_func op_44e0_4_nf;
-extern cpuop_func op_44e0_4_ff;
-extern cpuop_func op_44e8_4_nf;
-extern cpuop_func op_44e8_4_ff;
-extern cpuop_func op_44f0_4_nf;
-extern cpuop_func op_44f0_4_ff;
-extern cpuop_func op_44f8_4_nf;
-extern cpuop_func op_44f8_4_ff;
-extern cpuop_func op_44f9_4_nf;
-extern cpuop_func op_44f9_4_ff;
-extern cpuop_func op_44fa_4_nf;
-extern cpuop_func op_44fa_4_ff;
-extern cpuop_func op_44fb_4_nf;
-extern cpuop_func op_44fb_4_ff;
-extern cpuop_func op_44fc_4_nf;
-extern cpuop_func op_44fc_4_ff;
-extern cpuop_func op_4600_4_nf;
-extern cpuop_func op_4600_4_ff;
-extern cpuop_func op_4610_4_nf;
-extern cpuop_func op_4610_4_ff;
-extern cpuop_func op_4618_4_nf;
-extern cpuop_func op_4618_4_ff;
-extern cpuop_func op_4620_4_nf;
-extern cpuop_func op_4620_4_ff;
-extern cpuop_func op_4628_4_nf;
-extern cpuop_func op_4628_4_ff;
-extern cpuop_func op_4630_4_nf;
-extern cpuop_func op_4630_4_ff;
-extern cpuop_func op_4638_4_nf;
-extern cpuop_func op_4638_4_ff;
-extern cpuop_func op_4639_4_nf;
-extern cpuop_func op_4639_4_ff;
-extern cpuop_func op_4640_4_nf;
-extern cpuop_func op_4640_4_ff;
-extern cpuop_func op_4650_4_nf;
-extern cpuop_func op_4650_4_ff;
-extern cpuop_func op_4658_4_nf;
-extern cpuop_func op_4658_4_ff;
-extern cpuop_func op_4660_4_nf;
-extern cpuop_func op_4660_4_ff;
-extern cpuop_func op_4668_4_nf;
-extern cpuop_func op_4668_4_ff;
-extern cpuop_func op_4670_4_nf;
-extern cpuop_func op_4670_4_ff;
-extern cpuop_func op_4678_4_nf;
-extern cpuop_func op_4678_4_ff;
-extern cpuop_func op_4679_4_nf;
-extern cpuop_func op_4679_4_ff;
-extern cpuop_func op_4680_4_nf;
-extern cpuop_func op_4680_4_ff;
-extern cpuop_func op_4690_4_nf;
-extern cpuop_func op_4690_4_ff;
-extern cpuop_func op_4698_4_nf;
-extern cpuop_func op_4698_4_ff;
-extern cpuop_func op_46a0_4_nf;
-extern cpuop_func op_46a0_4_ff;
-extern cpuop_func op_46a8_4_nf;
-extern cpuop_func op_46a8_4_ff;
-extern cpuop_func op_46b0_4_nf;
-extern cpuop_func op_46b0_4_ff;
-extern cpuop_func op_46b8_4_nf;
-extern cpuop_func op_46b8_4_ff;
-extern cpuop_func op_46b9_4_nf;
-extern cpuop_func op_46b9_4_ff;
-extern cpuop_func op_46c0_4_nf;
-extern cpuop_func op_46c0_4_ff;
-extern cpuop_func op_46d0_4_nf;
-extern cpuop_func op_46d0_4_ff;
-extern cpuop_func op_46d8_4_nf;
-extern cpuop_func op_46d8_4_ff;
-extern cpuop_func op_46e0_4_nf;
-extern cpuop_func op_46e0_4_ff;
-extern cpuop_func op_46e8_4_nf;
-extern cpuop_func op_46e8_4_ff;
-extern cpuop_func op_46f0_4_nf;
-extern cpuop_func op_46f0_4_ff;
-extern cpuop_func op_46f8_4_nf;
-extern cpuop_func op_46f8_4_ff;
-extern cpuop_func op_46f9_4_nf;
-extern cpuop_func op_46f9_4_ff;
-extern cpuop_func op_46fa_4_nf;
-extern cpuop_func op_46fa_4_ff;
-extern cpuop_func op_46fb_4_nf;
-extern cpuop_func op_46fb_4_ff;
-extern cpuop_func op_46fc_4_nf;
-extern cpuop_func op_46fc_4_ff;
-extern cpuop_func op_4800_4_nf;
-extern cpuop_func op_4800_4_ff;
-extern cpuop_func op_4810_4_nf;
-extern cpuop_func op_4810_4_ff;
-extern cpuop_func op_4818_4_nf;
-extern cpuop_func op_4818_4_ff;
-extern cpuop_func op_4820_4_nf;
-extern cpuop_func op_4820_4_ff;
-extern cpuop_func op_4828_4_nf;
-extern cpuop_func op_4828_4_ff;
-extern cpuop_func op_4830_4_nf;
-extern cpuop_func op_4830_4_ff;
-extern cpuop_func op_4838_4_nf;
-extern cpuop_func op_4838_4_ff;
-extern cpuop_func op_4839_4_nf;
-extern cpuop_func op_4839_4_ff;
-extern cpuop_func op_4840_4_nf;
-extern cpuop_func op_4840_4_ff;
-extern cpuop_func op_4850_4_nf;
-extern cpuop_func op_4850_4_ff;
-extern cpuop_func op_4868_4_nf;
-extern cpuop_func op_4868_4_ff;
-extern cpuop_func op_4870_4_nf;
-extern cpuop_func op_4870_4_ff;
-extern cpuop_func op_4878_4_nf;
-extern cpuop_func op_4878_4_ff;
-extern cpuop_func op_4879_4_nf;
-extern cpuop_func op_4879_4_ff;
-extern cpuop_func op_487a_4_nf;
-extern cpuop_func op_487a_4_ff;
-extern cpuop_func op_487b_4_nf;
-extern cpuop_func op_487b_4_ff;
-extern cpuop_func op_4880_4_nf;
-extern cpuop_func op_4880_4_ff;
-extern cpuop_func op_4890_4_nf;
-extern cpuop_func op_4890_4_ff;
-extern cpuop_func op_48a0_4_nf;
-extern cpuop_func op_48a0_4_ff;
-extern cpuop_func op_48a8_4_nf;
-extern cpuop_func op_48a8_4_ff;
-extern cpuop_func op_48b0_4_nf;
-extern cpuop_func op_48b0_4_ff;
-extern cpuop_func op_48b8_4_nf;
-extern cpuop_func op_48b8_4_ff;
-extern cpuop_func op_48b9_4_nf;
-extern cpuop_func op_48b9_4_ff;
-extern cpuop_func op_48c0_4_nf;
-extern cpuop_func op_48c0_4_ff;
-extern cpuop_func op_48d0_4_nf;
-extern cpuop_func op_48d0_4_ff;
-extern cpuop_func op_48e0_4_nf;
-extern cpuop_func op_48e0_4_ff;
-extern cpuop_func op_48e8_4_nf;
-extern cpuop_func op_48e8_4_ff;
-extern cpuop_func op_48f0_4_nf;
-extern cpuop_func op_48f0_4_ff;
-extern cpuop_func op_48f8_4_nf;
-extern cpuop_func op_48f8_4_ff;
-extern cpuop_func op_48f9_4_nf;
-extern cpuop_func op_48f9_4_ff;
-extern cpuop_func op_4a00_4_nf;
-extern cpuop_func op_4a00_4_ff;
-extern cpuop_func op_4a10_4_nf;
-extern cpuop_func op_4a10_4_ff;
-extern cpuop_func op_4a18_4_nf;
-extern cpuop_func op_4a18_4_ff;
-extern cpuop_func op_4a20_4_nf;
-extern cpuop_func op_4a20_4_ff;
-extern cpuop_func op_4a28_4_nf;
-extern cpuop_func op_4a28_4_ff;
-extern cpuop_func op_4a30_4_nf;
-extern cpuop_func op_4a30_4_ff;
-extern cpuop_func op_4a38_4_nf;
-extern cpuop_func op_4a38_4_ff;
-extern cpuop_func op_4a39_4_nf;
-extern cpuop_func op_4a39_4_ff;
-extern cpuop_func op_4a3a_4_nf;
-extern cpuop_func op_4a3a_4_ff;
-extern cpuop_func op_4a3b_4_nf;
-extern cpuop_func op_4a3b_4_ff;
-extern cpuop_func op_4a3c_4_nf;
-extern cpuop_func op_4a3c_4_ff;
-extern cpuop_func op_4a40_4_nf;
-extern cpuop_func op_4a40_4_ff;
-extern cpuop_func op_4a48_4_nf;
-extern cpuop_func op_4a48_4_ff;
-extern cpuop_func op_4a50_4_nf;
-extern cpuop_func op_4a50_4_ff;
-extern cpuop_func op_4a58_4_nf;
-extern cpuop_func op_4a58_4_ff;
-extern cpuop_func op_4a60_4_nf;
-extern cpuop_func op_4a60_4_ff;
-extern cpuop_func op_4a68_4_nf;
-extern cpuop_func op_4a68_4_ff;
-extern cpuop_func op_4a70_4_nf;
-extern cpuop_func op_4a70_4_ff;
-extern cpuop_func op_4a78_4_nf;
-extern cpuop_func op_4a78_4_ff;
-extern cpuop_func op_4a79_4_nf;
-extern cpuop_func op_4a79_4_ff;
-extern cpuop_func op_4a7a_4_nf;
-extern cpuop_func op_4a7a_4_ff;
-extern cpuop_func op_4a7b_4_nf;
-extern cpuop_func op_4a7b_4_ff;
-extern cpuop_func op_4a7c_4_nf;
-extern cpuop_func op_4a7c_4_ff;
-extern cpuop_func op_4a80_4_nf;
-extern cpuop_func op_4a80_4_ff;
-extern cpuop_func op_4a88_4_nf;
-extern cpuop_func op_4a88_4_ff;
-extern cpuop_func op_4a90_4_nf;
-extern cpuop_func op_4a90_4_ff;
-extern cpuop_func op_4a98_4_nf;
-extern cpuop_func op_4a98_4_ff;
-extern cpuop_func op_4aa0_4_nf;
-extern cpuop_func op_4aa0_4_ff;
-extern cpuop_func op_4aa8_4_nf;
-extern cpuop_func op_4aa8_4_ff;
-extern cpuop_func op_4ab0_4_nf;
-extern cpuop_func op_4ab0_4_ff;
-extern cpuop_func op_4ab8_4_nf;
-extern cpuop_func op_4ab8_4_ff;
-extern cpuop_func op_4ab9_4_nf;
-extern cpuop_func op_4ab9_4_ff;
-extern cpuop_func op_4aba_4_nf;
-extern cpuop_func op_4aba_4_ff;
-extern cpuop_func op_4abb_4_nf;
-extern cpuop_func op_4abb_4_ff;
-extern cpuop_func op_4abc_4_nf;
-extern cpuop_func op_4abc_4_ff;
-extern cpuop_func op_4ac0_4_nf;
-extern cpuop_func op_4ac0_4_ff;
-extern cpuop_func op_4ad0_4_nf;
-extern cpuop_func op_4ad0_4_ff;
-extern cpuop_func op_4ad8_4_nf;
-extern cpuop_func op_4ad8_4_ff;
-extern cpuop_func op_4ae0_4_nf;
-extern cpuop_func op_4ae0_4_ff;
-extern cpuop_func op_4ae8_4_nf;
-extern cpuop_func op_4ae8_4_ff;
-extern cpuop_func op_4af0_4_nf;
-extern cpuop_func op_4af0_4_ff;
-extern cpuop_func op_4af8_4_nf;
-extern cpuop_func op_4af8_4_ff;
-extern cpuop_func op_4af9_4_nf;
-extern cpuop_func op_4af9_4_ff;
-extern cpuop_func op_4c90_4_nf;
-extern cpuop_func op_4c90_4_ff;
-extern cpuop_func op_4c98_4_nf;
-extern cpuop_func op_4c98_4_ff;
-extern cpuop_func op_4ca8_4_nf;
-extern cpuop_func op_4ca8_4_ff;
-extern cpuop_func op_4cb0_4_nf;
-extern cpuop_func op_4cb0_4_ff;
-extern cpuop_func op_4cb8_4_nf;
-extern cpuop_func op_4cb8_4_ff;
-extern cpuop_func op_4cb9_4_nf;
-extern cpuop_func op_4cb9_4_ff;
-extern cpuop_func op_4cba_4_nf;
-extern cpuop_func op_4cba_4_ff;
-extern cpuop_func op_4cbb_4_nf;
-extern cpuop_func op_4cbb_4_ff;
-extern cpuop_func op_4cd0_4_nf;
-extern cpuop_func op_4cd0_4_ff;
-extern cpuop_func op_4cd8_4_nf;
-extern cpuop_func op_4cd8_4_ff;
-extern cpuop_func op_4ce8_4_nf;
-extern cpuop_func op_4ce8_4_ff;
-extern cpuop_func op_4cf0_4_nf;
-extern cpuop_func op_4cf0_4_ff;
-extern cpuop_func op_4cf8_4_nf;
-extern cpuop_func op_4cf8_4_ff;
-extern cpuop_func op_4cf9_4_nf;
-extern cpuop_func op_4cf9_4_ff;
-extern cpuop_func op_4cfa_4_nf;
-extern cpuop_func op_4cfa_4_ff;
-extern cpuop_func op_4cfb_4_nf;
-extern cpuop_func op_4cfb_4_ff;
-extern cpuop_func op_4e40_4_nf;
-extern cpuop_func op_4e40_4_ff;
-extern cpuop_func op_4e50_4_nf;
-extern cpuop_func op_4e50_4_ff;
-extern cpuop_func op_4e58_4_nf;
-extern cpuop_func op_4e58_4_ff;
-extern cpuop_func op_4e60_4_nf;
-extern cpuop_func op_4e60_4_ff;
-extern cpuop_func op_4e68_4_nf;
-extern cpuop_func op_4e68_4_ff;
-extern cpuop_func op_4e70_4_nf;
-extern cpuop_func op_4e70_4_ff;
-extern cpuop_func op_4e71_4_nf;
-extern cpuop_func op_4e71_4_ff;
-extern cpuop_func op_4e72_4_nf;
-extern cpuop_func op_4e72_4_ff;
-extern cpuop_func op_4e73_4_nf;
-extern cpuop_func op_4e73_4_ff;
-extern cpuop_func op_4e74_4_nf;
-extern cpuop_func op_4e74_4_ff;
-extern cpuop_func op_4e75_4_nf;
-extern cpuop_func op_4e75_4_ff;
-extern cpuop_func op_4e76_4_nf;
-extern cpuop_func op_4e76_4_ff;
-extern cpuop_func op_4e77_4_nf;
-extern cpuop_func op_4e77_4_ff;
-extern cpuop_func op_4e90_4_nf;
-extern cpuop_func op_4e90_4_ff;
-extern cpuop_func op_4ea8_4_nf;
-extern cpuop_func op_4ea8_4_ff;
-extern cpuop_func op_4eb0_4_nf;
-extern cpuop_func op_4eb0_4_ff;
-extern cpuop_func op_4eb8_4_nf;
-extern cpuop_func op_4eb8_4_ff;
-extern cpuop_func op_4eb9_4_nf;
-extern cpuop_func op_4eb9_4_ff;
-extern cpuop_func op_4eba_4_nf;
-extern cpuop_func op_4eba_4_ff;
-extern cpuop_func op_4ebb_4_nf;
-extern cpuop_func op_4ebb_4_ff;
-extern cpuop_func op_4ed0_4_nf;
-extern cpuop_func op_4ed0_4_ff;
-extern cpuop_func op_4ee8_4_nf;
-extern cpuop_func op_4ee8_4_ff;
-extern cpuop_func op_4ef0_4_nf;
-extern cpuop_func op_4ef0_4_ff;
-extern cpuop_func op_4ef8_4_nf;
-extern cpuop_func op_4ef8_4_ff;
-extern cpuop_func op_4ef9_4_nf;
-extern cpuop_func op_4ef9_4_ff;
-extern cpuop_func op_4efa_4_nf;
-extern cpuop_func op_4efa_4_ff;
-extern cpuop_func op_4efb_4_nf;
-extern cpuop_func op_4efb_4_ff;
-extern cpuop_func op_5000_4_nf;
-extern cpuop_func op_5000_4_ff;
-extern cpuop_func op_5010_4_nf;
-extern cpuop_func op_5010_4_ff;
-extern cpuop_func op_5018_4_nf;
-extern cpuop_func op_5018_4_ff;
-extern cpuop_func op_5020_4_nf;
-extern cpuop_func op_5020_4_ff;
-extern cpuop_func op_5028_4_nf;
-extern cpuop_func op_5028_4_ff;
-extern cpuop_func op_5030_4_nf;
-extern cpuop_func op_5030_4_ff;
-extern cpuop_func op_5038_4_nf;
-extern cpuop_func op_5038_4_ff;
-extern cpuop_func op_5039_4_nf;
-extern cpuop_func op_5039_4_ff;
-extern cpuop_func op_5040_4_nf;
-extern cpuop_func op_5040_4_ff;
-extern cpuop_func op_5048_4_nf;
-extern cpuop_func op_5048_4_ff;
-extern cpuop_func op_5050_4_nf;
-extern cpuop_func op_5050_4_ff;
-extern cpuop_func op_5058_4_nf;
-extern cpuop_func op_5058_4_ff;
-extern cpuop_func op_5060_4_nf;
-extern cpuop_func op_5060_4_ff;
-extern cpuop_func op_5068_4_nf;
-extern cpuop_func op_5068_4_ff;
-extern cpuop_func op_5070_4_nf;
-extern cpuop_func op_5070_4_ff;
-extern cpuop_func op_5078_4_nf;
-extern cpuop_func op_5078_4_ff;
-extern cpuop_func op_5079_4_nf;
-extern cpuop_func op_5079_4_ff;
-extern cpuop_func op_5080_4_nf;
-extern cpuop_func op_5080_4_ff;
-extern cpuop_func op_5088_4_nf;
-extern cpuop_func op_5088_4_ff;
-extern cpuop_func op_5090_4_nf;
-extern cpuop_func op_5090_4_ff;
-extern cpuop_func op_5098_4_nf;
-extern cpuop_func op_5098_4_ff;
-extern cpuop_func op_50a0_4_nf;
-extern cpuop_func op_50a0_4_ff;
-extern cpuop_func op_50a8_4_nf;
-extern cpuop_func op_50a8_4_ff;
-extern cpuop_func op_50b0_4_nf;
-extern cpuop_func op_50b0_4_ff;
-extern cpuop_func op_50b8_4_nf;
-extern cpuop_func op_50b8_4_ff;
-extern cpuop_func op_50b9_4_nf;
-extern cpuop_func op_50b9_4_ff;
-extern cpuop_func op_50c0_4_nf;
-extern cpuop_func op_50c0_4_ff;
-extern cpuop_func op_50c8_4_nf;
-extern cpuop_func op_50c8_4_ff;
-extern cpuop_func op_50d0_4_nf;
-extern cpuop_func op_50d0_4_ff;
-extern cpuop_func op_50d8_4_nf;
-extern cpuop_func op_50d8_4_ff;
-extern cpuop_func op_50e0_4_nf;
-extern cpuop_func op_50e0_4_ff;
-extern cpuop_func op_50e8_4_nf;
-extern cpuop_func op_50e8_4_ff;
-extern cpuop_func op_50f0_4_nf;
-extern cpuop_func op_50f0_4_ff;
-extern cpuop_func op_50f8_4_nf;
-extern cpuop_func op_50f8_4_ff;
-extern cpuop_func op_50f9_4_nf;
-extern cpuop_func op_50f9_4_ff;
-extern cpuop_func op_5100_4_nf;
-extern cpuop_func op_5100_4_ff;
-extern cpuop_func op_5110_4_nf;
-extern cpuop_func op_5110_4_ff;
-extern cpuop_func op_5118_4_nf;
-extern cpuop_func op_5118_4_ff;
-extern cpuop_func op_5120_4_nf;
-extern cpuop_func op_5120_4_ff;
-extern cpuop_func op_5128_4_nf;
-extern cpuop_func op_5128_4_ff;
-extern cpuop_func op_5130_4_nf;
-extern cpuop_func op_5130_4_ff;
-extern cpuop_func op_5138_4_nf;
-extern cpuop_func op_5138_4_ff;
-extern cpuop_func op_5139_4_nf;
-extern cpuop_func op_5139_4_ff;
-extern cpuop_func op_5140_4_nf;
-extern cpuop_func op_5140_4_ff;
-extern cpuop_func op_5148_4_nf;
-extern cpuop_func op_5148_4_ff;
-extern cpuop_func op_5150_4_nf;
-extern cpuop_func op_5150_4_ff;
-extern cpuop_func op_5158_4_nf;
-extern cpuop_func op_5158_4_ff;
-extern cpuop_func op_5160_4_nf;
-extern cpuop_func op_5160_4_ff;
-extern cpuop_func op_5168_4_nf;
-extern cpuop_func op_5168_4_ff;
-extern cpuop_func op_5170_4_nf;
-extern cpuop_func op_5170_4_ff;
-extern cpuop_func op_5178_4_nf;
-extern cpuop_func op_5178_4_ff;
-extern cpuop_func op_5179_4_nf;
-extern cpuop_func op_5179_4_ff;
-extern cpuop_func op_5180_4_nf;
-extern cpuop_func op_5180_4_ff;
-extern cpuop_func op_5188_4_nf;
-extern cpuop_func op_5188_4_ff;
-extern cpuop_func op_5190_4_nf;
-extern cpuop_func op_5190_4_ff;
-extern cpuop_func op_5198_4_nf;
-extern cpuop_func op_5198_4_ff;
-extern cpuop_func op_51a0_4_nf;
-extern cpuop_func op_51a0_4_ff;
-extern cpuop_func op_51a8_4_nf;
-extern cpuop_func op_51a8_4_ff;
-extern cpuop_func op_51b0_4_nf;
-extern cpuop_func op_51b0_4_ff;
-extern cpuop_func op_51b8_4_nf;
-extern cpuop_func op_51b8_4_ff;
-extern cpuop_func op_51b9_4_nf;
-extern cpuop_func op_51b9_4_ff;
-extern cpuop_func op_51c0_4_nf;
-extern cpuop_func op_51c0_4_ff;
-extern cpuop_func op_51c8_4_nf;
-extern cpuop_func op_51c8_4_ff;
-extern cpuop_func op_51d0_4_nf;
-extern cpuop_func op_51d0_4_ff;
-extern cpuop_func op_51d8_4_nf;
-extern cpuop_func op_51d8_4_ff;
-extern cpuop_func op_51e0_4_nf;
-extern cpuop_func op_51e0_4_ff;
-extern cpuop_func op_51e8_4_nf;
-extern cpuop_func op_51e8_4_ff;
-extern cpuop_func op_51f0_4_nf;
-extern cpuop_func op_51f0_4_ff;
-extern cpuop_func op_51f8_4_nf;
-extern cpuop_func op_51f8_4_ff;
-extern cpuop_func op_51f9_4_nf;
-extern cpuop_func op_51f9_4_ff;
-extern cpuop_func op_52c0_4_nf;
-extern cpuop_func op_52c0_4_ff;
-extern cpuop_func op_52c8_4_nf;
-extern cpuop_func op_52c8_4_ff;
-extern cpuop_func op_52d0_4_nf;
-extern cpuop_func op_52d0_4_ff;
-extern cpuop_func op_52d8_4_nf;
-extern cpuop_func op_52d8_4_ff;
-extern cpuop_func op_52e0_4_nf;
-extern cpuop_func op_52e0_4_ff;
-extern cpuop_func op_52e8_4_nf;
-extern cpuop_func op_52e8_4_ff;
-extern cpuop_func op_52f0_4_nf;
-extern cpuop_func op_52f0_4_ff;
-extern cpuop_func op_52f8_4_nf;
-extern cpuop_func op_52f8_4_ff;
-extern cpuop_func op_52f9_4_nf;
-extern cpuop_func op_52f9_4_ff;
-extern cpuop_func op_53c0_4_nf;
-extern cpuop_func op_53c0_4_ff;
-extern cpuop_func op_53c8_4_nf;
-extern cpuop_func op_53c8_4_ff;
-extern cpuop_func op_53d0_4_nf;
-extern cpuop_func op_53d0_4_ff;
-extern cpuop_func op_53d8_4_nf;
-extern cpuop_func op_53d8_4_ff;
-extern cpuop_func op_53e0_4_nf;
-extern cpuop_func op_53e0_4_ff;
-extern cpuop_func op_53e8_4_nf;
-extern cpuop_func op_53e8_4_ff;
-extern cpuop_func op_53f0_4_nf;
-extern cpuop_func op_53f0_4_ff;
-extern cpuop_func op_53f8_4_nf;
-extern cpuop_func op_53f8_4_ff;
-extern cpuop_func op_53f9_4_nf;
-extern cpuop_func op_53f9_4_ff;
-extern cpuop_func op_54c0_4_nf;
-extern cpuop_func op_54c0_4_ff;
-extern cpuop_func op_54c8_4_nf;
-extern cpuop_func op_54c8_4_ff;
-extern cpuop_func op_54d0_4_nf;
-extern cpuop_func op_54d0_4_ff;
-extern cpuop_func op_54d8_4_nf;
-extern cpuop_func op_54d8_4_ff;
-extern cpuop_func op_54e0_4_nf;
-extern cpuop_func op_54e0_4_ff;
-extern cpuop_func op_54e8_4_nf;
-extern cpuop_func op_54e8_4_ff;
-extern cpuop_func op_54f0_4_nf;
-extern cpuop_func op_54f0_4_ff;
-extern cpuop_func op_54f8_4_nf;
-extern cpuop_func op_54f8_4_ff;
-extern cpuop_func op_54f9_4_nf;
-extern cpuop_func op_54f9_4_ff;
-extern cpuop_func op_55c0_4_nf;
-extern cpuop_func op_55c0_4_ff;
-extern cpuop_func op_55c8_4_nf;
-extern cpuop_func op_55c8_4_ff;
-extern cpuop_func op_55d0_4_nf;
-extern cpuop_func op_55d0_4_ff;
-extern cpuop_func op_55d8_4_nf;
-extern cpuop_func op_55d8_4_ff;
-extern cpuop_func op_55e0_4_nf;
-extern cpuop_func op_55e0_4_ff;
-extern cpuop_func op_55e8_4_nf;
-extern cpuop_func op_55e8_4_ff;
-extern cpuop_func op_55f0_4_nf;
-extern cpuop_func op_55f0_4_ff;
-extern cpuop_func op_55f8_4_nf;
-extern cpuop_func op_55f8_4_ff;
-extern cpuop_func op_55f9_4_nf;
-extern cpuop_func op_55f9_4_ff;
-extern cpuop_func op_56c0_4_nf;
-extern cpuop_func op_56c0_4_ff;
-extern cpuop_func op_56c8_4_nf;
-extern cpuop_func op_56c8_4_ff;
-extern cpuop_func op_56d0_4_nf;
-extern cpuop_func op_56d0_4_ff;
-extern cpuop_func op_56d8_4_nf;
-extern cpuop_func op_56d8_4_ff;
-extern cpuop_func op_56e0_4_nf;
-extern cpuop_func op_56e0_4_ff;
-extern cpuop_func op_56e8_4_nf;
-extern cpuop_func op_56e8_4_ff;
-extern cpuop_func op_56f0_4_nf;
-extern cpuop_func op_56f0_4_ff;
-extern cpuop_func op_56f8_4_nf;
-extern cpuop_func op_56f8_4_ff;
-extern cpuop_func op_56f9_4_nf;
-extern cpuop_func op_56f9_4_ff;
-extern cpuop_func op_57c0_4_nf;
-extern cpuop_func op_57c0_4_ff;
-extern cpuop_func op_57c8_4_nf;
-extern cpuop_func op_57c8_4_ff;
-extern cpuop_func op_57d0_4_nf;
-extern cpuop_func op_57d0_4_ff;
-extern cpuop_func op_57d8_4_nf;
-extern cpuop_func op_57d8_4_ff;
-extern cpuop_func op_57e0_4_nf;
-extern cpuop_func op_57e0_4_ff;
-extern cpuop_func op_57e8_4_nf;
-extern cpuop_func op_57e8_4_ff;
-extern cpuop_func op_57f0_4_nf;
-extern cpuop_func op_57f0_4_ff;
-extern cpuop_func op_57f8_4_nf;
-extern cpuop_func op_57f8_4_ff;
-extern cpuop_func op_57f9_4_nf;
-extern cpuop_func op_57f9_4_ff;
-extern cpuop_func op_58c0_4_nf;
-extern cpuop_func op_58c0_4_ff;
-extern cpuop_func op_58c8_4_nf;
-extern cpuop_func op_58c8_4_ff;
-extern cpuop_func op_58d0_4_nf;
-extern cpuop_func op_58d0_4_ff;
-extern cpuop_func op_58d8_4_nf;
-extern cpuop_func op_58d8_4_ff;
-extern cpuop_func op_58e0_4_nf;
-extern cpuop_func op_58e0_4_ff;
-extern cpuop_func op_58e8_4_nf;
-extern cpuop_func op_58e8_4_ff;
-extern cpuop_func op_58f0_4_nf;
-extern cpuop_func op_58f0_4_ff;
-extern cpuop_func op_58f8_4_nf;
-extern cpuop_func op_58f8_4_ff;
-extern cpuop_func op_58f9_4_nf;
-extern cpuop_func op_58f9_4_ff;
-extern cpuop_func op_59c0_4_nf;
-extern cpuop_func op_59c0_4_ff;
-extern cpuop_func op_59c8_4_nf;
-extern cpuop_func op_59c8_4_ff;
-extern cpuop_func op_59d0_4_nf;
-extern cpuop_func op_59d0_4_ff;
-extern cpuop_func op_59d8_4_nf;
-extern cpuop_func op_59d8_4_ff;
-extern cpuop_func op_59e0_4_nf;
-extern cpuop_func op_59e0_4_ff;
-extern cpuop_func op_59e8_4_nf;
-extern cpuop_func op_59e8_4_ff;
-extern cpuop_func op_59f0_4_nf;
-extern cpuop_func op_59f0_4_ff;
-extern cpuop_func op_59f8_4_nf;
-extern cpuop_func op_59f8_4_ff;
-extern cpuop_func op_59f9_4_nf;
-extern cpuop_func op_59f9_4_ff;
-extern cpuop_func op_5ac0_4_nf;
-extern cpuop_func op_5ac0_4_ff;
-extern cpuop_func op_5ac8_4_nf;
-extern cpuop_func op_5ac8_4_ff;
-extern cpuop_func op_5ad0_4_nf;
-extern cpuop_func op_5ad0_4_ff;
-extern cpuop_func op_5ad8_4_nf;
-extern cpuop_func op_5ad8_4_ff;
-extern cpuop_func op_5ae0_4_nf;
-extern cpuop_func op_5ae0_4_ff;
-extern cpuop_func op_5ae8_4_nf;
-extern cpuop_func op_5ae8_4_ff;
-extern cpuop_func op_5af0_4_nf;
-extern cpuop_func op_5af0_4_ff;
-extern cpuop_func op_5af8_4_nf;
-extern cpuop_func op_5af8_4_ff;
-extern cpuop_func op_5af9_4_nf;
-extern cpuop_func op_5af9_4_ff;
-extern cpuop_func op_5bc0_4_nf;
-extern cpuop_func op_5bc0_4_ff;
-extern cpuop_func op_5bc8_4_nf;
-extern cpuop_func op_5bc8_4_ff;
-extern cpuop_func op_5bd0_4_nf;
-extern cpuop_func op_5bd0_4_ff;
-extern cpuop_func op_5bd8_4_nf;
-extern cpuop_func op_5bd8_4_ff;
-extern cpuop_func op_5be0_4_nf;
-extern cpuop_func op_5be0_4_ff;
-extern cpuop_func op_5be8_4_nf;
-extern cpuop_func op_5be8_4_ff;
-extern cpuop_func op_5bf0_4_nf;
-extern cpuop_func op_5bf0_4_ff;
-extern cpuop_func op_5bf8_4_nf;
-extern cpuop_func op_5bf8_4_ff;
-extern cpuop_func op_5bf9_4_nf;
-extern cpuop_func op_5bf9_4_ff;
-extern cpuop_func op_5cc0_4_nf;
-extern cpuop_func op_5cc0_4_ff;
-extern cpuop_func op_5cc8_4_nf;
-extern cpuop_func op_5cc8_4_ff;
-extern cpuop_func op_5cd0_4_nf;
-extern cpuop_func op_5cd0_4_ff;
-extern cpuop_func op_5cd8_4_nf;
-extern cpuop_func op_5cd8_4_ff;
-extern cpuop_func op_5ce0_4_nf;
-extern cpuop_func op_5ce0_4_ff;
-extern cpuop_func op_5ce8_4_nf;
-extern cpuop_func op_5ce8_4_ff;
-extern cpuop_func op_5cf0_4_nf;
-extern cpuop_func op_5cf0_4_ff;
-extern cpuop_func op_5cf8_4_nf;
-extern cpuop_func op_5cf8_4_ff;
-extern cpuop_func op_5cf9_4_nf;
-extern cpuop_func op_5cf9_4_ff;
-extern cpuop_func op_5dc0_4_nf;
-extern cpuop_func op_5dc0_4_ff;
-extern cpuop_func op_5dc8_4_nf;
-extern cpuop_func op_5dc8_4_ff;
-extern cpuop_func op_5dd0_4_nf;
-extern cpuop_func op_5dd0_4_ff;
-extern cpuop_func op_5dd8_4_nf;
-extern cpuop_func op_5dd8_4_ff;
-extern cpuop_func op_5de0_4_nf;
-extern cpuop_func op_5de0_4_ff;
-extern cpuop_func op_5de8_4_nf;
-extern cpuop_func op_5de8_4_ff;
-extern cpuop_func op_5df0_4_nf;
-extern cpuop_func op_5df0_4_ff;
-extern cpuop_func op_5df8_4_nf;
-extern cpuop_func op_5df8_4_ff;
-extern cpuop_func op_5df9_4_nf;
-extern cpuop_func op_5df9_4_ff;
-extern cpuop_func op_5ec0_4_nf;
-extern cpuop_func op_5ec0_4_ff;
-extern cpuop_func op_5ec8_4_nf;
-extern cpuop_func op_5ec8_4_ff;
-extern cpuop_func op_5ed0_4_nf;
-extern cpuop_func op_5ed0_4_ff;
-extern cpuop_func op_5ed8_4_nf;
-extern cpuop_func op_5ed8_4_ff;
-extern cpuop_func op_5ee0_4_nf;
-extern cpuop_func op_5ee0_4_ff;
-extern cpuop_func op_5ee8_4_nf;
-extern cpuop_func op_5ee8_4_ff;
-extern cpuop_func op_5ef0_4_nf;
-extern cpuop_func op_5ef0_4_ff;
-extern cpuop_func op_5ef8_4_nf;
-extern cpuop_func op_5ef8_4_ff;
-extern cpuop_func op_5ef9_4_nf;
-extern cpuop_func op_5ef9_4_ff;
-extern cpuop_func op_5fc0_4_nf;
-extern cpuop_func op_5fc0_4_ff;
-extern cpuop_func op_5fc8_4_nf;
-extern cpuop_func op_5fc8_4_ff;
-extern cpuop_func op_5fd0_4_nf;
-extern cpuop_func op_5fd0_4_ff;
-extern cpuop_func op_5fd8_4_nf;
-extern cpuop_func op_5fd8_4_ff;
-extern cpuop_func op_5fe0_4_nf;
-extern cpuop_func op_5fe0_4_ff;
-extern cpuop_func op_5fe8_4_nf;
-extern cpuop_func op_5fe8_4_ff;
-extern cpuop_func op_5ff0_4_nf;
-extern cpuop_func op_5ff0_4_ff;
-extern cpuop_func op_5ff8_4_nf;
-extern cpuop_func op_5ff8_4_ff;
-extern cpuop_func op_5ff9_4_nf;
-extern cpuop_func op_5ff9_4_ff;
-extern cpuop_func op_6000_4_nf;
-extern cpuop_func op_6000_4_ff;
-extern cpuop_func op_6001_4_nf;
-extern cpuop_func op_6001_4_ff;
-extern cpuop_func op_60ff_4_nf;
-extern cpuop_func op_60ff_4_ff;
-extern cpuop_func op_6100_4_nf;
-extern cpuop_func op_6100_4_ff;
-extern cpuop_func op_6101_4_nf;
-extern cpuop_func op_6101_4_ff;
-extern cpuop_func op_61ff_4_nf;
-extern cpuop_func op_61ff_4_ff;
-extern cpuop_func op_6200_4_nf;
-extern cpuop_func op_6200_4_ff;
-extern cpuop_func op_6201_4_nf;
-extern cpuop_func op_6201_4_ff;
-extern cpuop_func op_62ff_4_nf;
-extern cpuop_func op_62ff_4_ff;
-extern cpuop_func op_6300_4_nf;
-extern cpuop_func op_6300_4_ff;
-extern cpuop_func op_6301_4_nf;
-extern cpuop_func op_6301_4_ff;
-extern cpuop_func op_63ff_4_nf;
-extern cpuop_func op_63ff_4_ff;
-extern cpuop_func op_6400_4_nf;
-extern cpuop_func op_6400_4_ff;
-extern cpuop_func op_6401_4_nf;
-extern cpuop_func op_6401_4_ff;
-extern cpuop_func op_64ff_4_nf;
-extern cpuop_func op_64ff_4_ff;
-extern cpuop_func op_6500_4_nf;
-extern cpuop_func op_6500_4_ff;
-extern cpuop_func op_6501_4_nf;
-extern cpuop_func op_6501_4_ff;
-extern cpuop_func op_65ff_4_nf;
-extern cpuop_func op_65ff_4_ff;
-extern cpuop_func op_6600_4_nf;
-extern cpuop_func op_6600_4_ff;
-extern cpuop_func op_6601_4_nf;
-extern cpuop_func op_6601_4_ff;
-extern cpuop_func op_66ff_4_nf;
-extern cpuop_func op_66ff_4_ff;
-extern cpuop_func op_6700_4_nf;
-extern cpuop_func op_6700_4_ff;
-extern cpuop_func op_6701_4_nf;
-extern cpuop_func op_6701_4_ff;
-extern cpuop_func op_67ff_4_nf;
-extern cpuop_func op_67ff_4_ff;
-extern cpuop_func op_6800_4_nf;
-extern cpuop_func op_6800_4_ff;
-extern cpuop_func op_6801_4_nf;
-extern cpuop_func op_6801_4_ff;
-extern cpuop_func op_68ff_4_nf;
-extern cpuop_func op_68ff_4_ff;
-extern cpuop_func op_6900_4_nf;
-extern cpuop_func op_6900_4_ff;
-extern cpuop_func op_6901_4_nf;
-extern cpuop_func op_6901_4_ff;
-extern cpuop_func op_69ff_4_nf;
-extern cpuop_func op_69ff_4_ff;
-extern cpuop_func op_6a00_4_nf;
-extern cpuop_func op_6a00_4_ff;
-extern cpuop_func op_6a01_4_nf;
-extern cpuop_func op_6a01_4_ff;
-extern cpuop_func op_6aff_4_nf;
-extern cpuop_func op_6aff_4_ff;
-extern cpuop_func op_6b00_4_nf;
-extern cpuop_func op_6b00_4_ff;
-extern cpuop_func op_6b01_4_nf;
-extern cpuop_func op_6b01_4_ff;
-extern cpuop_func op_6bff_4_nf;
-extern cpuop_func op_6bff_4_ff;
-extern cpuop_func op_6c00_4_nf;
-extern cpuop_func op_6c00_4_ff;
-extern cpuop_func op_6c01_4_nf;
-extern cpuop_func op_6c01_4_ff;
-extern cpuop_func op_6cff_4_nf;
-extern cpuop_func op_6cff_4_ff;
-extern cpuop_func op_6d00_4_nf;
-extern cpuop_func op_6d00_4_ff;
-extern cpuop_func op_6d01_4_nf;
-extern cpuop_func op_6d01_4_ff;
-extern cpuop_func op_6dff_4_nf;
-extern cpuop_func op_6dff_4_ff;
-extern cpuop_func op_6e00_4_nf;
-extern cpuop_func op_6e00_4_ff;
-extern cpuop_func op_6e01_4_nf;
-extern cpuop_func op_6e01_4_ff;
-extern cpuop_func op_6eff_4_nf;
-extern cpuop_func op_6eff_4_ff;
-extern cpuop_func op_6f00_4_nf;
-extern cpuop_func op_6f00_4_ff;
-extern cpuop_func op_6f01_4_nf;
-extern cpuop_func op_6f01_4_ff;
-extern cpuop_func op_6fff_4_nf;
-extern cpuop_func op_6fff_4_ff;
-extern cpuop_func op_7000_4_nf;
-extern cpuop_func op_7000_4_ff;
-extern cpuop_func op_8000_4_nf;
-extern cpuop_func op_8000_4_ff;
-extern cpuop_func op_8010_4_nf;
-extern cpuop_func op_8010_4_ff;
-extern cpuop_func op_8018_4_nf;
-extern cpuop_func op_8018_4_ff;
-extern cpuop_func op_8020_4_nf;
-extern cpuop_func op_8020_4_ff;
-extern cpuop_func op_8028_4_nf;
-extern cpuop_func op_8028_4_ff;
-extern cpuop_func op_8030_4_nf;
-extern cpuop_func op_8030_4_ff;
-extern cpuop_func op_8038_4_nf;
-extern cpuop_func op_8038_4_ff;
-extern cpuop_func op_8039_4_nf;
-extern cpuop_func op_8039_4_ff;
-extern cpuop_func op_803a_4_nf;
-extern cpuop_func op_803a_4_ff;
-extern cpuop_func op_803b_4_nf;
-extern cpuop_func op_803b_4_ff;
-extern cpuop_func op_803c_4_nf;
-extern cpuop_func op_803c_4_ff;
-extern cpuop_func op_8040_4_nf;
-extern cpuop_func op_8040_4_ff;
-extern cpuop_func op_8050_4_nf;
-extern cpuop_func op_8050_4_ff;
-extern cpuop_func op_8058_4_nf;
-extern cpuop_func op_8058_4_ff;
-extern cpuop_func op_8060_4_nf;
-extern cpuop_func op_8060_4_ff;
-extern cpuop_func op_8068_4_nf;
-extern cpuop_func op_8068_4_ff;
-extern cpuop_func op_8070_4_nf;
-extern cpuop_func op_8070_4_ff;
-extern cpuop_func op_8078_4_nf;
-extern cpuop_func op_8078_4_ff;
-extern cpuop_func op_8079_4_nf;
-extern cpuop_func op_8079_4_ff;
-extern cpuop_func op_807a_4_nf;
-extern cpuop_func op_807a_4_ff;
-extern cpuop_func op_807b_4_nf;
-extern cpuop_func op_807b_4_ff;
-extern cpuop_func op_807c_4_nf;
-extern cpuop_func op_807c_4_ff;
-extern cpuop_func op_8080_4_nf;
-extern cpuop_func op_8080_4_ff;
-extern cpuop_func op_8090_4_nf;
-extern cpuop_func op_8090_4_ff;
-extern cpuop_func op_8098_4_nf;
-extern cpuop_func op_8098_4_ff;
-extern cpuop_func op_80a0_4_nf;
-extern cpuop_func op_80a0_4_ff;
-extern cpuop_func op_80a8_4_nf;
-extern cpuop_func op_80a8_4_ff;
-extern cpuop_func op_80b0_4_nf;
-extern cpuop_func op_80b0_4_ff;
-extern cpuop_func op_80b8_4_nf;
-extern cpuop_func op_80b8_4_ff;
-extern cpuop_func op_80b9_4_nf;
-extern cpuop_func op_80b9_4_ff;
-extern cpuop_func op_80ba_4_nf;
-extern cpuop_func op_80ba_4_ff;
-extern cpuop_func op_80bb_4_nf;
-extern cpuop_func op_80bb_4_ff;
-extern cpuop_func op_80bc_4_nf;
-extern cpuop_func op_80bc_4_ff;
-extern cpuop_func op_80c0_4_nf;
-extern cpuop_func op_80c0_4_ff;
-extern cpuop_func op_80d0_4_nf;
-extern cpuop_func op_80d0_4_ff;
-extern cpuop_func op_80d8_4_nf;
-extern cpuop_func op_80d8_4_ff;
-extern cpuop_func op_80e0_4_nf;
-extern cpuop_func op_80e0_4_ff;
-extern cpuop_func op_80e8_4_nf;
-extern cpuop_func op_80e8_4_ff;
-extern cpuop_func op_80f0_4_nf;
-extern cpuop_func op_80f0_4_ff;
-extern cpuop_func op_80f8_4_nf;
-extern cpuop_func op_80f8_4_ff;
-extern cpuop_func op_80f9_4_nf;
-extern cpuop_func op_80f9_4_ff;
-extern cpuop_func op_80fa_4_nf;
-extern cpuop_func op_80fa_4_ff;
-extern cpuop_func op_80fb_4_nf;
-extern cpuop_func op_80fb_4_ff;
-extern cpuop_func op_80fc_4_nf;
-extern cpuop_func op_80fc_4_ff;
-extern cpuop_func op_8100_4_nf;
-extern cpuop_func op_8100_4_ff;
-extern cpuop_func op_8108_4_nf;
-extern cpuop_func op_8108_4_ff;
-extern cpuop_func op_8110_4_nf;
-extern cpuop_func op_8110_4_ff;
-extern cpuop_func op_8118_4_nf;
-extern cpuop_func op_8118_4_ff;
-extern cpuop_func op_8120_4_nf;
-extern cpuop_func op_8120_4_ff;
-extern cpuop_func op_8128_4_nf;
-extern cpuop_func op_8128_4_ff;
-extern cpuop_func op_8130_4_nf;
-extern cpuop_func op_8130_4_ff;
-extern cpuop_func op_8138_4_nf;
-extern cpuop_func op_8138_4_ff;
-extern cpuop_func op_8139_4_nf;
-extern cpuop_func op_8139_4_ff;
-extern cpuop_func op_8150_4_nf;
-extern cpuop_func op_8150_4_ff;
-extern cpuop_func op_8158_4_nf;
-extern cpuop_func op_8158_4_ff;
-extern cpuop_func op_8160_4_nf;
-extern cpuop_func op_8160_4_ff;
-extern cpuop_func op_8168_4_nf;
-extern cpuop_func op_8168_4_ff;
-extern cpuop_func op_8170_4_nf;
-extern cpuop_func op_8170_4_ff;
-extern cpuop_func op_8178_4_nf;
-extern cpuop_func op_8178_4_ff;
-extern cpuop_func op_8179_4_nf;
-extern cpuop_func op_8179_4_ff;
-extern cpuop_func op_8190_4_nf;
-extern cpuop_func op_8190_4_ff;
-extern cpuop_func op_8198_4_nf;
-extern cpuop_func op_8198_4_ff;
-extern cpuop_func op_81a0_4_nf;
-extern cpuop_func op_81a0_4_ff;
-extern cpuop_func op_81a8_4_nf;
-extern cpuop_func op_81a8_4_ff;
-extern cpuop_func op_81b0_4_nf;
-extern cpuop_func op_81b0_4_ff;
-extern cpuop_func op_81b8_4_nf;
-extern cpuop_func op_81b8_4_ff;
-extern cpuop_func op_81b9_4_nf;
-extern cpuop_func op_81b9_4_ff;
-extern cpuop_func op_81c0_4_nf;
-extern cpuop_func op_81c0_4_ff;
-extern cpuop_func op_81d0_4_nf;
-extern cpuop_func op_81d0_4_ff;
-extern cpuop_func op_81d8_4_nf;
-extern cpuop_func op_81d8_4_ff;
-extern cpuop_func op_81e0_4_nf;
-extern cpuop_func op_81e0_4_ff;
-extern cpuop_func op_81e8_4_nf;
-extern cpuop_func op_81e8_4_ff;
-extern cpuop_func op_81f0_4_nf;
-extern cpuop_func op_81f0_4_ff;
-extern cpuop_func op_81f8_4_nf;
-extern cpuop_func op_81f8_4_ff;
-extern cpuop_func op_81f9_4_nf;
-extern cpuop_func op_81f9_4_ff;
-extern cpuop_func op_81fa_4_nf;
-extern cpuop_func op_81fa_4_ff;
-extern cpuop_func op_81fb_4_nf;
-extern cpuop_func op_81fb_4_ff;
-extern cpuop_func op_81fc_4_nf;
-extern cpuop_func op_81fc_4_ff;
-extern cpuop_func op_9000_4_nf;
-extern cpuop_func op_9000_4_ff;
-extern cpuop_func op_9010_4_nf;
-extern cpuop_func op_9010_4_ff;
-extern cpuop_func op_9018_4_nf;
-extern cpuop_func op_9018_4_ff;
-extern cpuop_func op_9020_4_nf;
-extern cpuop_func op_9020_4_ff;
-extern cpuop_func op_9028_4_nf;
-extern cpuop_func op_9028_4_ff;
-extern cpuop_func op_9030_4_nf;
-extern cpuop_func op_9030_4_ff;
-extern cpuop_func op_9038_4_nf;
-extern cpuop_func op_9038_4_ff;
-extern cpuop_func op_9039_4_nf;
-extern cpuop_func op_9039_4_ff;
-extern cpuop_func op_903a_4_nf;
-extern cpuop_func op_903a_4_ff;
-extern cpuop_func op_903b_4_nf;
-extern cpuop_func op_903b_4_ff;
-extern cpuop_func op_903c_4_nf;
-extern cpuop_func op_903c_4_ff;
-extern cpuop_func op_9040_4_nf;
-extern cpuop_func op_9040_4_ff;
-extern cpuop_func op_9048_4_nf;
-extern cpuop_func op_9048_4_ff;
-extern cpuop_func op_9050_4_nf;
-extern cpuop_func op_9050_4_ff;
-extern cpuop_func op_9058_4_nf;
-extern cpuop_func op_9058_4_ff;
-extern cpuop_func op_9060_4_nf;
-extern cpuop_func op_9060_4_ff;
-extern cpuop_func op_9068_4_nf;
-extern cpuop_func op_9068_4_ff;
-extern cpuop_func op_9070_4_nf;
-extern cpuop_func op_9070_4_ff;
-extern cpuop_func op_9078_4_nf;
-extern cpuop_func op_9078_4_ff;
-extern cpuop_func op_9079_4_nf;
-extern cpuop_func op_9079_4_ff;
-extern cpuop_func op_907a_4_nf;
-extern cpuop_func op_907a_4_ff;
-extern cpuop_func op_907b_4_nf;
-extern cpuop_func op_907b_4_ff;
-extern cpuop_func op_907c_4_nf;
-extern cpuop_func op_907c_4_ff;
-extern cpuop_func op_9080_4_nf;
-extern cpuop_func op_9080_4_ff;
-extern cpuop_func op_9088_4_nf;
-extern cpuop_func op_9088_4_ff;
-extern cpuop_func op_9090_4_nf;
-extern cpuop_func op_9090_4_ff;
-extern cpuop_func op_9098_4_nf;
-extern cpuop_func op_9098_4_ff;
-extern cpuop_func op_90a0_4_nf;
-extern cpuop_func op_90a0_4_ff;
-extern cpuop_func op_90a8_4_nf;
-extern cpuop_func op_90a8_4_ff;
-extern cpuop_func op_90b0_4_nf;
-extern cpuop_func op_90b0_4_ff;
-extern cpuop_func op_90b8_4_nf;
-extern cpuop_func op_90b8_4_ff;
-extern cpuop_func op_90b9_4_nf;
-extern cpuop_func op_90b9_4_ff;
-extern cpuop_func op_90ba_4_nf;
-extern cpuop_func op_90ba_4_ff;
-extern cpuop_func op_90bb_4_nf;
-extern cpuop_func op_90bb_4_ff;
-extern cpuop_func op_90bc_4_nf;
-extern cpuop_func op_90bc_4_ff;
-extern cpuop_func op_90c0_4_nf;
-extern cpuop_func op_90c0_4_ff;
-extern cpuop_func op_90c8_4_nf;
-extern cpuop_func op_90c8_4_ff;
-extern cpuop_func op_90d0_4_nf;
-extern cpuop_func op_90d0_4_ff;
-extern cpuop_func op_90d8_4_nf;
-extern cpuop_func op_90d8_4_ff;
-extern cpuop_func op_90e0_4_nf;
-extern cpuop_func op_90e0_4_ff;
-extern cpuop_func op_90e8_4_nf;
-extern cpuop_func op_90e8_4_ff;
-extern cpuop_func op_90f0_4_nf;
-extern cpuop_func op_90f0_4_ff;
-extern cpuop_func op_90f8_4_nf;
-extern cpuop_func op_90f8_4_ff;
-extern cpuop_func op_90f9_4_nf;
-extern cpuop_func op_90f9_4_ff;
-extern cpuop_func op_90fa_4_nf;
-extern cpuop_func op_90fa_4_ff;
-extern cpuop_func op_90fb_4_nf;
-extern cpuop_func op_90fb_4_ff;
-extern cpuop_func op_90fc_4_nf;
-extern cpuop_func op_90fc_4_ff;
-extern cpuop_func op_9100_4_nf;
-extern cpuop_func op_9100_4_ff;
-extern cpuop_func op_9108_4_nf;
-extern cpuop_func op_9108_4_ff;
-extern cpuop_func op_9110_4_nf;
-extern cpuop_func op_9110_4_ff;
-extern cpuop_func op_9118_4_nf;
-extern cpuop_func op_9118_4_ff;
-extern cpuop_func op_9120_4_nf;
-extern cpuop_func op_9120_4_ff;
-extern cpuop_func op_9128_4_nf;
-extern cpuop_func op_9128_4_ff;
-extern cpuop_func op_9130_4_nf;
-extern cpuop_func op_9130_4_ff;
-extern cpuop_func op_9138_4_nf;
-extern cpuop_func op_9138_4_ff;
-extern cpuop_func op_9139_4_nf;
-extern cpuop_func op_9139_4_ff;
-extern cpuop_func op_9140_4_nf;
-extern cpuop_func op_9140_4_ff;
-extern cpuop_func op_9148_4_nf;
-extern cpuop_func op_9148_4_ff;
-extern cpuop_func op_9150_4_nf;
-extern cpuop_func op_9150_4_ff;
-extern cpuop_func op_9158_4_nf;
-extern cpuop_func op_9158_4_ff;
-extern cpuop_func op_9160_4_nf;
-extern cpuop_func op_9160_4_ff;
-extern cpuop_func op_9168_4_nf;
-extern cpuop_func op_9168_4_ff;
-extern cpuop_func op_9170_4_nf;
-extern cpuop_func op_9170_4_ff;
-extern cpuop_func op_9178_4_nf;
-extern cpuop_func op_9178_4_ff;
-extern cpuop_func op_9179_4_nf;
-extern cpuop_func op_9179_4_ff;
-extern cpuop_func op_9180_4_nf;
-extern cpuop_func op_9180_4_ff;
-extern cpuop_func op_9188_4_nf;
-extern cpuop_func op_9188_4_ff;
-extern cpuop_func op_9190_4_nf;
-extern cpuop_func op_9190_4_ff;
-extern cpuop_func op_9198_4_nf;
-extern cpuop_func op_9198_4_ff;
-extern cpuop_func op_91a0_4_nf;
-extern cpuop_func op_91a0_4_ff;
-extern cpuop_func op_91a8_4_nf;
-extern cpuop_func op_91a8_4_ff;
-extern cpuop_func op_91b0_4_nf;
-extern cpuop_func op_91b0_4_ff;
-extern cpuop_func op_91b8_4_nf;
-extern cpuop_func op_91b8_4_ff;
-extern cpuop_func op_91b9_4_nf;
-extern cpuop_func op_91b9_4_ff;
-extern cpuop_func op_91c0_4_nf;
-extern cpuop_func op_91c0_4_ff;
-extern cpuop_func op_91c8_4_nf;
-extern cpuop_func op_91c8_4_ff;
-extern cpuop_func op_91d0_4_nf;
-extern cpuop_func op_91d0_4_ff;
-extern cpuop_func op_91d8_4_nf;
-extern cpuop_func op_91d8_4_ff;
-extern cpuop_func op_91e0_4_nf;
-extern cpuop_func op_91e0_4_ff;
-extern cpuop_func op_91e8_4_nf;
-extern cpuop_func op_91e8_4_ff;
-extern cpuop_func op_91f0_4_nf;
-extern cpuop_func op_91f0_4_ff;
-extern cpuop_func op_91f8_4_nf;
-extern cpuop_func op_91f8_4_ff;
-extern cpuop_func op_91f9_4_nf;
-extern cpuop_func op_91f9_4_ff;
-extern cpuop_func op_91fa_4_nf;
-extern cpuop_func op_91fa_4_ff;
-extern cpuop_func op_91fb_4_nf;
-extern cpuop_func op_91fb_4_ff;
-extern cpuop_func op_91fc_4_nf;
-extern cpuop_func op_91fc_4_ff;
-extern cpuop_func op_b000_4_nf;
-extern cpuop_func op_b000_4_ff;
-extern cpuop_func op_b010_4_nf;
-extern cpuop_func op_b010_4_ff;
-extern cpuop_func op_b018_4_nf;
-extern cpuop_func op_b018_4_ff;
-extern cpuop_func op_b020_4_nf;
-extern cpuop_func op_b020_4_ff;
-extern cpuop_func op_b028_4_nf;
-extern cpuop_func op_b028_4_ff;
-extern cpuop_func op_b030_4_nf;
-extern cpuop_func op_b030_4_ff;
-extern cpuop_func op_b038_4_nf;
-extern cpuop_func op_b038_4_ff;
-extern cpuop_func op_b039_4_nf;
-extern cpuop_func op_b039_4_ff;
-extern cpuop_func op_b03a_4_nf;
-extern cpuop_func op_b03a_4_ff;
-extern cpuop_func op_b03b_4_nf;
-extern cpuop_func op_b03b_4_ff;
-extern cpuop_func op_b03c_4_nf;
-extern cpuop_func op_b03c_4_ff;
-extern cpuop_func op_b040_4_nf;
-extern cpuop_func op_b040_4_ff;
-extern cpuop_func op_b048_4_nf;
-extern cpuop_func op_b048_4_ff;
-extern cpuop_func op_b050_4_nf;
-extern cpuop_func op_b050_4_ff;
-extern cpuop_func op_b058_4_nf;
-extern cpuop_func op_b058_4_ff;
-extern cpuop_func op_b060_4_nf;
-extern cpuop_func op_b060_4_ff;
-extern cpuop_func op_b068_4_nf;
-extern cpuop_func op_b068_4_ff;
-extern cpuop_func op_b070_4_nf;
-extern cpuop_func op_b070_4_ff;
-extern cpuop_func op_b078_4_nf;
-extern cpuop_func op_b078_4_ff;
-extern cpuop_func op_b079_4_nf;
-extern cpuop_func op_b079_4_ff;
-extern cpuop_func op_b07a_4_nf;
-extern cpuop_func op_b07a_4_ff;
-extern cpuop_func op_b07b_4_nf;
-extern cpuop_func op_b07b_4_ff;
-extern cpuop_func op_b07c_4_nf;
-extern cpuop_func op_b07c_4_ff;
-extern cpuop_func op_b080_4_nf;
-extern cpuop_func op_b080_4_ff;
-extern cpuop_func op_b088_4_nf;
-extern cpuop_func op_b088_4_ff;
-extern cpuop_func op_b090_4_nf;
-extern cpuop_func op_b090_4_ff;
-extern cpuop_func op_b098_4_nf;
-extern cpuop_func op_b098_4_ff;
-extern cpuop_func op_b0a0_4_nf;
-extern cpuop_func op_b0a0_4_ff;
-extern cpuop_func op_b0a8_4_nf;
-extern cpuop_func op_b0a8_4_ff;
-extern cpuop_func op_b0b0_4_nf;
-extern cpuop_func op_b0b0_4_ff;
-extern cpuop_func op_b0b8_4_nf;
-extern cpuop_func op_b0b8_4_ff;
-extern cpuop_func op_b0b9_4_nf;
-extern cpuop_func op_b0b9_4_ff;
-extern cpuop_func op_b0ba_4_nf;
-extern cpuop_func op_b0ba_4_ff;
-extern cpuop_func op_b0bb_4_nf;
-extern cpuop_func op_b0bb_4_ff;
-extern cpuop_func op_b0bc_4_nf;
-extern cpuop_func op_b0bc_4_ff;
-extern cpuop_func op_b0c0_4_nf;
-extern cpuop_func op_b0c0_4_ff;
-extern cpuop_func op_b0c8_4_nf;
-extern cpuop_func op_b0c8_4_ff;
-extern cpuop_func op_b0d0_4_nf;
-extern cpuop_func op_b0d0_4_ff;
-extern cpuop_func op_b0d8_4_nf;
-extern cpuop_func op_b0d8_4_ff;
-extern cpuop_func op_b0e0_4_nf;
-extern cpuop_func op_b0e0_4_ff;
-extern cpuop_func op_b0e8_4_nf;
-extern cpuop_func op_b0e8_4_ff;
-extern cpuop_func op_b0f0_4_nf;
-extern cpuop_func op_b0f0_4_ff;
-extern cpuop_func op_b0f8_4_nf;
-extern cpuop_func op_b0f8_4_ff;
-extern cpuop_func op_b0f9_4_nf;
-extern cpuop_func op_b0f9_4_ff;
-extern cpuop_func op_b0fa_4_nf;
-extern cpuop_func op_b0fa_4_ff;
-extern cpuop_func op_b0fb_4_nf;
-extern cpuop_func op_b0fb_4_ff;
-extern cpuop_func op_b0fc_4_nf;
-extern cpuop_func op_b0fc_4_ff;
-extern cpuop_func op_b100_4_nf;
-extern cpuop_func op_b100_4_ff;
-extern cpuop_func op_b108_4_nf;
-extern cpuop_func op_b108_4_ff;
-extern cpuop_func op_b110_4_nf;
-extern cpuop_func op_b110_4_ff;
-extern cpuop_func op_b118_4_nf;
-extern cpuop_func op_b118_4_ff;
-extern cpuop_func op_b120_4_nf;
-extern cpuop_func op_b120_4_ff;
-extern cpuop_func op_b128_4_nf;
-extern cpuop_func op_b128_4_ff;
-extern cpuop_func op_b130_4_nf;
-extern cpuop_func op_b130_4_ff;
-extern cpuop_func op_b138_4_nf;
-extern cpuop_func op_b138_4_ff;
-extern cpuop_func op_b139_4_nf;
-extern cpuop_func op_b139_4_ff;
-extern cpuop_func op_b140_4_nf;
-extern cpuop_func op_b140_4_ff;
-extern cpuop_func op_b148_4_nf;
-extern cpuop_func op_b148_4_ff;
-extern cpuop_func op_b150_4_nf;
-extern cpuop_func op_b150_4_ff;
-extern cpuop_func op_b158_4_nf;
-extern cpuop_func op_b158_4_ff;
-extern cpuop_func op_b160_4_nf;
-extern cpuop_func op_b160_4_ff;
-extern cpuop_func op_b168_4_nf;
-extern cpuop_func op_b168_4_ff;
-extern cpuop_func op_b170_4_nf;
-extern cpuop_func op_b170_4_ff;
-extern cpuop_func op_b178_4_nf;
-extern cpuop_func op_b178_4_ff;
-extern cpuop_func op_b179_4_nf;
-extern cpuop_func op_b179_4_ff;
-extern cpuop_func op_b180_4_nf;
-extern cpuop_func op_b180_4_ff;
-extern cpuop_func op_b188_4_nf;
-extern cpuop_func op_b188_4_ff;
-extern cpuop_func op_b190_4_nf;
-extern cpuop_func op_b190_4_ff;
-extern cpuop_func op_b198_4_nf;
-extern cpuop_func op_b198_4_ff;
-extern cpuop_func op_b1a0_4_nf;
-extern cpuop_func op_b1a0_4_ff;
-extern cpuop_func op_b1a8_4_nf;
-extern cpuop_func op_b1a8_4_ff;
-extern cpuop_func op_b1b0_4_nf;
-extern cpuop_func op_b1b0_4_ff;
-extern cpuop_func op_b1b8_4_nf;
-extern cpuop_func op_b1b8_4_ff;
-extern cpuop_func op_b1b9_4_nf;
-extern cpuop_func op_b1b9_4_ff;
-extern cpuop_func op_b1c0_4_nf;
-extern cpuop_func op_b1c0_4_ff;
-extern cpuop_func op_b1c8_4_nf;
-extern cpuop_func op_b1c8_4_ff;
-extern cpuop_func op_b1d0_4_nf;
-extern cpuop_func op_b1d0_4_ff;
-extern cpuop_func op_b1d8_4_nf;
-extern cpuop_func op_b1d8_4_ff;
-extern cpuop_func op_b1e0_4_nf;
-extern cpuop_func op_b1e0_4_ff;
-extern cpuop_func op_b1e8_4_nf;
-extern cpuop_func op_b1e8_4_ff;
-extern cpuop_func op_b1f0_4_nf;
-extern cpuop_func op_b1f0_4_ff;
-extern cpuop_func op_b1f8_4_nf;
-extern cpuop_func op_b1f8_4_ff;
-extern cpuop_func op_b1f9_4_nf;
-extern cpuop_func op_b1f9_4_ff;
-extern cpuop_func op_b1fa_4_nf;
-extern cpuop_func op_b1fa_4_ff;
-extern cpuop_func op_b1fb_4_nf;
-extern cpuop_func op_b1fb_4_ff;
-extern cpuop_func op_b1fc_4_nf;
-extern cpuop_func op_b1fc_4_ff;
-extern cpuop_func op_c000_4_nf;
-extern cpuop_func op_c000_4_ff;
-extern cpuop_func op_c010_4_nf;
-extern cpuop_func op_c010_4_ff;
-extern cpuop_func op_c018_4_nf;
-extern cpuop_func op_c018_4_ff;
-extern cpuop_func op_c020_4_nf;
-extern cpuop_func op_c020_4_ff;
-extern cpuop_func op_c028_4_nf;
-extern cpuop_func op_c028_4_ff;
-extern cpuop_func op_c030_4_nf;
-extern cpuop_func op_c030_4_ff;
-extern cpuop_func op_c038_4_nf;
-extern cpuop_func op_c038_4_ff;
-extern cpuop_func op_c039_4_nf;
-extern cpuop_func op_c039_4_ff;
-extern cpuop_func op_c03a_4_nf;
-extern cpuop_func op_c03a_4_ff;
-extern cpuop_func op_c03b_4_nf;
-extern cpuop_func op_c03b_4_ff;
-extern cpuop_func op_c03c_4_nf;
-extern cpuop_func op_c03c_4_ff;
-extern cpuop_func op_c040_4_nf;
-extern cpuop_func op_c040_4_ff;
-extern cpuop_func op_c050_4_nf;
-extern cpuop_func op_c050_4_ff;
-extern cpuop_func op_c058_4_nf;
-extern cpuop_func op_c058_4_ff;
-extern cpuop_func op_c060_4_nf;
-extern cpuop_func op_c060_4_ff;
-extern cpuop_func op_c068_4_nf;
-extern cpuop_func op_c068_4_ff;
-extern cpuop_func op_c070_4_nf;
-extern cpuop_func op_c070_4_ff;
-extern cpuop_func op_c078_4_nf;
-extern cpuop_func op_c078_4_ff;
-extern cpuop_func op_c079_4_nf;
-extern cpuop_func op_c079_4_ff;
-extern cpuop_func op_c07a_4_nf;
-extern cpuop_func op_c07a_4_ff;
-extern cpuop_func op_c07b_4_nf;
-extern cpuop_func op_c07b_4_ff;
-extern cpuop_func op_c07c_4_nf;
-extern cpuop_func op_c07c_4_ff;
-extern cpuop_func op_c080_4_nf;
-extern cpuop_func op_c080_4_ff;
-extern cpuop_func op_c090_4_nf;
-extern cpuop_func op_c090_4_ff;
-extern cpuop_func op_c098_4_nf;
-extern cpuop_func op_c098_4_ff;
-extern cpuop_func op_c0a0_4_nf;
-extern cpuop_func op_c0a0_4_ff;
-extern cpuop_func op_c0a8_4_nf;
-extern cpuop_func op_c0a8_4_ff;
-extern cpuop_func op_c0b0_4_nf;
-extern cpuop_func op_c0b0_4_ff;
-extern cpuop_func op_c0b8_4_nf;
-extern cpuop_func op_c0b8_4_ff;
-extern cpuop_func op_c0b9_4_nf;
-extern cpuop_func op_c0b9_4_ff;
-extern cpuop_func op_c0ba_4_nf;
-extern cpuop_func op_c0ba_4_ff;
-extern cpuop_func op_c0bb_4_nf;
-extern cpuop_func op_c0bb_4_ff;
-extern cpuop_func op_c0bc_4_nf;
-extern cpuop_func op_c0bc_4_ff;
-extern cpuop_func op_c0c0_4_nf;
-extern cpuop_func op_c0c0_4_ff;
-extern cpuop_func op_c0d0_4_nf;
-extern cpuop_func op_c0d0_4_ff;
-extern cpuop_func op_c0d8_4_nf;
-extern cpuop_func op_c0d8_4_ff;
-extern cpuop_func op_c0e0_4_nf;
-extern cpuop_func op_c0e0_4_ff;
-extern cpuop_func op_c0e8_4_nf;
-extern cpuop_func op_c0e8_4_ff;
-extern cpuop_func op_c0f0_4_nf;
-extern cpuop_func op_c0f0_4_ff;
-extern cpuop_func op_c0f8_4_nf;
-extern cpuop_func op_c0f8_4_ff;
-extern cpuop_func op_c0f9_4_nf;
-extern cpuop_func op_c0f9_4_ff;
-extern cpuop_func op_c0fa_4_nf;
-extern cpuop_func op_c0fa_4_ff;
-extern cpuop_func op_c0fb_4_nf;
-extern cpuop_func op_c0fb_4_ff;
-extern cpuop_func op_c0fc_4_nf;
-extern cpuop_func op_c0fc_4_ff;
-extern cpuop_func op_c100_4_nf;
-extern cpuop_func op_c100_4_ff;
-extern cpuop_func op_c108_4_nf;
-extern cpuop_func op_c108_4_ff;
-extern cpuop_func op_c110_4_nf;
-extern cpuop_func op_c110_4_ff;
-extern cpuop_func op_c118_4_nf;
-extern cpuop_func op_c118_4_ff;
-extern cpuop_func op_c120_4_nf;
-extern cpuop_func op_c120_4_ff;
-extern cpuop_func op_c128_4_nf;
-extern cpuop_func op_c128_4_ff;
-extern cpuop_func op_c130_4_nf;
-extern cpuop_func op_c130_4_ff;
-extern cpuop_func op_c138_4_nf;
-extern cpuop_func op_c138_4_ff;
-extern cpuop_func op_c139_4_nf;
-extern cpuop_func op_c139_4_ff;
-extern cpuop_func op_c140_4_nf;
-extern cpuop_func op_c140_4_ff;
-extern cpuop_func op_c148_4_nf;
-extern cpuop_func op_c148_4_ff;
-extern cpuop_func op_c150_4_nf;
-extern cpuop_func op_c150_4_ff;
-extern cpuop_func op_c158_4_nf;
-extern cpuop_func op_c158_4_ff;
-extern cpuop_func op_c160_4_nf;
-extern cpuop_func op_c160_4_ff;
-extern cpuop_func op_c168_4_nf;
-extern cpuop_func op_c168_4_ff;
-extern cpuop_func op_c170_4_nf;
-extern cpuop_func op_c170_4_ff;
-extern cpuop_func op_c178_4_nf;
-extern cpuop_func op_c178_4_ff;
-extern cpuop_func op_c179_4_nf;
-extern cpuop_func op_c179_4_ff;
-extern cpuop_func op_c188_4_nf;
-extern cpuop_func op_c188_4_ff;
-extern cpuop_func op_c190_4_nf;
-extern cpuop_func op_c190_4_ff;
-extern cpuop_func op_c198_4_nf;
-extern cpuop_func op_c198_4_ff;
-extern cpuop_func op_c1a0_4_nf;
-extern cpuop_func op_c1a0_4_ff;
-extern cpuop_func op_c1a8_4_nf;
-extern cpuop_func op_c1a8_4_ff;
-extern cpuop_func op_c1b0_4_nf;
-extern cpuop_func op_c1b0_4_ff;
-extern cpuop_func op_c1b8_4_nf;
-extern cpuop_func op_c1b8_4_ff;
-extern cpuop_func op_c1b9_4_nf;
-extern cpuop_func op_c1b9_4_ff;
-extern cpuop_func op_c1c0_4_nf;
-extern cpuop_func op_c1c0_4_ff;
-extern cpuop_func op_c1d0_4_nf;
-extern cpuop_func op_c1d0_4_ff;
-extern cpuop_func op_c1d8_4_nf;
-extern cpuop_func op_c1d8_4_ff;
-extern cpuop_func op_c1e0_4_nf;
-extern cpuop_func op_c1e0_4_ff;
-extern cpuop_func op_c1e8_4_nf;
-extern cpuop_func op_c1e8_4_ff;
-extern cpuop_func op_c1f0_4_nf;
-extern cpuop_func op_c1f0_4_ff;
-extern cpuop_func op_c1f8_4_nf;
-extern cpuop_func op_c1f8_4_ff;
-extern cpuop_func op_c1f9_4_nf;
-extern cpuop_func op_c1f9_4_ff;
-extern cpuop_func op_c1fa_4_nf;
-extern cpuop_func op_c1fa_4_ff;
-extern cpuop_func op_c1fb_4_nf;
-extern cpuop_func op_c1fb_4_ff;
-extern cpuop_func op_c1fc_4_nf;
-extern cpuop_func op_c1fc_4_ff;
-extern cpuop_func op_d000_4_nf;
-extern cpuop_func op_d000_4_ff;
-extern cpuop_func op_d010_4_nf;
-extern cpuop_func op_d010_4_ff;
-extern cpuop_func op_d018_4_nf;
-extern cpuop_func op_d018_4_ff;
-extern cpuop_func op_d020_4_nf;
-extern cpuop_func op_d020_4_ff;
-extern cpuop_func op_d028_4_nf;
-extern cpuop_func op_d028_4_ff;
-extern cpuop_func op_d030_4_nf;
-extern cpuop_func op_d030_4_ff;
-extern cpuop_func op_d038_4_nf;
-extern cpuop_func op_d038_4_ff;
-extern cpuop_func op_d039_4_nf;
-extern cpuop_func op_d039_4_ff;
-extern cpuop_func op_d03a_4_nf;
-extern cpuop_func op_d03a_4_ff;
-extern cpuop_func op_d03b_4_nf;
-extern cpuop_func op_d03b_4_ff;
-extern cpuop_func op_d03c_4_nf;
-extern cpuop_func op_d03c_4_ff;
-extern cpuop_func op_d040_4_nf;
-extern cpuop_func op_d040_4_ff;
-extern cpuop_func op_d048_4_nf;
-extern cpuop_func op_d048_4_ff;
-extern cpuop_func op_d050_4_nf;
-extern cpuop_func op_d050_4_ff;
-extern cpuop_func op_d058_4_nf;
-extern cpuop_func op_d058_4_ff;
-extern cpuop_func op_d060_4_nf;
-extern cpuop_func op_d060_4_ff;
-extern cpuop_func op_d068_4_nf;
-extern cpuop_func op_d068_4_ff;
-extern cpuop_func op_d070_4_nf;
-extern cpuop_func op_d070_4_ff;
-extern cpuop_func op_d078_4_nf;
-extern cpuop_func op_d078_4_ff;
-extern cpuop_func op_d079_4_nf;
-extern cpuop_func op_d079_4_ff;
-extern cpuop_func op_d07a_4_nf;
-extern cpuop_func op_d07a_4_ff;
-extern cpuop_func op_d07b_4_nf;
-extern cpuop_func op_d07b_4_ff;
-extern cpuop_func op_d07c_4_nf;
-extern cpuop_func op_d07c_4_ff;
-extern cpuop_func op_d080_4_nf;
-extern cpuop_func op_d080_4_ff;
-extern cpuop_func op_d088_4_nf;
-extern cpuop_func op_d088_4_ff;
-extern cpuop_func op_d090_4_nf;
-extern cpuop_func op_d090_4_ff;
-extern cpuop_func op_d098_4_nf;
-extern cpuop_func op_d098_4_ff;
-extern cpuop_func op_d0a0_4_nf;
-extern cpuop_func op_d0a0_4_ff;
-extern cpuop_func op_d0a8_4_nf;
-extern cpuop_func op_d0a8_4_ff;
-extern cpuop_func op_d0b0_4_nf;
-extern cpuop_func op_d0b0_4_ff;
-extern cpuop_func op_d0b8_4_nf;
-extern cpuop_func op_d0b8_4_ff;
-extern cpuop_func op_d0b9_4_nf;
-extern cpuop_func op_d0b9_4_ff;
-extern cpuop_func op_d0ba_4_nf;
-extern cpuop_func op_d0ba_4_ff;
-extern cpuop_func op_d0bb_4_nf;
-extern cpuop_func op_d0bb_4_ff;
-extern cpuop_func op_d0bc_4_nf;
-extern cpuop_func op_d0bc_4_ff;
-extern cpuop_func op_d0c0_4_nf;
-extern cpuop_func op_d0c0_4_ff;
-extern cpuop_func op_d0c8_4_nf;
-extern cpuop_func op_d0c8_4_ff;
-extern cpuop_func op_d0d0_4_nf;
-extern cpuop_func op_d0d0_4_ff;
-extern cpuop_func op_d0d8_4_nf;
-extern cpuop_func op_d0d8_4_ff;
-extern cpuop_func op_d0e0_4_nf;
-extern cpuop_func op_d0e0_4_ff;
-extern cpuop_func op_d0e8_4_nf;
-extern cpuop_func op_d0e8_4_ff;
-extern cpuop_func op_d0f0_4_nf;
-extern cpuop_func op_d0f0_4_ff;
-extern cpuop_func op_d0f8_4_nf;
-extern cpuop_func op_d0f8_4_ff;
-extern cpuop_func op_d0f9_4_nf;
-extern cpuop_func op_d0f9_4_ff;
-extern cpuop_func op_d0fa_4_nf;
-extern cpuop_func op_d0fa_4_ff;
-extern cpuop_func op_d0fb_4_nf;
-extern cpuop_func op_d0fb_4_ff;
-extern cpuop_func op_d0fc_4_nf;
-extern cpuop_func op_d0fc_4_ff;
-extern cpuop_func op_d100_4_nf;
-extern cpuop_func op_d100_4_ff;
-extern cpuop_func op_d108_4_nf;
-extern cpuop_func op_d108_4_ff;
-extern cpuop_func op_d110_4_nf;
-extern cpuop_func op_d110_4_ff;
-extern cpuop_func op_d118_4_nf;
-extern cpuop_func op_d118_4_ff;
-extern cpuop_func op_d120_4_nf;
-extern cpuop_func op_d120_4_ff;
-extern cpuop_func op_d128_4_nf;
-extern cpuop_func op_d128_4_ff;
-extern cpuop_func op_d130_4_nf;
-extern cpuop_func op_d130_4_ff;
-extern cpuop_func op_d138_4_nf;
-extern cpuop_func op_d138_4_ff;
-extern cpuop_func op_d139_4_nf;
-extern cpuop_func op_d139_4_ff;
-extern cpuop_func op_d140_4_nf;
-extern cpuop_func op_d140_4_ff;
-extern cpuop_func op_d148_4_nf;
-extern cpuop_func op_d148_4_ff;
-extern cpuop_func op_d150_4_nf;
-extern cpuop_func op_d150_4_ff;
-extern cpuop_func op_d158_4_nf;
-extern cpuop_func op_d158_4_ff;
-extern cpuop_func op_d160_4_nf;
-extern cpuop_func op_d160_4_ff;
-extern cpuop_func op_d168_4_nf;
-extern cpuop_func op_d168_4_ff;
-extern cpuop_func op_d170_4_nf;
-extern cpuop_func op_d170_4_ff;
-extern cpuop_func op_d178_4_nf;
-extern cpuop_func op_d178_4_ff;
-extern cpuop_func op_d179_4_nf;
-extern cpuop_func op_d179_4_ff;
-extern cpuop_func op_d180_4_nf;
-extern cpuop_func op_d180_4_ff;
-extern cpuop_func op_d188_4_nf;
-extern cpuop_func op_d188_4_ff;
-extern cpuop_func op_d190_4_nf;
-extern cpuop_func op_d190_4_ff;
-extern cpuop_func op_d198_4_nf;
-extern cpuop_func op_d198_4_ff;
-extern cpuop_func op_d1a0_4_nf;
-extern cpuop_func op_d1a0_4_ff;
-extern cpuop_func op_d1a8_4_nf;
-extern cpuop_func op_d1a8_4_ff;
-extern cpuop_func op_d1b0_4_nf;
-extern cpuop_func op_d1b0_4_ff;
-extern cpuop_func op_d1b8_4_nf;
-extern cpuop_func op_d1b8_4_ff;
-extern cpuop_func op_d1b9_4_nf;
-extern cpuop_func op_d1b9_4_ff;
-extern cpuop_func op_d1c0_4_nf;
-extern cpuop_func op_d1c0_4_ff;
-extern cpuop_func op_d1c8_4_nf;
-extern cpuop_func op_d1c8_4_ff;
-extern cpuop_func op_d1d0_4_nf;
-extern cpuop_func op_d1d0_4_ff;
-extern cpuop_func op_d1d8_4_nf;
-extern cpuop_func op_d1d8_4_ff;
-extern cpuop_func op_d1e0_4_nf;
-extern cpuop_func op_d1e0_4_ff;
-extern cpuop_func op_d1e8_4_nf;
-extern cpuop_func op_d1e8_4_ff;
-extern cpuop_func op_d1f0_4_nf;
-extern cpuop_func op_d1f0_4_ff;
-extern cpuop_func op_d1f8_4_nf;
-extern cpuop_func op_d1f8_4_ff;
-extern cpuop_func op_d1f9_4_nf;
-extern cpuop_func op_d1f9_4_ff;
-extern cpuop_func op_d1fa_4_nf;
-extern cpuop_func op_d1fa_4_ff;
-extern cpuop_func op_d1fb_4_nf;
-extern cpuop_func op_d1fb_4_ff;
-extern cpuop_func op_d1fc_4_nf;
-extern cpuop_func op_d1fc_4_ff;
-extern cpuop_func op_e000_4_nf;
-extern cpuop_func op_e000_4_ff;
-extern cpuop_func op_e008_4_nf;
-extern cpuop_func op_e008_4_ff;
-extern cpuop_func op_e010_4_nf;
-extern cpuop_func op_e010_4_ff;
-extern cpuop_func op_e018_4_nf;
-extern cpuop_func op_e018_4_ff;
-extern cpuop_func op_e020_4_nf;
-extern cpuop_func op_e020_4_ff;
-extern cpuop_func op_e028_4_nf;
-extern cpuop_func op_e028_4_ff;
-extern cpuop_func op_e030_4_nf;
-extern cpuop_func op_e030_4_ff;
-extern cpuop_func op_e038_4_nf;
-extern cpuop_func op_e038_4_ff;
-extern cpuop_func op_e040_4_nf;
-extern cpuop_func op_e040_4_ff;
-extern cpuop_func op_e048_4_nf;
-extern cpuop_func op_e048_4_ff;
-extern cpuop_func op_e050_4_nf;
-extern cpuop_func op_e050_4_ff;
-extern cpuop_func op_e058_4_nf;
-extern cpuop_func op_e058_4_ff;
-extern cpuop_func op_e060_4_nf;
-extern cpuop_func op_e060_4_ff;
-extern cpuop_func op_e068_4_nf;
-extern cpuop_func op_e068_4_ff;
-extern cpuop_func op_e070_4_nf;
-extern cpuop_func op_e070_4_ff;
-extern cpuop_func op_e078_4_nf;
-extern cpuop_func op_e078_4_ff;
-extern cpuop_func op_e080_4_nf;
-extern cpuop_func op_e080_4_ff;
-extern cpuop_func op_e088_4_nf;
-extern cpuop_func op_e088_4_ff;
-extern cpuop_func op_e090_4_nf;
-extern cpuop_func op_e090_4_ff;
-extern cpuop_func op_e098_4_nf;
-extern cpuop_func op_e098_4_ff;
-extern cpuop_func op_e0a0_4_nf;
-extern cpuop_func op_e0a0_4_ff;
-extern cpuop_func op_e0a8_4_nf;
-extern cpuop_func op_e0a8_4_ff;
-extern cpuop_func op_e0b0_4_nf;
-extern cpuop_func op_e0b0_4_ff;
-extern cpuop_func op_e0b8_4_nf;
-extern cpuop_func op_e0b8_4_ff;
-extern cpuop_func op_e0d0_4_nf;
-extern cpuop_func op_e0d0_4_ff;
-extern cpuop_func op_e0d8_4_nf;
-extern cpuop_func op_e0d8_4_ff;
-extern cpuop_func op_e0e0_4_nf;
-extern cpuop_func op_e0e0_4_ff;
-extern cpuop_func op_e0e8_4_nf;
-extern cpuop_func op_e0e8_4_ff;
-extern cpuop_func op_e0f0_4_nf;
-extern cpuop_func op_e0f0_4_ff;
-extern cpuop_func op_e0f8_4_nf;
-extern cpuop_func op_e0f8_4_ff;
-extern cpuop_func op_e0f9_4_nf;
-extern cpuop_func op_e0f9_4_ff;
-extern cpuop_func op_e100_4_nf;
-extern cpuop_func op_e100_4_ff;
-extern cpuop_func op_e108_4_nf;
-extern cpuop_func op_e108_4_ff;
-extern cpuop_func op_e110_4_nf;
-extern cpuop_func op_e110_4_ff;
-extern cpuop_func op_e118_4_nf;
-extern cpuop_func op_e118_4_ff;
-extern cpuop_func op_e120_4_nf;
-extern cpuop_func op_e120_4_ff;
-extern cpuop_func op_e128_4_nf;
-extern cpuop_func op_e128_4_ff;
-extern cpuop_func op_e130_4_nf;
-extern cpuop_func op_e130_4_ff;
-extern cpuop_func op_e138_4_nf;
-extern cpuop_func op_e138_4_ff;
-extern cpuop_func op_e140_4_nf;
-extern cpuop_func op_e140_4_ff;
-extern cpuop_func op_e148_4_nf;
-extern cpuop_func op_e148_4_ff;
-extern cpuop_func op_e150_4_nf;
-extern cpuop_func op_e150_4_ff;
-extern cpuop_func op_e158_4_nf;
-extern cpuop_func op_e158_4_ff;
-extern cpuop_func op_e160_4_nf;
-extern cpuop_func op_e160_4_ff;
-extern cpuop_func op_e168_4_nf;
-extern cpuop_func op_e168_4_ff;
-extern cpuop_func op_e170_4_nf;
-extern cpuop_func op_e170_4_ff;
-extern cpuop_func op_e178_4_nf;
-extern cpuop_func op_e178_4_ff;
-extern cpuop_func op_e180_4_nf;
-extern cpuop_func op_e180_4_ff;
-extern cpuop_func op_e188_4_nf;
-extern cpuop_func op_e188_4_ff;
-extern cpuop_func op_e190_4_nf;
-extern cpuop_func op_e190_4_ff;
-extern cpuop_func op_e198_4_nf;
-extern cpuop_func op_e198_4_ff;
-extern cpuop_func op_e1a0_4_nf;
-extern cpuop_func op_e1a0_4_ff;
-extern cpuop_func op_e1a8_4_nf;
-extern cpuop_func op_e1a8_4_ff;
-extern cpuop_func op_e1b0_4_nf;
-extern cpuop_func op_e1b0_4_ff;
-extern cpuop_func op_e1b8_4_nf;
-extern cpuop_func op_e1b8_4_ff;
-extern cpuop_func op_e1d0_4_nf;
-extern cpuop_func op_e1d0_4_ff;
-extern cpuop_func op_e1d8_4_nf;
-extern cpuop_func op_e1d8_4_ff;
-extern cpuop_func op_e1e0_4_nf;
-extern cpuop_func op_e1e0_4_ff;
-extern cpuop_func op_e1e8_4_nf;
-extern cpuop_func op_e1e8_4_ff;
-extern cpuop_func op_e1f0_4_nf;
-extern cpuop_func op_e1f0_4_ff;
-extern cpuop_func op_e1f8_4_nf;
-extern cpuop_func op_e1f8_4_ff;
-extern cpuop_func op_e1f9_4_nf;
-extern cpuop_func op_e1f9_4_ff;
-extern cpuop_func op_e2d0_4_nf;
-extern cpuop_func op_e2d0_4_ff;
-extern cpuop_func op_e2d8_4_nf;
-extern cpuop_func op_e2d8_4_ff;
-extern cpuop_func op_e2e0_4_nf;
-extern cpuop_func op_e2e0_4_ff;
-extern cpuop_func op_e2e8_4_nf;
-extern cpuop_func op_e2e8_4_ff;
-extern cpuop_func op_e2f0_4_nf;
-extern cpuop_func op_e2f0_4_ff;
-extern cpuop_func op_e2f8_4_nf;
-extern cpuop_func op_e2f8_4_ff;
-extern cpuop_func op_e2f9_4_nf;
-extern cpuop_func op_e2f9_4_ff;
-extern cpuop_func op_e3d0_4_nf;
-extern cpuop_func op_e3d0_4_ff;
-extern cpuop_func op_e3d8_4_nf;
-extern cpuop_func op_e3d8_4_ff;
-extern cpuop_func op_e3e0_4_nf;
-extern cpuop_func op_e3e0_4_ff;
-extern cpuop_func op_e3e8_4_nf;
-extern cpuop_func op_e3e8_4_ff;
-extern cpuop_func op_e3f0_4_nf;
-extern cpuop_func op_e3f0_4_ff;
-extern cpuop_func op_e3f8_4_nf;
-extern cpuop_func op_e3f8_4_ff;
-extern cpuop_func op_e3f9_4_nf;
-extern cpuop_func op_e3f9_4_ff;
-extern cpuop_func op_e4d0_4_nf;
-extern cpuop_func op_e4d0_4_ff;
-extern cpuop_func op_e4d8_4_nf;
-extern cpuop_func op_e4d8_4_ff;
-extern cpuop_func op_e4e0_4_nf;
-extern cpuop_func op_e4e0_4_ff;
-extern cpuop_func op_e4e8_4_nf;
-extern cpuop_func op_e4e8_4_ff;
-extern cpuop_func op_e4f0_4_nf;
-extern cpuop_func op_e4f0_4_ff;
-extern cpuop_func op_e4f8_4_nf;
-extern cpuop_func op_e4f8_4_ff;
-extern cpuop_func op_e4f9_4_nf;
-extern cpuop_func op_e4f9_4_ff;
-extern cpuop_func op_e5d0_4_nf;
-extern cpuop_func op_e5d0_4_ff;
-extern cpuop_func op_e5d8_4_nf;
-extern cpuop_func op_e5d8_4_ff;
-extern cpuop_func op_e5e0_4_nf;
-extern cpuop_func op_e5e0_4_ff;
-extern cpuop_func op_e5e8_4_nf;
-extern cpuop_func op_e5e8_4_ff;
-extern cpuop_func op_e5f0_4_nf;
-extern cpuop_func op_e5f0_4_ff;
-extern cpuop_func op_e5f8_4_nf;
-extern cpuop_func op_e5f8_4_ff;
-extern cpuop_func op_e5f9_4_nf;
-extern cpuop_func op_e5f9_4_ff;
-extern cpuop_func op_e6d0_4_nf;
-extern cpuop_func op_e6d0_4_ff;
-extern cpuop_func op_e6d8_4_nf;
-extern cpuop_func op_e6d8_4_ff;
-extern cpuop_func op_e6e0_4_nf;
-extern cpuop_func op_e6e0_4_ff;
-extern cpuop_func op_e6e8_4_nf;
-extern cpuop_func op_e6e8_4_ff;
-extern cpuop_func op_e6f0_4_nf;
-extern cpuop_func op_e6f0_4_ff;
-extern cpuop_func op_e6f8_4_nf;
-extern cpuop_func op_e6f8_4_ff;
-extern cpuop_func op_e6f9_4_nf;
-extern cpuop_func op_e6f9_4_ff;
-extern cpuop_func op_e7d0_4_nf;
-extern cpuop_func op_e7d0_4_ff;
-extern cpuop_func op_e7d8_4_nf;
-extern cpuop_func op_e7d8_4_ff;
-extern cpuop_func op_e7e0_4_nf;
-extern cpuop_func op_e7e0_4_ff;
-extern cpuop_func op_e7e8_4_nf;
-extern cpuop_func op_e7e8_4_ff;
-extern cpuop_func op_e7f0_4_nf;
-extern cpuop_func op_e7f0_4_ff;
-extern cpuop_func op_e7f8_4_nf;
-extern cpuop_func op_e7f8_4_ff;
-extern cpuop_func op_e7f9_4_nf;
-extern cpuop_func op_e7f9_4_ff;
-extern cpuop_func op_0_5_nf;
+extern cpuop_func IllegalOpcode;
+extern cpuop_func * const cpuFunctionTable[];
+extern const uint16_t cpuOpcodeIndex[65536];
+
 extern cpuop_func op_0_5_ff;
-extern cpuop_func op_10_5_nf;
 extern cpuop_func op_10_5_ff;
-extern cpuop_func op_18_5_nf;
 extern cpuop_func op_18_5_ff;
-extern cpuop_func op_20_5_nf;
 extern cpuop_func op_20_5_ff;
-extern cpuop_func op_28_5_nf;
 extern cpuop_func op_28_5_ff;
-extern cpuop_func op_30_5_nf;
 extern cpuop_func op_30_5_ff;
-extern cpuop_func op_38_5_nf;
 extern cpuop_func op_38_5_ff;
-extern cpuop_func op_39_5_nf;
 extern cpuop_func op_39_5_ff;
-extern cpuop_func op_3c_5_nf;
 extern cpuop_func op_3c_5_ff;
-extern cpuop_func op_40_5_nf;
 extern cpuop_func op_40_5_ff;
-extern cpuop_func op_50_5_nf;
 extern cpuop_func op_50_5_ff;
-extern cpuop_func op_58_5_nf;
 extern cpuop_func op_58_5_ff;
-extern cpuop_func op_60_5_nf;
 extern cpuop_func op_60_5_ff;
-extern cpuop_func op_68_5_nf;
 extern cpuop_func op_68_5_ff;
-extern cpuop_func op_70_5_nf;
 extern cpuop_func op_70_5_ff;
-extern cpuop_func op_78_5_nf;
 extern cpuop_func op_78_5_ff;
-extern cpuop_func op_79_5_nf;
 extern cpuop_func op_79_5_ff;
-extern cpuop_func op_7c_5_nf;
 extern cpuop_func op_7c_5_ff;
-extern cpuop_func op_80_5_nf;
 extern cpuop_func op_80_5_ff;
-extern cpuop_func op_90_5_nf;
 extern cpuop_func op_90_5_ff;
-extern cpuop_func op_98_5_nf;
 extern cpuop_func op_98_5_ff;
-extern cpuop_func op_a0_5_nf;
 extern cpuop_func op_a0_5_ff;
-extern cpuop_func op_a8_5_nf;
 extern cpuop_func op_a8_5_ff;
-extern cpuop_func op_b0_5_nf;
 extern cpuop_func op_b0_5_ff;
-extern cpuop_func op_b8_5_nf;
 extern cpuop_func op_b8_5_ff;
-extern cpuop_func op_b9_5_nf;
 extern cpuop_func op_b9_5_ff;
-extern cpuop_func op_100_5_nf;
 extern cpuop_func op_100_5_ff;
-extern cpuop_func op_108_5_nf;
 extern cpuop_func op_108_5_ff;
-extern cpuop_func op_110_5_nf;
 extern cpuop_func op_110_5_ff;
-extern cpuop_func op_118_5_nf;
 extern cpuop_func op_118_5_ff;
-extern cpuop_func op_120_5_nf;
 extern cpuop_func op_120_5_ff;
-extern cpuop_func op_128_5_nf;
 extern cpuop_func op_128_5_ff;
-extern cpuop_func op_130_5_nf;
 extern cpuop_func op_130_5_ff;
-extern cpuop_func op_138_5_nf;
 extern cpuop_func op_138_5_ff;
-extern cpuop_func op_139_5_nf;
 extern cpuop_func op_139_5_ff;
-extern cpuop_func op_13a_5_nf;
 extern cpuop_func op_13a_5_ff;
-extern cpuop_func op_13b_5_nf;
 extern cpuop_func op_13b_5_ff;
-extern cpuop_func op_13c_5_nf;
 extern cpuop_func op_13c_5_ff;
-extern cpuop_func op_140_5_nf;
 extern cpuop_func op_140_5_ff;
-extern cpuop_func op_148_5_nf;
 extern cpuop_func op_148_5_ff;
-extern cpuop_func op_150_5_nf;
 extern cpuop_func op_150_5_ff;
-extern cpuop_func op_158_5_nf;
 extern cpuop_func op_158_5_ff;
-extern cpuop_func op_160_5_nf;
 extern cpuop_func op_160_5_ff;
-extern cpuop_func op_168_5_nf;
 extern cpuop_func op_168_5_ff;
-extern cpuop_func op_170_5_nf;
 extern cpuop_func op_170_5_ff;
-extern cpuop_func op_178_5_nf;
 extern cpuop_func op_178_5_ff;
-extern cpuop_func op_179_5_nf;
 extern cpuop_func op_179_5_ff;
-extern cpuop_func op_17a_5_nf;
 extern cpuop_func op_17a_5_ff;
-extern cpuop_func op_17b_5_nf;
 extern cpuop_func op_17b_5_ff;
-extern cpuop_func op_180_5_nf;
 extern cpuop_func op_180_5_ff;
-extern cpuop_func op_188_5_nf;
 extern cpuop_func op_188_5_ff;
-extern cpuop_func op_190_5_nf;
 extern cpuop_func op_190_5_ff;
-extern cpuop_func op_198_5_nf;
 extern cpuop_func op_198_5_ff;
-extern cpuop_func op_1a0_5_nf;
 extern cpuop_func op_1a0_5_ff;
-extern cpuop_func op_1a8_5_nf;
 extern cpuop_func op_1a8_5_ff;
-extern cpuop_func op_1b0_5_nf;
 extern cpuop_func op_1b0_5_ff;
-extern cpuop_func op_1b8_5_nf;
 extern cpuop_func op_1b8_5_ff;
-extern cpuop_func op_1b9_5_nf;
 extern cpuop_func op_1b9_5_ff;
-extern cpuop_func op_1ba_5_nf;
 extern cpuop_func op_1ba_5_ff;
-extern cpuop_func op_1bb_5_nf;
 extern cpuop_func op_1bb_5_ff;
-extern cpuop_func op_1c0_5_nf;
 extern cpuop_func op_1c0_5_ff;
-extern cpuop_func op_1c8_5_nf;
 extern cpuop_func op_1c8_5_ff;
-extern cpuop_func op_1d0_5_nf;
 extern cpuop_func op_1d0_5_ff;
-extern cpuop_func op_1d8_5_nf;
 extern cpuop_func op_1d8_5_ff;
-extern cpuop_func op_1e0_5_nf;
 extern cpuop_func op_1e0_5_ff;
-extern cpuop_func op_1e8_5_nf;
 extern cpuop_func op_1e8_5_ff;
-extern cpuop_func op_1f0_5_nf;
 extern cpuop_func op_1f0_5_ff;
-extern cpuop_func op_1f8_5_nf;
 extern cpuop_func op_1f8_5_ff;
-extern cpuop_func op_1f9_5_nf;
 extern cpuop_func op_1f9_5_ff;
-extern cpuop_func op_1fa_5_nf;
 extern cpuop_func op_1fa_5_ff;
-extern cpuop_func op_1fb_5_nf;
 extern cpuop_func op_1fb_5_ff;
-extern cpuop_func op_200_5_nf;
 extern cpuop_func op_200_5_ff;
-extern cpuop_func op_210_5_nf;
 extern cpuop_func op_210_5_ff;
-extern cpuop_func op_218_5_nf;
 extern cpuop_func op_218_5_ff;
-extern cpuop_func op_220_5_nf;
 extern cpuop_func op_220_5_ff;
-extern cpuop_func op_228_5_nf;
 extern cpuop_func op_228_5_ff;
-extern cpuop_func op_230_5_nf;
 extern cpuop_func op_230_5_ff;
-extern cpuop_func op_238_5_nf;
 extern cpuop_func op_238_5_ff;
-extern cpuop_func op_239_5_nf;
 extern cpuop_func op_239_5_ff;
-extern cpuop_func op_23c_5_nf;
 extern cpuop_func op_23c_5_ff;
-extern cpuop_func op_240_5_nf;
 extern cpuop_func op_240_5_ff;
-extern cpuop_func op_250_5_nf;
 extern cpuop_func op_250_5_ff;
-extern cpuop_func op_258_5_nf;
 extern cpuop_func op_258_5_ff;
-extern cpuop_func op_260_5_nf;
 extern cpuop_func op_260_5_ff;
-extern cpuop_func op_268_5_nf;
 extern cpuop_func op_268_5_ff;
-extern cpuop_func op_270_5_nf;
 extern cpuop_func op_270_5_ff;
-extern cpuop_func op_278_5_nf;
 extern cpuop_func op_278_5_ff;
-extern cpuop_func op_279_5_nf;
 extern cpuop_func op_279_5_ff;
-extern cpuop_func op_27c_5_nf;
 extern cpuop_func op_27c_5_ff;
-extern cpuop_func op_280_5_nf;
 extern cpuop_func op_280_5_ff;
-extern cpuop_func op_290_5_nf;
 extern cpuop_func op_290_5_ff;
-extern cpuop_func op_298_5_nf;
 extern cpuop_func op_298_5_ff;
-extern cpuop_func op_2a0_5_nf;
 extern cpuop_func op_2a0_5_ff;
-extern cpuop_func op_2a8_5_nf;
 extern cpuop_func op_2a8_5_ff;
-extern cpuop_func op_2b0_5_nf;
 extern cpuop_func op_2b0_5_ff;
-extern cpuop_func op_2b8_5_nf;
 extern cpuop_func op_2b8_5_ff;
-extern cpuop_func op_2b9_5_nf;
 extern cpuop_func op_2b9_5_ff;
-extern cpuop_func op_400_5_nf;
 extern cpuop_func op_400_5_ff;
-extern cpuop_func op_410_5_nf;
 extern cpuop_func op_410_5_ff;
-extern cpuop_func op_418_5_nf;
 extern cpuop_func op_418_5_ff;
-extern cpuop_func op_420_5_nf;
 extern cpuop_func op_420_5_ff;
-extern cpuop_func op_428_5_nf;
 extern cpuop_func op_428_5_ff;
-extern cpuop_func op_430_5_nf;
 extern cpuop_func op_430_5_ff;
-extern cpuop_func op_438_5_nf;
 extern cpuop_func op_438_5_ff;
-extern cpuop_func op_439_5_nf;
 extern cpuop_func op_439_5_ff;
-extern cpuop_func op_440_5_nf;
 extern cpuop_func op_440_5_ff;
-extern cpuop_func op_450_5_nf;
 extern cpuop_func op_450_5_ff;
-extern cpuop_func op_458_5_nf;
 extern cpuop_func op_458_5_ff;
-extern cpuop_func op_460_5_nf;
 extern cpuop_func op_460_5_ff;
-extern cpuop_func op_468_5_nf;
 extern cpuop_func op_468_5_ff;
-extern cpuop_func op_470_5_nf;
 extern cpuop_func op_470_5_ff;
-extern cpuop_func op_478_5_nf;
 extern cpuop_func op_478_5_ff;
-extern cpuop_func op_479_5_nf;
 extern cpuop_func op_479_5_ff;
-extern cpuop_func op_480_5_nf;
 extern cpuop_func op_480_5_ff;
-extern cpuop_func op_490_5_nf;
 extern cpuop_func op_490_5_ff;
-extern cpuop_func op_498_5_nf;
 extern cpuop_func op_498_5_ff;
-extern cpuop_func op_4a0_5_nf;
 extern cpuop_func op_4a0_5_ff;
-extern cpuop_func op_4a8_5_nf;
 extern cpuop_func op_4a8_5_ff;
-extern cpuop_func op_4b0_5_nf;
 extern cpuop_func op_4b0_5_ff;
-extern cpuop_func op_4b8_5_nf;
 extern cpuop_func op_4b8_5_ff;
-extern cpuop_func op_4b9_5_nf;
 extern cpuop_func op_4b9_5_ff;
-extern cpuop_func op_600_5_nf;
 extern cpuop_func op_600_5_ff;
-extern cpuop_func op_610_5_nf;
 extern cpuop_func op_610_5_ff;
-extern cpuop_func op_618_5_nf;
 extern cpuop_func op_618_5_ff;
-extern cpuop_func op_620_5_nf;
 extern cpuop_func op_620_5_ff;
-extern cpuop_func op_628_5_nf;
 extern cpuop_func op_628_5_ff;
-extern cpuop_func op_630_5_nf;
 extern cpuop_func op_630_5_ff;
-extern cpuop_func op_638_5_nf;
 extern cpuop_func op_638_5_ff;
-extern cpuop_func op_639_5_nf;
 extern cpuop_func op_639_5_ff;
-extern cpuop_func op_640_5_nf;
 extern cpuop_func op_640_5_ff;
-extern cpuop_func op_650_5_nf;
 extern cpuop_func op_650_5_ff;
-extern cpuop_func op_658_5_nf;
 extern cpuop_func op_658_5_ff;
-extern cpuop_func op_660_5_nf;
 extern cpuop_func op_660_5_ff;
-extern cpuop_func op_668_5_nf;
 extern cpuop_func op_668_5_ff;
-extern cpuop_func op_670_5_nf;
 extern cpuop_func op_670_5_ff;
-extern cpuop_func op_678_5_nf;
 extern cpuop_func op_678_5_ff;
-extern cpuop_func op_679_5_nf;
 extern cpuop_func op_679_5_ff;
-extern cpuop_func op_680_5_nf;
 extern cpuop_func op_680_5_ff;
-extern cpuop_func op_690_5_nf;
 extern cpuop_func op_690_5_ff;
-extern cpuop_func op_698_5_nf;
 extern cpuop_func op_698_5_ff;
-extern cpuop_func op_6a0_5_nf;
 extern cpuop_func op_6a0_5_ff;
-extern cpuop_func op_6a8_5_nf;
 extern cpuop_func op_6a8_5_ff;
-extern cpuop_func op_6b0_5_nf;
 extern cpuop_func op_6b0_5_ff;
-extern cpuop_func op_6b8_5_nf;
 extern cpuop_func op_6b8_5_ff;
-extern cpuop_func op_6b9_5_nf;
 extern cpuop_func op_6b9_5_ff;
-extern cpuop_func op_800_5_nf;
 extern cpuop_func op_800_5_ff;
-extern cpuop_func op_810_5_nf;
 extern cpuop_func op_810_5_ff;
-extern cpuop_func op_818_5_nf;
 extern cpuop_func op_818_5_ff;
-extern cpuop_func op_820_5_nf;
 extern cpuop_func op_820_5_ff;
-extern cpuop_func op_828_5_nf;
 extern cpuop_func op_828_5_ff;
-extern cpuop_func op_830_5_nf;
 extern cpuop_func op_830_5_ff;
-extern cpuop_func op_838_5_nf;
 extern cpuop_func op_838_5_ff;
-extern cpuop_func op_839_5_nf;
 extern cpuop_func op_839_5_ff;
-extern cpuop_func op_83a_5_nf;
 extern cpuop_func op_83a_5_ff;
-extern cpuop_func op_83b_5_nf;
 extern cpuop_func op_83b_5_ff;
-extern cpuop_func op_83c_5_nf;
 extern cpuop_func op_83c_5_ff;
-extern cpuop_func op_840_5_nf;
 extern cpuop_func op_840_5_ff;
-extern cpuop_func op_850_5_nf;
 extern cpuop_func op_850_5_ff;
-extern cpuop_func op_858_5_nf;
 extern cpuop_func op_858_5_ff;
-extern cpuop_func op_860_5_nf;
 extern cpuop_func op_860_5_ff;
-extern cpuop_func op_868_5_nf;
 extern cpuop_func op_868_5_ff;
-extern cpuop_func op_870_5_nf;
 extern cpuop_func op_870_5_ff;
-extern cpuop_func op_878_5_nf;
 extern cpuop_func op_878_5_ff;
-extern cpuop_func op_879_5_nf;
 extern cpuop_func op_879_5_ff;
-extern cpuop_func op_87a_5_nf;
 extern cpuop_func op_87a_5_ff;
-extern cpuop_func op_87b_5_nf;
 extern cpuop_func op_87b_5_ff;
-extern cpuop_func op_880_5_nf;
 extern cpuop_func op_880_5_ff;
-extern cpuop_func op_890_5_nf;
 extern cpuop_func op_890_5_ff;
-extern cpuop_func op_898_5_nf;
 extern cpuop_func op_898_5_ff;
-extern cpuop_func op_8a0_5_nf;
 extern cpuop_func op_8a0_5_ff;
-extern cpuop_func op_8a8_5_nf;
 extern cpuop_func op_8a8_5_ff;
-extern cpuop_func op_8b0_5_nf;
 extern cpuop_func op_8b0_5_ff;
-extern cpuop_func op_8b8_5_nf;
 extern cpuop_func op_8b8_5_ff;
-extern cpuop_func op_8b9_5_nf;
 extern cpuop_func op_8b9_5_ff;
-extern cpuop_func op_8ba_5_nf;
 extern cpuop_func op_8ba_5_ff;
-extern cpuop_func op_8bb_5_nf;
 extern cpuop_func op_8bb_5_ff;
-extern cpuop_func op_8c0_5_nf;
 extern cpuop_func op_8c0_5_ff;
-extern cpuop_func op_8d0_5_nf;
 extern cpuop_func op_8d0_5_ff;
-extern cpuop_func op_8d8_5_nf;
 extern cpuop_func op_8d8_5_ff;
-extern cpuop_func op_8e0_5_nf;
 extern cpuop_func op_8e0_5_ff;
-extern cpuop_func op_8e8_5_nf;
 extern cpuop_func op_8e8_5_ff;
-extern cpuop_func op_8f0_5_nf;
 extern cpuop_func op_8f0_5_ff;
-extern cpuop_func op_8f8_5_nf;
 extern cpuop_func op_8f8_5_ff;
-extern cpuop_func op_8f9_5_nf;
 extern cpuop_func op_8f9_5_ff;
-extern cpuop_func op_8fa_5_nf;
 extern cpuop_func op_8fa_5_ff;
-extern cpuop_func op_8fb_5_nf;
 extern cpuop_func op_8fb_5_ff;
-extern cpuop_func op_a00_5_nf;
 extern cpuop_func op_a00_5_ff;
-extern cpuop_func op_a10_5_nf;
 extern cpuop_func op_a10_5_ff;
-extern cpuop_func op_a18_5_nf;
 extern cpuop_func op_a18_5_ff;
-extern cpuop_func op_a20_5_nf;
 extern cpuop_func op_a20_5_ff;
-extern cpuop_func op_a28_5_nf;
 extern cpuop_func op_a28_5_ff;
-extern cpuop_func op_a30_5_nf;
 extern cpuop_func op_a30_5_ff;
-extern cpuop_func op_a38_5_nf;
 extern cpuop_func op_a38_5_ff;
-extern cpuop_func op_a39_5_nf;
 extern cpuop_func op_a39_5_ff;
-extern cpuop_func op_a3c_5_nf;
 extern cpuop_func op_a3c_5_ff;
-extern cpuop_func op_a40_5_nf;
 extern cpuop_func op_a40_5_ff;
-extern cpuop_func op_a50_5_nf;
 extern cpuop_func op_a50_5_ff;
-extern cpuop_func op_a58_5_nf;
 extern cpuop_func op_a58_5_ff;
-extern cpuop_func op_a60_5_nf;
 extern cpuop_func op_a60_5_ff;
-extern cpuop_func op_a68_5_nf;
 extern cpuop_func op_a68_5_ff;
-extern cpuop_func op_a70_5_nf;
 extern cpuop_func op_a70_5_ff;
-extern cpuop_func op_a78_5_nf;
 extern cpuop_func op_a78_5_ff;
-extern cpuop_func op_a79_5_nf;
 extern cpuop_func op_a79_5_ff;
-extern cpuop_func op_a7c_5_nf;
 extern cpuop_func op_a7c_5_ff;
-extern cpuop_func op_a80_5_nf;
 extern cpuop_func op_a80_5_ff;
-extern cpuop_func op_a90_5_nf;
 extern cpuop_func op_a90_5_ff;
-extern cpuop_func op_a98_5_nf;
 extern cpuop_func op_a98_5_ff;
-extern cpuop_func op_aa0_5_nf;
 extern cpuop_func op_aa0_5_ff;
-extern cpuop_func op_aa8_5_nf;
 extern cpuop_func op_aa8_5_ff;
-extern cpuop_func op_ab0_5_nf;
 extern cpuop_func op_ab0_5_ff;
-extern cpuop_func op_ab8_5_nf;
 extern cpuop_func op_ab8_5_ff;
-extern cpuop_func op_ab9_5_nf;
 extern cpuop_func op_ab9_5_ff;
-extern cpuop_func op_c00_5_nf;
 extern cpuop_func op_c00_5_ff;
-extern cpuop_func op_c10_5_nf;
 extern cpuop_func op_c10_5_ff;
-extern cpuop_func op_c18_5_nf;
 extern cpuop_func op_c18_5_ff;
-extern cpuop_func op_c20_5_nf;
 extern cpuop_func op_c20_5_ff;
-extern cpuop_func op_c28_5_nf;
 extern cpuop_func op_c28_5_ff;
-extern cpuop_func op_c30_5_nf;
 extern cpuop_func op_c30_5_ff;
-extern cpuop_func op_c38_5_nf;
 extern cpuop_func op_c38_5_ff;
-extern cpuop_func op_c39_5_nf;
 extern cpuop_func op_c39_5_ff;
-extern cpuop_func op_c3a_5_nf;
 extern cpuop_func op_c3a_5_ff;
-extern cpuop_func op_c3b_5_nf;
 extern cpuop_func op_c3b_5_ff;
-extern cpuop_func op_c40_5_nf;
 extern cpuop_func op_c40_5_ff;
-extern cpuop_func op_c50_5_nf;
 extern cpuop_func op_c50_5_ff;
-extern cpuop_func op_c58_5_nf;
 extern cpuop_func op_c58_5_ff;
-extern cpuop_func op_c60_5_nf;
 extern cpuop_func op_c60_5_ff;
-extern cpuop_func op_c68_5_nf;
 extern cpuop_func op_c68_5_ff;
-extern cpuop_func op_c70_5_nf;
 extern cpuop_func op_c70_5_ff;
-extern cpuop_func op_c78_5_nf;
 extern cpuop_func op_c78_5_ff;
-extern cpuop_func op_c79_5_nf;
 extern cpuop_func op_c79_5_ff;
-extern cpuop_func op_c7a_5_nf;
 extern cpuop_func op_c7a_5_ff;
-extern cpuop_func op_c7b_5_nf;
 extern cpuop_func op_c7b_5_ff;
-extern cpuop_func op_c80_5_nf;
 extern cpuop_func op_c80_5_ff;
-extern cpuop_func op_c90_5_nf;
 extern cpuop_func op_c90_5_ff;
-extern cpuop_func op_c98_5_nf;
 extern cpuop_func op_c98_5_ff;
-extern cpuop_func op_ca0_5_nf;
 extern cpuop_func op_ca0_5_ff;
-extern cpuop_func op_ca8_5_nf;
 extern cpuop_func op_ca8_5_ff;
-extern cpuop_func op_cb0_5_nf;
 extern cpuop_func op_cb0_5_ff;
-extern cpuop_func op_cb8_5_nf;
 extern cpuop_func op_cb8_5_ff;
-extern cpuop_func op_cb9_5_nf;
 extern cpuop_func op_cb9_5_ff;
-extern cpuop_func op_cba_5_nf;
 extern cpuop_func op_cba_5_ff;
-extern cpuop_func op_cbb_5_nf;
 extern cpuop_func op_cbb_5_ff;
-extern cpuop_func op_1000_5_nf;
 extern cpuop_func op_1000_5_ff;
-extern cpuop_func op_1008_5_nf;
 extern cpuop_func op_1008_5_ff;
-extern cpuop_func op_1010_5_nf;
 extern cpuop_func op_1010_5_ff;
-extern cpuop_func op_1018_5_nf;
 extern cpuop_func op_1018_5_ff;
-extern cpuop_func op_1020_5_nf;
 extern cpuop_func op_1020_5_ff;
-extern cpuop_func op_1028_5_nf;
 extern cpuop_func op_1028_5_ff;
-extern cpuop_func op_1030_5_nf;
 extern cpuop_func op_1030_5_ff;
-extern cpuop_func op_1038_5_nf;
 extern cpuop_func op_1038_5_ff;
-extern cpuop_func op_1039_5_nf;
 extern cpuop_func op_1039_5_ff;
-extern cpuop_func op_103a_5_nf;
 extern cpuop_func op_103a_5_ff;
-extern cpuop_func op_103b_5_nf;
 extern cpuop_func op_103b_5_ff;
-extern cpuop_func op_103c_5_nf;
 extern cpuop_func op_103c_5_ff;
-extern cpuop_func op_1080_5_nf;
 extern cpuop_func op_1080_5_ff;
-extern cpuop_func op_1088_5_nf;
 extern cpuop_func op_1088_5_ff;
-extern cpuop_func op_1090_5_nf;
 extern cpuop_func op_1090_5_ff;
-extern cpuop_func op_1098_5_nf;
 extern cpuop_func op_1098_5_ff;
-extern cpuop_func op_10a0_5_nf;
 extern cpuop_func op_10a0_5_ff;
-extern cpuop_func op_10a8_5_nf;
 extern cpuop_func op_10a8_5_ff;
-extern cpuop_func op_10b0_5_nf;
 extern cpuop_func op_10b0_5_ff;
-extern cpuop_func op_10b8_5_nf;
 extern cpuop_func op_10b8_5_ff;
-extern cpuop_func op_10b9_5_nf;
 extern cpuop_func op_10b9_5_ff;
-extern cpuop_func op_10ba_5_nf;
 extern cpuop_func op_10ba_5_ff;
-extern cpuop_func op_10bb_5_nf;
 extern cpuop_func op_10bb_5_ff;
-extern cpuop_func op_10bc_5_nf;
 extern cpuop_func op_10bc_5_ff;
-extern cpuop_func op_10c0_5_nf;
 extern cpuop_func op_10c0_5_ff;
-extern cpuop_func op_10c8_5_nf;
 extern cpuop_func op_10c8_5_ff;
-extern cpuop_func op_10d0_5_nf;
 extern cpuop_func op_10d0_5_ff;
-extern cpuop_func op_10d8_5_nf;
 extern cpuop_func op_10d8_5_ff;
-extern cpuop_func op_10e0_5_nf;
 extern cpuop_func op_10e0_5_ff;
-extern cpuop_func op_10e8_5_nf;
 extern cpuop_func op_10e8_5_ff;
-extern cpuop_func op_10f0_5_nf;
 extern cpuop_func op_10f0_5_ff;
-extern cpuop_func op_10f8_5_nf;
 extern cpuop_func op_10f8_5_ff;
-extern cpuop_func op_10f9_5_nf;
 extern cpuop_func op_10f9_5_ff;
-extern cpuop_func op_10fa_5_nf;
 extern cpuop_func op_10fa_5_ff;
-extern cpuop_func op_10fb_5_nf;
 extern cpuop_func op_10fb_5_ff;
-extern cpuop_func op_10fc_5_nf;
 extern cpuop_func op_10fc_5_ff;
-extern cpuop_func op_1100_5_nf;
 extern cpuop_func op_1100_5_ff;
-extern cpuop_func op_1108_5_nf;
 extern cpuop_func op_1108_5_ff;
-extern cpuop_func op_1110_5_nf;
 extern cpuop_func op_1110_5_ff;
-extern cpuop_func op_1118_5_nf;
 extern cpuop_func op_1118_5_ff;
-extern cpuop_func op_1120_5_nf;
 extern cpuop_func op_1120_5_ff;
-extern cpuop_func op_1128_5_nf;
 extern cpuop_func op_1128_5_ff;
-extern cpuop_func op_1130_5_nf;
 extern cpuop_func op_1130_5_ff;
-extern cpuop_func op_1138_5_nf;
 extern cpuop_func op_1138_5_ff;
-extern cpuop_func op_1139_5_nf;
 extern cpuop_func op_1139_5_ff;
-extern cpuop_func op_113a_5_nf;
 extern cpuop_func op_113a_5_ff;
-extern cpuop_func op_113b_5_nf;
 extern cpuop_func op_113b_5_ff;
-extern cpuop_func op_113c_5_nf;
 extern cpuop_func op_113c_5_ff;
-extern cpuop_func op_1140_5_nf;
 extern cpuop_func op_1140_5_ff;
-extern cpuop_func op_1148_5_nf;
 extern cpuop_func op_1148_5_ff;
-extern cpuop_func op_1150_5_nf;
 extern cpuop_func op_1150_5_ff;
-extern cpuop_func op_1158_5_nf;
 extern cpuop_func op_1158_5_ff;
-extern cpuop_func op_1160_5_nf;
 extern cpuop_func op_1160_5_ff;
-extern cpuop_func op_1168_5_nf;
 extern cpuop_func op_1168_5_ff;
-extern cpuop_func op_1170_5_nf;
 extern cpuop_func op_1170_5_ff;
-extern cpuop_func op_1178_5_nf;
 extern cpuop_func op_1178_5_ff;
-extern cpuop_func op_1179_5_nf;
 extern cpuop_func op_1179_5_ff;
-extern cpuop_func op_117a_5_nf;
 extern cpuop_func op_117a_5_ff;
-extern cpuop_func op_117b_5_nf;
 extern cpuop_func op_117b_5_ff;
-extern cpuop_func op_117c_5_nf;
 extern cpuop_func op_117c_5_ff;
-extern cpuop_func op_1180_5_nf;
 extern cpuop_func op_1180_5_ff;
-extern cpuop_func op_1188_5_nf;
 extern cpuop_func op_1188_5_ff;
-extern cpuop_func op_1190_5_nf;
 extern cpuop_func op_1190_5_ff;
-extern cpuop_func op_1198_5_nf;
 extern cpuop_func op_1198_5_ff;
-extern cpuop_func op_11a0_5_nf;
 extern cpuop_func op_11a0_5_ff;
-extern cpuop_func op_11a8_5_nf;
 extern cpuop_func op_11a8_5_ff;
-extern cpuop_func op_11b0_5_nf;
 extern cpuop_func op_11b0_5_ff;
-extern cpuop_func op_11b8_5_nf;
 extern cpuop_func op_11b8_5_ff;
-extern cpuop_func op_11b9_5_nf;
 extern cpuop_func op_11b9_5_ff;
-extern cpuop_func op_11ba_5_nf;
 extern cpuop_func op_11ba_5_ff;
-extern cpuop_func op_11bb_5_nf;
 extern cpuop_func op_11bb_5_ff;
-extern cpuop_func op_11bc_5_nf;
 extern cpuop_func op_11bc_5_ff;
-extern cpuop_func op_11c0_5_nf;
 extern cpuop_func op_11c0_5_ff;
-extern cpuop_func op_11c8_5_nf;
 extern cpuop_func op_11c8_5_ff;
-extern cpuop_func op_11d0_5_nf;
 extern cpuop_func op_11d0_5_ff;
-extern cpuop_func op_11d8_5_nf;
 extern cpuop_func op_11d8_5_ff;
-extern cpuop_func op_11e0_5_nf;
 extern cpuop_func op_11e0_5_ff;
-extern cpuop_func op_11e8_5_nf;
 extern cpuop_func op_11e8_5_ff;
-extern cpuop_func op_11f0_5_nf;
 extern cpuop_func op_11f0_5_ff;
-extern cpuop_func op_11f8_5_nf;
 extern cpuop_func op_11f8_5_ff;
-extern cpuop_func op_11f9_5_nf;
 extern cpuop_func op_11f9_5_ff;
-extern cpuop_func op_11fa_5_nf;
 extern cpuop_func op_11fa_5_ff;
-extern cpuop_func op_11fb_5_nf;
 extern cpuop_func op_11fb_5_ff;
-extern cpuop_func op_11fc_5_nf;
 extern cpuop_func op_11fc_5_ff;
-extern cpuop_func op_13c0_5_nf;
 extern cpuop_func op_13c0_5_ff;
-extern cpuop_func op_13c8_5_nf;
 extern cpuop_func op_13c8_5_ff;
-extern cpuop_func op_13d0_5_nf;
 extern cpuop_func op_13d0_5_ff;
-extern cpuop_func op_13d8_5_nf;
 extern cpuop_func op_13d8_5_ff;
-extern cpuop_func op_13e0_5_nf;
 extern cpuop_func op_13e0_5_ff;
-extern cpuop_func op_13e8_5_nf;
 extern cpuop_func op_13e8_5_ff;
-extern cpuop_func op_13f0_5_nf;
 extern cpuop_func op_13f0_5_ff;
-extern cpuop_func op_13f8_5_nf;
 extern cpuop_func op_13f8_5_ff;
-extern cpuop_func op_13f9_5_nf;
 extern cpuop_func op_13f9_5_ff;
-extern cpuop_func op_13fa_5_nf;
 extern cpuop_func op_13fa_5_ff;
-extern cpuop_func op_13fb_5_nf;
 extern cpuop_func op_13fb_5_ff;
-extern cpuop_func op_13fc_5_nf;
 extern cpuop_func op_13fc_5_ff;
-extern cpuop_func op_2000_5_nf;
 extern cpuop_func op_2000_5_ff;
-extern cpuop_func op_2008_5_nf;
 extern cpuop_func op_2008_5_ff;
-extern cpuop_func op_2010_5_nf;
 extern cpuop_func op_2010_5_ff;
-extern cpuop_func op_2018_5_nf;
 extern cpuop_func op_2018_5_ff;
-extern cpuop_func op_2020_5_nf;
 extern cpuop_func op_2020_5_ff;
-extern cpuop_func op_2028_5_nf;
 extern cpuop_func op_2028_5_ff;
-extern cpuop_func op_2030_5_nf;
 extern cpuop_func op_2030_5_ff;
-extern cpuop_func op_2038_5_nf;
 extern cpuop_func op_2038_5_ff;
-extern cpuop_func op_2039_5_nf;
 extern cpuop_func op_2039_5_ff;
-extern cpuop_func op_203a_5_nf;
 extern cpuop_func op_203a_5_ff;
-extern cpuop_func op_203b_5_nf;
 extern cpuop_func op_203b_5_ff;
-extern cpuop_func op_203c_5_nf;
 extern cpuop_func op_203c_5_ff;
-extern cpuop_func op_2040_5_nf;
 extern cpuop_func op_2040_5_ff;
-extern cpuop_func op_2048_5_nf;
 extern cpuop_func op_2048_5_ff;
-extern cpuop_func op_2050_5_nf;
 extern cpuop_func op_2050_5_ff;
-extern cpuop_func op_2058_5_nf;
 extern cpuop_func op_2058_5_ff;
-extern cpuop_func op_2060_5_nf;
 extern cpuop_func op_2060_5_ff;
-extern cpuop_func op_2068_5_nf;
 extern cpuop_func op_2068_5_ff;
-extern cpuop_func op_2070_5_nf;
 extern cpuop_func op_2070_5_ff;
-extern cpuop_func op_2078_5_nf;
 extern cpuop_func op_2078_5_ff;
-extern cpuop_func op_2079_5_nf;
 extern cpuop_func op_2079_5_ff;
-extern cpuop_func op_207a_5_nf;
 extern cpuop_func op_207a_5_ff;
-extern cpuop_func op_207b_5_nf;
 extern cpuop_func op_207b_5_ff;
-extern cpuop_func op_207c_5_nf;
 extern cpuop_func op_207c_5_ff;
-extern cpuop_func op_2080_5_nf;
 extern cpuop_func op_2080_5_ff;
-extern cpuop_func op_2088_5_nf;
 extern cpuop_func op_2088_5_ff;
-extern cpuop_func op_2090_5_nf;
 extern cpuop_func op_2090_5_ff;
-extern cpuop_func op_2098_5_nf;
 extern cpuop_func op_2098_5_ff;
-extern cpuop_func op_20a0_5_nf;
 extern cpuop_func op_20a0_5_ff;
-extern cpuop_func op_20a8_5_nf;
 extern cpuop_func op_20a8_5_ff;
-extern cpuop_func op_20b0_5_nf;
 extern cpuop_func op_20b0_5_ff;
-extern cpuop_func op_20b8_5_nf;
 extern cpuop_func op_20b8_5_ff;
-extern cpuop_func op_20b9_5_nf;
 extern cpuop_func op_20b9_5_ff;
-extern cpuop_func op_20ba_5_nf;
 extern cpuop_func op_20ba_5_ff;
-extern cpuop_func op_20bb_5_nf;
 extern cpuop_func op_20bb_5_ff;
-extern cpuop_func op_20bc_5_nf;
 extern cpuop_func op_20bc_5_ff;
-extern cpuop_func op_20c0_5_nf;
 extern cpuop_func op_20c0_5_ff;
-extern cpuop_func op_20c8_5_nf;
 extern cpuop_func op_20c8_5_ff;
-extern cpuop_func op_20d0_5_nf;
 extern cpuop_func op_20d0_5_ff;
-extern cpuop_func op_20d8_5_nf;
 extern cpuop_func op_20d8_5_ff;
-extern cpuop_func op_20e0_5_nf;
 extern cpuop_func op_20e0_5_ff;
-extern cpuop_func op_20e8_5_nf;
 extern cpuop_func op_20e8_5_ff;
-extern cpuop_func op_20f0_5_nf;
 extern cpuop_func op_20f0_5_ff;
-extern cpuop_func op_20f8_5_nf;
 extern cpuop_func op_20f8_5_ff;
-extern cpuop_func op_20f9_5_nf;
 extern cpuop_func op_20f9_5_ff;
-extern cpuop_func op_20fa_5_nf;
 extern cpuop_func op_20fa_5_ff;
-extern cpuop_func op_20fb_5_nf;
 extern cpuop_func op_20fb_5_ff;
-extern cpuop_func op_20fc_5_nf;
 extern cpuop_func op_20fc_5_ff;
-extern cpuop_func op_2100_5_nf;
 extern cpuop_func op_2100_5_ff;
-extern cpuop_func op_2108_5_nf;
 extern cpuop_func op_2108_5_ff;
-extern cpuop_func op_2110_5_nf;
 extern cpuop_func op_2110_5_ff;
-extern cpuop_func op_2118_5_nf;
 extern cpuop_func op_2118_5_ff;
-extern cpuop_func op_2120_5_nf;
 extern cpuop_func op_2120_5_ff;
-extern cpuop_func op_2128_5_nf;
 extern cpuop_func op_2128_5_ff;
-extern cpuop_func op_2130_5_nf;
 extern cpuop_func op_2130_5_ff;
-extern cpuop_func op_2138_5_nf;
 extern cpuop_func op_2138_5_ff;
-extern cpuop_func op_2139_5_nf;
 extern cpuop_func op_2139_5_ff;
-extern cpuop_func op_213a_5_nf;
 extern cpuop_func op_213a_5_ff;
-extern cpuop_func op_213b_5_nf;
 extern cpuop_func op_213b_5_ff;
-extern cpuop_func op_213c_5_nf;
 extern cpuop_func op_213c_5_ff;
-extern cpuop_func op_2140_5_nf;
 extern cpuop_func op_2140_5_ff;
-extern cpuop_func op_2148_5_nf;
 extern cpuop_func op_2148_5_ff;
-extern cpuop_func op_2150_5_nf;
 extern cpuop_func op_2150_5_ff;
-extern cpuop_func op_2158_5_nf;
 extern cpuop_func op_2158_5_ff;
-extern cpuop_func op_2160_5_nf;
 extern cpuop_func op_2160_5_ff;
-extern cpuop_func op_2168_5_nf;
 extern cpuop_func op_2168_5_ff;
-extern cpuop_func op_2170_5_nf;
 extern cpuop_func op_2170_5_ff;
-extern cpuop_func op_2178_5_nf;
 extern cpuop_func op_2178_5_ff;
-extern cpuop_func op_2179_5_nf;
 extern cpuop_func op_2179_5_ff;
-extern cpuop_func op_217a_5_nf;
 extern cpuop_func op_217a_5_ff;
-extern cpuop_func op_217b_5_nf;
 extern cpuop_func op_217b_5_ff;
-extern cpuop_func op_217c_5_nf;
 extern cpuop_func op_217c_5_ff;
-extern cpuop_func op_2180_5_nf;
 extern cpuop_func op_2180_5_ff;
-extern cpuop_func op_2188_5_nf;
 extern cpuop_func op_2188_5_ff;
-extern cpuop_func op_2190_5_nf;
 extern cpuop_func op_2190_5_ff;
-extern cpuop_func op_2198_5_nf;
 extern cpuop_func op_2198_5_ff;
-extern cpuop_func op_21a0_5_nf;
 extern cpuop_func op_21a0_5_ff;
-extern cpuop_func op_21a8_5_nf;
 extern cpuop_func op_21a8_5_ff;
-extern cpuop_func op_21b0_5_nf;
 extern cpuop_func op_21b0_5_ff;
-extern cpuop_func op_21b8_5_nf;
 extern cpuop_func op_21b8_5_ff;
-extern cpuop_func op_21b9_5_nf;
 extern cpuop_func op_21b9_5_ff;
-extern cpuop_func op_21ba_5_nf;
 extern cpuop_func op_21ba_5_ff;
-extern cpuop_func op_21bb_5_nf;
 extern cpuop_func op_21bb_5_ff;
-extern cpuop_func op_21bc_5_nf;
 extern cpuop_func op_21bc_5_ff;
-extern cpuop_func op_21c0_5_nf;
 extern cpuop_func op_21c0_5_ff;
-extern cpuop_func op_21c8_5_nf;
 extern cpuop_func op_21c8_5_ff;
-extern cpuop_func op_21d0_5_nf;
 extern cpuop_func op_21d0_5_ff;
-extern cpuop_func op_21d8_5_nf;
 extern cpuop_func op_21d8_5_ff;
-extern cpuop_func op_21e0_5_nf;
 extern cpuop_func op_21e0_5_ff;
-extern cpuop_func op_21e8_5_nf;
 extern cpuop_func op_21e8_5_ff;
-extern cpuop_func op_21f0_5_nf;
 extern cpuop_func op_21f0_5_ff;
-extern cpuop_func op_21f8_5_nf;
 extern cpuop_func op_21f8_5_ff;
-extern cpuop_func op_21f9_5_nf;
 extern cpuop_func op_21f9_5_ff;
-extern cpuop_func op_21fa_5_nf;
 extern cpuop_func op_21fa_5_ff;
-extern cpuop_func op_21fb_5_nf;
 extern cpuop_func op_21fb_5_ff;
-extern cpuop_func op_21fc_5_nf;
 extern cpuop_func op_21fc_5_ff;
-extern cpuop_func op_23c0_5_nf;
 extern cpuop_func op_23c0_5_ff;
-extern cpuop_func op_23c8_5_nf;
 extern cpuop_func op_23c8_5_ff;
-extern cpuop_func op_23d0_5_nf;
 extern cpuop_func op_23d0_5_ff;
-extern cpuop_func op_23d8_5_nf;
 extern cpuop_func op_23d8_5_ff;
-extern cpuop_func op_23e0_5_nf;
 extern cpuop_func op_23e0_5_ff;
-extern cpuop_func op_23e8_5_nf;
 extern cpuop_func op_23e8_5_ff;
-extern cpuop_func op_23f0_5_nf;
 extern cpuop_func op_23f0_5_ff;
-extern cpuop_func op_23f8_5_nf;
 extern cpuop_func op_23f8_5_ff;
-extern cpuop_func op_23f9_5_nf;
 extern cpuop_func op_23f9_5_ff;
-extern cpuop_func op_23fa_5_nf;
 extern cpuop_func op_23fa_5_ff;
-extern cpuop_func op_23fb_5_nf;
 extern cpuop_func op_23fb_5_ff;
-extern cpuop_func op_23fc_5_nf;
 extern cpuop_func op_23fc_5_ff;
-extern cpuop_func op_3000_5_nf;
 extern cpuop_func op_3000_5_ff;
-extern cpuop_func op_3008_5_nf;
 extern cpuop_func op_3008_5_ff;
-extern cpuop_func op_3010_5_nf;
 extern cpuop_func op_3010_5_ff;
-extern cpuop_func op_3018_5_nf;
 extern cpuop_func op_3018_5_ff;
-extern cpuop_func op_3020_5_nf;
 extern cpuop_func op_3020_5_ff;
-extern cpuop_func op_3028_5_nf;
 extern cpuop_func op_3028_5_ff;
-extern cpuop_func op_3030_5_nf;
 extern cpuop_func op_3030_5_ff;
-extern cpuop_func op_3038_5_nf;
 extern cpuop_func op_3038_5_ff;
-extern cpuop_func op_3039_5_nf;
 extern cpuop_func op_3039_5_ff;
-extern cpuop_func op_303a_5_nf;
 extern cpuop_func op_303a_5_ff;
-extern cpuop_func op_303b_5_nf;
 extern cpuop_func op_303b_5_ff;
-extern cpuop_func op_303c_5_nf;
 extern cpuop_func op_303c_5_ff;
-extern cpuop_func op_3040_5_nf;
 extern cpuop_func op_3040_5_ff;
-extern cpuop_func op_3048_5_nf;
 extern cpuop_func op_3048_5_ff;
-extern cpuop_func op_3050_5_nf;
 extern cpuop_func op_3050_5_ff;
-extern cpuop_func op_3058_5_nf;
 extern cpuop_func op_3058_5_ff;
-extern cpuop_func op_3060_5_nf;
 extern cpuop_func op_3060_5_ff;
-extern cpuop_func op_3068_5_nf;
 extern cpuop_func op_3068_5_ff;
-extern cpuop_func op_3070_5_nf;
 extern cpuop_func op_3070_5_ff;
-extern cpuop_func op_3078_5_nf;
 extern cpuop_func op_3078_5_ff;
-extern cpuop_func op_3079_5_nf;
 extern cpuop_func op_3079_5_ff;
-extern cpuop_func op_307a_5_nf;
 extern cpuop_func op_307a_5_ff;
-extern cpuop_func op_307b_5_nf;
 extern cpuop_func op_307b_5_ff;
-extern cpuop_func op_307c_5_nf;
 extern cpuop_func op_307c_5_ff;
-extern cpuop_func op_3080_5_nf;
 extern cpuop_func op_3080_5_ff;
-extern cpuop_func op_3088_5_nf;
 extern cpuop_func op_3088_5_ff;
-extern cpuop_func op_3090_5_nf;
 extern cpuop_func op_3090_5_ff;
-extern cpuop_func op_3098_5_nf;
 extern cpuop_func op_3098_5_ff;
-extern cpuop_func op_30a0_5_nf;
 extern cpuop_func op_30a0_5_ff;
-extern cpuop_func op_30a8_5_nf;
 extern cpuop_func op_30a8_5_ff;
-extern cpuop_func op_30b0_5_nf;
 extern cpuop_func op_30b0_5_ff;
-extern cpuop_func op_30b8_5_nf;
 extern cpuop_func op_30b8_5_ff;
-extern cpuop_func op_30b9_5_nf;
 extern cpuop_func op_30b9_5_ff;
-extern cpuop_func op_30ba_5_nf;
 extern cpuop_func op_30ba_5_ff;
-extern cpuop_func op_30bb_5_nf;
 extern cpuop_func op_30bb_5_ff;
-extern cpuop_func op_30bc_5_nf;
 extern cpuop_func op_30bc_5_ff;
-extern cpuop_func op_30c0_5_nf;
 extern cpuop_func op_30c0_5_ff;
-extern cpuop_func op_30c8_5_nf;
 extern cpuop_func op_30c8_5_ff;
-extern cpuop_func op_30d0_5_nf;
 extern cpuop_func op_30d0_5_ff;
-extern cpuop_func op_30d8_5_nf;
 extern cpuop_func op_30d8_5_ff;
-extern cpuop_func op_30e0_5_nf;
 extern cpuop_func op_30e0_5_ff;
-extern cpuop_func op_30e8_5_nf;
 extern cpuop_func op_30e8_5_ff;
-extern cpuop_func op_30f0_5_nf;
 extern cpuop_func op_30f0_5_ff;
-extern cpuop_func op_30f8_5_nf;
 extern cpuop_func op_30f8_5_ff;
-extern cpuop_func op_30f9_5_nf;
 extern cpuop_func op_30f9_5_ff;
-extern cpuop_func op_30fa_5_nf;
 extern cpuop_func op_30fa_5_ff;
-extern cpuop_func op_30fb_5_nf;
 extern cpuop_func op_30fb_5_ff;
-extern cpuop_func op_30fc_5_nf;
 extern cpuop_func op_30fc_5_ff;
-extern cpuop_func op_3100_5_nf;
 extern cpuop_func op_3100_5_ff;
-extern cpuop_func op_3108_5_nf;
 extern cpuop_func op_3108_5_ff;
-extern cpuop_func op_3110_5_nf;
 extern cpuop_func op_3110_5_ff;
-extern cpuop_func op_3118_5_nf;
 extern cpuop_func op_3118_5_ff;
-extern cpuop_func op_3120_5_nf;
 extern cpuop_func op_3120_5_ff;
-extern cpuop_func op_3128_5_nf;
 extern cpuop_func op_3128_5_ff;
-extern cpuop_func op_3130_5_nf;
 extern cpuop_func op_3130_5_ff;
-extern cpuop_func op_3138_5_nf;
 extern cpuop_func op_3138_5_ff;
-extern cpuop_func op_3139_5_nf;
 extern cpuop_func op_3139_5_ff;
-extern cpuop_func op_313a_5_nf;
 extern cpuop_func op_313a_5_ff;
-extern cpuop_func op_313b_5_nf;
 extern cpuop_func op_313b_5_ff;
-extern cpuop_func op_313c_5_nf;
 extern cpuop_func op_313c_5_ff;
-extern cpuop_func op_3140_5_nf;
 extern cpuop_func op_3140_5_ff;
-extern cpuop_func op_3148_5_nf;
 extern cpuop_func op_3148_5_ff;
-extern cpuop_func op_3150_5_nf;
 extern cpuop_func op_3150_5_ff;
-extern cpuop_func op_3158_5_nf;
 extern cpuop_func op_3158_5_ff;
-extern cpuop_func op_3160_5_nf;
 extern cpuop_func op_3160_5_ff;
-extern cpuop_func op_3168_5_nf;
 extern cpuop_func op_3168_5_ff;
-extern cpuop_func op_3170_5_nf;
 extern cpuop_func op_3170_5_ff;
-extern cpuop_func op_3178_5_nf;
 extern cpuop_func op_3178_5_ff;
-extern cpuop_func op_3179_5_nf;
 extern cpuop_func op_3179_5_ff;
-extern cpuop_func op_317a_5_nf;
 extern cpuop_func op_317a_5_ff;
-extern cpuop_func op_317b_5_nf;
 extern cpuop_func op_317b_5_ff;
-extern cpuop_func op_317c_5_nf;
 extern cpuop_func op_317c_5_ff;
-extern cpuop_func op_3180_5_nf;
 extern cpuop_func op_3180_5_ff;
-extern cpuop_func op_3188_5_nf;
 extern cpuop_func op_3188_5_ff;
-extern cpuop_func op_3190_5_nf;
 extern cpuop_func op_3190_5_ff;
-extern cpuop_func op_3198_5_nf;
 extern cpuop_func op_3198_5_ff;
-extern cpuop_func op_31a0_5_nf;
 extern cpuop_func op_31a0_5_ff;
-extern cpuop_func op_31a8_5_nf;
 extern cpuop_func op_31a8_5_ff;
-extern cpuop_func op_31b0_5_nf;
 extern cpuop_func op_31b0_5_ff;
-extern cpuop_func op_31b8_5_nf;
 extern cpuop_func op_31b8_5_ff;
-extern cpuop_func op_31b9_5_nf;
 extern cpuop_func op_31b9_5_ff;
-extern cpuop_func op_31ba_5_nf;
 extern cpuop_func op_31ba_5_ff;
-extern cpuop_func op_31bb_5_nf;
 extern cpuop_func op_31bb_5_ff;
-extern cpuop_func op_31bc_5_nf;
 extern cpuop_func op_31bc_5_ff;
-extern cpuop_func op_31c0_5_nf;
 extern cpuop_func op_31c0_5_ff;
-extern cpuop_func op_31c8_5_nf;
 extern cpuop_func op_31c8_5_ff;
-extern cpuop_func op_31d0_5_nf;
 extern cpuop_func op_31d0_5_ff;
-extern cpuop_func op_31d8_5_nf;
 extern cpuop_func op_31d8_5_ff;
-extern cpuop_func op_31e0_5_nf;
 extern cpuop_func op_31e0_5_ff;
-extern cpuop_func op_31e8_5_nf;
 extern cpuop_func op_31e8_5_ff;
-extern cpuop_func op_31f0_5_nf;
 extern cpuop_func op_31f0_5_ff;
-extern cpuop_func op_31f8_5_nf;
 extern cpuop_func op_31f8_5_ff;
-extern cpuop_func op_31f9_5_nf;
 extern cpuop_func op_31f9_5_ff;
-extern cpuop_func op_31fa_5_nf;
 extern cpuop_func op_31fa_5_ff;
-extern cpuop_func op_31fb_5_nf;
 extern cpuop_func op_31fb_5_ff;
-extern cpuop_func op_31fc_5_nf;
 extern cpuop_func op_31fc_5_ff;
-extern cpuop_func op_33c0_5_nf;
 extern cpuop_func op_33c0_5_ff;
-extern cpuop_func op_33c8_5_nf;
 extern cpuop_func op_33c8_5_ff;
-extern cpuop_func op_33d0_5_nf;
 extern cpuop_func op_33d0_5_ff;
-extern cpuop_func op_33d8_5_nf;
 extern cpuop_func op_33d8_5_ff;
-extern cpuop_func op_33e0_5_nf;
 extern cpuop_func op_33e0_5_ff;
-extern cpuop_func op_33e8_5_nf;
 extern cpuop_func op_33e8_5_ff;
-extern cpuop_func op_33f0_5_nf;
 extern cpuop_func op_33f0_5_ff;
-extern cpuop_func op_33f8_5_nf;
 extern cpuop_func op_33f8_5_ff;
-extern cpuop_func op_33f9_5_nf;
 extern cpuop_func op_33f9_5_ff;
-extern cpuop_func op_33fa_5_nf;
 extern cpuop_func op_33fa_5_ff;
-extern cpuop_func op_33fb_5_nf;
 extern cpuop_func op_33fb_5_ff;
-extern cpuop_func op_33fc_5_nf;
 extern cpuop_func op_33fc_5_ff;
-extern cpuop_func op_4000_5_nf;
 extern cpuop_func op_4000_5_ff;
-extern cpuop_func op_4010_5_nf;
 extern cpuop_func op_4010_5_ff;
-extern cpuop_func op_4018_5_nf;
 extern cpuop_func op_4018_5_ff;
-extern cpuop_func op_4020_5_nf;
 extern cpuop_func op_4020_5_ff;
-extern cpuop_func op_4028_5_nf;
 extern cpuop_func op_4028_5_ff;
-extern cpuop_func op_4030_5_nf;
 extern cpuop_func op_4030_5_ff;
-extern cpuop_func op_4038_5_nf;
 extern cpuop_func op_4038_5_ff;
-extern cpuop_func op_4039_5_nf;
 extern cpuop_func op_4039_5_ff;
-extern cpuop_func op_4040_5_nf;
 extern cpuop_func op_4040_5_ff;
-extern cpuop_func op_4050_5_nf;
 extern cpuop_func op_4050_5_ff;
-extern cpuop_func op_4058_5_nf;
 extern cpuop_func op_4058_5_ff;
-extern cpuop_func op_4060_5_nf;
 extern cpuop_func op_4060_5_ff;
-extern cpuop_func op_4068_5_nf;
 extern cpuop_func op_4068_5_ff;
-extern cpuop_func op_4070_5_nf;
 extern cpuop_func op_4070_5_ff;
-extern cpuop_func op_4078_5_nf;
 extern cpuop_func op_4078_5_ff;
-extern cpuop_func op_4079_5_nf;
 extern cpuop_func op_4079_5_ff;
-extern cpuop_func op_4080_5_nf;
 extern cpuop_func op_4080_5_ff;
-extern cpuop_func op_4090_5_nf;
 extern cpuop_func op_4090_5_ff;
-extern cpuop_func op_4098_5_nf;
 extern cpuop_func op_4098_5_ff;
-extern cpuop_func op_40a0_5_nf;
 extern cpuop_func op_40a0_5_ff;
-extern cpuop_func op_40a8_5_nf;
 extern cpuop_func op_40a8_5_ff;
-extern cpuop_func op_40b0_5_nf;
 extern cpuop_func op_40b0_5_ff;
-extern cpuop_func op_40b8_5_nf;
 extern cpuop_func op_40b8_5_ff;
-extern cpuop_func op_40b9_5_nf;
 extern cpuop_func op_40b9_5_ff;
-extern cpuop_func op_40c0_5_nf;
 extern cpuop_func op_40c0_5_ff;
-extern cpuop_func op_40d0_5_nf;
 extern cpuop_func op_40d0_5_ff;
-extern cpuop_func op_40d8_5_nf;
 extern cpuop_func op_40d8_5_ff;
-extern cpuop_func op_40e0_5_nf;
 extern cpuop_func op_40e0_5_ff;
-extern cpuop_func op_40e8_5_nf;
 extern cpuop_func op_40e8_5_ff;
-extern cpuop_func op_40f0_5_nf;
 extern cpuop_func op_40f0_5_ff;
-extern cpuop_func op_40f8_5_nf;
 extern cpuop_func op_40f8_5_ff;
-extern cpuop_func op_40f9_5_nf;
 extern cpuop_func op_40f9_5_ff;
-extern cpuop_func op_4180_5_nf;
 extern cpuop_func op_4180_5_ff;
-extern cpuop_func op_4190_5_nf;
 extern cpuop_func op_4190_5_ff;
-extern cpuop_func op_4198_5_nf;
 extern cpuop_func op_4198_5_ff;
-extern cpuop_func op_41a0_5_nf;
 extern cpuop_func op_41a0_5_ff;
-extern cpuop_func op_41a8_5_nf;
 extern cpuop_func op_41a8_5_ff;
-extern cpuop_func op_41b0_5_nf;
 extern cpuop_func op_41b0_5_ff;
-extern cpuop_func op_41b8_5_nf;
 extern cpuop_func op_41b8_5_ff;
-extern cpuop_func op_41b9_5_nf;
 extern cpuop_func op_41b9_5_ff;
-extern cpuop_func op_41ba_5_nf;
 extern cpuop_func op_41ba_5_ff;
-extern cpuop_func op_41bb_5_nf;
 extern cpuop_func op_41bb_5_ff;
-extern cpuop_func op_41bc_5_nf;
 extern cpuop_func op_41bc_5_ff;
-extern cpuop_func op_41d0_5_nf;
 extern cpuop_func op_41d0_5_ff;
-extern cpuop_func op_41e8_5_nf;
 extern cpuop_func op_41e8_5_ff;
-extern cpuop_func op_41f0_5_nf;
 extern cpuop_func op_41f0_5_ff;
-extern cpuop_func op_41f8_5_nf;
 extern cpuop_func op_41f8_5_ff;
-extern cpuop_func op_41f9_5_nf;
 extern cpuop_func op_41f9_5_ff;
-extern cpuop_func op_41fa_5_nf;
 extern cpuop_func op_41fa_5_ff;
-extern cpuop_func op_41fb_5_nf;
 extern cpuop_func op_41fb_5_ff;
-extern cpuop_func op_4200_5_nf;
 extern cpuop_func op_4200_5_ff;
-extern cpuop_func op_4210_5_nf;
 extern cpuop_func op_4210_5_ff;
-extern cpuop_func op_4218_5_nf;
 extern cpuop_func op_4218_5_ff;
-extern cpuop_func op_4220_5_nf;
 extern cpuop_func op_4220_5_ff;
-extern cpuop_func op_4228_5_nf;
 extern cpuop_func op_4228_5_ff;
-extern cpuop_func op_4230_5_nf;
 extern cpuop_func op_4230_5_ff;
-extern cpuop_func op_4238_5_nf;
 extern cpuop_func op_4238_5_ff;
-extern cpuop_func op_4239_5_nf;
 extern cpuop_func op_4239_5_ff;
-extern cpuop_func op_4240_5_nf;
 extern cpuop_func op_4240_5_ff;
-extern cpuop_func op_4250_5_nf;
 extern cpuop_func op_4250_5_ff;
-extern cpuop_func op_4258_5_nf;
 extern cpuop_func op_4258_5_ff;
-extern cpuop_func op_4260_5_nf;
 extern cpuop_func op_4260_5_ff;
-extern cpuop_func op_4268_5_nf;
 extern cpuop_func op_4268_5_ff;
-extern cpuop_func op_4270_5_nf;
 extern cpuop_func op_4270_5_ff;
-extern cpuop_func op_4278_5_nf;
 extern cpuop_func op_4278_5_ff;
-extern cpuop_func op_4279_5_nf;
 extern cpuop_func op_4279_5_ff;
-extern cpuop_func op_4280_5_nf;
 extern cpuop_func op_4280_5_ff;
-extern cpuop_func op_4290_5_nf;
 extern cpuop_func op_4290_5_ff;
-extern cpuop_func op_4298_5_nf;
 extern cpuop_func op_4298_5_ff;
-extern cpuop_func op_42a0_5_nf;
 extern cpuop_func op_42a0_5_ff;
-extern cpuop_func op_42a8_5_nf;
 extern cpuop_func op_42a8_5_ff;
-extern cpuop_func op_42b0_5_nf;
 extern cpuop_func op_42b0_5_ff;
-extern cpuop_func op_42b8_5_nf;
 extern cpuop_func op_42b8_5_ff;
-extern cpuop_func op_42b9_5_nf;
 extern cpuop_func op_42b9_5_ff;
-extern cpuop_func op_4400_5_nf;
 extern cpuop_func op_4400_5_ff;
-extern cpuop_func op_4410_5_nf;
 extern cpuop_func op_4410_5_ff;
-extern cpuop_func op_4418_5_nf;
 extern cpuop_func op_4418_5_ff;
-extern cpuop_func op_4420_5_nf;
 extern cpuop_func op_4420_5_ff;
-extern cpuop_func op_4428_5_nf;
 extern cpuop_func op_4428_5_ff;
-extern cpuop_func op_4430_5_nf;
 extern cpuop_func op_4430_5_ff;
-extern cpuop_func op_4438_5_nf;
 extern cpuop_func op_4438_5_ff;
-extern cpuop_func op_4439_5_nf;
 extern cpuop_func op_4439_5_ff;
-extern cpuop_func op_4440_5_nf;
 extern cpuop_func op_4440_5_ff;
-extern cpuop_func op_4450_5_nf;
 extern cpuop_func op_4450_5_ff;
-extern cpuop_func op_4458_5_nf;
 extern cpuop_func op_4458_5_ff;
-extern cpuop_func op_4460_5_nf;
 extern cpuop_func op_4460_5_ff;
-extern cpuop_func op_4468_5_nf;
 extern cpuop_func op_4468_5_ff;
-extern cpuop_func op_4470_5_nf;
 extern cpuop_func op_4470_5_ff;
-extern cpuop_func op_4478_5_nf;
 extern cpuop_func op_4478_5_ff;
-extern cpuop_func op_4479_5_nf;
 extern cpuop_func op_4479_5_ff;
-extern cpuop_func op_4480_5_nf;
 extern cpuop_func op_4480_5_ff;
-extern cpuop_func op_4490_5_nf;
 extern cpuop_func op_4490_5_ff;
-extern cpuop_func op_4498_5_nf;
 extern cpuop_func op_4498_5_ff;
-extern cpuop_func op_44a0_5_nf;
 extern cpuop_func op_44a0_5_ff;
-extern cpuop_func op_44a8_5_nf;
 extern cpuop_func op_44a8_5_ff;
-extern cpuop_func op_44b0_5_nf;
 extern cpuop_func op_44b0_5_ff;
-extern cpuop_func op_44b8_5_nf;
 extern cpuop_func op_44b8_5_ff;
-extern cpuop_func op_44b9_5_nf;
 extern cpuop_func op_44b9_5_ff;
-extern cpuop_func op_44c0_5_nf;
 extern cpuop_func op_44c0_5_ff;
-extern cpuop_func op_44d0_5_nf;
 extern cpuop_func op_44d0_5_ff;
-extern cpuop_func op_44d8_5_nf;
 extern cpuop_func op_44d8_5_ff;
-extern cpuop_func op_44e0_5_nf;
 extern cpuop_func op_44e0_5_ff;
-extern cpuop_func op_44e8_5_nf;
 extern cpuop_func op_44e8_5_ff;
-extern cpuop_func op_44f0_5_nf;
 extern cpuop_func op_44f0_5_ff;
-extern cpuop_func op_44f8_5_nf;
 extern cpuop_func op_44f8_5_ff;
-extern cpuop_func op_44f9_5_nf;
 extern cpuop_func op_44f9_5_ff;
-extern cpuop_func op_44fa_5_nf;
 extern cpuop_func op_44fa_5_ff;
-extern cpuop_func op_44fb_5_nf;
 extern cpuop_func op_44fb_5_ff;
-extern cpuop_func op_44fc_5_nf;
 extern cpuop_func op_44fc_5_ff;
-extern cpuop_func op_4600_5_nf;
 extern cpuop_func op_4600_5_ff;
-extern cpuop_func op_4610_5_nf;
 extern cpuop_func op_4610_5_ff;
-extern cpuop_func op_4618_5_nf;
 extern cpuop_func op_4618_5_ff;
-extern cpuop_func op_4620_5_nf;
 extern cpuop_func op_4620_5_ff;
-extern cpuop_func op_4628_5_nf;
 extern cpuop_func op_4628_5_ff;
-extern cpuop_func op_4630_5_nf;
 extern cpuop_func op_4630_5_ff;
-extern cpuop_func op_4638_5_nf;
 extern cpuop_func op_4638_5_ff;
-extern cpuop_func op_4639_5_nf;
 extern cpuop_func op_4639_5_ff;
-extern cpuop_func op_4640_5_nf;
 extern cpuop_func op_4640_5_ff;
-extern cpuop_func op_4650_5_nf;
 extern cpuop_func op_4650_5_ff;
-extern cpuop_func op_4658_5_nf;
 extern cpuop_func op_4658_5_ff;
-extern cpuop_func op_4660_5_nf;
 extern cpuop_func op_4660_5_ff;
-extern cpuop_func op_4668_5_nf;
 extern cpuop_func op_4668_5_ff;
-extern cpuop_func op_4670_5_nf;
 extern cpuop_func op_4670_5_ff;
-extern cpuop_func op_4678_5_nf;
 extern cpuop_func op_4678_5_ff;
-extern cpuop_func op_4679_5_nf;
 extern cpuop_func op_4679_5_ff;
-extern cpuop_func op_4680_5_nf;
 extern cpuop_func op_4680_5_ff;
-extern cpuop_func op_4690_5_nf;
 extern cpuop_func op_4690_5_ff;
-extern cpuop_func op_4698_5_nf;
 extern cpuop_func op_4698_5_ff;
-extern cpuop_func op_46a0_5_nf;
 extern cpuop_func op_46a0_5_ff;
-extern cpuop_func op_46a8_5_nf;
 extern cpuop_func op_46a8_5_ff;
-extern cpuop_func op_46b0_5_nf;
 extern cpuop_func op_46b0_5_ff;
-extern cpuop_func op_46b8_5_nf;
 extern cpuop_func op_46b8_5_ff;
-extern cpuop_func op_46b9_5_nf;
 extern cpuop_func op_46b9_5_ff;
-extern cpuop_func op_46c0_5_nf;
 extern cpuop_func op_46c0_5_ff;
-extern cpuop_func op_46d0_5_nf;
 extern cpuop_func op_46d0_5_ff;
-extern cpuop_func op_46d8_5_nf;
 extern cpuop_func op_46d8_5_ff;
-extern cpuop_func op_46e0_5_nf;
 extern cpuop_func op_46e0_5_ff;
-extern cpuop_func op_46e8_5_nf;
 extern cpuop_func op_46e8_5_ff;
-extern cpuop_func op_46f0_5_nf;
 extern cpuop_func op_46f0_5_ff;
-extern cpuop_func op_46f8_5_nf;
 extern cpuop_func op_46f8_5_ff;
-extern cpuop_func op_46f9_5_nf;
 extern cpuop_func op_46f9_5_ff;
-extern cpuop_func op_46fa_5_nf;
 extern cpuop_func op_46fa_5_ff;
-extern cpuop_func op_46fb_5_nf;
 extern cpuop_func op_46fb_5_ff;
-extern cpuop_func op_46fc_5_nf;
 extern cpuop_func op_46fc_5_ff;
-extern cpuop_func op_4800_5_nf;
 extern cpuop_func op_4800_5_ff;
-extern cpuop_func op_4810_5_nf;
 extern cpuop_func op_4810_5_ff;
-extern cpuop_func op_4818_5_nf;
 extern cpuop_func op_4818_5_ff;
-extern cpuop_func op_4820_5_nf;
 extern cpuop_func op_4820_5_ff;
-extern cpuop_func op_4828_5_nf;
 extern cpuop_func op_4828_5_ff;
-extern cpuop_func op_4830_5_nf;
 extern cpuop_func op_4830_5_ff;
-extern cpuop_func op_4838_5_nf;
 extern cpuop_func op_4838_5_ff;
-extern cpuop_func op_4839_5_nf;
 extern cpuop_func op_4839_5_ff;
-extern cpuop_func op_4840_5_nf;
 extern cpuop_func op_4840_5_ff;
-extern cpuop_func op_4850_5_nf;
 extern cpuop_func op_4850_5_ff;
-extern cpuop_func op_4868_5_nf;
 extern cpuop_func op_4868_5_ff;
-extern cpuop_func op_4870_5_nf;
 extern cpuop_func op_4870_5_ff;
-extern cpuop_func op_4878_5_nf;
 extern cpuop_func op_4878_5_ff;
-extern cpuop_func op_4879_5_nf;
 extern cpuop_func op_4879_5_ff;
-extern cpuop_func op_487a_5_nf;
 extern cpuop_func op_487a_5_ff;
-extern cpuop_func op_487b_5_nf;
 extern cpuop_func op_487b_5_ff;
-extern cpuop_func op_4880_5_nf;
 extern cpuop_func op_4880_5_ff;
-extern cpuop_func op_4890_5_nf;
 extern cpuop_func op_4890_5_ff;
-extern cpuop_func op_48a0_5_nf;
 extern cpuop_func op_48a0_5_ff;
-extern cpuop_func op_48a8_5_nf;
 extern cpuop_func op_48a8_5_ff;
-extern cpuop_func op_48b0_5_nf;
 extern cpuop_func op_48b0_5_ff;
-extern cpuop_func op_48b8_5_nf;
 extern cpuop_func op_48b8_5_ff;
-extern cpuop_func op_48b9_5_nf;
 extern cpuop_func op_48b9_5_ff;
-extern cpuop_func op_48c0_5_nf;
 extern cpuop_func op_48c0_5_ff;
-extern cpuop_func op_48d0_5_nf;
 extern cpuop_func op_48d0_5_ff;
-extern cpuop_func op_48e0_5_nf;
 extern cpuop_func op_48e0_5_ff;
-extern cpuop_func op_48e8_5_nf;
 extern cpuop_func op_48e8_5_ff;
-extern cpuop_func op_48f0_5_nf;
 extern cpuop_func op_48f0_5_ff;
-extern cpuop_func op_48f8_5_nf;
 extern cpuop_func op_48f8_5_ff;
-extern cpuop_func op_48f9_5_nf;
 extern cpuop_func op_48f9_5_ff;
-extern cpuop_func op_4a00_5_nf;
 extern cpuop_func op_4a00_5_ff;
-extern cpuop_func op_4a10_5_nf;
 extern cpuop_func op_4a10_5_ff;
-extern cpuop_func op_4a18_5_nf;
 extern cpuop_func op_4a18_5_ff;
-extern cpuop_func op_4a20_5_nf;
 extern cpuop_func op_4a20_5_ff;
-extern cpuop_func op_4a28_5_nf;
 extern cpuop_func op_4a28_5_ff;
-extern cpuop_func op_4a30_5_nf;
 extern cpuop_func op_4a30_5_ff;
-extern cpuop_func op_4a38_5_nf;
 extern cpuop_func op_4a38_5_ff;
-extern cpuop_func op_4a39_5_nf;
 extern cpuop_func op_4a39_5_ff;
-extern cpuop_func op_4a3a_5_nf;
 extern cpuop_func op_4a3a_5_ff;
-extern cpuop_func op_4a3b_5_nf;
 extern cpuop_func op_4a3b_5_ff;
-extern cpuop_func op_4a3c_5_nf;
 extern cpuop_func op_4a3c_5_ff;
-extern cpuop_func op_4a40_5_nf;
 extern cpuop_func op_4a40_5_ff;
-extern cpuop_func op_4a48_5_nf;
 extern cpuop_func op_4a48_5_ff;
-extern cpuop_func op_4a50_5_nf;
 extern cpuop_func op_4a50_5_ff;
-extern cpuop_func op_4a58_5_nf;
 extern cpuop_func op_4a58_5_ff;
-extern cpuop_func op_4a60_5_nf;
 extern cpuop_func op_4a60_5_ff;
-extern cpuop_func op_4a68_5_nf;
 extern cpuop_func op_4a68_5_ff;
-extern cpuop_func op_4a70_5_nf;
 extern cpuop_func op_4a70_5_ff;
-extern cpuop_func op_4a78_5_nf;
 extern cpuop_func op_4a78_5_ff;
-extern cpuop_func op_4a79_5_nf;
 extern cpuop_func op_4a79_5_ff;
-extern cpuop_func op_4a7a_5_nf;
 extern cpuop_func op_4a7a_5_ff;
-extern cpuop_func op_4a7b_5_nf;
 extern cpuop_func op_4a7b_5_ff;
-extern cpuop_func op_4a7c_5_nf;
 extern cpuop_func op_4a7c_5_ff;
-extern cpuop_func op_4a80_5_nf;
 extern cpuop_func op_4a80_5_ff;
-extern cpuop_func op_4a88_5_nf;
 extern cpuop_func op_4a88_5_ff;
-extern cpuop_func op_4a90_5_nf;
 extern cpuop_func op_4a90_5_ff;
-extern cpuop_func op_4a98_5_nf;
 extern cpuop_func op_4a98_5_ff;
-extern cpuop_func op_4aa0_5_nf;
 extern cpuop_func op_4aa0_5_ff;
-extern cpuop_func op_4aa8_5_nf;
 extern cpuop_func op_4aa8_5_ff;
-extern cpuop_func op_4ab0_5_nf;
 extern cpuop_func op_4ab0_5_ff;
-extern cpuop_func op_4ab8_5_nf;
 extern cpuop_func op_4ab8_5_ff;
-extern cpuop_func op_4ab9_5_nf;
 extern cpuop_func op_4ab9_5_ff;
-extern cpuop_func op_4aba_5_nf;
 extern cpuop_func op_4aba_5_ff;
-extern cpuop_func op_4abb_5_nf;
 extern cpuop_func op_4abb_5_ff;
-extern cpuop_func op_4abc_5_nf;
 extern cpuop_func op_4abc_5_ff;
-extern cpuop_func op_4ac0_5_nf;
 extern cpuop_func op_4ac0_5_ff;
-extern cpuop_func op_4ad0_5_nf;
 extern cpuop_func op_4ad0_5_ff;
-extern cpuop_func op_4ad8_5_nf;
 extern cpuop_func op_4ad8_5_ff;
-extern cpuop_func op_4ae0_5_nf;
 extern cpuop_func op_4ae0_5_ff;
-extern cpuop_func op_4ae8_5_nf;
 extern cpuop_func op_4ae8_5_ff;
-extern cpuop_func op_4af0_5_nf;
 extern cpuop_func op_4af0_5_ff;
-extern cpuop_func op_4af8_5_nf;
 extern cpuop_func op_4af8_5_ff;
-extern cpuop_func op_4af9_5_nf;
 extern cpuop_func op_4af9_5_ff;
-extern cpuop_func op_4c90_5_nf;
 extern cpuop_func op_4c90_5_ff;
-extern cpuop_func op_4c98_5_nf;
 extern cpuop_func op_4c98_5_ff;
-extern cpuop_func op_4ca8_5_nf;
 extern cpuop_func op_4ca8_5_ff;
-extern cpuop_func op_4cb0_5_nf;
 extern cpuop_func op_4cb0_5_ff;
-extern cpuop_func op_4cb8_5_nf;
 extern cpuop_func op_4cb8_5_ff;
-extern cpuop_func op_4cb9_5_nf;
 extern cpuop_func op_4cb9_5_ff;
-extern cpuop_func op_4cba_5_nf;
 extern cpuop_func op_4cba_5_ff;
-extern cpuop_func op_4cbb_5_nf;
 extern cpuop_func op_4cbb_5_ff;
-extern cpuop_func op_4cd0_5_nf;
 extern cpuop_func op_4cd0_5_ff;
-extern cpuop_func op_4cd8_5_nf;
 extern cpuop_func op_4cd8_5_ff;
-extern cpuop_func op_4ce8_5_nf;
 extern cpuop_func op_4ce8_5_ff;
-extern cpuop_func op_4cf0_5_nf;
 extern cpuop_func op_4cf0_5_ff;
-extern cpuop_func op_4cf8_5_nf;
 extern cpuop_func op_4cf8_5_ff;
-extern cpuop_func op_4cf9_5_nf;
 extern cpuop_func op_4cf9_5_ff;
-extern cpuop_func op_4cfa_5_nf;
 extern cpuop_func op_4cfa_5_ff;
-extern cpuop_func op_4cfb_5_nf;
 extern cpuop_func op_4cfb_5_ff;
-extern cpuop_func op_4e40_5_nf;
 extern cpuop_func op_4e40_5_ff;
-extern cpuop_func op_4e50_5_nf;
 extern cpuop_func op_4e50_5_ff;
-extern cpuop_func op_4e58_5_nf;
 extern cpuop_func op_4e58_5_ff;
-extern cpuop_func op_4e60_5_nf;
 extern cpuop_func op_4e60_5_ff;
-extern cpuop_func op_4e68_5_nf;
 extern cpuop_func op_4e68_5_ff;
-extern cpuop_func op_4e70_5_nf;
 extern cpuop_func op_4e70_5_ff;
-extern cpuop_func op_4e71_5_nf;
 extern cpuop_func op_4e71_5_ff;
-extern cpuop_func op_4e72_5_nf;
 extern cpuop_func op_4e72_5_ff;
-extern cpuop_func op_4e73_5_nf;
 extern cpuop_func op_4e73_5_ff;
-extern cpuop_func op_4e74_5_nf;
 extern cpuop_func op_4e74_5_ff;
-extern cpuop_func op_4e75_5_nf;
 extern cpuop_func op_4e75_5_ff;
-extern cpuop_func op_4e76_5_nf;
 extern cpuop_func op_4e76_5_ff;
-extern cpuop_func op_4e77_5_nf;
 extern cpuop_func op_4e77_5_ff;
-extern cpuop_func op_4e90_5_nf;
 extern cpuop_func op_4e90_5_ff;
-extern cpuop_func op_4ea8_5_nf;
 extern cpuop_func op_4ea8_5_ff;
-extern cpuop_func op_4eb0_5_nf;
 extern cpuop_func op_4eb0_5_ff;
-extern cpuop_func op_4eb8_5_nf;
 extern cpuop_func op_4eb8_5_ff;
-extern cpuop_func op_4eb9_5_nf;
 extern cpuop_func op_4eb9_5_ff;
-extern cpuop_func op_4eba_5_nf;
 extern cpuop_func op_4eba_5_ff;
-extern cpuop_func op_4ebb_5_nf;
 extern cpuop_func op_4ebb_5_ff;
-extern cpuop_func op_4ed0_5_nf;
 extern cpuop_func op_4ed0_5_ff;
-extern cpuop_func op_4ee8_5_nf;
 extern cpuop_func op_4ee8_5_ff;
-extern cpuop_func op_4ef0_5_nf;
 extern cpuop_func op_4ef0_5_ff;
-extern cpuop_func op_4ef8_5_nf;
 extern cpuop_func op_4ef8_5_ff;
-extern cpuop_func op_4ef9_5_nf;
 extern cpuop_func op_4ef9_5_ff;
-extern cpuop_func op_4efa_5_nf;
 extern cpuop_func op_4efa_5_ff;
-extern cpuop_func op_4efb_5_nf;
 extern cpuop_func op_4efb_5_ff;
-extern cpuop_func op_5000_5_nf;
 extern cpuop_func op_5000_5_ff;
-extern cpuop_func op_5010_5_nf;
 extern cpuop_func op_5010_5_ff;
-extern cpuop_func op_5018_5_nf;
 extern cpuop_func op_5018_5_ff;
-extern cpuop_func op_5020_5_nf;
 extern cpuop_func op_5020_5_ff;
-extern cpuop_func op_5028_5_nf;
 extern cpuop_func op_5028_5_ff;
-extern cpuop_func op_5030_5_nf;
 extern cpuop_func op_5030_5_ff;
-extern cpuop_func op_5038_5_nf;
 extern cpuop_func op_5038_5_ff;
-extern cpuop_func op_5039_5_nf;
 extern cpuop_func op_5039_5_ff;
-extern cpuop_func op_5040_5_nf;
 extern cpuop_func op_5040_5_ff;
-extern cpuop_func op_5048_5_nf;
 extern cpuop_func op_5048_5_ff;
-extern cpuop_func op_5050_5_nf;
 extern cpuop_func op_5050_5_ff;
-extern cpuop_func op_5058_5_nf;
 extern cpuop_func op_5058_5_ff;
-extern cpuop_func op_5060_5_nf;
 extern cpuop_func op_5060_5_ff;
-extern cpuop_func op_5068_5_nf;
 extern cpuop_func op_5068_5_ff;
-extern cpuop_func op_5070_5_nf;
 extern cpuop_func op_5070_5_ff;
-extern cpuop_func op_5078_5_nf;
 extern cpuop_func op_5078_5_ff;
-extern cpuop_func op_5079_5_nf;
 extern cpuop_func op_5079_5_ff;
-extern cpuop_func op_5080_5_nf;
 extern cpuop_func op_5080_5_ff;
-extern cpuop_func op_5088_5_nf;
 extern cpuop_func op_5088_5_ff;
-extern cpuop_func op_5090_5_nf;
 extern cpuop_func op_5090_5_ff;
-extern cpuop_func op_5098_5_nf;
 extern cpuop_func op_5098_5_ff;
-extern cpuop_func op_50a0_5_nf;
 extern cpuop_func op_50a0_5_ff;
-extern cpuop_func op_50a8_5_nf;
 extern cpuop_func op_50a8_5_ff;
-extern cpuop_func op_50b0_5_nf;
 extern cpuop_func op_50b0_5_ff;
-extern cpuop_func op_50b8_5_nf;
 extern cpuop_func op_50b8_5_ff;
-extern cpuop_func op_50b9_5_nf;
 extern cpuop_func op_50b9_5_ff;
-extern cpuop_func op_50c0_5_nf;
 extern cpuop_func op_50c0_5_ff;
-extern cpuop_func op_50c8_5_nf;
 extern cpuop_func op_50c8_5_ff;
-extern cpuop_func op_50d0_5_nf;
 extern cpuop_func op_50d0_5_ff;
-extern cpuop_func op_50d8_5_nf;
 extern cpuop_func op_50d8_5_ff;
-extern cpuop_func op_50e0_5_nf;
 extern cpuop_func op_50e0_5_ff;
-extern cpuop_func op_50e8_5_nf;
 extern cpuop_func op_50e8_5_ff;
-extern cpuop_func op_50f0_5_nf;
 extern cpuop_func op_50f0_5_ff;
-extern cpuop_func op_50f8_5_nf;
 extern cpuop_func op_50f8_5_ff;
-extern cpuop_func op_50f9_5_nf;
 extern cpuop_func op_50f9_5_ff;
-extern cpuop_func op_5100_5_nf;
 extern cpuop_func op_5100_5_ff;
-extern cpuop_func op_5110_5_nf;
 extern cpuop_func op_5110_5_ff;
-extern cpuop_func op_5118_5_nf;
 extern cpuop_func op_5118_5_ff;
-extern cpuop_func op_5120_5_nf;
 extern cpuop_func op_5120_5_ff;
-extern cpuop_func op_5128_5_nf;
 extern cpuop_func op_5128_5_ff;
-extern cpuop_func op_5130_5_nf;
 extern cpuop_func op_5130_5_ff;
-extern cpuop_func op_5138_5_nf;
 extern cpuop_func op_5138_5_ff;
-extern cpuop_func op_5139_5_nf;
 extern cpuop_func op_5139_5_ff;
-extern cpuop_func op_5140_5_nf;
 extern cpuop_func op_5140_5_ff;
-extern cpuop_func op_5148_5_nf;
 extern cpuop_func op_5148_5_ff;
-extern cpuop_func op_5150_5_nf;
 extern cpuop_func op_5150_5_ff;
-extern cpuop_func op_5158_5_nf;
 extern cpuop_func op_5158_5_ff;
-extern cpuop_func op_5160_5_nf;
 extern cpuop_func op_5160_5_ff;
-extern cpuop_func op_5168_5_nf;
 extern cpuop_func op_5168_5_ff;
-extern cpuop_func op_5170_5_nf;
 extern cpuop_func op_5170_5_ff;
-extern cpuop_func op_5178_5_nf;
 extern cpuop_func op_5178_5_ff;
-extern cpuop_func op_5179_5_nf;
 extern cpuop_func op_5179_5_ff;
-extern cpuop_func op_5180_5_nf;
 extern cpuop_func op_5180_5_ff;
-extern cpuop_func op_5188_5_nf;
 extern cpuop_func op_5188_5_ff;
-extern cpuop_func op_5190_5_nf;
 extern cpuop_func op_5190_5_ff;
-extern cpuop_func op_5198_5_nf;
 extern cpuop_func op_5198_5_ff;
-extern cpuop_func op_51a0_5_nf;
 extern cpuop_func op_51a0_5_ff;
-extern cpuop_func op_51a8_5_nf;
 extern cpuop_func op_51a8_5_ff;
-extern cpuop_func op_51b0_5_nf;
 extern cpuop_func op_51b0_5_ff;
-extern cpuop_func op_51b8_5_nf;
 extern cpuop_func op_51b8_5_ff;
-extern cpuop_func op_51b9_5_nf;
 extern cpuop_func op_51b9_5_ff;
-extern cpuop_func op_51c0_5_nf;
 extern cpuop_func op_51c0_5_ff;
-extern cpuop_func op_51c8_5_nf;
 extern cpuop_func op_51c8_5_ff;
-extern cpuop_func op_51d0_5_nf;
 extern cpuop_func op_51d0_5_ff;
-extern cpuop_func op_51d8_5_nf;
 extern cpuop_func op_51d8_5_ff;
-extern cpuop_func op_51e0_5_nf;
 extern cpuop_func op_51e0_5_ff;
-extern cpuop_func op_51e8_5_nf;
 extern cpuop_func op_51e8_5_ff;
-extern cpuop_func op_51f0_5_nf;
 extern cpuop_func op_51f0_5_ff;
-extern cpuop_func op_51f8_5_nf;
 extern cpuop_func op_51f8_5_ff;
-extern cpuop_func op_51f9_5_nf;
 extern cpuop_func op_51f9_5_ff;
-extern cpuop_func op_52c0_5_nf;
 extern cpuop_func op_52c0_5_ff;
-extern cpuop_func op_52c8_5_nf;
 extern cpuop_func op_52c8_5_ff;
-extern cpuop_func op_52d0_5_nf;
 extern cpuop_func op_52d0_5_ff;
-extern cpuop_func op_52d8_5_nf;
 extern cpuop_func op_52d8_5_ff;
-extern cpuop_func op_52e0_5_nf;
 extern cpuop_func op_52e0_5_ff;
-extern cpuop_func op_52e8_5_nf;
 extern cpuop_func op_52e8_5_ff;
-extern cpuop_func op_52f0_5_nf;
 extern cpuop_func op_52f0_5_ff;
-extern cpuop_func op_52f8_5_nf;
 extern cpuop_func op_52f8_5_ff;
-extern cpuop_func op_52f9_5_nf;
 extern cpuop_func op_52f9_5_ff;
-extern cpuop_func op_53c0_5_nf;
 extern cpuop_func op_53c0_5_ff;
-extern cpuop_func op_53c8_5_nf;
 extern cpuop_func op_53c8_5_ff;
-extern cpuop_func op_53d0_5_nf;
 extern cpuop_func op_53d0_5_ff;
-extern cpuop_func op_53d8_5_nf;
 extern cpuop_func op_53d8_5_ff;
-extern cpuop_func op_53e0_5_nf;
 extern cpuop_func op_53e0_5_ff;
-extern cpuop_func op_53e8_5_nf;
 extern cpuop_func op_53e8_5_ff;
-extern cpuop_func op_53f0_5_nf;
 extern cpuop_func op_53f0_5_ff;
-extern cpuop_func op_53f8_5_nf;
 extern cpuop_func op_53f8_5_ff;
-extern cpuop_func op_53f9_5_nf;
 extern cpuop_func op_53f9_5_ff;
-extern cpuop_func op_54c0_5_nf;
 extern cpuop_func op_54c0_5_ff;
-extern cpuop_func op_54c8_5_nf;
 extern cpuop_func op_54c8_5_ff;
-extern cpuop_func op_54d0_5_nf;
 extern cpuop_func op_54d0_5_ff;
-extern cpuop_func op_54d8_5_nf;
 extern cpuop_func op_54d8_5_ff;
-extern cpuop_func op_54e0_5_nf;
 extern cpuop_func op_54e0_5_ff;
-extern cpuop_func op_54e8_5_nf;
 extern cpuop_func op_54e8_5_ff;
-extern cpuop_func op_54f0_5_nf;
 extern cpuop_func op_54f0_5_ff;
-extern cpuop_func op_54f8_5_nf;
 extern cpuop_func op_54f8_5_ff;
-extern cpuop_func op_54f9_5_nf;
 extern cpuop_func op_54f9_5_ff;
-extern cpuop_func op_55c0_5_nf;
 extern cpuop_func op_55c0_5_ff;
-extern cpuop_func op_55c8_5_nf;
 extern cpuop_func op_55c8_5_ff;
-extern cpuop_func op_55d0_5_nf;
 extern cpuop_func op_55d0_5_ff;
-extern cpuop_func op_55d8_5_nf;
 extern cpuop_func op_55d8_5_ff;
-extern cpuop_func op_55e0_5_nf;
 extern cpuop_func op_55e0_5_ff;
-extern cpuop_func op_55e8_5_nf;
 extern cpuop_func op_55e8_5_ff;
-extern cpuop_func op_55f0_5_nf;
 extern cpuop_func op_55f0_5_ff;
-extern cpuop_func op_55f8_5_nf;
 extern cpuop_func op_55f8_5_ff;
-extern cpuop_func op_55f9_5_nf;
 extern cpuop_func op_55f9_5_ff;
-extern cpuop_func op_56c0_5_nf;
 extern cpuop_func op_56c0_5_ff;
-extern cpuop_func op_56c8_5_nf;
 extern cpuop_func op_56c8_5_ff;
-extern cpuop_func op_56d0_5_nf;
 extern cpuop_func op_56d0_5_ff;
-extern cpuop_func op_56d8_5_nf;
 extern cpuop_func op_56d8_5_ff;
-extern cpuop_func op_56e0_5_nf;
 extern cpuop_func op_56e0_5_ff;
-extern cpuop_func op_56e8_5_nf;
 extern cpuop_func op_56e8_5_ff;
-extern cpuop_func op_56f0_5_nf;
 extern cpuop_func op_56f0_5_ff;
-extern cpuop_func op_56f8_5_nf;
 extern cpuop_func op_56f8_5_ff;
-extern cpuop_func op_56f9_5_nf;
 extern cpuop_func op_56f9_5_ff;
-extern cpuop_func op_57c0_5_nf;
 extern cpuop_func op_57c0_5_ff;
-extern cpuop_func op_57c8_5_nf;
 extern cpuop_func op_57c8_5_ff;
-extern cpuop_func op_57d0_5_nf;
 extern cpuop_func op_57d0_5_ff;
-extern cpuop_func op_57d8_5_nf;
 extern cpuop_func op_57d8_5_ff;
-extern cpuop_func op_57e0_5_nf;
 extern cpuop_func op_57e0_5_ff;
-extern cpuop_func op_57e8_5_nf;
 extern cpuop_func op_57e8_5_ff;
-extern cpuop_func op_57f0_5_nf;
 extern cpuop_func op_57f0_5_ff;
-extern cpuop_func op_57f8_5_nf;
 extern cpuop_func op_57f8_5_ff;
-extern cpuop_func op_57f9_5_nf;
 extern cpuop_func op_57f9_5_ff;
-extern cpuop_func op_58c0_5_nf;
 extern cpuop_func op_58c0_5_ff;
-extern cpuop_func op_58c8_5_nf;
 extern cpuop_func op_58c8_5_ff;
-extern cpuop_func op_58d0_5_nf;
 extern cpuop_func op_58d0_5_ff;
-extern cpuop_func op_58d8_5_nf;
 extern cpuop_func op_58d8_5_ff;
-extern cpuop_func op_58e0_5_nf;
 extern cpuop_func op_58e0_5_ff;
-extern cpuop_func op_58e8_5_nf;
 extern cpuop_func op_58e8_5_ff;
-extern cpuop_func op_58f0_5_nf;
 extern cpuop_func op_58f0_5_ff;
-extern cpuop_func op_58f8_5_nf;
 extern cpuop_func op_58f8_5_ff;
-extern cpuop_func op_58f9_5_nf;
 extern cpuop_func op_58f9_5_ff;
-extern cpuop_func op_59c0_5_nf;
 extern cpuop_func op_59c0_5_ff;
-extern cpuop_func op_59c8_5_nf;
 extern cpuop_func op_59c8_5_ff;
-extern cpuop_func op_59d0_5_nf;
 extern cpuop_func op_59d0_5_ff;
-extern cpuop_func op_59d8_5_nf;
 extern cpuop_func op_59d8_5_ff;
-extern cpuop_func op_59e0_5_nf;
 extern cpuop_func op_59e0_5_ff;
-extern cpuop_func op_59e8_5_nf;
 extern cpuop_func op_59e8_5_ff;
-extern cpuop_func op_59f0_5_nf;
 extern cpuop_func op_59f0_5_ff;
-extern cpuop_func op_59f8_5_nf;
 extern cpuop_func op_59f8_5_ff;
-extern cpuop_func op_59f9_5_nf;
 extern cpuop_func op_59f9_5_ff;
-extern cpuop_func op_5ac0_5_nf;
 extern cpuop_func op_5ac0_5_ff;
-extern cpuop_func op_5ac8_5_nf;
 extern cpuop_func op_5ac8_5_ff;
-extern cpuop_func op_5ad0_5_nf;
 extern cpuop_func op_5ad0_5_ff;
-extern cpuop_func op_5ad8_5_nf;
 extern cpuop_func op_5ad8_5_ff;
-extern cpuop_func op_5ae0_5_nf;
 extern cpuop_func op_5ae0_5_ff;
-extern cpuop_func op_5ae8_5_nf;
 extern cpuop_func op_5ae8_5_ff;
-extern cpuop_func op_5af0_5_nf;
 extern cpuop_func op_5af0_5_ff;
-extern cpuop_func op_5af8_5_nf;
 extern cpuop_func op_5af8_5_ff;
-extern cpuop_func op_5af9_5_nf;
 extern cpuop_func op_5af9_5_ff;
-extern cpuop_func op_5bc0_5_nf;
 extern cpuop_func op_5bc0_5_ff;
-extern cpuop_func op_5bc8_5_nf;
 extern cpuop_func op_5bc8_5_ff;
-extern cpuop_func op_5bd0_5_nf;
 extern cpuop_func op_5bd0_5_ff;
-extern cpuop_func op_5bd8_5_nf;
 extern cpuop_func op_5bd8_5_ff;
-extern cpuop_func op_5be0_5_nf;
 extern cpuop_func op_5be0_5_ff;
-extern cpuop_func op_5be8_5_nf;
 extern cpuop_func op_5be8_5_ff;
-extern cpuop_func op_5bf0_5_nf;
 extern cpuop_func op_5bf0_5_ff;
-extern cpuop_func op_5bf8_5_nf;
 extern cpuop_func op_5bf8_5_ff;
-extern cpuop_func op_5bf9_5_nf;
 extern cpuop_func op_5bf9_5_ff;
-extern cpuop_func op_5cc0_5_nf;
 extern cpuop_func op_5cc0_5_ff;
-extern cpuop_func op_5cc8_5_nf;
 extern cpuop_func op_5cc8_5_ff;
-extern cpuop_func op_5cd0_5_nf;
 extern cpuop_func op_5cd0_5_ff;
-extern cpuop_func op_5cd8_5_nf;
 extern cpuop_func op_5cd8_5_ff;
-extern cpuop_func op_5ce0_5_nf;
 extern cpuop_func op_5ce0_5_ff;
-extern cpuop_func op_5ce8_5_nf;
 extern cpuop_func op_5ce8_5_ff;
-extern cpuop_func op_5cf0_5_nf;
 extern cpuop_func op_5cf0_5_ff;
-extern cpuop_func op_5cf8_5_nf;
 extern cpuop_func op_5cf8_5_ff;
-extern cpuop_func op_5cf9_5_nf;
 extern cpuop_func op_5cf9_5_ff;
-extern cpuop_func op_5dc0_5_nf;
 extern cpuop_func op_5dc0_5_ff;
-extern cpuop_func op_5dc8_5_nf;
 extern cpuop_func op_5dc8_5_ff;
-extern cpuop_func op_5dd0_5_nf;
 extern cpuop_func op_5dd0_5_ff;
-extern cpuop_func op_5dd8_5_nf;
 extern cpuop_func op_5dd8_5_ff;
-extern cpuop_func op_5de0_5_nf;
 extern cpuop_func op_5de0_5_ff;
-extern cpuop_func op_5de8_5_nf;
 extern cpuop_func op_5de8_5_ff;
-extern cpuop_func op_5df0_5_nf;
 extern cpuop_func op_5df0_5_ff;
-extern cpuop_func op_5df8_5_nf;
 extern cpuop_func op_5df8_5_ff;
-extern cpuop_func op_5df9_5_nf;
 extern cpuop_func op_5df9_5_ff;
-extern cpuop_func op_5ec0_5_nf;
 extern cpuop_func op_5ec0_5_ff;
-extern cpuop_func op_5ec8_5_nf;
 extern cpuop_func op_5ec8_5_ff;
-extern cpuop_func op_5ed0_5_nf;
 extern cpuop_func op_5ed0_5_ff;
-extern cpuop_func op_5ed8_5_nf;
 extern cpuop_func op_5ed8_5_ff;
-extern cpuop_func op_5ee0_5_nf;
 extern cpuop_func op_5ee0_5_ff;
-extern cpuop_func op_5ee8_5_nf;
 extern cpuop_func op_5ee8_5_ff;
-extern cpuop_func op_5ef0_5_nf;
 extern cpuop_func op_5ef0_5_ff;
-extern cpuop_func op_5ef8_5_nf;
 extern cpuop_func op_5ef8_5_ff;
-extern cpuop_func op_5ef9_5_nf;
 extern cpuop_func op_5ef9_5_ff;
-extern cpuop_func op_5fc0_5_nf;
 extern cpuop_func op_5fc0_5_ff;
-extern cpuop_func op_5fc8_5_nf;
 extern cpuop_func op_5fc8_5_ff;
-extern cpuop_func op_5fd0_5_nf;
 extern cpuop_func op_5fd0_5_ff;
-extern cpuop_func op_5fd8_5_nf;
 extern cpuop_func op_5fd8_5_ff;
-extern cpuop_func op_5fe0_5_nf;
 extern cpuop_func op_5fe0_5_ff;
-extern cpuop_func op_5fe8_5_nf;
 extern cpuop_func op_5fe8_5_ff;
-extern cpuop_func op_5ff0_5_nf;
 extern cpuop_func op_5ff0_5_ff;
-extern cpuop_func op_5ff8_5_nf;
 extern cpuop_func op_5ff8_5_ff;
-extern cpuop_func op_5ff9_5_nf;
 extern cpuop_func op_5ff9_5_ff;
-extern cpuop_func op_6000_5_nf;
 extern cpuop_func op_6000_5_ff;
-extern cpuop_func op_6001_5_nf;
 extern cpuop_func op_6001_5_ff;
-extern cpuop_func op_60ff_5_nf;
 extern cpuop_func op_60ff_5_ff;
-extern cpuop_func op_6100_5_nf;
 extern cpuop_func op_6100_5_ff;
-extern cpuop_func op_6101_5_nf;
 extern cpuop_func op_6101_5_ff;
-extern cpuop_func op_61ff_5_nf;
 extern cpuop_func op_61ff_5_ff;
-extern cpuop_func op_6200_5_nf;
 extern cpuop_func op_6200_5_ff;
-extern cpuop_func op_6201_5_nf;
 extern cpuop_func op_6201_5_ff;
-extern cpuop_func op_62ff_5_nf;
 extern cpuop_func op_62ff_5_ff;
-extern cpuop_func op_6300_5_nf;
 extern cpuop_func op_6300_5_ff;
-extern cpuop_func op_6301_5_nf;
 extern cpuop_func op_6301_5_ff;
-extern cpuop_func op_63ff_5_nf;
 extern cpuop_func op_63ff_5_ff;
-extern cpuop_func op_6400_5_nf;
 extern cpuop_func op_6400_5_ff;
-extern cpuop_func op_6401_5_nf;
 extern cpuop_func op_6401_5_ff;
-extern cpuop_func op_64ff_5_nf;
 extern cpuop_func op_64ff_5_ff;
-extern cpuop_func op_6500_5_nf;
 extern cpuop_func op_6500_5_ff;
-extern cpuop_func op_6501_5_nf;
 extern cpuop_func op_6501_5_ff;
-extern cpuop_func op_65ff_5_nf;
 extern cpuop_func op_65ff_5_ff;
-extern cpuop_func op_6600_5_nf;
 extern cpuop_func op_6600_5_ff;
-extern cpuop_func op_6601_5_nf;
 extern cpuop_func op_6601_5_ff;
-extern cpuop_func op_66ff_5_nf;
 extern cpuop_func op_66ff_5_ff;
-extern cpuop_func op_6700_5_nf;
 extern cpuop_func op_6700_5_ff;
-extern cpuop_func op_6701_5_nf;
 extern cpuop_func op_6701_5_ff;
-extern cpuop_func op_67ff_5_nf;
 extern cpuop_func op_67ff_5_ff;
-extern cpuop_func op_6800_5_nf;
 extern cpuop_func op_6800_5_ff;
-extern cpuop_func op_6801_5_nf;
 extern cpuop_func op_6801_5_ff;
-extern cpuop_func op_68ff_5_nf;
 extern cpuop_func op_68ff_5_ff;
-extern cpuop_func op_6900_5_nf;
 extern cpuop_func op_6900_5_ff;
-extern cpuop_func op_6901_5_nf;
 extern cpuop_func op_6901_5_ff;
-extern cpuop_func op_69ff_5_nf;
 extern cpuop_func op_69ff_5_ff;
-extern cpuop_func op_6a00_5_nf;
 extern cpuop_func op_6a00_5_ff;
-extern cpuop_func op_6a01_5_nf;
 extern cpuop_func op_6a01_5_ff;
-extern cpuop_func op_6aff_5_nf;
 extern cpuop_func op_6aff_5_ff;
-extern cpuop_func op_6b00_5_nf;
 extern cpuop_func op_6b00_5_ff;
-extern cpuop_func op_6b01_5_nf;
 extern cpuop_func op_6b01_5_ff;
-extern cpuop_func op_6bff_5_nf;
 extern cpuop_func op_6bff_5_ff;
-extern cpuop_func op_6c00_5_nf;
 extern cpuop_func op_6c00_5_ff;
-extern cpuop_func op_6c01_5_nf;
 extern cpuop_func op_6c01_5_ff;
-extern cpuop_func op_6cff_5_nf;
 extern cpuop_func op_6cff_5_ff;
-extern cpuop_func op_6d00_5_nf;
 extern cpuop_func op_6d00_5_ff;
-extern cpuop_func op_6d01_5_nf;
 extern cpuop_func op_6d01_5_ff;
-extern cpuop_func op_6dff_5_nf;
 extern cpuop_func op_6dff_5_ff;
-extern cpuop_func op_6e00_5_nf;
 extern cpuop_func op_6e00_5_ff;
-extern cpuop_func op_6e01_5_nf;
 extern cpuop_func op_6e01_5_ff;
-extern cpuop_func op_6eff_5_nf;
 extern cpuop_func op_6eff_5_ff;
-extern cpuop_func op_6f00_5_nf;
 extern cpuop_func op_6f00_5_ff;
-extern cpuop_func op_6f01_5_nf;
 extern cpuop_func op_6f01_5_ff;
-extern cpuop_func op_6fff_5_nf;
 extern cpuop_func op_6fff_5_ff;
-extern cpuop_func op_7000_5_nf;
 extern cpuop_func op_7000_5_ff;
-extern cpuop_func op_8000_5_nf;
 extern cpuop_func op_8000_5_ff;
-extern cpuop_func op_8010_5_nf;
 extern cpuop_func op_8010_5_ff;
-extern cpuop_func op_8018_5_nf;
 extern cpuop_func op_8018_5_ff;
-extern cpuop_func op_8020_5_nf;
 extern cpuop_func op_8020_5_ff;
-extern cpuop_func op_8028_5_nf;
 extern cpuop_func op_8028_5_ff;
-extern cpuop_func op_8030_5_nf;
 extern cpuop_func op_8030_5_ff;
-extern cpuop_func op_8038_5_nf;
 extern cpuop_func op_8038_5_ff;
-extern cpuop_func op_8039_5_nf;
 extern cpuop_func op_8039_5_ff;
-extern cpuop_func op_803a_5_nf;
 extern cpuop_func op_803a_5_ff;
-extern cpuop_func op_803b_5_nf;
 extern cpuop_func op_803b_5_ff;
-extern cpuop_func op_803c_5_nf;
 extern cpuop_func op_803c_5_ff;
-extern cpuop_func op_8040_5_nf;
 extern cpuop_func op_8040_5_ff;
-extern cpuop_func op_8050_5_nf;
 extern cpuop_func op_8050_5_ff;
-extern cpuop_func op_8058_5_nf;
 extern cpuop_func op_8058_5_ff;
-extern cpuop_func op_8060_5_nf;
 extern cpuop_func op_8060_5_ff;
-extern cpuop_func op_8068_5_nf;
 extern cpuop_func op_8068_5_ff;
-extern cpuop_func op_8070_5_nf;
 extern cpuop_func op_8070_5_ff;
-extern cpuop_func op_8078_5_nf;
 extern cpuop_func op_8078_5_ff;
-extern cpuop_func op_8079_5_nf;
 extern cpuop_func op_8079_5_ff;
-extern cpuop_func op_807a_5_nf;
 extern cpuop_func op_807a_5_ff;
-extern cpuop_func op_807b_5_nf;
 extern cpuop_func op_807b_5_ff;
-extern cpuop_func op_807c_5_nf;
 extern cpuop_func op_807c_5_ff;
-extern cpuop_func op_8080_5_nf;
 extern cpuop_func op_8080_5_ff;
-extern cpuop_func op_8090_5_nf;
 extern cpuop_func op_8090_5_ff;
-extern cpuop_func op_8098_5_nf;
 extern cpuop_func op_8098_5_ff;
-extern cpuop_func op_80a0_5_nf;
 extern cpuop_func op_80a0_5_ff;
-extern cpuop_func op_80a8_5_nf;
 extern cpuop_func op_80a8_5_ff;
-extern cpuop_func op_80b0_5_nf;
 extern cpuop_func op_80b0_5_ff;
-extern cpuop_func op_80b8_5_nf;
 extern cpuop_func op_80b8_5_ff;
-extern cpuop_func op_80b9_5_nf;
 extern cpuop_func op_80b9_5_ff;
-extern cpuop_func op_80ba_5_nf;
 extern cpuop_func op_80ba_5_ff;
-extern cpuop_func op_80bb_5_nf;
 extern cpuop_func op_80bb_5_ff;
-extern cpuop_func op_80bc_5_nf;
 extern cpuop_func op_80bc_5_ff;
-extern cpuop_func op_80c0_5_nf;
 extern cpuop_func op_80c0_5_ff;
-extern cpuop_func op_80d0_5_nf;
 extern cpuop_func op_80d0_5_ff;
-extern cpuop_func op_80d8_5_nf;
 extern cpuop_func op_80d8_5_ff;
-extern cpuop_func op_80e0_5_nf;
 extern cpuop_func op_80e0_5_ff;
-extern cpuop_func op_80e8_5_nf;
 extern cpuop_func op_80e8_5_ff;
-extern cpuop_func op_80f0_5_nf;
 extern cpuop_func op_80f0_5_ff;
-extern cpuop_func op_80f8_5_nf;
 extern cpuop_func op_80f8_5_ff;
-extern cpuop_func op_80f9_5_nf;
 extern cpuop_func op_80f9_5_ff;
-extern cpuop_func op_80fa_5_nf;
 extern cpuop_func op_80fa_5_ff;
-extern cpuop_func op_80fb_5_nf;
 extern cpuop_func op_80fb_5_ff;
-extern cpuop_func op_80fc_5_nf;
 extern cpuop_func op_80fc_5_ff;
-extern cpuop_func op_8100_5_nf;
 extern cpuop_func op_8100_5_ff;
-extern cpuop_func op_8108_5_nf;
 extern cpuop_func op_8108_5_ff;
-extern cpuop_func op_8110_5_nf;
 extern cpuop_func op_8110_5_ff;
-extern cpuop_func op_8118_5_nf;
 extern cpuop_func op_8118_5_ff;
-extern cpuop_func op_8120_5_nf;
 extern cpuop_func op_8120_5_ff;
-extern cpuop_func op_8128_5_nf;
 extern cpuop_func op_8128_5_ff;
-extern cpuop_func op_8130_5_nf;
 extern cpuop_func op_8130_5_ff;
-extern cpuop_func op_8138_5_nf;
 extern cpuop_func op_8138_5_ff;
-extern cpuop_func op_8139_5_nf;
 extern cpuop_func op_8139_5_ff;
-extern cpuop_func op_8150_5_nf;
 extern cpuop_func op_8150_5_ff;
-extern cpuop_func op_8158_5_nf;
 extern cpuop_func op_8158_5_ff;
-extern cpuop_func op_8160_5_nf;
 extern cpuop_func op_8160_5_ff;
-extern cpuop_func op_8168_5_nf;
 extern cpuop_func op_8168_5_ff;
-extern cpuop_func op_8170_5_nf;
 extern cpuop_func op_8170_5_ff;
-extern cpuop_func op_8178_5_nf;
 extern cpuop_func op_8178_5_ff;
-extern cpuop_func op_8179_5_nf;
 extern cpuop_func op_8179_5_ff;
-extern cpuop_func op_8190_5_nf;
 extern cpuop_func op_8190_5_ff;
-extern cpuop_func op_8198_5_nf;
 extern cpuop_func op_8198_5_ff;
-extern cpuop_func op_81a0_5_nf;
 extern cpuop_func op_81a0_5_ff;
-extern cpuop_func op_81a8_5_nf;
 extern cpuop_func op_81a8_5_ff;
-extern cpuop_func op_81b0_5_nf;
 extern cpuop_func op_81b0_5_ff;
-extern cpuop_func op_81b8_5_nf;
 extern cpuop_func op_81b8_5_ff;
-extern cpuop_func op_81b9_5_nf;
 extern cpuop_func op_81b9_5_ff;
-extern cpuop_func op_81c0_5_nf;
 extern cpuop_func op_81c0_5_ff;
-extern cpuop_func op_81d0_5_nf;
 extern cpuop_func op_81d0_5_ff;
-extern cpuop_func op_81d8_5_nf;
 extern cpuop_func op_81d8_5_ff;
-extern cpuop_func op_81e0_5_nf;
 extern cpuop_func op_81e0_5_ff;
-extern cpuop_func op_81e8_5_nf;
 extern cpuop_func op_81e8_5_ff;
-extern cpuop_func op_81f0_5_nf;
 extern cpuop_func op_81f0_5_ff;
-extern cpuop_func op_81f8_5_nf;
 extern cpuop_func op_81f8_5_ff;
-extern cpuop_func op_81f9_5_nf;
 extern cpuop_func op_81f9_5_ff;
-extern cpuop_func op_81fa_5_nf;
 extern cpuop_func op_81fa_5_ff;
-extern cpuop_func op_81fb_5_nf;
 extern cpuop_func op_81fb_5_ff;
-extern cpuop_func op_81fc_5_nf;
 extern cpuop_func op_81fc_5_ff;
-extern cpuop_func op_9000_5_nf;
 extern cpuop_func op_9000_5_ff;
-extern cpuop_func op_9010_5_nf;
 extern cpuop_func op_9010_5_ff;
-extern cpuop_func op_9018_5_nf;
 extern cpuop_func op_9018_5_ff;
-extern cpuop_func op_9020_5_nf;
 extern cpuop_func op_9020_5_ff;
-extern cpuop_func op_9028_5_nf;
 extern cpuop_func op_9028_5_ff;
-extern cpuop_func op_9030_5_nf;
 extern cpuop_func op_9030_5_ff;
-extern cpuop_func op_9038_5_nf;
 extern cpuop_func op_9038_5_ff;
-extern cpuop_func op_9039_5_nf;
 extern cpuop_func op_9039_5_ff;
-extern cpuop_func op_903a_5_nf;
 extern cpuop_func op_903a_5_ff;
-extern cpuop_func op_903b_5_nf;
 extern cpuop_func op_903b_5_ff;
-extern cpuop_func op_903c_5_nf;
 extern cpuop_func op_903c_5_ff;
-extern cpuop_func op_9040_5_nf;
 extern cpuop_func op_9040_5_ff;
-extern cpuop_func op_9048_5_nf;
 extern cpuop_func op_9048_5_ff;
-extern cpuop_func op_9050_5_nf;
 extern cpuop_func op_9050_5_ff;
-extern cpuop_func op_9058_5_nf;
 extern cpuop_func op_9058_5_ff;
-extern cpuop_func op_9060_5_nf;
 extern cpuop_func op_9060_5_ff;
-extern cpuop_func op_9068_5_nf;
 extern cpuop_func op_9068_5_ff;
-extern cpuop_func op_9070_5_nf;
 extern cpuop_func op_9070_5_ff;
-extern cpuop_func op_9078_5_nf;
 extern cpuop_func op_9078_5_ff;
-extern cpuop_func op_9079_5_nf;
 extern cpuop_func op_9079_5_ff;
-extern cpuop_func op_907a_5_nf;
 extern cpuop_func op_907a_5_ff;
-extern cpuop_func op_907b_5_nf;
 extern cpuop_func op_907b_5_ff;
-extern cpuop_func op_907c_5_nf;
 extern cpuop_func op_907c_5_ff;
-extern cpuop_func op_9080_5_nf;
 extern cpuop_func op_9080_5_ff;
-extern cpuop_func op_9088_5_nf;
 extern cpuop_func op_9088_5_ff;
-extern cpuop_func op_9090_5_nf;
 extern cpuop_func op_9090_5_ff;
-extern cpuop_func op_9098_5_nf;
 extern cpuop_func op_9098_5_ff;
-extern cpuop_func op_90a0_5_nf;
 extern cpuop_func op_90a0_5_ff;
-extern cpuop_func op_90a8_5_nf;
 extern cpuop_func op_90a8_5_ff;
-extern cpuop_func op_90b0_5_nf;
 extern cpuop_func op_90b0_5_ff;
-extern cpuop_func op_90b8_5_nf;
 extern cpuop_func op_90b8_5_ff;
-extern cpuop_func op_90b9_5_nf;
 extern cpuop_func op_90b9_5_ff;
-extern cpuop_func op_90ba_5_nf;
 extern cpuop_func op_90ba_5_ff;
-extern cpuop_func op_90bb_5_nf;
 extern cpuop_func op_90bb_5_ff;
-extern cpuop_func op_90bc_5_nf;
 extern cpuop_func op_90bc_5_ff;
-extern cpuop_func op_90c0_5_nf;
 extern cpuop_func op_90c0_5_ff;
-extern cpuop_func op_90c8_5_nf;
 extern cpuop_func op_90c8_5_ff;
-extern cpuop_func op_90d0_5_nf;
 extern cpuop_func op_90d0_5_ff;
-extern cpuop_func op_90d8_5_nf;
 extern cpuop_func op_90d8_5_ff;
-extern cpuop_func op_90e0_5_nf;
 extern cpuop_func op_90e0_5_ff;
-extern cpuop_func op_90e8_5_nf;
 extern cpuop_func op_90e8_5_ff;
-extern cpuop_func op_90f0_5_nf;
 extern cpuop_func op_90f0_5_ff;
-extern cpuop_func op_90f8_5_nf;
 extern cpuop_func op_90f8_5_ff;
-extern cpuop_func op_90f9_5_nf;
 extern cpuop_func op_90f9_5_ff;
-extern cpuop_func op_90fa_5_nf;
 extern cpuop_func op_90fa_5_ff;
-extern cpuop_func op_90fb_5_nf;
 extern cpuop_func op_90fb_5_ff;
-extern cpuop_func op_90fc_5_nf;
 extern cpuop_func op_90fc_5_ff;
-extern cpuop_func op_9100_5_nf;
 extern cpuop_func op_9100_5_ff;
-extern cpuop_func op_9108_5_nf;
 extern cpuop_func op_9108_5_ff;
-extern cpuop_func op_9110_5_nf;
 extern cpuop_func op_9110_5_ff;
-extern cpuop_func op_9118_5_nf;
 extern cpuop_func op_9118_5_ff;
-extern cpuop_func op_9120_5_nf;
 extern cpuop_func op_9120_5_ff;
-extern cpuop_func op_9128_5_nf;
 extern cpuop_func op_9128_5_ff;
-extern cpuop_func op_9130_5_nf;
 extern cpuop_func op_9130_5_ff;
-extern cpuop_func op_9138_5_nf;
 extern cpuop_func op_9138_5_ff;
-extern cpuop_func op_9139_5_nf;
 extern cpuop_func op_9139_5_ff;
-extern cpuop_func op_9140_5_nf;
 extern cpuop_func op_9140_5_ff;
-extern cpuop_func op_9148_5_nf;
 extern cpuop_func op_9148_5_ff;
-extern cpuop_func op_9150_5_nf;
 extern cpuop_func op_9150_5_ff;
-extern cpuop_func op_9158_5_nf;
 extern cpuop_func op_9158_5_ff;
-extern cpuop_func op_9160_5_nf;
 extern cpuop_func op_9160_5_ff;
-extern cpuop_func op_9168_5_nf;
 extern cpuop_func op_9168_5_ff;
-extern cpuop_func op_9170_5_nf;
 extern cpuop_func op_9170_5_ff;
-extern cpuop_func op_9178_5_nf;
 extern cpuop_func op_9178_5_ff;
-extern cpuop_func op_9179_5_nf;
 extern cpuop_func op_9179_5_ff;
-extern cpuop_func op_9180_5_nf;
 extern cpuop_func op_9180_5_ff;
-extern cpuop_func op_9188_5_nf;
 extern cpuop_func op_9188_5_ff;
-extern cpuop_func op_9190_5_nf;
 extern cpuop_func op_9190_5_ff;
-extern cpuop_func op_9198_5_nf;
 extern cpuop_func op_9198_5_ff;
-extern cpuop_func op_91a0_5_nf;
 extern cpuop_func op_91a0_5_ff;
-extern cpuop_func op_91a8_5_nf;
 extern cpuop_func op_91a8_5_ff;
-extern cpuop_func op_91b0_5_nf;
 extern cpuop_func op_91b0_5_ff;
-extern cpuop_func op_91b8_5_nf;
 extern cpuop_func op_91b8_5_ff;
-extern cpuop_func op_91b9_5_nf;
 extern cpuop_func op_91b9_5_ff;
-extern cpuop_func op_91c0_5_nf;
 extern cpuop_func op_91c0_5_ff;
-extern cpuop_func op_91c8_5_nf;
 extern cpuop_func op_91c8_5_ff;
-extern cpuop_func op_91d0_5_nf;
 extern cpuop_func op_91d0_5_ff;
-extern cpuop_func op_91d8_5_nf;
 extern cpuop_func op_91d8_5_ff;
-extern cpuop_func op_91e0_5_nf;
 extern cpuop_func op_91e0_5_ff;
-extern cpuop_func op_91e8_5_nf;
 extern cpuop_func op_91e8_5_ff;
-extern cpuop_func op_91f0_5_nf;
 extern cpuop_func op_91f0_5_ff;
-extern cpuop_func op_91f8_5_nf;
 extern cpuop_func op_91f8_5_ff;
-extern cpuop_func op_91f9_5_nf;
 extern cpuop_func op_91f9_5_ff;
-extern cpuop_func op_91fa_5_nf;
 extern cpuop_func op_91fa_5_ff;
-extern cpuop_func op_91fb_5_nf;
 extern cpuop_func op_91fb_5_ff;
-extern cpuop_func op_91fc_5_nf;
 extern cpuop_func op_91fc_5_ff;
-extern cpuop_func op_b000_5_nf;
 extern cpuop_func op_b000_5_ff;
-extern cpuop_func op_b010_5_nf;
 extern cpuop_func op_b010_5_ff;
-extern cpuop_func op_b018_5_nf;
 extern cpuop_func op_b018_5_ff;
-extern cpuop_func op_b020_5_nf;
 extern cpuop_func op_b020_5_ff;
-extern cpuop_func op_b028_5_nf;
 extern cpuop_func op_b028_5_ff;
-extern cpuop_func op_b030_5_nf;
 extern cpuop_func op_b030_5_ff;
-extern cpuop_func op_b038_5_nf;
 extern cpuop_func op_b038_5_ff;
-extern cpuop_func op_b039_5_nf;
 extern cpuop_func op_b039_5_ff;
-extern cpuop_func op_b03a_5_nf;
 extern cpuop_func op_b03a_5_ff;
-extern cpuop_func op_b03b_5_nf;
 extern cpuop_func op_b03b_5_ff;
-extern cpuop_func op_b03c_5_nf;
 extern cpuop_func op_b03c_5_ff;
-extern cpuop_func op_b040_5_nf;
 extern cpuop_func op_b040_5_ff;
-extern cpuop_func op_b048_5_nf;
 extern cpuop_func op_b048_5_ff;
-extern cpuop_func op_b050_5_nf;
 extern cpuop_func op_b050_5_ff;
-extern cpuop_func op_b058_5_nf;
 extern cpuop_func op_b058_5_ff;
-extern cpuop_func op_b060_5_nf;
 extern cpuop_func op_b060_5_ff;
-extern cpuop_func op_b068_5_nf;
 extern cpuop_func op_b068_5_ff;
-extern cpuop_func op_b070_5_nf;
 extern cpuop_func op_b070_5_ff;
-extern cpuop_func op_b078_5_nf;
 extern cpuop_func op_b078_5_ff;
-extern cpuop_func op_b079_5_nf;
 extern cpuop_func op_b079_5_ff;
-extern cpuop_func op_b07a_5_nf;
 extern cpuop_func op_b07a_5_ff;
-extern cpuop_func op_b07b_5_nf;
 extern cpuop_func op_b07b_5_ff;
-extern cpuop_func op_b07c_5_nf;
 extern cpuop_func op_b07c_5_ff;
-extern cpuop_func op_b080_5_nf;
 extern cpuop_func op_b080_5_ff;
-extern cpuop_func op_b088_5_nf;
 extern cpuop_func op_b088_5_ff;
-extern cpuop_func op_b090_5_nf;
 extern cpuop_func op_b090_5_ff;
-extern cpuop_func op_b098_5_nf;
 extern cpuop_func op_b098_5_ff;
-extern cpuop_func op_b0a0_5_nf;
 extern cpuop_func op_b0a0_5_ff;
-extern cpuop_func op_b0a8_5_nf;
 extern cpuop_func op_b0a8_5_ff;
-extern cpuop_func op_b0b0_5_nf;
 extern cpuop_func op_b0b0_5_ff;
-extern cpuop_func op_b0b8_5_nf;
 extern cpuop_func op_b0b8_5_ff;
-extern cpuop_func op_b0b9_5_nf;
 extern cpuop_func op_b0b9_5_ff;
-extern cpuop_func op_b0ba_5_nf;
 extern cpuop_func op_b0ba_5_ff;
-extern cpuop_func op_b0bb_5_nf;
 extern cpuop_func op_b0bb_5_ff;
-extern cpuop_func op_b0bc_5_nf;
 extern cpuop_func op_b0bc_5_ff;
-extern cpuop_func op_b0c0_5_nf;
 extern cpuop_func op_b0c0_5_ff;
-extern cpuop_func op_b0c8_5_nf;
 extern cpuop_func op_b0c8_5_ff;
-extern cpuop_func op_b0d0_5_nf;
 extern cpuop_func op_b0d0_5_ff;
-extern cpuop_func op_b0d8_5_nf;
 extern cpuop_func op_b0d8_5_ff;
-extern cpuop_func op_b0e0_5_nf;
 extern cpuop_func op_b0e0_5_ff;
-extern cpuop_func op_b0e8_5_nf;
 extern cpuop_func op_b0e8_5_ff;
-extern cpuop_func op_b0f0_5_nf;
 extern cpuop_func op_b0f0_5_ff;
-extern cpuop_func op_b0f8_5_nf;
 extern cpuop_func op_b0f8_5_ff;
-extern cpuop_func op_b0f9_5_nf;
 extern cpuop_func op_b0f9_5_ff;
-extern cpuop_func op_b0fa_5_nf;
 extern cpuop_func op_b0fa_5_ff;
-extern cpuop_func op_b0fb_5_nf;
 extern cpuop_func op_b0fb_5_ff;
-extern cpuop_func op_b0fc_5_nf;
 extern cpuop_func op_b0fc_5_ff;
-extern cpuop_func op_b100_5_nf;
 extern cpuop_func op_b100_5_ff;
-extern cpuop_func op_b108_5_nf;
 extern cpuop_func op_b108_5_ff;
-extern cpuop_func op_b110_5_nf;
 extern cpuop_func op_b110_5_ff;
-extern cpuop_func op_b118_5_nf;
 extern cpuop_func op_b118_5_ff;
-extern cpuop_func op_b120_5_nf;
 extern cpuop_func op_b120_5_ff;
-extern cpuop_func op_b128_5_nf;
 extern cpuop_func op_b128_5_ff;
-extern cpuop_func op_b130_5_nf;
 extern cpuop_func op_b130_5_ff;
-extern cpuop_func op_b138_5_nf;
 extern cpuop_func op_b138_5_ff;
-extern cpuop_func op_b139_5_nf;
 extern cpuop_func op_b139_5_ff;
-extern cpuop_func op_b140_5_nf;
 extern cpuop_func op_b140_5_ff;
-extern cpuop_func op_b148_5_nf;
 extern cpuop_func op_b148_5_ff;
-extern cpuop_func op_b150_5_nf;
 extern cpuop_func op_b150_5_ff;
-extern cpuop_func op_b158_5_nf;
 extern cpuop_func op_b158_5_ff;
-extern cpuop_func op_b160_5_nf;
 extern cpuop_func op_b160_5_ff;
-extern cpuop_func op_b168_5_nf;
 extern cpuop_func op_b168_5_ff;
-extern cpuop_func op_b170_5_nf;
 extern cpuop_func op_b170_5_ff;
-extern cpuop_func op_b178_5_nf;
 extern cpuop_func op_b178_5_ff;
-extern cpuop_func op_b179_5_nf;
 extern cpuop_func op_b179_5_ff;
-extern cpuop_func op_b180_5_nf;
 extern cpuop_func op_b180_5_ff;
-extern cpuop_func op_b188_5_nf;
 extern cpuop_func op_b188_5_ff;
-extern cpuop_func op_b190_5_nf;
 extern cpuop_func op_b190_5_ff;
-extern cpuop_func op_b198_5_nf;
 extern cpuop_func op_b198_5_ff;
-extern cpuop_func op_b1a0_5_nf;
 extern cpuop_func op_b1a0_5_ff;
-extern cpuop_func op_b1a8_5_nf;
 extern cpuop_func op_b1a8_5_ff;
-extern cpuop_func op_b1b0_5_nf;
 extern cpuop_func op_b1b0_5_ff;
-extern cpuop_func op_b1b8_5_nf;
 extern cpuop_func op_b1b8_5_ff;
-extern cpuop_func op_b1b9_5_nf;
 extern cpuop_func op_b1b9_5_ff;
-extern cpuop_func op_b1c0_5_nf;
 extern cpuop_func op_b1c0_5_ff;
-extern cpuop_func op_b1c8_5_nf;
 extern cpuop_func op_b1c8_5_ff;
-extern cpuop_func op_b1d0_5_nf;
 extern cpuop_func op_b1d0_5_ff;
-extern cpuop_func op_b1d8_5_nf;
 extern cpuop_func op_b1d8_5_ff;
-extern cpuop_func op_b1e0_5_nf;
 extern cpuop_func op_b1e0_5_ff;
-extern cpuop_func op_b1e8_5_nf;
 extern cpuop_func op_b1e8_5_ff;
-extern cpuop_func op_b1f0_5_nf;
 extern cpuop_func op_b1f0_5_ff;
-extern cpuop_func op_b1f8_5_nf;
 extern cpuop_func op_b1f8_5_ff;
-extern cpuop_func op_b1f9_5_nf;
 extern cpuop_func op_b1f9_5_ff;
-extern cpuop_func op_b1fa_5_nf;
 extern cpuop_func op_b1fa_5_ff;
-extern cpuop_func op_b1fb_5_nf;
 extern cpuop_func op_b1fb_5_ff;
-extern cpuop_func op_b1fc_5_nf;
 extern cpuop_func op_b1fc_5_ff;
-extern cpuop_func op_c000_5_nf;
 extern cpuop_func op_c000_5_ff;
-extern cpuop_func op_c010_5_nf;
 extern cpuop_func op_c010_5_ff;
-extern cpuop_func op_c018_5_nf;
 extern cpuop_func op_c018_5_ff;
-extern cpuop_func op_c020_5_nf;
 extern cpuop_func op_c020_5_ff;
-extern cpuop_func op_c028_5_nf;
 extern cpuop_func op_c028_5_ff;
-extern cpuop_func op_c030_5_nf;
 extern cpuop_func op_c030_5_ff;
-extern cpuop_func op_c038_5_nf;
 extern cpuop_func op_c038_5_ff;
-extern cpuop_func op_c039_5_nf;
 extern cpuop_func op_c039_5_ff;
-extern cpuop_func op_c03a_5_nf;
 extern cpuop_func op_c03a_5_ff;
-extern cpuop_func op_c03b_5_nf;
 extern cpuop_func op_c03b_5_ff;
-extern cpuop_func op_c03c_5_nf;
 extern cpuop_func op_c03c_5_ff;
-extern cpuop_func op_c040_5_nf;
 extern cpuop_func op_c040_5_ff;
-extern cpuop_func op_c050_5_nf;
 extern cpuop_func op_c050_5_ff;
-extern cpuop_func op_c058_5_nf;
 extern cpuop_func op_c058_5_ff;
-extern cpuop_func op_c060_5_nf;
 extern cpuop_func op_c060_5_ff;
-extern cpuop_func op_c068_5_nf;
 extern cpuop_func op_c068_5_ff;
-extern cpuop_func op_c070_5_nf;
 extern cpuop_func op_c070_5_ff;
-extern cpuop_func op_c078_5_nf;
 extern cpuop_func op_c078_5_ff;
-extern cpuop_func op_c079_5_nf;
 extern cpuop_func op_c079_5_ff;
-extern cpuop_func op_c07a_5_nf;
 extern cpuop_func op_c07a_5_ff;
-extern cpuop_func op_c07b_5_nf;
 extern cpuop_func op_c07b_5_ff;
-extern cpuop_func op_c07c_5_nf;
 extern cpuop_func op_c07c_5_ff;
-extern cpuop_func op_c080_5_nf;
 extern cpuop_func op_c080_5_ff;
-extern cpuop_func op_c090_5_nf;
 extern cpuop_func op_c090_5_ff;
-extern cpuop_func op_c098_5_nf;
 extern cpuop_func op_c098_5_ff;
-extern cpuop_func op_c0a0_5_nf;
 extern cpuop_func op_c0a0_5_ff;
-extern cpuop_func op_c0a8_5_nf;
 extern cpuop_func op_c0a8_5_ff;
-extern cpuop_func op_c0b0_5_nf;
 extern cpuop_func op_c0b0_5_ff;
-extern cpuop_func op_c0b8_5_nf;
 extern cpuop_func op_c0b8_5_ff;
-extern cpuop_func op_c0b9_5_nf;
 extern cpuop_func op_c0b9_5_ff;
-extern cpuop_func op_c0ba_5_nf;
 extern cpuop_func op_c0ba_5_ff;
-extern cpuop_func op_c0bb_5_nf;
 extern cpuop_func op_c0bb_5_ff;
-extern cpuop_func op_c0bc_5_nf;
 extern cpuop_func op_c0bc_5_ff;
-extern cpuop_func op_c0c0_5_nf;
 extern cpuop_func op_c0c0_5_ff;
-extern cpuop_func op_c0d0_5_nf;
 extern cpuop_func op_c0d0_5_ff;
-extern cpuop_func op_c0d8_5_nf;
 extern cpuop_func op_c0d8_5_ff;
-extern cpuop_func op_c0e0_5_nf;
 extern cpuop_func op_c0e0_5_ff;
-extern cpuop_func op_c0e8_5_nf;
 extern cpuop_func op_c0e8_5_ff;
-extern cpuop_func op_c0f0_5_nf;
 extern cpuop_func op_c0f0_5_ff;
-extern cpuop_func op_c0f8_5_nf;
 extern cpuop_func op_c0f8_5_ff;
-extern cpuop_func op_c0f9_5_nf;
 extern cpuop_func op_c0f9_5_ff;
-extern cpuop_func op_c0fa_5_nf;
 extern cpuop_func op_c0fa_5_ff;
-extern cpuop_func op_c0fb_5_nf;
 extern cpuop_func op_c0fb_5_ff;
-extern cpuop_func op_c0fc_5_nf;
 extern cpuop_func op_c0fc_5_ff;
-extern cpuop_func op_c100_5_nf;
 extern cpuop_func op_c100_5_ff;
-extern cpuop_func op_c108_5_nf;
 extern cpuop_func op_c108_5_ff;
-extern cpuop_func op_c110_5_nf;
 extern cpuop_func op_c110_5_ff;
-extern cpuop_func op_c118_5_nf;
 extern cpuop_func op_c118_5_ff;
-extern cpuop_func op_c120_5_nf;
 extern cpuop_func op_c120_5_ff;
-extern cpuop_func op_c128_5_nf;
 extern cpuop_func op_c128_5_ff;
-extern cpuop_func op_c130_5_nf;
 extern cpuop_func op_c130_5_ff;
-extern cpuop_func op_c138_5_nf;
 extern cpuop_func op_c138_5_ff;
-extern cpuop_func op_c139_5_nf;
 extern cpuop_func op_c139_5_ff;
-extern cpuop_func op_c140_5_nf;
 extern cpuop_func op_c140_5_ff;
-extern cpuop_func op_c148_5_nf;
 extern cpuop_func op_c148_5_ff;
-extern cpuop_func op_c150_5_nf;
 extern cpuop_func op_c150_5_ff;
-extern cpuop_func op_c158_5_nf;
 extern cpuop_func op_c158_5_ff;
-extern cpuop_func op_c160_5_nf;
 extern cpuop_func op_c160_5_ff;
-extern cpuop_func op_c168_5_nf;
 extern cpuop_func op_c168_5_ff;
-extern cpuop_func op_c170_5_nf;
 extern cpuop_func op_c170_5_ff;
-extern cpuop_func op_c178_5_nf;
 extern cpuop_func op_c178_5_ff;
-extern cpuop_func op_c179_5_nf;
 extern cpuop_func op_c179_5_ff;
-extern cpuop_func op_c188_5_nf;
 extern cpuop_func op_c188_5_ff;
-extern cpuop_func op_c190_5_nf;
 extern cpuop_func op_c190_5_ff;
-extern cpuop_func op_c198_5_nf;
 extern cpuop_func op_c198_5_ff;
-extern cpuop_func op_c1a0_5_nf;
 extern cpuop_func op_c1a0_5_ff;
-extern cpuop_func op_c1a8_5_nf;
 extern cpuop_func op_c1a8_5_ff;
-extern cpuop_func op_c1b0_5_nf;
 extern cpuop_func op_c1b0_5_ff;
-extern cpuop_func op_c1b8_5_nf;
 extern cpuop_func op_c1b8_5_ff;
-extern cpuop_func op_c1b9_5_nf;
 extern cpuop_func op_c1b9_5_ff;
-extern cpuop_func op_c1c0_5_nf;
 extern cpuop_func op_c1c0_5_ff;
-extern cpuop_func op_c1d0_5_nf;
 extern cpuop_func op_c1d0_5_ff;
-extern cpuop_func op_c1d8_5_nf;
 extern cpuop_func op_c1d8_5_ff;
-extern cpuop_func op_c1e0_5_nf;
 extern cpuop_func op_c1e0_5_ff;
-extern cpuop_func op_c1e8_5_nf;
 extern cpuop_func op_c1e8_5_ff;
-extern cpuop_func op_c1f0_5_nf;
 extern cpuop_func op_c1f0_5_ff;
-extern cpuop_func op_c1f8_5_nf;
 extern cpuop_func op_c1f8_5_ff;
-extern cpuop_func op_c1f9_5_nf;
 extern cpuop_func op_c1f9_5_ff;
-extern cpuop_func op_c1fa_5_nf;
 extern cpuop_func op_c1fa_5_ff;
-extern cpuop_func op_c1fb_5_nf;
 extern cpuop_func op_c1fb_5_ff;
-extern cpuop_func op_c1fc_5_nf;
 extern cpuop_func op_c1fc_5_ff;
-extern cpuop_func op_d000_5_nf;
 extern cpuop_func op_d000_5_ff;
-extern cpuop_func op_d010_5_nf;
 extern cpuop_func op_d010_5_ff;
-extern cpuop_func op_d018_5_nf;
 extern cpuop_func op_d018_5_ff;
-extern cpuop_func op_d020_5_nf;
 extern cpuop_func op_d020_5_ff;
-extern cpuop_func op_d028_5_nf;
 extern cpuop_func op_d028_5_ff;
-extern cpuop_func op_d030_5_nf;
 extern cpuop_func op_d030_5_ff;
-extern cpuop_func op_d038_5_nf;
 extern cpuop_func op_d038_5_ff;
-extern cpuop_func op_d039_5_nf;
 extern cpuop_func op_d039_5_ff;
-extern cpuop_func op_d03a_5_nf;
 extern cpuop_func op_d03a_5_ff;
-extern cpuop_func op_d03b_5_nf;
 extern cpuop_func op_d03b_5_ff;
-extern cpuop_func op_d03c_5_nf;
 extern cpuop_func op_d03c_5_ff;
-extern cpuop_func op_d040_5_nf;
 extern cpuop_func op_d040_5_ff;
-extern cpuop_func op_d048_5_nf;
 extern cpuop_func op_d048_5_ff;
-extern cpuop_func op_d050_5_nf;
 extern cpuop_func op_d050_5_ff;
-extern cpuop_func op_d058_5_nf;
 extern cpuop_func op_d058_5_ff;
-extern cpuop_func op_d060_5_nf;
 extern cpuop_func op_d060_5_ff;
-extern cpuop_func op_d068_5_nf;
 extern cpuop_func op_d068_5_ff;
-extern cpuop_func op_d070_5_nf;
 extern cpuop_func op_d070_5_ff;
-extern cpuop_func op_d078_5_nf;
 extern cpuop_func op_d078_5_ff;
-extern cpuop_func op_d079_5_nf;
 extern cpuop_func op_d079_5_ff;
-extern cpuop_func op_d07a_5_nf;
 extern cpuop_func op_d07a_5_ff;
-extern cpuop_func op_d07b_5_nf;
 extern cpuop_func op_d07b_5_ff;
-extern cpuop_func op_d07c_5_nf;
 extern cpuop_func op_d07c_5_ff;
-extern cpuop_func op_d080_5_nf;
 extern cpuop_func op_d080_5_ff;
-extern cpuop_func op_d088_5_nf;
 extern cpuop_func op_d088_5_ff;
-extern cpuop_func op_d090_5_nf;
 extern cpuop_func op_d090_5_ff;
-extern cpuop_func op_d098_5_nf;
 extern cpuop_func op_d098_5_ff;
-extern cpuop_func op_d0a0_5_nf;
 extern cpuop_func op_d0a0_5_ff;
-extern cpuop_func op_d0a8_5_nf;
 extern cpuop_func op_d0a8_5_ff;
-extern cpuop_func op_d0b0_5_nf;
 extern cpuop_func op_d0b0_5_ff;
-extern cpuop_func op_d0b8_5_nf;
 extern cpuop_func op_d0b8_5_ff;
-extern cpuop_func op_d0b9_5_nf;
 extern cpuop_func op_d0b9_5_ff;
-extern cpuop_func op_d0ba_5_nf;
 extern cpuop_func op_d0ba_5_ff;
-extern cpuop_func op_d0bb_5_nf;
 extern cpuop_func op_d0bb_5_ff;
-extern cpuop_func op_d0bc_5_nf;
 extern cpuop_func op_d0bc_5_ff;
-extern cpuop_func op_d0c0_5_nf;
 extern cpuop_func op_d0c0_5_ff;
-extern cpuop_func op_d0c8_5_nf;
 extern cpuop_func op_d0c8_5_ff;
-extern cpuop_func op_d0d0_5_nf;
 extern cpuop_func op_d0d0_5_ff;
-extern cpuop_func op_d0d8_5_nf;
 extern cpuop_func op_d0d8_5_ff;
-extern cpuop_func op_d0e0_5_nf;
 extern cpuop_func op_d0e0_5_ff;
-extern cpuop_func op_d0e8_5_nf;
 extern cpuop_func op_d0e8_5_ff;
-extern cpuop_func op_d0f0_5_nf;
 extern cpuop_func op_d0f0_5_ff;
-extern cpuop_func op_d0f8_5_nf;
 extern cpuop_func op_d0f8_5_ff;
-extern cpuop_func op_d0f9_5_nf;
 extern cpuop_func op_d0f9_5_ff;
-extern cpuop_func op_d0fa_5_nf;
 extern cpuop_func op_d0fa_5_ff;
-extern cpuop_func op_d0fb_5_nf;
 extern cpuop_func op_d0fb_5_ff;
-extern cpuop_func op_d0fc_5_nf;
 extern cpuop_func op_d0fc_5_ff;
-extern cpuop_func op_d100_5_nf;
 extern cpuop_func op_d100_5_ff;
-extern cpuop_func op_d108_5_nf;
 extern cpuop_func op_d108_5_ff;
-extern cpuop_func op_d110_5_nf;
 extern cpuop_func op_d110_5_ff;
-extern cpuop_func op_d118_5_nf;
 extern cpuop_func op_d118_5_ff;
-extern cpuop_func op_d120_5_nf;
 extern cpuop_func op_d120_5_ff;
-extern cpuop_func op_d128_5_nf;
 extern cpuop_func op_d128_5_ff;
-extern cpuop_func op_d130_5_nf;
 extern cpuop_func op_d130_5_ff;
-extern cpuop_func op_d138_5_nf;
 extern cpuop_func op_d138_5_ff;
-extern cpuop_func op_d139_5_nf;
 extern cpuop_func op_d139_5_ff;
-extern cpuop_func op_d140_5_nf;
 extern cpuop_func op_d140_5_ff;
-extern cpuop_func op_d148_5_nf;
 extern cpuop_func op_d148_5_ff;
-extern cpuop_func op_d150_5_nf;
 extern cpuop_func op_d150_5_ff;
-extern cpuop_func op_d158_5_nf;
 extern cpuop_func op_d158_5_ff;
-extern cpuop_func op_d160_5_nf;
 extern cpuop_func op_d160_5_ff;
-extern cpuop_func op_d168_5_nf;
 extern cpuop_func op_d168_5_ff;
-extern cpuop_func op_d170_5_nf;
 extern cpuop_func op_d170_5_ff;
-extern cpuop_func op_d178_5_nf;
 extern cpuop_func op_d178_5_ff;
-extern cpuop_func op_d179_5_nf;
 extern cpuop_func op_d179_5_ff;
-extern cpuop_func op_d180_5_nf;
 extern cpuop_func op_d180_5_ff;
-extern cpuop_func op_d188_5_nf;
 extern cpuop_func op_d188_5_ff;
-extern cpuop_func op_d190_5_nf;
 extern cpuop_func op_d190_5_ff;
-extern cpuop_func op_d198_5_nf;
 extern cpuop_func op_d198_5_ff;
-extern cpuop_func op_d1a0_5_nf;
 extern cpuop_func op_d1a0_5_ff;
-extern cpuop_func op_d1a8_5_nf;
 extern cpuop_func op_d1a8_5_ff;
-extern cpuop_func op_d1b0_5_nf;
 extern cpuop_func op_d1b0_5_ff;
-extern cpuop_func op_d1b8_5_nf;
 extern cpuop_func op_d1b8_5_ff;
-extern cpuop_func op_d1b9_5_nf;
 extern cpuop_func op_d1b9_5_ff;
-extern cpuop_func op_d1c0_5_nf;
 extern cpuop_func op_d1c0_5_ff;
-extern cpuop_func op_d1c8_5_nf;
 extern cpuop_func op_d1c8_5_ff;
-extern cpuop_func op_d1d0_5_nf;
 extern cpuop_func op_d1d0_5_ff;
-extern cpuop_func op_d1d8_5_nf;
 extern cpuop_func op_d1d8_5_ff;
-extern cpuop_func op_d1e0_5_nf;
 extern cpuop_func op_d1e0_5_ff;
-extern cpuop_func op_d1e8_5_nf;
 extern cpuop_func op_d1e8_5_ff;
-extern cpuop_func op_d1f0_5_nf;
 extern cpuop_func op_d1f0_5_ff;
-extern cpuop_func op_d1f8_5_nf;
 extern cpuop_func op_d1f8_5_ff;
-extern cpuop_func op_d1f9_5_nf;
 extern cpuop_func op_d1f9_5_ff;
-extern cpuop_func op_d1fa_5_nf;
 extern cpuop_func op_d1fa_5_ff;
-extern cpuop_func op_d1fb_5_nf;
 extern cpuop_func op_d1fb_5_ff;
-extern cpuop_func op_d1fc_5_nf;
 extern cpuop_func op_d1fc_5_ff;
-extern cpuop_func op_e000_5_nf;
 extern cpuop_func op_e000_5_ff;
-extern cpuop_func op_e008_5_nf;
 extern cpuop_func op_e008_5_ff;
-extern cpuop_func op_e010_5_nf;
 extern cpuop_func op_e010_5_ff;
-extern cpuop_func op_e018_5_nf;
 extern cpuop_func op_e018_5_ff;
-extern cpuop_func op_e020_5_nf;
 extern cpuop_func op_e020_5_ff;
-extern cpuop_func op_e028_5_nf;
 extern cpuop_func op_e028_5_ff;
-extern cpuop_func op_e030_5_nf;
 extern cpuop_func op_e030_5_ff;
-extern cpuop_func op_e038_5_nf;
 extern cpuop_func op_e038_5_ff;
-extern cpuop_func op_e040_5_nf;
 extern cpuop_func op_e040_5_ff;
-extern cpuop_func op_e048_5_nf;
 extern cpuop_func op_e048_5_ff;
-extern cpuop_func op_e050_5_nf;
 extern cpuop_func op_e050_5_ff;
-extern cpuop_func op_e058_5_nf;
 extern cpuop_func op_e058_5_ff;
-extern cpuop_func op_e060_5_nf;
 extern cpuop_func op_e060_5_ff;
-extern cpuop_func op_e068_5_nf;
 extern cpuop_func op_e068_5_ff;
-extern cpuop_func op_e070_5_nf;
 extern cpuop_func op_e070_5_ff;
-extern cpuop_func op_e078_5_nf;
 extern cpuop_func op_e078_5_ff;
-extern cpuop_func op_e080_5_nf;
 extern cpuop_func op_e080_5_ff;
-extern cpuop_func op_e088_5_nf;
 extern cpuop_func op_e088_5_ff;
-extern cpuop_func op_e090_5_nf;
 extern cpuop_func op_e090_5_ff;
-extern cpuop_func op_e098_5_nf;
 extern cpuop_func op_e098_5_ff;
-extern cpuop_func op_e0a0_5_nf;
 extern cpuop_func op_e0a0_5_ff;
-extern cpuop_func op_e0a8_5_nf;
 extern cpuop_func op_e0a8_5_ff;
-extern cpuop_func op_e0b0_5_nf;
 extern cpuop_func op_e0b0_5_ff;
-extern cpuop_func op_e0b8_5_nf;
 extern cpuop_func op_e0b8_5_ff;
-extern cpuop_func op_e0d0_5_nf;
 extern cpuop_func op_e0d0_5_ff;
-extern cpuop_func op_e0d8_5_nf;
 extern cpuop_func op_e0d8_5_ff;
-extern cpuop_func op_e0e0_5_nf;
 extern cpuop_func op_e0e0_5_ff;
-extern cpuop_func op_e0e8_5_nf;
 extern cpuop_func op_e0e8_5_ff;
-extern cpuop_func op_e0f0_5_nf;
 extern cpuop_func op_e0f0_5_ff;
-extern cpuop_func op_e0f8_5_nf;
 extern cpuop_func op_e0f8_5_ff;
-extern cpuop_func op_e0f9_5_nf;
 extern cpuop_func op_e0f9_5_ff;
-extern cpuop_func op_e100_5_nf;
 extern cpuop_func op_e100_5_ff;
-extern cpuop_func op_e108_5_nf;
 extern cpuop_func op_e108_5_ff;
-extern cpuop_func op_e110_5_nf;
 extern cpuop_func op_e110_5_ff;
-extern cpuop_func op_e118_5_nf;
 extern cpuop_func op_e118_5_ff;
-extern cpuop_func op_e120_5_nf;
 extern cpuop_func op_e120_5_ff;
-extern cpuop_func op_e128_5_nf;
 extern cpuop_func op_e128_5_ff;
-extern cpuop_func op_e130_5_nf;
 extern cpuop_func op_e130_5_ff;
-extern cpuop_func op_e138_5_nf;
 extern cpuop_func op_e138_5_ff;
-extern cpuop_func op_e140_5_nf;
 extern cpuop_func op_e140_5_ff;
-extern cpuop_func op_e148_5_nf;
 extern cpuop_func op_e148_5_ff;
-extern cpuop_func op_e150_5_nf;
 extern cpuop_func op_e150_5_ff;
-extern cpuop_func op_e158_5_nf;
 extern cpuop_func op_e158_5_ff;
-extern cpuop_func op_e160_5_nf;
 extern cpuop_func op_e160_5_ff;
-extern cpuop_func op_e168_5_nf;
 extern cpuop_func op_e168_5_ff;
-extern cpuop_func op_e170_5_nf;
 extern cpuop_func op_e170_5_ff;
-extern cpuop_func op_e178_5_nf;
 extern cpuop_func op_e178_5_ff;
-extern cpuop_func op_e180_5_nf;
 extern cpuop_func op_e180_5_ff;
-extern cpuop_func op_e188_5_nf;
 extern cpuop_func op_e188_5_ff;
-extern cpuop_func op_e190_5_nf;
 extern cpuop_func op_e190_5_ff;
-extern cpuop_func op_e198_5_nf;
 extern cpuop_func op_e198_5_ff;
-extern cpuop_func op_e1a0_5_nf;
 extern cpuop_func op_e1a0_5_ff;
-extern cpuop_func op_e1a8_5_nf;
 extern cpuop_func op_e1a8_5_ff;
-extern cpuop_func op_e1b0_5_nf;
 extern cpuop_func op_e1b0_5_ff;
-extern cpuop_func op_e1b8_5_nf;
 extern cpuop_func op_e1b8_5_ff;
-extern cpuop_func op_e1d0_5_nf;
 extern cpuop_func op_e1d0_5_ff;
-extern cpuop_func op_e1d8_5_nf;
 extern cpuop_func op_e1d8_5_ff;
-extern cpuop_func op_e1e0_5_nf;
 extern cpuop_func op_e1e0_5_ff;
-extern cpuop_func op_e1e8_5_nf;
 extern cpuop_func op_e1e8_5_ff;
-extern cpuop_func op_e1f0_5_nf;
 extern cpuop_func op_e1f0_5_ff;
-extern cpuop_func op_e1f8_5_nf;
 extern cpuop_func op_e1f8_5_ff;
-extern cpuop_func op_e1f9_5_nf;
 extern cpuop_func op_e1f9_5_ff;
-extern cpuop_func op_e2d0_5_nf;
 extern cpuop_func op_e2d0_5_ff;
-extern cpuop_func op_e2d8_5_nf;
 extern cpuop_func op_e2d8_5_ff;
-extern cpuop_func op_e2e0_5_nf;
 extern cpuop_func op_e2e0_5_ff;
-extern cpuop_func op_e2e8_5_nf;
 extern cpuop_func op_e2e8_5_ff;
-extern cpuop_func op_e2f0_5_nf;
 extern cpuop_func op_e2f0_5_ff;
-extern cpuop_func op_e2f8_5_nf;
 extern cpuop_func op_e2f8_5_ff;
-extern cpuop_func op_e2f9_5_nf;
 extern cpuop_func op_e2f9_5_ff;
-extern cpuop_func op_e3d0_5_nf;
 extern cpuop_func op_e3d0_5_ff;
-extern cpuop_func op_e3d8_5_nf;
 extern cpuop_func op_e3d8_5_ff;
-extern cpuop_func op_e3e0_5_nf;
 extern cpuop_func op_e3e0_5_ff;
-extern cpuop_func op_e3e8_5_nf;
 extern cpuop_func op_e3e8_5_ff;
-extern cpuop_func op_e3f0_5_nf;
 extern cpuop_func op_e3f0_5_ff;
-extern cpuop_func op_e3f8_5_nf;
 extern cpuop_func op_e3f8_5_ff;
-extern cpuop_func op_e3f9_5_nf;
 extern cpuop_func op_e3f9_5_ff;
-extern cpuop_func op_e4d0_5_nf;
 extern cpuop_func op_e4d0_5_ff;
-extern cpuop_func op_e4d8_5_nf;
 extern cpuop_func op_e4d8_5_ff;
-extern cpuop_func op_e4e0_5_nf;
 extern cpuop_func op_e4e0_5_ff;
-extern cpuop_func op_e4e8_5_nf;
 extern cpuop_func op_e4e8_5_ff;
-extern cpuop_func op_e4f0_5_nf;
 extern cpuop_func op_e4f0_5_ff;
-extern cpuop_func op_e4f8_5_nf;
 extern cpuop_func op_e4f8_5_ff;
-extern cpuop_func op_e4f9_5_nf;
 extern cpuop_func op_e4f9_5_ff;
-extern cpuop_func op_e5d0_5_nf;
 extern cpuop_func op_e5d0_5_ff;
-extern cpuop_func op_e5d8_5_nf;
 extern cpuop_func op_e5d8_5_ff;
-extern cpuop_func op_e5e0_5_nf;
 extern cpuop_func op_e5e0_5_ff;
-extern cpuop_func op_e5e8_5_nf;
 extern cpuop_func op_e5e8_5_ff;
-extern cpuop_func op_e5f0_5_nf;
 extern cpuop_func op_e5f0_5_ff;
-extern cpuop_func op_e5f8_5_nf;
 extern cpuop_func op_e5f8_5_ff;
-extern cpuop_func op_e5f9_5_nf;
 extern cpuop_func op_e5f9_5_ff;
-extern cpuop_func op_e6d0_5_nf;
 extern cpuop_func op_e6d0_5_ff;
-extern cpuop_func op_e6d8_5_nf;
 extern cpuop_func op_e6d8_5_ff;
-extern cpuop_func op_e6e0_5_nf;
 extern cpuop_func op_e6e0_5_ff;
-extern cpuop_func op_e6e8_5_nf;
 extern cpuop_func op_e6e8_5_ff;
-extern cpuop_func op_e6f0_5_nf;
 extern cpuop_func op_e6f0_5_ff;
-extern cpuop_func op_e6f8_5_nf;
 extern cpuop_func op_e6f8_5_ff;
-extern cpuop_func op_e6f9_5_nf;
 extern cpuop_func op_e6f9_5_ff;
-extern cpuop_func op_e7d0_5_nf;
 extern cpuop_func op_e7d0_5_ff;
-extern cpuop_func op_e7d8_5_nf;
 extern cpuop_func op_e7d8_5_ff;
-extern cpuop_func op_e7e0_5_nf;
 extern cpuop_func op_e7e0_5_ff;
-extern cpuop_func op_e7e8_5_nf;
 extern cpuop_func op_e7e8_5_ff;
-extern cpuop_func op_e7f0_5_nf;
 extern cpuop_func op_e7f0_5_ff;
-extern cpuop_func op_e7f8_5_nf;
 extern cpuop_func op_e7f8_5_ff;
-extern cpuop_func op_e7f9_5_nf;
 extern cpuop_func op_e7f9_5_ff;
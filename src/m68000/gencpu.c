@@ -77,6 +77,11 @@
 
 #define BOOL_TYPE "int"
 
+// Have ADD, SUB, CMP & the logical ops (MOVE, TST, AND...) just note their
+// operands, and leave working out the flags to whoever needs them (see
+// MakeFlags() & cctrue())
+#define LAZY_FLAGS
+
 static FILE *headerfile;
 static FILE *stblfile;
 
@@ -886,6 +891,41 @@ static void genflags (flagtypes type, wordsizes size, const char *value,
     }
 #endif
 
+#ifdef LAZY_FLAGS
+    {
+	int shift = (size == sz_byte ? 24 : size == sz_word ? 16 : 0);
+	const char *stype = (size == sz_byte ? "int8_t" : size == sz_word ? "int16_t" : "int32_t");
+	const char *utype = (size == sz_byte ? "uint8_t" : size == sz_word ? "uint16_t" : "uint32_t");
+
+	switch (type) {
+	 case flag_logical:
+	    printf ("\tSET_LAZY_LOGIC (%s, %d);\n", value, shift);
+	    return;
+
+	 case flag_add:
+	    start_brace ();
+	    printf ("uint32_t %s = ((%s)(%s)) + ((%s)(%s));\n", value, stype, dst, stype, src);
+	    printf ("\tSET_LAZY_ADD (%s, %s, %d);\n", src, dst, shift);
+	    /* X is the same as C, but isn't lazy */
+	    printf ("\tSET_XFLG (((%s)(~%s)) < ((%s)(%s)));\n", utype, dst, utype, src);
+	    return;
+
+	 case flag_sub:
+	 case flag_cmp:
+	    start_brace ();
+	    printf ("uint32_t %s = ((%s)(%s)) - ((%s)(%s));\n", value, stype, dst, stype, src);
+	    printf ("\tSET_LAZY_SUB (%s, %s, %d);\n", src, dst, shift);
+
+	    if (type == flag_sub)
+		printf ("\tSET_XFLG (((%s)(%s)) > ((%s)(%s)));\n", utype, src, utype, dst);
+	    return;
+
+	 default:
+	    break;
+	}
+    }
+#endif
+
     genflags_normal (type, size, value, src, dst);
 }
 
@@ -1736,7 +1776,7 @@ static void gen_opcode (unsigned long int opcode)
 	printf ("\tuint32_t oldpc = m68k_getpc();\n");
 	genamode (curi->smode, "srcreg", curi->size, "extra", 1, 0);
 	genamode (curi->dmode, "dstreg", curi->size, "dst", 2, 0);
-	printf ("\t{int32_t upper,lower,reg = regs.regs[(extra >> 12) & 15];\n");
+	printf ("\t{int32_t upper,lower,reg = regs.rn[(extra >> 12) & 15];\n");
 	switch (curi->size) {
 	case sz_byte:
 	    printf ("\tlower=(int32_t)(int8_t)m68k_read_memory_8(dsta); upper = (int32_t)(int8_t)m68k_read_memory_8(dsta+1);\n");
@@ -2183,14 +2223,14 @@ static void gen_opcode (unsigned long int opcode)
 	genamode (curi->smode, "srcreg", curi->size, "src", 1, 0);
 	start_brace ();
 	printf ("\tint regno = (src >> 12) & 15;\n");
-	printf ("\tuint32_t *regp = regs.regs + regno;\n");
+	printf ("\tuint32_t *regp = regs.rn + regno;\n");
 	printf ("\tif (! m68k_movec2(src & 0xFFF, regp)) goto %s;\n", endlabelstr);
 	break;
     case i_MOVE2C:
 	genamode (curi->smode, "srcreg", curi->size, "src", 1, 0);
 	start_brace ();
 	printf ("\tint regno = (src >> 12) & 15;\n");
-	printf ("\tuint32_t *regp = regs.regs + regno;\n");
+	printf ("\tuint32_t *regp = regs.rn + regno;\n");
 	printf ("\tif (! m68k_move2c(src & 0xFFF, regp)) goto %s;\n", endlabelstr);
 	break;
     case i_CAS:
@@ -2215,8 +2255,8 @@ static void gen_opcode (unsigned long int opcode)
     break;
     case i_CAS2:
 	genamode (curi->smode, "srcreg", curi->size, "extra", 1, 0);
-	printf ("\tuint32_t rn1 = regs.regs[(extra >> 28) & 15];\n");
-	printf ("\tuint32_t rn2 = regs.regs[(extra >> 12) & 15];\n");
+	printf ("\tuint32_t rn1 = regs.rn[(extra >> 28) & 15];\n");
+	printf ("\tuint32_t rn2 = regs.rn[(extra >> 12) & 15];\n");
 	if (curi->size == sz_word) {
 	    int old_brace_level = n_braces;
 	    printf ("\tuint16_t dst1 = m68k_read_memory_16(rn1), dst2 = m68k_read_memory_16(rn2);\n");
@@ -2256,7 +2296,7 @@ static void gen_opcode (unsigned long int opcode)
 	printf ("\tif (extra & 0x800)\n");
 	old_brace_level = n_braces;
 	start_brace ();
-	printf ("\tuint32_t src = regs.regs[(extra >> 12) & 15];\n");
+	printf ("\tuint32_t src = regs.rn[(extra >> 12) & 15];\n");
 	genamode (curi->dmode, "dstreg", curi->size, "dst", 2, 0);
 	genastore ("src", curi->dmode, "dstreg", curi->size, "dst");
 	pop_braces (old_brace_level);
@@ -2593,6 +2633,11 @@ static void GenerateTables(FILE * f)
 
 static int postfix;
 
+/* Where each opcode's own handler is in cpuFunctionTable[] (0 if it hasn't
+ * got one) */
+static uint16_t *handler_index;
+static int nr_handlers;
+
 static void generate_one_opcode (int rp)
 {
     int i;
@@ -2613,13 +2658,8 @@ static void generate_one_opcode (int rp)
     if (table68k[opcode].handler != -1)
 	return;
 
-    if (opcode_next_clev[rp] != cpu_level) {
-	fprintf (stblfile, "{ CPUFUNC(op_%lx_%d), 0, %ld }, /* %s */\n", opcode, opcode_last_postfix[rp],
-		 opcode, lookuptab[i].name);
-	return;
-    }
-    fprintf (stblfile, "{ CPUFUNC(op_%lx_%d), 0, %ld }, /* %s */\n", opcode, postfix, opcode, lookuptab[i].name);
-    fprintf (headerfile, "extern cpuop_func op_%lx_%d_nf;\n", opcode, postfix);
+    handler_index[opcode] = ++nr_handlers;
+    fprintf (stblfile, "\tCPUFUNC(op_%lx_%d),\t/* %s */\n", opcode, postfix, lookuptab[i].name);
     fprintf (headerfile, "extern cpuop_func op_%lx_%d_ff;\n", opcode, postfix);
     printf ("unsigned long CPUFUNC(op_%lx_%d)(uint32_t opcode) /* %s */\n{\n", opcode, postfix, lookuptab[i].name);
 
@@ -2716,70 +2756,90 @@ static void generate_one_opcode (int rp)
     opcode_last_postfix[rp] = postfix;
 }
 
+//
+// The Jaguar only has a 68000, and we always run it with prefetch & address
+// errors (UAE's "compatible" mode), so that's all that gets generated. (UAE
+// also makes a "fast" variant & ones for the 68010 on up, but we never used
+// them.)
+//
 static void generate_func(void)
 {
-	int i, j, rp;
-
-	using_prefetch = 0;
-	using_exception_3 = 0;
-//JLH:
-//	for(i=0; i<6; i++)
-//For some reason, this doesn't work properly. Seems something is making a bad
-//assumption somewhere.
-//and it's probably in opcode_next_clev[rp]...
-	for(i=4; i<6; i++)
+	int j, rp;
+
+	cpu_level = 0;
+	using_prefetch = 1;
+	using_exception_3 = 1;
+	postfix = 5;
+
+	for(rp=0; rp<nr_cpuop_funcs; rp++)
+		opcode_next_clev[rp] = 0;
+
+	fprintf(stblfile, "// Every handler, in the order cpuOpcodeIndex[] numbers them\n"
+		"cpuop_func * const cpuFunctionTable[] = {\n"
+		"\tIllegalOpcode,\n");
+
+	/* sam: this is for people with low memory (eg. me :)) */
+	printf("\n"
+		"#if !defined(PART_1) && !defined(PART_2) && "
+		"!defined(PART_3) && !defined(PART_4) && "
+		"!defined(PART_5) && !defined(PART_6) && "
+		"!defined(PART_7) && !defined(PART_8)"
+		"\n"
+		"#define PART_1 1\n"
+		"#define PART_2 1\n"
+		"#define PART_3 1\n"
+		"#define PART_4 1\n"
+		"#define PART_5 1\n"
+		"#define PART_6 1\n"
+		"#define PART_7 1\n"
+		"#define PART_8 1\n"
+		"#endif\n\n");
+
+	rp = 0;
+
+	for(j=1; j<=8; ++j)
 	{
-		cpu_level = 4 - i;
+		int k = (j * nr_cpuop_funcs) / 8;
+		printf("#ifdef PART_%d\n", j);
 
-		//JLH
-		for(rp=0; rp<nr_cpuop_funcs; rp++)
-			opcode_next_clev[rp] = 0;
+		for(; rp<k; rp++)
+			generate_one_opcode(rp);
 
-		if (i == 5)
-		{
-			cpu_level = 0;
-			using_prefetch = 1;
-			using_exception_3 = 1;
-	
-			for(rp=0; rp<nr_cpuop_funcs; rp++)
-				opcode_next_clev[rp] = 0;
-		}
+		printf ("#endif\n\n");
+	}
 
-		postfix = i;
-		fprintf(stblfile, "const struct cputbl CPUFUNC(op_smalltbl_%d)[] = {\n", postfix);
-
-		/* sam: this is for people with low memory (eg. me :)) */
-		printf("\n"
-			"#if !defined(PART_1) && !defined(PART_2) && "
-			"!defined(PART_3) && !defined(PART_4) && "
-			"!defined(PART_5) && !defined(PART_6) && "
-			"!defined(PART_7) && !defined(PART_8)"
-			"\n"
-			"#define PART_1 1\n"
-			"#define PART_2 1\n"
-			"#define PART_3 1\n"
-			"#define PART_4 1\n"
-			"#define PART_5 1\n"
-			"#define PART_6 1\n"
-			"#define PART_7 1\n"
-			"#define PART_8 1\n"
-			"#endif\n\n");
-
-		rp = 0;
-
-		for(j=1; j<=8; ++j)
-		{
-			int k = (j * nr_cpuop_funcs) / 8;
-			printf("#ifdef PART_%d\n", j);
+	fprintf(stblfile, "};\n\n");
+}
+
+//
+// Point every opcode at its handler, with the merges that do_merges() found
+// (opcodes that share a handler with another one) already resolved, so that
+// there's nothing left to do at run time
+//
+static void generate_dispatch_table(void)
+{
+	long int opcode;
 
-			for(; rp<k; rp++)
-				generate_one_opcode(rp);
+	fprintf(stblfile, "// Which handler each opcode goes to (0 is IllegalOpcode)\n"
+		"const uint16_t cpuOpcodeIndex[65536] = {\n");
 
-			printf ("#endif\n\n");
+	for(opcode=0; opcode<65536; opcode++)
+	{
+		int index = 0;
+
+		if (table68k[opcode].mnemo != i_ILLG && table68k[opcode].clev <= cpu_level)
+		{
+			index = handler_index[table68k[opcode].handler != -1 ? table68k[opcode].handler : opcode];
+
+			if (index == 0)
+				abort();
 		}
 
-		fprintf(stblfile, "{ 0, 0, 0 }};\n");
+		fprintf(stblfile, "%s%d,%s", ((opcode % 16) == 0 ? "\t" : ""), index,
+			((opcode % 16) == 15 ? "\n" : " "));
 	}
+
+	fprintf(stblfile, "};\n");
 }
 
 int main(int argc, char ** argv)
@@ -2791,6 +2851,7 @@ int main(int argc, char ** argv)
 	opcode_last_postfix = (int *)malloc(sizeof(int) * nr_cpuop_funcs);
 	opcode_next_clev = (int *)malloc(sizeof(int) * nr_cpuop_funcs);
 	counts = (unsigned long *)malloc(65536 * sizeof(unsigned long));
+	handler_index = (uint16_t *)calloc(65536, sizeof(uint16_t));
 	read_counts();
 
 	/* It would be a lot nicer to put all in one file (we'd also get rid of
@@ -2811,7 +2872,12 @@ int main(int argc, char ** argv)
 
 	GenerateTables(stdout);
 
+	fprintf(headerfile, "extern cpuop_func IllegalOpcode;\n"
+		"extern cpuop_func * const cpuFunctionTable[];\n"
+		"extern const uint16_t cpuOpcodeIndex[65536];\n\n");
+
 	generate_func();
+	generate_dispatch_table();
 
 	free(table68k);
 	return 0;
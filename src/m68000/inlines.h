@@ -12,8 +12,62 @@
 
 #include "cpudefs.h"
 
+//
+// The conditions are worked out straight from a pending SUB/CMP or logical op
+// where that's easy (which is most of the time, as they're usually what comes
+// right before a Bcc), so the flags themselves don't have to be
+//
 STATIC_INLINE int cctrue(const int cc)
 {
+	if (regs.flag_op == FLAGOP_SUB)
+	{
+		uint32_t src = regs.flag_src, dst = regs.flag_dst;
+
+		switch (cc)
+		{
+			case 0:  return 1;                            /* T */
+			case 1:  return 0;                            /* F */
+			case 2:  return dst > src;                    /* HI */
+			case 3:  return dst <= src;                   /* LS */
+			case 4:  return dst >= src;                   /* CC */
+			case 5:  return dst < src;                    /* CS */
+			case 6:  return dst != src;                   /* NE */
+			case 7:  return dst == src;                   /* EQ */
+			case 10: return (int32_t)(dst - src) >= 0;    /* PL */
+			case 11: return (int32_t)(dst - src) < 0;     /* MI */
+			case 12: return (int32_t)dst >= (int32_t)src; /* GE */
+			case 13: return (int32_t)dst < (int32_t)src;  /* LT */
+			case 14: return (int32_t)dst > (int32_t)src;  /* GT */
+			case 15: return (int32_t)dst <= (int32_t)src; /* LE */
+		}
+	}
+	else if (regs.flag_op == FLAGOP_LOGIC)
+	{
+		int32_t result = (int32_t)regs.flag_dst;
+
+		switch (cc)
+		{
+			case 0:  return 1;                       /* T */
+			case 1:  return 0;                       /* F */
+			case 2:  return result != 0;             /* HI */
+			case 3:  return result == 0;             /* LS */
+			case 4:  return 1;                       /* CC */
+			case 5:  return 0;                       /* CS */
+			case 6:  return result != 0;             /* NE */
+			case 7:  return result == 0;             /* EQ */
+			case 8:  return 1;                       /* VC */
+			case 9:  return 0;                       /* VS */
+			case 10: return result >= 0;             /* PL */
+			case 11: return result < 0;              /* MI */
+			case 12: return result >= 0;             /* GE */
+			case 13: return result < 0;              /* LT */
+			case 14: return result > 0;              /* GT */
+			case 15: return result <= 0;             /* LE */
+		}
+	}
+
+	FLAGS_SYNC;
+
 	switch (cc)
 	{
 		case 0:  return 1;                       /* T */
@@ -38,21 +92,29 @@ STATIC_INLINE int cctrue(const int cc)
 	return 0;
 }
 
-//no #define m68k_incpc(o) (regs.pc_p += (o))
-#define m68k_incpc(o) (regs.pc += (o))
+// The PC is kept twice: regs.pc is the 68K's address, and regs.pc_p is where
+// that is in host memory, so that fetching the instruction stream doesn't have
+// to go thru the memory handlers. Anything that changes one changes both.
+#define m68k_incpc(o) (regs.pc += (o), regs.pc_p += (o))
+
+void m68k_rebase_pc(void);
 
 STATIC_INLINE void m68k_setpc(uint32_t newpc)
 {
-	//This is only done here... (get_real_address())
-//	regs.pc_p = regs.pc_oldp = get_real_address(newpc);
 	regs.pc = newpc;
+
+	// Only have to go looking if it's outside of the current fetch window, &
+	// then m68k_execute() does it before the next instruction is fetched
+	if (newpc - regs.fetch_base < regs.fetch_size)
+		regs.pc_p = regs.pc_oldp + (newpc - regs.fetch_base);
+	else
+		regs.fetch_base = regs.fetch_size = 0;
 }
 
 #define m68k_setpc_rte  m68k_setpc
 
 STATIC_INLINE uint32_t m68k_getpc(void)
 {
-//	return regs.pc + ((char *)regs.pc_p - (char *)regs.pc_oldp);
 	return regs.pc;
 }
 
@@ -97,21 +159,16 @@ STATIC_INLINE void m68k_do_jsr(uint32_t oldpc, uint32_t dest)
 	m68k_setpc(dest);
 }
 
-#if 0
-//These do_get_mem_* functions are only used in newcpu...
-//What it does is use a pointer to make instruction fetching quicker,
-//though it probably leads to more problems than it solves. Something to
-//decide using a profiler...
-#define get_ibyte(o) do_get_mem_byte(regs.pc_p + (o) + 1)
-#define get_iword(o) do_get_mem_word(regs.pc_p + (o))
-#define get_ilong(o) do_get_mem_long(regs.pc_p + (o))
-#else
-// For now, we'll punt this crap...
+// Instruction fetches go straight thru regs.pc_p; the 68K is big endian, so
+// these put the bytes together the same way GET16/GET32 do.
 // (Also, notice that the byte read is at address + 1...)
-#define get_ibyte(o)	m68k_read_memory_8(regs.pc + (o) + 1)
-#define get_iword(o)	m68k_read_memory_16(regs.pc + (o))
-#define get_ilong(o)	m68k_read_memory_32(regs.pc + (o))
-#endif
+#define do_get_mem_byte(a)	((uint32_t)(a)[0])
+#define do_get_mem_word(a)	(((uint32_t)(a)[0] << 8) | (a)[1])
+#define do_get_mem_long(a)	(((uint32_t)(a)[0] << 24) | ((a)[1] << 16) | ((a)[2] << 8) | (a)[3])
+
+#define get_ibyte(o)	do_get_mem_byte(regs.pc_p + (o) + 1)
+#define get_iword(o)	do_get_mem_word(regs.pc_p + (o))
+#define get_ilong(o)	do_get_mem_long(regs.pc_p + (o))
 
 // We don't use this crap, so let's comment out for now...
 STATIC_INLINE void refill_prefetch(uint32_t currpc, uint32_t offs)
@@ -15,17 +15,13 @@
 #include "cpuextra.h"
 #include "inlines.h"
 #include "readcpu.h"
-
-
-// Stuff from m68kinterface.c
-extern unsigned long IllegalOpcode(uint32_t opcode);
-extern cpuop_func * cpuFunctionTable[65536];
+#include "cputbl.h"
 
 // Prototypes
 void HandleMovem(char * output, uint16_t data, int direction);
 
-// Local "global" variables
-static long int m68kpc_offset;
+// Local "global" variables (in M68KState; see cpudefs.h)
+#define m68kpc_offset	(CONTEXT(m68k).m68kpc_offset)
 
 #if 0
 #define get_ibyte_1(o) get_byte(regs.pc + (regs.pc_p - regs.pc_oldp) + (o) + 1)
@@ -338,9 +334,10 @@ unsigned int M68KDisassemble(char * output, uint32_t addr)
 	uint32_t opcode = get_iword_1(m68kpc_offset);
 	m68kpc_offset += 2;
 
-	if (cpuFunctionTable[opcode] == IllegalOpcode)
+	if (cpuOpcodeIndex[opcode] == 0)
 		opcode = 0x4AFC;
 
+	read_table68k();
 	struct instr * dp = table68k + opcode;
 
 	for(lookup=lookuptab; lookup->mnemo!=dp->mnemo; lookup++)
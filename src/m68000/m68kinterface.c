@@ -12,11 +12,14 @@
 //
 
 #include "m68kinterface.h"
+#include <string.h>								// For memcpy()
 //#include <pthread.h>
 #include "cpudefs.h"
 #include "inlines.h"
 #include "cpuextra.h"
 #include "readcpu.h"
+#include "cputbl.h"
+#include "profile.h"
 
 // Exception Vectors handled by emulation
 #define EXCEPTION_BUS_ERROR                2 /* This one is not emulated! */
@@ -35,15 +38,6 @@
 #define EXCEPTION_INTERRUPT_AUTOVECTOR    24
 #define EXCEPTION_TRAP_BASE               32
 
-// These are found in obj/cpustbl.c (generated by gencpu)
-
-//extern const struct cputbl op_smalltbl_0_ff[];	/* 68040 */
-//extern const struct cputbl op_smalltbl_1_ff[];	/* 68020 + 68881 */
-//extern const struct cputbl op_smalltbl_2_ff[];	/* 68020 */
-//extern const struct cputbl op_smalltbl_3_ff[];	/* 68010 */
-extern const struct cputbl op_smalltbl_4_ff[];	/* 68000 */
-extern const struct cputbl op_smalltbl_5_ff[];	/* 68000 slow but compatible.  */
-
 // Externs, supplied by the user...
 //extern int irq_ack_handler(int);
 
@@ -52,19 +46,16 @@ STATIC_INLINE void m68ki_check_interrupts(void);
 void m68ki_exception_interrupt(uint32_t intLevel);
 STATIC_INLINE uint32_t m68ki_init_exception(void);
 STATIC_INLINE void m68ki_stack_frame_3word(uint32_t pc, uint32_t sr);
-unsigned long IllegalOpcode(uint32_t opcode);
-void BuildCPUFunctionTable(void);
 void m68k_set_irq2(unsigned int intLevel);
 
-// Local "Global" vars
-static int32_t initialCycles;
-cpuop_func * cpuFunctionTable[65536];
+// Local "Global" vars (in M68KState; see cpudefs.h)
+#define initialCycles			(CONTEXT(m68k).initialCycles)
 
 // By virtue of the fact that m68k_set_irq() can be called asychronously by
 // another thread, we need something along the lines of this:
-static int checkForIRQToHandle = 0;
+#define checkForIRQToHandle		(CONTEXT(m68k).checkForIRQToHandle)
 //static pthread_mutex_t executionLock = PTHREAD_MUTEX_INITIALIZER;
-static int IRQLevelToHandle = 0;
+#define IRQLevelToHandle		(CONTEXT(m68k).IRQLevelToHandle)
 
 #if 0
 #define ADD_CYCLES(A)    m68ki_remaining_cycles += (A)
@@ -90,7 +81,7 @@ void Dasm(uint32_t offset, uint32_t qt)
 #ifdef CPU_DEBUG
 // back up a few instructions...
 //offset -= 100;
-	static char buffer[2048];//, mem[64];
+	char buffer[2048];//, mem[64];
 	int pc = offset, oldpc;
 	uint32_t i;
 
@@ -118,7 +109,7 @@ void DumpRegisters(void)
 
 	for(i=0; i<16; i++)
 	{
-		printf("%s%i: %08X ", (i < 8 ? "D" : "A"), i & 0x7, regs.regs[i]);
+		printf("%s%i: %08X ", (i < 8 ? "D" : "A"), i & 0x7, regs.rn[i]);
 
 		if ((i & 0x03) == 3)
 			printf("\n");
@@ -147,27 +138,8 @@ void m68k_set_cpu_type(unsigned int type)
 // Pulse the RESET line on the CPU
 void m68k_pulse_reset(void)
 {
-	static uint32_t emulation_initialized = 0;
-
-	// The first call to this function initializes the opcode handler jump table
-	if (!emulation_initialized)
-	{
-#if 0
-		m68ki_build_opcode_table();
-		m68k_set_int_ack_callback(NULL);
-		m68k_set_bkpt_ack_callback(NULL);
-		m68k_set_reset_instr_callback(NULL);
-		m68k_set_pc_changed_callback(NULL);
-		m68k_set_fc_callback(NULL);
-		m68k_set_instr_hook_callback(NULL);
-#else
-		// Build opcode handler table here...
-		read_table68k();
-		do_merges();
-		BuildCPUFunctionTable();
-#endif
-		emulation_initialized = 1;
-	}
+	// The opcode handler table comes ready made from gencpu (see cpustbl.c),
+	// so there's nothing to set up the first time thru here
 
 //	if (CPU_TYPE == 0)	/* KW 990319 */
 //		m68k_set_cpu_type(M68K_CPU_TYPE_68000);
@@ -246,6 +218,7 @@ int m68k_execute(int num_cycles)
 	/* Main loop.  Keep going until we run out of clock cycles */
 	do
 	{
+#ifdef DEBUG_HOOKS
 		// This is so our debugging code can break in on a dime.
 		// Otherwise, this is just extra slow down :-P
 		if (regs.spcflags & SPCFLAG_DEBUGGER)
@@ -257,6 +230,7 @@ int m68k_execute(int num_cycles)
 
 			return num_cycles;
 		}
+#endif
 #if 0
 		/* Set tracing accodring to T1. (T0 is done inside instruction) */
 		m68ki_trace_t1(); /* auto-disable (see m68kcpu.h) */
@@ -291,7 +265,7 @@ if (regs.pc == 0x803416)
 	hitCount++;
 	inRoutine = 1;
 	instSeen = 0;
-	printf("%i: $80340A start. A0=%08X, A1=%08X ", hitCount, regs.regs[8], regs.regs[9]);
+	printf("%i: $80340A start. A0=%08X, A1=%08X ", hitCount, regs.rn[8], regs.rn[9]);
 }
 else if (regs.pc == 0x803422)
 {
@@ -315,7 +289,7 @@ if (inRoutine)
 	if (regs.pc == 0x94C6)
 		go = 0;
 
-//	if (regs.regs[10] == 0xFFFFFFFF && go)
+//	if (regs.rn[10] == 0xFFFFFFFF && go)
 	if (go)
 	{
 //		printf("A2=-1, PC=%08X\n", regs.pc);
@@ -340,12 +314,18 @@ if (inRoutine)
 #ifdef M68K_HOOK_FUNCTION
 		M68KInstructionHook();
 #endif
+		// Branches move the PC by a displacement, and straight line code can
+		// run off the end of the window, so check it here
+		if (regs.pc - regs.fetch_base >= regs.fetch_size)
+			m68k_rebase_pc();
+
 		uint32_t opcode = get_iword(0);
+		ProfileM68KOpcode(opcode);
 //if ((opcode & 0xFFF8) == 0x31C0)
 //{
 //	printf("MOVE.W D%i, EA\n", opcode & 0x07);
 //}
-		int32_t cycles = (int32_t)(*cpuFunctionTable[opcode])(opcode);
+		int32_t cycles = (int32_t)(*cpuFunctionTable[cpuOpcodeIndex[opcode]])(opcode);
 		regs.remainingCycles -= cycles;
 //		pthread_mutex_unlock(&executionLock);
 
@@ -603,10 +583,87 @@ STATIC_INLINE void m68ki_stack_frame_3word(uint32_t pc, uint32_t sr)
 }
 
 
+//
+// How many bytes long the instruction with the given opcode is. On the 68000,
+// the opcode word is all it takes to tell.
+//
+static int InstructionLength(uint32_t opcode)
+{
+	read_table68k();
+	const struct instr * i = &table68k[opcode & 0xFFFF];
+	int length = 2;
+
+	if (i->mnemo == i_ILLG || i->clev > 0)
+		return length;
+
+	for(int j=0; j<2; j++)
+	{
+		if (!(j == 0 ? i->suse : i->duse))
+			continue;
+
+		switch (j == 0 ? i->smode : i->dmode)
+		{
+		case Ad16: case Ad8r: case absw: case PC16: case PC8r: case imm0: case imm1:
+			length += 2;
+			break;
+		case absl: case imm2:
+			length += 4;
+			break;
+		case imm:
+			length += (i->size == sz_long ? 4 : 2);
+			break;
+		}
+	}
+
+	return (length > M68K_MAX_INSTRUCTION ? M68K_MAX_INSTRUCTION : length);
+}
+
+
+//
+// Point regs.pc_p at regs.pc. If the PC is in memory we can see (RAM, ROM &
+// the BIOS), it goes straight there, and everything up to the end of that
+// memory becomes the new fetch window; anything else (like code running out of
+// the GPU's RAM) has its instruction read into fetch_buf the slow way. Reads
+// thru the memory handlers can have side effects, so only the words that make
+// up the instruction get read, just as if it had fetched them itself.
+//
+void m68k_rebase_pc(void)
+{
+	unsigned int start, size;
+	uint8_t * host = (regs.pc <= 0xFFFFFF ? M68KFetchWindow(regs.pc, &start, &size) : NULL);
+
+	// Leave room so the longest instruction at the end can't run off of it
+	if (host && size > M68K_MAX_INSTRUCTION && regs.pc - start < size - M68K_MAX_INSTRUCTION)
+	{
+		regs.fetch_base = start;
+		regs.fetch_size = size - M68K_MAX_INSTRUCTION;
+		regs.pc_oldp = host;
+		regs.pc_p = host + (regs.pc - start);
+		return;
+	}
+
+	uint32_t opcode = m68k_read_memory_16(regs.pc);
+	int length = InstructionLength(opcode);
+	regs.fetch_buf[0] = opcode >> 8;
+	regs.fetch_buf[1] = opcode & 0xFF;
+
+	for(int i=2; i<M68K_MAX_INSTRUCTION; i+=2)
+	{
+		uint32_t word = (i < length ? m68k_read_memory_16(regs.pc + i) : 0);
+		regs.fetch_buf[i + 0] = word >> 8;
+		regs.fetch_buf[i + 1] = word & 0xFF;
+	}
+
+	// No window, so the next instruction comes back here too
+	regs.fetch_base = regs.fetch_size = 0;
+	regs.pc_p = regs.fetch_buf;
+}
+
+
 unsigned int m68k_get_reg(void * context, m68k_register_t reg)
 {
 	if (reg <= M68K_REG_A7)
-		return regs.regs[reg];
+		return regs.rn[reg];
 	else if (reg == M68K_REG_PC)
 		return regs.pc;
 	else if (reg == M68K_REG_SR)
@@ -615,7 +672,7 @@ unsigned int m68k_get_reg(void * context, m68k_register_t reg)
 		return regs.sr;
 	}
 	else if (reg == M68K_REG_SP)
-		return regs.regs[15];
+		return regs.rn[15];
 
 	return 0;
 }
@@ -624,16 +681,113 @@ unsigned int m68k_get_reg(void * context, m68k_register_t reg)
 void m68k_set_reg(m68k_register_t reg, unsigned int value)
 {
 	if (reg <= M68K_REG_A7)
-		regs.regs[reg] = value;
+		regs.rn[reg] = value;
 	else if (reg == M68K_REG_PC)
-		regs.pc = value;
+		m68k_setpc(value);
 	else if (reg == M68K_REG_SR)
 	{
 		regs.sr = value;
 		MakeFromSR();
 	}
 	else if (reg == M68K_REG_SP)
-		regs.regs[15] = value;
+		regs.rn[15] = value;
+}
+
+
+// A flat copy of the CPU's state. We don't save regs as-is because of the
+// host pointers in there.
+typedef struct
+{
+	uint32_t rn[16];
+	uint32_t usp, isp;
+	uint16_t sr;
+	uint8_t s, stopped;
+	int32_t intmask, intLevel;
+	uint32_t c, z, n, v, x;
+	uint32_t pc, spcflags;
+	uint32_t prefetch_pc, prefetch;
+	int32_t remainingCycles;
+	uint32_t interruptCycles;
+	int32_t initial_cycles;
+	int32_t check_for_irq, irq_level;
+} m68k_context;
+
+
+unsigned int m68k_context_size(void)
+{
+	return sizeof(m68k_context);
+}
+
+
+unsigned int m68k_get_context(void * dst)
+{
+	m68k_context * ctx = (m68k_context *)dst;
+
+	if (ctx)
+	{
+		memset(ctx, 0, sizeof(m68k_context));
+		FLAGS_SYNC;
+		memcpy(ctx->rn, regs.rn, sizeof(ctx->rn));
+		ctx->usp = regs.usp;
+		ctx->isp = regs.isp;
+		ctx->sr = regs.sr;
+		ctx->s = regs.s;
+		ctx->stopped = regs.stopped;
+		ctx->intmask = regs.intmask;
+		ctx->intLevel = regs.intLevel;
+		ctx->c = regs.c;
+		ctx->z = regs.z;
+		ctx->n = regs.n;
+		ctx->v = regs.v;
+		ctx->x = regs.x;
+		ctx->pc = regs.pc;
+		ctx->spcflags = regs.spcflags;
+		ctx->prefetch_pc = regs.prefetch_pc;
+		ctx->prefetch = regs.prefetch;
+		ctx->remainingCycles = regs.remainingCycles;
+		ctx->interruptCycles = regs.interruptCycles;
+		ctx->initial_cycles = initialCycles;
+		ctx->check_for_irq = checkForIRQToHandle;
+		ctx->irq_level = IRQLevelToHandle;
+	}
+
+	return sizeof(m68k_context);
+}
+
+
+void m68k_set_context(void * src)
+{
+	m68k_context * ctx = (m68k_context *)src;
+
+	if (!ctx)
+		return;
+
+	memcpy(regs.rn, ctx->rn, sizeof(ctx->rn));
+	regs.usp = ctx->usp;
+	regs.isp = ctx->isp;
+	regs.sr = ctx->sr;
+	regs.s = ctx->s;
+	regs.stopped = ctx->stopped;
+	regs.intmask = ctx->intmask;
+	regs.intLevel = ctx->intLevel;
+	regs.flag_op = FLAGOP_NONE;
+	regs.c = ctx->c;
+	regs.z = ctx->z;
+	regs.n = ctx->n;
+	regs.v = ctx->v;
+	regs.x = ctx->x;
+	regs.pc = ctx->pc;
+	// Memory may not be in yet, so leave finding the PC to m68k_execute()
+	regs.pc_p = regs.pc_oldp = NULL;
+	regs.fetch_base = regs.fetch_size = 0;
+	regs.spcflags = ctx->spcflags;
+	regs.prefetch_pc = ctx->prefetch_pc;
+	regs.prefetch = ctx->prefetch;
+	regs.remainingCycles = ctx->remainingCycles;
+	regs.interruptCycles = ctx->interruptCycles;
+	initialCycles = ctx->initial_cycles;
+	checkForIRQToHandle = ctx->check_for_irq;
+	IRQLevelToHandle = ctx->irq_level;
 }
 
 
@@ -644,7 +798,7 @@ unsigned int m68k_is_valid_instruction(unsigned int instruction, unsigned int cp
 {
 	instruction &= 0xFFFF;
 
-	if (cpuFunctionTable[instruction] == IllegalOpcode)
+	if (cpuOpcodeIndex[instruction] == 0)
 		return 0;
 
 	return 1;
@@ -710,53 +864,33 @@ unsigned long IllegalOpcode(uint32_t opcode)
 }
 
 
-void BuildCPUFunctionTable(void)
+//
+// Which of UAE's instruction families (MOVE, ADD, Bcc...) an opcode belongs
+// to, for the profiler. The table this comes from is only read in the first
+// time something asks, since running the CPU doesn't need it.
+//
+//
+// The instruction table is shared by every machine (see context.h), so this
+// gets it read in before any of them can be running
+//
+void m68k_fill_tables(void)
 {
-	int i;
-	unsigned long opcode;
-
-	// We're only using the "fast" 68000 emulation here, not the "compatible"
-	// ("fast" doesn't throw exceptions, so we're using "compatible" now :-P)
-#if 0
-	const struct cputbl * tbl = (currprefs.cpu_compatible
-		? op_smalltbl_5_ff : op_smalltbl_4_ff);
-#else
-//let's try "compatible" and see what happens here...
-//	const struct cputbl * tbl = op_smalltbl_4_ff;
-	const struct cputbl * tbl = op_smalltbl_5_ff;
-#endif
-
-//	Log_Printf(LOG_DEBUG, "Building CPU function table (%d %d %d).\n",
-//		currprefs.cpu_level, currprefs.cpu_compatible, currprefs.address_space_24);
-
-	// Set all instructions to Illegal...
-	for(opcode=0; opcode<65536; opcode++)
-		cpuFunctionTable[opcode] = IllegalOpcode;
+	read_table68k();
+}
 
-	// Move functions from compact table into our full function table...
-	for(i=0; tbl[i].handler!=NULL; i++)
-		cpuFunctionTable[tbl[i].opcode] = tbl[i].handler;
 
-//JLH: According to readcpu.c, handler is set to -1 and never changes.
-// Actually, it does read this crap in readcpu.c, do_merges() does it... :-P
-// Again, seems like a build time thing could be done here...
-#if 1
-	for(opcode=0; opcode<65536; opcode++)
-	{
-//		if (table68k[opcode].mnemo == i_ILLG || table68k[opcode].clev > currprefs.cpu_level)
-		if (table68k[opcode].mnemo == i_ILLG || table68k[opcode].clev > 0)
-			continue;
+unsigned int m68k_opcode_family(unsigned int opcode)
+{
+	read_table68k();
+	return table68k[opcode & 0xFFFF].mnemo;
+}
 
-		if (table68k[opcode].handler != -1)
-		{
-//printf("Relocate: $%04X->$%04X\n", table68k[opcode].handler, opcode);
-			cpuop_func * f = cpuFunctionTable[table68k[opcode].handler];
 
-			if (f == IllegalOpcode)
-				abort();
+const char * m68k_opcode_family_name(unsigned int family)
+{
+	for(int i=0; lookuptab[i].name[0]; i++)
+		if (lookuptab[i].mnemo == family)
+			return lookuptab[i].name;
 
-			cpuFunctionTable[opcode] = f;
-		}
-	}
-#endif
+	return "???";
 }
@@ -88,11 +88,19 @@ void m68k_write_memory_32(unsigned int address, unsigned int value);
 
 int irq_ack_handler(int);
 
+// Where the CPU can fetch instructions at address straight out of host memory:
+// returns the host pointer to the start of that memory and sets start & size to
+// the 68K addresses it covers, or returns NULL if it has to use the read
+// functions above
+unsigned char * M68KFetchWindow(unsigned int address, unsigned int * start, unsigned int * size);
+
 // Convenience functions
 
 // Uncomment this to have the emulated CPU call a hook function after every instruction
 // NB: This must be implemented by the user!
+#ifdef DEBUG_HOOKS
 #define M68K_HOOK_FUNCTION
+#endif
 #ifdef M68K_HOOK_FUNCTION
 void M68KInstructionHook(void);
 #endif
@@ -110,6 +118,13 @@ unsigned int m68k_get_reg(void * context, m68k_register_t reg);
 /* Poke values into the internals of the currently running CPU context */
 void m68k_set_reg(m68k_register_t reg, unsigned int value);
 
+/* Get/set the entire CPU context (for save states). The context holds no
+ * pointers, so it can be written out and read back in as-is.
+ */
+unsigned int m68k_context_size(void);
+unsigned int m68k_get_context(void * dst);
+void m68k_set_context(void * src);
+
 // Dummy functions, for now...
 
 /* Check if an instruction is valid for the specified CPU type */
@@ -130,6 +145,13 @@ int m68k_cycles_remaining(void);        // Number of cycles left
 void m68k_modify_timeslice(int cycles); // Modify cycles left
 void m68k_end_timeslice(void);          // End timeslice now
 
+// Shared tables
+void m68k_fill_tables(void);
+
+// Profiling support
+unsigned int m68k_opcode_family(unsigned int opcode);
+const char * m68k_opcode_family_name(unsigned int family);
+
 #ifdef __cplusplus
 }
 #endif
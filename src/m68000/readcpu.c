@@ -940,6 +940,11 @@ nomatch:
 void read_table68k(void)
 {
 	int i;
+
+	// Only has to be done once
+	if (table68k)
+		return;
+
 	table68k = (struct instr *)malloc(65536 * sizeof(struct instr));
 
 	for(i=0; i<65536; i++)
@@ -21,6 +21,10 @@
 #include "jagbios.h"
 #include "wavetable.h"
 
+// The memory map below points straight at the one & only jagMemSpace & its
+// registers, so there's no MMU in multi-instance builds (see context.h)
+#ifndef MULTI_INSTANCE
+
 /*
 Addresses to be handled:
 
@@ -603,3 +607,4 @@ uint64_t MMURead64(uint32_t address, uint32_t who/*= UNKNOWN*/)
 	return 0;
 }
 
+#endif	// !MULTI_INSTANCE
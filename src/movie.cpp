@@ -0,0 +1,514 @@
+//
+// movie.cpp: Input recording & playback
+//
+// A movie is the state the machine was in when recording started, followed by
+// what was on both joypads for every frame after that. Since the emulation is
+// deterministic, playing the inputs back from that state gives the exact same
+// run--which makes a movie a good way to check that a change to the core
+// didn't change anything, using real gameplay rather than attract mode.
+//
+// Every so often, a CRC of main RAM & of the screen goes in after a frame's
+// input; when playing back, these are checked to catch a desync at (or at
+// least, close to) where it happened.
+//
+// Loading a state doesn't have to end a movie, as long as the state is on the
+// movie's timeline (rewind & run-ahead do this all the time). Every state
+// carries the frame # it was saved at along with a hash of all the input that
+// got it there (seeded with a CRC of the starting state), & we keep the same
+// hash for every frame of the movie; if they agree, the movie just picks up
+// from that frame. When recording, whatever was recorded after it is thrown
+// away. A state from anywhere else stops the movie.
+//
+// File layout (all values in host byte order, like the save states):
+//
+//   MovieHeader
+//   state (header.stateSize bytes, as made by SaveState())
+//   for each frame:
+//     uint32_t buttons[2]           joypad0/1Buttons, one bit per button
+//     uint32_t crc[2]               RAM & screen CRCs, only after every
+//                                   header.checkInterval frames
+//
+
+#include "movie.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "crc32.h"
+#include "jaguar.h"
+#include "joystick.h"
+#include "log.h"
+#include "settings.h"
+#include "state.h"
+
+#define MOVIE_MAGIC			0x564D4A56			// "VJMV"
+#define MOVIE_VERSION		1
+
+// The settings that change what the emulated machine does (as opposed to how
+// fast we get there, like the recompiler or the fast blitter)
+
+#define MOVIE_NTSC			0x01
+#define MOVIE_BIOS			0x02
+#define MOVIE_GPU			0x04
+#define MOVIE_DSP			0x08
+#define MOVIE_PIPELINED_DSP	0x10
+#define MOVIE_ALPINE		0x20
+#define MOVIE_BIOS_TYPE(s)	(((s) >> 8) & 0xFF)
+
+struct MovieHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t romCRC;							// What it was recorded on
+	uint32_t settings;							// MOVIE_* flags
+	uint32_t checkInterval;						// Frames between CRCs
+	uint32_t stateSize;							// Size of the starting state
+};
+
+enum { MOVIE_OFF = 0, MOVIE_RECORDING, MOVIE_PLAYING };
+
+// (MOVIE_OFF is 0, so a fresh MovieState is off)
+
+#ifndef MULTI_INSTANCE
+struct MovieState movieState;
+#endif
+
+#define movieFile			(CONTEXT(movie).movieFile)
+#define movieMode			(CONTEXT(movie).movieMode)
+#define movieInterval		(CONTEXT(movie).movieInterval)
+#define movieFrame			(CONTEXT(movie).movieFrame)
+#define movieLength			(CONTEXT(movie).movieLength)
+#define movieDesyncs		(CONTEXT(movie).movieDesyncs)
+#define oldSettings			(CONTEXT(movie).oldSettings)
+#define movieStart			(CONTEXT(movie).movieStart)
+#define movieHash			(CONTEXT(movie).movieHash)
+#define movieHashSize		(CONTEXT(movie).movieHashSize)
+
+
+static uint32_t GetSettings(void)
+{
+	return (vjs.hardwareTypeNTSC ? MOVIE_NTSC : 0) | (vjs.useJaguarBIOS ? MOVIE_BIOS : 0)
+		| (vjs.GPUEnabled ? MOVIE_GPU : 0) | (vjs.DSPEnabled ? MOVIE_DSP : 0)
+		| (vjs.usePipelinedDSP ? MOVIE_PIPELINED_DSP : 0) | (vjs.hardwareTypeAlpine ? MOVIE_ALPINE : 0)
+		| ((vjs.biosType & 0xFF) << 8);
+}
+
+
+static void SetSettings(uint32_t settings)
+{
+	vjs.hardwareTypeNTSC = (settings & MOVIE_NTSC ? true : false);
+	vjs.useJaguarBIOS = (settings & MOVIE_BIOS ? true : false);
+	vjs.GPUEnabled = (settings & MOVIE_GPU ? true : false);
+	vjs.DSPEnabled = (settings & MOVIE_DSP ? true : false);
+	vjs.usePipelinedDSP = (settings & MOVIE_PIPELINED_DSP ? true : false);
+	vjs.hardwareTypeAlpine = (settings & MOVIE_ALPINE ? true : false);
+	vjs.biosType = MOVIE_BIOS_TYPE(settings);
+}
+
+
+static uint32_t PackButtons(const uint8_t * buttons)
+{
+	uint32_t bits = 0;
+
+	for(int i=BUTTON_FIRST; i<=BUTTON_LAST; i++)
+		bits |= (buttons[i] ? 1 << i : 0);
+
+	return bits;
+}
+
+
+static void UnpackButtons(uint32_t bits, uint8_t * buttons)
+{
+	for(int i=BUTTON_FIRST; i<=BUTTON_LAST; i++)
+		buttons[i] = (bits & (1 << i) ? 0xFF : 0x00);
+}
+
+
+//
+// Where the given frame's input is in the file
+//
+static long FrameOffset(uint32_t frame)
+{
+	return movieStart + (long)(((frame * 2) + ((frame / movieInterval) * 2)) * sizeof(uint32_t));
+}
+
+
+//
+// Set the input hash after the given frame, given the input for that frame
+//
+static bool SetHash(uint32_t frame, const uint32_t * buttons)
+{
+	if (frame + 1 >= movieHashSize)
+	{
+		uint32_t size = (movieHashSize ? movieHashSize * 2 : 4096);
+		uint32_t * hash = (uint32_t *)realloc(movieHash, size * sizeof(uint32_t));
+
+		if (!hash)
+			return false;
+
+		movieHash = hash;
+		movieHashSize = size;
+	}
+
+	movieHash[frame + 1] = crc32_update(movieHash[frame], (const unsigned char *)buttons, 2 * sizeof(uint32_t));
+
+	return true;
+}
+
+
+//
+// Start recording to the given file, from the machine's current state
+//
+bool MovieRecord(const char * path, uint32_t checkInterval/*= MOVIE_CHECK_INTERVAL*/)
+{
+	MovieStop();
+
+	size_t stateSize = StateSize();
+	uint8_t * state = (uint8_t *)malloc(stateSize);
+
+	if (!state || !SaveState(state, stateSize))
+	{
+		WriteLog("MOVIE: Could not save the starting state!\n");
+		free(state);
+		return false;
+	}
+
+	movieFile = fopen(path, "wb");
+
+	if (!movieFile)
+	{
+		WriteLog("MOVIE: Could not create \"%s\"!\n", path);
+		free(state);
+		return false;
+	}
+
+	MovieHeader header;
+	header.magic = MOVIE_MAGIC;
+	header.version = MOVIE_VERSION;
+	header.romCRC = jaguarMainROMCRC32;
+	header.settings = GetSettings();
+	header.checkInterval = (checkInterval ? checkInterval : MOVIE_CHECK_INTERVAL);
+	header.stateSize = (uint32_t)stateSize;
+
+	bool ok = (fwrite(&header, sizeof(header), 1, movieFile) == 1)
+		&& (fwrite(state, stateSize, 1, movieFile) == 1);
+	uint32_t seed = crc32_update(0, state, (unsigned int)stateSize);
+	free(state);
+
+	if (ok && !(movieHash = (uint32_t *)malloc(4096 * sizeof(uint32_t))))
+		ok = false;
+
+	if (!ok)
+	{
+		WriteLog("MOVIE: Could not write to \"%s\"!\n", path);
+		fclose(movieFile);
+		movieFile = NULL;
+		return false;
+	}
+
+	movieMode = MOVIE_RECORDING;
+	movieInterval = header.checkInterval;
+	movieFrame = movieLength = movieDesyncs = 0;
+	movieStart = ftell(movieFile);
+	movieHashSize = 4096;
+	movieHash[0] = seed;
+	WriteLog("MOVIE: Recording to \"%s\"...\n", path);
+
+	return true;
+}
+
+
+//
+// Start playing back the given file. This puts the machine into the state the
+// movie starts from, & the settings it was recorded with.
+//
+bool MoviePlay(const char * path)
+{
+	MovieStop();
+
+	movieFile = fopen(path, "rb");
+
+	if (!movieFile)
+	{
+		WriteLog("MOVIE: Could not open \"%s\"!\n", path);
+		return false;
+	}
+
+	MovieHeader header;
+	uint8_t * state = NULL;
+	const char * error = NULL;
+
+	if (fread(&header, sizeof(header), 1, movieFile) != 1 || header.magic != MOVIE_MAGIC)
+		error = "not a movie";
+	else if (header.version != MOVIE_VERSION)
+		error = "wrong movie version";
+	else if (header.romCRC != jaguarMainROMCRC32)
+		error = "recorded with a different ROM";
+	else if (header.stateSize != StateSize() || header.checkInterval == 0)
+		error = "recorded with an incompatible version of the emulator";
+	else if (!(state = (uint8_t *)malloc(header.stateSize)))
+		error = "out of memory";
+	else if (fread(state, header.stateSize, 1, movieFile) != 1)
+		error = "file is truncated";
+
+	uint32_t seed = (state ? crc32_update(0, state, header.stateSize) : 0);
+
+	if (!error)
+	{
+		oldSettings = GetSettings();
+		SetSettings(header.settings);
+
+		if (!LoadState(state, header.stateSize))
+		{
+			SetSettings(oldSettings);
+			error = "starting state is corrupt";
+		}
+	}
+
+	free(state);
+
+	if (error)
+	{
+		WriteLog("MOVIE: Can't play \"%s\": %s!\n", path, error);
+		fclose(movieFile);
+		movieFile = NULL;
+		return false;
+	}
+
+	// Every checkInterval frames take up (checkInterval * 2) + 2 longs
+	long start = ftell(movieFile);
+	fseek(movieFile, 0, SEEK_END);
+	uint32_t longs = (uint32_t)((ftell(movieFile) - start) / sizeof(uint32_t));
+	fseek(movieFile, start, SEEK_SET);
+	uint32_t blockSize = (header.checkInterval * 2) + 2;
+	movieLength = ((longs / blockSize) * header.checkInterval) + ((longs % blockSize) / 2);
+
+	movieMode = MOVIE_PLAYING;
+	movieInterval = header.checkInterval;
+	movieFrame = movieDesyncs = 0;
+	movieStart = start;
+
+	// Hash the whole movie's input up front, so that a state saved anywhere
+	// along it can be loaded
+	movieHash = (uint32_t *)malloc((movieLength + 1) * sizeof(uint32_t));
+	movieHashSize = movieLength + 1;
+
+	if (!movieHash)
+	{
+		WriteLog("MOVIE: Can't play \"%s\": out of memory!\n", path);
+		MovieStop();
+		return false;
+	}
+
+	movieHash[0] = seed;
+
+	for(uint32_t i=0; i<movieLength; i++)
+	{
+		uint32_t buttons[2];
+		fseek(movieFile, FrameOffset(i), SEEK_SET);
+
+		if (fread(buttons, sizeof(buttons), 1, movieFile) != 1)
+			buttons[0] = buttons[1] = 0;
+
+		SetHash(i, buttons);
+	}
+
+	fseek(movieFile, start, SEEK_SET);
+
+	WriteLog("MOVIE: Playing \"%s\" (%u frames)...\n", path, movieLength);
+
+	return true;
+}
+
+
+void MovieStop(void)
+{
+	if (movieMode == MOVIE_PLAYING)
+	{
+		SetSettings(oldSettings);
+		WriteLog("MOVIE: Playback stopped after %u of %u frames, %u desync%s.\n", movieFrame,
+			movieLength, movieDesyncs, (movieDesyncs == 1 ? "" : "s"));
+	}
+	else if (movieMode == MOVIE_RECORDING)
+		WriteLog("MOVIE: Recording stopped after %u frames.\n", movieFrame);
+
+	if (movieFile)
+		fclose(movieFile);
+
+	free(movieHash);
+	movieFile = NULL;
+	movieHash = NULL;
+	movieHashSize = 0;
+	movieMode = MOVIE_OFF;
+}
+
+
+bool MovieIsRecording(void)
+{
+	return (movieMode == MOVIE_RECORDING);
+}
+
+
+bool MovieIsPlaying(void)
+{
+	return (movieMode == MOVIE_PLAYING);
+}
+
+
+//
+// Whether the coming frame ends with a CRC check; if so, the frame has to be
+// drawn (even when frame skipping), so that there's a screen to check
+//
+bool MovieCheckDue(void)
+{
+	return (movieMode != MOVIE_OFF && ((movieFrame + 1) % movieInterval) == 0);
+}
+
+
+//
+// Call once a frame, after the frontend's input is in joypad0/1Buttons & before
+// the frame is run. When recording, this writes the input out; when playing
+// back, it replaces it with what was recorded.
+//
+void MovieInput(void)
+{
+	uint32_t buttons[2];
+
+	if (movieMode == MOVIE_RECORDING)
+	{
+		buttons[0] = PackButtons(joypad0Buttons);
+		buttons[1] = PackButtons(joypad1Buttons);
+
+		if (fwrite(buttons, sizeof(buttons), 1, movieFile) != 1 || !SetHash(movieFrame, buttons))
+		{
+			WriteLog("MOVIE: Could not write frame #%u!\n", movieFrame);
+			MovieStop();
+		}
+	}
+	else if (movieMode == MOVIE_PLAYING)
+	{
+		if (fread(buttons, sizeof(buttons), 1, movieFile) != 1)
+		{
+			MovieStop();
+			return;
+		}
+
+		UnpackButtons(buttons[0], joypad0Buttons);
+		UnpackButtons(buttons[1], joypad1Buttons);
+	}
+}
+
+
+//
+// Call once a frame, after the frame has been run & drawn into the screen
+//
+void MovieEndFrame(const uint32_t * screen, uint32_t width, uint32_t height, uint32_t pitch)
+{
+	if (movieMode == MOVIE_OFF)
+		return;
+
+	if (!MovieCheckDue())
+	{
+		movieFrame++;
+		return;
+	}
+
+	uint32_t crc[2], recorded[2];
+	crc[0] = (uint32_t)crc32_calcCheckSum(jaguarMainRAM, 0x200000);
+	crc[1] = 0;
+
+	for(uint32_t y=0; y<height; y++)
+		crc[1] = crc32_update(crc[1], (const unsigned char *)(screen + (y * pitch)), width * sizeof(uint32_t));
+
+	if (movieMode == MOVIE_RECORDING)
+	{
+		if (fwrite(crc, sizeof(crc), 1, movieFile) != 1)
+		{
+			WriteLog("MOVIE: Could not write frame #%u!\n", movieFrame);
+			MovieStop();
+			return;
+		}
+	}
+	else if (fread(recorded, sizeof(recorded), 1, movieFile) == 1)
+	{
+		if (crc[0] != recorded[0] || crc[1] != recorded[1])
+		{
+			// Only the first one really means anything; everything after that
+			// is just the fallout from it
+			if (movieDesyncs == 0)
+				WriteLog("MOVIE: Desync at frame #%u! (RAM %08X, should be %08X; screen %08X, should be %08X)\n",
+					movieFrame, crc[0], recorded[0], crc[1], recorded[1]);
+
+			movieDesyncs++;
+		}
+	}
+
+	movieFrame++;
+}
+
+
+//
+// A state carries where it was along the movie that was running when it was
+// saved (if any). When one's loaded that's on the current movie's timeline,
+// the movie carries on from there; otherwise, it stops.
+//
+void MovieStateSync(StateBuffer * sb)
+{
+	uint32_t frame = 0, hash = 0;
+
+	if (movieMode != MOVIE_OFF && sb->mode != STATE_LOAD)
+		frame = movieFrame, hash = movieHash[movieFrame];
+
+	STATE_SYNC(sb, frame);
+	STATE_SYNC(sb, hash);
+
+	if (sb->mode != STATE_LOAD || movieMode == MOVIE_OFF)
+		return;
+
+	uint32_t known = (movieMode == MOVIE_RECORDING ? movieFrame : movieLength);
+
+	if (frame > known || movieHash[frame] != hash)
+	{
+		WriteLog("MOVIE: Loaded a state that isn't on the movie's timeline.\n");
+		MovieStop();
+		return;
+	}
+
+	// When recording, anything after this frame is from another timeline now
+	if (movieMode == MOVIE_RECORDING && frame < movieFrame)
+	{
+		fflush(movieFile);
+#ifdef _WIN32
+		_chsize(_fileno(movieFile), FrameOffset(frame));
+#else
+		if (ftruncate(fileno(movieFile), FrameOffset(frame)) != 0)
+			WriteLog("MOVIE: Could not cut the movie off at frame #%u!\n", frame);
+#endif
+	}
+
+	fseek(movieFile, FrameOffset(frame), SEEK_SET);
+	movieFrame = frame;
+}
+
+
+uint32_t MovieLength(void)
+{
+	return (movieMode == MOVIE_PLAYING ? movieLength : movieFrame);
+}
+
+
+uint32_t MovieFrame(void)
+{
+	return movieFrame;
+}
+
+
+uint32_t MovieDesyncs(void)
+{
+	return movieDesyncs;
+}
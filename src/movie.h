@@ -0,0 +1,47 @@
+//
+// movie.h: Input recording & playback
+//
+
+#ifndef __MOVIE_H__
+#define __MOVIE_H__
+
+#include <stdio.h>
+#include <stdint.h>
+#include "context.h"
+#include "state.h"
+
+#define MOVIE_CHECK_INTERVAL	60				// Frames between desync checks
+
+bool MovieRecord(const char * path, uint32_t checkInterval = MOVIE_CHECK_INTERVAL);
+bool MoviePlay(const char * path);
+void MovieStop(void);
+bool MovieIsRecording(void);
+bool MovieIsPlaying(void);
+bool MovieCheckDue(void);
+void MovieInput(void);
+void MovieEndFrame(const uint32_t * screen, uint32_t width, uint32_t height, uint32_t pitch);
+void MovieStateSync(StateBuffer * sb);
+uint32_t MovieLength(void);
+uint32_t MovieFrame(void);
+uint32_t MovieDesyncs(void);
+
+// What MOVIE.CPP knows about the machine (see context.h)
+
+struct MovieState
+{
+	FILE * movieFile;
+	int movieMode;
+	uint32_t movieInterval;
+	uint32_t movieFrame;
+	uint32_t movieLength;
+	uint32_t movieDesyncs;
+	uint32_t oldSettings;						// What to put back when playback ends
+	long movieStart;							// File offset of the first frame
+
+	// The input hash for every frame we know about; movieHash[n] is what a
+	// state saved after n frames carries
+	uint32_t * movieHash;
+	uint32_t movieHashSize;
+};
+
+#endif	// __MOVIE_H__
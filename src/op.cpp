@@ -69,14 +69,20 @@ static uint8_t op_blend_cr[0x10000];
 // some of the regular TOM RAM...
 //#warning objectp_ram is separated from TOM RAM--need to fix that!
 //static uint8_t objectp_ram[0x40];			// This is based at $F00000
-uint8_t objectp_running = 0;
 //bool objectp_stop_reading_list;
 
 static uint8_t op_bitmap_bit_depth[8] = { 1, 2, 4, 8, 16, 24, 32, 0 };
 //static uint32_t op_bitmap_bit_size[8] =
 //	{ (uint32_t)(0.125*65536), (uint32_t)(0.25*65536), (uint32_t)(0.5*65536), (uint32_t)(1*65536),
 //	  (uint32_t)(2*65536),     (uint32_t)(1*65536),    (uint32_t)(1*65536),   (uint32_t)(1*65536) };
-static uint32_t op_pointer;
+
+#ifndef MULTI_INSTANCE
+struct OPState opState;
+#endif
+
+#define op_pointer			(CONTEXT(op).op_pointer)
+#define objectList			(CONTEXT(op).objectList)
+#define numberOfObjects		(CONTEXT(op).numberOfObjects)
 
 int32_t phraseWidthToPixels[8] = { 64, 32, 16, 8, 4, 2, 0, 0 };
 
@@ -86,6 +92,19 @@ int32_t phraseWidthToPixels[8] = { 64, 32, 16, 8, 4, 2, 0, 0 };
 //
 void OPInit(void)
 {
+	OPFillBlendTables();
+	OPReset();
+}
+
+
+void OPFillBlendTables(void)
+{
+	static bool tablesFilled = false;
+
+	// Only has to be done once (every machine uses the same ones; see context.h)
+	if (tablesFilled)
+		return;
+
 	// Here we calculate the saturating blend of a signed 4-bit value and an
 	// existing Cyan/Red value as well as a signed 8-bit value and an existing intensity...
 	// Note: CRY is 4 bits Cyan, 4 bits Red, 16 bits intensitY
@@ -124,7 +143,7 @@ void OPInit(void)
 		op_blend_cr[i] = (c2 << 4) | c1;
 	}
 
-	OPReset();
+	tablesFilled = true;
 }
 
 
@@ -142,8 +161,6 @@ static const char * opType[8] =
 { "(BITMAP)", "(SCALED BITMAP)", "(GPU INT)", "(BRANCH)", "(STOP)", "???", "???", "???" };
 static const char * ccType[8] =
 	{ "==", "<", ">", "(opflag set)", "(second half line)", "?", "?", "?" };
-static uint32_t object[8192];
-static uint32_t numberOfObjects;
 //static uint32_t objectLink[8192];
 //static uint32_t numberOfLinks;
 
@@ -196,12 +213,18 @@ void OPDone(void)
 }
 
 
+void OPStateSync(StateBuffer * sb)
+{
+	STATE_SYNC(sb, objectp_running);
+}
+
+
 bool OPObjectExists(uint32_t address)
 {
 	// Yes, we really do a linear search, every time. :-/
 	for(uint32_t i=0; i<numberOfObjects; i++)
 	{
-		if (address == object[i])
+		if (address == objectList[i])
 			return true;
 	}
 
@@ -220,7 +243,7 @@ void OPDiscoverObjects(uint32_t address)
 		if (OPObjectExists(address))
 			return;
 
-		object[numberOfObjects++] = address;
+		objectList[numberOfObjects++] = address;
 
 		// Get the object & decode its type, link address
 		uint32_t hi = JaguarReadLong(address + 0, OP);
@@ -246,7 +269,7 @@ void OPDumpObjectList(void)
 {
 	for(uint32_t i=0; i<numberOfObjects; i++)
 	{
-		uint32_t address = object[i];
+		uint32_t address = objectList[i];
 
 		uint32_t hi = JaguarReadLong(address + 0, OP);
 		uint32_t lo = JaguarReadLong(address + 4, OP);
@@ -482,7 +505,7 @@ else
 		op_pointer += 8;
 //WriteLog("\t%08X type %i\n", op_pointer, (uint8_t)p0 & 0x07);
 
-#if 1
+#ifdef DEBUG_HOOKS
 if (halfline == TOMGetVDB() && op_start_log)
 //if (halfline == 215 && op_start_log)
 //if (halfline == 28 && op_start_log)
@@ -582,8 +605,10 @@ WriteLog("    --> List end\n\n");
 			uint32_t height = (p0 & 0xFFC000) >> 14;
 			uint32_t oldOPP = op_pointer - 8;
 // *** BEGIN OP PROCESSOR TESTING ONLY ***
+#ifdef DEBUG_HOOKS
 if (inhibit && op_start_log)
 	WriteLog("!!! ^^^ This object is INHIBITED! ^^^ !!!\n");
+#endif
 bitmapCounter++;
 if (!inhibit)	// For OP testing only!
 // *** END OP PROCESSOR TESTING ONLY ***
@@ -649,11 +674,13 @@ if (op_pointer > 0x1FFFFF && op_pointer < 0x800000)
 			uint32_t oldOPP = op_pointer - 8;
 //WriteLog("OP: Scaled Object (ypos=%04X, height=%04X", ypos, height);
 // *** BEGIN OP PROCESSOR TESTING ONLY ***
+#ifdef DEBUG_HOOKS
 if (inhibit && op_start_log)
 {
 	WriteLog("!!! ^^^ This object is INHIBITED! ^^^ !!! (halfline=%u, ypos=%u, height=%u)\n", halfline, ypos, height);
 	DumpScaledObject(p0, OPLoadPhrase(op_pointer), OPLoadPhrase(op_pointer+8));
 }
+#endif
 bitmapCounter++;
 if (!inhibit)	// For OP testing only!
 // *** END OP PROCESSOR TESTING ONLY ***
@@ -874,6 +901,317 @@ OP: Scaled bitmap 4x? 4bpp at 34,? hscale=80 fpix=0 data=000756E8 pitch 1 hflipp
 }
 
 
+//
+// Bitmap phrase fetching & line buffer writers
+//
+// Nearly all bitmap data lives in main RAM or the cartridge, so rather than
+// going through JaguarReadLong() twice a phrase we pull it straight out of host
+// memory, and only take the long way around for everything else. The writers
+// are templated on depth & the TRANS/RMW/REFLECT flags, so each combination
+// gets its own inner loop without any flag tests left in it.
+//
+
+static inline const uint8_t * OPPhrasePointer(uint32_t address)
+{
+	address &= 0xFFFFF8;
+
+	// First 2M is mirrored in the $0 - $7FFFFF range
+	if (address < 0x800000)
+		return jaguarMainRAM + (address & 0x1FFFF8);
+
+	if (address < 0xDFFF00)
+		return jaguarMainROM + (address - 0x800000);
+
+	return NULL;
+}
+
+
+static inline uint64_t OPFetchPhrase(uint32_t address)
+{
+	const uint8_t * phrase = OPPhrasePointer(address);
+
+	if (phrase)
+		return GET64(phrase, 0);
+
+	address &= ~0x07;
+	return ((uint64_t)JaguarReadLong(address, OP) << 32) | (uint64_t)JaguarReadLong(address + 4, OP);
+}
+
+
+//
+// Same as above, but leaves the phrase in memory order (for 16 & 24 BPP data,
+// which goes into the line buffer as is)
+//
+static inline uint64_t OPFetchPhraseRaw(uint32_t address)
+{
+	uint8_t bytes[8];
+	const uint8_t * phrase = OPPhrasePointer(address);
+
+	if (!phrase)
+	{
+		uint64_t data = OPFetchPhrase(address);
+		SET64(bytes, 0, data);
+		phrase = bytes;
+	}
+
+	uint64_t raw;
+	memcpy(&raw, phrase, 8);
+	return raw;
+}
+
+
+//
+// Write one pixel into the line buffer. For 1 - 8 BPP, bits is the palette
+// index (8 BPP passes in a zero CLUT index); for 16 BPP it's the pixel itself.
+//
+template <int BPP, bool TRANS, bool RMW>
+static inline void OPWritePixel(uint8_t * lb, uint32_t bits, uint8_t index, const uint8_t * paletteRAM)
+{
+	if (TRANS && bits == 0)
+		return;
+
+	if (BPP == 16)
+	{
+		uint8_t bitsHi = bits >> 8, bitsLo = bits & 0xFF;
+
+		if (!RMW)
+			lb[0] = bitsHi, lb[1] = bitsLo;
+		else
+			lb[0] = BLEND_CR(lb[0], bitsHi), lb[1] = BLEND_Y(lb[1], bitsLo);
+	}
+	else
+	{
+		uint32_t entry = index | bits;
+
+		if (!RMW)
+			// This is the *only* correct use of endian-dependent code
+			// (i.e., mem-to-mem direct copying)!
+			*(uint16_t *)lb = ((const uint16_t *)paletteRAM)[entry];
+		else
+			lb[0] = BLEND_CR(lb[0], paletteRAM[entry << 1]),
+			lb[1] = BLEND_Y(lb[1], paletteRAM[(entry << 1) + 1]);
+	}
+}
+
+
+//
+// Write four palettized pixels (the top 4 * BPP bits of pixels) into the line
+// buffer with a single 8 byte store. Transparent pixels get masked out with the
+// line buffer's current contents, so the store never has to be split up.
+//
+template <int BPP, bool TRANS, bool REFLECT>
+static inline void OPWritePaletteGroup(uint8_t * lb, uint64_t pixels, uint8_t index, const uint16_t * paletteRAM16)
+{
+	uint16_t value[4], mask[4];
+
+	for(int i=0; i<4; i++)
+	{
+		uint32_t bits = (pixels >> (64 - (BPP * (i + 1)))) & ((1 << BPP) - 1);
+		int lane = (REFLECT ? 3 - i : i);
+		value[lane] = paletteRAM16[index | bits];
+		mask[lane] = (bits ? 0xFFFF : 0x0000);
+	}
+
+	// When reflected, the group runs from the current pixel *down* 3 pixels
+	uint8_t * dst = (REFLECT ? lb - 6 : lb);
+	uint64_t group;
+	memcpy(&group, value, 8);
+
+	if (TRANS)
+	{
+		uint64_t groupMask, current;
+		memcpy(&groupMask, mask, 8);
+		memcpy(&current, dst, 8);
+		group = (current & ~groupMask) | (group & groupMask);
+	}
+
+	memcpy(dst, &group, 8);
+}
+
+
+//
+// Write a whole 16 BPP phrase (in memory order) into the line buffer
+//
+template <bool TRANS, bool REFLECT>
+static inline void OPWriteDirectPhrase(uint8_t * lb, uint64_t raw)
+{
+	uint8_t * dst = (REFLECT ? lb - 6 : lb);
+
+	// Reversing the order of the four 16-bit lanes works the same on either endian
+	if (REFLECT)
+	{
+		raw = (raw >> 32) | (raw << 32);
+		raw = ((raw >> 16) & 0x0000FFFF0000FFFFULL) | ((raw & 0x0000FFFF0000FFFFULL) << 16);
+	}
+
+	if (TRANS)
+	{
+		// Set the top bit of each lane that has anything in it, then spread it out
+		uint64_t nonZero = (((raw & 0x7FFF7FFF7FFF7FFFULL) + 0x7FFF7FFF7FFF7FFFULL) | raw) & 0x8000800080008000ULL;
+		uint64_t groupMask = (nonZero >> 15) * 0xFFFF, current;
+		memcpy(&current, dst, 8);
+		raw = (current & ~groupMask) | (raw & groupMask);
+	}
+
+	memcpy(dst, &raw, 8);
+}
+
+
+//
+// 24 BPP puts *4* bytes into the line buffer for each pixel, and ignores both
+// RMW & scaling (at least, as far as we can tell).
+//
+template <bool TRANS, bool REFLECT>
+static void OPDraw24BPPBitmap(uint8_t * lb, uint32_t data, uint32_t pitch, uint32_t iwidth)
+{
+	while (iwidth--)
+	{
+		uint64_t raw = OPFetchPhraseRaw(data);
+		data += pitch;
+
+		for(int i=0; i<2; i++)
+		{
+			uint32_t pixel;
+			memcpy(&pixel, (uint8_t *)&raw + (i * 4), 4);
+
+			if (!TRANS || pixel != 0)
+				memcpy(lb, &pixel, 4);
+
+			lb += (REFLECT ? -4 : 4);
+		}
+	}
+}
+
+
+//
+// Fixed bitmaps: skip is how many pixels of the first phrase to pass over, and
+// pitch is in bytes.
+//
+template <int BPP, bool TRANS, bool RMW, bool REFLECT>
+static void OPDrawFixedBitmap(uint8_t * lb, uint32_t data, uint32_t pitch, uint32_t iwidth,
+	uint32_t skip, uint8_t index, const uint8_t * paletteRAM)
+{
+	if (BPP == 24)
+	{
+		OPDraw24BPPBitmap<TRANS, REFLECT>(lb, data, pitch, iwidth);
+		return;
+	}
+
+	const uint32_t pixelsPerPhrase = 64 / BPP;
+	const int32_t lbufDelta = (REFLECT ? -2 : 2);
+	uint32_t i = skip;
+
+	while (iwidth--)
+	{
+		if (BPP == 16 && !RMW)
+		{
+			OPWriteDirectPhrase<TRANS, REFLECT>(lb, OPFetchPhraseRaw(data));
+			data += pitch;
+			lb += lbufDelta * 4;
+			continue;
+		}
+
+		uint64_t pixels = OPFetchPhrase(data) << (i * BPP);
+		data += pitch;
+
+		// RMW has to go pixel by pixel. Otherwise, we only do that until we're
+		// lined up on a four pixel group (which only FIRSTPIX can throw off).
+		for(; i<pixelsPerPhrase && (RMW || (i & 3)); i++)
+		{
+			OPWritePixel<BPP, TRANS, RMW>(lb, pixels >> (64 - BPP), index, paletteRAM);
+			lb += lbufDelta;
+			pixels <<= BPP;
+		}
+
+		for(; i<pixelsPerPhrase; i+=4)
+		{
+			OPWritePaletteGroup<BPP, TRANS, REFLECT>(lb, pixels, index, (const uint16_t *)paletteRAM);
+			lb += lbufDelta * 4;
+			pixels <<= (BPP * 4) & 0x3F;
+		}
+
+		i = 0;
+	}
+}
+
+
+//
+// Scaled bitmaps: hscale is in [3.5] fixed point, and pitch is in bytes.
+//
+template <int BPP, bool TRANS, bool RMW, bool REFLECT>
+static void OPDrawScaledBitmap(uint8_t * lb, uint32_t data, uint32_t pitch, uint32_t iwidth,
+	uint16_t hscale, uint8_t index, const uint8_t * paletteRAM)
+{
+	if (BPP == 24)
+	{
+		OPDraw24BPPBitmap<TRANS, REFLECT>(lb, data, pitch, iwidth);
+		return;
+	}
+
+	const int pixelsPerPhrase = 64 / BPP;
+	const int32_t lbufDelta = (REFLECT ? -2 : 2);
+// Hmm. It seems that fixing the horizontal scale necessitated re-fixing this. Not sure why,
+// but seems to be consistent with the vertical scaling now (and it may turn out to be wrong!)...
+	uint16_t horizontalRemainder = hscale;				// Not sure if it starts full, but seems reasonable [It's not!]
+//	uint8_t horizontalRemainder = 0;					// Let's try zero! Seems to work! Yay! [No, it doesn't!]
+	int pixCount = 0;
+	uint64_t pixels = OPFetchPhrase(data);
+
+	while ((int32_t)iwidth > 0)
+	{
+		OPWritePixel<BPP, TRANS, RMW>(lb, pixels >> (64 - BPP), index, paletteRAM);
+		lb += lbufDelta;
+
+		while (horizontalRemainder < 0x20)		// I.e., it's <= 1.0 (*before* subtraction)
+		{
+			horizontalRemainder += hscale;
+			pixCount++;
+			pixels <<= BPP;
+		}
+		horizontalRemainder -= 0x20;		// Subtract 1.0f in [3.5] fixed point format
+
+		if (pixCount >= pixelsPerPhrase)
+		{
+			int phrasesToSkip = pixCount / pixelsPerPhrase, pixelShift = pixCount % pixelsPerPhrase;
+
+			data += pitch * phrasesToSkip;
+			pixels = OPFetchPhrase(data) << (BPP * pixelShift);
+			iwidth -= phrasesToSkip;
+			pixCount = pixelShift;
+		}
+	}
+}
+
+
+typedef void (OPFixedBitmapWriter)(uint8_t * lb, uint32_t data, uint32_t pitch, uint32_t iwidth,
+	uint32_t skip, uint8_t index, const uint8_t * paletteRAM);
+typedef void (OPScaledBitmapWriter)(uint8_t * lb, uint32_t data, uint32_t pitch, uint32_t iwidth,
+	uint16_t hscale, uint8_t index, const uint8_t * paletteRAM);
+
+// Indexed by the object's flags: REFLECT (0), RMW (1), TRANS (2)
+#define OP_WRITER_FLAGS(writer, bpp) \
+	{ writer<bpp, false, false, false>, writer<bpp, false, false, true>, \
+	  writer<bpp, false, true, false>, writer<bpp, false, true, true>, \
+	  writer<bpp, true, false, false>, writer<bpp, true, false, true>, \
+	  writer<bpp, true, true, false>, writer<bpp, true, true, true> }
+
+static OPFixedBitmapWriter * const opFixedBitmapWriter[6][8] = {
+	OP_WRITER_FLAGS(OPDrawFixedBitmap, 1), OP_WRITER_FLAGS(OPDrawFixedBitmap, 2),
+	OP_WRITER_FLAGS(OPDrawFixedBitmap, 4), OP_WRITER_FLAGS(OPDrawFixedBitmap, 8),
+	OP_WRITER_FLAGS(OPDrawFixedBitmap, 16), OP_WRITER_FLAGS(OPDrawFixedBitmap, 24)
+};
+
+static OPScaledBitmapWriter * const opScaledBitmapWriter[6][8] = {
+	OP_WRITER_FLAGS(OPDrawScaledBitmap, 1), OP_WRITER_FLAGS(OPDrawScaledBitmap, 2),
+	OP_WRITER_FLAGS(OPDrawScaledBitmap, 4), OP_WRITER_FLAGS(OPDrawScaledBitmap, 8),
+	OP_WRITER_FLAGS(OPDrawScaledBitmap, 16), OP_WRITER_FLAGS(OPDrawScaledBitmap, 24)
+};
+
+// "For images with 1 to 4 bits/pixel the top 7 to 4 bits of the index
+//  provide the most significant bits of the palette address."
+static const uint8_t opIndexMask[6] = { 0xFE, 0xFC, 0xF0, 0x00, 0x00, 0x00 };
+
+
 //
 // Store fixed size bitmap in line buffer
 //
@@ -895,9 +1233,7 @@ void OPProcessFixedBitmap(uint64_t p0, uint64_t p1, bool render)
 //	uint8_t flags = (p1 >> 45) & 0x0F;	// REFLECT, RMW, TRANS, RELEASE
 //Optimize: break these out to their own BOOL values
 	uint8_t flags = (p1 >> 45) & 0x07;				// REFLECT (0), RMW (1), TRANS (2)
-	bool flagREFLECT = (flags & OPFLAG_REFLECT ? true : false),
-		flagRMW = (flags & OPFLAG_RMW ? true : false),
-		flagTRANS = (flags & OPFLAG_TRANS ? true : false);
+	bool flagREFLECT = (flags & OPFLAG_REFLECT ? true : false);
 // "For images with 1 to 4 bits/pixel the top 7 to 4 bits of the index
 //  provide the most significant bits of the palette address."
 	uint8_t index = (p1 >> 37) & 0xFE;				// CLUT index offset (upper pix, 1-4 bpp)
@@ -905,11 +1241,7 @@ void OPProcessFixedBitmap(uint64_t p0, uint64_t p1, bool render)
 	pitch <<= 3;									// Optimization: Multiply pitch by 8
 
 //	int16_t scanlineWidth = tom_getVideoModeWidth();
-	uint8_t * tomRam8 = TOMGetRamPointer();
 	uint8_t * paletteRAM = &tomRam8[0x400];
-	// This is OK as long as it's used correctly: For 16-bit RAM to RAM direct copies--NOT
-	// for use when using endian-corrected data (i.e., any of the *_word_read functions!)
-	uint16_t * paletteRAM16 = (uint16_t *)paletteRAM;
 
 //	WriteLog("bitmap %ix? %ibpp at %i,? firstpix=? data=0x%.8x pitch %i hflipped=%s dwidth=? (linked to ?) RMW=%s Tranparent=%s\n",
 //		iwidth, op_bitmap_bit_depth[bitdepth], xpos, ptr, pitch, (flags&OPFLAG_REFLECT ? "yes" : "no"), (flags&OPFLAG_RMW ? "yes" : "no"), (flags&OPFLAG_TRANS ? "yes" : "no"));
@@ -1070,272 +1402,21 @@ if (depth > 5)
 // And it seems that this is wrong, index == 0 is transparent apparently... :-/
 //#define OP_USES_PALETTE_ZERO
 
-	if (depth == 0)									// 1 BPP
-	{
-		// The LSB of flags is OPFLAG_REFLECT, so sign extend it and or 2 into it.
-		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
-
-		// Fetch 1st phrase...
-		uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
+	// Only 1 & 8 BPP honor FIRSTPIX...
 //Note that firstPix should only be honored *if* we start with the 1st phrase of the bitmap
 //i.e., we didn't clip on the margin... !!! FIX !!!
-		pixels <<= firstPix;						// Skip first N pixels (N=firstPix)...
-		int i = firstPix;							// Start counter at right spot...
-
-		while (iwidth--)
-		{
-			while (i++ < 64)
-			{
-				uint8_t bit = pixels >> 63;
-#ifndef OP_USES_PALETTE_ZERO
-				if (flagTRANS && bit == 0)
-#else
-				if (flagTRANS && (paletteRAM16[index | bit] == 0))
-#endif
-					;	// Do nothing...
-				else
-				{
-					if (!flagRMW)
-//Optimize: Set palleteRAM16 to beginning of palette RAM + index*2 and use only [bit] as index...
-//Won't optimize RMW case though...
-						// This is the *only* correct use of endian-dependent code
-						// (i.e., mem-to-mem direct copying)!
-						*(uint16_t *)currentLineBuffer = paletteRAM16[index | bit];
-					else
-						*currentLineBuffer =
-							BLEND_CR(*currentLineBuffer, paletteRAM[(index | bit) << 1]),
-						*(currentLineBuffer + 1) =
-							BLEND_Y(*(currentLineBuffer + 1), paletteRAM[((index | bit) << 1) + 1]);
-				}
-
-				currentLineBuffer += lbufDelta;
-				pixels <<= 1;
-			}
-			i = 0;
-			// Fetch next phrase...
-			data += pitch;
-			pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-		}
-	}
-	else if (depth == 1)							// 2 BPP
-	{
-if (firstPix)
-	WriteLog("OP: Fixed bitmap @ 2 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
-		index &= 0xFC;								// Top six bits form CLUT index
-		// The LSB is OPFLAG_REFLECT, so sign extend it and or 2 into it.
-		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
-
-		while (iwidth--)
-		{
-			// Fetch phrase...
-			uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-			data += pitch;
-
-			for(int i=0; i<32; i++)
-			{
-				uint8_t bits = pixels >> 62;
-// Seems to me that both of these are in the same endian, so we could cast it as
-// uint16_t * and do straight across copies (what about 24 bpp? Treat it differently...)
-// This only works for the palettized modes (1 - 8 BPP), since we actually have to
-// copy data from memory in 16 BPP mode (or does it? Isn't this the same as the CLUT case?)
-// No, it isn't because we read the memory in an endian safe way--this *won't* work...
-#ifndef OP_USES_PALETTE_ZERO
-				if (flagTRANS && bits == 0)
-#else
-				if (flagTRANS && (paletteRAM16[index | bits] == 0))
-#endif
-					;	// Do nothing...
-				else
-				{
-					if (!flagRMW)
-						*(uint16_t *)currentLineBuffer = paletteRAM16[index | bits];
-					else
-						*currentLineBuffer =
-							BLEND_CR(*currentLineBuffer, paletteRAM[(index | bits) << 1]),
-						*(currentLineBuffer + 1) =
-							BLEND_Y(*(currentLineBuffer + 1), paletteRAM[((index | bits) << 1) + 1]);
-				}
-
-				currentLineBuffer += lbufDelta;
-				pixels <<= 2;
-			}
-		}
-	}
-	else if (depth == 2)							// 4 BPP
-	{
-if (firstPix)
-	WriteLog("OP: Fixed bitmap @ 4 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
-		index &= 0xF0;								// Top four bits form CLUT index
-		// The LSB is OPFLAG_REFLECT, so sign extend it and or 2 into it.
-		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
-
-		while (iwidth--)
-		{
-			// Fetch phrase...
-			uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-			data += pitch;
-
-			for(int i=0; i<16; i++)
-			{
-				uint8_t bits = pixels >> 60;
-// Seems to me that both of these are in the same endian, so we could cast it as
-// uint16_t * and do straight across copies (what about 24 bpp? Treat it differently...)
-// This only works for the palettized modes (1 - 8 BPP), since we actually have to
-// copy data from memory in 16 BPP mode (or does it? Isn't this the same as the CLUT case?)
-// No, it isn't because we read the memory in an endian safe way--this *won't* work...
-#ifndef OP_USES_PALETTE_ZERO
-				if (flagTRANS && bits == 0)
-#else
-				if (flagTRANS && (paletteRAM16[index | bits] == 0))
-#endif
-					;	// Do nothing...
-				else
-				{
-					if (!flagRMW)
-						*(uint16_t *)currentLineBuffer = paletteRAM16[index | bits];
-					else
-						*currentLineBuffer =
-							BLEND_CR(*currentLineBuffer, paletteRAM[(index | bits) << 1]),
-						*(currentLineBuffer + 1) =
-							BLEND_Y(*(currentLineBuffer + 1), paletteRAM[((index | bits) << 1) + 1]);
-				}
-
-				currentLineBuffer += lbufDelta;
-				pixels <<= 4;
-			}
-		}
-	}
-	else if (depth == 3)							// 8 BPP
-	{
-		// The LSB is OPFLAG_REFLECT, so sign extend it and or 2 into it.
-		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
-
-		// Fetch 1st phrase...
-		uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-//Note that firstPix should only be honored *if* we start with the 1st phrase of the bitmap
-//i.e., we didn't clip on the margin... !!! FIX !!!
-		firstPix &= 0x30;							// Only top two bits are valid for 8 BPP
-		pixels <<= firstPix;						// Skip first N pixels (N=firstPix)...
-		int i = firstPix >> 3;						// Start counter at right spot...
-
-		while (iwidth--)
-		{
-			while (i++ < 8)
-			{
-				uint8_t bits = pixels >> 56;
-// Seems to me that both of these are in the same endian, so we could cast it as
-// uint16_t * and do straight across copies (what about 24 bpp? Treat it differently...)
-// This only works for the palettized modes (1 - 8 BPP), since we actually have to
-// copy data from memory in 16 BPP mode (or does it? Isn't this the same as the CLUT case?)
-// No, it isn't because we read the memory in an endian safe way--this *won't* work...
-//This would seem to be problematic...
-//Because it's the palette entry being zero that makes the pixel transparent...
-//Let's try it and see.
-#ifndef OP_USES_PALETTE_ZERO
-				if (flagTRANS && bits == 0)
-#else
-				if (flagTRANS && (paletteRAM16[bits] == 0))
-#endif
-					;	// Do nothing...
-				else
-				{
-					if (!flagRMW)
-						*(uint16_t *)currentLineBuffer = paletteRAM16[bits];
-					else
-						*currentLineBuffer =
-							BLEND_CR(*currentLineBuffer, paletteRAM[bits << 1]),
-						*(currentLineBuffer + 1) =
-							BLEND_Y(*(currentLineBuffer + 1), paletteRAM[(bits << 1) + 1]);
-				}
-
-				currentLineBuffer += lbufDelta;
-				pixels <<= 8;
-			}
-			i = 0;
-			// Fetch next phrase...
-			data += pitch;
-			pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-		}
-	}
-	else if (depth == 4)							// 16 BPP
-	{
-if (firstPix)
-	WriteLog("OP: Fixed bitmap @ 16 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
-		// The LSB is OPFLAG_REFLECT, so sign extend it and or 2 into it.
-		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
-
-		while (iwidth--)
-		{
-			// Fetch phrase...
-			uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-			data += pitch;
-
-			for(int i=0; i<4; i++)
-			{
-				uint8_t bitsHi = pixels >> 56, bitsLo = pixels >> 48;
-// Seems to me that both of these are in the same endian, so we could cast it as
-// uint16_t * and do straight across copies (what about 24 bpp? Treat it differently...)
-// This only works for the palettized modes (1 - 8 BPP), since we actually have to
-// copy data from memory in 16 BPP mode (or does it? Isn't this the same as the CLUT case?)
-// No, it isn't because we read the memory in an endian safe way--it *won't* work...
-//This doesn't seem right... Let's try the encoded black value ($8800):
-//Apparently, CRY 0 maps to $8800...
-				if (flagTRANS && ((bitsLo | bitsHi) == 0))
-//				if (flagTRANS && (bitsHi == 0x88) && (bitsLo == 0x00))
-					;	// Do nothing...
-				else
-				{
-					if (!flagRMW)
-						*currentLineBuffer = bitsHi,
-						*(currentLineBuffer + 1) = bitsLo;
-					else
-						*currentLineBuffer =
-							BLEND_CR(*currentLineBuffer, bitsHi),
-						*(currentLineBuffer + 1) =
-							BLEND_Y(*(currentLineBuffer + 1), bitsLo);
-				}
-
-				currentLineBuffer += lbufDelta;
-				pixels <<= 16;
-			}
-		}
-	}
-	else if (depth == 5)							// 24 BPP
-	{
-//Looks like Iron Soldier is the only game that uses 24BPP mode...
-//There *might* be others...
-//WriteLog("OP: Writing 24 BPP bitmap!\n");
-if (firstPix)
-	WriteLog("OP: Fixed bitmap @ 24 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
-		// Not sure, but I think RMW only works with 16 BPP and below, and only in CRY mode...
-		// The LSB of flags is OPFLAG_REFLECT, so sign extend it and OR 4 into it.
-		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 4) | 0x04;
-
-		while (iwidth--)
-		{
-			// Fetch phrase...
-			uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-			data += pitch;
-
-			for(int i=0; i<2; i++)
-			{
-				// We don't use a 32-bit var here because of endian issues...!
-				uint8_t bits3 = pixels >> 56, bits2 = pixels >> 48,
-					bits1 = pixels >> 40, bits0 = pixels >> 32;
-
-				if (flagTRANS && (bits3 | bits2 | bits1 | bits0) == 0)
-					;	// Do nothing...
-				else
-					*currentLineBuffer = bits3,
-					*(currentLineBuffer + 1) = bits2,
-					*(currentLineBuffer + 2) = bits1,
-					*(currentLineBuffer + 3) = bits0;
-
-				currentLineBuffer += lbufDelta;
-				pixels <<= 32;
-			}
-		}
-	}
+	uint32_t skip = 0;
+
+	if (depth == 0)
+		skip = firstPix;							// Skip first N pixels (N=firstPix)...
+	else if (depth == 3)
+		skip = (firstPix & 0x30) >> 3;				// Only top two bits are valid for 8 BPP
+	else if (firstPix && depth < 6)
+		WriteLog("OP: Fixed bitmap @ %u BPP requesting FIRSTPIX! (fp=%u)\n", op_bitmap_bit_depth[depth], firstPix);
+
+	if (depth < 6)
+		opFixedBitmapWriter[depth][flags](currentLineBuffer, data, pitch, iwidth, skip,
+			index & opIndexMask[depth], paletteRAM);
 }
 
 
@@ -1362,23 +1443,13 @@ if (firstPix)
 //	uint8_t flags = (p1 >> 45) & 0x0F;	// REFLECT, RMW, TRANS, RELEASE
 //Optimize: break these out to their own BOOL values [DONE]
 	uint8_t flags = (p1 >> 45) & 0x07;				// REFLECT (0), RMW (1), TRANS (2)
-	bool flagREFLECT = (flags & OPFLAG_REFLECT ? true : false),
-		flagRMW = (flags & OPFLAG_RMW ? true : false),
-		flagTRANS = (flags & OPFLAG_TRANS ? true : false);
+	bool flagREFLECT = (flags & OPFLAG_REFLECT ? true : false);
 	uint8_t index = (p1 >> 37) & 0xFE;				// CLUT index offset (upper pix, 1-4 bpp)
 	uint32_t pitch = (p1 >> 15) & 0x07;				// Phrase pitch
 
-	uint8_t * tomRam8 = TOMGetRamPointer();
 	uint8_t * paletteRAM = &tomRam8[0x400];
-	// This is OK as long as it's used correctly: For 16-bit RAM to RAM direct copies--NOT
-	// for use when using endian-corrected data (i.e., any of the *ReadWord functions!)
-	uint16_t * paletteRAM16 = (uint16_t *)paletteRAM;
 
 	uint16_t hscale = p2 & 0xFF;
-// Hmm. It seems that fixing the horizontal scale necessitated re-fixing this. Not sure why,
-// but seems to be consistent with the vertical scaling now (and it may turn out to be wrong!)...
-	uint16_t horizontalRemainder = hscale;				// Not sure if it starts full, but seems reasonable [It's not!]
-//	uint8_t horizontalRemainder = 0;					// Let's try zero! Seems to work! Yay! [No, it doesn't!]
 	int32_t scaledWidthInPixels = (iwidth * phraseWidthToPixels[depth] * hscale) >> 5;
 	uint32_t scaledPhrasePixels = (phraseWidthToPixels[depth] * hscale) >> 5;
 
@@ -1494,17 +1565,21 @@ uint32_t scaledPhrasePixelsUS = phraseWidthToPixels[depth] * hscale;
 
 	if (startPos < 0)			// Case #1: Begin out, end in, L to R
 {
+#ifdef DEBUG_HOOKS
 extern int start_logging;
 if (start_logging)
 	WriteLog("OP: Scaled bitmap (%02X, %u BPP, spp=%u) start pos (%i) < 0...", hscale, op_bitmap_bit_depth[depth], scaledPhrasePixels, startPos);
+#endif
 //		clippedWidth = 0 - startPos,
 		clippedWidth = (0 - startPos) << 5,
 //		dataClippedWidth = phraseClippedWidth = clippedWidth / scaledPhrasePixels,
 		dataClippedWidth = phraseClippedWidth = (clippedWidth / scaledPhrasePixelsUS) >> 5,
 //		startPos = 0 - (clippedWidth % scaledPhrasePixels);
 		startPos += (dataClippedWidth * scaledPhrasePixelsUS) >> 5;
+#ifdef DEBUG_HOOKS
 if (start_logging)
 	WriteLog(" [new sp=%i, cw=%i, dcw=pcw=%i]\n", startPos, clippedWidth, dataClippedWidth);
+#endif
 }
 
 	if (endPos < 0)				// Case #2: Begin in, end out, R to L
@@ -1520,6 +1595,7 @@ if (start_logging)
 		dataClippedWidth = phraseClippedWidth = clippedWidth / scaledPhrasePixels,
 		startPos = lbufWidth + (clippedWidth % scaledPhrasePixels);
 
+#ifdef DEBUG_HOOKS
 extern int op_start_log;
 if (op_start_log && clippedWidth != 0)
 	WriteLog("OP: Clipped line. SP=%i, EP=%i, clip=%u, iwidth=%u, hscale=%02X\n", startPos, endPos, clippedWidth, iwidth, hscale);
@@ -1535,6 +1611,7 @@ if (op_start_log && startPos == 13)
 		WriteLog("\n");
 	}
 }
+#endif
 	// If the image is sitting on the line buffer left or right edge, we need to compensate
 	// by decreasing the image phrase width accordingly.
 	iwidth -= phraseClippedWidth;
@@ -1561,357 +1638,14 @@ if (op_start_log && startPos == 13)
 // anyway.
 // This seems to be the case (at least according to the Midsummer docs)...!
 
-	if (depth == 0)									// 1 BPP
-	{
-if (firstPix != 0)
-	WriteLog("OP: Scaled bitmap @ 1 BPP requesting FIRSTPIX!\n");
-		// The LSB of flags is OPFLAG_REFLECT, so sign extend it and or 2 into it.
-		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
-
-		int pixCount = 0;
-		uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-
-		while ((int32_t)iwidth > 0)
-		{
-			uint8_t bits = pixels >> 63;
-
-#ifndef OP_USES_PALETTE_ZERO
-			if (flagTRANS && bits == 0)
-#else
-			if (flagTRANS && (paletteRAM16[index | bits] == 0))
-#endif
-				;	// Do nothing...
-			else
-			{
-				if (!flagRMW)
-					// This is the *only* correct use of endian-dependent code
-					// (i.e., mem-to-mem direct copying)!
-					*(uint16_t *)currentLineBuffer = paletteRAM16[index | bits];
-				else
-					*currentLineBuffer =
-						BLEND_CR(*currentLineBuffer, paletteRAM[(index | bits) << 1]),
-					*(currentLineBuffer + 1) =
-						BLEND_Y(*(currentLineBuffer + 1), paletteRAM[((index | bits) << 1) + 1]);
-			}
-
-			currentLineBuffer += lbufDelta;
-
-/*
-The reason we subtract the horizontalRemainder *after* the test is because we had too few
-bytes for horizontalRemainder to properly recognize a negative number. But now it's 16 bits
-wide, so we could probably go back to that (as long as we make it an int16_t and not a uint16!)
-*/
-/*			horizontalRemainder -= 0x20;		// Subtract 1.0f in [3.5] fixed point format
-			while (horizontalRemainder & 0x80)
-			{
-				horizontalRemainder += hscale;
-				pixCount++;
-				pixels <<= 1;
-			}//*/
-//			while (horizontalRemainder <= 0x20)		// I.e., it's <= 1.0 (*before* subtraction)
-			while (horizontalRemainder < 0x20)		// I.e., it's <= 1.0 (*before* subtraction)
-			{
-				horizontalRemainder += hscale;
-				pixCount++;
-				pixels <<= 1;
-			}
-			horizontalRemainder -= 0x20;		// Subtract 1.0f in [3.5] fixed point format
-
-			if (pixCount > 63)
-			{
-				int phrasesToSkip = pixCount / 64, pixelShift = pixCount % 64;
-
-				data += (pitch << 3) * phrasesToSkip;
-				pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-				pixels <<= 1 * pixelShift;
-				iwidth -= phrasesToSkip;
-				pixCount = pixelShift;
-			}
-		}
-	}
-	else if (depth == 1)							// 2 BPP
-	{
-if (firstPix != 0)
-	WriteLog("OP: Scaled bitmap @ 2 BPP requesting FIRSTPIX!\n");
-		index &= 0xFC;								// Top six bits form CLUT index
-		// The LSB is OPFLAG_REFLECT, so sign extend it and or 2 into it.
-		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
-
-		int pixCount = 0;
-		uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-
-		while ((int32_t)iwidth > 0)
-		{
-			uint8_t bits = pixels >> 62;
-
-#ifndef OP_USES_PALETTE_ZERO
-			if (flagTRANS && bits == 0)
-#else
-			if (flagTRANS && (paletteRAM16[index | bits] == 0))
-#endif
-				;	// Do nothing...
-			else
-			{
-				if (!flagRMW)
-					// This is the *only* correct use of endian-dependent code
-					// (i.e., mem-to-mem direct copying)!
-					*(uint16_t *)currentLineBuffer = paletteRAM16[index | bits];
-				else
-					*currentLineBuffer =
-						BLEND_CR(*currentLineBuffer, paletteRAM[(index | bits) << 1]),
-					*(currentLineBuffer + 1) =
-						BLEND_Y(*(currentLineBuffer + 1), paletteRAM[((index | bits) << 1) + 1]);
-			}
-
-			currentLineBuffer += lbufDelta;
-
-/*			horizontalRemainder -= 0x20;		// Subtract 1.0f in [3.5] fixed point format
-			while (horizontalRemainder & 0x80)
-			{
-				horizontalRemainder += hscale;
-				pixCount++;
-				pixels <<= 2;
-			}//*/
-//			while (horizontalRemainder <= 0x20)		// I.e., it's <= 0 (*before* subtraction)
-			while (horizontalRemainder < 0x20)		// I.e., it's <= 1.0 (*before* subtraction)
-			{
-				horizontalRemainder += hscale;
-				pixCount++;
-				pixels <<= 2;
-			}
-			horizontalRemainder -= 0x20;		// Subtract 1.0f in [3.5] fixed point format
-
-			if (pixCount > 31)
-			{
-				int phrasesToSkip = pixCount / 32, pixelShift = pixCount % 32;
-
-				data += (pitch << 3) * phrasesToSkip;
-				pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-				pixels <<= 2 * pixelShift;
-				iwidth -= phrasesToSkip;
-				pixCount = pixelShift;
-			}
-		}
-	}
-	else if (depth == 2)							// 4 BPP
-	{
-if (firstPix != 0)
-	WriteLog("OP: Scaled bitmap @ 4 BPP requesting FIRSTPIX!\n");
-		index &= 0xF0;								// Top four bits form CLUT index
-		// The LSB is OPFLAG_REFLECT, so sign extend it and or 2 into it.
-		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
-
-		int pixCount = 0;
-		uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-
-		while ((int32_t)iwidth > 0)
-		{
-			uint8_t bits = pixels >> 60;
-
-#ifndef OP_USES_PALETTE_ZERO
-			if (flagTRANS && bits == 0)
-#else
-			if (flagTRANS && (paletteRAM16[index | bits] == 0))
-#endif
-				;	// Do nothing...
-			else
-			{
-				if (!flagRMW)
-					// This is the *only* correct use of endian-dependent code
-					// (i.e., mem-to-mem direct copying)!
-					*(uint16_t *)currentLineBuffer = paletteRAM16[index | bits];
-				else
-					*currentLineBuffer =
-						BLEND_CR(*currentLineBuffer, paletteRAM[(index | bits) << 1]),
-					*(currentLineBuffer + 1) =
-						BLEND_Y(*(currentLineBuffer + 1), paletteRAM[((index | bits) << 1) + 1]);
-			}
-
-			currentLineBuffer += lbufDelta;
-
-/*			horizontalRemainder -= 0x20;		// Subtract 1.0f in [3.5] fixed point format
-			while (horizontalRemainder & 0x80)
-			{
-				horizontalRemainder += hscale;
-				pixCount++;
-				pixels <<= 4;
-			}//*/
-//			while (horizontalRemainder <= 0x20)		// I.e., it's <= 0 (*before* subtraction)
-			while (horizontalRemainder < 0x20)		// I.e., it's <= 0 (*before* subtraction)
-			{
-				horizontalRemainder += hscale;
-				pixCount++;
-				pixels <<= 4;
-			}
-			horizontalRemainder -= 0x20;		// Subtract 1.0f in [3.5] fixed point format
-
-			if (pixCount > 15)
-			{
-				int phrasesToSkip = pixCount / 16, pixelShift = pixCount % 16;
-
-				data += (pitch << 3) * phrasesToSkip;
-				pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-				pixels <<= 4 * pixelShift;
-				iwidth -= phrasesToSkip;
-				pixCount = pixelShift;
-			}
-		}
-	}
-	else if (depth == 3)							// 8 BPP
-	{
-if (firstPix)
-	WriteLog("OP: Scaled bitmap @ 8 BPP requesting FIRSTPIX! (fp=%u)\n", firstPix);
-		// The LSB is OPFLAG_REFLECT, so sign extend it and or 2 into it.
-		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
-
-		int pixCount = 0;
-		uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-
-		while ((int32_t)iwidth > 0)
-		{
-			uint8_t bits = pixels >> 56;
-
-#ifndef OP_USES_PALETTE_ZERO
-			if (flagTRANS && bits == 0)
-#else
-			if (flagTRANS && (paletteRAM16[bits] == 0))
-#endif
-				;	// Do nothing...
-			else
-			{
-				if (!flagRMW)
-					// This is the *only* correct use of endian-dependent code
-					// (i.e., mem-to-mem direct copying)!
-					*(uint16_t *)currentLineBuffer = paletteRAM16[bits];
-/*				{
-					if (currentLineBuffer >= lineBufferLowerLimit && currentLineBuffer <= lineBufferUpperLimit)
-						*(uint16_t *)currentLineBuffer = paletteRAM16[bits];
-				}*/
-				else
-					*currentLineBuffer =
-						BLEND_CR(*currentLineBuffer, paletteRAM[bits << 1]),
-					*(currentLineBuffer + 1) =
-						BLEND_Y(*(currentLineBuffer + 1), paletteRAM[(bits << 1) + 1]);
-			}
-
-			currentLineBuffer += lbufDelta;
-
-//			while (horizontalRemainder <= 0x20)		// I.e., it's <= 0 (*before* subtraction)
-			while (horizontalRemainder < 0x20)		// I.e., it's <= 1.0 (*before* subtraction)
-			{
-				horizontalRemainder += hscale;
-				pixCount++;
-				pixels <<= 8;
-			}
-			horizontalRemainder -= 0x20;		// Subtract 1.0f in [3.5] fixed point format
-
-			if (pixCount > 7)
-			{
-				int phrasesToSkip = pixCount / 8, pixelShift = pixCount % 8;
-
-				data += (pitch << 3) * phrasesToSkip;
-				pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-				pixels <<= 8 * pixelShift;
-				iwidth -= phrasesToSkip;
-				pixCount = pixelShift;
-			}
-		}
-	}
-	else if (depth == 4)							// 16 BPP
-	{
-if (firstPix != 0)
-	WriteLog("OP: Scaled bitmap @ 16 BPP requesting FIRSTPIX!\n");
-		// The LSB is OPFLAG_REFLECT, so sign extend it and OR 2 into it.
-		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 5) | 0x02;
-
-		int pixCount = 0;
-		uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-
-		while ((int32_t)iwidth > 0)
-		{
-			uint8_t bitsHi = pixels >> 56, bitsLo = pixels >> 48;
-
-//This doesn't seem right... Let's try the encoded black value ($8800):
-//Apparently, CRY 0 maps to $8800...
-				if (flagTRANS && ((bitsLo | bitsHi) == 0))
-//				if (flagTRANS && (bitsHi == 0x88) && (bitsLo == 0x00))
-				;	// Do nothing...
-			else
-			{
-				if (!flagRMW)
-					*currentLineBuffer = bitsHi,
-					*(currentLineBuffer + 1) = bitsLo;
-				else
-					*currentLineBuffer =
-						BLEND_CR(*currentLineBuffer, bitsHi),
-					*(currentLineBuffer + 1) =
-						BLEND_Y(*(currentLineBuffer + 1), bitsLo);
-			}
-
-			currentLineBuffer += lbufDelta;
-
-/*			horizontalRemainder -= 0x20;		// Subtract 1.0f in [3.5] fixed point format
-			while (horizontalRemainder & 0x80)
-			{
-				horizontalRemainder += hscale;
-				pixCount++;
-				pixels <<= 16;
-			}//*/
-//			while (horizontalRemainder <= 0x20)		// I.e., it's <= 0 (*before* subtraction)
-			while (horizontalRemainder < 0x20)		// I.e., it's <= 1.0 (*before* subtraction)
-			{
-				horizontalRemainder += hscale;
-				pixCount++;
-				pixels <<= 16;
-			}
-			horizontalRemainder -= 0x20;		// Subtract 1.0f in [3.5] fixed point format
-//*/
-			if (pixCount > 3)
-			{
-				int phrasesToSkip = pixCount / 4, pixelShift = pixCount % 4;
-
-				data += (pitch << 3) * phrasesToSkip;
-				pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-				pixels <<= 16 * pixelShift;
-
-				iwidth -= phrasesToSkip;
-
-				pixCount = pixelShift;
-			}
-		}
-	}
-	else if (depth == 5)							// 24 BPP
-	{
+	if (depth == 5)
 //I'm not sure that you can scale a 24 BPP bitmap properly--the JTRM seem to indicate as much.
-WriteLog("OP: Writing 24 BPP scaled bitmap!\n");
-if (firstPix != 0)
-	WriteLog("OP: Scaled bitmap @ 24 BPP requesting FIRSTPIX!\n");
-		// Not sure, but I think RMW only works with 16 BPP and below, and only in CRY mode...
-		// The LSB is OPFLAG_REFLECT, so sign extend it and or 4 into it.
-		int32_t lbufDelta = ((int8_t)((flags << 7) & 0xFF) >> 4) | 0x04;
-
-		while (iwidth--)
-		{
-			// Fetch phrase...
-			uint64_t pixels = ((uint64_t)JaguarReadLong(data, OP) << 32) | JaguarReadLong(data + 4, OP);
-			data += pitch << 3;						// Multiply pitch * 8 (optimize: precompute this value)
+		WriteLog("OP: Writing 24 BPP scaled bitmap!\n");
 
-			for(int i=0; i<2; i++)
-			{
-				uint8_t bits3 = pixels >> 56, bits2 = pixels >> 48,
-					bits1 = pixels >> 40, bits0 = pixels >> 32;
-
-				if (flagTRANS && (bits3 | bits2 | bits1 | bits0) == 0)
-					;	// Do nothing...
-				else
-					*currentLineBuffer = bits3,
-					*(currentLineBuffer + 1) = bits2,
-					*(currentLineBuffer + 2) = bits1,
-					*(currentLineBuffer + 3) = bits0;
-
-				currentLineBuffer += lbufDelta;
-				pixels <<= 32;
-			}
-		}
-	}
+	if (firstPix != 0 && depth < 6)
+		WriteLog("OP: Scaled bitmap @ %u BPP requesting FIRSTPIX!\n", op_bitmap_bit_depth[depth]);
+
+	if (depth < 6)
+		opScaledBitmapWriter[depth][flags](currentLineBuffer, data, pitch << 3, iwidth, hscale,
+			index & opIndexMask[depth], paletteRAM);
 }
@@ -6,10 +6,14 @@
 #define __OBJECTP_H__
 
 #include <stdint.h>
+#include "context.h"
+#include "state.h"
 
 void OPInit(void);
+void OPFillBlendTables(void);
 void OPReset(void);
 void OPDone(void);
+void OPStateSync(StateBuffer * sb);
 
 uint64_t OPLoadPhrase(uint32_t offset);
 
@@ -24,8 +28,18 @@ void OPSetCurrentObject(uint64_t object);
 #define OPFLAG_RMW			2					// Read-Modify-Write bit
 #define OPFLAG_REFLECT		1					// Horizontal mirror bit
 
+// What OP.CPP knows about the machine (see context.h)
+
+struct OPState
+{
+	uint8_t objectp_running;
+	uint32_t op_pointer;
+	uint32_t objectList[8192];					// Seen by OPDiscoverObjects()
+	uint32_t numberOfObjects;
+};
+
 // Exported variables
 
-extern uint8_t objectp_running;
+#define objectp_running		(CONTEXT(op).objectp_running)
 
 #endif	// __OBJECTP_H__
@@ -0,0 +1,424 @@
+//
+// profile.cpp: Built in profiler
+//
+
+//
+// Each thread keeps a small stack of what it's currently running. Whenever
+// something gets pushed or popped, the time since the last push/pop goes to
+// whatever was on top, so nested subsystems (the OP inside of event handling,
+// the blitter inside of the GPU) don't get counted twice. The DSP thread has a
+// stack of its own, which is why the totals are added up atomically.
+//
+// On top of the time, we count the work each subsystem does, which opcodes the
+// three CPUs run, which blitter commands get used & where in the memory map the
+// CPUs go. All of it stays compiled in; when profiling is switched off, each
+// hook costs a test of profileEnabled & nothing else.
+//
+// ProfileEndFrame() closes out a frame. If a dump file has been set up, every
+// so many frames a line of JSON with everything that was counted since the
+// last one gets tacked onto the end of it, & the counts start over. That makes
+// it possible to go back & see what a slow stretch of a game was up to.
+//
+
+#include "profile.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "dsp.h"
+#include "gpu.h"
+#include "m68000/m68kinterface.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#define PROFILE_STACK_SIZE		16
+
+bool profileEnabled = false;
+uint32_t profileM68KOpcodes[0x10000];
+
+static ProfileCounters counters[PROFILE_MAX];
+static uint64_t memoryAccesses[2][PROFILE_MEM_MAX];
+static ProfileBlit blits[PROFILE_BLIT_COMMANDS];
+static uint32_t numBlits = 0;
+
+// Only builds with threads need a stack per thread (not every platform we
+// build for has thread local storage)
+#ifdef HAVE_THREADS
+#define PROFILE_PER_THREAD	__thread
+#else
+#define PROFILE_PER_THREAD
+#endif
+
+static PROFILE_PER_THREAD int stack[PROFILE_STACK_SIZE];
+static PROFILE_PER_THREAD int depth = 0;
+static PROFILE_PER_THREAD uint64_t lastSwitch = 0;
+
+// Frame tracking
+static uint64_t frames = 0;
+static uint64_t frameStart = 0;
+static ProfileCounters frameBase[PROFILE_MAX];
+static ProfileFrame totalFrame, lastFrame, worstFrame;
+
+// Periodic dumps
+static char * dumpPath = NULL;
+static uint32_t dumpFrames = 0;
+
+static const char * profileName[PROFILE_MAX] = {
+	"68K", "GPU", "DSP", "OP", "Blitter", "Render", "Events"
+};
+
+static const char * memoryName[PROFILE_MEM_MAX] = {
+	"RAM", "ROM", "CDROM", "BIOS", "TOM", "JERRY", "Other"
+};
+
+
+//
+// Returns a timestamp in nanoseconds
+//
+uint64_t ProfileClock(void)
+{
+#ifdef _WIN32
+	static LARGE_INTEGER frequency = { 0 };
+	LARGE_INTEGER count;
+
+	if (frequency.QuadPart == 0)
+		QueryPerformanceFrequency(&frequency);
+
+	QueryPerformanceCounter(&count);
+	return (uint64_t)((double)count.QuadPart * 1000000000.0 / (double)frequency.QuadPart);
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * 1000000000) + ts.tv_nsec;
+#endif
+}
+
+
+static inline void ProfileAdd(uint64_t * counter, uint64_t value)
+{
+#if defined(HAVE_THREADS) && defined(__GNUC__)
+	__atomic_fetch_add(counter, value, __ATOMIC_RELAXED);
+#else
+	*counter += value;
+#endif
+}
+
+
+void ProfilePush(int subsystem)
+{
+	uint64_t now = ProfileClock();
+
+	if (depth > 0 && depth <= PROFILE_STACK_SIZE)
+		ProfileAdd(&counters[stack[depth - 1]].time, now - lastSwitch);
+
+	if (depth < PROFILE_STACK_SIZE)
+		stack[depth] = subsystem;
+
+	ProfileAdd(&counters[subsystem].calls, 1);
+	depth++;
+	lastSwitch = now;
+}
+
+
+void ProfilePop(void)
+{
+	// If profiling got switched on in the middle of something, there won't be
+	// anything to pop
+	if (depth == 0)
+		return;
+
+	uint64_t now = ProfileClock();
+	depth--;
+
+	if (depth < PROFILE_STACK_SIZE)
+		ProfileAdd(&counters[stack[depth]].time, now - lastSwitch);
+
+	lastSwitch = now;
+}
+
+
+void ProfileAddWork(int subsystem, uint64_t work)
+{
+	ProfileAdd(&counters[subsystem].work, work);
+}
+
+
+void ProfileMemoryAccess(uint32_t address, bool write)
+{
+	int region;
+	address &= 0xFFFFFF;
+
+	// First 2M is mirrored in the $0 - $7FFFFF range
+	if (address < 0x800000)
+		region = PROFILE_MEM_RAM;
+	else if (address < 0xDFFF00)
+		region = PROFILE_MEM_ROM;
+	else if (address < 0xE00000)
+		region = PROFILE_MEM_CDROM;
+	else if (address < 0xE40000)
+		region = PROFILE_MEM_BIOS;
+	else if (address >= 0xF00000 && address < 0xF10000)
+		region = PROFILE_MEM_TOM;
+	else if (address >= 0xF10000 && address < 0xF20000)
+		region = PROFILE_MEM_JERRY;
+	else
+		region = PROFILE_MEM_OTHER;
+
+	ProfileAdd(&memoryAccesses[write ? 1 : 0][region], 1);
+}
+
+
+//
+// Blits only ever get kicked off from the main thread, so there's no need to
+// be careful here. If a game uses more command words than we have room for,
+// the ones that show up late don't get counted.
+//
+void ProfileBlitCommand(uint32_t cmd, uint64_t pixels)
+{
+	for(uint32_t i=0; i<numBlits; i++)
+	{
+		if (blits[i].cmd == cmd)
+		{
+			blits[i].blits++;
+			blits[i].pixels += pixels;
+			return;
+		}
+	}
+
+	if (numBlits < PROFILE_BLIT_COMMANDS)
+	{
+		blits[numBlits].cmd = cmd;
+		blits[numBlits].blits = 1;
+		blits[numBlits].pixels = pixels;
+		numBlits++;
+	}
+}
+
+
+//
+// Switching profiling on & off is best done between frames, when there's
+// nothing on the stack
+//
+void ProfileEnable(bool state)
+{
+	if (state && !profileEnabled)
+		ProfileReset();
+
+	profileEnabled = state;
+	depth = 0;
+}
+
+
+void ProfileReset(void)
+{
+	memset(counters, 0, sizeof(counters));
+	memset(memoryAccesses, 0, sizeof(memoryAccesses));
+	memset(profileM68KOpcodes, 0, sizeof(profileM68KOpcodes));
+	memset(blits, 0, sizeof(blits));
+	numBlits = 0;
+	GPUResetStats();
+	dsp_reset_stats();
+
+	frames = 0;
+	memset(frameBase, 0, sizeof(frameBase));
+	memset(&totalFrame, 0, sizeof(totalFrame));
+	memset(&lastFrame, 0, sizeof(lastFrame));
+	memset(&worstFrame, 0, sizeof(worstFrame));
+	frameStart = ProfileClock();
+}
+
+
+//
+// Sets up a file to append a line of JSON to every <frames> frames. Passing
+// NULL (or 0 frames) stops the dumps.
+//
+void ProfileSetDump(const char * path, uint32_t frames)
+{
+	free(dumpPath);
+	dumpPath = (path && frames ? strdup(path) : NULL);
+	dumpFrames = frames;
+}
+
+
+static void ProfileDump(void)
+{
+	FILE * fp = fopen(dumpPath, "a");
+
+	if (!fp)
+		return;
+
+	ProfileWriteJSON(fp);
+	fclose(fp);
+	ProfileReset();
+}
+
+
+void ProfileEndFrame(void)
+{
+	if (!profileEnabled)
+		return;
+
+	uint64_t now = ProfileClock();
+	lastFrame.time = now - frameStart;
+
+	for(int i=0; i<PROFILE_MAX; i++)
+	{
+		ProfileCounters current = counters[i];
+		lastFrame.subsystem[i].time = current.time - frameBase[i].time;
+		lastFrame.subsystem[i].work = current.work - frameBase[i].work;
+		lastFrame.subsystem[i].calls = current.calls - frameBase[i].calls;
+		frameBase[i] = current;
+	}
+
+	totalFrame.time += lastFrame.time;
+
+	if (lastFrame.time > worstFrame.time)
+		worstFrame = lastFrame;
+
+	frames++;
+	frameStart = now;
+
+	if (dumpPath && (frames % dumpFrames) == 0)
+		ProfileDump();
+}
+
+
+void ProfileGetStats(ProfileStats * stats)
+{
+	memset(stats, 0, sizeof(ProfileStats));
+	stats->frames = frames;
+	stats->total = totalFrame;
+	stats->last = lastFrame;
+	stats->worst = worstFrame;
+
+	for(int i=0; i<PROFILE_MAX; i++)
+		stats->total.subsystem[i] = counters[i];
+
+	for(int i=0; i<PROFILE_MEM_MAX; i++)
+	{
+		stats->memoryReads[i] = memoryAccesses[0][i];
+		stats->memoryWrites[i] = memoryAccesses[1][i];
+	}
+
+	for(uint32_t i=0; i<0x10000; i++)
+	{
+		if (profileM68KOpcodes[i])
+		{
+			uint32_t family = m68k_opcode_family(i);
+			stats->m68kOpcodes[family < PROFILE_M68K_FAMILIES ? family : 0] += profileM68KOpcodes[i];
+		}
+	}
+
+	for(int i=0; i<PROFILE_RISC_OPCODES; i++)
+	{
+		stats->gpuOpcodes[i] = gpu_opcode_use[i];
+		stats->dspOpcodes[i] = dsp_opcode_use[i];
+	}
+
+	// Biggest users first
+	stats->numBlits = numBlits;
+	memcpy(stats->blit, blits, sizeof(blits));
+
+	for(uint32_t i=1; i<numBlits; i++)
+	{
+		ProfileBlit blit = stats->blit[i];
+		uint32_t j = i;
+
+		for(; j>0 && stats->blit[j - 1].pixels < blit.pixels; j--)
+			stats->blit[j] = stats->blit[j - 1];
+
+		stats->blit[j] = blit;
+	}
+}
+
+
+static void ProfileWriteFrame(FILE * fp, const char * name, const ProfileFrame & frame)
+{
+	fprintf(fp, "\"%s\":{\"timeNs\":%llu", name, (unsigned long long)frame.time);
+
+	for(int i=0; i<PROFILE_MAX; i++)
+		fprintf(fp, ",\"%s\":{\"timeNs\":%llu,\"work\":%llu,\"calls\":%llu}", profileName[i],
+			(unsigned long long)frame.subsystem[i].time, (unsigned long long)frame.subsystem[i].work,
+			(unsigned long long)frame.subsystem[i].calls);
+
+	fprintf(fp, "}");
+}
+
+
+static void ProfileWriteOpcodes(FILE * fp, const char * name, const uint64_t * count, int numOpcodes,
+	const char * const * opcodeName)
+{
+	bool first = true;
+	fprintf(fp, ",\"%s\":{", name);
+
+	for(int i=0; i<numOpcodes; i++)
+	{
+		if (count[i] == 0)
+			continue;
+
+		fprintf(fp, "%s\"%s\":%llu", (first ? "" : ","),
+			(opcodeName ? opcodeName[i] : m68k_opcode_family_name(i)), (unsigned long long)count[i]);
+		first = false;
+	}
+
+	fprintf(fp, "}");
+}
+
+
+//
+// Writes out everything on one line, so a dump file can be read a line (i.e.,
+// an interval) at a time
+//
+void ProfileWriteJSON(FILE * fp)
+{
+	ProfileStats * stats = (ProfileStats *)malloc(sizeof(ProfileStats));
+
+	if (!stats)
+		return;
+
+	ProfileGetStats(stats);
+	fprintf(fp, "{\"frames\":%llu,", (unsigned long long)stats->frames);
+	ProfileWriteFrame(fp, "total", stats->total);
+	fprintf(fp, ",");
+	ProfileWriteFrame(fp, "last", stats->last);
+	fprintf(fp, ",");
+	ProfileWriteFrame(fp, "worst", stats->worst);
+
+	fprintf(fp, ",\"memory\":{");
+
+	for(int i=0; i<PROFILE_MEM_MAX; i++)
+		fprintf(fp, "%s\"%s\":{\"reads\":%llu,\"writes\":%llu}", (i ? "," : ""), memoryName[i],
+			(unsigned long long)stats->memoryReads[i], (unsigned long long)stats->memoryWrites[i]);
+
+	fprintf(fp, "}");
+	ProfileWriteOpcodes(fp, "m68kOpcodes", stats->m68kOpcodes, PROFILE_M68K_FAMILIES, NULL);
+	ProfileWriteOpcodes(fp, "gpuOpcodes", stats->gpuOpcodes, PROFILE_RISC_OPCODES, gpu_opcode_str);
+	ProfileWriteOpcodes(fp, "dspOpcodes", stats->dspOpcodes, PROFILE_RISC_OPCODES, dsp_opcode_str);
+	fprintf(fp, ",\"blits\":[");
+
+	for(uint32_t i=0; i<stats->numBlits; i++)
+		fprintf(fp, "%s{\"cmd\":\"%08X\",\"blits\":%llu,\"pixels\":%llu}", (i ? "," : ""),
+			stats->blit[i].cmd, (unsigned long long)stats->blit[i].blits,
+			(unsigned long long)stats->blit[i].pixels);
+
+	fprintf(fp, "]}\n");
+	free(stats);
+}
+
+
+//
+// Returns the time spent in a subsystem in nanoseconds
+//
+uint64_t ProfileTime(int subsystem)
+{
+	return (subsystem >= 0 && subsystem < PROFILE_MAX ? counters[subsystem].time : 0);
+}
+
+
+const char * ProfileName(int subsystem)
+{
+	return (subsystem >= 0 && subsystem < PROFILE_MAX ? profileName[subsystem] : "???");
+}
@@ -0,0 +1,138 @@
+//
+// profile.h: Built in profiler
+//
+
+#ifndef __PROFILE_H__
+#define __PROFILE_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#ifndef __cplusplus
+#include <stdbool.h>
+#endif
+
+// The things that we keep track of the time spent in. Each one only gets the
+// time that's spent in it directly, so e.g. a blit that the 68K kicks off is
+// counted as blitter time & not 68K time.
+
+enum { PROFILE_M68K = 0, PROFILE_GPU, PROFILE_DSP, PROFILE_OP, PROFILE_BLITTER, PROFILE_RENDER,
+	PROFILE_EVENTS, PROFILE_MAX };
+
+// Where in the memory map the 68K, GPU & DSP go to over the bus
+
+enum { PROFILE_MEM_RAM = 0, PROFILE_MEM_ROM, PROFILE_MEM_CDROM, PROFILE_MEM_BIOS, PROFILE_MEM_TOM,
+	PROFILE_MEM_JERRY, PROFILE_MEM_OTHER, PROFILE_MEM_MAX };
+
+#define PROFILE_M68K_FAMILIES	128				// UAE's instruction families (MOVE, ADD, Bcc...)
+#define PROFILE_RISC_OPCODES	64
+#define PROFILE_BLIT_COMMANDS	64
+
+// The work a subsystem does is counted in whatever makes sense for it: clock
+// cycles for the 68K, GPU & DSP (each at its own clock), pixels for the
+// blitter, halflines for the OP & scanlines for the render. Calls is how many
+// times it was entered, which for event handling is the number of events.
+
+struct ProfileCounters
+{
+	uint64_t time;								// In nanoseconds
+	uint64_t work;
+	uint64_t calls;
+};
+
+struct ProfileFrame
+{
+	uint64_t time;								// Wall clock time, in nanoseconds
+	struct ProfileCounters subsystem[PROFILE_MAX];
+};
+
+struct ProfileBlit
+{
+	uint32_t cmd;
+	uint64_t blits;
+	uint64_t pixels;
+};
+
+// Everything that's been counted since the last ProfileReset(). The worst
+// frame is the one that took the longest, along with where its time went.
+
+struct ProfileStats
+{
+	uint64_t frames;
+	struct ProfileFrame total;
+	struct ProfileFrame last;
+	struct ProfileFrame worst;
+	uint64_t memoryReads[PROFILE_MEM_MAX];
+	uint64_t memoryWrites[PROFILE_MEM_MAX];
+	uint64_t m68kOpcodes[PROFILE_M68K_FAMILIES];
+	uint64_t gpuOpcodes[PROFILE_RISC_OPCODES];
+	uint64_t dspOpcodes[PROFILE_RISC_OPCODES];
+	uint32_t numBlits;							// Command words in blit[], most pixels first
+	struct ProfileBlit blit[PROFILE_BLIT_COMMANDS];
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern bool profileEnabled;
+extern uint32_t profileM68KOpcodes[0x10000];
+
+void ProfileEnable(bool state);
+void ProfileReset(void);
+void ProfilePush(int subsystem);
+void ProfilePop(void);
+void ProfileAddWork(int subsystem, uint64_t work);
+void ProfileMemoryAccess(uint32_t address, bool write);
+void ProfileBlitCommand(uint32_t cmd, uint64_t pixels);
+void ProfileEndFrame(void);
+void ProfileSetDump(const char * path, uint32_t frames);
+void ProfileGetStats(struct ProfileStats * stats);
+void ProfileWriteJSON(FILE * fp);
+uint64_t ProfileClock(void);
+uint64_t ProfileTime(int subsystem);
+const char * ProfileName(int subsystem);
+
+#ifdef __cplusplus
+}
+#endif
+
+// These are what goes around the code being profiled. When profiling is off,
+// they cost a test & a (well predicted) branch.
+
+static inline void ProfileEnter(int subsystem)
+{
+	if (profileEnabled)
+		ProfilePush(subsystem);
+}
+
+static inline void ProfileLeave(void)
+{
+	if (profileEnabled)
+		ProfilePop();
+}
+
+static inline void ProfileWork(int subsystem, uint64_t work)
+{
+	if (profileEnabled)
+		ProfileAddWork(subsystem, work);
+}
+
+static inline void ProfileRead(uint32_t address)
+{
+	if (profileEnabled)
+		ProfileMemoryAccess(address, false);
+}
+
+static inline void ProfileWrite(uint32_t address)
+{
+	if (profileEnabled)
+		ProfileMemoryAccess(address, true);
+}
+
+static inline void ProfileM68KOpcode(uint32_t opcode)
+{
+	if (profileEnabled)
+		profileM68KOpcodes[opcode]++;
+}
+
+#endif	// __PROFILE_H__
@@ -0,0 +1,969 @@
+//
+// risc.h: The Jaguar RISC core, shared by the GPU & DSP
+//
+// The interpreter here is the one that was in gpu.cpp & dsp.cpp: originally by
+// David Raingeard (Cal2), GCC/SDL port by Niels Wagenaar (Linux/WIN32) and Caz
+// (BeOS), cleanups & rewrites by James Hammons.
+//
+// The GPU & DSP run the same instruction set; all that's different between the
+// two is where their local RAM is, how many interrupts they have, how wide the
+// MAC accumulator is & a handful of opcodes that only one of them has (the
+// GPU's PACK/SAT8/SAT16/SAT24/LOADP/STOREP & the DSP's ADDQMOD/SUBQMOD/SAT16S/
+// SAT32S/MIRROR). So the interpreter is written once, as a template on a traits
+// struct that each core fills in with those differences & references to its
+// own state. Since everything in the traits is known at compile time, each
+// instantiation comes out the same as if it had been written out by hand.
+//
+// The traits struct has to supply:
+//
+//   enum WHO, RAM_BASE, RAM_SIZE    Who it is (for memory accesses) & where
+//                                   its local RAM is
+//   enum IRQS                       # of interrupts (5 on the GPU, 6 on the DSP)
+//   enum PROFILE, DASM              What it is to the profiler & dasmjag()
+//   typedef Accumulator             Type of the MAC accumulator
+//   pc(), reg(), alternateReg(), ...
+//                                   Where this machine's core keeps its state
+//                                   (see the GPU), decode cache included
+//   opcode, opcodeCycles            The core's opcode handler & timing tables
+//   ReadWord/ReadLong/WriteLong     The core's own memory accessors
+//   Exec(cycles)                    Runs a delay slot
+//   BeforeOpcode()                  Called before each instruction
+//   Tracing()                       True if every instruction should be logged
+//
+// Each core builds its opcode table out of the handlers in here, & keeps the
+// register I/O (which really is different between the two) to itself.
+//
+
+#ifndef __RISC_H__
+#define __RISC_H__
+
+#include <stdint.h>
+#include <string.h>
+#include "jagdasm.h"
+#include "jaguar.h"
+#include "log.h"
+#include "profile.h"
+#include "riscjit.h"
+#include "settings.h"
+
+#define RM				Core::reg()[Core::firstParameter()]
+#define RN				Core::reg()[Core::secondParameter()]
+#define ALTERNATE_RM	Core::alternateReg()[Core::firstParameter()]
+#define ALTERNATE_RN	Core::alternateReg()[Core::secondParameter()]
+#define IMM_1			Core::firstParameter()
+#define IMM_2			Core::secondParameter()
+
+template <class Core>
+struct RISC
+{
+	// FLAGS register bits
+
+	enum { ZERO_FLAG = 0x0001, CARRY_FLAG = 0x0002, NEGA_FLAG = 0x0004, IMASK = 0x0008, REGPAGE = 0x4000 };
+
+	static uint8_t branchCondition[8 * 32];
+	static const uint32_t convertZero[32];
+
+	//
+	// Flags. Z & N are kept as the result that set them, sign extended to 64
+	// bits: Z is set when the bottom 32 bits are zero & N is the top bit. That
+	// makes setting them one store, since nearly every opcode sets both from its
+	// result; only the things that look at them have to work them out.
+	//
+
+	static inline uint32_t FlagZ(void) { return ((uint32_t)Core::flagZN() == 0); }
+	static inline uint32_t FlagN(void) { return (uint32_t)(Core::flagZN() >> 63); }
+
+	// NCZ, as they are in the FLAGS register
+	static inline uint32_t Flags(void) { return (FlagN() << 2) | (Core::flagC() << 1) | FlagZ(); }
+
+	static inline void SetFlags(uint32_t flags)
+	{
+		SetZNFlags(flags & ZERO_FLAG, flags & NEGA_FLAG);
+		Core::flagC() = (flags & CARRY_FLAG) >> 1;
+	}
+
+	static inline void ClearZNC(void) { Core::flagZN() = 1, Core::flagC() = 0; }
+	static inline void SetZN(uint32_t r) { Core::flagZN() = (uint64_t)(int64_t)(int32_t)r; }
+	static inline void SetZ(uint32_t r) { Core::flagZN() = (Core::flagZN() & 0x8000000000000000ULL) | (r != 0); }
+	static inline void SetN(uint32_t r) { Core::flagZN() = (Core::flagZN() & ~0x8000000000000000ULL) | ((uint64_t)(r >> 31) << 63); }
+	static inline void SetZNFlags(uint32_t z, uint32_t n) { Core::flagZN() = (n ? 0x8000000000000000ULL : 0) | (z ? 0 : 1); }
+	static inline void SetZNCAdd(uint32_t a, uint32_t b, uint32_t r) { SetZN(r); Core::flagC() = (b > ~a); }
+	static inline void SetZNCSub(uint32_t a, uint32_t b, uint32_t r) { SetZN(r); Core::flagC() = (b > a); }
+
+	static inline bool BranchCondition(uint32_t condition) { return branchCondition[condition + (Flags() << 5)]; }
+
+	static inline bool IsLocal(uint32_t address) { return (address - Core::RAM_BASE) < Core::RAM_SIZE; }
+
+	// MIRROR reverses all 32 bits
+	static inline uint32_t Mirror(uint32_t r)
+	{
+		r = ((r >> 1) & 0x55555555) | ((r & 0x55555555) << 1);
+		r = ((r >> 2) & 0x33333333) | ((r & 0x33333333) << 2);
+		r = ((r >> 4) & 0x0F0F0F0F) | ((r & 0x0F0F0F0F) << 4);
+		r = ((r >> 8) & 0x00FF00FF) | ((r & 0x00FF00FF) << 8);
+		return (r >> 16) | (r << 16);
+	}
+
+	static void Init(void)
+	{
+		static bool tableFilled = false;
+
+		// Only has to be done once (every machine uses the same one; see context.h)
+		if (tableFilled)
+			return;
+
+		for(int i=0; i<8; i++)
+		{
+			for(int j=0; j<32; j++)
+			{
+				int result = 1;
+
+				if ((j & 1) && (i & ZERO_FLAG))
+					result = 0;
+
+				if ((j & 2) && !(i & ZERO_FLAG))
+					result = 0;
+
+				if ((j & 4) && (i & (CARRY_FLAG << (j >> 4))))
+					result = 0;
+
+				if ((j & 8) && !(i & (CARRY_FLAG << (j >> 4))))
+					result = 0;
+
+				branchCondition[(i * 32) + j] = result;
+			}
+		}
+
+		tableFilled = true;
+	}
+
+	//
+	// Throw away everything decoded or compiled from local RAM
+	//
+	static void Flush(void)
+	{
+		memset(Core::decodeCache(), 0, sizeof(RISCDecodedOp) * (Core::RAM_SIZE / 2));
+		RISCJitFlush(&Core::jit());
+	}
+
+	//
+	// Call on every write into local RAM (offset is from the start of it)
+	//
+	static inline void LocalWrite(uint32_t offset)
+	{
+		Core::decodeCache()[offset >> 1].valid = 0;
+		RISCJitWrite(&Core::jit(), offset);
+	}
+
+	//
+	// Change register banks if necessary
+	//
+	static void UpdateRegisterBanks(void)
+	{
+		int bank = (Core::flags() & REGPAGE);
+
+		if (Core::flags() & IMASK)
+			bank = 0;							// IMASK forces main bank to be bank 0
+
+		if (bank)
+			Core::reg() = Core::regBank1(), Core::alternateReg() = Core::regBank0();
+		else
+			Core::reg() = Core::regBank0(), Core::alternateReg() = Core::regBank1();
+	}
+
+	//
+	// The interrupts that are latched & enabled, if we're not already in one
+	//
+	static uint32_t PendingIRQs(void)
+	{
+		// Bail out if we're already in an interrupt!
+		if (Core::flags() & IMASK)
+			return 0;
+
+		// Get the interrupt latch & enable bits. The DSP's sixth interrupt is
+		// off on its own, past the INT_CLRx bits.
+		uint32_t bits = (Core::control() >> 6) & 0x1F, mask = (Core::flags() >> 4) & 0x1F;
+
+		if (Core::IRQS > 5)
+		{
+			bits |= (Core::control() >> 10) & 0x20;
+			mask |= (Core::flags() >> 11) & 0x20;
+		}
+
+		return bits & mask;
+	}
+
+	static bool IRQPending(void)
+	{
+		return PendingIRQs() != 0;
+	}
+
+	static void HandleIRQs(void)
+	{
+		uint32_t bits = PendingIRQs();
+
+		// Bail out if latched interrupts aren't enabled
+		if (!bits)
+			return;
+
+		// Determine which interrupt to service (the highest one wins)
+		uint32_t which = 0;
+
+		for(uint32_t i=1; i<Core::IRQS; i++)
+		{
+			if (bits & (1 << i))
+				which = i;
+		}
+
+#ifdef DEBUG_HOOKS
+		extern int start_logging;
+
+		if (start_logging)
+			WriteLog("%s: Generating IRQ #%u\n", Core::jit().name, which);
+#endif
+
+		// set the interrupt flag
+		Core::flags() |= IMASK;
+		UpdateRegisterBanks();
+
+		// subqt  #4,r31		; pre-decrement stack pointer
+		// move  pc,r30			; address of interrupted code
+		// store  r30,(r31)     ; store return address
+		Core::reg()[31] -= 4;
+		Core::WriteLong(Core::reg()[31], Core::pc() - 2);
+
+		// movei  #service_address,r30  ; pointer to ISR entry
+		// jump  (r30)					; jump to ISR
+		// nop
+		Core::pc() = Core::reg()[30] = Core::RAM_BASE + (which * 0x10);
+	}
+
+	//
+	// Main execution loop. This doesn't check for interrupts; that's up to the
+	// core, as the GPU & DSP do it at different times.
+	//
+	static int32_t Run(int32_t cycles)
+	{
+#ifdef DEBUG_HOOKS
+		static bool tripwire = false;
+#endif
+		Core::inExec()++;
+		int32_t requested = cycles;
+
+		while (cycles > 0 && (Core::control() & 0x01))
+		{
+			Core::BeforeOpcode();
+
+			// Run a whole block of recompiled code if we can. Delay slots run
+			// thru Exec() (where we're called recursively) are always left to
+			// the interpreter; compiled jumps run theirs themselves.
+			if (vjs.useRISCJit && Core::inExec() == 1 && !Core::Tracing())
+			{
+				int32_t used = RISCJitExecute(&Core::jit(), cycles);
+
+				if (used)
+				{
+					cycles -= used;
+					continue;
+				}
+			}
+
+			uint32_t index;
+			void (* handler)(void);
+
+			if (IsLocal(Core::pc()) && !(Core::pc() & 0x01))
+			{
+				uint32_t offset = Core::pc() - Core::RAM_BASE;
+				RISCDecodedOp & op = Core::decodeCache()[offset >> 1];
+
+				if (!op.valid)
+				{
+					uint16_t opcode = ((uint16_t)Core::ram()[offset] << 8) | Core::ram()[offset + 1];
+					op.index = opcode >> 10;
+					op.handler = Core::opcode[op.index];
+					op.rm = (opcode >> 5) & 0x1F;
+					op.rn = opcode & 0x1F;
+					op.valid = 1;
+				}
+
+				index = op.index;
+				handler = op.handler;
+				Core::firstParameter() = op.rm;
+				Core::secondParameter() = op.rn;
+			}
+			else
+			{
+				uint16_t opcode = Core::ReadWord(Core::pc());
+				index = opcode >> 10;
+				handler = Core::opcode[index];
+				Core::firstParameter() = (opcode >> 5) & 0x1F;
+				Core::secondParameter() = opcode & 0x1F;
+			}
+
+#ifdef DEBUG_HOOKS
+			if (Core::Tracing())
+			{
+				char buffer[512];
+				dasmjag(Core::DASM, buffer, Core::pc());
+				WriteLog("%s: [%08X] %s (RM=%08X, RN=%08X) -> ", Core::jit().name, Core::pc(), buffer, RM, RN);
+			}
+#endif
+
+			Core::pc() += 2;
+			handler();
+			cycles -= Core::opcodeCycles[index];
+			Core::opcodeUse()[index]++;
+
+#ifdef DEBUG_HOOKS
+			if (Core::Tracing())
+				WriteLog("(RM=%08X, RN=%08X)\n", RM, RN);
+
+			if (!IsLocal(Core::pc()) && !tripwire)
+			{
+				WriteLog("%s: Executing outside local RAM! PC: %08X\n", Core::jit().name, Core::pc());
+				tripwire = true;
+			}
+#endif
+		}
+
+		Core::inExec()--;
+		ProfileWork(Core::PROFILE, requested - cycles);
+
+		// # of cycles actually run (which can be a few more than asked for)
+		return requested - cycles;
+	}
+
+	//
+	// Opcodes that both cores have
+	//
+
+	static void opcode_add(void)
+	{
+		uint32_t res = RN + RM;
+		SetZNCAdd(RN, RM, res);
+		RN = res;
+	}
+
+	static void opcode_addc(void)
+	{
+		uint32_t res = RN + RM + Core::flagC();
+		uint32_t carry = Core::flagC();
+//		SetZNCAdd(RN, RM, res); //???BUG??? Yes!
+		SetZNCAdd(RN + carry, RM, res);
+		RN = res;
+	}
+
+	static void opcode_addq(void)
+	{
+		uint32_t r1 = convertZero[IMM_1];
+		uint32_t res = RN + r1;
+		SetZNCAdd(RN, r1, res);
+		RN = res;
+	}
+
+	static void opcode_addqt(void)
+	{
+		RN += convertZero[IMM_1];
+	}
+
+	static void opcode_sub(void)
+	{
+		uint32_t res = RN - RM;
+		SetZNCSub(RN, RM, res);
+		RN = res;
+	}
+
+	static void opcode_subc(void)
+	{
+		// This is how the ALU does it--Two's complement with inverted carry
+		uint64_t res = (uint64_t)RN + (uint64_t)(RM ^ 0xFFFFFFFF) + (Core::flagC() ^ 1);
+		// Carry out of the result is inverted too
+		Core::flagC() = ((res >> 32) & 0x01) ^ 1;
+		RN = (res & 0xFFFFFFFF);
+		SetZN(RN);
+	}
+
+	static void opcode_subq(void)
+	{
+		uint32_t r1 = convertZero[IMM_1];
+		uint32_t res = RN - r1;
+		SetZNCSub(RN, r1, res);
+		RN = res;
+	}
+
+	static void opcode_subqt(void)
+	{
+		RN -= convertZero[IMM_1];
+	}
+
+	static void opcode_neg(void)
+	{
+		uint32_t res = -RN;
+		SetZNCSub(0, RN, res);
+		RN = res;
+	}
+
+	static void opcode_and(void)
+	{
+		RN = RN & RM;
+		SetZN(RN);
+	}
+
+	static void opcode_or(void)
+	{
+		RN = RN | RM;
+		SetZN(RN);
+	}
+
+	static void opcode_xor(void)
+	{
+		RN = RN ^ RM;
+		SetZN(RN);
+	}
+
+	static void opcode_not(void)
+	{
+		RN = ~RN;
+		SetZN(RN);
+	}
+
+	static void opcode_btst(void)
+	{
+		SetZ((RN >> IMM_1) & 1);
+	}
+
+	static void opcode_bset(void)
+	{
+		uint32_t res = RN | (1 << IMM_1);
+		RN = res;
+		SetZN(res);
+	}
+
+	static void opcode_bclr(void)
+	{
+		uint32_t res = RN & ~(1 << IMM_1);
+		RN = res;
+		SetZN(res);
+	}
+
+	static void opcode_mult(void)
+	{
+		RN = (uint16_t)RM * (uint16_t)RN;
+		SetZN(RN);
+	}
+
+	static void opcode_imult(void)
+	{
+		RN = (int16_t)RN * (int16_t)RM;
+		SetZN(RN);
+	}
+
+	static void opcode_imultn(void)
+	{
+		// This is OK, since this multiply won't overflow 32 bits...
+		int32_t res = (int32_t)((int16_t)RN * (int16_t)RM);
+		Core::acc() = (typename Core::Accumulator)res;
+		SetZN(res);
+	}
+
+	static void opcode_resmac(void)
+	{
+		RN = (uint32_t)Core::acc();
+	}
+
+	static void opcode_imacn(void)
+	{
+		int32_t res = (int16_t)RM * (int16_t)RN;
+		Core::acc() += (typename Core::Accumulator)res;
+//Should we AND the result to fit into 40 bits here???
+	}
+
+	static void opcode_div(void)	// RN / RM
+	{
+		// Real algorithm, courtesy of SCPCD: NYAN!
+		uint32_t q = RN;
+		uint32_t r = 0;
+
+		// If 16.16 division, stuff top 16 bits of RN into remainder and put the
+		// bottom 16 of RN in top 16 of quotient
+		if (Core::divControl() & 0x01)
+			q <<= 16, r = RN >> 16;
+
+		for(int i=0; i<32; i++)
+		{
+			uint32_t sign = r & 0x80000000;
+			r = (r << 1) | ((q >> 31) & 0x01);
+			r += (sign ? RM : -RM);
+			q = (q << 1) | (((~r) >> 31) & 0x01);
+		}
+
+		RN = q;
+		Core::remain() = r;
+	}
+
+	static void opcode_abs(void)
+	{
+		Core::flagC() = RN >> 31;
+
+		//Is 0x80000000 a positive number? If so, then we need to set C to 0 as well!
+		if (RN == 0x80000000)
+			SetZNFlags(0, 1);
+		else
+		{
+			if (Core::flagC())
+				RN = -RN;
+
+			SetZN(RN);
+		}
+	}
+
+	static void opcode_sh(void)
+	{
+		if (RM & 0x80000000)		// Shift left
+		{
+			Core::flagC() = RN >> 31;
+			RN = ((int32_t)RM <= -32 ? 0 : RN << -(int32_t)RM);
+		}
+		else						// Shift right
+		{
+			Core::flagC() = RN & 0x01;
+			RN = (RM >= 32 ? 0 : RN >> RM);
+		}
+
+		SetZN(RN);
+	}
+
+	static void opcode_shlq(void)
+	{
+		// NB: This instruction is the *only* one that does (32 - immediate data).
+		int32_t r1 = 32 - IMM_1;
+		uint32_t res = RN << r1;
+		SetZN(res); Core::flagC() = (RN >> 31) & 1;
+		RN = res;
+	}
+
+	static void opcode_shrq(void)
+	{
+		int32_t r1 = convertZero[IMM_1];
+		uint32_t res = RN >> r1;
+		SetZN(res); Core::flagC() = RN & 1;
+		RN = res;
+	}
+
+	static void opcode_sha(void)
+	{
+		uint32_t res;
+
+		if ((int32_t)RM < 0)
+		{
+			res = ((int32_t)RM <= -32) ? 0 : (RN << -(int32_t)RM);
+			Core::flagC() = RN >> 31;
+		}
+		else
+		{
+			res = ((int32_t)RM >= 32) ? ((int32_t)RN >> 31) : ((int32_t)RN >> (int32_t)RM);
+			Core::flagC() = RN & 0x01;
+		}
+
+		RN = res;
+		SetZN(res);
+	}
+
+	static void opcode_sharq(void)
+	{
+		uint32_t res = (int32_t)RN >> convertZero[IMM_1];
+		SetZN(res); Core::flagC() = RN & 0x01;
+		RN = res;
+	}
+
+	static void opcode_ror(void)
+	{
+		uint32_t r1 = RM & 0x1F;
+		uint32_t res = (RN >> r1) | (RN << (32 - r1));
+		SetZN(res); Core::flagC() = (RN >> 31) & 1;
+		RN = res;
+	}
+
+	static void opcode_rorq(void)
+	{
+		uint32_t r1 = convertZero[IMM_1 & 0x1F];
+		uint32_t r2 = RN;
+		uint32_t res = (r2 >> r1) | (r2 << (32 - r1));
+		RN = res;
+		SetZN(res); Core::flagC() = (r2 >> 31) & 0x01;
+	}
+
+	static void opcode_cmp(void)
+	{
+		uint32_t res = RN - RM;
+		SetZNCSub(RN, RM, res);
+	}
+
+	static void opcode_cmpq(void)
+	{
+		static const int32_t sqtable[32] =
+			{ 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,-16,-15,-14,-13,-12,-11,-10,-9,-8,-7,-6,-5,-4,-3,-2,-1 };
+		uint32_t r1 = sqtable[IMM_1 & 0x1F];
+		uint32_t res = RN - r1;
+		SetZNCSub(RN, r1, res);
+	}
+
+	static void opcode_move(void)
+	{
+		RN = RM;
+	}
+
+	static void opcode_moveq(void)
+	{
+		RN = IMM_1;
+	}
+
+	static void opcode_moveta(void)
+	{
+		ALTERNATE_RN = RM;
+	}
+
+	static void opcode_movefa(void)
+	{
+		RN = ALTERNATE_RM;
+	}
+
+	static void opcode_movei(void)
+	{
+		// This instruction is followed by 32-bit value in LSW / MSW format...
+		if ((Core::pc() - Core::RAM_BASE) <= Core::RAM_SIZE - 4 && !(Core::pc() & 0x01))
+		{
+			const uint8_t * p = &Core::ram()[Core::pc() - Core::RAM_BASE];
+			RN = ((uint32_t)p[0] << 8) | (uint32_t)p[1] | ((uint32_t)p[2] << 24) | ((uint32_t)p[3] << 16);
+		}
+		else
+			RN = (uint32_t)Core::ReadWord(Core::pc()) | ((uint32_t)Core::ReadWord(Core::pc() + 2) << 16);
+
+		Core::pc() += 4;
+	}
+
+	static void opcode_move_pc(void)
+	{
+		// Should be previous PC--this might not always be previous instruction!
+		// Then again, this will point right at the *current* instruction, i.e., MOVE PC,R!
+		RN = Core::pc() - 2;
+	}
+
+// According to the docs, & "Do The Same", this address is long aligned...
+// So let's try it:
+// And it works!!! Need to fix all instances...
+// Also, Power Drive Rally seems to contradict the idea that only LOADs in
+// the $F03000-$F03FFF range are aligned...
+#warning "!!! Alignment issues, need to find definitive final word on this !!!"
+/*
+Preliminary testing on real hardware seems to confirm that something strange goes on
+with unaligned reads in main memory. When the address is off by 1, the result is the
+same as the long address with the top byte replaced by something. So if the read is
+from $401, and $400 has 12 34 56 78, the value read will be $nn345678, where nn is a currently unknown vlaue.
+When the address is off by 2, the result would be $nnnn5678, where nnnn is unknown.
+When the address is off by 3, the result would be $nnnnnn78, where nnnnnn is unknown.
+It may be that the "unknown" values come from the prefetch queue, but not sure how
+to test that. They seem to be stable, though, which would indicate such a mechanism.
+Sometimes, however, the off by 2 case returns $12345678!
+*/
+
+	static void opcode_loadb(void)
+	{
+		if (IsLocal(RM))
+			RN = Core::ReadLong(RM) & 0xFF;
+		else
+			RN = JaguarReadByte(RM, Core::WHO);
+	}
+
+	static void opcode_loadw(void)
+	{
+		if (IsLocal(RM))
+			RN = Core::ReadLong(RM & 0xFFFFFFFE) & 0xFFFF;
+		else
+			RN = JaguarReadWord(RM & 0xFFFFFFFE, Core::WHO);
+	}
+
+	static void opcode_load(void)
+	{
+		RN = Core::ReadLong(RM & 0xFFFFFFFC);
+	}
+
+	static inline uint32_t LoadLong(uint32_t address)
+	{
+		return Core::ReadLong(IsLocal(address) ? address & 0xFFFFFFFC : address);
+	}
+
+	static void opcode_load_r14_indexed(void)
+	{
+		RN = LoadLong(Core::reg()[14] + (convertZero[IMM_1] << 2));
+	}
+
+	static void opcode_load_r15_indexed(void)
+	{
+		RN = LoadLong(Core::reg()[15] + (convertZero[IMM_1] << 2));
+	}
+
+	static void opcode_load_r14_ri(void)
+	{
+		RN = LoadLong(Core::reg()[14] + RM);
+	}
+
+	static void opcode_load_r15_ri(void)
+	{
+		RN = LoadLong(Core::reg()[15] + RM);
+	}
+
+	static inline void StoreLong(uint32_t address, uint32_t data)
+	{
+		Core::WriteLong((IsLocal(address) ? address & 0xFFFFFFFC : address), data);
+	}
+
+	static void opcode_storeb(void)
+	{
+//Is this right???
+// Would appear to be so...!
+		if (IsLocal(RM))
+			Core::WriteLong(RM, RN & 0xFF);
+		else
+			JaguarWriteByte(RM, RN, Core::WHO);
+	}
+
+	static void opcode_storew(void)
+	{
+		if (IsLocal(RM))
+			Core::WriteLong(RM & 0xFFFFFFFE, RN & 0xFFFF);
+		else
+			JaguarWriteWord(RM & 0xFFFFFFFE, RN, Core::WHO);
+	}
+
+	static void opcode_store(void)
+	{
+		StoreLong(RM, RN);
+	}
+
+	static void opcode_store_r14_indexed(void)
+	{
+		StoreLong(Core::reg()[14] + (convertZero[IMM_1] << 2), RN);
+	}
+
+	static void opcode_store_r15_indexed(void)
+	{
+		StoreLong(Core::reg()[15] + (convertZero[IMM_1] << 2), RN);
+	}
+
+	static void opcode_store_r14_ri(void)
+	{
+		StoreLong(Core::reg()[14] + RM, RN);
+	}
+
+	static void opcode_store_r15_ri(void)
+	{
+		StoreLong(Core::reg()[15] + RM, RN);
+	}
+
+// There is a problem here with interrupt handlers the JUMP and JR instructions that
+// can cause trouble because an interrupt can occur *before* the instruction following the
+// jump can execute... !!! FIX !!!
+	static void opcode_jump(void)
+	{
+		if (BranchCondition(IMM_2))
+		{
+#ifdef DEBUG_HOOKS
+			if (Core::Tracing())
+				WriteLog("    --> JUMP: Branch taken.\n");
+#endif
+			uint32_t delayed_pc = RM;
+			Core::Exec(1);
+			Core::pc() = delayed_pc;
+		}
+	}
+
+	static void opcode_jr(void)
+	{
+		if (BranchCondition(IMM_2))
+		{
+#ifdef DEBUG_HOOKS
+			if (Core::Tracing())
+				WriteLog("    --> JR: Branch taken.\n");
+#endif
+			int32_t offset = (IMM_1 & 0x10 ? 0xFFFFFFF0 | IMM_1 : IMM_1);		// Sign extend IMM_1
+			int32_t delayed_pc = Core::pc() + (offset * 2);
+			Core::Exec(1);
+			Core::pc() = delayed_pc;
+		}
+	}
+
+	static void opcode_mmult(void)
+	{
+		int count = Core::matrixControl() & 0x0F;	// Matrix width
+		uint32_t addr = Core::pointerToMatrix();		// In local RAM
+		uint32_t step = (Core::matrixControl() & 0x10 ? 4 * count : 4);	// Column or row stepping
+		int64_t accum = 0;
+
+		for(int i=0; i<count; i++)
+		{
+			int16_t a;
+
+			if (i & 0x01)
+				a = (int16_t)((Core::alternateReg()[IMM_1 + (i >> 1)] >> 16) & 0xFFFF);
+			else
+				a = (int16_t)(Core::alternateReg()[IMM_1 + (i >> 1)] & 0xFFFF);
+
+			int16_t b = (int16_t)Core::ReadWord(addr + 2);
+			accum += a * b;
+			addr += step;
+		}
+
+		RN = (int32_t)accum;
+		// carry flag to do (out of the last add)
+		SetZN(RN);
+	}
+
+	static void opcode_mtoi(void)
+	{
+		uint32_t _RM = RM;
+		uint32_t res = RN = (((int32_t)_RM >> 8) & 0xFF800000) | (_RM & 0x007FFFFF);
+		SetZN(res);
+	}
+
+	static void opcode_normi(void)
+	{
+		uint32_t _RM = RM;
+		uint32_t res = 0;
+
+		if (_RM)
+		{
+			while ((_RM & 0xFFC00000) == 0)
+			{
+				_RM <<= 1;
+				res--;
+			}
+
+			while ((_RM & 0xFF800000) != 0)
+			{
+				_RM >>= 1;
+				res++;
+			}
+		}
+
+		RN = res;
+		SetZN(res);
+	}
+
+	static void opcode_nop(void)
+	{
+	}
+
+	//
+	// GPU only opcodes
+	//
+
+	static void opcode_sat8(void)
+	{
+		RN = ((int32_t)RN < 0 ? 0 : (RN > 0xFF ? 0xFF : RN));
+		SetZN(RN);
+	}
+
+	static void opcode_sat16(void)
+	{
+		RN = ((int32_t)RN < 0 ? 0 : (RN > 0xFFFF ? 0xFFFF : RN));
+		SetZN(RN);
+	}
+
+	static void opcode_sat24(void)
+	{
+		RN = ((int32_t)RN < 0 ? 0 : (RN > 0xFFFFFF ? 0xFFFFFF : RN));
+		SetZN(RN);
+	}
+
+	static void opcode_pack(void)
+	{
+		uint32_t val = RN;
+
+//BUG!	if (RM == 0)				// Pack
+		if (IMM_1 == 0)				// Pack
+			RN = ((val >> 10) & 0x0000F000) | ((val >> 5) & 0x00000F00) | (val & 0x000000FF);
+		else						// Unpack
+			RN = ((val & 0x0000F000) << 10) | ((val & 0x00000F00) << 5) | (val & 0x000000FF);
+	}
+
+	static void opcode_loadp(void)
+	{
+		uint32_t address = (IsLocal(RM) ? RM & 0xFFFFFFF8 : RM);
+		Core::hidata() = Core::ReadLong(address + 0);
+		RN = Core::ReadLong(address + 4);
+	}
+
+	static void opcode_storep(void)
+	{
+		uint32_t address = (IsLocal(RM) ? RM & 0xFFFFFFF8 : RM);
+		Core::WriteLong(address + 0, Core::hidata());
+		Core::WriteLong(address + 4, RN);
+	}
+
+	//
+	// DSP only opcodes
+	//
+
+	static void opcode_addqmod(void)
+	{
+		uint32_t r1 = convertZero[IMM_1];
+		uint32_t r2 = RN;
+		uint32_t res = r2 + r1;
+		res = (res & (~Core::modulo())) | (r2 & Core::modulo());
+		RN = res;
+		SetZNCAdd(r2, r1, res);
+	}
+
+	static void opcode_subqmod(void)
+	{
+		uint32_t r1 = convertZero[IMM_1];
+		uint32_t r2 = RN;
+		uint32_t res = r2 - r1;
+		res = (res & (~Core::modulo())) | (r2 & Core::modulo());
+		RN = res;
+		SetZNCSub(r2, r1, res);
+	}
+
+	static void opcode_sat16s(void)
+	{
+		int32_t r2 = RN;
+		uint32_t res = (r2 < -32768) ? -32768 : (r2 > 32767) ? 32767 : r2;
+		RN = res;
+		SetZN(res);
+	}
+
+	static void opcode_sat32s(void)
+	{
+		int32_t r2 = (uint32_t)RN;
+		int32_t temp = Core::acc() >> 32;
+		uint32_t res = (temp < -1) ? (int32_t)0x80000000 : (temp > 0) ? (int32_t)0x7FFFFFFF : r2;
+		RN = res;
+		SetZN(res);
+	}
+
+	static void opcode_mirror(void)
+	{
+		RN = Mirror(RN);
+		SetZN(RN);
+	}
+
+	static void opcode_illegal(void)
+	{
+		// Don't know what it does, but it does *something*...
+		WriteLog("%06X: illegal %u, %u [NCZ:%u%u%u]\n", Core::pc() - 2, IMM_1, IMM_2, FlagN(), Core::flagC(), FlagZ());
+	}
+};
+
+template <class Core> uint8_t RISC<Core>::branchCondition[8 * 32];
+template <class Core> const uint32_t RISC<Core>::convertZero[32] =
+	{ 32,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31 };
+
+#undef RM
+#undef RN
+#undef ALTERNATE_RM
+#undef ALTERNATE_RN
+#undef IMM_1
+#undef IMM_2
+
+#endif	// __RISC_H__
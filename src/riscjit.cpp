@@ -0,0 +1,1133 @@
+//
+// riscjit.cpp: Basic block recompiler for the GPU & DSP RISC cores
+//
+
+//
+// This translates runs of local RAM code into x86-64 code. The register to
+// register ops are done inline, with the flags worked out the same way the
+// interpreter keeps them; everything else is compiled as a call to the
+// interpreter's handler with the operand fields & PC stored beforehand.
+//
+// A block keeps going thru stores, but after each one it checks whether the
+// store did anything the interpreter loop would have noticed--stopped the
+// core, moved the PC (an interrupt or a write to the PC register), wrote over
+// the block itself or set the core's attention flag--& returns if it did.
+// JUMP & JR test the condition inline. If the jump is taken, the delay slot is
+// run right there (just as Exec(1) would have), the PC is set & the block
+// returns; if not, the block carries on with the delay slot as the next
+// instruction. Since an interrupt can sneak in ahead of a delay slot on the
+// GPU (see GPUExec()), the core can supply a check for that, & the block
+// returns in front of the jump if there is one.
+//
+// A block returns the number of cycles it used. It's only run if all of it
+// fits in the current timeslice, so every instruction it runs would also have
+// been run by the interpreter.
+//
+// The code buffer is never writable & executable at the same time: it's
+// flipped to RW to compile a block, & back to RX to run one.
+//
+// Building with RISC_JIT_VERIFY (make RISC_JIT_VERIFY=1) has each block record
+// the core's state after every instruction, which is then replayed thru the
+// interpreter's handlers & compared. Loads & stores aren't done again; their
+// results are taken from the recording, so nothing outside of the core sees
+// anything happen twice. Slow, but very handy when changing the code generator!
+//
+
+#include "riscjit.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "log.h"
+
+#ifdef RISC_JIT_X64
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+#endif
+
+#define MAX_BLOCK_INSTRUCTIONS	32
+#define MAX_BLOCK_WORDS			(MAX_BLOCK_INSTRUCTIONS * 3)
+#define MAX_BLOCK_BYTES			(128 + (MAX_BLOCK_INSTRUCTIONS * 256))
+#define CODE_BUFFER_SIZE		0x40000
+#define MAX_STATE_SIZE			1024
+
+enum { BLOCK_NONE = 0, BLOCK_COMPILED, BLOCK_UNCOMPILABLE };
+
+struct RISCJitBlock
+{
+	uint8_t * code;
+	uint32_t cycles;
+	uint16_t words;
+	uint8_t status;
+};
+
+
+#ifdef RISC_JIT_X64
+
+//
+// Executable memory handling
+//
+static uint8_t * AllocateCode(size_t size)
+{
+#ifdef _WIN32
+	return (uint8_t *)VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+	void * p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	return (p == MAP_FAILED ? NULL : (uint8_t *)p);
+#endif
+}
+
+
+static void FreeCode(uint8_t * code, size_t size)
+{
+#ifdef _WIN32
+	VirtualFree(code, 0, MEM_RELEASE);
+#else
+	munmap(code, size);
+#endif
+}
+
+
+//
+// Make the code buffer executable (& read only), or writable (& not executable)
+//
+static bool ProtectCode(RISCJitCore * core, bool executable)
+{
+	if (core->codeExecutable == executable)
+		return true;
+
+#ifdef _WIN32
+	DWORD old;
+	bool ok = (VirtualProtect(core->codeBuffer, CODE_BUFFER_SIZE, (executable ? PAGE_EXECUTE_READ : PAGE_READWRITE), &old) != 0);
+#else
+	bool ok = (mprotect(core->codeBuffer, CODE_BUFFER_SIZE, (executable ? PROT_READ | PROT_EXEC : PROT_READ | PROT_WRITE)) == 0);
+#endif
+
+	if (ok)
+		core->codeExecutable = executable;
+
+	return ok;
+}
+
+
+//
+// Code emitters. Register usage in a block:
+//   RBX = &firstParameter, RBP = &flagZN, R12 = &secondParameter, R13 = &pc,
+//   R14 = &opcodeUse[0], R15 = &reg (the current bank pointer)
+// These are all callee saved in both the SysV & Win64 ABIs. Above the 32 byte
+// shadow space, [RSP+32] holds &flagC & [RSP+40] holds a JUMP's target while
+// its delay slot runs.
+//
+static inline void Emit8(uint8_t *& p, uint8_t b)	{ *p++ = b; }
+static inline void Emit32(uint8_t *& p, uint32_t d)	{ memcpy(p, &d, 4); p += 4; }
+static inline void Emit64(uint8_t *& p, uint64_t q)	{ memcpy(p, &q, 8); p += 8; }
+
+
+// Fixes up a short jump emitted with a zero displacement to land here
+static inline void PatchJump8(uint8_t * jump, uint8_t * p)		{ jump[1] = (uint8_t)(p - (jump + 2)); }
+static inline void PatchJump32(uint8_t * jump, uint8_t * p)	{ uint32_t d = (uint32_t)(p - (jump + 6)); memcpy(jump + 2, &d, 4); }
+
+
+struct BlockCompiler
+{
+	RISCJitCore * core;
+	uint8_t * p;
+	uint32_t startWord;
+	uint32_t lastFirst, lastSecond;					// What the parameter globals hold
+	uint32_t use[64];								// Opcode counts not emitted yet
+};
+
+
+static inline uint16_t OpcodeAt(RISCJitCore * core, uint32_t word)
+{
+	return ((uint16_t)core->ram[word << 1] << 8) | core->ram[(word << 1) + 1];
+}
+
+
+static void EmitPrologue(uint8_t *& p, RISCJitCore * core)
+{
+	Emit8(p, 0x53);									// push rbx
+	Emit8(p, 0x55);									// push rbp
+	Emit8(p, 0x41); Emit8(p, 0x54);					// push r12
+	Emit8(p, 0x41); Emit8(p, 0x55);					// push r13
+	Emit8(p, 0x41); Emit8(p, 0x56);					// push r14
+	Emit8(p, 0x41); Emit8(p, 0x57);					// push r15
+	Emit8(p, 0x48); Emit8(p, 0x83); Emit8(p, 0xEC); Emit8(p, 0x38);	// sub rsp, 56 (keeps alignment, shadow space + 2 slots)
+	Emit8(p, 0x48); Emit8(p, 0xBB); Emit64(p, (uint64_t)(uintptr_t)core->firstParameter);	// mov rbx, imm64
+	Emit8(p, 0x48); Emit8(p, 0xBD); Emit64(p, (uint64_t)(uintptr_t)core->flagZN);			// mov rbp, imm64
+	Emit8(p, 0x49); Emit8(p, 0xBC); Emit64(p, (uint64_t)(uintptr_t)core->secondParameter);	// mov r12, imm64
+	Emit8(p, 0x49); Emit8(p, 0xBD); Emit64(p, (uint64_t)(uintptr_t)core->pc);				// mov r13, imm64
+	Emit8(p, 0x49); Emit8(p, 0xBE); Emit64(p, (uint64_t)(uintptr_t)core->opcodeUse);		// mov r14, imm64
+	Emit8(p, 0x49); Emit8(p, 0xBF); Emit64(p, (uint64_t)(uintptr_t)core->reg);				// mov r15, imm64
+	Emit8(p, 0x48); Emit8(p, 0xB8); Emit64(p, (uint64_t)(uintptr_t)core->flagC);			// mov rax, imm64
+	Emit8(p, 0x48); Emit8(p, 0x89); Emit8(p, 0x44); Emit8(p, 0x24); Emit8(p, 0x20);			// mov [rsp + 32], rax
+}
+
+
+//
+// Return from the block, saying it used the given number of cycles
+//
+static void EmitEpilogue(uint8_t *& p, uint32_t cycles)
+{
+	Emit8(p, 0xB8); Emit32(p, cycles);				// mov eax, imm32
+	Emit8(p, 0x48); Emit8(p, 0x83); Emit8(p, 0xC4); Emit8(p, 0x38);	// add rsp, 56
+	Emit8(p, 0x41); Emit8(p, 0x5F);					// pop r15
+	Emit8(p, 0x41); Emit8(p, 0x5E);					// pop r14
+	Emit8(p, 0x41); Emit8(p, 0x5D);					// pop r13
+	Emit8(p, 0x41); Emit8(p, 0x5C);					// pop r12
+	Emit8(p, 0x5D);									// pop rbp
+	Emit8(p, 0x5B);									// pop rbx
+	Emit8(p, 0xC3);									// ret
+}
+
+
+static void EmitStorePC(uint8_t *& p, uint32_t pc)
+{
+	Emit8(p, 0x41); Emit8(p, 0xC7); Emit8(p, 0x45); Emit8(p, 0x00); Emit32(p, pc);	// mov dword [r13], imm32
+}
+
+
+static void EmitLoadRegPointer(uint8_t *& p)
+{
+	Emit8(p, 0x49); Emit8(p, 0x8B); Emit8(p, 0x07);	// mov rax, [r15]
+}
+
+
+// ECX = RN (leaves RAX pointing at the registers)
+static void EmitLoadRN(uint8_t *& p, uint32_t rn)
+{
+	EmitLoadRegPointer(p);
+	Emit8(p, 0x8B); Emit8(p, 0x48); Emit8(p, rn << 2);		// mov ecx, [rax + RN]
+}
+
+
+// EDX = RM (RAX has to be pointing at the registers)
+static void EmitLoadRM(uint8_t *& p, uint32_t rm)
+{
+	Emit8(p, 0x8B); Emit8(p, 0x50); Emit8(p, rm << 2);		// mov edx, [rax + RM]
+}
+
+
+// RN = ECX (RAX has to be pointing at the registers)
+static void EmitStoreRN(uint8_t *& p, uint32_t rn)
+{
+	Emit8(p, 0x89); Emit8(p, 0x48); Emit8(p, rn << 2);		// mov [rax + RN], ecx
+}
+
+
+// Z & N from the result in ECX (trashes the top of RCX)
+static void EmitSetZN(uint8_t *& p)
+{
+	Emit8(p, 0x48); Emit8(p, 0x63); Emit8(p, 0xC9);			// movsxd rcx, ecx
+	Emit8(p, 0x48); Emit8(p, 0x89); Emit8(p, 0x4D); Emit8(p, 0x00);	// mov [rbp], rcx
+}
+
+
+// C from DL (trashes RAX)
+static void EmitSetC(uint8_t *& p)
+{
+	Emit8(p, 0x48); Emit8(p, 0x8B); Emit8(p, 0x44); Emit8(p, 0x24); Emit8(p, 0x20);	// mov rax, [rsp + 32]
+	Emit8(p, 0x88); Emit8(p, 0x10);							// mov [rax], dl
+}
+
+
+static void EmitSetCFromCarry(uint8_t *& p)
+{
+	Emit8(p, 0x0F); Emit8(p, 0x92); Emit8(p, 0xC2);			// setc dl
+}
+
+
+// DL = the top bit of ECX
+static void EmitTopBitToDL(uint8_t *& p)
+{
+	Emit8(p, 0x89); Emit8(p, 0xCA);							// mov edx, ecx
+	Emit8(p, 0xC1); Emit8(p, 0xEA); Emit8(p, 0x1F);			// shr edx, 31
+}
+
+
+// DL = the bottom bit of ECX
+static void EmitBottomBitToDL(uint8_t *& p)
+{
+	Emit8(p, 0x89); Emit8(p, 0xCA);							// mov edx, ecx
+	Emit8(p, 0x83); Emit8(p, 0xE2); Emit8(p, 0x01);			// and edx, 1
+}
+
+
+//
+// Add the opcode counts piled up so far to the core's
+//
+static void FlushUse(BlockCompiler & c)
+{
+	for(uint32_t i=0; i<64; i++)
+	{
+		if (c.use[i] && c.core->opcodeUse)
+		{
+			Emit8(c.p, 0x41); Emit8(c.p, 0x81); Emit8(c.p, 0x86); Emit32(c.p, i << 2); Emit32(c.p, c.use[i]);	// add dword [r14 + disp32], imm32
+		}
+
+		c.use[i] = 0;
+	}
+}
+
+
+//
+// Have the interpreter's handler do it. It expects the PC to already point
+// past the opcode, like it does in the interpreter loop.
+//
+static void EmitCall(BlockCompiler & c, uint32_t word, uint32_t index, uint32_t first, uint32_t second)
+{
+	uint8_t *& p = c.p;
+
+	if (first != c.lastFirst)
+	{
+		Emit8(p, 0xC7); Emit8(p, 0x03); Emit32(p, first);		// mov dword [rbx], imm32
+		c.lastFirst = first;
+	}
+
+	if (second != c.lastSecond)
+	{
+		Emit8(p, 0x41); Emit8(p, 0xC7); Emit8(p, 0x04); Emit8(p, 0x24); Emit32(p, second);	// mov dword [r12], imm32
+		c.lastSecond = second;
+	}
+
+	EmitStorePC(p, c.core->ramBase + (word << 1) + 2);
+	Emit8(p, 0x48); Emit8(p, 0xB8); Emit64(p, (uint64_t)(uintptr_t)c.core->opcode[index]);	// mov rax, imm64
+	Emit8(p, 0xFF); Emit8(p, 0xD0);							// call rax
+}
+
+
+#ifdef RISC_JIT_VERIFY
+static void VerifyRecord(RISCJitCore * core, uint32_t address);
+
+static void EmitVerifyRecord(BlockCompiler & c, uint32_t address)
+{
+	uint8_t *& p = c.p;
+#ifdef _WIN32
+	Emit8(p, 0x48); Emit8(p, 0xB9); Emit64(p, (uint64_t)(uintptr_t)c.core);	// mov rcx, imm64
+	Emit8(p, 0xBA); Emit32(p, address);						// mov edx, imm32
+#else
+	Emit8(p, 0x48); Emit8(p, 0xBF); Emit64(p, (uint64_t)(uintptr_t)c.core);	// mov rdi, imm64
+	Emit8(p, 0xBE); Emit32(p, address);						// mov esi, imm32
+#endif
+	Emit8(p, 0x48); Emit8(p, 0xB8); Emit64(p, (uint64_t)(uintptr_t)VerifyRecord);	// mov rax, imm64
+	Emit8(p, 0xFF); Emit8(p, 0xD0);							// call rax
+}
+#endif
+
+
+//
+// Compile the instruction at the given word (anything but a jump). Returns the
+// number of words it takes up.
+//
+static uint32_t EmitInstruction(BlockCompiler & c, uint32_t word)
+{
+	RISCJitCore * core = c.core;
+	uint8_t *& p = c.p;
+	uint16_t opcode = OpcodeAt(core, word);
+	uint32_t index = opcode >> 10;
+	uint32_t first = (opcode >> 5) & 0x1F, second = opcode & 0x1F;
+	uint8_t kind = core->opcodeKind[index];
+	uint32_t words = 1;
+
+	// A shift of 32 is undefined in C, so leave those to the handler to get
+	// whatever it gets
+	if ((kind == RJ_SHLQ || kind == RJ_SHRQ || kind == RJ_SHARQ || kind == RJ_RORQ) && first == 0)
+		kind = RJ_CALL;
+
+	switch (kind)
+	{
+	case RJ_NOP:
+		break;
+	case RJ_MOVE:
+		EmitLoadRegPointer(p);
+		Emit8(p, 0x8B); Emit8(p, 0x48); Emit8(p, first << 2);	// mov ecx, [rax + RM]
+		EmitStoreRN(p, second);
+		break;
+	case RJ_MOVEQ:
+		EmitLoadRegPointer(p);
+		Emit8(p, 0xC7); Emit8(p, 0x40); Emit8(p, second << 2); Emit32(p, first);	// mov dword [rax + RN], imm32
+		break;
+	case RJ_MOVEI:
+	{
+		// The immediate is in LSW/MSW order
+		uint32_t offset = word << 1;
+		uint32_t data = ((uint32_t)core->ram[offset + 2] << 8) | core->ram[offset + 3]
+			| ((uint32_t)core->ram[offset + 4] << 24) | ((uint32_t)core->ram[offset + 5] << 16);
+		EmitLoadRegPointer(p);
+		Emit8(p, 0xC7); Emit8(p, 0x40); Emit8(p, second << 2); Emit32(p, data);	// mov dword [rax + RN], imm32
+		words = 3;
+		break;
+	}
+	case RJ_MOVETA:
+		EmitLoadRegPointer(p);
+		Emit8(p, 0x8B); Emit8(p, 0x48); Emit8(p, first << 2);	// mov ecx, [rax + RM]
+		Emit8(p, 0x48); Emit8(p, 0xB8); Emit64(p, (uint64_t)(uintptr_t)core->alternateReg);	// mov rax, imm64
+		Emit8(p, 0x48); Emit8(p, 0x8B); Emit8(p, 0x00);			// mov rax, [rax]
+		EmitStoreRN(p, second);
+		break;
+	case RJ_MOVEFA:
+		Emit8(p, 0x48); Emit8(p, 0xB8); Emit64(p, (uint64_t)(uintptr_t)core->alternateReg);	// mov rax, imm64
+		Emit8(p, 0x48); Emit8(p, 0x8B); Emit8(p, 0x00);			// mov rax, [rax]
+		Emit8(p, 0x8B); Emit8(p, 0x48); Emit8(p, first << 2);	// mov ecx, [rax + RM]
+		EmitLoadRegPointer(p);
+		EmitStoreRN(p, second);
+		break;
+	case RJ_ADDQT:
+		EmitLoadRegPointer(p);
+		Emit8(p, 0x81); Emit8(p, 0x40); Emit8(p, second << 2); Emit32(p, core->convertZero[first]);	// add dword [rax + RN], imm32
+		break;
+	case RJ_SUBQT:
+		EmitLoadRegPointer(p);
+		Emit8(p, 0x81); Emit8(p, 0x68); Emit8(p, second << 2); Emit32(p, core->convertZero[first]);	// sub dword [rax + RN], imm32
+		break;
+	case RJ_ADD:
+	case RJ_SUB:
+	case RJ_CMP:
+		EmitLoadRN(p, second);
+		EmitLoadRM(p, first);
+		Emit8(p, (kind == RJ_ADD ? 0x01 : 0x29)); Emit8(p, 0xD1);	// add/sub ecx, edx
+		EmitSetCFromCarry(p);
+
+		if (kind != RJ_CMP)
+			EmitStoreRN(p, second);
+
+		EmitSetZN(p);
+		EmitSetC(p);
+		break;
+	case RJ_ADDQ:
+	case RJ_SUBQ:
+	case RJ_CMPQ:
+	{
+		// CMPQ's immediate is signed
+		uint32_t data = (kind == RJ_CMPQ ? (uint32_t)(int32_t)((first & 0x10) ? (int32_t)first - 32 : (int32_t)first)
+			: core->convertZero[first]);
+		EmitLoadRN(p, second);
+		Emit8(p, 0x81); Emit8(p, (kind == RJ_ADDQ ? 0xC1 : 0xE9)); Emit32(p, data);	// add/sub ecx, imm32
+		EmitSetCFromCarry(p);
+
+		if (kind != RJ_CMPQ)
+			EmitStoreRN(p, second);
+
+		EmitSetZN(p);
+		EmitSetC(p);
+		break;
+	}
+	case RJ_NEG:
+		EmitLoadRN(p, second);
+		Emit8(p, 0xF7); Emit8(p, 0xD9);							// neg ecx (sets carry if it wasn't zero)
+		EmitSetCFromCarry(p);
+		EmitStoreRN(p, second);
+		EmitSetZN(p);
+		EmitSetC(p);
+		break;
+	case RJ_AND:
+	case RJ_OR:
+	case RJ_XOR:
+		EmitLoadRN(p, second);
+		EmitLoadRM(p, first);
+		Emit8(p, (kind == RJ_AND ? 0x21 : (kind == RJ_OR ? 0x09 : 0x31))); Emit8(p, 0xD1);	// and/or/xor ecx, edx
+		EmitStoreRN(p, second);
+		EmitSetZN(p);
+		break;
+	case RJ_NOT:
+		EmitLoadRN(p, second);
+		Emit8(p, 0xF7); Emit8(p, 0xD1);							// not ecx
+		EmitStoreRN(p, second);
+		EmitSetZN(p);
+		break;
+	case RJ_BTST:
+		// Only Z changes, & it's set if the bit is clear
+		EmitLoadRN(p, second);
+		Emit8(p, 0x89); Emit8(p, 0xCA);							// mov edx, ecx
+		Emit8(p, 0xC1); Emit8(p, 0xEA); Emit8(p, first);		// shr edx, imm8
+		Emit8(p, 0x83); Emit8(p, 0xE2); Emit8(p, 0x01);			// and edx, 1
+		Emit8(p, 0x48); Emit8(p, 0x8B); Emit8(p, 0x4D); Emit8(p, 0x00);	// mov rcx, [rbp]
+		Emit8(p, 0x48); Emit8(p, 0xC1); Emit8(p, 0xE9); Emit8(p, 0x3F);	// shr rcx, 63
+		Emit8(p, 0x48); Emit8(p, 0xC1); Emit8(p, 0xE1); Emit8(p, 0x3F);	// shl rcx, 63
+		Emit8(p, 0x48); Emit8(p, 0x09); Emit8(p, 0xD1);			// or rcx, rdx
+		Emit8(p, 0x48); Emit8(p, 0x89); Emit8(p, 0x4D); Emit8(p, 0x00);	// mov [rbp], rcx
+		break;
+	case RJ_BSET:
+	case RJ_BCLR:
+		EmitLoadRN(p, second);
+		Emit8(p, 0x81);
+
+		if (kind == RJ_BSET)
+		{
+			Emit8(p, 0xC9); Emit32(p, 1 << first);				// or ecx, imm32
+		}
+		else
+		{
+			Emit8(p, 0xE1); Emit32(p, ~(1 << first));			// and ecx, imm32
+		}
+
+		EmitStoreRN(p, second);
+		EmitSetZN(p);
+		break;
+	case RJ_MULT:
+	case RJ_IMULT:
+	{
+		uint8_t extend = (kind == RJ_MULT ? 0xB7 : 0xBF);
+		EmitLoadRegPointer(p);
+		Emit8(p, 0x0F); Emit8(p, extend); Emit8(p, 0x48); Emit8(p, second << 2);	// movzx/movsx ecx, word [rax + RN]
+		Emit8(p, 0x0F); Emit8(p, extend); Emit8(p, 0x50); Emit8(p, first << 2);	// movzx/movsx edx, word [rax + RM]
+		Emit8(p, 0x0F); Emit8(p, 0xAF); Emit8(p, 0xCA);			// imul ecx, edx
+		EmitStoreRN(p, second);
+		EmitSetZN(p);
+		break;
+	}
+	case RJ_SHLQ:
+		// The only one that shifts by (32 - immediate)
+		EmitLoadRN(p, second);
+		EmitTopBitToDL(p);
+		Emit8(p, 0xC1); Emit8(p, 0xE1); Emit8(p, 32 - first);	// shl ecx, imm8
+		EmitStoreRN(p, second);
+		EmitSetZN(p);
+		EmitSetC(p);
+		break;
+	case RJ_SHRQ:
+	case RJ_SHARQ:
+		EmitLoadRN(p, second);
+		EmitBottomBitToDL(p);
+		Emit8(p, 0xC1); Emit8(p, (kind == RJ_SHRQ ? 0xE9 : 0xF9)); Emit8(p, first);	// shr/sar ecx, imm8
+		EmitStoreRN(p, second);
+		EmitSetZN(p);
+		EmitSetC(p);
+		break;
+	case RJ_RORQ:
+		EmitLoadRN(p, second);
+		EmitTopBitToDL(p);
+		Emit8(p, 0xC1); Emit8(p, 0xC9); Emit8(p, first);		// ror ecx, imm8
+		EmitStoreRN(p, second);
+		EmitSetZN(p);
+		EmitSetC(p);
+		break;
+	default:
+		EmitCall(c, word, index, first, second);
+	}
+
+	c.use[index]++;
+#ifdef RISC_JIT_VERIFY
+	EmitVerifyRecord(c, core->ramBase + (word << 1));
+#endif
+
+	return words;
+}
+
+
+//
+// After a store, get out if the interpreter loop would have done something
+// different from just going on to the next instruction
+//
+static void EmitStoreChecks(BlockCompiler & c, uint32_t nextPC, uint32_t cycles)
+{
+	RISCJitCore * core = c.core;
+	uint8_t *& p = c.p;
+	uint8_t * exit[4];
+	int numExits = 0;
+
+	FlushUse(c);
+
+	// The PC moved (an interrupt, or a write to the PC register)
+	Emit8(p, 0x41); Emit8(p, 0x81); Emit8(p, 0x7D); Emit8(p, 0x00); Emit32(p, nextPC);	// cmp dword [r13], imm32
+	exit[numExits++] = p;
+	Emit8(p, 0x75); Emit8(p, 0x00);							// jne exit
+
+	// The core was stopped
+	Emit8(p, 0x48); Emit8(p, 0xB8); Emit64(p, (uint64_t)(uintptr_t)core->control);	// mov rax, imm64
+	Emit8(p, 0xF6); Emit8(p, 0x00); Emit8(p, 0x01);			// test byte [rax], 1
+	exit[numExits++] = p;
+	Emit8(p, 0x74); Emit8(p, 0x00);							// jz exit
+
+	// The block was written over
+	Emit8(p, 0x48); Emit8(p, 0xB8); Emit64(p, (uint64_t)(uintptr_t)&core->block[c.startWord].status);	// mov rax, imm64
+	Emit8(p, 0x80); Emit8(p, 0x38); Emit8(p, BLOCK_COMPILED);	// cmp byte [rax], imm8
+	exit[numExits++] = p;
+	Emit8(p, 0x75); Emit8(p, 0x00);							// jne exit
+
+	// The core wants the interpreter loop to look at something
+	if (core->attention)
+	{
+		Emit8(p, 0x48); Emit8(p, 0xB8); Emit64(p, (uint64_t)(uintptr_t)core->attention);	// mov rax, imm64
+		Emit8(p, 0x80); Emit8(p, 0x38); Emit8(p, 0x00);		// cmp byte [rax], 0
+		exit[numExits++] = p;
+		Emit8(p, 0x75); Emit8(p, 0x00);						// jne exit
+	}
+
+	uint8_t * over = p;
+	Emit8(p, 0xEB); Emit8(p, 0x00);							// jmp over
+
+	for(int i=0; i<numExits; i++)
+		PatchJump8(exit[i], p);
+
+	EmitEpilogue(p, cycles);
+	PatchJump8(over, p);
+}
+
+
+//
+// Compile a JUMP or JR along with its delay slot. cycles is what the block has
+// used up to the jump.
+//
+static void EmitJump(BlockCompiler & c, uint32_t word, uint32_t cycles)
+{
+	RISCJitCore * core = c.core;
+	uint8_t *& p = c.p;
+	uint16_t opcode = OpcodeAt(core, word);
+	uint32_t index = opcode >> 10;
+	uint32_t first = (opcode >> 5) & 0x1F, condition = opcode & 0x1F;
+	uint32_t address = core->ramBase + (word << 1);
+	uint8_t * notTaken[3];
+	int numNotTaken = 0;
+
+	FlushUse(c);
+
+	// Conditions that ask for a flag to be both set & clear are never true
+	if ((condition & 0x03) == 0x03 || (condition & 0x0C) == 0x0C)
+	{
+		c.use[index]++;
+		return;
+	}
+
+	// Bits 0 & 1 want Z clear/set, bits 2 & 3 want C (or N, with bit 4) clear/set
+	if (condition & 0x03)
+	{
+		Emit8(p, 0x83); Emit8(p, 0x7D); Emit8(p, 0x00); Emit8(p, 0x00);	// cmp dword [rbp], 0 (Z is set if it's equal)
+		notTaken[numNotTaken++] = p;
+		Emit8(p, 0x0F); Emit8(p, (condition & 0x01 ? 0x84 : 0x85)); Emit32(p, 0);	// je/jne notTaken
+	}
+
+	if (condition & 0x0C)
+	{
+		if (condition & 0x10)
+		{
+			Emit8(p, 0xF6); Emit8(p, 0x45); Emit8(p, 0x07); Emit8(p, 0x80);	// test byte [rbp + 7], 0x80 (N)
+		}
+		else
+		{
+			Emit8(p, 0x48); Emit8(p, 0x8B); Emit8(p, 0x44); Emit8(p, 0x24); Emit8(p, 0x20);	// mov rax, [rsp + 32]
+			Emit8(p, 0x80); Emit8(p, 0x38); Emit8(p, 0x00);		// cmp byte [rax], 0 (C)
+		}
+
+		notTaken[numNotTaken++] = p;
+		Emit8(p, 0x0F); Emit8(p, (condition & 0x04 ? 0x85 : 0x84)); Emit32(p, 0);	// jne/je notTaken
+	}
+
+	// Taken. If the delay slot would be preceded by an interrupt, let the
+	// interpreter do the jump.
+	if (core->delaySlotIRQ)
+	{
+		Emit8(p, 0x48); Emit8(p, 0xB8); Emit64(p, (uint64_t)(uintptr_t)core->delaySlotIRQ);	// mov rax, imm64
+		Emit8(p, 0xFF); Emit8(p, 0xD0);						// call rax
+		Emit8(p, 0x84); Emit8(p, 0xC0);						// test al, al
+		uint8_t * noIRQ = p;
+		Emit8(p, 0x74); Emit8(p, 0x00);						// jz noIRQ
+		EmitStorePC(p, address);
+		EmitEpilogue(p, cycles);
+		PatchJump8(noIRQ, p);
+	}
+
+	// JUMP's target is read before the delay slot runs
+	if (core->opcodeKind[index] == RJ_JUMP)
+	{
+		EmitLoadRegPointer(p);
+		Emit8(p, 0x8B); Emit8(p, 0x48); Emit8(p, first << 2);	// mov ecx, [rax + RM]
+		Emit8(p, 0x89); Emit8(p, 0x4C); Emit8(p, 0x24); Emit8(p, 0x28);	// mov [rsp + 40], ecx
+	}
+
+	uint32_t lastFirst = c.lastFirst, lastSecond = c.lastSecond;
+	c.use[index]++;
+	EmitInstruction(c, word + 1);
+	FlushUse(c);
+
+	if (core->opcodeKind[index] == RJ_JUMP)
+	{
+		Emit8(p, 0x8B); Emit8(p, 0x4C); Emit8(p, 0x24); Emit8(p, 0x28);	// mov ecx, [rsp + 40]
+		Emit8(p, 0x41); Emit8(p, 0x89); Emit8(p, 0x4D); Emit8(p, 0x00);	// mov [r13], ecx
+	}
+	else
+	{
+		int32_t offset = (first & 0x10 ? (int32_t)first - 32 : (int32_t)first);
+		EmitStorePC(p, address + 2 + (offset * 2));
+	}
+
+	EmitEpilogue(p, cycles + core->opcodeCycles[index]);
+
+	// Not taken, so the delay slot is just the next instruction
+	for(int i=0; i<numNotTaken; i++)
+		PatchJump32(notTaken[i], p);
+
+	c.lastFirst = lastFirst;
+	c.lastSecond = lastSecond;
+	c.use[index]++;
+}
+
+
+//
+// Can the instruction at the given word go in a block (or be a delay slot)?
+//
+static bool Compilable(RISCJitCore * core, uint32_t word, bool delaySlot)
+{
+	uint32_t numWords = core->ramSize >> 1;
+
+	if (word >= numWords)
+		return false;
+
+	uint8_t kind = core->opcodeKind[OpcodeAt(core, word) >> 10];
+
+	if (kind == RJ_END || (kind == RJ_MOVEI && word + 3 > numWords))
+		return false;
+
+	if (delaySlot && (kind == RJ_JUMP || kind == RJ_JR))
+		return false;
+
+	return true;
+}
+
+
+//
+// Compile the block starting at the given word of local RAM. The code buffer
+// has to be writable.
+//
+static void CompileBlock(RISCJitCore * core, uint32_t startWord)
+{
+	RISCJitBlock & block = core->block[startWord];
+
+	if (core->codePosition + MAX_BLOCK_BYTES > CODE_BUFFER_SIZE)
+	{
+		WriteLog("JIT: %s code buffer full, flushing...\n", core->name);
+		RISCJitFlush(core);
+	}
+
+	BlockCompiler c;
+	c.core = core;
+	c.p = core->codeBuffer + core->codePosition;
+	c.startWord = startWord;
+	c.lastFirst = c.lastSecond = 0xFFFFFFFF;
+	memset(c.use, 0, sizeof(c.use));
+
+	uint8_t * start = c.p;
+	uint32_t word = startWord, count = 0, cycles = 0;
+	bool afterStore = false, jumpedAway = false;
+
+	EmitPrologue(c.p, core);
+
+	while (count < MAX_BLOCK_INSTRUCTIONS && Compilable(core, word, false))
+	{
+		uint32_t index = OpcodeAt(core, word) >> 10;
+		uint8_t kind = core->opcodeKind[index];
+
+		// A jump & its delay slot go in together, & a block never ends on a
+		// jump, so it's known where the block left off
+		if ((kind == RJ_JUMP || kind == RJ_JR)
+			&& (count + 2 > MAX_BLOCK_INSTRUCTIONS || !Compilable(core, word + 1, true)))
+			break;
+
+		if (afterStore)
+			EmitStoreChecks(c, core->ramBase + (word << 1), cycles);
+
+		if (kind == RJ_JUMP || kind == RJ_JR)
+		{
+			EmitJump(c, word, cycles);
+			word++;
+		}
+		else
+			word += EmitInstruction(c, word);
+
+		afterStore = (kind == RJ_STORE);
+		cycles += core->opcodeCycles[index];
+		count++;
+
+		// Nothing goes past a jump that's always taken (what's after its delay
+		// slot is likely to be data), but the slot is still part of the block
+		if ((kind == RJ_JUMP || kind == RJ_JR) && (OpcodeAt(core, word - 1) & 0x1F) == 0)
+		{
+			word += (core->opcodeKind[OpcodeAt(core, word) >> 10] == RJ_MOVEI ? 3 : 1);
+			jumpedAway = true;
+			break;
+		}
+	}
+
+	if (count == 0)
+	{
+		block.status = BLOCK_UNCOMPILABLE;
+		block.words = 1;
+		core->codeWord[startWord] = 1;
+		return;
+	}
+
+	// If it ended with a store, the PC is already where it should be--unless
+	// the store moved it
+	if (!jumpedAway)
+	{
+		FlushUse(c);
+
+		if (!afterStore)
+			EmitStorePC(c.p, core->ramBase + (word << 1));
+
+		EmitEpilogue(c.p, cycles);
+	}
+
+	block.code = start;
+	block.cycles = cycles;
+	block.words = word - startWord;
+	block.status = BLOCK_COMPILED;
+	core->codePosition += c.p - start;
+
+	for(uint32_t i=startWord; i<word; i++)
+		core->codeWord[i] = 1;
+}
+
+
+#ifdef RISC_JIT_VERIFY
+static void SaveState(RISCJitCore * core, uint8_t * buffer)
+{
+	for(uint32_t i=0; i<core->numState; i++)
+	{
+		memcpy(buffer, core->state[i].data, core->state[i].size);
+		buffer += core->state[i].size;
+	}
+}
+
+
+static void LoadState(RISCJitCore * core, const uint8_t * buffer)
+{
+	for(uint32_t i=0; i<core->numState; i++)
+	{
+		memcpy(core->state[i].data, buffer, core->state[i].size);
+		buffer += core->state[i].size;
+	}
+}
+
+
+//
+// Compare the core's state against what the compiled code recorded. The PC
+// isn't kept up to date inside of a block, so it's left out unless asked for.
+//
+static bool CompareState(RISCJitCore * core, const uint8_t * jit, uint32_t address, bool withPC)
+{
+	bool same = true;
+
+	for(uint32_t i=0; i<core->numState; i++)
+	{
+		const RISCJitState & state = core->state[i];
+
+		if ((state.data != core->pc || withPC) && memcmp(state.data, jit, state.size) != 0)
+		{
+			WriteLog("JIT: %s instruction @ %08X differs from the interpreter in %s!\n", core->name, address, state.name);
+
+			for(size_t j=0; j+4<=state.size; j+=4)
+			{
+				uint32_t a, b;
+				memcpy(&a, jit + j, 4);
+				memcpy(&b, (const uint8_t *)state.data + j, 4);
+
+				if (a != b)
+					WriteLog("     [%u] JIT=%08X interpreter=%08X\n", (unsigned)(j >> 2), a, b);
+			}
+
+			same = false;
+		}
+
+		jit += state.size;
+	}
+
+	return same;
+}
+
+
+//
+// Called by the compiled code after each instruction (other than a jump)
+//
+static void VerifyRecord(RISCJitCore * core, uint32_t address)
+{
+	if (core->traceLength > MAX_BLOCK_INSTRUCTIONS)
+		return;
+
+	SaveState(core, core->trace + (core->traceLength * core->stateSize));
+	core->traceAddress[core->traceLength] = address;
+	core->traceParameter[core->traceLength] = (*core->firstParameter << 8) | *core->secondParameter;
+	core->traceLength++;
+}
+
+
+//
+// The same test as the interpreter's branch condition table
+//
+static bool VerifyCondition(RISCJitCore * core, uint32_t condition)
+{
+	bool z = ((uint32_t)*core->flagZN == 0);
+	bool f = (condition & 0x10 ? (*core->flagZN >> 63) != 0 : *core->flagC != 0);
+
+	return !(((condition & 0x01) && z) || ((condition & 0x02) && !z)
+		|| ((condition & 0x04) && f) || ((condition & 0x08) && !f));
+}
+
+
+//
+// Run the block, then go thru what it did with the interpreter's handlers &
+// compare the two after each instruction. The core is left the way the
+// compiled code left it.
+//
+static int32_t VerifyBlock(RISCJitCore * core, RISCJitBlock & block, uint32_t startWord)
+{
+	uint8_t before[MAX_STATE_SIZE], after[MAX_STATE_SIZE];
+	uint32_t startPC = *core->pc;
+
+	// Stores in the block can change its code, so hang onto it as it was
+	for(uint32_t i=0; i<block.words; i++)
+		core->traceCode[i] = OpcodeAt(core, startWord + i);
+
+	SaveState(core, before);
+	core->traceLength = 0;
+	int32_t cycles = ((uint32_t (*)(void))block.code)();
+	SaveState(core, after);
+	LoadState(core, before);
+
+	uint32_t jumpTarget = 0;
+	bool inDelaySlot = false;
+
+	for(uint32_t i=0; i<core->traceLength; )
+	{
+		uint32_t address = *core->pc;
+		uint32_t word = ((address - core->ramBase) >> 1) - startWord;
+
+		if (word >= block.words)
+		{
+			WriteLog("JIT: %s block @ %08X went somewhere else (%08X) in the interpreter!\n", core->name, startPC, address);
+			break;
+		}
+
+		uint16_t opcode = core->traceCode[word];
+		uint32_t index = opcode >> 10;
+		uint32_t first = (opcode >> 5) & 0x1F, second = opcode & 0x1F;
+		uint8_t kind = core->opcodeKind[index];
+		*core->pc += 2;
+
+		if (kind == RJ_JUMP || kind == RJ_JR)
+		{
+			if (VerifyCondition(core, second))
+			{
+				int32_t offset = (first & 0x10 ? (int32_t)first - 32 : (int32_t)first);
+				jumpTarget = (kind == RJ_JUMP ? (*core->reg)[first] : *core->pc + (offset * 2));
+				inDelaySlot = true;
+			}
+
+			continue;
+		}
+
+		if (address != core->traceAddress[i])
+		{
+			WriteLog("JIT: %s block @ %08X went to %08X, but the interpreter went to %08X!\n", core->name, startPC, core->traceAddress[i], address);
+			break;
+		}
+
+		const uint8_t * jit = core->trace + (i * core->stateSize);
+		*core->firstParameter = first;
+		*core->secondParameter = second;
+
+		// Memory accesses only happen once; what they did was recorded
+		if (kind == RJ_LOAD || kind == RJ_STORE)
+		{
+			if (core->traceParameter[i] != ((first << 8) | second))
+				WriteLog("JIT: %s instruction @ %08X was called with the wrong operands (%04X)!\n", core->name, address, core->traceParameter[i]);
+
+			LoadState(core, jit);
+		}
+		else
+			core->opcode[index]();
+
+		CompareState(core, jit, address, false);
+
+		// Carry on from where the compiled code was, so one difference
+		// doesn't turn into a pile of them
+		uint32_t pc = *core->pc;
+		LoadState(core, jit);
+		*core->pc = pc;
+
+		if (inDelaySlot)
+		{
+			*core->pc = jumpTarget;
+			inDelaySlot = false;
+		}
+
+		i++;
+	}
+
+	uint32_t pc = *core->pc;
+	LoadState(core, after);
+
+	if (pc != *core->pc)
+		WriteLog("JIT: %s block @ %08X ended up at %08X, but the interpreter ended up at %08X!\n", core->name, startPC, *core->pc, pc);
+
+	return cycles;
+}
+#endif
+
+#endif	// RISC_JIT_X64
+
+
+bool RISCJitInit(RISCJitCore * core)
+{
+#ifdef RISC_JIT_X64
+	if (core->codeBuffer)
+		return true;
+
+	uint32_t numWords = core->ramSize >> 1;
+	core->block = (RISCJitBlock *)calloc(numWords, sizeof(RISCJitBlock));
+	core->codeWord = (uint8_t *)calloc(numWords, 1);
+	core->codeBuffer = AllocateCode(CODE_BUFFER_SIZE);
+	core->codePosition = 0;
+	core->codeExecutable = false;
+	bool ok = (core->block && core->codeWord && core->codeBuffer);
+
+#ifdef RISC_JIT_VERIFY
+	core->stateSize = 0;
+
+	for(uint32_t i=0; i<core->numState; i++)
+		core->stateSize += core->state[i].size;
+
+	core->trace = (uint8_t *)malloc((MAX_BLOCK_INSTRUCTIONS + 1) * core->stateSize);
+	core->traceAddress = (uint32_t *)malloc((MAX_BLOCK_INSTRUCTIONS + 1) * sizeof(uint32_t));
+	core->traceParameter = (uint32_t *)malloc((MAX_BLOCK_INSTRUCTIONS + 1) * sizeof(uint32_t));
+	core->traceCode = (uint16_t *)malloc(MAX_BLOCK_WORDS * sizeof(uint16_t));
+	ok = ok && core->trace && core->traceAddress && core->traceParameter && core->traceCode
+		&& (core->stateSize <= MAX_STATE_SIZE);
+#endif
+
+	if (ok)
+	{
+		WriteLog("JIT: Initialized %s recompiler.\n", core->name);
+		return true;
+	}
+
+	WriteLog("JIT: Could not allocate memory for the %s recompiler!\n", core->name);
+	RISCJitDone(core);
+#endif
+	return false;
+}
+
+
+void RISCJitDone(RISCJitCore * core)
+{
+#ifdef RISC_JIT_X64
+	if (core->codeBuffer)
+		FreeCode(core->codeBuffer, CODE_BUFFER_SIZE);
+#endif
+
+	free(core->block);
+	free(core->codeWord);
+	core->block = NULL;
+	core->codeWord = NULL;
+	core->codeBuffer = NULL;
+#ifdef RISC_JIT_VERIFY
+	free(core->trace);
+	free(core->traceAddress);
+	free(core->traceParameter);
+	free(core->traceCode);
+	core->trace = NULL;
+	core->traceAddress = NULL;
+	core->traceParameter = NULL;
+	core->traceCode = NULL;
+#endif
+}
+
+
+void RISCJitFlush(RISCJitCore * core)
+{
+	if (!core->codeBuffer)
+		return;
+
+	memset(core->block, 0, (core->ramSize >> 1) * sizeof(RISCJitBlock));
+	memset(core->codeWord, 0, core->ramSize >> 1);
+	core->codePosition = 0;
+}
+
+
+//
+// Something wrote to a word of local RAM that's part of at least one block,
+// so get rid of every block that covers it. The code space isn't reclaimed
+// until the next flush, so it's safe to do this from inside a handler (a
+// block that's running checks its status after every store).
+//
+void RISCJitInvalidateWord(RISCJitCore * core, uint32_t word)
+{
+	uint32_t first = (word >= MAX_BLOCK_WORDS ? word - MAX_BLOCK_WORDS : 0);
+
+	for(uint32_t i=first; i<=word; i++)
+	{
+		RISCJitBlock & block = core->block[i];
+
+		if (block.status != BLOCK_NONE && (i + block.words) > word)
+			block.status = BLOCK_NONE;
+	}
+
+	core->codeWord[word] = 0;
+}
+
+
+#ifdef RISC_JIT_X64
+//
+// Something went wrong flipping the code buffer between writable &
+// executable, so give up on the recompiler for good
+//
+static int32_t GiveUp(RISCJitCore * core)
+{
+	WriteLog("JIT: Could not change the protection of the %s code buffer, turning the recompiler off.\n", core->name);
+	RISCJitDone(core);
+	core->unavailable = true;
+	return 0;
+}
+#endif
+
+
+//
+// Run the block at the current PC, if there is one & it fits in the number of
+// cycles left. Returns the number of cycles used, or zero if the caller needs to
+// interpret the next instruction itself.
+//
+int32_t RISCJitExecute(RISCJitCore * core, int32_t cycles)
+{
+#ifdef RISC_JIT_X64
+	uint32_t offset = *core->pc - core->ramBase;
+
+	if (offset >= core->ramSize || (offset & 0x01))
+		return 0;
+
+	// Start up on first use, so nothing gets allocated unless it's turned on
+	if (!core->codeBuffer)
+	{
+		if (core->unavailable || !RISCJitInit(core))
+		{
+			core->unavailable = true;
+			return 0;
+		}
+	}
+
+	RISCJitBlock & block = core->block[offset >> 1];
+
+	if (block.status == BLOCK_NONE)
+	{
+		if (!ProtectCode(core, false))
+			return GiveUp(core);
+
+		CompileBlock(core, offset >> 1);
+	}
+
+	if (block.status != BLOCK_COMPILED || (int32_t)block.cycles > cycles)
+		return 0;
+
+	if (!ProtectCode(core, true))
+		return GiveUp(core);
+
+#ifdef RISC_JIT_VERIFY
+	return VerifyBlock(core, block, offset >> 1);
+#else
+	return ((uint32_t (*)(void))block.code)();
+#endif
+#else
+	return 0;
+#endif
+}
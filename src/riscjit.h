@@ -0,0 +1,108 @@
+//
+// riscjit.h: Basic block recompiler for the GPU & DSP RISC cores
+//
+
+#ifndef __RISCJIT_H__
+#define __RISCJIT_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(NO_RISC_JIT)
+#define RISC_JIT_X64
+#endif
+
+// How each opcode is treated by the recompiler. The simple register to
+// register ops are done inline, & most everything else is a call to the
+// interpreter's handler. Stores are calls too, but after each one the block
+// checks that it didn't stop the core, move the PC, write over the block or
+// need the core's attention (see RISCJitCore::attention) & gets out if it did.
+// JUMP & JR are done inline, including their delay slot. RJ_END ends a block &
+// leaves the opcode to the interpreter.
+
+enum { RJ_END = 0, RJ_CALL, RJ_LOAD, RJ_STORE, RJ_JUMP, RJ_JR, RJ_NOP,
+	RJ_MOVE, RJ_MOVEQ, RJ_MOVEI, RJ_MOVETA, RJ_MOVEFA,
+	RJ_ADD, RJ_ADDQ, RJ_ADDQT, RJ_SUB, RJ_SUBQ, RJ_SUBQT, RJ_NEG, RJ_CMP, RJ_CMPQ,
+	RJ_AND, RJ_OR, RJ_XOR, RJ_NOT, RJ_BTST, RJ_BSET, RJ_BCLR, RJ_MULT, RJ_IMULT,
+	RJ_SHLQ, RJ_SHRQ, RJ_SHARQ, RJ_RORQ };
+
+// A piece of the core's state that the verifier compares after each instruction
+
+struct RISCJitState
+{
+	void * data;
+	size_t size;
+	const char * name;
+};
+
+struct RISCJitBlock;
+
+// The interpreter's predecoded copy of local RAM, one entry per word (see
+// risc.h). It's here so that the cores can keep it with the rest of their state.
+
+struct RISCDecodedOp
+{
+	void (* handler)(void);
+	uint8_t index;
+	uint8_t rm, rn;
+	uint8_t valid;
+};
+
+// Everything the recompiler needs to know about a core. The first part is
+// filled in by the core that owns it; the rest is private to riscjit.cpp.
+
+struct RISCJitCore
+{
+	const char * name;
+	uint32_t ramBase;
+	uint32_t ramSize;
+	uint8_t * ram;
+	void (** opcode)(void);
+	const uint8_t * opcodeCycles;
+	uint32_t * opcodeUse;
+	const uint8_t * opcodeKind;						// RJ_* for each of the 64 opcodes
+	const uint32_t * convertZero;
+	uint32_t * firstParameter;
+	uint32_t * secondParameter;
+	uint32_t * pc;
+	uint32_t ** reg;
+	uint32_t ** alternateReg;
+	uint64_t * flagZN;
+	uint8_t * flagC;
+	uint32_t * control;
+	const bool * attention;							// If set after a store, leave the block (can be NULL)
+	bool (* delaySlotIRQ)(void);					// True if Exec() would take an IRQ (can be NULL)
+	const RISCJitState * state;
+	uint32_t numState;
+
+	RISCJitBlock * block;							// One per word of local RAM
+	uint8_t * codeWord;								// Set if a block covers the word
+	uint8_t * codeBuffer;
+	size_t codePosition;
+	bool codeExecutable;							// Code buffer is RX (otherwise it's RW)
+	bool unavailable;								// Set if we couldn't start up
+#ifdef RISC_JIT_VERIFY
+	uint8_t * trace;								// The core's state after each instruction
+	uint32_t * traceAddress;
+	uint32_t * traceParameter;
+	uint16_t * traceCode;							// The block's code, as it was compiled
+	uint32_t traceLength;
+	size_t stateSize;
+#endif
+};
+
+bool RISCJitInit(RISCJitCore * core);
+void RISCJitDone(RISCJitCore * core);
+void RISCJitFlush(RISCJitCore * core);
+void RISCJitInvalidateWord(RISCJitCore * core, uint32_t word);
+int32_t RISCJitExecute(RISCJitCore * core, int32_t cycles);
+
+// Called on every write to local RAM, so keep the common case (no code there) cheap
+
+static inline void RISCJitWrite(RISCJitCore * core, uint32_t offset)
+{
+	if (core->codeWord && core->codeWord[offset >> 1])
+		RISCJitInvalidateWord(core, offset >> 1);
+}
+
+#endif	// __RISCJIT_H__
@@ -16,5 +16,7 @@
 
 // Global variables
 
-VJSettings vjs;
+#ifndef MULTI_INSTANCE
+VJSettings settingsState;
+#endif
 
@@ -13,6 +13,7 @@
 #endif
 
 #include <stdint.h>
+#include "context.h"
 
 // Settings struct
 
@@ -35,6 +36,11 @@ struct VJSettings
 	bool allowWritesToROM;
 	uint32_t biosType;
 	bool useFastBlitter;
+	bool useBlitterShadow;
+	bool useRISCJit;
+	bool useDSPThread;
+	bool useRenderThread;
+	bool doomResHack;							// Double up Doom's 8 clock wide pixels
 
 	// Keybindings in order of U, D, L, R, C, B, A, Op, Pa, 0-9, #, *
 
@@ -61,6 +67,6 @@ enum { BT_K_SERIES, BT_M_SERIES, BT_STUBULATOR_1, BT_STUBULATOR_2 };
 
 // Exported variables
 
-extern VJSettings vjs;
+#define vjs				CONTEXT(settings)
 
 #endif	// __SETTINGS_H__
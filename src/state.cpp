@@ -13,13 +13,697 @@
 
 #include "state.h"
 
-bool SaveState(void)
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "dsp.h"
+#include "dspthread.h"
+#include "event.h"
+#include "gpu.h"
+#include "jaguar.h"
+#include "jerry.h"
+#include "log.h"
+#include "movie.h"
+#include "tom.h"
+
+// A state starts with this header, followed by the raw state data.
+
+#define STATE_MAGIC			0x53534A56			// "VJSS"
+#define DELTA_MAGIC			0x44534A56			// "VJSD"
+
+// A new keyframe is forced after this many deltas (which caps how many have to
+// be replayed to get to any one of them), or once more than this many pages
+// have been written to since the last delta (at which point the deltas aren't
+// much of a savings anymore).
+
+#define DELTA_KEYFRAME_INTERVAL		60
+#define DELTA_KEYFRAME_PAGES		(STATE_NUM_PAGES / 2)
+
+enum { DELTA_KEYFRAME = 0, DELTA_DELTA };
+
+// Every full state we save gets a serial number, & together with the session
+// (which is different for every run of the emulator) that tells us exactly
+// which state a buffer holds. When that's the state main RAM was last synced
+// with, only the pages written since then need to be copied; that's what
+// makes reloading the same state over & over (as run-ahead does) cheap.
+
+struct StateHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t size;								// Size of the data following this
+	uint32_t session;
+	uint32_t serial;
+	uint32_t reserved;
+};
+
+// Delta states get their serials from the same counter, so no two states saved
+// in one session ever share one, no matter what got loaded in between.
+
+struct DeltaHeader
+{
+	uint32_t magic;
+	uint16_t version;
+	uint8_t type;								// DELTA_KEYFRAME/DELTA_DELTA
+	uint8_t reserved;
+	uint32_t session;
+	uint32_t serial;
+	uint32_t parent;							// Serial of the state this is a delta of
+	uint32_t depth;								// # of deltas since the keyframe
+	uint32_t size;								// Size of the data following this
+};
+
+#ifndef MULTI_INSTANCE
+struct StateState stateState;
+#endif
+
+#define stateSession			(CONTEXT(state).stateSession)
+#define stateSerial				(CONTEXT(state).stateSerial)
+#define snapshotSerial			(CONTEXT(state).snapshotSerial)
+#define snapshotBuffer			(CONTEXT(state).snapshotBuffer)
+#define baseRAM					(CONTEXT(state).baseRAM)
+#define baseDevices				(CONTEXT(state).baseDevices)
+#define deltaDevices			(CONTEXT(state).deltaDevices)
+#define baseSession				(CONTEXT(state).baseSession)
+#define baseSerial				(CONTEXT(state).baseSerial)
+#define deltasSinceKeyframe		(CONTEXT(state).deltasSinceKeyframe)
+#define deltaBytesSinceKeyframe	(CONTEXT(state).deltaBytesSinceKeyframe)
+
+
+void StateSync(StateBuffer * sb, void * data, size_t size)
+{
+	if (sb->position + size > sb->size)
+		sb->error = true;
+	else if (sb->mode == STATE_SAVE)
+		memcpy(sb->data + sb->position, data, size);
+	else if (sb->mode == STATE_LOAD)
+		memcpy(data, sb->data + sb->position, size);
+
+	sb->position += size;
+}
+
+
+//
+// When loading, returns the data that the next size bytes are about to be
+// loaded from (so a subsystem can see what's going to change), otherwise NULL
+//
+const uint8_t * StatePeek(StateBuffer * sb, size_t size)
+{
+	if (sb->mode != STATE_LOAD || sb->position + size > sb->size)
+		return NULL;
+
+	return sb->data + sb->position;
+}
+
+
+static void ClearDirtyFlag(uint8_t flag)
+{
+	for(uint32_t i=0; i<STATE_NUM_PAGES; i++)
+		mainRAMDirtyPage[i] &= ~flag;
+}
+
+
+//
+// Loading a state writes RAM behind the dirty page tracking's back, so the
+// DSP thread has to take a fresh copy of all of it
+//
+static void MarkRAMReloaded(void)
+{
+	for(uint32_t i=0; i<STATE_NUM_PAGES; i++)
+		mainRAMDirtyPage[i] |= STATE_DIRTY_DSP_THREAD;
+}
+
+
+//
+// Copy main RAM to or from a state. If the state is the one RAM was last
+// synced with, only the pages that have been written since need to go.
+//
+static void SyncRAM(uint8_t * state, bool load, bool incremental)
+{
+	if (!incremental)
+	{
+		if (load)
+			memcpy(jaguarMainRAM, state, 0x200000);
+		else
+			memcpy(state, jaguarMainRAM, 0x200000);
+	}
+	else
+	{
+		for(uint32_t i=0; i<STATE_NUM_PAGES; i++)
+		{
+			if (!(mainRAMDirtyPage[i] & STATE_DIRTY_SNAPSHOT))
+				continue;
+
+			uint32_t offset = i << STATE_PAGE_SHIFT;
+
+			if (load)
+				memcpy(jaguarMainRAM + offset, state + offset, 1 << STATE_PAGE_SHIFT);
+			else
+				memcpy(state + offset, jaguarMainRAM + offset, 1 << STATE_PAGE_SHIFT);
+		}
+	}
+
+	ClearDirtyFlag(STATE_DIRTY_SNAPSHOT);
+}
+
+
+static uint32_t Session(void)
+{
+	if (stateSession == 0)
+		stateSession = ((uint32_t)time(NULL) ^ (uint32_t)(uintptr_t)&stateSession ^ (uint32_t)clock()) | 1;
+
+	return stateSession;
+}
+
+
+static bool IsSnapshot(const void * data)
+{
+	const StateHeader * header = (const StateHeader *)data;
+
+	return (snapshotSerial != 0 && header->magic == STATE_MAGIC && header->version == STATE_VERSION
+		&& header->session == stateSession && header->serial == snapshotSerial);
+}
+
+
+//
+// Run every subsystem (except main RAM) through the given buffer
+//
+static void SyncDevices(StateBuffer * sb)
+{
+	JaguarStateSync(sb);
+	TOMStateSync(sb);
+	JERRYStateSync(sb);
+	GPUStateSync(sb);
+	DSPStateSync(sb);
+	EventStateSync(sb);
+	MovieStateSync(sb);
+}
+
+
+size_t StateSize(void)
+{
+	static size_t stateSize = 0;
+
+	// The size never changes, so we only need to figure it out once
+	if (stateSize == 0)
+	{
+		StateBuffer sb = { STATE_MEASURE, NULL, (size_t)-1, 0, false };
+		SyncDevices(&sb);
+		stateSize = sizeof(StateHeader) + 0x200000 + sb.position;
+	}
+
+	return stateSize;
+}
+
+
+bool SaveState(void * data, size_t size)
+{
+	// Anything the DSP thread is holding on to has to land first
+	DSPThreadWait();
+
+	if (data == NULL || size < StateSize())
+		return false;
+
+	// If the frontend hands us back the buffer it got the last state in, RAM
+	// only has to be brought up to date
+	bool incremental = (data == snapshotBuffer && IsSnapshot(data));
+	uint8_t * ram = (uint8_t *)data + sizeof(StateHeader);
+
+	StateHeader * header = (StateHeader *)data;
+	header->magic = STATE_MAGIC;
+	header->version = STATE_VERSION;
+	header->size = StateSize() - sizeof(StateHeader);
+	header->session = Session();
+	header->serial = ++stateSerial;
+	header->reserved = 0;
+
+	StateBuffer sb = { STATE_SAVE, ram + 0x200000, header->size - 0x200000, 0, false };
+	SyncDevices(&sb);
+	SyncRAM(ram, false, incremental);
+	snapshotSerial = (sb.error ? 0 : header->serial);
+	snapshotBuffer = data;
+
+	return !sb.error;
+}
+
+
+bool LoadState(const void * data, size_t size)
+{
+	DSPThreadWait();
+
+	if (data == NULL || size < sizeof(StateHeader))
+		return false;
+
+	const StateHeader * header = (const StateHeader *)data;
+
+	if (header->magic != STATE_MAGIC || header->version != STATE_VERSION
+		|| header->size != StateSize() - sizeof(StateHeader)
+		|| size < StateSize())
+	{
+		WriteLog("STATE: Save state is incompatible with this version, not loading.\n");
+		return false;
+	}
+
+	// Nothing gets allocated or rebuilt here: main RAM is copied straight
+	// back (just the pages that changed, if this is the state RAM was last
+	// synced with), & the subsystems copy their own state back & only throw
+	// away what they've derived from anything that's actually different.
+	bool incremental = IsSnapshot(data);
+	uint8_t * ram = (uint8_t *)data + sizeof(StateHeader);
+	StateBuffer sb = { STATE_LOAD, ram + 0x200000, header->size - 0x200000, 0, false };
+	SyncDevices(&sb);
+	SyncRAM(ram, true, incremental);
+	MarkRAMReloaded();
+
+	// The delta states' base is no good anymore
+	baseSerial = 0;
+
+	if (sb.error)
+	{
+		WriteLog("STATE: Save state is corrupt!\n");
+		snapshotSerial = 0;
+	}
+	else
+	{
+		snapshotSerial = header->serial;
+		snapshotBuffer = data;
+		stateSerial = (header->serial > stateSerial ? header->serial : stateSerial);
+	}
+
+	return !sb.error;
+}
+
+
+//
+// Delta state support
+//
+
+// Size of the non-RAM part of a state, rounded up to a whole number of
+// 32-bit words (which is what the XOR encoder works on)
+static uint32_t DeviceWords(void)
+{
+	static uint32_t deviceWords = 0;
+
+	if (deviceWords == 0)
+	{
+		StateBuffer sb = { STATE_MEASURE, NULL, (size_t)-1, 0, false };
+		SyncDevices(&sb);
+		deviceWords = (uint32_t)((sb.position + 3) / 4);
+	}
+
+	return deviceWords;
+}
+
+
+static bool AllocateDeltaBuffers(void)
+{
+	if (baseRAM)
+		return true;
+
+	baseRAM = (uint8_t *)malloc(0x200000);
+	baseDevices = (uint32_t *)calloc(DeviceWords(), 4);
+	deltaDevices = (uint32_t *)calloc(DeviceWords(), 4);
+
+	if (!baseRAM || !baseDevices || !deltaDevices)
+	{
+		WriteLog("STATE: Could not allocate delta state buffers!\n");
+		free(baseRAM), free(baseDevices), free(deltaDevices);
+		baseRAM = NULL, baseDevices = deltaDevices = NULL;
+		return false;
+	}
+
+	return true;
+}
+
+
+//
+// XOR encoder/decoder. The data is a series of tokens: the number of words
+// that match the reference to skip over (16 bits), then the number of words
+// that don't (16 bits), followed by those words XORed with the reference.
+// Returns NULL if the output doesn't fit.
+//
+static uint8_t * EncodeXOR(const uint32_t * cur, const uint32_t * ref, uint32_t words, uint8_t * out, const uint8_t * end)
+{
+	uint32_t i = 0;
+
+	while (i < words)
+	{
+		uint32_t skip = 0, copy = 0;
+
+		while ((i + skip < words) && (skip < 0xFFFF) && (cur[i + skip] == ref[i + skip]))
+			skip++;
+
+		i += skip;
+
+		while ((i + copy < words) && (copy < 0xFFFF) && (cur[i + copy] != ref[i + copy]))
+			copy++;
+
+		if (out + 4 + (copy * 4) > end)
+			return NULL;
+
+		uint16_t counts[2] = { (uint16_t)skip, (uint16_t)copy };
+		memcpy(out, counts, 4);
+		out += 4;
+
+		for(uint32_t j=0; j<copy; j++, i++, out+=4)
+		{
+			uint32_t x = cur[i] ^ ref[i];
+			memcpy(out, &x, 4);
+		}
+	}
+
+	return out;
+}
+
+
+// Applies an encoded XOR stream to data (which must hold the reference)
+static const uint8_t * DecodeXOR(uint32_t * data, uint32_t words, const uint8_t * in, const uint8_t * end)
 {
-	return false;
+	uint32_t i = 0;
+
+	while (i < words)
+	{
+		uint16_t counts[2];
+
+		if (in + 4 > end)
+			return NULL;
+
+		memcpy(counts, in, 4);
+		in += 4;
+		i += counts[0];
+
+		if ((i + counts[1] > words) || (in + (counts[1] * 4) > end))
+			return NULL;
+
+		for(uint32_t j=0; j<counts[1]; j++, i++, in+=4)
+		{
+			uint32_t x;
+			memcpy(&x, in, 4);
+			data[i] ^= x;
+		}
+	}
+
+	return (i == words ? in : NULL);
+}
+
+
+size_t DeltaStateMaxSize(void)
+{
+	// A delta that would come out bigger than a keyframe is saved as one
+	return sizeof(DeltaHeader) + (DeviceWords() * 4) + 0x200000;
 }
 
-bool LoadState(void)
+
+static size_t SaveKeyframe(uint8_t * data, size_t size)
 {
-	return false;
+	size_t deviceSize = DeviceWords() * 4;
+
+	if (size < DeltaStateMaxSize())
+		return 0;
+
+	StateBuffer sb = { STATE_SAVE, (uint8_t *)baseDevices, deviceSize, 0, false };
+	SyncDevices(&sb);
+
+	if (sb.error)
+	{
+		baseSerial = 0;
+		return 0;
+	}
+
+	memcpy(baseRAM, jaguarMainRAM, 0x200000);
+	ClearDirtyFlag(STATE_DIRTY_DELTA);
+	baseSession = Session();
+	baseSerial = ++stateSerial;
+	deltasSinceKeyframe = 0;
+	deltaBytesSinceKeyframe = 0;
+
+	DeltaHeader header = { DELTA_MAGIC, STATE_VERSION, DELTA_KEYFRAME, 0, baseSession, baseSerial, 0, 0,
+		(uint32_t)(deviceSize + 0x200000) };
+	memcpy(data, &header, sizeof(header));
+	memcpy(data + sizeof(header), baseDevices, deviceSize);
+	memcpy(data + sizeof(header) + deviceSize, baseRAM, 0x200000);
+
+	return DeltaStateMaxSize();
 }
 
+
+//
+// Save a delta state (or a keyframe, if it's time for one). Returns the number
+// of bytes written, or 0 on failure.
+//
+size_t SaveDeltaState(void * data, size_t size)
+{
+	DSPThreadWait();
+
+	if (data == NULL || !AllocateDeltaBuffers())
+		return 0;
+
+	uint8_t * out = (uint8_t *)data;
+	uint32_t dirtyPages = 0;
+
+	for(uint32_t i=0; i<STATE_NUM_PAGES; i++)
+		dirtyPages += mainRAMDirtyPage[i] & STATE_DIRTY_DELTA;
+
+	// A delta's parent has to be from the same session as the delta. And once
+	// replaying the deltas costs more than loading a keyframe would, it's time
+	// for a new one.
+	if (baseSerial == 0 || baseSession != Session() || (deltasSinceKeyframe >= DELTA_KEYFRAME_INTERVAL)
+		|| (deltaBytesSinceKeyframe >= DeltaStateMaxSize()) || (dirtyPages > DELTA_KEYFRAME_PAGES))
+		return SaveKeyframe(out, size);
+
+	StateBuffer sb = { STATE_SAVE, (uint8_t *)deltaDevices, DeviceWords() * 4, 0, false };
+	SyncDevices(&sb);
+
+	if (sb.error)
+		return 0;
+
+	const uint8_t * end = out + size;
+	uint8_t * p = out + sizeof(DeltaHeader);
+	p = EncodeXOR(deltaDevices, baseDevices, DeviceWords(), p, end);
+
+	// Then the RAM pages, each one preceded by its page number. The count
+	// goes in first, and is patched once we know what it is.
+	uint8_t * countPtr = p;
+	uint16_t pageCount = 0;
+
+	if (p && (p + 2 <= end))
+		p += 2;
+	else
+		p = NULL;
+
+	for(uint32_t i=0; (i<STATE_NUM_PAGES) && p; i++)
+	{
+		if (!(mainRAMDirtyPage[i] & STATE_DIRTY_DELTA))
+			continue;
+
+		if (p + 2 > end)
+		{
+			p = NULL;
+			break;
+		}
+
+		uint16_t page = (uint16_t)i;
+		memcpy(p, &page, 2);
+		uint8_t * next = EncodeXOR((uint32_t *)(jaguarMainRAM + (i << STATE_PAGE_SHIFT)),
+			(uint32_t *)(baseRAM + (i << STATE_PAGE_SHIFT)), (1 << STATE_PAGE_SHIFT) / 4, p + 2, end);
+
+		// Pages that were written to but ended up the same as before are left
+		// out (those encode to a single empty token)
+		if (next && (next - p) == 6)
+			continue;
+
+		p = next;
+		pageCount++;
+	}
+
+	// If it didn't fit, save a keyframe instead
+	if (p == NULL)
+		return SaveKeyframe(out, size);
+
+	memcpy(countPtr, &pageCount, 2);
+
+	// This state is what the next delta will be a delta of
+	for(uint32_t i=0; i<STATE_NUM_PAGES; i++)
+	{
+		if (mainRAMDirtyPage[i] & STATE_DIRTY_DELTA)
+		{
+			memcpy(baseRAM + (i << STATE_PAGE_SHIFT), jaguarMainRAM + (i << STATE_PAGE_SHIFT), 1 << STATE_PAGE_SHIFT);
+			mainRAMDirtyPage[i] &= ~STATE_DIRTY_DELTA;
+		}
+	}
+
+	uint32_t * swap = baseDevices;
+	baseDevices = deltaDevices;
+	deltaDevices = swap;
+	deltasSinceKeyframe++;
+	deltaBytesSinceKeyframe += p - out;
+
+	DeltaHeader header = { DELTA_MAGIC, STATE_VERSION, DELTA_DELTA, 0, baseSession, ++stateSerial, baseSerial,
+		deltasSinceKeyframe, (uint32_t)(p - out - sizeof(DeltaHeader)) };
+	memcpy(out, &header, sizeof(header));
+	baseSerial = header.serial;
+
+	return p - out;
+}
+
+
+bool LoadDeltaState(const void * data, size_t size)
+{
+	DSPThreadWait();
+
+	if (data == NULL || size < sizeof(DeltaHeader) || !AllocateDeltaBuffers())
+		return false;
+
+	DeltaHeader header;
+	memcpy(&header, data, sizeof(header));
+	const uint8_t * in = (const uint8_t *)data + sizeof(header);
+	const uint8_t * end = in + header.size;
+	size_t deviceSize = DeviceWords() * 4;
+
+	if (header.magic != DELTA_MAGIC || header.version != STATE_VERSION
+		|| size < sizeof(header) + header.size)
+		return false;
+
+	MarkRAMReloaded();
+
+	if (header.type == DELTA_KEYFRAME)
+	{
+		if (header.size != deviceSize + 0x200000)
+			return false;
+
+		memcpy(baseDevices, in, deviceSize);
+		memcpy(baseRAM, in + deviceSize, 0x200000);
+		memcpy(jaguarMainRAM, baseRAM, 0x200000);
+		ClearDirtyFlag(STATE_DIRTY_DELTA);
+		snapshotSerial = 0;
+		baseSession = header.session;
+		baseSerial = header.serial;
+		deltasSinceKeyframe = 0;
+		deltaBytesSinceKeyframe = 0;
+
+		StateBuffer sb = { STATE_LOAD, (uint8_t *)baseDevices, deviceSize, 0, false };
+		SyncDevices(&sb);
+
+		return !sb.error;
+	}
+
+	// A delta goes on top of its parent. If it's the state that was last saved
+	// or loaded, the machine just has to be put back the way it was then.
+	bool reload = (header.serial == baseSerial);
+
+	if (baseSerial == 0 || header.session != baseSession || (!reload && header.parent != baseSerial))
+	{
+		WriteLog("STATE: Delta state #%u's parent (#%u) isn't loaded!\n", header.serial, header.parent);
+		return false;
+	}
+
+	// Decode everything we can before touching the machine, in case it's corrupt
+	uint16_t pageCount = 0;
+
+	if (!reload)
+	{
+		memcpy(deltaDevices, baseDevices, deviceSize);
+		in = DecodeXOR(deltaDevices, DeviceWords(), in, end);
+
+		if (in == NULL || in + 2 > end)
+			return false;
+
+		memcpy(&pageCount, in, 2);
+		in += 2;
+	}
+
+	// Put back every page that's been touched since the parent...
+	snapshotSerial = 0;
+
+	for(uint32_t i=0; i<STATE_NUM_PAGES; i++)
+	{
+		if (mainRAMDirtyPage[i] & STATE_DIRTY_DELTA)
+		{
+			memcpy(jaguarMainRAM + (i << STATE_PAGE_SHIFT), baseRAM + (i << STATE_PAGE_SHIFT), 1 << STATE_PAGE_SHIFT);
+			mainRAMDirtyPage[i] &= ~STATE_DIRTY_DELTA;
+		}
+	}
+
+	// ...then apply the ones in the delta
+	for(uint32_t i=0; i<pageCount && in; i++)
+	{
+		uint16_t page;
+
+		if (in + 2 > end)
+			in = NULL;
+		else
+		{
+			memcpy(&page, in, 2);
+			in += 2;
+
+			if (page >= STATE_NUM_PAGES)
+				in = NULL;
+			else
+			{
+				uint32_t offset = page << STATE_PAGE_SHIFT;
+				in = DecodeXOR((uint32_t *)(baseRAM + offset), (1 << STATE_PAGE_SHIFT) / 4, in, end);
+				memcpy(jaguarMainRAM + offset, baseRAM + offset, 1 << STATE_PAGE_SHIFT);
+			}
+		}
+	}
+
+	if (in == NULL)
+	{
+		// RAM is now in an unknown state, & so is the base
+		WriteLog("STATE: Delta state is corrupt!\n");
+		StateResetDeltas();
+		return false;
+	}
+
+	if (!reload)
+	{
+		uint32_t * swap = baseDevices;
+		baseDevices = deltaDevices;
+		deltaDevices = swap;
+		baseSerial = header.serial;
+		deltasSinceKeyframe = header.depth;
+	}
+
+	StateBuffer sb = { STATE_LOAD, (uint8_t *)baseDevices, deviceSize, 0, false };
+	SyncDevices(&sb);
+
+	return !sb.error;
+}
+
+
+bool DeltaStateIsKeyframe(const void * data, size_t size)
+{
+	DeltaHeader header;
+
+	if (data == NULL || size < sizeof(header))
+		return false;
+
+	memcpy(&header, data, sizeof(header));
+
+	return (header.magic == DELTA_MAGIC && header.type == DELTA_KEYFRAME);
+}
+
+
+//
+// Forget the last delta state; the next one saved will be a keyframe. This is
+// for when RAM has been changed behind the dirty page tracking's back, so the
+// next full state can't be an incremental one either (& the DSP thread can't
+// trust its copy of RAM).
+//
+void StateResetDeltas(void)
+{
+	baseSerial = 0;
+	snapshotSerial = 0;
+	MarkRAMReloaded();
+}
+
+
+//
+// Let go of the delta state buffers (they come back the next time one's saved)
+//
+void StateDone(void)
+{
+	free(baseRAM), free(baseDevices), free(deltaDevices);
+	baseRAM = NULL, baseDevices = deltaDevices = NULL;
+	StateResetDeltas();
+}
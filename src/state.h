@@ -7,7 +7,90 @@
 #ifndef __STATE_H__
 #define __STATE_H__
 
-bool SaveState(void);
-bool LoadState(void);
+#include <stdint.h>
+#include <stddef.h>
+#include "context.h"
+
+// Bump this whenever the layout of the saved state changes!
+
+#define STATE_VERSION		7
+
+enum { STATE_MEASURE = 0, STATE_SAVE, STATE_LOAD };
+
+// A save state is built by having every subsystem "sync" its variables through
+// one of these. The same function is used to measure, save & load the state, so
+// the layout can never get out of step between saving and loading.
+
+struct StateBuffer
+{
+	int mode;									// STATE_MEASURE/SAVE/LOAD
+	uint8_t * data;
+	size_t size;
+	size_t position;
+	bool error;									// Set if we ran off the end
+};
+
+void StateSync(StateBuffer * sb, void * data, size_t size);
+const uint8_t * StatePeek(StateBuffer * sb, size_t size);
+
+#define STATE_SYNC(sb, var)		StateSync((sb), &(var), sizeof(var))
+
+size_t StateSize(void);
+bool SaveState(void * data, size_t size);
+bool LoadState(const void * data, size_t size);
+
+// Delta states: Writes to main RAM are tracked by 4K page. A delta state holds
+// only the pages written since the state saved before it, XORed against that
+// state & run-length encoded, along with the (similarly encoded) rest of the
+// machine. Every so often a full keyframe is written instead. A delta can be
+// loaded when the state it was saved after (its parent) or the delta itself
+// was the last one saved or loaded; to go back to an earlier one, load the
+// keyframe before it & then every delta after that, in order.
+
+#define STATE_PAGE_SHIFT		12
+#define STATE_NUM_PAGES			(0x200000 >> STATE_PAGE_SHIFT)
+
+// A write sets every bit of a page's dirty flags; the delta states, the full
+// states & the DSP thread's copy of RAM each clear their own bit when they
+// catch up with RAM.
+
+#define STATE_DIRTY_DELTA		0x01			// Written since the last delta state
+#define STATE_DIRTY_SNAPSHOT	0x02			// Written since the last full save/load
+#define STATE_DIRTY_DSP_THREAD	0x04			// Written since the DSP thread last copied it
+#define STATE_DIRTY_ALL			0xFF
+
+#define STATE_MARK_RAM_DIRTY(a)	(mainRAMDirtyPage[((a) & 0x1FFFFF) >> STATE_PAGE_SHIFT] = STATE_DIRTY_ALL)
+
+size_t DeltaStateMaxSize(void);
+size_t SaveDeltaState(void * data, size_t size);
+bool LoadDeltaState(const void * data, size_t size);
+bool DeltaStateIsKeyframe(const void * data, size_t size);
+void StateResetDeltas(void);
+void StateDone(void);
+
+// What STATE.CPP knows about the machine (see context.h)
+
+struct StateState
+{
+	uint8_t mainRAMDirtyPage[STATE_NUM_PAGES];	// STATE_DIRTY_* flags for each page
+
+	// The full state main RAM was last synced with (serial 0 is none)
+	uint32_t stateSession;
+	uint32_t stateSerial;
+	uint32_t snapshotSerial;
+	const void * snapshotBuffer;
+
+	// The delta state that was last saved or loaded, which the next one saved
+	// is a delta of (allocated on first use)
+	uint8_t * baseRAM;
+	uint32_t * baseDevices;
+	uint32_t * deltaDevices;
+	uint32_t baseSession;
+	uint32_t baseSerial;						// 0 is none
+	uint32_t deltasSinceKeyframe;
+	size_t deltaBytesSinceKeyframe;
+};
+
+#define mainRAMDirtyPage		(CONTEXT(state).mainRAMDirtyPage)
 
 #endif	// __STATE_H__
@@ -256,9 +256,9 @@
 #include "tom.h"
 
 #include <string.h>								// For memset()
-#include <stdlib.h>								// For rand()
 #include "blitter.h"
 #include "cry2rgb.h"
+#include "dspthread.h"
 #include "event.h"
 #include "gpu.h"
 #include "jaguar.h"
@@ -266,7 +266,10 @@
 #include "m68000/m68kinterface.h"
 //#include "vjag_memory.h"
 #include "op.h"
+#include "profile.h"
 #include "settings.h"
+#include "tomscan.h"
+#include "tomthread.h"
 
 #define NEW_TIMER_SYSTEM
 
@@ -349,36 +352,32 @@
 //(It's easier to do it here, though...)
 //#define TOM_DEBUG
 
-#ifdef __LIBRETRO__
-extern int doom_res_hack;
+#ifndef MULTI_INSTANCE
+struct TOMState tomState;
 #endif
 
-uint8_t tomRam8[0x4000];
-uint32_t tomWidth, tomHeight;
-uint32_t tomTimerPrescaler;
-uint32_t tomTimerDivider;
-int32_t tomTimerCounter;
-uint16_t tom_jerry_int_pending, tom_timer_int_pending, tom_object_int_pending,
-	tom_gpu_int_pending, tom_video_int_pending;
+#define tom_jerry_int_pending	(CONTEXT(tom).tom_jerry_int_pending)
+#define tom_timer_int_pending	(CONTEXT(tom).tom_timer_int_pending)
+#define tom_object_int_pending	(CONTEXT(tom).tom_object_int_pending)
+#define tom_gpu_int_pending		(CONTEXT(tom).tom_gpu_int_pending)
+#define tom_video_int_pending	(CONTEXT(tom).tom_video_int_pending)
 
-// These are set by the "user" of the Jaguar core lib, since these are
-// OS/system dependent.
-uint32_t * screenBuffer;
-uint32_t screenPitch;
+// screenBuffer & screenPitch are set by the "user" of the Jaguar core lib,
+// since these are OS/system dependent.
 
 static const char * videoMode_to_str[8] =
 	{ "16 BPP CRY", "24 BPP RGB", "16 BPP DIRECT", "16 BPP RGB",
 	  "Mixed mode", "24 BPP RGB", "16 BPP DIRECT", "16 BPP RGB" };
 
-typedef void (render_xxx_scanline_fn)(uint32_t *);
+typedef TOMLineRenderer render_xxx_scanline_fn;
 
 // Private function prototypes
 
-void tom_render_16bpp_cry_scanline(uint32_t * backbuffer);
-void tom_render_24bpp_scanline(uint32_t * backbuffer);
-void tom_render_16bpp_direct_scanline(uint32_t * backbuffer);
-void tom_render_16bpp_rgb_scanline(uint32_t * backbuffer);
-void tom_render_16bpp_cry_rgb_mix_scanline(uint32_t * backbuffer);
+void tom_render_16bpp_cry_scanline(uint32_t * backbuffer, const uint8_t * regs, const uint8_t * lineBuffer, uint32_t lineWidth);
+void tom_render_24bpp_scanline(uint32_t * backbuffer, const uint8_t * regs, const uint8_t * lineBuffer, uint32_t lineWidth);
+void tom_render_16bpp_direct_scanline(uint32_t * backbuffer, const uint8_t * regs, const uint8_t * lineBuffer, uint32_t lineWidth);
+void tom_render_16bpp_rgb_scanline(uint32_t * backbuffer, const uint8_t * regs, const uint8_t * lineBuffer, uint32_t lineWidth);
+void tom_render_16bpp_cry_rgb_mix_scanline(uint32_t * backbuffer, const uint8_t * regs, const uint8_t * lineBuffer, uint32_t lineWidth);
 
 //render_xxx_scanline_fn * scanline_render_normal[] =
 render_xxx_scanline_fn * scanline_render[] =
@@ -571,6 +570,12 @@ uint32_t MIX16ToRGB32[0x10000];
 #warning "This is not endian-safe. !!! FIX !!!"
 void TOMFillLookupTables(void)
 {
+	static bool tablesFilled = false;
+
+	// Only has to be done once (every machine uses the same ones; see context.h)
+	if (tablesFilled)
+		return;
+
 	// NOTE: Jaguar 16-bit (non-CRY) color is RBG 556 like so:
 	//       RRRR RBBB BBGG GGGG
 	for(uint32_t i=0; i<0x10000; i++)
@@ -597,6 +602,8 @@ void TOMFillLookupTables(void)
 		CRY16ToRGB32[i] = 0xFF000000 | (r << 16) | (g << 8) | (b << 0);
 		MIX16ToRGB32[i] = (i & 0x01 ? RGB16ToRGB32[i] : CRY16ToRGB32[i]);
 	}
+
+	tablesFilled = true;
 }
 
 
@@ -655,17 +662,17 @@ uint16_t TOMGetVDB(void)
 //
 // 16 BPP CRY/RGB mixed mode rendering
 //
-void tom_render_16bpp_cry_rgb_mix_scanline(uint32_t * backbuffer)
+void tom_render_16bpp_cry_rgb_mix_scanline(uint32_t * backbuffer, const uint8_t * regs, const uint8_t * lineBuffer, uint32_t lineWidth)
 {
 //CHANGED TO 32BPP RENDERING
-	uint16_t width = tomWidth;
-	uint8_t * current_line_buffer = (uint8_t *)&tomRam8[0x1800];
+	uint16_t width = lineWidth;
+	const uint8_t * current_line_buffer = lineBuffer;
 
 	//New stuff--restrict our drawing...
-	uint8_t pwidth = ((GET16(tomRam8, VMODE) & PWIDTH) >> 9) + 1;
+	uint8_t pwidth = ((GET16(regs, VMODE) & PWIDTH) >> 9) + 1;
 	//NOTE: May have to check HDB2 as well!
 	// Get start position in HC ticks
-	int16_t startPos = GET16(tomRam8, HDB1) - (vjs.hardwareTypeNTSC ? LEFT_VISIBLE_HC : LEFT_VISIBLE_HC_PAL);
+	int16_t startPos = GET16(regs, HDB1) - (vjs.hardwareTypeNTSC ? LEFT_VISIBLE_HC : LEFT_VISIBLE_HC_PAL);
 	// Convert to pixels
 	startPos /= pwidth;
 
@@ -681,7 +688,7 @@ void tom_render_16bpp_cry_rgb_mix_scanline(uint32_t * backbuffer)
 // and so is the backbuffer.
 #ifdef LEFT_BG_FIX
 	{
-		uint8_t g = tomRam8[BORD1], r = tomRam8[BORD1 + 1], b = tomRam8[BORD2 + 1];
+		uint8_t g = regs[BORD1], r = regs[BORD1 + 1], b = regs[BORD2 + 1];
 		uint32_t pixel = 0xFF000000 | (r << 16) | (g << 8) | (b << 0);
 
 		for(int16_t i=0; i<startPos; i++)
@@ -693,36 +700,30 @@ void tom_render_16bpp_cry_rgb_mix_scanline(uint32_t * backbuffer)
 		backbuffer += 2 * startPos, width -= startPos;
 #endif
 
-	while (width)
-	{
-		uint16_t color = (*current_line_buffer++) << 8;
-		color |= *current_line_buffer++;
-		*backbuffer++ = MIX16ToRGB32[color];
-		width--;
-	}
+	TOMScanTable16(backbuffer, current_line_buffer, width, MIX16ToRGB32);
 }
 
 
 //
 // 16 BPP CRY mode rendering
 //
-void tom_render_16bpp_cry_scanline(uint32_t * backbuffer)
+void tom_render_16bpp_cry_scanline(uint32_t * backbuffer, const uint8_t * regs, const uint8_t * lineBuffer, uint32_t lineWidth)
 {
 //CHANGED TO 32BPP RENDERING
-	uint16_t width = tomWidth;
-	uint8_t * current_line_buffer = (uint8_t *)&tomRam8[0x1800];
+	uint16_t width = lineWidth;
+	const uint8_t * current_line_buffer = lineBuffer;
 
 	//New stuff--restrict our drawing...
-	uint8_t pwidth = ((GET16(tomRam8, VMODE) & PWIDTH) >> 9) + 1;
+	uint8_t pwidth = ((GET16(regs, VMODE) & PWIDTH) >> 9) + 1;
 	//NOTE: May have to check HDB2 as well!
-	int16_t startPos = GET16(tomRam8, HDB1) - (vjs.hardwareTypeNTSC ? LEFT_VISIBLE_HC : LEFT_VISIBLE_HC_PAL);// Get start position in HC ticks
+	int16_t startPos = GET16(regs, HDB1) - (vjs.hardwareTypeNTSC ? LEFT_VISIBLE_HC : LEFT_VISIBLE_HC_PAL);// Get start position in HC ticks
 	startPos /= pwidth;
 	if (startPos < 0)
 		current_line_buffer += 2 * -startPos;
 	else
 #ifdef LEFT_BG_FIX
 	{
-		uint8_t g = tomRam8[BORD1], r = tomRam8[BORD1 + 1], b = tomRam8[BORD2 + 1];
+		uint8_t g = regs[BORD1], r = regs[BORD1 + 1], b = regs[BORD2 + 1];
 		uint32_t pixel = 0xFF000000 | (r << 16) | (g << 8) | (b << 0);
 
 		for(int16_t i=0; i<startPos; i++)
@@ -735,41 +736,39 @@ void tom_render_16bpp_cry_scanline(uint32_t * backbuffer)
 		backbuffer += 2 * startPos, width -= startPos;
 #endif
 
-	while (width)
-	{
-		uint16_t color = (*current_line_buffer++) << 8;
-		color |= *current_line_buffer++;
-		*backbuffer++ = CRY16ToRGB32[color];
 #ifdef __LIBRETRO__
 //Double pixel screen on doom if pwidth=8 -> (163*2)
-if(doom_res_hack==1)
-	if(pwidth==8)*backbuffer++ = CRY16ToRGB32[color];
-#endif
-		width--;
+	if (vjs.doomResHack && pwidth == 8)
+	{
+		TOMScanTable16Double(backbuffer, current_line_buffer, width, CRY16ToRGB32);
+		return;
 	}
+#endif
+
+	TOMScanTable16(backbuffer, current_line_buffer, width, CRY16ToRGB32);
 }
 
 
 //
 // 24 BPP mode rendering
 //
-void tom_render_24bpp_scanline(uint32_t * backbuffer)
+void tom_render_24bpp_scanline(uint32_t * backbuffer, const uint8_t * regs, const uint8_t * lineBuffer, uint32_t lineWidth)
 {
 //CHANGED TO 32BPP RENDERING
-	uint16_t width = tomWidth;
-	uint8_t * current_line_buffer = (uint8_t *)&tomRam8[0x1800];
+	uint16_t width = lineWidth;
+	const uint8_t * current_line_buffer = lineBuffer;
 
 	//New stuff--restrict our drawing...
-	uint8_t pwidth = ((GET16(tomRam8, VMODE) & PWIDTH) >> 9) + 1;
+	uint8_t pwidth = ((GET16(regs, VMODE) & PWIDTH) >> 9) + 1;
 	//NOTE: May have to check HDB2 as well!
-	int16_t startPos = GET16(tomRam8, HDB1) - (vjs.hardwareTypeNTSC ? LEFT_VISIBLE_HC : LEFT_VISIBLE_HC_PAL);	// Get start position in HC ticks
+	int16_t startPos = GET16(regs, HDB1) - (vjs.hardwareTypeNTSC ? LEFT_VISIBLE_HC : LEFT_VISIBLE_HC_PAL);	// Get start position in HC ticks
 	startPos /= pwidth;
 	if (startPos < 0)
 		current_line_buffer += 4 * -startPos;
 	else
 #ifdef LEFT_BG_FIX
 	{
-		uint8_t g = tomRam8[BORD1], r = tomRam8[BORD1 + 1], b = tomRam8[BORD2 + 1];
+		uint8_t g = regs[BORD1], r = regs[BORD1 + 1], b = regs[BORD2 + 1];
 		uint32_t pixel = 0xFF000000 | (r << 16) | (g << 8) | (b << 0);
 
 		for(int16_t i=0; i<startPos; i++)
@@ -782,16 +781,7 @@ void tom_render_24bpp_scanline(uint32_t * backbuffer)
 		backbuffer += 2 * startPos, width -= startPos;
 #endif
 
-	while (width)
-	{
-		uint32_t g = *current_line_buffer++;
-		uint32_t r = *current_line_buffer++;
-		current_line_buffer++;
-		uint32_t b = *current_line_buffer++;
-//hm.		*backbuffer++ = 0xFF000000 | (b << 16) | (g << 8) | r;
-		*backbuffer++ = 0xFF000000 | (r << 16) | (g << 8) | (b << 0);
-		width--;
-	}
+	TOMScanRGB24(backbuffer, current_line_buffer, width);
 }
 
 
@@ -800,36 +790,30 @@ void tom_render_24bpp_scanline(uint32_t * backbuffer)
 //
 // 16 BPP direct mode rendering
 //
-void tom_render_16bpp_direct_scanline(uint32_t * backbuffer)
+void tom_render_16bpp_direct_scanline(uint32_t * backbuffer, const uint8_t * regs, const uint8_t * lineBuffer, uint32_t lineWidth)
 {
-	uint16_t width = tomWidth;
-	uint8_t * current_line_buffer = (uint8_t *)&tomRam8[0x1800];
+	uint16_t width = lineWidth;
+	const uint8_t * current_line_buffer = lineBuffer;
 
-	while (width)
-	{
-		uint16_t color = (*current_line_buffer++) << 8;
-		color |= *current_line_buffer++;
-		*backbuffer++ = color >> 1;
-		width--;
-	}
+	TOMScanDirect16(backbuffer, current_line_buffer, width);
 }
 
 
 //
 // 16 BPP RGB mode rendering
 //
-void tom_render_16bpp_rgb_scanline(uint32_t * backbuffer)
+void tom_render_16bpp_rgb_scanline(uint32_t * backbuffer, const uint8_t * regs, const uint8_t * lineBuffer, uint32_t lineWidth)
 {
 //CHANGED TO 32BPP RENDERING
 	// 16 BPP RGB: 0-5 green, 6-10 blue, 11-15 red
 
-	uint16_t width = tomWidth;
-	uint8_t * current_line_buffer = (uint8_t *)&tomRam8[0x1800];
+	uint16_t width = lineWidth;
+	const uint8_t * current_line_buffer = lineBuffer;
 
 	//New stuff--restrict our drawing...
-	uint8_t pwidth = ((GET16(tomRam8, VMODE) & PWIDTH) >> 9) + 1;
+	uint8_t pwidth = ((GET16(regs, VMODE) & PWIDTH) >> 9) + 1;
 	//NOTE: May have to check HDB2 as well!
-	int16_t startPos = GET16(tomRam8, HDB1) - (vjs.hardwareTypeNTSC ? LEFT_VISIBLE_HC : LEFT_VISIBLE_HC_PAL);	// Get start position in HC ticks
+	int16_t startPos = GET16(regs, HDB1) - (vjs.hardwareTypeNTSC ? LEFT_VISIBLE_HC : LEFT_VISIBLE_HC_PAL);	// Get start position in HC ticks
 	startPos /= pwidth;
 
 	if (startPos < 0)
@@ -837,7 +821,7 @@ void tom_render_16bpp_rgb_scanline(uint32_t * backbuffer)
 	else
 #ifdef LEFT_BG_FIX
 	{
-		uint8_t g = tomRam8[BORD1], r = tomRam8[BORD1 + 1], b = tomRam8[BORD2 + 1];
+		uint8_t g = regs[BORD1], r = regs[BORD1 + 1], b = regs[BORD2 + 1];
 		uint32_t pixel = 0xFF000000 | (r << 16) | (g << 8) | (b << 0);
 
 		for(int16_t i=0; i<startPos; i++)
@@ -850,13 +834,34 @@ void tom_render_16bpp_rgb_scanline(uint32_t * backbuffer)
 		backbuffer += 2 * startPos, width -= startPos;
 #endif
 
-	while (width)
+	TOMScanRGB16(backbuffer, current_line_buffer, width);
+}
+
+
+//
+// How much of the line buffer the renderer for the given mode is going to
+// look at (so we know how much to copy when it's done on another thread)
+//
+static uint32_t TOMLineBufferBytes(uint8_t mode)
+{
+	uint32_t bytesPerPixel = ((mode & 0x03) == VIDEO_MODE_24BPP_RGB ? 4 : 2);
+	uint32_t pixels = tomWidth;
+
+	if ((mode & 0x03) != VIDEO_MODE_16BPP_DIRECT)
 	{
-		uint32_t color = (*current_line_buffer++) << 8;
-		color |= *current_line_buffer++;
-		*backbuffer++ = RGB16ToRGB32[color];
-		width--;
+		uint8_t pwidth = ((GET16(tomRam8, VMODE) & PWIDTH) >> 9) + 1;
+		int16_t startPos = GET16(tomRam8, HDB1) - (vjs.hardwareTypeNTSC ? LEFT_VISIBLE_HC : LEFT_VISIBLE_HC_PAL);
+		startPos /= pwidth;
+
+		if (startPos < 0)
+			pixels += -startPos;
+		else
+			pixels = (uint16_t)(pixels - startPos);
 	}
+
+	uint32_t bytes = pixels * bytesPerPixel;
+
+	return (bytes > 0x4000 - 0x1800 ? 0x4000 - 0x1800 : bytes);
 }
 
 
@@ -956,9 +961,15 @@ TOM: Vertical Interrupt written by M68K: 491
 			if (GET16(tomRam8, VMODE) & BGEN) // && (CRY or RGB16)...
 				for(uint32_t i=0; i<720; i++)
 					*current_line_buffer++ = bgHI, *current_line_buffer++ = bgLO;
-
-			OPProcessList(halfline, render);
 		}
+
+		// When the frame is being skipped, the OP still has to walk the list
+		// so that the object write-backs, GPU objects & interrupts happen just
+		// like they would otherwise; it just doesn't draw anything.
+		ProfileEnter(PROFILE_OP);
+		OPProcessList(halfline, render);
+		ProfileLeave();
+		ProfileWork(PROFILE_OP, 1);
 	}
 	else
 		inActiveDisplayArea = false;
@@ -994,15 +1005,26 @@ TOM: Vertical Interrupt written by M68K: 491
 
 	// Here's our virtualized scanline code...
 
-	if (halfline >= topVisible && halfline < bottomVisible)
+	if (render && halfline >= topVisible && halfline < bottomVisible)
 	{
+		ProfileEnter(PROFILE_RENDER);
+		ProfileWork(PROFILE_RENDER, 1);
+
 		if (inActiveDisplayArea)
 		{
 //NOTE: The following doesn't put BORDER color on the sides... !!! FIX !!!
 #warning "The following doesn't put BORDER color on the sides... !!! FIX !!!"
 			if (vjs.renderType == RT_NORMAL)
+			{
 //				scanline_render[TOMGetVideoMode()](TOMBackbuffer);
-				scanline_render[TOMGetVideoMode()](TOMCurrentLine);
+				uint8_t mode = TOMGetVideoMode();
+				const uint8_t * lineBuffer = &tomRam8[0x1800];
+
+				// Hand it off to the conversion threads if we can, otherwise do it now
+				if (!vjs.useRenderThread
+					|| !TOMThreadQueueLine(scanline_render[mode], TOMCurrentLine, tomWidth, tomRam8, lineBuffer, TOMLineBufferBytes(mode)))
+					scanline_render[mode](TOMCurrentLine, tomRam8, lineBuffer, tomWidth);
+			}
 			else//TV type render
 			{
 /*
@@ -1074,6 +1096,8 @@ void tom_render_24bpp_scanline(uint32_t * backbuffer)
 			for(uint32_t i=0; i<tomWidth; i++)
 				*currentLineBuffer++ = pixel;
 		}
+
+		ProfileLeave();
 	}
 }
 
@@ -1084,6 +1108,7 @@ void tom_render_24bpp_scanline(uint32_t * backbuffer)
 void TOMInit(void)
 {
 	TOMFillLookupTables();
+	TOMScanInit();
 	OPInit();
 	BlitterInit();
 	TOMReset();
@@ -1092,6 +1117,7 @@ void TOMInit(void)
 
 void TOMDone(void)
 {
+	TOMThreadDone();
 	OPDone();
 	BlitterDone();
 	WriteLog("TOM: Resolution %i x %i %s\n", TOMGetVideoModeWidth(), TOMGetVideoModeHeight(),
@@ -1106,6 +1132,25 @@ void TOMDone(void)
 }
 
 
+void TOMStateSync(StateBuffer * sb)
+{
+	STATE_SYNC(sb, tomRam8);
+	STATE_SYNC(sb, tomWidth);
+	STATE_SYNC(sb, tomHeight);
+	STATE_SYNC(sb, tomTimerPrescaler);
+	STATE_SYNC(sb, tomTimerDivider);
+	STATE_SYNC(sb, tomTimerCounter);
+	STATE_SYNC(sb, tom_jerry_int_pending);
+	STATE_SYNC(sb, tom_timer_int_pending);
+	STATE_SYNC(sb, tom_object_int_pending);
+	STATE_SYNC(sb, tom_gpu_int_pending);
+	STATE_SYNC(sb, tom_video_int_pending);
+
+	OPStateSync(sb);
+	BlitterStateSync(sb);
+}
+
+
 uint32_t TOMGetVideoModeWidth(void)
 {
 	//These widths are pretty bogus. Should use HDB1/2 & HDE/HBB & PWIDTH to calc the width...
@@ -1380,7 +1425,7 @@ if (offset >= 0xF02000 && offset <= 0xF020FF)
 // is check what the global time is at the time of the read and calculate the correct HC...
 // !!! FIX !!!
 	else if (offset == 0xF00004)
-		return rand() & 0x03FF;
+		return JaguarRandom() & 0x03FF;
 	else if ((offset >= GPU_CONTROL_RAM_BASE) && (offset < GPU_CONTROL_RAM_BASE + 0x20))
 		return GPUReadWord(offset, who);
 	else if ((offset >= GPU_WORK_RAM_BASE) && (offset < GPU_WORK_RAM_BASE + 0x1000))
@@ -1685,6 +1730,10 @@ if (offset == HEQ)
 
 int TOMIRQEnabled(int irq)
 {
+	// The DSP thread goes by the mask as it was when it was handed its frame
+	if (dspThreadBusy && DSPThreadIsWorker())
+		return DSPThreadTOMIRQMask() & (1 << irq);
+
 	// This is the correct byte in big endian... D'oh!
 //	return jaguar_byte_read(0xF000E1) & (1 << irq);
 	return tomRam8[INT1 + 1/*0xE1*/] & (1 << irq);
@@ -1715,8 +1764,10 @@ void TOMResetPIT(void)
 
 	if (tomTimerPrescaler)
 	{
-		double usecs = (float)(tomTimerPrescaler + 1) * (float)(tomTimerDivider + 1) * RISC_CYCLE_IN_USEC;
-		SetCallbackTime(TOMPITCallback, usecs);
+		// The PIT counts RISC cycles, so its period is the same # of cycles on
+		// PAL as it is on NTSC
+		uint64_t cycles = (uint64_t)(tomTimerPrescaler + 1) * (uint64_t)(tomTimerDivider + 1);
+		SetCallbackCycles(TOMPITCallback, cycles);
 	}
 #endif
 }
@@ -5,7 +5,9 @@
 #ifndef __TOM_H__
 #define __TOM_H__
 
+#include "context.h"
 #include "vjag_memory.h"
+#include "state.h"
 
 #define VIDEO_MODE_16BPP_CRY	0
 #define VIDEO_MODE_24BPP_RGB	1
@@ -26,8 +28,10 @@
 enum { IRQ_VIDEO = 0, IRQ_GPU, IRQ_OPFLAG, IRQ_TIMER, IRQ_DSP };
 
 void TOMInit(void);
+void TOMFillLookupTables(void);
 void TOMReset(void);
 void TOMDone(void);
+void TOMStateSync(StateBuffer * sb);
 
 uint8_t TOMReadByte(uint32_t offset, uint32_t who = UNKNOWN);
 uint16_t TOMReadWord(uint32_t offset, uint32_t who = UNKNOWN);
@@ -53,16 +57,31 @@ void TOMSetPendingGPUInt(void);
 void TOMSetPendingVideoInt(void);
 void TOMResetPIT(void);
 
+// What TOM.CPP knows about the machine (see context.h)
+
+struct TOMState
+{
+	uint8_t tomRam8[0x4000];
+	uint32_t tomWidth, tomHeight;
+	uint32_t tomTimerPrescaler;
+	uint32_t tomTimerDivider;
+	int32_t tomTimerCounter;
+	uint16_t tom_jerry_int_pending, tom_timer_int_pending, tom_object_int_pending,
+		tom_gpu_int_pending, tom_video_int_pending;
+	uint32_t * screenBuffer;
+	uint32_t screenPitch;
+};
+
 // Exported variables
 
-extern uint32_t tomWidth;
-extern uint32_t tomHeight;
-extern uint8_t tomRam8[];
-extern uint32_t tomTimerPrescaler;
-extern uint32_t tomTimerDivider;
-extern int32_t tomTimerCounter;
+#define tomWidth			(CONTEXT(tom).tomWidth)
+#define tomHeight			(CONTEXT(tom).tomHeight)
+#define tomRam8				(CONTEXT(tom).tomRam8)
+#define tomTimerPrescaler	(CONTEXT(tom).tomTimerPrescaler)
+#define tomTimerDivider		(CONTEXT(tom).tomTimerDivider)
+#define tomTimerCounter		(CONTEXT(tom).tomTimerCounter)
 
-extern uint32_t screenPitch;
-extern uint32_t * screenBuffer;
+#define screenPitch			(CONTEXT(tom).screenPitch)
+#define screenBuffer		(CONTEXT(tom).screenBuffer)
 
 #endif	// __TOM_H__
@@ -0,0 +1,466 @@
+//
+// tomscan.cpp: Line buffer to backbuffer conversion kernels
+//
+
+//
+// These do the per pixel part of the tom_render_*_scanline functions. There's
+// a plain C version of each, plus SSE2, AVX2 & NEON versions where the
+// compiler can give them to us. TOMScanInit() picks the fastest set that the
+// CPU we're running on can handle.
+//
+// CRY & mixed mode have no closed form, so they still go through the 64K
+// lookup tables (AVX2 can at least gather 8 of those at a time). RGB16, 24 BPP
+// & direct mode are done with plain arithmetic; the RGB16 kernels have to come
+// up with exactly what RGB16ToRGB32[] has in it, so if you change the formula
+// in TOMFillLookupTables(), change it here too.
+//
+
+#include "tomscan.h"
+
+#include "log.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SCAN_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(SCAN_HAVE_SSE2) && (defined(__x86_64__) || defined(__i386__)) \
+	&& (defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#define SCAN_HAVE_AVX2
+#include <immintrin.h>
+#define SCAN_AVX2_TARGET	__attribute__((target("avx2")))
+#endif
+
+// The NEON RGB24 kernel assumes a little endian host
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && !defined(MSB_FIRST)
+#define SCAN_HAVE_NEON
+#include <arm_neon.h>
+#endif
+
+extern uint32_t RGB16ToRGB32[];
+
+
+//
+// Plain C versions. These are exactly what the scanline renderers used to do.
+//
+static void ScanTable16Scalar(uint32_t * dst, const uint8_t * src, uint32_t pixels, const uint32_t * table)
+{
+	while (pixels--)
+	{
+		uint16_t color = (src[0] << 8) | src[1];
+		src += 2;
+		*dst++ = table[color];
+	}
+}
+
+
+static void ScanTable16DoubleScalar(uint32_t * dst, const uint8_t * src, uint32_t pixels, const uint32_t * table)
+{
+	while (pixels--)
+	{
+		uint16_t color = (src[0] << 8) | src[1];
+		src += 2;
+		*dst++ = table[color];
+		*dst++ = table[color];
+	}
+}
+
+
+static void ScanRGB16Scalar(uint32_t * dst, const uint8_t * src, uint32_t pixels)
+{
+	ScanTable16Scalar(dst, src, pixels, RGB16ToRGB32);
+}
+
+
+static void ScanRGB24Scalar(uint32_t * dst, const uint8_t * src, uint32_t pixels)
+{
+	while (pixels--)
+	{
+		uint32_t g = src[0], r = src[1], b = src[3];
+		src += 4;
+		*dst++ = 0xFF000000 | (r << 16) | (g << 8) | (b << 0);
+	}
+}
+
+
+static void ScanDirect16Scalar(uint32_t * dst, const uint8_t * src, uint32_t pixels)
+{
+	while (pixels--)
+	{
+		uint16_t color = (src[0] << 8) | src[1];
+		src += 2;
+		*dst++ = color >> 1;
+	}
+}
+
+
+#ifdef SCAN_HAVE_SSE2
+//
+// SSE2 versions. These do 8 pixels at a time (4 for 24 BPP) & let the scalar
+// versions mop up whatever's left.
+//
+static inline __m128i Swap16(__m128i v)
+{
+	return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+
+static inline __m128i RGB16ToRGB32SSE2(__m128i c)
+{
+	const __m128i red = _mm_set1_epi32(0xF100), green = _mm_set1_epi32(0x003F),
+		blue = _mm_set1_epi32(0x07C0), alpha = _mm_set1_epi32(0xFF000000);
+
+	return _mm_or_si128(_mm_or_si128(alpha, _mm_slli_epi32(_mm_and_si128(c, red), 8)),
+		_mm_or_si128(_mm_slli_epi32(_mm_and_si128(c, green), 10), _mm_srli_epi32(_mm_and_si128(c, blue), 3)));
+}
+
+
+static void ScanTable16SSE2(uint32_t * dst, const uint8_t * src, uint32_t pixels, const uint32_t * table)
+{
+	for(; pixels>=8; pixels-=8, src+=16, dst+=8)
+	{
+		__m128i c = Swap16(_mm_loadu_si128((const __m128i *)src));
+
+		_mm_storeu_si128((__m128i *)(dst + 0), _mm_set_epi32(table[_mm_extract_epi16(c, 3)],
+			table[_mm_extract_epi16(c, 2)], table[_mm_extract_epi16(c, 1)], table[_mm_extract_epi16(c, 0)]));
+		_mm_storeu_si128((__m128i *)(dst + 4), _mm_set_epi32(table[_mm_extract_epi16(c, 7)],
+			table[_mm_extract_epi16(c, 6)], table[_mm_extract_epi16(c, 5)], table[_mm_extract_epi16(c, 4)]));
+	}
+
+	ScanTable16Scalar(dst, src, pixels, table);
+}
+
+
+static void ScanTable16DoubleSSE2(uint32_t * dst, const uint8_t * src, uint32_t pixels, const uint32_t * table)
+{
+	for(; pixels>=8; pixels-=8, src+=16, dst+=16)
+	{
+		__m128i c = Swap16(_mm_loadu_si128((const __m128i *)src));
+		__m128i lo = _mm_set_epi32(table[_mm_extract_epi16(c, 3)], table[_mm_extract_epi16(c, 2)],
+			table[_mm_extract_epi16(c, 1)], table[_mm_extract_epi16(c, 0)]);
+		__m128i hi = _mm_set_epi32(table[_mm_extract_epi16(c, 7)], table[_mm_extract_epi16(c, 6)],
+			table[_mm_extract_epi16(c, 5)], table[_mm_extract_epi16(c, 4)]);
+
+		_mm_storeu_si128((__m128i *)(dst + 0), _mm_unpacklo_epi32(lo, lo));
+		_mm_storeu_si128((__m128i *)(dst + 4), _mm_unpackhi_epi32(lo, lo));
+		_mm_storeu_si128((__m128i *)(dst + 8), _mm_unpacklo_epi32(hi, hi));
+		_mm_storeu_si128((__m128i *)(dst + 12), _mm_unpackhi_epi32(hi, hi));
+	}
+
+	ScanTable16DoubleScalar(dst, src, pixels, table);
+}
+
+
+static void ScanRGB16SSE2(uint32_t * dst, const uint8_t * src, uint32_t pixels)
+{
+	const __m128i zero = _mm_setzero_si128();
+
+	for(; pixels>=8; pixels-=8, src+=16, dst+=8)
+	{
+		__m128i c = Swap16(_mm_loadu_si128((const __m128i *)src));
+		_mm_storeu_si128((__m128i *)(dst + 0), RGB16ToRGB32SSE2(_mm_unpacklo_epi16(c, zero)));
+		_mm_storeu_si128((__m128i *)(dst + 4), RGB16ToRGB32SSE2(_mm_unpackhi_epi16(c, zero)));
+	}
+
+	ScanRGB16Scalar(dst, src, pixels);
+}
+
+
+static void ScanRGB24SSE2(uint32_t * dst, const uint8_t * src, uint32_t pixels)
+{
+	// Each pixel comes in as G, R, x, B; as a little endian long, that makes
+	// RGB = ((pixel & $FFFF) << 8) | (pixel >> 24).
+	const __m128i low = _mm_set1_epi32(0xFFFF), alpha = _mm_set1_epi32(0xFF000000);
+
+	for(; pixels>=4; pixels-=4, src+=16, dst+=4)
+	{
+		__m128i p = _mm_loadu_si128((const __m128i *)src);
+		_mm_storeu_si128((__m128i *)dst, _mm_or_si128(alpha,
+			_mm_or_si128(_mm_slli_epi32(_mm_and_si128(p, low), 8), _mm_srli_epi32(p, 24))));
+	}
+
+	ScanRGB24Scalar(dst, src, pixels);
+}
+
+
+static void ScanDirect16SSE2(uint32_t * dst, const uint8_t * src, uint32_t pixels)
+{
+	const __m128i zero = _mm_setzero_si128();
+
+	for(; pixels>=8; pixels-=8, src+=16, dst+=8)
+	{
+		__m128i c = _mm_srli_epi16(Swap16(_mm_loadu_si128((const __m128i *)src)), 1);
+		_mm_storeu_si128((__m128i *)(dst + 0), _mm_unpacklo_epi16(c, zero));
+		_mm_storeu_si128((__m128i *)(dst + 4), _mm_unpackhi_epi16(c, zero));
+	}
+
+	ScanDirect16Scalar(dst, src, pixels);
+}
+#endif
+
+
+#ifdef SCAN_HAVE_AVX2
+//
+// AVX2 versions. The big win here is being able to gather 8 table entries at
+// once for CRY & mixed mode.
+//
+SCAN_AVX2_TARGET static inline __m256i Load16AVX2(const uint8_t * src)
+{
+	return _mm256_cvtepu16_epi32(Swap16(_mm_loadu_si128((const __m128i *)src)));
+}
+
+
+SCAN_AVX2_TARGET static void ScanTable16AVX2(uint32_t * dst, const uint8_t * src, uint32_t pixels, const uint32_t * table)
+{
+	for(; pixels>=8; pixels-=8, src+=16, dst+=8)
+		_mm256_storeu_si256((__m256i *)dst, _mm256_i32gather_epi32((const int *)table, Load16AVX2(src), 4));
+
+	ScanTable16Scalar(dst, src, pixels, table);
+}
+
+
+SCAN_AVX2_TARGET static void ScanTable16DoubleAVX2(uint32_t * dst, const uint8_t * src, uint32_t pixels, const uint32_t * table)
+{
+	const __m256i lower = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3),
+		upper = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+
+	for(; pixels>=8; pixels-=8, src+=16, dst+=16)
+	{
+		__m256i rgb = _mm256_i32gather_epi32((const int *)table, Load16AVX2(src), 4);
+		_mm256_storeu_si256((__m256i *)(dst + 0), _mm256_permutevar8x32_epi32(rgb, lower));
+		_mm256_storeu_si256((__m256i *)(dst + 8), _mm256_permutevar8x32_epi32(rgb, upper));
+	}
+
+	ScanTable16DoubleScalar(dst, src, pixels, table);
+}
+
+
+SCAN_AVX2_TARGET static void ScanRGB16AVX2(uint32_t * dst, const uint8_t * src, uint32_t pixels)
+{
+	const __m256i red = _mm256_set1_epi32(0xF100), green = _mm256_set1_epi32(0x003F),
+		blue = _mm256_set1_epi32(0x07C0), alpha = _mm256_set1_epi32(0xFF000000);
+
+	for(; pixels>=8; pixels-=8, src+=16, dst+=8)
+	{
+		__m256i c = Load16AVX2(src);
+		_mm256_storeu_si256((__m256i *)dst,
+			_mm256_or_si256(_mm256_or_si256(alpha, _mm256_slli_epi32(_mm256_and_si256(c, red), 8)),
+			_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(c, green), 10), _mm256_srli_epi32(_mm256_and_si256(c, blue), 3))));
+	}
+
+	ScanRGB16Scalar(dst, src, pixels);
+}
+
+
+SCAN_AVX2_TARGET static void ScanRGB24AVX2(uint32_t * dst, const uint8_t * src, uint32_t pixels)
+{
+	const __m256i low = _mm256_set1_epi32(0xFFFF), alpha = _mm256_set1_epi32(0xFF000000);
+
+	for(; pixels>=8; pixels-=8, src+=32, dst+=8)
+	{
+		__m256i p = _mm256_loadu_si256((const __m256i *)src);
+		_mm256_storeu_si256((__m256i *)dst, _mm256_or_si256(alpha,
+			_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(p, low), 8), _mm256_srli_epi32(p, 24))));
+	}
+
+	ScanRGB24Scalar(dst, src, pixels);
+}
+
+
+SCAN_AVX2_TARGET static void ScanDirect16AVX2(uint32_t * dst, const uint8_t * src, uint32_t pixels)
+{
+	for(; pixels>=8; pixels-=8, src+=16, dst+=8)
+		_mm256_storeu_si256((__m256i *)dst, _mm256_srli_epi32(Load16AVX2(src), 1));
+
+	ScanDirect16Scalar(dst, src, pixels);
+}
+#endif
+
+
+#ifdef SCAN_HAVE_NEON
+//
+// NEON versions
+//
+static inline uint16x8_t Load16NEON(const uint8_t * src)
+{
+	return vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(src)));
+}
+
+
+static inline uint32x4_t RGB16ToRGB32NEON(uint32x4_t c)
+{
+	return vorrq_u32(vorrq_u32(vdupq_n_u32(0xFF000000), vshlq_n_u32(vandq_u32(c, vdupq_n_u32(0xF100)), 8)),
+		vorrq_u32(vshlq_n_u32(vandq_u32(c, vdupq_n_u32(0x003F)), 10), vshrq_n_u32(vandq_u32(c, vdupq_n_u32(0x07C0)), 3)));
+}
+
+
+static void ScanTable16NEON(uint32_t * dst, const uint8_t * src, uint32_t pixels, const uint32_t * table)
+{
+	for(; pixels>=8; pixels-=8, src+=16, dst+=8)
+	{
+		uint16_t c[8];
+		vst1q_u16(c, Load16NEON(src));
+
+		for(int i=0; i<8; i++)
+			dst[i] = table[c[i]];
+	}
+
+	ScanTable16Scalar(dst, src, pixels, table);
+}
+
+
+static void ScanTable16DoubleNEON(uint32_t * dst, const uint8_t * src, uint32_t pixels, const uint32_t * table)
+{
+	for(; pixels>=8; pixels-=8, src+=16, dst+=16)
+	{
+		uint16_t c[8];
+		vst1q_u16(c, Load16NEON(src));
+
+		for(int i=0; i<8; i++)
+			dst[i * 2 + 0] = dst[i * 2 + 1] = table[c[i]];
+	}
+
+	ScanTable16DoubleScalar(dst, src, pixels, table);
+}
+
+
+static void ScanRGB16NEON(uint32_t * dst, const uint8_t * src, uint32_t pixels)
+{
+	for(; pixels>=8; pixels-=8, src+=16, dst+=8)
+	{
+		uint16x8_t c = Load16NEON(src);
+		vst1q_u32(dst + 0, RGB16ToRGB32NEON(vmovl_u16(vget_low_u16(c))));
+		vst1q_u32(dst + 4, RGB16ToRGB32NEON(vmovl_u16(vget_high_u16(c))));
+	}
+
+	ScanRGB16Scalar(dst, src, pixels);
+}
+
+
+static void ScanRGB24NEON(uint32_t * dst, const uint8_t * src, uint32_t pixels)
+{
+	for(; pixels>=4; pixels-=4, src+=16, dst+=4)
+	{
+		uint32x4_t p = vreinterpretq_u32_u8(vld1q_u8(src));
+		vst1q_u32(dst, vorrq_u32(vdupq_n_u32(0xFF000000),
+			vorrq_u32(vshlq_n_u32(vandq_u32(p, vdupq_n_u32(0xFFFF)), 8), vshrq_n_u32(p, 24))));
+	}
+
+	ScanRGB24Scalar(dst, src, pixels);
+}
+
+
+static void ScanDirect16NEON(uint32_t * dst, const uint8_t * src, uint32_t pixels)
+{
+	for(; pixels>=8; pixels-=8, src+=16, dst+=8)
+	{
+		uint16x8_t c = vshrq_n_u16(Load16NEON(src), 1);
+		vst1q_u32(dst + 0, vmovl_u16(vget_low_u16(c)));
+		vst1q_u32(dst + 4, vmovl_u16(vget_high_u16(c)));
+	}
+
+	ScanDirect16Scalar(dst, src, pixels);
+}
+#endif
+
+
+void (* TOMScanTable16)(uint32_t *, const uint8_t *, uint32_t, const uint32_t *) = ScanTable16Scalar;
+void (* TOMScanTable16Double)(uint32_t *, const uint8_t *, uint32_t, const uint32_t *) = ScanTable16DoubleScalar;
+void (* TOMScanRGB16)(uint32_t *, const uint8_t *, uint32_t) = ScanRGB16Scalar;
+void (* TOMScanRGB24)(uint32_t *, const uint8_t *, uint32_t) = ScanRGB24Scalar;
+void (* TOMScanDirect16)(uint32_t *, const uint8_t *, uint32_t) = ScanDirect16Scalar;
+
+static const char * scanName[SCAN_MAX] = { "scalar", "SSE2", "AVX2", "NEON" };
+
+
+//
+// Switch to the given kernel set. Returns false (and leaves things alone) if
+// the set isn't available on this build/CPU.
+//
+bool TOMScanSelect(int kernels)
+{
+	switch (kernels)
+	{
+	case SCAN_SCALAR:
+		TOMScanTable16 = ScanTable16Scalar;
+		TOMScanTable16Double = ScanTable16DoubleScalar;
+		TOMScanRGB16 = ScanRGB16Scalar;
+		TOMScanRGB24 = ScanRGB24Scalar;
+		TOMScanDirect16 = ScanDirect16Scalar;
+		return true;
+#ifdef SCAN_HAVE_SSE2
+	case SCAN_SSE2:
+		TOMScanTable16 = ScanTable16SSE2;
+		TOMScanTable16Double = ScanTable16DoubleSSE2;
+		TOMScanRGB16 = ScanRGB16SSE2;
+		TOMScanRGB24 = ScanRGB24SSE2;
+		TOMScanDirect16 = ScanDirect16SSE2;
+		return true;
+#endif
+#ifdef SCAN_HAVE_AVX2
+	case SCAN_AVX2:
+		if (!__builtin_cpu_supports("avx2"))
+			return false;
+
+		TOMScanTable16 = ScanTable16AVX2;
+		TOMScanTable16Double = ScanTable16DoubleAVX2;
+		TOMScanRGB16 = ScanRGB16AVX2;
+		TOMScanRGB24 = ScanRGB24AVX2;
+		TOMScanDirect16 = ScanDirect16AVX2;
+		return true;
+#endif
+#ifdef SCAN_HAVE_NEON
+	case SCAN_NEON:
+		TOMScanTable16 = ScanTable16NEON;
+		TOMScanTable16Double = ScanTable16DoubleNEON;
+		TOMScanRGB16 = ScanRGB16NEON;
+		TOMScanRGB24 = ScanRGB24NEON;
+		TOMScanDirect16 = ScanDirect16NEON;
+		return true;
+#endif
+	}
+
+	return false;
+}
+
+
+//
+// The fastest kernel set we can use here
+//
+int TOMScanBest(void)
+{
+#ifdef SCAN_HAVE_AVX2
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx2"))
+		return SCAN_AVX2;
+#endif
+#if defined(SCAN_HAVE_SSE2)
+	return SCAN_SSE2;
+#elif defined(SCAN_HAVE_NEON)
+	return SCAN_NEON;
+#else
+	return SCAN_SCALAR;
+#endif
+}
+
+
+const char * TOMScanName(int kernels)
+{
+	return (kernels >= 0 && kernels < SCAN_MAX ? scanName[kernels] : "unknown");
+}
+
+
+void TOMScanInit(void)
+{
+	static bool kernelsPicked = false;
+
+	// Only has to be done once
+	if (kernelsPicked)
+		return;
+
+	kernelsPicked = true;
+	int kernels = TOMScanBest();
+	TOMScanSelect(kernels);
+	WriteLog("TOM: Using %s scanline kernels.\n", TOMScanName(kernels));
+}
@@ -0,0 +1,29 @@
+//
+// tomscan.h: Line buffer to backbuffer conversion kernels
+//
+
+#ifndef __TOMSCAN_H__
+#define __TOMSCAN_H__
+
+#include <stdint.h>
+
+// Kernel sets, from slowest to fastest
+
+enum { SCAN_SCALAR = 0, SCAN_SSE2, SCAN_AVX2, SCAN_NEON, SCAN_MAX };
+
+// All of these take big endian line buffer pixels from src & write XRGB8888
+// pixels to dst. The 16 BPP table kernels are used for both CRY & mixed mode;
+// the "Double" variant writes each pixel twice (for the Doom res hack).
+
+extern void (* TOMScanTable16)(uint32_t * dst, const uint8_t * src, uint32_t pixels, const uint32_t * table);
+extern void (* TOMScanTable16Double)(uint32_t * dst, const uint8_t * src, uint32_t pixels, const uint32_t * table);
+extern void (* TOMScanRGB16)(uint32_t * dst, const uint8_t * src, uint32_t pixels);
+extern void (* TOMScanRGB24)(uint32_t * dst, const uint8_t * src, uint32_t pixels);
+extern void (* TOMScanDirect16)(uint32_t * dst, const uint8_t * src, uint32_t pixels);
+
+void TOMScanInit(void);
+bool TOMScanSelect(int kernels);
+int TOMScanBest(void);
+const char * TOMScanName(int kernels);
+
+#endif	// __TOMSCAN_H__
@@ -0,0 +1,244 @@
+//
+// tomthread.cpp: Converts TOM's line buffer output on a pool of worker threads
+//
+
+//
+// Once the OP has built a line, all that's left to do with it is to convert
+// it from CRY/RGB16/RGB24 into the backbuffer, and nothing in the emulation
+// ever looks at the result. So instead of doing that on the spot, we take a
+// copy of the line buffer (and the handful of registers the conversion looks
+// at) and let a pool of workers chew on it, while the emulation moves on to
+// the next line. The workers pick up lines in batches as they come in, and we
+// only wait for them to catch up once the frame is about to be handed off.
+//
+
+#include "tomthread.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "log.h"
+
+#ifdef HAVE_THREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#define MAX_QUEUED_LINES		1024
+#define LINE_ARENA_SIZE			0x100000		// Line buffer copies for one batch of lines
+#define LINES_PER_WAKEUP		8				// How many lines to queue before poking the workers
+#define LINES_PER_CLAIM			4				// How many lines a worker takes at a time
+#define MAX_WORKERS				TOM_THREAD_MAX_WORKERS
+
+#ifdef HAVE_THREADS
+struct QueuedLine
+{
+	TOMLineRenderer * render;
+	uint32_t * backbuffer;
+	uint32_t width;
+	const uint8_t * lineBuffer;
+	uint8_t regs[TOM_LINE_REG_BYTES];
+};
+
+#ifndef MULTI_INSTANCE
+struct TOMThreadState tomThreadState;
+#endif
+
+#define worker				(CONTEXT(tomThread).worker)
+#define numWorkers			(CONTEXT(tomThread).numWorkers)
+#define lock				(CONTEXT(tomThread).lock)
+#define wakeWorkers			(CONTEXT(tomThread).wakeWorkers)
+#define linesDone			(CONTEXT(tomThread).linesDone)
+#define poolStarted			(CONTEXT(tomThread).poolStarted)
+#define poolFailed			(CONTEXT(tomThread).poolFailed)
+#define quitWorkers			(CONTEXT(tomThread).quitWorkers)
+#define line				(CONTEXT(tomThread).line)
+#define lineArena			(CONTEXT(tomThread).lineArena)
+#define arenaPosition		(CONTEXT(tomThread).arenaPosition)
+#define numLines			(CONTEXT(tomThread).numLines)
+#define linesQueued			(CONTEXT(tomThread).linesQueued)
+#define linesClaimed		(CONTEXT(tomThread).linesClaimed)
+#define linesFinished		(CONTEXT(tomThread).linesFinished)
+
+
+static void * TOMThreadLoop(void * context)
+{
+	// The renderers look at the settings of the machine that started us
+	JaguarContextMakeCurrent((struct JaguarContext *)context);
+	pthread_mutex_lock(&lock);
+
+	while (!quitWorkers)
+	{
+		if (linesClaimed == linesQueued)
+		{
+			pthread_cond_wait(&wakeWorkers, &lock);
+			continue;
+		}
+
+		uint32_t first = linesClaimed;
+		uint32_t last = first + LINES_PER_CLAIM;
+
+		if (last > linesQueued)
+			last = linesQueued;
+
+		linesClaimed = last;
+		pthread_mutex_unlock(&lock);
+
+		for(uint32_t i=first; i<last; i++)
+			line[i].render(line[i].backbuffer, line[i].regs, line[i].lineBuffer, line[i].width);
+
+		pthread_mutex_lock(&lock);
+		linesFinished += last - first;
+
+		if (linesFinished == linesQueued)
+			pthread_cond_signal(&linesDone);
+	}
+
+	pthread_mutex_unlock(&lock);
+	return NULL;
+}
+
+
+static bool TOMThreadStart(void)
+{
+	if (poolStarted)
+		return true;
+
+	if (poolFailed)
+		return false;
+
+	line = (QueuedLine *)malloc(MAX_QUEUED_LINES * sizeof(QueuedLine));
+	lineArena = (uint8_t *)malloc(LINE_ARENA_SIZE);
+
+	// Leave a core for the emulation itself, but always have at least one worker
+	long cores = sysconf(_SC_NPROCESSORS_ONLN);
+	uint32_t wanted = (cores > 1 ? (uint32_t)cores - 1 : 1);
+
+	if (wanted > MAX_WORKERS)
+		wanted = MAX_WORKERS;
+
+	pthread_mutex_init(&lock, NULL);
+	pthread_cond_init(&wakeWorkers, NULL);
+	pthread_cond_init(&linesDone, NULL);
+
+	if (line && lineArena)
+	{
+		for(numWorkers=0; numWorkers<wanted; numWorkers++)
+			if (pthread_create(&worker[numWorkers], NULL, TOMThreadLoop, JaguarContextCurrent()) != 0)
+				break;
+	}
+
+	if (numWorkers > 0)
+	{
+		WriteLog("TOM: Started %u video conversion thread%s.\n", numWorkers, (numWorkers == 1 ? "" : "s"));
+		poolStarted = true;
+		return true;
+	}
+
+	WriteLog("TOM: Could not start video conversion threads! Converting in line instead.\n");
+	pthread_mutex_destroy(&lock);
+	pthread_cond_destroy(&wakeWorkers);
+	pthread_cond_destroy(&linesDone);
+	free(line);
+	free(lineArena);
+	line = NULL;
+	lineArena = NULL;
+	poolFailed = true;
+	return false;
+}
+#endif
+
+
+//
+// Queue up a line for conversion. Returns false if there's no one to hand it
+// to, in which case the caller has to convert it itself.
+//
+bool TOMThreadQueueLine(TOMLineRenderer * render, uint32_t * backbuffer, uint32_t width,
+	const uint8_t * regs, const uint8_t * lineBuffer, uint32_t lineBytes)
+{
+#ifdef HAVE_THREADS
+	if (lineBytes > LINE_ARENA_SIZE || !TOMThreadStart())
+		return false;
+
+	// If we've run out of room, let the workers drain what we have so far
+	if (numLines == MAX_QUEUED_LINES || arenaPosition + lineBytes > LINE_ARENA_SIZE)
+		TOMThreadWait();
+
+	QueuedLine & l = line[numLines];
+	l.render = render;
+	l.backbuffer = backbuffer;
+	l.width = width;
+	l.lineBuffer = lineArena + arenaPosition;
+	memcpy(l.regs, regs, TOM_LINE_REG_BYTES);
+	memcpy(lineArena + arenaPosition, lineBuffer, lineBytes);
+	arenaPosition += (lineBytes + 15) & ~15;
+	numLines++;
+
+	if ((numLines % LINES_PER_WAKEUP) == 0)
+	{
+		pthread_mutex_lock(&lock);
+		linesQueued = numLines;
+		pthread_cond_broadcast(&wakeWorkers);
+		pthread_mutex_unlock(&lock);
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+
+//
+// Wait for every queued line to make it into the backbuffer
+//
+void TOMThreadWait(void)
+{
+#ifdef HAVE_THREADS
+	if (numLines == 0)
+		return;
+
+	pthread_mutex_lock(&lock);
+	linesQueued = numLines;
+	pthread_cond_broadcast(&wakeWorkers);
+
+	while (linesFinished != linesQueued)
+		pthread_cond_wait(&linesDone, &lock);
+
+	linesQueued = linesClaimed = linesFinished = 0;
+	pthread_mutex_unlock(&lock);
+
+	numLines = 0;
+	arenaPosition = 0;
+#endif
+}
+
+
+void TOMThreadDone(void)
+{
+#ifdef HAVE_THREADS
+	TOMThreadWait();
+
+	if (!poolStarted)
+		return;
+
+	pthread_mutex_lock(&lock);
+	quitWorkers = true;
+	pthread_cond_broadcast(&wakeWorkers);
+	pthread_mutex_unlock(&lock);
+
+	for(uint32_t i=0; i<numWorkers; i++)
+		pthread_join(worker[i], NULL);
+
+	pthread_mutex_destroy(&lock);
+	pthread_cond_destroy(&wakeWorkers);
+	pthread_cond_destroy(&linesDone);
+
+	numWorkers = 0;
+	quitWorkers = false;
+	poolStarted = false;
+	free(line);
+	free(lineArena);
+	line = NULL;
+	lineArena = NULL;
+#endif
+}
@@ -0,0 +1,58 @@
+//
+// tomthread.h: Converts TOM's line buffer output on a pool of worker threads
+//
+
+#ifndef __TOMTHREAD_H__
+#define __TOMTHREAD_H__
+
+#include <stdint.h>
+#include "context.h"
+
+#ifdef HAVE_THREADS
+#include <pthread.h>
+#endif
+
+// How much of TOM's register space a queued line keeps a copy of. The line
+// renderers only look at VMODE, the borders & HDB1, which all live below this.
+
+#define TOM_LINE_REG_BYTES		0x80
+
+// Converts one line of TOM's line buffer into the backbuffer. The renderer gets
+// its registers & line buffer passed in, so it can run on a copy of either.
+
+typedef void (TOMLineRenderer)(uint32_t * backbuffer, const uint8_t * regs, const uint8_t * lineBuffer, uint32_t width);
+
+bool TOMThreadQueueLine(TOMLineRenderer * render, uint32_t * backbuffer, uint32_t width,
+	const uint8_t * regs, const uint8_t * lineBuffer, uint32_t lineBytes);
+void TOMThreadWait(void);
+void TOMThreadDone(void);
+
+// What TOMTHREAD.CPP knows about the machine (see context.h)
+
+#define TOM_THREAD_MAX_WORKERS	4
+
+struct TOMThreadState
+{
+#ifdef HAVE_THREADS
+	pthread_t worker[TOM_THREAD_MAX_WORKERS];
+	uint32_t numWorkers;
+	pthread_mutex_t lock;
+	pthread_cond_t wakeWorkers;
+	pthread_cond_t linesDone;
+	bool poolStarted;
+	bool poolFailed;
+	bool quitWorkers;
+
+	struct QueuedLine * line;
+	uint8_t * lineArena;
+	uint32_t arenaPosition;						// Only the main thread touches these two
+	uint32_t numLines;
+	uint32_t linesQueued;						// These are protected by the lock
+	uint32_t linesClaimed;
+	uint32_t linesFinished;
+#else
+	bool unused;
+#endif
+};
+
+#endif	// __TOMTHREAD_H__
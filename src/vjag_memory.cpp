@@ -27,13 +27,9 @@ goes... Still completely doable though. :-)
 
 #include "vjag_memory.h"
 
-uint8_t jagMemSpace[0xF20000];					// The entire memory space of the Jaguar...!
-
-uint8_t * jaguarMainRAM = &jagMemSpace[0x000000];
-uint8_t * jaguarMainROM = &jagMemSpace[0x800000];
-uint8_t * cdRAM         = &jagMemSpace[0xDFFF00];
-uint8_t * gpuRAM        = &jagMemSpace[0xF03000];
-uint8_t * dspRAM        = &jagMemSpace[0xF1B000];
+#ifndef MULTI_INSTANCE
+struct MemoryState memoryState;
+#endif
 
 #if 0
 union Word
@@ -113,6 +109,7 @@ unsigned long ByteSwap1 (unsigned long nLongNumber)
 
 //Not sure if this is a good approach yet...
 //should be if we use proper aliasing, and htonl and friends...
+#ifndef MULTI_INSTANCE
 #if 1
 uint32_t & butch     = *((uint32_t *)&jagMemSpace[0xDFFF00]);	// base of Butch == interrupt control register, R/W
 uint32_t & dscntrl   = *((uint32_t *)&jagMemSpace[0xDFFF04]);	// DSA control register, R/W
@@ -128,6 +125,7 @@ uint32_t & unknown   = *((uint32_t *)&jagMemSpace[0xDFFF2C]);	// Seems to be som
 #else
 uint32_t butch, dscntrl, ds_data, i2cntrl, sbcntrl, subdata, subdatb, sb_time, fifo_data, i2sdat2, unknown;
 #endif
+#endif
 
 #warning "Need to separate out this stuff (or do we???)"
 //if we use a contiguous memory space, we don't need this shit...
@@ -149,6 +147,7 @@ uint32_t butch, dscntrl, ds_data, i2cntrl, sbcntrl, subdata, subdatb, sb_time, f
 
 // Look at <endian.h> and see if that header is portable or not.
 
+#ifndef MULTI_INSTANCE
 uint16_t & memcon1   = *((uint16_t *)&jagMemSpace[0xF00000]);
 uint16_t & memcon2   = *((uint16_t *)&jagMemSpace[0xF00002]);
 uint16_t & hc        = *((uint16_t *)&jagMemSpace[0xF00004]);
@@ -252,13 +251,7 @@ uint32_t & d_mod     = *((uint32_t *)&jagMemSpace[0xF1A118]);
 uint32_t & d_divctrl = *((uint32_t *)&jagMemSpace[0xF1A11C]);
 uint32_t d_remain;								// Dual register with $F0211C
 uint32_t & d_machi   = *((uint32_t *)&jagMemSpace[0xF1A120]);
-uint16_t & ltxd      = *((uint16_t *)&jagMemSpace[0xF1A148]);
-uint16_t lrxd;									// Dual register with $F1A148
-uint16_t & rtxd      = *((uint16_t *)&jagMemSpace[0xF1A14C]);
-uint16_t rrxd;									// Dual register with $F1A14C
-uint8_t  & sclk      = *((uint8_t *) &jagMemSpace[0xF1A150]);
-uint8_t sstat;									// Dual register with $F1A150
-uint32_t & smode     = *((uint32_t *)&jagMemSpace[0xF1A154]);
+#endif
 
 // Memory debugging identifiers
 
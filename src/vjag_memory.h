@@ -8,14 +8,37 @@
 #define __MEMORY_H__
 
 #include <stdint.h>
+#include "context.h"
 
-extern uint8_t jagMemSpace[];
+struct MemoryState
+{
+	uint8_t jagMemSpace[0xF20000];				// The entire memory space of the Jaguar...!
+	uint16_t lrxd, rrxd;						// Dual registers with $F1A148 & $F1A14C
+	uint8_t sstat;								// Dual register with $F1A150
+};
+
+#define jagMemSpace		(CONTEXT(memory).jagMemSpace)
+
+#define jaguarMainRAM	(&jagMemSpace[0x000000])
+#define jaguarMainROM	(&jagMemSpace[0x800000])
+#define cdRAM			(&jagMemSpace[0xDFFF00])
+#define gpuRAM			(&jagMemSpace[0xF03000])
+#define dspRAM			(&jagMemSpace[0xF1B000])
 
-extern uint8_t * jaguarMainRAM;
-extern uint8_t * jaguarMainROM;
-extern uint8_t * gpuRAM;
-extern uint8_t * dspRAM;
+// JERRY's I2S registers
 
+#define ltxd			(*((uint16_t *)&jagMemSpace[0xF1A148]))
+#define lrxd			(CONTEXT(memory).lrxd)
+#define rtxd			(*((uint16_t *)&jagMemSpace[0xF1A14C]))
+#define rrxd			(CONTEXT(memory).rrxd)
+#define sclk			(*((uint8_t *) &jagMemSpace[0xF1A150]))
+#define sstat			(CONTEXT(memory).sstat)
+#define smode			(*((uint32_t *)&jagMemSpace[0xF1A154]))
+
+// The rest of the registers, by name, for the MMU (see mmu.cpp). These are
+// bound to the one & only jagMemSpace, so multi-instance builds go without.
+
+#ifndef MULTI_INSTANCE
 #if 1
 extern uint32_t & butch, & dscntrl;
 extern uint16_t & ds_data;
@@ -50,9 +73,7 @@ extern uint32_t & d_flags, & d_mtxc, & d_mtxa, & d_end, & d_pc, & d_ctrl,
 	& d_mod, & d_divctrl;
 extern uint32_t d_remain;
 extern uint32_t & d_machi;
-extern uint16_t & ltxd, lrxd, & rtxd, rrxd;
-extern uint8_t & sclk, sstat;
-extern uint32_t & smode;
+#endif
 /*
 uint16_t & ltxd      = *((uint16_t *)&jagMemSpace[0xF1A148]);
 uint16_t lrxd;									// Dual register with $F1A148
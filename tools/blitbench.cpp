@@ -0,0 +1,168 @@
+//
+// blitbench.cpp: Benchmark for the fast blitter's specialized paths
+//
+// Runs a handful of typical blits (fills, copies, transparent copies, Gouraud
+// shading & Z buffering) thru the fast blitter, both with & without its
+// specialized paths, checks that they leave RAM & the blitter's pointers in
+// the same state, and reports how many megapixels/sec each one manages.
+//
+// Usage: blitbench [seconds per test]
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "blitter.h"
+#include "settings.h"
+#include "vjag_memory.h"
+
+#define BLITTER_BASE		0xF02200
+#define SCREEN_WIDTH		320
+#define SCREEN_LINES		200
+
+// 320 pixels wide (mantissa 1, exponent 8), pixel by pixel (XADDPIX) or
+// phrase by phrase (XADDPHR)
+#define FLAGS_WIDTH_320		0x00004200
+#define FLAGS_XADDPIX		0x00010000
+#define FLAGS_XADDPHR		0x00000000
+
+struct BlitTest
+{
+	const char * name;
+	uint32_t cmd;
+	uint32_t depth;									// 3 = 8 BPP, 4 = 16 BPP, 5 = 32 BPP
+	uint32_t xadd;
+};
+
+static const BlitTest test[] = {
+	{ "Fill (8 BPP)",               0x00010200, 3, FLAGS_XADDPHR },
+	{ "Fill (16 BPP)",              0x00010200, 4, FLAGS_XADDPHR },
+	{ "Fill (32 BPP)",              0x00010200, 5, FLAGS_XADDPHR },
+	{ "Copy (16 BPP)",              0x01800601, 4, FLAGS_XADDPIX },
+	{ "Copy to A2 (16 BPP)",        0x01800E01, 4, FLAGS_XADDPIX },
+	{ "Transparent copy (16 BPP)",  0x09800609, 4, FLAGS_XADDPIX },
+	{ "Gouraud (16 BPP)",           0x00011200, 4, FLAGS_XADDPIX },
+	{ "Z buffered (16 BPP)",        0x00113078, 4, FLAGS_XADDPIX },
+	{ "Fill (unlisted cmd)",        0x00010600, 4, FLAGS_XADDPHR },
+};
+
+#define NUM_TESTS		(sizeof(test) / sizeof(test[0]))
+
+static uint8_t * startRAM;
+static uint8_t * referenceRAM;
+
+
+static void SetRegister(uint32_t reg, uint32_t data)
+{
+	BlitterWriteLong(BLITTER_BASE + reg, data);
+}
+
+
+//
+// Sets up a blit of a whole 320x200 screen (or a single line of it, if the
+// command doesn't step A1 to the next line), & kicks it off
+//
+static uint32_t RunBlit(const BlitTest & t)
+{
+	uint32_t lines = (t.cmd & 0x00000200 ? SCREEN_LINES : 1);
+	uint32_t flags = FLAGS_WIDTH_320 | t.xadd | (t.depth << 3);
+
+	SetRegister(0x00, 0x100000);					// A1_BASE
+	SetRegister(0x04, flags);						// A1_FLAGS
+	SetRegister(0x08, (SCREEN_LINES << 16) | SCREEN_WIDTH);	// A1_CLIP
+	SetRegister(0x0C, 0);							// A1_PIXEL
+	SetRegister(0x10, (1 << 16) | (-SCREEN_WIDTH & 0xFFFF));	// A1_STEP
+	SetRegister(0x14, 0);							// A1_FSTEP
+	SetRegister(0x18, 0);							// A1_FPIXEL
+	SetRegister(0x24, 0x020000);					// A2_BASE
+	SetRegister(0x28, flags);						// A2_FLAGS
+	SetRegister(0x2C, 0);							// A2_MASK
+	SetRegister(0x30, 0);							// A2_PIXEL
+	SetRegister(0x34, (1 << 16) | (-SCREEN_WIDTH & 0xFFFF));	// A2_STEP
+	SetRegister(0x40, 0x11223344), SetRegister(0x44, 0x55667788);	// SRCDATA
+	SetRegister(0x48, 0x99AABBCC), SetRegister(0x4C, 0xDDEEFF00);	// DSTDATA
+	SetRegister(0x50, 0x40004000), SetRegister(0x54, 0x40004000);	// DSTZ
+	SetRegister(0x58, 0x00010002), SetRegister(0x5C, 0x00030004);	// SRCZINT
+	SetRegister(0x60, 0x00000000), SetRegister(0x64, 0x00000000);	// SRCZFRAC
+	SetRegister(0x68, 0x12345678), SetRegister(0x6C, 0x9ABCDEF0);	// PATTERNDATA
+	SetRegister(0x70, 0x00000100);					// INTENSITYINC
+	SetRegister(0x74, 0x00000040);					// ZINC
+	SetRegister(0x3C, (lines << 16) | SCREEN_WIDTH);	// PIXLINECOUNTER
+	SetRegister(0x38, t.cmd);						// COMMAND (starts the blit)
+
+	return lines * SCREEN_WIDTH;
+}
+
+
+int main(int argc, char * argv[])
+{
+	double seconds = (argc > 1 ? atof(argv[1]) : 0.5);
+	startRAM = (uint8_t *)malloc(0x200000);
+	referenceRAM = (uint8_t *)malloc(0x200000);
+
+	if (!startRAM || !referenceRAM)
+	{
+		printf("Out of memory!\n");
+		return 1;
+	}
+
+	vjs.useFastBlitter = true;
+	BlitterInit();
+
+	// Something other than zeroes, so that transparency & Z compares do something
+	srand(1);
+
+	for(uint32_t i=0; i<0x200000; i++)
+		startRAM[i] = (rand() & 0x100 ? rand() : 0);
+
+	printf("%-26s %-9s %12s %10s\n", "Blit", "Cmd", "Mpixels/s", "Speedup");
+	int failures = 0;
+
+	for(uint32_t i=0; i<NUM_TESTS; i++)
+	{
+		// The generic loop is the reference
+		BlitterUseSpecializedPaths(false);
+		memcpy(jaguarMainRAM, startRAM, 0x200000);
+		RunBlit(test[i]);
+		memcpy(referenceRAM, jaguarMainRAM, 0x200000);
+		uint32_t a1 = BlitterReadLong(BLITTER_BASE + 0x0C), a2 = BlitterReadLong(BLITTER_BASE + 0x30);
+
+		BlitterUseSpecializedPaths(true);
+		memcpy(jaguarMainRAM, startRAM, 0x200000);
+		RunBlit(test[i]);
+		bool ok = (memcmp(referenceRAM, jaguarMainRAM, 0x200000) == 0)
+			&& a1 == BlitterReadLong(BLITTER_BASE + 0x0C) && a2 == BlitterReadLong(BLITTER_BASE + 0x30);
+
+		double genericRate = 0;
+
+		for(int specialized=0; specialized<2; specialized++)
+		{
+			BlitterUseSpecializedPaths(specialized);
+			uint64_t pixels = 0;
+			clock_t start = clock(), end;
+
+			do
+			{
+				for(int j=0; j<8; j++)
+					pixels += RunBlit(test[i]);
+
+				end = clock();
+			}
+			while ((double)(end - start) / CLOCKS_PER_SEC < seconds);
+
+			double rate = (double)pixels / ((double)(end - start) / CLOCKS_PER_SEC) / 1000000.0;
+
+			if (!specialized)
+				genericRate = rate;
+
+			printf("%-26s %08X  %12.1f %9.2fx %s%s\n", test[i].name, test[i].cmd, rate, rate / genericRate,
+				(specialized ? "specialized" : "generic"), (specialized && !ok ? "  MISMATCH!" : ""));
+		}
+
+		failures += (ok ? 0 : 1);
+	}
+
+	BlitterUseSpecializedPaths(true);
+	return (failures ? 1 : 0);
+}
@@ -0,0 +1,111 @@
+//
+// eventbench.cpp: Benchmark for the event timelines
+//
+// Fills the main & JERRY timelines with events that put themselves right back
+// in when they fire, the way the halfline, PIT & I2S callbacks do, then hands
+// them out with HandleNextEvent() as fast as it'll go. One of the tests also
+// has an event that reprograms another one (RemoveCallback() followed by
+// SetCallbackCycles()) every time it fires, which is what a game banging on a
+// PIT does. Reports how many million events/sec each test manages.
+//
+// Usage: eventbench [seconds per test]
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "event.h"
+#include "settings.h"
+
+#define MAX_EVENTS		16
+
+struct EventTest
+{
+	const char * name;
+	int type;
+	uint32_t events;								// # of events kept in the timeline
+	bool reprogram;									// Event 0 reprograms event 1
+};
+
+static const EventTest test[] = {
+	{ "Main, 3 events",           EVENT_MAIN,  3,  false },
+	{ "Main, 8 events",           EVENT_MAIN,  8,  false },
+	{ "Main, 16 events",          EVENT_MAIN,  16, false },
+	{ "JERRY, 3 events",          EVENT_JERRY, 3,  false },
+	{ "Main, 8 w/reprogramming",  EVENT_MAIN,  8,  true },
+};
+
+#define NUM_TESTS		(sizeof(test) / sizeof(test[0]))
+
+static const EventTest * current;
+static uint64_t handled;
+
+// Keeps the compiler from throwing the peeks away
+static volatile uint64_t elapsed;
+
+// Periods (in RISC cycles) that don't line up with each other, roughly the
+// size of the ones the real thing uses (a halfline is ~845 cycles)
+static const uint32_t period[MAX_EVENTS] = {
+	845, 554, 1690, 2000, 977, 3313, 1201, 4096,
+	751, 1499, 2503, 619, 887, 3001, 1777, 5003
+};
+
+template <int N> static void Tick(void);
+
+static void (* const tick[MAX_EVENTS])(void) = {
+	Tick<0>, Tick<1>, Tick<2>, Tick<3>, Tick<4>, Tick<5>, Tick<6>, Tick<7>,
+	Tick<8>, Tick<9>, Tick<10>, Tick<11>, Tick<12>, Tick<13>, Tick<14>, Tick<15>
+};
+
+
+template <int N> static void Tick(void)
+{
+	handled++;
+
+	if (N == 0 && current->reprogram)
+	{
+		RemoveCallback(tick[1]);
+		SetCallbackCycles(tick[1], period[1] + (handled & 0xFF), current->type);
+	}
+
+	SetCallbackCycles(tick[N], period[N], current->type);
+}
+
+
+int main(int argc, char * argv[])
+{
+	double seconds = (argc > 1 ? atof(argv[1]) : 0.5);
+	vjs.hardwareTypeNTSC = true;
+
+	printf("%-26s %12s\n", "Timeline", "Mevents/s");
+
+	for(uint32_t i=0; i<NUM_TESTS; i++)
+	{
+		current = &test[i];
+		InitializeEventList();
+
+		for(uint32_t j=0; j<test[i].events; j++)
+			SetCallbackCycles(tick[j], period[j], test[i].type);
+
+		handled = 0;
+		clock_t start = clock(), end;
+
+		do
+		{
+			// Peek at the next event first, like JaguarExecuteNew() does
+			for(int j=0; j<4096; j++)
+			{
+				elapsed += GetCyclesToNextEvent(test[i].type);
+				HandleNextEvent(test[i].type);
+			}
+
+			end = clock();
+		}
+		while ((double)(end - start) / CLOCKS_PER_SEC < seconds);
+
+		double rate = (double)handled / ((double)(end - start) / CLOCKS_PER_SEC) / 1000000.0;
+		printf("%-26s %12.1f\n", test[i].name, rate);
+	}
+
+	return 0;
+}
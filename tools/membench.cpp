@@ -0,0 +1,120 @@
+//
+// membench.cpp: Benchmark for the 68K's memory handlers
+//
+// Calls the m68k_read/write_memory_* handlers the 68K core uses over & over,
+// walking thru a 64K stretch of each part of the memory map, & reports how
+// many million accesses/sec each size & region manages. RAM, ROM & the BIOS
+// go thru the page tables (reads) or the RAM check (writes); TOM's registers
+// go thru the regular handlers, which is what everything else costs.
+//
+// Usage: membench [seconds per test]
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "jaguar.h"
+#include "settings.h"
+#include "m68000/m68kinterface.h"
+
+struct MemTest
+{
+	const char * name;
+	uint32_t base;
+	uint32_t size;									// 1, 2 or 4 bytes
+	bool write;
+};
+
+// TOM's line buffer is plain memory behind the TOM handlers, so writing it
+// over & over doesn't set anything off
+static const MemTest test[] = {
+	{ "RAM read8",     0x100000, 1, false },
+	{ "RAM read16",    0x100000, 2, false },
+	{ "RAM read32",    0x100000, 4, false },
+	{ "RAM write8",    0x100000, 1, true },
+	{ "RAM write16",   0x100000, 2, true },
+	{ "RAM write32",   0x100000, 4, true },
+	{ "ROM read16",    0x800000, 2, false },
+	{ "ROM read32",    0x800000, 4, false },
+	{ "BIOS read16",   0xE00000, 2, false },
+	{ "TOM read16",    0xF00800, 2, false },
+	{ "TOM write16",   0xF00800, 2, true },
+};
+
+#define NUM_TESTS		(sizeof(test) / sizeof(test[0]))
+
+// Keeps the compiler from throwing the reads away
+static volatile uint32_t sink;
+
+
+//
+// One pass of 4096 accesses (wrapping inside of 64K, or TOM's line buffer)
+//
+static void RunPass(const MemTest & t, uint32_t pass)
+{
+	uint32_t mask = (t.base >= 0xF00000 ? 0x7FF : 0xFFFF) & ~(t.size - 1);
+	uint32_t sum = 0;
+
+	for(uint32_t i=0; i<4096; i++)
+	{
+		uint32_t address = t.base + (((i + pass) * t.size * 7) & mask);
+
+		if (t.write)
+		{
+			if (t.size == 1)
+				m68k_write_memory_8(address, i);
+			else if (t.size == 2)
+				m68k_write_memory_16(address, i);
+			else
+				m68k_write_memory_32(address, i);
+		}
+		else
+		{
+			if (t.size == 1)
+				sum += m68k_read_memory_8(address);
+			else if (t.size == 2)
+				sum += m68k_read_memory_16(address);
+			else
+				sum += m68k_read_memory_32(address);
+		}
+	}
+
+	sink += sum;
+}
+
+
+int main(int argc, char * argv[])
+{
+	double seconds = (argc > 1 ? atof(argv[1]) : 0.5);
+
+	memset(&vjs, 0, sizeof(vjs));
+	vjs.hardwareTypeNTSC = true;
+	JaguarInit();
+	JaguarReset();
+
+	printf("%-14s %12s\n", "Access", "Mops/s");
+
+	for(uint32_t i=0; i<NUM_TESTS; i++)
+	{
+		uint64_t accesses = 0;
+		uint32_t pass = 0;
+		clock_t start = clock(), end;
+
+		do
+		{
+			for(int j=0; j<16; j++, pass++)
+				RunPass(test[i], pass);
+
+			accesses += 16 * 4096;
+			end = clock();
+		}
+		while ((double)(end - start) / CLOCKS_PER_SEC < seconds);
+
+		double rate = (double)accesses / ((double)(end - start) / CLOCKS_PER_SEC) / 1000000.0;
+		printf("%-14s %12.1f\n", test[i].name, rate);
+	}
+
+	JaguarDone();
+	return 0;
+}
@@ -0,0 +1,264 @@
+//
+// multirun.cpp: Runs several Jaguars at once in one process, one per thread
+//
+// Runs the same ROM on one machine by itself, then on N machines at the same
+// time (each on its own thread), & checks that every one of them comes up with
+// the same video & audio as the one that ran by itself. This is built with
+// MULTI_INSTANCE (see src/context.h), so each machine is a JaguarContext of
+// its own & they all share the one copy of the core. Core options can be given
+// as key=value pairs, e.g. virtualjaguar_usefastblitter=enabled.
+//
+// Usage: multirun <ROM> [machines] [frames] [option=value ...]
+//
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "context.h"
+#include "libretro.h"
+
+#ifndef MULTI_INSTANCE
+#error "multirun has to be built with MULTI_INSTANCE (it's what make multirun does)"
+#endif
+
+#define MAX_MACHINES		64
+#define MAX_OPTIONS			32
+
+struct Run
+{
+	uint32_t frames;
+	uint32_t videoHash;
+	uint32_t audioHash;
+	double start, end;
+	bool ok;
+};
+
+static const char * romPath;
+static const char * option[MAX_OPTIONS];
+static uint32_t numOptions = 0;
+
+// The libretro callbacks don't carry a user pointer, but each machine is only
+// ever called into from its own thread
+static __thread Run * currentRun;
+
+
+static uint32_t Hash(const void * data, size_t length, uint32_t hash)
+{
+	const uint8_t * p = (const uint8_t *)data;
+
+	for(size_t i=0; i<length; i++)
+		hash = (hash ^ p[i]) * 16777619;
+
+	return hash;
+}
+
+
+static double Now(void)
+{
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + (tv.tv_usec / 1000000.0);
+}
+
+
+static bool Environment(unsigned cmd, void * data)
+{
+	if (cmd == RETRO_ENVIRONMENT_SET_PIXEL_FORMAT)
+		return (*(const enum retro_pixel_format *)data == RETRO_PIXEL_FORMAT_XRGB8888);
+
+	if (cmd == RETRO_ENVIRONMENT_GET_VARIABLE)
+	{
+		struct retro_variable * var = (struct retro_variable *)data;
+		size_t length = strlen(var->key);
+
+		for(uint32_t i=0; i<numOptions; i++)
+		{
+			if (strncmp(option[i], var->key, length) == 0 && option[i][length] == '=')
+			{
+				var->value = option[i] + length + 1;
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+
+static void Video(const void * data, unsigned width, unsigned height, size_t pitch)
+{
+	if (!data)
+		return;
+
+	for(unsigned y=0; y<height; y++)
+		currentRun->videoHash = Hash((const uint8_t *)data + (y * pitch), width * 4, currentRun->videoHash);
+}
+
+
+static size_t Audio(const int16_t * data, size_t frames)
+{
+	currentRun->audioHash = Hash(data, frames * 4, currentRun->audioHash);
+	return frames;
+}
+
+
+static void InputPoll(void)
+{
+}
+
+
+static int16_t InputState(unsigned, unsigned, unsigned, unsigned)
+{
+	return 0;
+}
+
+
+//
+// One machine, from start to finish. Only the frames themselves are timed.
+//
+static void * RunMachine(void * data)
+{
+	Run * run = (Run *)data;
+	struct JaguarContext * context = JaguarContextCreate();
+
+	currentRun = run;
+	run->ok = false;
+
+	if (!context)
+		return NULL;
+
+	JaguarContextMakeCurrent(context);
+	retro_set_environment(Environment);
+	retro_set_video_refresh(Video);
+	retro_set_audio_sample_batch(Audio);
+	retro_set_input_poll(InputPoll);
+	retro_set_input_state(InputState);
+	retro_init();
+
+	FILE * fp = fopen(romPath, "rb");
+	void * rom = NULL;
+	long size = 0;
+
+	if (fp)
+	{
+		fseek(fp, 0, SEEK_END);
+		size = ftell(fp);
+		fseek(fp, 0, SEEK_SET);
+		rom = malloc(size);
+
+		if (rom && fread(rom, 1, size, fp) != (size_t)size)
+			free(rom), rom = NULL;
+
+		fclose(fp);
+	}
+
+	struct retro_game_info info = { romPath, rom, (size_t)size, NULL };
+
+	if (rom && retro_load_game(&info))
+	{
+		run->start = Now();
+
+		for(uint32_t i=0; i<run->frames; i++)
+			retro_run();
+
+		run->end = Now();
+		run->ok = true;
+		retro_unload_game();
+	}
+
+	retro_deinit();
+	JaguarContextDestroy(context);
+	free(rom);
+	return NULL;
+}
+
+
+//
+// Runs <count> machines side by side, & returns how long it took
+//
+static double RunMachines(Run * run, uint32_t count, uint32_t frames)
+{
+	pthread_t thread[MAX_MACHINES];
+	bool started[MAX_MACHINES];
+
+	for(uint32_t i=0; i<count; i++)
+	{
+		run[i].frames = frames;
+		run[i].videoHash = run[i].audioHash = 2166136261u;
+		run[i].ok = false;
+		started[i] = (pthread_create(&thread[i], NULL, RunMachine, &run[i]) == 0);
+	}
+
+	for(uint32_t i=0; i<count; i++)
+		if (started[i])
+			pthread_join(thread[i], NULL);
+
+	double start = 0, end = 0;
+
+	for(uint32_t i=0; i<count; i++)
+	{
+		if (!run[i].ok)
+			continue;
+
+		if (start == 0 || run[i].start < start)
+			start = run[i].start;
+
+		if (run[i].end > end)
+			end = run[i].end;
+	}
+
+	return end - start;
+}
+
+
+int main(int argc, char * argv[])
+{
+	if (argc < 2)
+	{
+		printf("Usage: %s <ROM> [machines] [frames] [option=value ...]\n", argv[0]);
+		return 1;
+	}
+
+	romPath = argv[1];
+	uint32_t count = (argc > 2 ? atoi(argv[2]) : 4);
+	uint32_t frames = (argc > 3 ? atoi(argv[3]) : 600);
+
+	for(int i=4; i<argc && numOptions<MAX_OPTIONS; i++)
+		option[numOptions++] = argv[i];
+
+	if (count < 1 || count > MAX_MACHINES)
+	{
+		printf("Machines must be between 1 and %u!\n", MAX_MACHINES);
+		return 1;
+	}
+
+	Run single, run[MAX_MACHINES];
+	double singleTime = RunMachines(&single, 1, frames);
+
+	if (!single.ok)
+	{
+		printf("Could not run %s!\n", romPath);
+		return 1;
+	}
+
+	printf("1 machine:   %8.1f frames/sec (video %08X, audio %08X)\n", frames / singleTime,
+		single.videoHash, single.audioHash);
+
+	double time = RunMachines(run, count, frames);
+	int failures = 0;
+
+	for(uint32_t i=0; i<count; i++)
+	{
+		bool same = run[i].ok && run[i].videoHash == single.videoHash && run[i].audioHash == single.audioHash;
+		printf("  machine %2u: video %08X, audio %08X%s\n", i, run[i].videoHash, run[i].audioHash,
+			(!run[i].ok ? "  FAILED!" : (same ? "" : "  MISMATCH!")));
+		failures += (same ? 0 : 1);
+	}
+
+	printf("%u machines: %8.1f frames/sec total, %.2fx a single machine\n", count,
+		(frames * count) / time, ((frames * count) / time) / (frames / singleTime));
+
+	return (failures ? 1 : 0);
+}
@@ -0,0 +1,147 @@
+//
+// scanbench.cpp: Benchmark for the TOM scanline conversion kernels
+//
+// Runs every line buffer format through each kernel set that this build & CPU
+// can do, checks the results against the plain C kernels, and reports how many
+// megapixels/sec each one manages.
+//
+// Usage: scanbench [seconds per test]
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "tom.h"
+#include "tomscan.h"
+
+extern uint32_t RGB16ToRGB32[];
+extern uint32_t CRY16ToRGB32[];
+extern uint32_t MIX16ToRGB32[];
+void TOMFillLookupTables(void);
+
+// Big enough for every 16 bit value, which is what the correctness checks use
+#define BENCH_PIXELS		0x10000
+#define LINE_PIXELS			720
+
+enum { FMT_CRY16, FMT_CRY16_DOUBLE, FMT_MIX16, FMT_RGB16, FMT_RGB24, FMT_DIRECT16, FMT_MAX };
+
+static const char * formatName[FMT_MAX] = {
+	"16 BPP CRY", "16 BPP CRY (doubled)", "Mixed CRY/RGB", "16 BPP RGB", "24 BPP RGB", "16 BPP direct"
+};
+
+static uint8_t * src;
+static uint32_t * dst;
+static uint32_t * reference;
+
+
+static void Convert(int format, uint32_t * out, uint32_t pixels)
+{
+	switch (format)
+	{
+	case FMT_CRY16:			TOMScanTable16(out, src, pixels, CRY16ToRGB32); break;
+	case FMT_CRY16_DOUBLE:	TOMScanTable16Double(out, src, pixels, CRY16ToRGB32); break;
+	case FMT_MIX16:			TOMScanTable16(out, src, pixels, MIX16ToRGB32); break;
+	case FMT_RGB16:			TOMScanRGB16(out, src, pixels); break;
+	case FMT_RGB24:			TOMScanRGB24(out, src, pixels / 2); break;
+	case FMT_DIRECT16:		TOMScanDirect16(out, src, pixels); break;
+	}
+}
+
+
+static uint32_t OutputPixels(int format, uint32_t pixels)
+{
+	return (format == FMT_CRY16_DOUBLE ? pixels * 2 : (format == FMT_RGB24 ? pixels / 2 : pixels));
+}
+
+
+int main(int argc, char * argv[])
+{
+	double seconds = (argc > 1 ? atof(argv[1]) : 0.5);
+	src = (uint8_t *)malloc(BENCH_PIXELS * 2 + 16);
+	dst = (uint32_t *)malloc((BENCH_PIXELS * 2 + 16) * sizeof(uint32_t));
+	reference = (uint32_t *)malloc(FMT_MAX * BENCH_PIXELS * 2 * sizeof(uint32_t));
+
+	if (!src || !dst || !reference)
+	{
+		printf("Out of memory!\n");
+		return 1;
+	}
+
+	TOMFillLookupTables();
+
+	// Every possible 16 bit pixel, in big endian order like the line buffer has
+	for(uint32_t i=0; i<BENCH_PIXELS; i++)
+		src[i * 2 + 0] = i >> 8, src[i * 2 + 1] = i & 0xFF;
+
+	// The scalar kernels are the reference. RGB16 gets checked against the
+	// lookup table directly, since that's what the SIMD versions have to match.
+	TOMScanSelect(SCAN_SCALAR);
+
+	for(int format=0; format<FMT_MAX; format++)
+		Convert(format, reference + format * BENCH_PIXELS * 2, BENCH_PIXELS);
+
+	for(uint32_t i=0; i<BENCH_PIXELS; i++)
+	{
+		if (reference[FMT_RGB16 * BENCH_PIXELS * 2 + i] != RGB16ToRGB32[i])
+		{
+			printf("Scalar RGB16 kernel doesn't match the lookup table at %04X!\n", i);
+			return 1;
+		}
+	}
+
+	printf("%-22s %-8s %12s %10s\n", "Format", "Kernels", "Mpixels/s", "Speedup");
+	int failures = 0;
+
+	for(int format=0; format<FMT_MAX; format++)
+	{
+		double scalarRate = 0;
+
+		for(int kernels=0; kernels<SCAN_MAX; kernels++)
+		{
+			if (!TOMScanSelect(kernels))
+				continue;
+
+			// Odd lengths & offsets make sure the leftovers get handled too
+			bool ok = true;
+
+			for(uint32_t length=0; length<=19 && ok; length++)
+			{
+				memset(dst, 0xCC, (BENCH_PIXELS * 2 + 16) * sizeof(uint32_t));
+				Convert(format, dst, BENCH_PIXELS - length);
+				uint32_t n = OutputPixels(format, BENCH_PIXELS - length);
+
+				ok = (memcmp(dst, reference + format * BENCH_PIXELS * 2, n * sizeof(uint32_t)) == 0)
+					&& dst[n] == 0xCCCCCCCC;
+			}
+
+			// Time it on line sized pieces, which is how it gets used
+			uint64_t pixels = 0;
+			clock_t start = clock(), end;
+
+			do
+			{
+				for(int i=0; i<64; i++)
+				{
+					Convert(format, dst, LINE_PIXELS);
+					pixels += OutputPixels(format, LINE_PIXELS);
+				}
+
+				end = clock();
+			}
+			while ((double)(end - start) / CLOCKS_PER_SEC < seconds);
+
+			double rate = (double)pixels / ((double)(end - start) / CLOCKS_PER_SEC) / 1000000.0;
+
+			if (kernels == SCAN_SCALAR)
+				scalarRate = rate;
+
+			printf("%-22s %-8s %12.1f %9.2fx%s\n", formatName[format], TOMScanName(kernels), rate,
+				rate / scalarRate, (ok ? "" : "  MISMATCH!"));
+			failures += (ok ? 0 : 1);
+		}
+	}
+
+	TOMScanSelect(TOMScanBest());
+	return (failures ? 1 : 0);
+}
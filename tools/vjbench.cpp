@@ -0,0 +1,295 @@
+//
+// vjbench.cpp: Runs the core headless & reports how fast it goes
+//
+// Loads a ROM the same way the libretro frontend does, then runs N frames with
+// nothing looking at the video or audio, & reports how many frames/sec that
+// came to & where the time went. With a trace file, it also writes out a hash
+// of every frame's video & audio, which makes it easy to see if (and where) a
+// change made anything come out different. Playing back a movie does the same
+// with real gameplay, & checks the run against the one that was recorded.
+//
+// Usage: vj-bench [options] <ROM>
+//
+//   -n <frames>     Number of frames to time (default 600)
+//   -w <frames>     Number of frames to run before timing starts (default 0)
+//   -t <file>       Write a per frame hash trace to <file> ("-" for stdout)
+//   -o <file>       Write everything the profiler counted to <file> as JSON
+//   -s <frames>     Frame skip: only draw 1 frame out of every <frames> + 1
+//   -m <file>       Play back a movie (times the whole movie, unless -n is given)
+//   -M <file>       Record the run (after any warmup) to a movie
+//   -l <file>       Write the emulator's log to <file>
+//   -b              Boot thru the Jaguar BIOS
+//   -p              Run as a PAL Jaguar
+//   -f              Use the fast blitter
+//   -j              Use the GPU/DSP recompiler
+//   -d              Run the DSP on its own thread
+//   -r              Convert the video on worker threads
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dac.h"
+#include "dspthread.h"
+#include "file.h"
+#include "jagbios.h"
+#include "jagbios2.h"
+#include "jaguar.h"
+#include "log.h"
+#include "movie.h"
+#include "profile.h"
+#include "settings.h"
+#include "tomthread.h"
+
+#define VIDEO_WIDTH			320
+#define VIDEO_HEIGHT		240
+#define SAMPLES_PER_FRAME	1600
+
+static uint32_t * videoBuffer;
+static uint16_t * audioBuffer;
+
+
+static uint32_t Hash(const void * data, size_t length, uint32_t hash)
+{
+	const uint8_t * p = (const uint8_t *)data;
+
+	for(size_t i=0; i<length; i++)
+		hash = (hash ^ p[i]) * 16777619;
+
+	return hash;
+}
+
+
+//
+// One frame, just like retro_run() does it
+//
+static void RunFrame(bool render)
+{
+	MovieInput();
+	JaguarExecuteNew(render || MovieCheckDue());
+
+	if (vjs.useDSPThread)
+		DSPThreadRun(audioBuffer, SAMPLES_PER_FRAME);
+	else
+	{
+		DSPThreadWait();
+		SDLSoundCallback(NULL, audioBuffer, SAMPLES_PER_FRAME);
+	}
+
+	TOMThreadWait();
+	ProfileEndFrame();
+
+	if (MovieCheckDue())
+		DSPThreadWait();
+
+	MovieEndFrame(videoBuffer, VIDEO_WIDTH, VIDEO_HEIGHT, VIDEO_WIDTH);
+}
+
+
+static void Usage(const char * name)
+{
+	printf("Usage: %s [-n frames] [-w frames] [-t trace] [-o JSON] [-s frames] [-m movie] [-M movie] [-l log] [-b] [-p] [-f] [-j] [-d] [-r] <ROM>\n", name);
+}
+
+
+int main(int argc, char * argv[])
+{
+	uint32_t frames = 600, warmup = 0, frameSkip = 0;
+	bool framesGiven = false;
+	const char * tracePath = NULL, * jsonPath = NULL, * logPath = NULL, * romPath = NULL;
+	const char * playPath = NULL, * recordPath = NULL;
+
+	memset(&vjs, 0, sizeof(vjs));
+	vjs.GPUEnabled = true;
+	vjs.DSPEnabled = true;
+	vjs.audioEnabled = true;
+	vjs.hardwareTypeNTSC = true;
+
+	for(int i=1; i<argc; i++)
+	{
+		if (argv[i][0] != '-' || argv[i][1] == 0)
+		{
+			romPath = argv[i];
+			continue;
+		}
+
+		bool needsValue = (strchr("nwtolsmM", argv[i][1]) != NULL);
+
+		if (argv[i][2] != 0 || (needsValue && i + 1 >= argc))
+		{
+			Usage(argv[0]);
+			return 1;
+		}
+
+		switch (argv[i][1])
+		{
+		case 'n': frames = atoi(argv[++i]); framesGiven = true; break;
+		case 'w': warmup = atoi(argv[++i]); break;
+		case 't': tracePath = argv[++i]; break;
+		case 'o': jsonPath = argv[++i]; break;
+		case 's': frameSkip = atoi(argv[++i]); break;
+		case 'm': playPath = argv[++i]; break;
+		case 'M': recordPath = argv[++i]; break;
+		case 'l': logPath = argv[++i]; break;
+		case 'b': vjs.useJaguarBIOS = true; break;
+		case 'p': vjs.hardwareTypeNTSC = false; break;
+		case 'f': vjs.useFastBlitter = true; break;
+		case 'j': vjs.useRISCJit = true; break;
+		case 'd': vjs.useDSPThread = true; break;
+		case 'r': vjs.useRenderThread = true; break;
+		default:
+			Usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (!romPath)
+	{
+		Usage(argv[0]);
+		return 1;
+	}
+
+	FILE * trace = NULL;
+
+	if (tracePath)
+	{
+		trace = (strcmp(tracePath, "-") == 0 ? stdout : fopen(tracePath, "w"));
+
+		if (!trace)
+		{
+			printf("Could not open %s!\n", tracePath);
+			return 1;
+		}
+	}
+
+	if (logPath)
+		LogInit(logPath);
+
+	videoBuffer = (uint32_t *)calloc(1024 * 512, sizeof(uint32_t));
+	audioBuffer = (uint16_t *)calloc(2048, sizeof(uint16_t));
+
+	if (!videoBuffer || !audioBuffer)
+	{
+		printf("Out of memory!\n");
+		return 1;
+	}
+
+	JaguarInit();
+	memcpy(jagMemSpace + 0xE00000, (vjs.biosType == BT_K_SERIES ? jaguarBootROM : jaguarBootROM2), 0x20000);
+	JaguarSetScreenPitch(VIDEO_WIDTH);
+	JaguarSetScreenBuffer(videoBuffer);
+	SET32(jaguarMainRAM, 0, 0x00200000);
+
+	if (!JaguarLoadFile((char *)romPath))
+	{
+		printf("Could not load %s!\n", romPath);
+		return 1;
+	}
+
+	JaguarReset();
+
+	for(uint32_t i=0; i<warmup; i++)
+		RunFrame(true);
+
+	if (playPath)
+	{
+		if (!MoviePlay(playPath))
+		{
+			printf("Could not play %s! (see the log for why)\n", playPath);
+			return 1;
+		}
+
+		if (!framesGiven)
+			frames = MovieLength();
+	}
+
+	if (recordPath && !MovieRecord(recordPath))
+	{
+		printf("Could not record to %s!\n", recordPath);
+		return 1;
+	}
+
+	uint32_t videoHash = 2166136261u, audioHash = 2166136261u;
+	ProfileEnable(true);
+	ProfileReset();
+	uint64_t start = ProfileClock();
+
+	for(uint32_t i=0; i<frames; i++)
+	{
+		RunFrame((i % (frameSkip + 1)) == 0);
+
+		if (trace)
+		{
+			uint32_t frameVideo = Hash(videoBuffer, VIDEO_WIDTH * VIDEO_HEIGHT * 4, 2166136261u);
+			uint32_t frameAudio = Hash(audioBuffer, SAMPLES_PER_FRAME * 2, 2166136261u);
+			fprintf(trace, "frame %u video %08X audio %08X\n", warmup + i, frameVideo, frameAudio);
+		}
+
+		videoHash = Hash(videoBuffer, VIDEO_WIDTH * VIDEO_HEIGHT * 4, videoHash);
+		audioHash = Hash(audioBuffer, SAMPLES_PER_FRAME * 2, audioHash);
+	}
+
+	// Anything that's still running on the DSP thread counts too
+	DSPThreadWait();
+	double elapsed = (double)(ProfileClock() - start) / 1000000000.0;
+	ProfileStats * stats = (ProfileStats *)malloc(sizeof(ProfileStats));
+	ProfileGetStats(stats);
+
+	printf("%s: %u frames in %.3f s, %.1f frames/sec (video %08X, audio %08X)\n", romPath, frames,
+		elapsed, (elapsed > 0 ? frames / elapsed : 0), videoHash, audioHash);
+
+	double accounted = 0;
+
+	for(int i=0; i<PROFILE_MAX; i++)
+	{
+		double time = (double)ProfileTime(i) / 1000000000.0;
+		accounted += time;
+		printf("  %-8s %9.3f ms/frame %6.1f%%\n", ProfileName(i), (frames ? time * 1000.0 / frames : 0),
+			(elapsed > 0 ? time * 100.0 / elapsed : 0));
+	}
+
+	// Whatever's left is the frame loop itself, hashing & the like. With the
+	// DSP thread on, the DSP's time overlaps the rest & this can go negative.
+	double other = elapsed - accounted;
+	printf("  %-8s %9.3f ms/frame %6.1f%%\n", "Other", (frames ? other * 1000.0 / frames : 0),
+		(elapsed > 0 ? other * 100.0 / elapsed : 0));
+
+	// Where the slowest frame spent its time
+	printf("Worst frame: %.3f ms (", stats->worst.time / 1000000.0);
+
+	for(int i=0; i<PROFILE_MAX; i++)
+		printf("%s%s %.3f", (i ? ", " : ""), ProfileName(i), stats->worst.subsystem[i].time / 1000000.0);
+
+	printf(")\n");
+
+	if (jsonPath)
+	{
+		FILE * json = fopen(jsonPath, "w");
+
+		if (json)
+		{
+			ProfileWriteJSON(json);
+			fclose(json);
+		}
+		else
+			printf("Could not open %s!\n", jsonPath);
+	}
+
+	free(stats);
+	ProfileEnable(false);
+
+	uint32_t desyncs = MovieDesyncs();
+	bool finished = (MovieFrame() >= MovieLength());
+	MovieStop();
+
+	if (playPath)
+		printf("Movie: %u frames played%s, %u desync%s\n", MovieFrame(), (finished ? "" : " (not to the end)"),
+			desyncs, (desyncs == 1 ? "" : "s"));
+
+	if (trace && trace != stdout)
+		fclose(trace);
+
+	JaguarDone();
+	LogDone();
+	return (playPath && desyncs ? 2 : 0);
+}